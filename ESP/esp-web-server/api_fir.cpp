@@ -66,13 +66,19 @@ uint32_t firFileTaps(const char* file) {
     return (uint32_t)((size + bytesPerTap - 1) / bytesPerTap);
 }
 
-uint32_t firPoolUsed(const Preset& preset, int overrideOutput, const char* overrideFile) {
+uint32_t firPoolUsed(const Preset& preset, int overrideOutput, const char* overrideFile,
+                     int overrideCompiled) {
     uint32_t used = 0;
     for (int i = 0; i < NUM_OUTPUTS; i++) {
         const char* file = (i == overrideOutput) ? overrideFile : preset.outputs[i].fir;
+        bool compiled = (i == overrideOutput && overrideCompiled >= 0) ? overrideCompiled == 1
+                                                                      : preset.outputs[i].firCompiled;
         // Charged in whole partitions - what the Teensy's static coefficient
-        // arena actually spends (see FIR_POOL_CHARGE_QUANTUM)
+        // arena actually spends (see FIR_POOL_CHARGE_QUANTUM). A compiled
+        // output's tail is charged at the cap: the Teensy sizes it to the
+        // cascade's decay, which only it computes.
         uint32_t taps = firFileTaps(file);
+        if (compiled && taps > 0) taps += FIR_COMPILE_TAIL_TAPS;
         used += (taps + FIR_POOL_CHARGE_QUANTUM - 1) / FIR_POOL_CHARGE_QUANTUM
                 * FIR_POOL_CHARGE_QUANTUM;
     }
@@ -147,6 +153,17 @@ void firPoolErrorsToJson(bool isActive, JsonObject pool) {
         entry["code"] = code;
         entry["file"] = file;
     }
+    // What each compiled output's last load cut off (FIRC lines)
+    JsonArray compiled = pool.createNestedArray("compiled");
+    for (int i = 0; i < NUM_OUTPUTS; i++) {
+        uint16_t tailTaps;
+        float truncationDb;
+        if (!getFirCompileReport(i, tailTaps, truncationDb)) continue;
+        JsonObject entry = compiled.createNestedObject();
+        entry["output"] = i;
+        entry["tailTaps"] = tailTaps;
+        entry["truncationDb"] = truncationDb;
+    }
 }
 
 // See the header: the counterpart to broadcastFirLoadError, for the
@@ -168,11 +185,17 @@ esp_err_t handleGetPresetFirPool(PsychicRequest *request) {
     }
     String presetName = request->getParam("preset_name")->value();
 
-    int presetIndex = find_preset_by_name(presetName.c_str());
+    ConfigSnapshotPtr snap = config_snapshot();
+    int presetIndex = snap->find_preset(presetName.c_str());
     if (presetIndex == -1) {
         return request->reply(404, "text/plain", "Preset not found");
     }
-    const Preset& preset = current_config.presets[presetIndex];
+    std::unique_ptr<Preset> copy;
+    const Preset* source = read_preset(*snap, presetIndex, copy);
+    if (source == nullptr) {
+        return request->reply(503, "text/plain", "Preset unavailable");
+    }
+    const Preset& preset = *source;
 
     JsonDocument doc;
     doc["total"] = FIR_TAP_POOL;
@@ -183,6 +206,7 @@ esp_err_t handleGetPresetFirPool(PsychicRequest *request) {
         entry["output"] = i;
         entry["file"] = preset.outputs[i].fir;
         entry["taps"] = firFileTaps(preset.outputs[i].fir);
+        entry["compiled"] = preset.outputs[i].firCompiled;
     }
 
     String response;
@@ -215,11 +239,16 @@ esp_err_t handlePutPresetFirEnabled(PsychicRequest *request) {
         return request->reply(409, "text/plain", "FIR changes are locked while recording");
     }
 
+    PresetRef preset(presetIndex);
+    if (!preset) {
+        return request->reply(503, "text/plain", "Preset unavailable");
+    }
+
     // Update the FIR filter enabled state
     bool enabled = (state == "on");
     {
         ConfigLock lock;
-        current_config.presets[presetIndex].firEnabled = enabled;
+        preset->firEnabled = enabled;
         scheduleConfigWrite();
     }
 
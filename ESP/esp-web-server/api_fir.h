@@ -17,14 +17,18 @@ bool isValidFirFilename(const String& filename);
 uint32_t firFileTaps(const char* file);
 
 // Total taps a preset's FIR assignments would consume. When overrideOutput
-// is >= 0 that output's file is replaced by overrideFile for the count
-// (used to price a candidate load before accepting it).
-uint32_t firPoolUsed(const Preset& preset, int overrideOutput = -1, const char* overrideFile = nullptr);
+// is >= 0 that output's file is replaced by overrideFile for the count, and
+// its compiled flag by overrideCompiled when that is 0 or 1 (used to price a
+// candidate load before accepting it). A compiled output is charged its
+// file plus the full FIR_COMPILE_TAIL_TAPS.
+uint32_t firPoolUsed(const Preset& preset, int overrideOutput = -1, const char* overrideFile = nullptr,
+                     int overrideCompiled = -1);
 
 // Serialize total/used plus per-output FIR load failures (active preset only).
 void firPoolToJson(const Preset& preset, bool isActive, JsonObject pool);
 
-// Just the "errors" array, for callers that compute "used" themselves.
+// Just the "errors" array (and the "compiled" reports), for callers that
+// compute "used" themselves.
 void firPoolErrorsToJson(bool isActive, JsonObject pool);
 
 // Push the active preset's whole tap-pool state - capacity, usage and the
@@ -3,6 +3,7 @@
 #include "config.h"
 #include "api_helpers.h"
 #include "teensy_comm.h"
+#include "mem_pool.h"
 
 esp_err_t handlePutSpeakerGain(PsychicRequest* request) {
     if (request->hasParam("speaker") && request->hasParam("value")) {
@@ -35,7 +36,7 @@ esp_err_t handlePutSpeakerGain(PsychicRequest* request) {
         return request->reply(400, "application/json", "{\"error\":\"Missing JSON body or speaker/value parameters\"}");
     }
 
-    JsonDocument doc;
+    JsonDocument doc(pooledJsonAllocator());
     DeserializationError error = deserializeJson(doc, request->body());
 
     if (error) {
@@ -2,16 +2,17 @@
 #include "config.h"
 #include "api_helpers.h"
 #include "websocket.h"
+#include "mem_pool.h"
 #include <string.h>
 
 /**
  * @brief Finds a preset by its name.
  * @param name The name of the preset to find.
- * @return The index of the preset in the current_config.presets array, or -1 if not found.
+ * @return The preset's slot index, or -1 if not found.
  */
 int find_preset_by_name(const char* name) {
     for (int i = 0; i < MAX_PRESETS; i++) {
-        if (strlen(current_config.presets[i].name) > 0 && strcmp(current_config.presets[i].name, name) == 0) {
+        if (strlen(current_config.presetNames[i]) > 0 && strcmp(current_config.presetNames[i], name) == 0) {
             return i;
         }
     }
@@ -24,22 +25,39 @@ int find_preset_by_name(const char* name) {
  */
 int find_empty_preset_slot() {
     for (int i = 0; i < MAX_PRESETS; i++) {
-        if (strlen(current_config.presets[i].name) == 0) {
+        if (strlen(current_config.presetNames[i]) == 0) {
             return i;
         }
     }
     return -1;
 }
 
+const Preset* read_preset(const ConfigSnapshot& snap, int index, std::unique_ptr<Preset>& copy) {
+    if (index == snap.active_preset_index) {
+        return &snap.active;
+    }
+    copy.reset(new (std::nothrow) Preset());
+    if (!copy || !config_copy_preset(index, *copy)) {
+        return nullptr;
+    }
+    return copy.get();
+}
+
 esp_err_t sendJsonAndBroadcast(PsychicRequest* request, const JsonDocument& doc) {
-    // Heap-backed String: V1 payloads (outputChanged with a source/filter
-    // object, firPool, template) can exceed a small stack buffer
-    String buffer;
-    serializeJson(doc, buffer);
-    if (buffer.length() > 0) {
-        broadcastWebSocket(buffer.c_str());
-        return request->reply(200, "application/json", buffer.c_str());
+    // Measured first, so the buffer is one pool block (mem_pool.h) instead
+    // of a String regrown by realloc. V1 payloads (outputChanged with a
+    // source/filter object, firPool, template) can exceed the biggest
+    // class; those come from the heap.
+    size_t len = measureJson(doc);
+    char* buffer = (char*)poolAlloc(len + 1);
+    if (buffer != nullptr && len > 0) {
+        serializeJson(doc, buffer, len + 1);
+        broadcastWebSocket(buffer);
+        esp_err_t result = request->reply(200, "application/json", buffer);
+        poolFree(buffer);
+        return result;
     }
+    poolFree(buffer);
     DebugSerial.println("Error serializing JSON response");
     return request->reply(500, "application/json", "{\"error\":\"Failed to serialize response\"}");
 }
@@ -3,10 +3,18 @@
 
 #include <PsychicHttp.h>
 #include <ArduinoJson.h>
+#include <memory>
+#include "config.h"
 
 int find_preset_by_name(const char* name);
 int find_empty_preset_slot();
 
+// A preset for a GET handler to read without the config lock: the
+// snapshot's own copy when index is the active preset, otherwise a private
+// copy in 'copy' taken under one short lock. nullptr if the slot emptied
+// in the meantime or the copy couldn't be allocated.
+const Preset* read_preset(const ConfigSnapshot& snap, int index, std::unique_ptr<Preset>& copy);
+
 // Serialize a small JSON document, send it as the HTTP response and
 // broadcast it to WebSocket clients. Every broadcast should carry a
 // "messageType" field so the UI can dispatch on it.
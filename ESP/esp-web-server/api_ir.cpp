@@ -0,0 +1,73 @@
+#include "globals.h"
+#include "api_ir.h"
+#include "config.h"
+#include "teensy_comm.h"
+#include "teensy_protocol.h"
+#include <ArduinoJson.h>
+
+// Strict 0..max integer query parameter; false if present but malformed
+static bool parseIntParam(PsychicRequest *request, const char* name, long max, int& out) {
+    if (!request->hasParam(name)) return true;
+    String param = request->getParam(name)->value();
+    char* end = nullptr;
+    long parsed = strtol(param.c_str(), &end, 10);
+    if (param.length() == 0 || end == nullptr || *end != '\0' || parsed < 0 || parsed > max) {
+        return false;
+    }
+    out = (int)parsed;
+    return true;
+}
+
+esp_err_t handlePutMeasureIrStart(PsychicRequest *request) {
+    int output = -1;
+    int level = 50;
+    if (!request->hasParam("output") || !parseIntParam(request, "output", NUM_OUTPUTS - 1, output)) {
+        return request->reply(400, "text/plain", "Output must be an integer 0-7");
+    }
+    if (!parseIntParam(request, "level", 100, level)) {
+        return request->reply(400, "text/plain", "Level must be an integer 0-100");
+    }
+
+    // Same rule as the delay probe: only what the active preset plays
+    bool enabled;
+    {
+        ConfigLock lock;
+        enabled = active_preset().outputs[output].enabled;
+    }
+    if (!enabled) {
+        return request->reply(400, "text/plain", "Output is not enabled in the active preset");
+    }
+
+    char outputStr[8], levelStr[8];
+    snprintf(outputStr, sizeof(outputStr), "%d", output);
+    snprintf(levelStr, sizeof(levelStr), "%d", level);
+    sendToTeensy(CMD_START_IR_MEASURE, outputStr, levelStr);
+
+    // How to read the result file: sample preSamples is lag 0 (sweep sent
+    // and mic captured in the same audio block), lengthSamples in all.
+    JsonDocument doc;
+    doc["status"] = "ok";
+    doc["output"] = output;
+    doc["level"] = level;
+    doc["sampleRate"] = IR_SAMPLE_RATE;
+    doc["sweepSamples"] = IR_SWEEP_SAMPLES;
+    doc["f0"] = IR_SWEEP_F0_HZ;
+    doc["f1"] = IR_SWEEP_F1_HZ;
+    doc["captureSamples"] = IR_CAPTURE_SAMPLES;
+    doc["preSamples"] = IR_PRE_SAMPLES;
+    doc["lengthSamples"] = IR_LENGTH;
+    doc["settleMs"] = IR_SETTLE_MS;
+    doc["directory"] = IR_MEASUREMENTS_DIR;
+
+    char responseBuffer[384];
+    size_t len = serializeJson(doc, responseBuffer, sizeof(responseBuffer));
+    if (len == 0 || len >= sizeof(responseBuffer)) {
+        return request->reply(500, "application/json", "{\"error\":\"Failed to serialize IR contract\"}");
+    }
+    return request->reply(200, "application/json", responseBuffer);
+}
+
+esp_err_t handlePutMeasureIrStop(PsychicRequest *request) {
+    sendToTeensy(CMD_STOP_IR_MEASURE, nullptr);
+    return request->reply(200, "application/json", "{\"status\":\"ok\"}");
+}
@@ -0,0 +1,16 @@
+#ifndef API_IR_H
+#define API_IR_H
+
+#include <PsychicHttp.h>
+
+// On-device impulse response measurement (see teensy_protocol.h for the
+// wire contract).
+// PUT /measure/ir/start?output=<0-7>&level=<0-100> - sweep one enabled
+//   output of the active preset into the analog-input measurement mic;
+//   replies with the sweep/result contract. Progress and the result file
+//   arrive as irEvent websocket messages relayed from the Teensy's IR lines.
+// PUT /measure/ir/stop                             - cancel a running one.
+esp_err_t handlePutMeasureIrStart(PsychicRequest *request);
+esp_err_t handlePutMeasureIrStop(PsychicRequest *request);
+
+#endif // API_IR_H
@@ -0,0 +1,87 @@
+#include "globals.h"
+#include "api_level_log.h"
+#include "api_helpers.h"
+#include "mem_pool.h"
+#include "config.h"
+#include "teensy_comm.h"
+#include "teensy_protocol.h"
+#include <ArduinoJson.h>
+
+// Strict integer query parameter in [min, max]; false if present but
+// malformed
+static bool parseLongParam(PsychicRequest *request, const char* name, long min, long max, long& out) {
+    if (!request->hasParam(name)) return true;
+    String param = request->getParam(name)->value();
+    char* end = nullptr;
+    long parsed = strtol(param.c_str(), &end, 10);
+    if (param.length() == 0 || end == nullptr || *end != '\0' || parsed < min || parsed > max) {
+        return false;
+    }
+    out = parsed;
+    return true;
+}
+
+esp_err_t handlePutLevelLog(PsychicRequest *request) {
+    long enabled = -1;
+    if (!request->hasParam("enabled") || !parseLongParam(request, "enabled", 0, 1, enabled)) {
+        return request->reply(400, "text/plain", "Enabled must be 0 or 1");
+    }
+
+    {
+        ConfigLock lock;
+        current_config.levelLog = enabled != 0;
+        scheduleConfigWrite();
+    }
+
+    // The Teensy answers with LOG STATE (or LOG ERR nosd/mkdir/create),
+    // relayed as a levelLogEvent
+    sendOnOffToTeensy(CMD_SET_LEVEL_LOG, enabled != 0);
+
+    JsonDocument doc(pooledJsonAllocator());
+    doc["messageType"] = "levelLogChanged";
+    doc["enabled"] = enabled != 0;
+    return sendJsonAndBroadcast(request, doc);
+}
+
+esp_err_t handlePutLevelLogQuery(PsychicRequest *request) {
+    long from = -3600;
+    long count = 3600;
+    long step = 1;
+    if (!parseLongParam(request, "from", -(long)LEVEL_LOG_CAPACITY, 0x7FFFFFFFL, from)) {
+        return request->reply(400, "text/plain", "From must be an integer (negative counts back from now)");
+    }
+    if (!parseLongParam(request, "count", 1, LEVEL_LOG_CAPACITY, count)) {
+        return request->reply(400, "text/plain", "Count must be a positive integer within the log's capacity");
+    }
+    if (!parseLongParam(request, "step", 1, LEVEL_LOG_CAPACITY, step)) {
+        return request->reply(400, "text/plain", "Step must be a positive integer within the log's capacity");
+    }
+
+    char fromStr[16], countStr[16], stepStr[16];
+    snprintf(fromStr, sizeof(fromStr), "%ld", from);
+    snprintf(countStr, sizeof(countStr), "%ld", count);
+    snprintf(stepStr, sizeof(stepStr), "%ld", step);
+    sendToTeensy(CMD_GET_LEVEL_LOG, fromStr, countStr, stepStr);
+
+    // How to read the PT lines that follow: band j of LEVEL_LOG_BANDS is
+    // centred on firstBandHz * 10^(j / bandsPerDecade) - the base-ten
+    // third octaves the RTA's grid gives, 20Hz to 20kHz
+    JsonDocument doc;
+    doc["status"] = "ok";
+    doc["from"] = from;
+    doc["count"] = count;
+    doc["step"] = step;
+    doc["intervalMs"] = LEVEL_LOG_INTERVAL_MS;
+    doc["capacity"] = LEVEL_LOG_CAPACITY;
+    doc["bands"] = LEVEL_LOG_BANDS;
+    doc["firstBandHz"] = 19.95f;
+    doc["bandsPerDecade"] = 10;
+    doc["maxPoints"] = LEVEL_LOG_MAX_POINTS;
+
+    char responseBuffer[256];
+    size_t len = serializeJson(doc, responseBuffer, sizeof(responseBuffer));
+    if (len == 0 || len >= sizeof(responseBuffer)) {
+        return request->reply(500, "application/json", "{\"error\":\"Failed to serialize level log contract\"}");
+    }
+    return request->reply(200, "application/json", responseBuffer);
+}
@@ -0,0 +1,17 @@
+#ifndef API_LEVEL_LOG_H
+#define API_LEVEL_LOG_H
+
+#include <PsychicHttp.h>
+
+// Long-term level log on the Teensy's SD card (see teensy_protocol.h for
+// the wire contract and record layout).
+// PUT /log/levels?enabled=<0|1>                        - start/stop logging;
+//   persisted, so it resumes after a reboot. Broadcast as levelLogChanged.
+// PUT /log/levels/query?from=<n>&count=<n>[&step=<n>] - read a range back:
+//   from < 0 counts back from the newest second, step folds that many
+//   seconds into each point. Replies with the decoding contract; the
+//   RANGE/PT/END lines arrive as levelLogEvent websocket messages.
+esp_err_t handlePutLevelLog(PsychicRequest *request);
+esp_err_t handlePutLevelLogQuery(PsychicRequest *request);
+
+#endif // API_LEVEL_LOG_H
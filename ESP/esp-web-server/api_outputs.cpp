@@ -5,6 +5,7 @@
 #include "config.h"
 #include "teensy_comm.h"
 #include "websocket.h"
+#include "mem_pool.h"
 #include <ArduinoJson.h>
 #include <stdlib.h>
 #include <string.h>
@@ -14,6 +15,7 @@
 struct OutputRequest {
     int presetIndex;
     int outputIndex;
+    PresetRef ref; // keeps the preset paged in for the handler's lifetime
     Preset* preset;
     Output* output;
 };
@@ -71,9 +73,15 @@ static bool getOutputRequest(PsychicRequest* request, OutputRequest& ctx, esp_er
         return false;
     }
 
+    ctx.ref.reset(presetIndex);
+    if (!ctx.ref) {
+        result = request->reply(503, "text/plain", "Preset unavailable");
+        return false;
+    }
+
     ctx.presetIndex = presetIndex;
     ctx.outputIndex = (int)outputIndex;
-    ctx.preset = &current_config.presets[presetIndex];
+    ctx.preset = ctx.ref.get();
     ctx.output = &ctx.preset->outputs[outputIndex];
     return true;
 }
@@ -118,7 +126,7 @@ esp_err_t handlePutOutputLabel(PsychicRequest *request) {
         scheduleConfigWrite();
     }
 
-    JsonDocument doc;
+    JsonDocument doc(pooledJsonAllocator());
     doc.createNestedObject("changes")["label"] = label;
     return replyOutputChanged(request, ctx, doc);
 }
@@ -148,7 +156,7 @@ esp_err_t handlePutOutputEnabled(PsychicRequest *request) {
         sendToTeensy(CMD_SET_OUTPUT_MUTE, ch, (ctx.output->mute || !enabled) ? "1" : "0");
     }
 
-    JsonDocument doc;
+    JsonDocument doc(pooledJsonAllocator());
     doc.createNestedObject("changes")["enabled"] = enabled;
     return replyOutputChanged(request, ctx, doc, flipped);
 }
@@ -182,7 +190,7 @@ esp_err_t handlePutOutputSource(PsychicRequest *request, JsonVariant &json) {
         sendToTeensy(CMD_SET_OUTPUT_SOURCE, ch, l, r);
     }
 
-    JsonDocument doc;
+    JsonDocument doc(pooledJsonAllocator());
     JsonObject source = doc.createNestedObject("changes").createNestedObject("source");
     source["left"] = left;
     source["right"] = right;
@@ -213,7 +221,7 @@ esp_err_t handlePutOutputGain(PsychicRequest *request) {
         sendToTeensy(CMD_SET_OUTPUT_GAIN, ch, db);
     }
 
-    JsonDocument doc;
+    JsonDocument doc(pooledJsonAllocator());
     doc.createNestedObject("changes")["gainDb"] = gainDb;
     return replyOutputChanged(request, ctx, doc);
 }
@@ -241,7 +249,7 @@ esp_err_t handlePutOutputMute(PsychicRequest *request) {
         sendToTeensy(CMD_SET_OUTPUT_MUTE, ch, (mute || !ctx.output->enabled) ? "1" : "0");
     }
 
-    JsonDocument doc;
+    JsonDocument doc(pooledJsonAllocator());
     doc.createNestedObject("changes")["mute"] = mute;
     return replyOutputChanged(request, ctx, doc);
 }
@@ -269,7 +277,7 @@ esp_err_t handlePutOutputInvert(PsychicRequest *request) {
         sendToTeensy(CMD_SET_OUTPUT_INVERT, ch, invert ? "1" : "0");
     }
 
-    JsonDocument doc;
+    JsonDocument doc(pooledJsonAllocator());
     doc.createNestedObject("changes")["invert"] = invert;
     return replyOutputChanged(request, ctx, doc);
 }
@@ -297,7 +305,7 @@ esp_err_t handlePutOutputDelay(PsychicRequest *request) {
         sendToTeensy(CMD_SET_OUTPUT_DELAY, ch, us);
     }
 
-    JsonDocument doc;
+    JsonDocument doc(pooledJsonAllocator());
     doc.createNestedObject("changes")["delayUs"] = delayUs;
     return replyOutputChanged(request, ctx, doc);
 }
@@ -306,6 +314,38 @@ esp_err_t handlePutOutputDelay(PsychicRequest *request) {
 // Body: {mode:'off'} | {mode:'xover', xover:id} | {mode:'manual', freq, type}.
 // hpFloor is enforced on every edit (including switching the HP off).
 
+// Apply a filter body onto 'section'. Returns nullptr, or the 400 message
+// (section is then left partly updated - callers parse into a copy).
+static const char* parseFilterSection(const Preset& preset, JsonObject body, FilterSection& section) {
+    const char* mode = body["mode"] | "";
+    if (strcmp(mode, "off") == 0) {
+        section.mode = FilterMode::Off;
+    } else if (strcmp(mode, "xover") == 0) {
+        const char* xover = body["xover"] | "";
+        if (find_crossover_by_id(preset, xover) == -1) {
+            return "Unknown crossover point";
+        }
+        section.mode = FilterMode::Xover;
+        strlcpy(section.xover, xover, sizeof(section.xover));
+    } else if (strcmp(mode, "manual") == 0) {
+        double freq = body["freq"] | -1.0;
+        const char* type = body["type"] | "LR4";
+        if (!(freq >= 20 && freq <= 20000)) {
+            return "Manual filter frequency must be between 20 and 20000 Hz";
+        }
+        if (strcmp(type, "LR2") != 0 && strcmp(type, "LR4") != 0 && strcmp(type, "BW2") != 0) {
+            return "Filter type must be one of LR2, LR4, BW2";
+        }
+        section.mode = FilterMode::Manual;
+        section.freq = freq;
+        strlcpy(section.type, type, sizeof(section.type));
+        section.xover[0] = '\0'; // a manual section drops any kept reference
+    } else {
+        return "Filter mode must be 'off', 'xover' or 'manual'";
+    }
+    return nullptr;
+}
+
 esp_err_t handlePutOutputFilter(PsychicRequest *request, JsonVariant &json) {
     OutputRequest ctx;
     esp_err_t result;
@@ -323,32 +363,9 @@ esp_err_t handlePutOutputFilter(PsychicRequest *request, JsonVariant &json) {
 
     FilterSection& section = (which == "hp") ? ctx.output->hp : ctx.output->lp;
     FilterSection updated = section; // keeps a previous xover ref across 'off'
-
-    const char* mode = body["mode"] | "";
-    if (strcmp(mode, "off") == 0) {
-        updated.mode = FilterMode::Off;
-    } else if (strcmp(mode, "xover") == 0) {
-        const char* xover = body["xover"] | "";
-        if (find_crossover_by_id(*ctx.preset, xover) == -1) {
-            return request->reply(400, "text/plain", "Unknown crossover point");
-        }
-        updated.mode = FilterMode::Xover;
-        strlcpy(updated.xover, xover, sizeof(updated.xover));
-    } else if (strcmp(mode, "manual") == 0) {
-        double freq = body["freq"] | -1.0;
-        const char* type = body["type"] | "LR4";
-        if (!(freq >= 20 && freq <= 20000)) {
-            return request->reply(400, "text/plain", "Manual filter frequency must be between 20 and 20000 Hz");
-        }
-        if (strcmp(type, "LR2") != 0 && strcmp(type, "LR4") != 0 && strcmp(type, "BW2") != 0) {
-            return request->reply(400, "text/plain", "Filter type must be one of LR2, LR4, BW2");
-        }
-        updated.mode = FilterMode::Manual;
-        updated.freq = freq;
-        strlcpy(updated.type, type, sizeof(updated.type));
-        updated.xover[0] = '\0'; // a manual section drops any kept reference
-    } else {
-        return request->reply(400, "text/plain", "Filter mode must be 'off', 'xover' or 'manual'");
+    const char* error = parseFilterSection(*ctx.preset, body, updated);
+    if (error != nullptr) {
+        return request->reply(400, "text/plain", error);
     }
 
     bool flipped;
@@ -373,7 +390,7 @@ esp_err_t handlePutOutputFilter(PsychicRequest *request, JsonVariant &json) {
         sendOutputFiltersToTeensy(ctx.outputIndex, *ctx.preset);
     }
 
-    JsonDocument doc;
+    JsonDocument doc(pooledJsonAllocator());
     filter_to_json(section, doc.createNestedObject("changes").createNestedObject(which));
     return replyOutputChanged(request, ctx, doc, flipped);
 }
@@ -433,16 +450,18 @@ esp_err_t handlePutOutputEq(PsychicRequest *request, JsonVariant &json) {
         sendToTeensy(CMD_RESET_OUTPUT_EQ, ch, from);
     }
 
-    JsonDocument doc;
+    JsonDocument doc(pooledJsonAllocator());
     doc["messageType"] = "outputEqChanged";
     doc["presetName"] = ctx.preset->name;
     doc["status"] = "ok";
     doc["output"] = ctx.outputIndex;
     doc["numPoints"] = count;
-    String buffer;
-    serializeJson(doc, buffer);
-    if (buffer.length() > 0) {
-        broadcastWebSocket(buffer.c_str());
+    size_t len = measureJson(doc);
+    char* buffer = (char*)poolAlloc(len + 1);
+    if (buffer != nullptr) {
+        serializeJson(doc, buffer, len + 1);
+        broadcastWebSocket(buffer);
+        poolFree(buffer);
     }
 
     return request->reply(204);
@@ -516,7 +535,7 @@ esp_err_t handlePutOutputEqEnabled(PsychicRequest *request) {
         sendToTeensy(CMD_SET_OUTPUT_EQ_ENABLED, ch, enabled ? "1" : "0");
     }
 
-    JsonDocument doc;
+    JsonDocument doc(pooledJsonAllocator());
     doc.createNestedObject("changes")["eqEnabled"] = enabled;
     return replyOutputChanged(request, ctx, doc);
 }
@@ -550,7 +569,7 @@ esp_err_t handlePutOutputFir(PsychicRequest *request) {
     // Pool check with this output's file swapped for the candidate
     uint32_t used = firPoolUsed(*ctx.preset, ctx.outputIndex, file.c_str());
     if (used > FIR_TAP_POOL) {
-        JsonDocument err;
+        JsonDocument err(pooledJsonAllocator());
         char message[80];
         snprintf(message, sizeof(message), "FIR tap pool exceeded: %lu of %d taps",
                  (unsigned long)used, FIR_TAP_POOL);
@@ -576,12 +595,494 @@ esp_err_t handlePutOutputFir(PsychicRequest *request) {
         loadFirFilters();
     }
 
-    JsonDocument doc;
+    JsonDocument doc(pooledJsonAllocator());
     doc.createNestedObject("changes")["fir"] = file;
     JsonObject pool = doc.createNestedObject("firPool");
     pool["total"] = FIR_TAP_POOL;
     pool["used"] = used;
-    firPoolErrorsToJson(ctx.preset == &current_config.presets[current_config.active_preset_index],
-                        pool);
+    firPoolErrorsToJson(isActivePreset(ctx), pool);
     return replyOutputChanged(request, ctx, doc);
 }
+
+// Compiled mode: the Teensy folds this output's crossover and PEQ into its
+// FIR at the next load and stops running them live. The longer filter is
+// priced at the full tail before it is accepted; what the tail cut off comes
+// back in firPool.compiled once the load reports.
+esp_err_t handlePutOutputFirCompiled(PsychicRequest *request) {
+    OutputRequest ctx;
+    esp_err_t result;
+    if (!getOutputRequest(request, ctx, result)) return result;
+
+    // Takes effect through a FIR load, same lock as a file change
+    if (isActivePreset(ctx) && isRecordingActive()) {
+        return request->reply(409, "text/plain", "FIR changes are locked while recording");
+    }
+
+    String state = request->hasParam("state") ? request->getParam("state")->value() : "";
+    if (state != "on" && state != "off") {
+        return request->reply(400, "text/plain", "Invalid state");
+    }
+    bool compiled = (state == "on");
+
+    uint32_t used = firPoolUsed(*ctx.preset, ctx.outputIndex, ctx.output->fir, compiled ? 1 : 0);
+    if (used > FIR_TAP_POOL) {
+        JsonDocument err(pooledJsonAllocator());
+        char message[80];
+        snprintf(message, sizeof(message), "FIR tap pool exceeded: %lu of %d taps",
+                 (unsigned long)used, FIR_TAP_POOL);
+        err["error"] = message;
+        err["used"] = used;
+        err["total"] = FIR_TAP_POOL;
+        String buffer;
+        serializeJson(err, buffer);
+        return request->reply(409, "application/json", buffer.c_str());
+    }
+
+    bool changed;
+    {
+        ConfigLock lock;
+        changed = ctx.output->firCompiled != compiled;
+        ctx.output->firCompiled = compiled;
+        scheduleConfigWrite();
+    }
+
+    // Nothing to reload for an output without a file, or when nothing moved
+    if (isActivePreset(ctx) && changed) {
+        char ch[8];
+        snprintf(ch, sizeof(ch), "%d", ctx.outputIndex);
+        sendToTeensy(CMD_SET_OUTPUT_FIR_COMPILED, ch, compiled ? "1" : "0");
+        if (ctx.output->fir[0] != '\0') loadFirFilters();
+    }
+
+    JsonDocument doc(pooledJsonAllocator());
+    doc.createNestedObject("changes")["firCompiled"] = compiled;
+    JsonObject pool = doc.createNestedObject("firPool");
+    pool["total"] = FIR_TAP_POOL;
+    pool["used"] = used;
+    firPoolErrorsToJson(isActivePreset(ctx), pool);
+    return replyOutputChanged(request, ctx, doc);
+}
+
+// --- Batched edits ---
+// PUT /preset/batch?preset_name=  with an ordered JSON array of operations:
+//   {op:'gain', output, value}             {op:'delay', output, value}
+//   {op:'mute'|'invert'|'enabled'|'eqEnabled', output, state:true|false}
+//   {op:'source', output, left, right}
+//   {op:'filter', output, which, mode, ...}  (the /preset/output/filter body)
+//   {op:'eqPoint', output, id, freq, gain, q}
+//   {op:'crossover', id, frequency, confirm}
+// A UI drag changes several of these at once, and one PUT per field meant a
+// lock, a validation, a burst of UART commands and a broadcast per field.
+// Here the ops apply in order to a scratch copy under one config lock, with
+// each op validated like its single endpoint, and hpFloor checked once over
+// the result. Any failure rejects the whole batch. A batch may pass through
+// states the single endpoints would refuse - raise a protected HP and then
+// drop its crossover - as long as it ends safe.
+// The Teensy gets the difference between the stored preset and the result:
+// one command per changed parameter, however many ops touched it. The reply
+// and the single broadcast (presetBatchChanged) carry the changed fields per
+// output and crossover, in the outputChanged/crossoverChanged vocabulary.
+
+#define BATCH_MAX_OPS 64
+
+enum : uint16_t {
+    BATCH_GAIN = 1 << 0,
+    BATCH_MUTE = 1 << 1,
+    BATCH_INVERT = 1 << 2,
+    BATCH_ENABLED = 1 << 3,
+    BATCH_DELAY = 1 << 4,
+    BATCH_SOURCE = 1 << 5,
+    BATCH_FILTERS = 1 << 6,
+    BATCH_EQ = 1 << 7,
+    BATCH_EQ_ENABLED = 1 << 8,
+};
+
+struct BatchError {
+    int status = 400;
+    bool locked = false; // 409 is the locked-crossover JSON shape
+    char message[128] = "";
+};
+
+static bool batchFail(BatchError& err, int status, const char* message) {
+    err.status = status;
+    strlcpy(err.message, message, sizeof(err.message));
+    return false;
+}
+
+// Apply one operation to the scratch preset. 'structural' is set for the
+// edits that flip the template to custom (see flip_template_to_custom).
+static bool applyBatchOp(Preset& preset, JsonObject op, bool& structural, BatchError& err) {
+    const char* name = op["op"] | "";
+
+    if (strcmp(name, "crossover") == 0) {
+        int index = find_crossover_by_id(preset, op["id"] | "");
+        if (index == -1) {
+            return batchFail(err, 404, "Crossover point not found");
+        }
+        if (!op["frequency"].is<double>()) {
+            return batchFail(err, 400, "Missing or invalid frequency");
+        }
+        CrossoverPoint& point = preset.crossovers[index];
+        int freq = (int)op["frequency"].as<double>();
+        if (freq < point.min || freq > point.max) {
+            snprintf(err.message, sizeof(err.message), "Crossover frequency must be between %u and %u Hz",
+                     point.min, point.max);
+            err.status = 400;
+            return false;
+        }
+        if (point.locked && !(op["confirm"] | false)) {
+            snprintf(err.message, sizeof(err.message),
+                     "Crossover point %s is locked. Re-send with confirm=true to apply.", point.id);
+            err.status = 409;
+            err.locked = true;
+            return false;
+        }
+        point.freq = freq;
+        return true;
+    }
+
+    int outputIndex = op["output"] | -1;
+    if (!op["output"].is<int>() || outputIndex < 0 || outputIndex >= NUM_OUTPUTS) {
+        return batchFail(err, 400, "Output must be an integer 0-7");
+    }
+    Output& output = preset.outputs[outputIndex];
+
+    if (strcmp(name, "gain") == 0) {
+        if (!op["value"].is<double>()) {
+            return batchFail(err, 400, "Missing or invalid value");
+        }
+        output.gainDb = clampd(op["value"].as<double>(), OUTPUT_GAIN_MIN_DB, OUTPUT_GAIN_MAX_DB);
+    } else if (strcmp(name, "delay") == 0) {
+        double delayUs = op["value"] | -1.0;
+        if (!op["value"].is<double>() || delayUs < 0 || delayUs > MAX_DELAY_US) {
+            return batchFail(err, 400, "Delay must be between 0 and 20000 microseconds");
+        }
+        output.delayUs = delayUs;
+    } else if (strcmp(name, "mute") == 0 || strcmp(name, "invert") == 0 ||
+               strcmp(name, "enabled") == 0 || strcmp(name, "eqEnabled") == 0) {
+        if (!op["state"].is<bool>()) {
+            return batchFail(err, 400, "Invalid state");
+        }
+        bool state = op["state"].as<bool>();
+        if (strcmp(name, "mute") == 0) {
+            output.mute = state;
+        } else if (strcmp(name, "invert") == 0) {
+            output.invert = state;
+        } else if (strcmp(name, "eqEnabled") == 0) {
+            output.eqEnabled = state;
+        } else {
+            output.enabled = state;
+            structural = true;
+        }
+    } else if (strcmp(name, "source") == 0) {
+        if (!op["left"].is<double>() || !op["right"].is<double>()) {
+            return batchFail(err, 400, "Expected numeric left and right");
+        }
+        output.sourceLeft = clampd(op["left"].as<double>(), 0.0, 1.0);
+        output.sourceRight = clampd(op["right"].as<double>(), 0.0, 1.0);
+        structural = true;
+    } else if (strcmp(name, "filter") == 0) {
+        const char* which = op["which"] | "";
+        if (strcmp(which, "hp") != 0 && strcmp(which, "lp") != 0) {
+            return batchFail(err, 400, "Parameter 'which' must be 'hp' or 'lp'");
+        }
+        FilterSection& section = (which[0] == 'h') ? output.hp : output.lp;
+        FilterSection updated = section;
+        const char* error = parseFilterSection(preset, op, updated);
+        if (error != nullptr) {
+            return batchFail(err, 400, error);
+        }
+        section = updated;
+        structural = true;
+    } else if (strcmp(name, "eqPoint") == 0) {
+        int id = op["id"] | -1;
+        if (id < 0 || id >= MAX_OUTPUT_PEQ) {
+            return batchFail(err, 400, "PEQ point ID out of bounds");
+        }
+        if (id > output.num_peq) {
+            return batchFail(err, 400, "PEQ point ID would leave a gap");
+        }
+        PEQPoint& stored = output.peq[id];
+        stored.freq = clampf(op["freq"] | 1000.0f, 20.0f, 20000.0f);
+        stored.gain = clampf(op["gain"] | 0.0f, -15.0f, 15.0f);
+        stored.q    = clampf(op["q"] | 1.0f, 0.1f, 10.0f);
+        if (id >= output.num_peq) {
+            output.num_peq = id + 1;
+        }
+    } else {
+        return batchFail(err, 400, "Unknown op");
+    }
+    return true;
+}
+
+static bool sameSection(const FilterSection& a, const FilterSection& b) {
+    return a.mode == b.mode && a.freq == b.freq &&
+           strcmp(a.xover, b.xover) == 0 && strcmp(a.type, b.type) == 0;
+}
+
+static bool sameResolved(const Preset& before, const FilterSection& a,
+                         const Preset& after, const FilterSection& b) {
+    return resolve_filter_freq(before, a) == resolve_filter_freq(after, b) &&
+           strcmp(resolve_filter_type(before, a), resolve_filter_type(after, b)) == 0;
+}
+
+// What changed on one output. Filters count as changed when a section was
+// edited or when what it resolves to moved (a referenced crossover).
+// eqPoints gets one bit per point that differs or was appended.
+static uint16_t outputChanges(const Preset& before, const Preset& after, int ch, uint16_t& eqPoints) {
+    const Output& a = before.outputs[ch];
+    const Output& b = after.outputs[ch];
+    uint16_t changed = 0;
+    if (a.gainDb != b.gainDb) changed |= BATCH_GAIN;
+    if (a.mute != b.mute) changed |= BATCH_MUTE;
+    if (a.invert != b.invert) changed |= BATCH_INVERT;
+    if (a.enabled != b.enabled) changed |= BATCH_ENABLED;
+    if (a.delayUs != b.delayUs) changed |= BATCH_DELAY;
+    if (a.sourceLeft != b.sourceLeft || a.sourceRight != b.sourceRight) changed |= BATCH_SOURCE;
+    if (a.eqEnabled != b.eqEnabled) changed |= BATCH_EQ_ENABLED;
+    if (!sameSection(a.hp, b.hp) || !sameSection(a.lp, b.lp) ||
+        !sameResolved(before, a.hp, after, b.hp) || !sameResolved(before, a.lp, after, b.lp)) {
+        changed |= BATCH_FILTERS;
+    }
+    eqPoints = 0;
+    for (int i = 0; i < b.num_peq; i++) {
+        if (i >= a.num_peq || a.peq[i].freq != b.peq[i].freq ||
+            a.peq[i].gain != b.peq[i].gain || a.peq[i].q != b.peq[i].q) {
+            eqPoints |= (uint16_t)(1u << i);
+        }
+    }
+    if (eqPoints != 0 || a.num_peq != b.num_peq) changed |= BATCH_EQ;
+    return changed;
+}
+
+// How far ahead a batch's gain changes are stamped: time for its stamped
+// commands (two per output, ~400 bytes at 115200 baud) and whatever is
+// already queued to reach the Teensy. A stamp that arrives late still
+// applies, at the next audio block, as an unstamped command would.
+#define BATCH_STAMP_LEAD_MS 100
+
+// The gain commands of one output's batch, all due on dueSample when
+// stamped, so a batch across outputs lands on one sample.
+static void sendBatchGainsToTeensy(const Preset& preset, int ch, uint16_t changed,
+                                   bool stamped, uint32_t dueSample) {
+    const Output& output = preset.outputs[ch];
+    char chStr[8], a[16];
+    snprintf(chStr, sizeof(chStr), "%d", ch);
+    const char* command[3] = {};
+    const char* value[3] = {};
+    int count = 0;
+    if (changed & BATCH_GAIN) {
+        snprintf(a, sizeof(a), "%.2f", output.gainDb);
+        command[count] = CMD_SET_OUTPUT_GAIN;
+        value[count++] = a;
+    }
+    if (changed & (BATCH_MUTE | BATCH_ENABLED)) {
+        command[count] = CMD_SET_OUTPUT_MUTE;
+        value[count++] = (output.mute || !output.enabled) ? "1" : "0";
+    }
+    if (changed & BATCH_INVERT) {
+        command[count] = CMD_SET_OUTPUT_INVERT;
+        value[count++] = output.invert ? "1" : "0";
+    }
+    for (int i = 0; i < count; i++) {
+        if (stamped) sendStampedToTeensy(dueSample, command[i], chStr, value[i]);
+        else sendToTeensy(command[i], chStr, value[i]);
+    }
+}
+
+// Everything else a batch changed on one output, applied on arrival
+static void sendBatchOutputToTeensy(const Preset& preset, int ch, uint16_t changed, uint16_t eqPoints) {
+    const Output& output = preset.outputs[ch];
+    char chStr[8], a[16], b[16];
+    snprintf(chStr, sizeof(chStr), "%d", ch);
+    if (changed & BATCH_DELAY) {
+        snprintf(a, sizeof(a), "%d", (int)output.delayUs);
+        sendToTeensy(CMD_SET_OUTPUT_DELAY, chStr, a);
+    }
+    if (changed & BATCH_SOURCE) {
+        snprintf(a, sizeof(a), "%.4f", output.sourceLeft);
+        snprintf(b, sizeof(b), "%.4f", output.sourceRight);
+        sendToTeensy(CMD_SET_OUTPUT_SOURCE, chStr, a, b);
+    }
+    if (changed & BATCH_FILTERS) {
+        sendOutputFiltersToTeensy(ch, preset);
+    }
+    for (int i = 0; i < output.num_peq; i++) {
+        if (eqPoints & (1u << i)) {
+            sendOutputEqPointToTeensy(ch, i, output.peq[i]);
+        }
+    }
+    if (changed & BATCH_EQ_ENABLED) {
+        sendToTeensy(CMD_SET_OUTPUT_EQ_ENABLED, chStr, output.eqEnabled ? "1" : "0");
+    }
+}
+
+static void batchChangesToJson(const Output& output, uint16_t changed, JsonObject changes) {
+    if (changed & BATCH_GAIN) changes["gainDb"] = output.gainDb;
+    if (changed & BATCH_MUTE) changes["mute"] = output.mute;
+    if (changed & BATCH_INVERT) changes["invert"] = output.invert;
+    if (changed & BATCH_ENABLED) changes["enabled"] = output.enabled;
+    if (changed & BATCH_DELAY) changes["delayUs"] = output.delayUs;
+    if (changed & BATCH_SOURCE) {
+        JsonObject source = changes.createNestedObject("source");
+        source["left"] = output.sourceLeft;
+        source["right"] = output.sourceRight;
+    }
+    if (changed & BATCH_FILTERS) {
+        filter_to_json(output.hp, changes.createNestedObject("hp"));
+        filter_to_json(output.lp, changes.createNestedObject("lp"));
+    }
+    if (changed & BATCH_EQ) {
+        JsonArray peq = changes.createNestedArray("peq");
+        for (int i = 0; i < output.num_peq; i++) {
+            JsonObject point = peq.createNestedObject();
+            point["freq"] = output.peq[i].freq;
+            point["gain"] = output.peq[i].gain;
+            point["q"] = output.peq[i].q;
+        }
+    }
+    if (changed & BATCH_EQ_ENABLED) changes["eqEnabled"] = output.eqEnabled;
+}
+
+esp_err_t handlePutPresetBatch(PsychicRequest *request, JsonVariant &json) {
+    if (!request->hasParam("preset_name")) {
+        return request->reply(400, "text/plain", "Missing preset_name parameter");
+    }
+    JsonArray ops = json.as<JsonArray>();
+    if (ops.isNull()) {
+        return request->reply(400, "text/plain", "Expected a JSON array of operations");
+    }
+    if ((int)ops.size() > BATCH_MAX_OPS) {
+        return request->reply(400, "text/plain", "Too many operations");
+    }
+
+    int presetIndex = find_preset_by_name(request->getParam("preset_name")->value().c_str());
+    if (presetIndex == -1) {
+        return request->reply(404, "text/plain", "Preset not found");
+    }
+    PresetRef presetRef(presetIndex);
+    if (!presetRef) {
+        return request->reply(503, "text/plain", "Preset unavailable");
+    }
+    Preset* preset = presetRef.get();
+
+    // The result is built beside the stored preset, so the diff below has
+    // both, and a rejected batch has nothing to undo
+    std::unique_ptr<Preset> scratch(new (std::nothrow) Preset());
+    if (!scratch) {
+        return request->reply(503, "text/plain", "Not enough memory for the batch");
+    }
+
+    BatchError err;
+    int failedOp = -1;
+    int violation = -1;
+    bool structural = false;
+    bool flipped = false;
+    bool anyChange = false;
+    uint16_t changed[NUM_OUTPUTS] = {};
+    uint16_t eqPoints[NUM_OUTPUTS] = {};
+    bool xoverChanged[MAX_CROSSOVER_POINTS] = {};
+    {
+        ConfigLock lock;
+        *scratch = *preset;
+        int i = 0;
+        for (JsonObject op : ops) {
+            if (!applyBatchOp(*scratch, op, structural, err)) {
+                failedOp = i;
+                break;
+            }
+            i++;
+        }
+        if (failedOp < 0) {
+            violation = hp_floor_violation(*scratch);
+        }
+        if (failedOp < 0 && violation < 0) {
+            for (int ch = 0; ch < NUM_OUTPUTS; ch++) {
+                changed[ch] = outputChanges(*preset, *scratch, ch, eqPoints[ch]);
+                anyChange |= changed[ch] != 0;
+            }
+            for (int x = 0; x < scratch->num_crossovers; x++) {
+                xoverChanged[x] = preset->crossovers[x].freq != scratch->crossovers[x].freq;
+                anyChange |= xoverChanged[x];
+            }
+            if (anyChange) {
+                if (structural) {
+                    flipped = flip_template_to_custom(*scratch);
+                }
+                *preset = *scratch;
+                scheduleConfigWrite();
+            }
+        }
+    }
+
+    if (failedOp >= 0) {
+        char message[160];
+        snprintf(message, sizeof(message), "Operation %d: %s", failedOp, err.message);
+        if (err.locked) {
+            JsonDocument doc(pooledJsonAllocator());
+            doc["error"] = message;
+            doc["locked"] = true;
+            doc["op"] = failedOp;
+            String buffer;
+            serializeJson(doc, buffer);
+            return request->reply(409, "application/json", buffer.c_str());
+        }
+        return request->reply(err.status, "text/plain", message);
+    }
+    if (violation >= 0) {
+        const Output& out = scratch->outputs[violation];
+        char message[128];
+        snprintf(message, sizeof(message), "Output %d (%s) requires a high-pass at or above %u Hz",
+                 violation + 1, out.label, out.hpFloor);
+        return request->reply(409, "text/plain", message);
+    }
+
+    if (presetIndex == current_config.active_preset_index) {
+        // Gains first and on one shared sample, ahead of the slower filter
+        // and EQ commands; unstamped when the Teensy's clock is unknown
+        uint32_t dueSample = 0;
+        const bool stamped = teensyClockAhead(BATCH_STAMP_LEAD_MS, dueSample);
+        for (int ch = 0; ch < NUM_OUTPUTS; ch++) {
+            if (changed[ch] != 0) {
+                sendBatchGainsToTeensy(*scratch, ch, changed[ch], stamped, dueSample);
+            }
+        }
+        for (int ch = 0; ch < NUM_OUTPUTS; ch++) {
+            if (changed[ch] != 0) {
+                sendBatchOutputToTeensy(*scratch, ch, changed[ch], eqPoints[ch]);
+            }
+        }
+    }
+
+    JsonDocument doc(pooledJsonAllocator());
+    doc["messageType"] = "presetBatchChanged";
+    doc["presetName"] = scratch->name;
+    doc["status"] = "ok";
+    doc["applied"] = (int)ops.size();
+    JsonArray outputs = doc.createNestedArray("outputs");
+    for (int ch = 0; ch < NUM_OUTPUTS; ch++) {
+        if (changed[ch] == 0) continue;
+        JsonObject entry = outputs.createNestedObject();
+        entry["output"] = ch;
+        batchChangesToJson(scratch->outputs[ch], changed[ch], entry.createNestedObject("changes"));
+    }
+    JsonArray crossovers = doc.createNestedArray("crossovers");
+    for (int x = 0; x < scratch->num_crossovers; x++) {
+        if (!xoverChanged[x]) continue;
+        JsonObject entry = crossovers.createNestedObject();
+        entry["id"] = scratch->crossovers[x].id;
+        entry["crossoverFreq"] = scratch->crossovers[x].freq;
+    }
+    if (flipped) {
+        doc["template"] = "custom";
+    }
+
+    // A batch that changed nothing (values already set) is answered but not
+    // broadcast - there is nothing for other clients to merge
+    if (!anyChange) {
+        String buffer;
+        serializeJson(doc, buffer);
+        return request->reply(200, "application/json", buffer.c_str());
+    }
+    return sendJsonAndBroadcast(request, doc);
+}
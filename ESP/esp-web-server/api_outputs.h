@@ -19,5 +19,10 @@ esp_err_t handlePutOutputEq(PsychicRequest *request, JsonVariant &json);
 esp_err_t handlePutOutputEqPoint(PsychicRequest *request, JsonVariant &json);
 esp_err_t handlePutOutputEqEnabled(PsychicRequest *request);
 esp_err_t handlePutOutputFir(PsychicRequest *request);
+esp_err_t handlePutOutputFirCompiled(PsychicRequest *request);
+
+// PUT /preset/batch?preset_name= - an ordered array of output and crossover
+// edits applied atomically, with one Teensy sync and one broadcast.
+esp_err_t handlePutPresetBatch(PsychicRequest *request, JsonVariant &json);
 
 #endif // API_OUTPUTS_H
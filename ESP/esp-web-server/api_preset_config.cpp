@@ -5,28 +5,45 @@
 #include "teensy_comm.h"
 #include "config.h"
 #include "api_helpers.h"
+#include "mem_pool.h"
 #include <string.h>
 #include <ArduinoJson.h>
 
-// Find the input-EQ set for spl=0, creating it in a free slot if needed.
-// Returns nullptr when all slots are taken by other SPL values.
-static PEQSet* getOrCreateSpl0Set(Preset* preset) {
+// Find the input-EQ set for an SPL, creating it in a free slot if needed
+// (*created says so: the Teensy then needs the new slot's level). Returns
+// nullptr when all slots are taken by other SPL values.
+static PEQSet* getOrCreateSplSet(Preset* preset, int spl, bool* created = nullptr) {
     PEQSet* sets = preset->inputEq.sets;
+    if (created) *created = false;
     for (int i = 0; i < MAX_PEQ_SETS; i++) {
-        if (sets[i].spl == 0) {
+        if (sets[i].spl == spl) {
             return &sets[i];
         }
     }
     for (int i = 0; i < MAX_PEQ_SETS; i++) {
         if (sets[i].spl == -1) { // free slot
-            sets[i].spl = 0;
+            sets[i].spl = spl;
             sets[i].num_points = 0;
+            if (created) *created = true;
             return &sets[i];
         }
     }
     return nullptr;
 }
 
+// The optional "spl" query parameter of the EQ point routes: which SPL
+// set to edit, 0 (the preference curve) when absent. False if out of range.
+static bool parseSplParam(PsychicRequest* request, int& spl) {
+    spl = 0;
+    if (!request->hasParam("spl")) return true;
+    String value = request->getParam("spl")->value();
+    char* end = nullptr;
+    long parsed = strtol(value.c_str(), &end, 10);
+    if (value.length() == 0 || *end != '\0' || parsed < 0 || parsed > INPUT_EQ_SPL_MAX) return false;
+    spl = (int)parsed;
+    return true;
+}
+
 static float clampf(float value, float lo, float hi) {
     if (value < lo) return lo;
     if (value > hi) return hi;
@@ -36,7 +53,7 @@ static float clampf(float value, float lo, float hi) {
 // 409 for a write to a locked crossover point without confirm=true. This one
 // is JSON (not text/plain): the UI dispatches on the locked flag.
 static esp_err_t replyLocked(PsychicRequest* request, const char* id) {
-    JsonDocument doc;
+    JsonDocument doc(pooledJsonAllocator());
     char message[96];
     snprintf(message, sizeof(message),
              "Crossover point %s is locked. Re-send with confirm=true to apply.", id);
@@ -89,7 +106,11 @@ esp_err_t handlePutPresetCrossover(PsychicRequest *request) {
     if (presetIndex == -1) {
         return request->reply(404, "text/plain", "Preset not found");
     }
-    Preset* preset = &current_config.presets[presetIndex];
+    PresetRef presetRef(presetIndex);
+    if (!presetRef) {
+        return request->reply(503, "text/plain", "Preset unavailable");
+    }
+    Preset* preset = presetRef.get();
 
     int xoverIndex = find_crossover_by_id(*preset, id.c_str());
     if (xoverIndex == -1) {
@@ -122,7 +143,7 @@ esp_err_t handlePutPresetCrossover(PsychicRequest *request) {
 
     syncCrossoverReferencesToTeensy(presetIndex, *preset, point.id);
 
-    JsonDocument doc;
+    JsonDocument doc(pooledJsonAllocator());
     doc["messageType"] = "crossoverChanged";
     doc["presetName"] = presetName;
     doc["status"] = "ok";
@@ -154,7 +175,11 @@ esp_err_t handlePutPresetCrossoverEnabled(PsychicRequest *request) {
     if (presetIndex == -1) {
         return request->reply(404, "text/plain", "Preset not found");
     }
-    Preset* preset = &current_config.presets[presetIndex];
+    PresetRef presetRef(presetIndex);
+    if (!presetRef) {
+        return request->reply(503, "text/plain", "Preset unavailable");
+    }
+    Preset* preset = presetRef.get();
 
     int xoverIndex = find_crossover_by_id(*preset, id.c_str());
     if (xoverIndex == -1) {
@@ -193,7 +218,7 @@ esp_err_t handlePutPresetCrossoverEnabled(PsychicRequest *request) {
 
     syncCrossoverReferencesToTeensy(presetIndex, *preset, id.c_str());
 
-    JsonDocument doc;
+    JsonDocument doc(pooledJsonAllocator());
     doc["messageType"] = "crossoverEnabledChanged";
     doc["presetName"] = presetName;
     doc["status"] = "ok";
@@ -221,7 +246,11 @@ esp_err_t handlePutPresetDynamics(PsychicRequest *request, JsonVariant &json) {
         return request->reply(400, "text/plain", "Expected a JSON dynamics object");
     }
 
-    Preset* preset = &current_config.presets[presetIndex];
+    PresetRef presetRef(presetIndex);
+    if (!presetRef) {
+        return request->reply(503, "text/plain", "Preset unavailable");
+    }
+    Preset* preset = presetRef.get();
     {
         ConfigLock lock;
         Dynamics& dyn = preset->dynamics;
@@ -250,7 +279,7 @@ esp_err_t handlePutPresetDynamics(PsychicRequest *request, JsonVariant &json) {
         sendDynamicsToTeensy(preset->dynamics);
     }
 
-    JsonDocument responseDoc;
+    JsonDocument responseDoc(pooledJsonAllocator());
     responseDoc["messageType"] = "dynamicsChanged";
     responseDoc["presetName"] = presetName;
     responseDoc["status"] = "ok";
@@ -283,11 +312,21 @@ esp_err_t handlePutPresetEQPoints(PsychicRequest *request, JsonVariant &json) {
         return request->reply(404, "text/plain", "Preset not found");
     }
 
-    Preset* preset = &current_config.presets[presetIndex];
-    PEQSet* target_set = getOrCreateSpl0Set(preset);
+    PresetRef presetRef(presetIndex);
+    if (!presetRef) {
+        return request->reply(503, "text/plain", "Preset unavailable");
+    }
+    int spl;
+    if (!parseSplParam(request, spl)) {
+        return request->reply(400, "text/plain", "spl out of range");
+    }
+    Preset* preset = presetRef.get();
+    bool created;
+    PEQSet* target_set = getOrCreateSplSet(preset, spl, &created);
     if (target_set == nullptr) {
-        return request->reply(507, "text/plain", "No available EQ set slots to create default spl=0 set.");
+        return request->reply(507, "text/plain", "No available EQ set slots for this spl.");
     }
+    const int set_index = (int)(target_set - preset->inputEq.sets);
 
     JsonArray pointsArray = json.as<JsonArray>();
     if (pointsArray.isNull()) {
@@ -324,24 +363,26 @@ esp_err_t handlePutPresetEQPoints(PsychicRequest *request, JsonVariant &json) {
     }
 
     if (presetIndex == current_config.active_preset_index) {
+        if (created) sendInputEqLevelsToTeensy(preset->inputEq);
         // Queue only the points that actually changed...
         for (int i = 0; i < count; i++) {
             if (changed[i]) {
-                sendInputEqPointToTeensy(i, target_set->points[i]);
+                sendInputEqPointToTeensy(set_index, i, target_set->points[i]);
             }
         }
         // ...and disable every band beyond the active points with a single command
-        char fromIndex[8];
+        char setStr[8], fromIndex[8];
+        snprintf(setStr, sizeof(setStr), "%d", set_index);
         snprintf(fromIndex, sizeof(fromIndex), "%d", count);
-        sendToTeensy(CMD_RESET_INPUT_EQ, fromIndex);
+        sendToTeensy(CMD_RESET_INPUT_EQ, setStr, fromIndex);
     }
 
-    JsonDocument responseDoc;
+    JsonDocument responseDoc(pooledJsonAllocator());
     responseDoc["messageType"] = "eqPointsChanged";
     responseDoc["presetName"] = presetName;
     responseDoc["status"] = "ok";
     responseDoc["eqType"] = "pref";
-    responseDoc["spl"] = 0;
+    responseDoc["spl"] = spl;
     responseDoc["numPoints"] = target_set->num_points;
     char buffer[192];
     size_t len = serializeJson(responseDoc, buffer, sizeof(buffer));
@@ -373,11 +414,21 @@ esp_err_t handlePutPresetEQPoint(PsychicRequest *request, JsonVariant &json) {
         return request->reply(400, "text/plain", "PEQ point ID out of bounds");
     }
 
-    Preset* preset = &current_config.presets[presetIndex];
-    PEQSet* target_set = getOrCreateSpl0Set(preset);
+    PresetRef presetRef(presetIndex);
+    if (!presetRef) {
+        return request->reply(503, "text/plain", "Preset unavailable");
+    }
+    int spl;
+    if (!parseSplParam(request, spl)) {
+        return request->reply(400, "text/plain", "spl out of range");
+    }
+    Preset* preset = presetRef.get();
+    bool created;
+    PEQSet* target_set = getOrCreateSplSet(preset, spl, &created);
     if (target_set == nullptr) {
-        return request->reply(507, "text/plain", "No available EQ set slots to create default spl=0 set.");
+        return request->reply(507, "text/plain", "No available EQ set slots for this spl.");
     }
+    const int set_index = (int)(target_set - preset->inputEq.sets);
 
     // Allow updating an existing point or appending directly after the last
     // one; a larger id would mark the skipped-over stale points as active.
@@ -398,7 +449,8 @@ esp_err_t handlePutPresetEQPoint(PsychicRequest *request, JsonVariant &json) {
     }
 
     if (presetIndex == current_config.active_preset_index) {
-        sendInputEqPointToTeensy(id, target_set->points[id]);
+        if (created) sendInputEqLevelsToTeensy(preset->inputEq);
+        sendInputEqPointToTeensy(set_index, id, target_set->points[id]);
     }
 
     return request->reply(204);
@@ -420,8 +472,13 @@ esp_err_t handlePutPresetEQEnabled(PsychicRequest *request) {
         return request->reply(404, "text/plain", "Preset not found");
     }
 
-    Preset* preset = &current_config.presets[presetIndex];
-    if (getOrCreateSpl0Set(preset) == nullptr) {
+    PresetRef presetRef(presetIndex);
+    if (!presetRef) {
+        return request->reply(503, "text/plain", "Preset unavailable");
+    }
+    Preset* preset = presetRef.get();
+    bool created;
+    if (getOrCreateSplSet(preset, 0, &created) == nullptr) {
         return request->reply(507, "text/plain", "No available EQ set slots to create default spl=0 set.");
     }
 
@@ -433,10 +490,11 @@ esp_err_t handlePutPresetEQEnabled(PsychicRequest *request) {
     }
 
     if (presetIndex == current_config.active_preset_index) {
+        if (created) sendInputEqLevelsToTeensy(preset->inputEq);
         sendOnOffToTeensy(CMD_SET_INPUT_EQ_ENABLED, enabled);
     }
 
-    JsonDocument doc;
+    JsonDocument doc(pooledJsonAllocator());
     doc["messageType"] = "eqEnabledChanged";
     doc["presetName"] = presetName;
     doc["status"] = "ok";
@@ -13,14 +13,15 @@
 // --- API Handlers ---
 
 esp_err_t handleGetPresets(PsychicRequest *request) {
+    ConfigSnapshotPtr snap = config_snapshot();
     JsonDocument doc;
     JsonArray presets = doc.to<JsonArray>();
 
     for (int i = 0; i < MAX_PRESETS; i++) {
-        if (strlen(current_config.presets[i].name) > 0) {
+        if (snap->presetNames[i][0] != '\0') {
             JsonObject preset = presets.createNestedObject();
-            preset["name"] = current_config.presets[i].name;
-            preset["isCurrent"] = (i == current_config.active_preset_index);
+            preset["name"] = snap->presetNames[i];
+            preset["isCurrent"] = (i == snap->active_preset_index);
         }
     }
 
@@ -53,16 +54,26 @@ esp_err_t handleGetPreset(PsychicRequest *request) {
         return request->reply(400, "text/plain", "Missing required parameters");
     }
     String presetName = request->getParam("name")->value();
-    int presetIndex = find_preset_by_name(presetName.c_str());
 
+    // Read from the snapshot (config.h): the active preset is already in it;
+    // any other is copied out under one short lock. Either way the config
+    // lock is free again before the JSON is built and sent.
+    ConfigSnapshotPtr snap = config_snapshot();
+    int presetIndex = snap->find_preset(presetName.c_str());
     if (presetIndex == -1) {
         return request->reply(404, "text/plain", "Preset not found");
     }
+    std::unique_ptr<Preset> copy;
+    const Preset* source = read_preset(*snap, presetIndex, copy);
+    if (source == nullptr) {
+        return request->reply(503, "text/plain", "Preset unavailable");
+    }
+    const Preset& preset = *source;
+    const bool isActive = presetIndex == snap->active_preset_index;
 
-    const Preset& preset = current_config.presets[presetIndex];
     JsonDocument doc;
     doc["name"] = preset.name;
-    doc["isCurrent"] = presetIndex == current_config.active_preset_index;
+    doc["isCurrent"] = isActive;
     doc["template"] = preset.templateId;
 
     JsonArray crossovers = doc.createNestedArray("crossovers");
@@ -82,8 +93,7 @@ esp_err_t handleGetPreset(PsychicRequest *request) {
     doc["volume"] = preset.volume;
     dynamics_to_json(preset.dynamics, doc.createNestedObject("dynamics"));
 
-    firPoolToJson(preset, presetIndex == current_config.active_preset_index,
-                  doc.createNestedObject("firPool"));
+    firPoolToJson(preset, isActive, doc.createNestedObject("firPool"));
 
     String response;
     serializeJson(doc, response);
@@ -125,10 +135,14 @@ esp_err_t handlePostPresetCreate(PsychicRequest *request) {
         return request->reply(507, "text/plain", "Maximum number of presets reached");
     }
 
+    // An empty slot pages in as a blank preset, so this reads no flash
+    PresetRef preset(newIndex);
+    if (!preset) {
+        return request->reply(503, "text/plain", "Preset unavailable");
+    }
     ConfigLock lock;
-    Preset& preset = current_config.presets[newIndex];
-    build_preset_from_template(preset, templateId.c_str());
-    strlcpy(preset.name, presetName.c_str(), sizeof(preset.name));
+    build_preset_from_template(*preset, templateId.c_str());
+    set_preset_name(newIndex, presetName.c_str());
 
     scheduleConfigWrite();
     return request->reply(201, "application/json", "{}");
@@ -159,12 +173,20 @@ esp_err_t handlePostPresetCopy(PsychicRequest *request) {
         return request->reply(507, "text/plain", "Maximum number of presets reached");
     }
 
-    // Copy the preset struct
+    // Copy the preset struct. The source is read without pinning it, so this
+    // handler holds one cache entry (the destination) like every other.
+    std::unique_ptr<Preset> source(new (std::nothrow) Preset());
+    if (!source || !config_copy_preset(sourceIndex, *source)) {
+        return request->reply(503, "text/plain", "Preset unavailable");
+    }
+    PresetRef dest(destIndex);
+    if (!dest) {
+        return request->reply(503, "text/plain", "Preset unavailable");
+    }
     ConfigLock lock;
-    current_config.presets[destIndex] = current_config.presets[sourceIndex];
+    *dest = *source;
     // Update the name
-    strlcpy(current_config.presets[destIndex].name, destName.c_str(),
-            sizeof(current_config.presets[destIndex].name));
+    set_preset_name(destIndex, destName.c_str());
 
     scheduleConfigWrite();
     return request->reply(201, "application/json", "{}");
@@ -191,10 +213,12 @@ esp_err_t handlePutPresetRename(PsychicRequest *request) {
         return request->reply(404, "text/plain", "Preset to rename not found");
     }
 
-    // Update name in config
+    // Update name in config (the record carries it, so this may page the
+    // preset in)
     ConfigLock lock;
-    strlcpy(current_config.presets[presetIndex].name, newName.c_str(),
-            sizeof(current_config.presets[presetIndex].name));
+    if (!set_preset_name(presetIndex, newName.c_str())) {
+        return request->reply(503, "text/plain", "Preset unavailable");
+    }
     scheduleConfigWrite();
 
     return request->reply(200, "application/json", "{}");
@@ -220,7 +244,7 @@ esp_err_t handleDeletePreset(PsychicRequest *request) {
     // checking for "Default" wouldn't protect anything)
     int usedPresets = 0;
     for (int i = 0; i < MAX_PRESETS; i++) {
-        if (strlen(current_config.presets[i].name) > 0) {
+        if (strlen(current_config.presetNames[i]) > 0) {
             usedPresets++;
         }
     }
@@ -229,20 +253,25 @@ esp_err_t handleDeletePreset(PsychicRequest *request) {
     }
 
     ConfigLock lock;
-    // "Delete" by clearing the name, making the slot available
-    current_config.presets[presetIndex].name[0] = '\0';
-
     // If the deleted preset was the active one, switch to the first
-    // remaining preset (slot 0 may itself have been deleted earlier)
+    // remaining preset (slot 0 may itself have been deleted earlier). This
+    // goes first: the new active preset may have to be paged in, and if it
+    // can't be the delete doesn't happen either.
     if (current_config.active_preset_index == presetIndex) {
-        for (int i = 0; i < MAX_PRESETS; i++) {
-            if (strlen(current_config.presets[i].name) > 0) {
-                current_config.active_preset_index = i;
-                break;
+        int next = -1;
+        for (int i = 0; i < MAX_PRESETS && next < 0; i++) {
+            if (i != presetIndex && strlen(current_config.presetNames[i]) > 0) {
+                next = i;
             }
         }
+        if (!set_active_preset(next)) {
+            return request->reply(503, "text/plain", "Preset unavailable");
+        }
     }
 
+    // "Delete" by clearing the name, making the slot available
+    set_preset_name(presetIndex, "");
+
     updateTeensyWithActivePresetParameters();
 
     scheduleConfigWrite();
@@ -267,7 +296,9 @@ esp_err_t handlePutActivePreset(PsychicRequest *request) {
 
     {
         ConfigLock lock;
-        current_config.active_preset_index = presetIndex;
+        if (!set_active_preset(presetIndex)) {
+            return request->reply(503, "text/plain", "Preset unavailable");
+        }
         scheduleConfigWrite();
     }
     updateTeensyWithActivePresetParameters();
@@ -277,7 +308,7 @@ esp_err_t handlePutActivePreset(PsychicRequest *request) {
     // Prepare data for WebSocket broadcast
     JsonDocument doc;
     doc["messageType"] = "activePresetChanged";
-    doc["activePresetName"] = current_config.presets[current_config.active_preset_index].name;
+    doc["activePresetName"] = current_config.presetNames[current_config.active_preset_index];
     doc["activePresetIndex"] = current_config.active_preset_index;
     // Master volume is per-preset: carry the level that just took effect so
     // clients don't have to refetch /status to follow it
@@ -309,10 +340,15 @@ esp_err_t handlePutPresetDelayEnabled(PsychicRequest *request) {
         return request->reply(404, "text/plain", "Preset not found");
     }
 
+    PresetRef preset(presetIndex);
+    if (!preset) {
+        return request->reply(503, "text/plain", "Preset unavailable");
+    }
+
     bool enabled = (state == "on");
     {
         ConfigLock lock;
-        current_config.presets[presetIndex].delaysEnabled = enabled;
+        preset->delaysEnabled = enabled;
         scheduleConfigWrite();
     }
 
@@ -17,6 +17,18 @@ esp_err_t handlePutProbeDelayStart(PsychicRequest *request) {
         }
         level = (int)parsed;
     }
+    // capture=mic: the Teensy records its measurement mic and reports each
+    // arrival itself (PROBE RESULT lines); the default leaves the timing to
+    // the web UI's phone recording
+    bool mic = false;
+    if (request->hasParam("capture")) {
+        String capture = request->getParam("capture")->value();
+        if (capture == "mic") {
+            mic = true;
+        } else if (capture != "phone") {
+            return request->reply(400, "text/plain", "Capture must be phone or mic");
+        }
+    }
 
     // The probe covers the active preset's enabled outputs: ascending, then
     // the same list reversed (the UI averages both passes per output to
@@ -27,7 +39,7 @@ esp_err_t handlePutProbeDelayStart(PsychicRequest *request) {
     int count = 0;
     {
         ConfigLock lock;
-        const Preset& preset = current_config.presets[current_config.active_preset_index];
+        const Preset& preset = active_preset();
         for (int ch = 0; ch < NUM_OUTPUTS; ch++) {
             if (preset.outputs[ch].enabled) {
                 mask |= 1 << ch;
@@ -42,7 +54,7 @@ esp_err_t handlePutProbeDelayStart(PsychicRequest *request) {
     char maskStr[8], levelStr[8];
     snprintf(maskStr, sizeof(maskStr), "%d", mask);
     snprintf(levelStr, sizeof(levelStr), "%d", level);
-    sendToTeensy(CMD_START_DELAY_PROBE, maskStr, levelStr);
+    sendToTeensy(CMD_START_DELAY_PROBE, maskStr, levelStr, mic ? "1" : nullptr);
 
     // The schedule the UI records and correlates against. Sample counts are
     // on the Teensy's 44.1kHz clock; chirp k starts at sample
@@ -58,6 +70,9 @@ esp_err_t handlePutProbeDelayStart(PsychicRequest *request) {
     doc["f0"] = PROBE_F0_HZ;
     doc["f1"] = PROBE_F1_HZ;
     doc["level"] = level;
+    doc["capture"] = mic ? "mic" : "phone";
+    // PROBE RESULT confidences below this are no arrival (mic capture only)
+    doc["minConfidence"] = PROBE_MIN_CONFIDENCE;
     JsonArray order = doc.createNestedArray("order");
     for (int i = 0; i < count; i++) order.add(forward[i]);
     for (int i = count - 1; i >= 0; i--) order.add(forward[i]);
@@ -4,6 +4,7 @@
 #include "websocket.h"
 #include "teensy_comm.h"
 #include "utilities.h"
+#include "mem_pool.h"
 
 esp_err_t handlePutTone(PsychicRequest *request) {
     if (!request->hasParam("frequency") || !request->hasParam("volume")) {
@@ -30,7 +31,7 @@ esp_err_t handlePutTone(PsychicRequest *request) {
 
     sendToTeensy(CMD_SET_TONE, freqStr, volStr);
 
-        JsonDocument doc;
+        JsonDocument doc(pooledJsonAllocator());
     doc["toneFrequency"] = current_config.toneFrequency;
     doc["toneVolume"] = current_config.toneVolume;
 
@@ -54,7 +55,7 @@ esp_err_t handlePutToneStop(PsychicRequest *request) {
 
     sendToTeensy(CMD_STOP_TONE, "");
 
-        JsonDocument doc;
+        JsonDocument doc(pooledJsonAllocator());
     doc["toneFrequency"] = 0;
     doc["toneVolume"] = 0;
 
@@ -87,7 +88,7 @@ esp_err_t handlePutNoise(PsychicRequest *request) {
 
     sendToTeensy(CMD_SET_NOISE, volStr);
 
-        JsonDocument doc;
+        JsonDocument doc(pooledJsonAllocator());
     doc["noiseVolume"] = current_config.noiseVolume;
 
     char responseBuffer[1024]; // Adjust size as needed
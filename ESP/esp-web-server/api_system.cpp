@@ -6,39 +6,46 @@
 #include "utilities.h"
 #include "api_helpers.h"
 #include "health.h"
+#include "config_store.h"
+#include "static_assets.h"
+#include "mem_pool.h"
 
 esp_err_t handleGetStatus(PsychicRequest *request) {
+    // Everything below reads the snapshot (config.h), not current_config -
+    // the most-polled endpoint never touches the config lock unless a
+    // write has just invalidated the snapshot.
+    ConfigSnapshotPtr snap = config_snapshot();
     JsonDocument doc;
 
     JsonObject speakerGains = doc.createNestedObject("speakerGains");
-    speakerGains["left"] = current_config.speakerGains.left * 100.0f;
-    speakerGains["right"] = current_config.speakerGains.right * 100.0f;
-    speakerGains["sub"] = current_config.speakerGains.sub * 100.0f;
+    speakerGains["left"] = snap->speakerGains.left * 100.0f;
+    speakerGains["right"] = snap->speakerGains.right * 100.0f;
+    speakerGains["sub"] = snap->speakerGains.sub * 100.0f;
     
     JsonObject inputGains = doc.createNestedObject("inputGains");
-    inputGains["spdif"] = current_config.inputGains.spdif;
-    inputGains["bluetooth"] = current_config.inputGains.bluetooth;
-    inputGains["usb"] = current_config.inputGains.usb;
-    inputGains["tone"] = current_config.inputGains.tone;
-    inputGains["analog"] = current_config.inputGains.analog;
-    inputGains["recorder"] = current_config.inputGains.recorder;
+    inputGains["spdif"] = snap->inputGains.spdif;
+    inputGains["bluetooth"] = snap->inputGains.bluetooth;
+    inputGains["usb"] = snap->inputGains.usb;
+    inputGains["tone"] = snap->inputGains.tone;
+    inputGains["analog"] = snap->inputGains.analog;
+    inputGains["recorder"] = snap->inputGains.recorder;
     
     JsonObject mute = doc.createNestedObject("mute");
-    mute["muted"] = current_config.muted;
-    mute["percent"] = current_config.mutePercent;
+    mute["muted"] = snap->muted;
+    mute["percent"] = snap->mutePercent;
     
     JsonObject tone = doc.createNestedObject("tone");
-    tone["frequency"] = current_config.toneFrequency;
-    tone["volume"] = current_config.toneVolume;
+    tone["frequency"] = snap->toneFrequency;
+    tone["volume"] = snap->toneVolume;
     
     JsonObject noise = doc.createNestedObject("noise");
-    noise["volume"] = current_config.noiseVolume;
+    noise["volume"] = snap->noiseVolume;
     
-    doc["currentPreset"] = current_config.presets[current_config.active_preset_index].name;
-    doc["deviceName"] = current_config.deviceName;
+    doc["currentPreset"] = snap->active.name;
+    doc["deviceName"] = snap->deviceName;
 
     // Master volume, which lives on the active preset
-    doc["volume"] = active_preset().volume;
+    doc["volume"] = snap->active.volume;
 
     // Internal heap headroom - each open TLS socket costs ~40KB, so this is
     // the number to watch when tuning the HTTPS max_open_sockets budget.
@@ -60,6 +67,64 @@ esp_err_t handleGetStatus(PsychicRequest *request) {
     health["resetReason"] = healthResetReasonName();
     health["lastRestartCause"] = healthLastRestartCause();
 
+    // Config store telemetry (config_store.h). lastSaveBytes is what one
+    // debounced save cost the flash; a single-preset edit should read one
+    // preset record plus, at most, the small globals record.
+    JsonObject storage = doc.createNestedObject("storage");
+    storage["source"] = config_store_stats.bootSource;
+    storage["bootLoadUs"] = config_store_stats.bootLoadUs;
+    storage["saves"] = config_store_stats.saves;
+    storage["lastSaveUs"] = config_store_stats.lastSaveUs;
+    storage["lastSaveBytes"] = config_store_stats.lastSaveBytes;
+    storage["lastSaveRecords"] = config_store_stats.lastSaveRecords;
+    storage["totalBytesWritten"] = config_store_stats.totalBytesWritten;
+
+    // Preset paging (config.h). pageIns climbing with every request means
+    // the UI is cycling through more presets than the cache holds.
+    JsonObject presetCache = doc.createNestedObject("presetCache");
+    presetCache["slots"] = PRESET_CACHE_SLOTS;
+    presetCache["resident"] = preset_cache_resident();
+    presetCache["hits"] = preset_cache_stats.hits;
+    presetCache["pageIns"] = preset_cache_stats.pageIns;
+    presetCache["writeBacks"] = preset_cache_stats.writeBacks;
+    presetCache["failures"] = preset_cache_stats.failures;
+
+    // Web UI delivery (static_assets.h). bytesSent before and after a cold
+    // page load is what that load cost over the air.
+    StaticAssetStats assetStats = staticAssetStats();
+    JsonObject assets = doc.createNestedObject("static");
+    assets["files"] = staticAssetCount();
+    assets["build"] = staticAssetBuildId();
+    assets["ramCachedBytes"] = staticAssetCachedBytes();
+    assets["requests"] = assetStats.requests;
+    assets["notModified"] = assetStats.notModified;
+    assets["ramHits"] = assetStats.ramHits;
+    assets["bytesSent"] = assetStats.bytesSent;
+
+    // Transient allocation pools (mem_pool.h). exhausted or oversize
+    // climbing means those allocations are back on the general heap.
+    MemPoolStats pools[MEM_POOL_CLASSES];
+    getMemPoolStats(pools);
+    JsonObject memPools = doc.createNestedObject("memPools");
+    JsonArray poolClasses = memPools.createNestedArray("classes");
+    for (const MemPoolStats& pool : pools) {
+        JsonObject entry = poolClasses.createNestedObject();
+        entry["blockSize"] = pool.blockSize;
+        entry["blocks"] = pool.blocks;
+        entry["inUse"] = pool.inUse;
+        entry["peakInUse"] = pool.peakInUse;
+        entry["allocs"] = pool.allocs;
+        entry["exhausted"] = pool.exhausted;
+    }
+    memPools["oversize"] = memPoolOversize();
+
+    // Teensy runtime telemetry (teensy_comm.h): DSP load, audio pool and
+    // RAM2 heap, and the USB input's drift/glitch counters - what to line up
+    // against an audible glitch.
+    TeensyStats teensy;
+    getTeensyStats(teensy);
+    teensyStatsToJson(teensy, doc.createNestedObject("teensy"));
+
     String response;
     serializeJson(doc, response);
     return request->reply(200, "application/json", response.c_str());
@@ -90,7 +155,7 @@ esp_err_t handlePutDeviceName(PsychicRequest *request) {
     // Re-announce "<name>.local" right away
     startMdns();
 
-    JsonDocument doc;
+    JsonDocument doc(pooledJsonAllocator());
     doc["messageType"] = "deviceNameChanged";
     doc["deviceName"] = current_config.deviceName;
     return sendJsonAndBroadcast(request, doc);
@@ -117,7 +182,7 @@ esp_err_t handlePutMute(PsychicRequest *request) {
     sendOnOffToTeensy(CMD_SET_MUTE, current_config.muted);
 
     // Same shape as the broadcast sent by toggle_mute (IR remote path)
-    JsonDocument doc;
+    JsonDocument doc(pooledJsonAllocator());
     doc["messageType"] = "muteChanged";
     doc["muted"] = current_config.muted;
     return sendJsonAndBroadcast(request, doc);
@@ -142,7 +207,7 @@ esp_err_t handlePutMutePercent(PsychicRequest *request) {
 
     sendFloatToTeensy(CMD_SET_MUTE_PERCENT, percent);
 
-    JsonDocument doc;
+    JsonDocument doc(pooledJsonAllocator());
     doc["messageType"] = "mutePercentChanged";
     doc["mutePercent"] = current_config.mutePercent;
     return sendJsonAndBroadcast(request, doc);
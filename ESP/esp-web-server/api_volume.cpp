@@ -5,6 +5,7 @@
 #include "teensy_comm.h"
 #include "utilities.h"
 #include "websocket.h"
+#include "mem_pool.h"
 #include <ArduinoJson.h>
 
 // Master volume is a per-preset value (config.h): each preset remembers the
@@ -16,7 +17,7 @@
 // Broadcast which preset's volume changed, so a UI showing a different
 // preset doesn't take the value as its own.
 static void broadcastVolumeChanged(const Preset& preset) {
-    JsonDocument doc;
+    JsonDocument doc(pooledJsonAllocator());
     doc["messageType"] = "volumeChanged";
     doc["presetName"] = preset.name;
     doc["volume"] = preset.volume;
@@ -32,11 +33,16 @@ static void broadcastVolumeChanged(const Preset& preset) {
 
 /**
  * Store a preset's volume and, when it is the preset being played, push it
- * to the Teensy. Returns the clamped value.
+ * to the Teensy. Returns the clamped value, or -1 if the preset couldn't be
+ * paged in.
  */
 static int applyVolume(int presetIndex, int volume) {
     volume = volume < 0 ? 0 : (volume > 100 ? 100 : volume);
-    Preset& preset = current_config.presets[presetIndex];
+    PresetRef presetRef(presetIndex);
+    if (!presetRef) {
+        return -1;
+    }
+    Preset& preset = *presetRef;
     {
         ConfigLock lock;
         preset.volume = volume;
@@ -75,10 +81,14 @@ esp_err_t handlePutVolume(PsychicRequest *request) {
     }
 
     volume = applyVolume(presetIndex, volume);
+    if (volume < 0) {
+        return request->reply(503, "application/json",
+                              "{\"success\":false,\"error\":\"Preset unavailable\"}");
+    }
 
-    JsonDocument doc;
+    JsonDocument doc(pooledJsonAllocator());
     doc["success"] = true;
-    doc["presetName"] = current_config.presets[presetIndex].name;
+    doc["presetName"] = current_config.presetNames[presetIndex];
     doc["volume"] = volume;
     String response;
     serializeJson(doc, response);
@@ -102,7 +112,7 @@ void toggle_mute() {
     sendOnOffToTeensy(CMD_SET_MUTE, current_config.muted);
     scheduleConfigWrite();
     // Prepare data for WebSocket broadcast
-    JsonDocument doc;
+    JsonDocument doc(pooledJsonAllocator());
     doc["messageType"] = "muteChanged";
     doc["muted"] = current_config.muted;
     char messageBuffer[128]; // Adjust size as needed
@@ -43,7 +43,7 @@ void nextPreset() {
     int index = currentPresetIndex;
     for (int i = 0; i < MAX_PRESETS; i++) {
         index = (index + 1) % MAX_PRESETS;
-        if (strlen(current_config.presets[index].name) > 0) {
+        if (strlen(current_config.presetNames[index]) > 0) {
             currentPresetIndex = index;
             break;
         }
@@ -58,7 +58,7 @@ void handleShortPress() {
         lcd.setBacklight(1);
         backlightStart = millis();
         if (millis() - lastButtonScreenUpdateTime > BUTTON_SCREEN_UPDATE_INTERVAL) {
-            writeToScreen(current_config.presets[currentPresetIndex].name);
+            writeToScreen(current_config.presetNames[currentPresetIndex]);
             lastButtonScreenUpdateTime = millis();
         }
     } else {
@@ -71,7 +71,7 @@ void handleShortPress() {
         // Backlight is on, so cycle to next preset
         nextPreset(); // Update the preset index
         if (millis() - lastButtonScreenUpdateTime > BUTTON_SCREEN_UPDATE_INTERVAL) {
-            writeToScreen(current_config.presets[currentPresetIndex].name); // Display the new preset
+            writeToScreen(current_config.presetNames[currentPresetIndex]); // Display the new preset
             lastButtonScreenUpdateTime = millis();
         }
     }
@@ -117,14 +117,29 @@ void handleButton() {
             return;
         }
         if (currentPresetIndex != current_config.active_preset_index) {
-            current_config.active_preset_index = currentPresetIndex;
+            // The same lock as the web handlers' switch, so this can't race
+            // their edits of the config or the preset cache
+            bool switched;
+            {
+                ConfigLock lock;
+                switched = set_active_preset(currentPresetIndex);
+                if (switched) {
+                    scheduleConfigWrite();
+                }
+            }
+            if (!switched) {
+                // Couldn't page it in - snap the selection back
+                writeToScreen("Preset unavailable", 2000);
+                currentPresetIndex = current_config.active_preset_index;
+                lastButtonPressTime = 0;
+                return;
+            }
             updateTeensyWithActivePresetParameters();
-            scheduleConfigWrite();
 
             // Prepare data for WebSocket broadcast
             JsonDocument doc;
             doc["messageType"] = "activePresetChanged";
-            doc["activePresetName"] = current_config.presets[current_config.active_preset_index].name;
+            doc["activePresetName"] = current_config.presetNames[current_config.active_preset_index];
             doc["activePresetIndex"] = current_config.active_preset_index;
 
             // Serialize JSON to a temporary buffer
@@ -1,5 +1,7 @@
 #include "globals.h"
 #include "config.h"
+#include "config_store.h"
+#include "snapshot_cell.h"
 #include "templates.h"
 #include "teensy_comm.h"
 #include "api_fir.h"
@@ -8,6 +10,7 @@
 #include <LittleFS.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/semphr.h>
+#include <esp_heap_caps.h>
 
 // Define the global configuration instance
 Config current_config;
@@ -31,6 +34,46 @@ void config_unlock() {
     }
 }
 
+// --- Read snapshots (see config.h) ---
+
+static SnapshotCell<ConfigSnapshot> snapshotCell;
+
+int ConfigSnapshot::find_preset(const char* name) const {
+    for (int i = 0; i < MAX_PRESETS; i++) {
+        if (presetNames[i][0] != '\0' && strcmp(presetNames[i], name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// The only place a snapshot reads current_config: one locked copy of
+// ~4.4KB, a few microseconds.
+static void fill_snapshot(ConfigSnapshot& snap) {
+    ConfigLock lock;
+    strlcpy(snap.deviceName, current_config.deviceName, sizeof(snap.deviceName));
+    snap.active_preset_index = current_config.active_preset_index;
+    snap.toneFrequency = current_config.toneFrequency;
+    snap.toneVolume = current_config.toneVolume;
+    snap.noiseVolume = current_config.noiseVolume;
+    snap.muted = current_config.muted;
+    snap.mutePercent = current_config.mutePercent;
+    snap.levelLog = current_config.levelLog;
+    snap.speakerGains = current_config.speakerGains;
+    snap.inputGains = current_config.inputGains;
+    memcpy(snap.presetNames, current_config.presetNames, sizeof(snap.presetNames));
+    snap.active = active_preset();
+}
+
+ConfigSnapshotPtr config_snapshot() {
+    return snapshotCell.get(fill_snapshot);
+}
+
+void config_snapshot_invalidate() {
+    snapshotCell.invalidate();
+}
+
+
 bool is_valid_device_name(const char* name) {
     size_t len = name != nullptr ? strlen(name) : 0;
     if (len == 0 || len > DEVICE_NAME_MAX_LEN) {
@@ -101,7 +144,7 @@ bool flip_template_to_custom(Preset& preset) {
 
 // --- JSON serialization of model pieces ---
 // These produce the API shapes (GET /preset, broadcasts) and double as the
-// storage format inside /config.msgpack.
+// storage format, both inside the config records and /config.msgpack.
 
 static const char* filterModeName(FilterMode mode) {
     switch (mode) {
@@ -149,6 +192,7 @@ void output_to_json(const Output& output, JsonObject obj) {
     }
     obj["eqEnabled"] = output.eqEnabled;
     obj["fir"] = output.fir;
+    obj["firCompiled"] = output.firCompiled;
     obj["delayUs"] = output.delayUs;
     obj["gainDb"] = output.gainDb;
     obj["invert"] = output.invert;
@@ -157,6 +201,7 @@ void output_to_json(const Output& output, JsonObject obj) {
 
 void input_eq_to_json(const InputEq& eq, JsonObject obj) {
     obj["enabled"] = eq.enabled;
+    obj["refSpl"] = eq.refSpl;
     JsonArray sets = obj.createNestedArray("sets");
     for (int i = 0; i < MAX_PEQ_SETS; i++) {
         if (eq.sets[i].spl == -1) continue;
@@ -236,6 +281,7 @@ static void output_from_json(JsonObject obj, Output& output, int index) {
     peq_points_from_json(obj["peq"], output.peq, MAX_OUTPUT_PEQ, output.num_peq);
     output.eqEnabled = obj["eqEnabled"] | true; // absent in older configs
     strlcpy(output.fir, obj["fir"] | "", sizeof(output.fir));
+    output.firCompiled = obj["firCompiled"] | false;
     output.delayUs = obj["delayUs"] | 0.0;
     output.gainDb = obj["gainDb"] | 0.0;
     output.invert = obj["invert"] | false;
@@ -259,6 +305,8 @@ static void preset_from_json(JsonObject obj, Preset& preset) {
 
     JsonObject inputEq = obj["inputEq"];
     preset.inputEq.enabled = inputEq["enabled"] | false;
+    int refSpl = inputEq["refSpl"] | INPUT_EQ_REF_SPL_DEFAULT;
+    preset.inputEq.refSpl = refSpl < 0 ? 0 : (refSpl > INPUT_EQ_SPL_MAX ? INPUT_EQ_SPL_MAX : refSpl);
     for (int i = 0; i < MAX_PEQ_SETS; i++) {
         preset.inputEq.sets[i] = PEQSet();
     }
@@ -266,7 +314,8 @@ static void preset_from_json(JsonObject obj, Preset& preset) {
     for (JsonObject set : inputEq["sets"].as<JsonArray>()) {
         if (setCount >= MAX_PEQ_SETS) break;
         PEQSet& target = preset.inputEq.sets[setCount++];
-        target.spl = set["spl"] | 0;
+        int spl = set["spl"] | 0;
+        target.spl = spl < 0 ? 0 : (spl > INPUT_EQ_SPL_MAX ? INPUT_EQ_SPL_MAX : spl);
         peq_points_from_json(set["points"], target.points, MAX_PEQ_POINTS, target.num_points);
     }
 
@@ -348,44 +397,447 @@ static bool migrate_config(JsonDocument& doc, uint8_t fromVersion) {
     return true;
 }
 
-bool load_config() {
-    return load_config_from(CONFIG_FILE);
+// The top-level fields of the config, everything but the presets. Shared by
+// the globals record and the single-file /backup format.
+static void globals_to_json(const ConfigSnapshot& snap, JsonObject doc) {
+    doc["version"] = CONFIG_CURRENT_VERSION;
+    doc["deviceName"] = snap.deviceName;
+    doc["active_preset_index"] = snap.active_preset_index;
+    doc["toneFrequency"] = snap.toneFrequency;
+    doc["toneVolume"] = snap.toneVolume;
+    doc["noiseVolume"] = snap.noiseVolume;
+    doc["muted"] = snap.muted;
+    doc["mutePercent"] = snap.mutePercent;
+    doc["levelLog"] = snap.levelLog;
+
+    JsonObject speakerGains = doc.createNestedObject("speakerGains");
+    speakerGains["left"] = snap.speakerGains.left;
+    speakerGains["right"] = snap.speakerGains.right;
+    speakerGains["sub"] = snap.speakerGains.sub;
+
+    JsonObject inputGains = doc.createNestedObject("inputGains");
+    inputGains["spdif"] = snap.inputGains.spdif;
+    inputGains["bluetooth"] = snap.inputGains.bluetooth;
+    inputGains["usb"] = snap.inputGains.usb;
+    inputGains["tone"] = snap.inputGains.tone;
+    inputGains["analog"] = snap.inputGains.analog;
+    inputGains["recorder"] = snap.inputGains.recorder;
 }
 
-bool load_config_from(const char* path) {
-    if (!LittleFS.exists(path)) {
-        DebugSerial.println("Config file not found, using defaults");
+bool config_to_json(JsonDocument& doc) {
+    ConfigSnapshotPtr snap = config_snapshot();
+    // One scratch Preset for the non-active slots, each copied out under
+    // its own short lock - never the whole config under one
+    std::unique_ptr<Preset> scratch(new (std::nothrow) Preset());
+    if (!snap || !scratch) {
         return false;
     }
+    globals_to_json(*snap, doc.to<JsonObject>());
 
-    File file = LittleFS.open(path, "r");
-    if (!file) {
-        DebugSerial.println("Failed to open config file for reading");
-        return false;
+    // Presets keep their slot positions (active_preset_index and the
+    // button/remote cycling are slot-based). Empty slots save name-only.
+    JsonArray presets = doc.createNestedArray("presets");
+    for (int i = 0; i < MAX_PRESETS; i++) {
+        JsonObject preset = presets.createNestedObject();
+        if (i == snap->active_preset_index) {
+            preset_to_json(snap->active, preset);
+        } else if (config_copy_preset(i, *scratch)) {
+            preset_to_json(*scratch, preset);
+        } else {
+            preset["name"] = "";
+        }
     }
+    return true;
+}
 
-    // Create a buffer to hold the MessagePack data
-    size_t fileSize = file.size();
-    if (fileSize == 0) {
-        DebugSerial.println("Config file is empty");
-        file.close();
-        return false;
+// --- Dirty tracking ---
+// save_config rewrites only the preset records whose contents changed since
+// they were last loaded or stored. Nothing at the ~45 mutation sites has to
+// report what it touched: a CRC of the Preset's bytes, taken under the
+// config lock, is cheap enough to run over every resident preset on every
+// save and can't miss an edit. A preset that isn't resident is by
+// definition what its record holds, unless eviction left an edit pending
+// for the save (see cache_evict_locked). Padding and the unused tail
+// of a char[] can only make it see a change that isn't there - which costs
+// one serialization, after which the store notices the record came out
+// identical and skips the write.
+static uint32_t storedPresetCrc[MAX_PRESETS];
+static bool storedPresetClean[MAX_PRESETS];
+
+static uint32_t preset_state_crc(const Preset& preset) {
+    return config_store_crc(&preset, sizeof(Preset));
+}
+
+static void mark_all_presets_dirty() {
+    for (int i = 0; i < MAX_PRESETS; i++) {
+        storedPresetClean[i] = false;
     }
+}
 
-    std::unique_ptr<char[]> buffer(new char[fileSize]);
-    file.readBytes(buffer.get(), fileSize);
-    file.close();
+// Serialize one record's document and hand it to the store. Returns the
+// bytes written; ok is false only on a failed write (an unchanged record
+// that the store skipped is fine).
+static size_t store_record(int slot, const JsonDocument& doc, bool& ok) {
+    size_t length = measureMsgPack(doc);
+    std::unique_ptr<uint8_t[]> buffer(new (std::nothrow) uint8_t[length]);
+    if (!buffer) {
+        DebugSerial.printf("No memory to serialize config record %d (%u bytes)\n", slot, (unsigned)length);
+        ok = false;
+        return 0;
+    }
+    serializeMsgPack(doc, buffer.get(), length);
+    bool skipped = false;
+    size_t written = config_store_write(slot, buffer.get(), length, skipped);
+    ok = skipped || written > 0;
+    return written;
+}
 
-    // Deserialize MessagePack
-    JsonDocument doc;
-    DeserializationError error = deserializeMsgPack(doc, buffer.get(), fileSize);
+// Store one preset's record - or remove it, for a preset with no name -
+// and mark the slot clean at the given CRC. Returns the bytes written; ok
+// as for store_record, removed whether a record was deleted.
+static size_t store_preset(int slot, const Preset& preset, uint32_t crc, bool& ok,
+                           bool* removed = nullptr) {
+    size_t written = 0;
+    if (preset.name[0] == '\0') {
+        bool gone = false;
+        ok = config_store_remove(slot, gone);
+        if (removed != nullptr) *removed = gone;
+    } else {
+        JsonDocument doc;
+        preset_to_json(preset, doc.to<JsonObject>());
+        written = store_record(slot, doc, ok);
+    }
+    if (ok) {
+        storedPresetCrc[slot] = crc;
+        storedPresetClean[slot] = true;
+    }
+    return written;
+}
+
+// --- Preset paging (see config.h) ---
+
+struct PresetCacheEntry {
+    int slot = -1;       // preset slot held, -1 = free
+    uint8_t pins = 0;    // live PresetRefs, plus one while it is the active preset
+    uint32_t lastUse = 0;
+    Preset preset;
+};
+
+static PresetCacheEntry presetCache[PRESET_CACHE_SLOTS];
+static int activeEntry = -1; // entry holding active_preset_index
+static uint32_t cacheClock = 0;
+PresetCacheStats preset_cache_stats;
+
+// An edited preset evicted before the save got to it, waiting for
+// save_config to write it. Eviction runs under cacheMutex and often the
+// config lock too, so it only copies the preset here; the flash write
+// happens in the save, outside both, from its own copy. generation moves
+// whenever the copy is replaced, so a save that wrote an older one leaves
+// the newer one pending.
+struct PendingWriteBack {
+    Preset* preset = nullptr;
+    uint32_t crc = 0;
+    uint16_t generation = 0;
+};
+
+static PendingWriteBack pendingWriteBacks[MAX_PRESETS];
+
+// Guards the cache bookkeeping, page-ins and write-backs. Lock order is
+// config lock -> cacheMutex -> the store's own lock: PresetRefs may be
+// taken inside a ConfigLock scope, and nothing here takes the config lock.
+// Created in init_config alongside configMutex.
+static SemaphoreHandle_t cacheMutex = nullptr;
+
+static void cache_lock() {
+    if (cacheMutex != nullptr) {
+        xSemaphoreTake(cacheMutex, portMAX_DELAY);
+    }
+}
 
+static void cache_unlock() {
+    if (cacheMutex != nullptr) {
+        xSemaphoreGive(cacheMutex);
+    }
+}
+
+// Parse one preset record into 'out'. NoMemory covers the parse as well as
+// the read buffer, so a low-heap moment is never mistaken for corruption.
+static StoreRead read_preset_record(int slot, Preset& out) {
+    std::unique_ptr<uint8_t[]> payload;
+    size_t length = 0;
+    uint8_t version = 0;
+    StoreRead result = config_store_read(slot, payload, length, version);
+    if (result != StoreRead::Ok) {
+        return result;
+    }
+    JsonDocument doc;
+    DeserializationError error = deserializeMsgPack(doc, (const uint8_t*)payload.get(), length);
+    if (error == DeserializationError::NoMemory) {
+        return StoreRead::NoMemory;
+    }
     if (error) {
-        DebugSerial.print("Failed to deserialize config: ");
-        DebugSerial.println(error.c_str());
-        return false;
+        return StoreRead::Corrupt;
+    }
+    JsonObject obj = doc.as<JsonObject>();
+    strlcpy(out.name, obj["name"] | "", sizeof(out.name));
+    preset_from_json(obj, out);
+    return StoreRead::Ok;
+}
+
+// A default preset in a slot: what an empty slot pages in as, and what a
+// named slot falls back to when its record is gone.
+static void reset_preset(Preset& preset, const char* name) {
+    build_preset_from_template(preset, DEFAULT_TEMPLATE_ID);
+    strlcpy(preset.name, name, sizeof(preset.name));
+}
+
+static int cache_find_locked(int slot) {
+    for (int e = 0; e < PRESET_CACHE_SLOTS; e++) {
+        if (presetCache[e].slot == slot) return e;
+    }
+    return -1;
+}
+
+// Forget a slot's pending write-back: its preset is resident again, or is
+// being replaced wholesale
+static void pending_drop_locked(int slot) {
+    PendingWriteBack& pending = pendingWriteBacks[slot];
+    delete pending.preset;
+    pending.preset = nullptr;
+}
+
+// Replace a slot's pending write-back with 'preset'. Returns false if
+// there was no memory for the copy.
+static bool pending_put_locked(int slot, const Preset& preset, uint32_t crc) {
+    PendingWriteBack& pending = pendingWriteBacks[slot];
+    if (pending.preset == nullptr) {
+        pending.preset = new (std::nothrow) Preset();
+        if (pending.preset == nullptr) return false;
+    }
+    *pending.preset = preset;
+    pending.crc = crc;
+    pending.generation++;
+    return true;
+}
+
+// Free up the least recently used unpinned entry, handing its preset to
+// the next save if it was edited since it was stored. Returns the (now
+// free) entry, or -1 if everything is pinned or there was no memory for
+// the hand-off - an edit is never dropped to make room. No flash I/O: the
+// caller may hold the config lock. The edit itself scheduled the save.
+static int cache_evict_locked() {
+    int victim = -1;
+    for (int e = 0; e < PRESET_CACHE_SLOTS; e++) {
+        const PresetCacheEntry& entry = presetCache[e];
+        if (entry.pins > 0) continue;
+        if (entry.slot < 0) return e;
+        if (victim < 0 || entry.lastUse < presetCache[victim].lastUse) victim = e;
+    }
+    if (victim < 0) {
+        DebugSerial.println("Preset cache: every entry is pinned");
+        return -1;
+    }
+
+    PresetCacheEntry& entry = presetCache[victim];
+    uint32_t crc = preset_state_crc(entry.preset);
+    if (!storedPresetClean[entry.slot] || storedPresetCrc[entry.slot] != crc) {
+        if (!pending_put_locked(entry.slot, entry.preset, crc)) {
+            DebugSerial.printf("Preset cache: no memory to hand off slot %d, not evicting it\n", entry.slot);
+            return -1;
+        }
+        preset_cache_stats.writeBacks++;
+    }
+    entry.slot = -1;
+    return victim;
+}
+
+// Pin the entry holding 'slot', paging it in if it isn't resident. With
+// claim set nothing is read: the entry gets a default preset for the caller
+// to overwrite (a load filling the slot from a document). Returns the
+// entry, or -1.
+static int cache_acquire_locked(int slot, bool claim = false) {
+    int e = cache_find_locked(slot);
+    if (e >= 0) {
+        presetCache[e].pins++;
+        presetCache[e].lastUse = ++cacheClock;
+        preset_cache_stats.hits++;
+        return e;
     }
 
+    e = cache_evict_locked();
+    if (e < 0) {
+        return -1;
+    }
+    PresetCacheEntry& entry = presetCache[e];
+    const char* name = current_config.presetNames[slot];
+
+    PendingWriteBack& pending = pendingWriteBacks[slot];
+    if (claim || name[0] == '\0') {
+        // Nothing to read. The dirty state is left alone: an emptied slot
+        // whose record is still on flash stays due for removal.
+        reset_preset(entry.preset, name);
+        pending_drop_locked(slot);
+    } else if (pending.preset != nullptr) {
+        // Evicted with an edit the save hasn't written yet: the record is
+        // stale, and the slot stays dirty
+        entry.preset = *pending.preset;
+        pending_drop_locked(slot);
+    } else {
+        StoreRead result = read_preset_record(slot, entry.preset);
+        if (result == StoreRead::NoMemory) {
+            DebugSerial.printf("Preset cache: no memory to page in slot %d\n", slot);
+            return -1;
+        }
+        if (result == StoreRead::Ok) {
+            storedPresetCrc[slot] = preset_state_crc(entry.preset);
+            storedPresetClean[slot] = true;
+        } else {
+            // Missing or corrupt: keep the preset (and its name) rather than
+            // have it vanish from the list; the next save rewrites the record.
+            DebugSerial.printf("Preset cache: record for slot %d unreadable, using defaults\n", slot);
+            reset_preset(entry.preset, name);
+            storedPresetClean[slot] = false;
+        }
+        preset_cache_stats.pageIns++;
+    }
+
+    entry.slot = slot;
+    entry.pins = 1;
+    entry.lastUse = ++cacheClock;
+    return e;
+}
+
+static void cache_release_locked(int e) {
+    if (e >= 0 && presetCache[e].pins > 0) {
+        presetCache[e].pins--;
+    }
+}
+
+// Point active_preset_index at an entry already pinned for it. The entry
+// keeps that pin while it is active; the previous active entry loses its.
+static void cache_install_active_locked(int e, int index) {
+    int previous = activeEntry;
+    activeEntry = e;
+    current_config.active_preset_index = index;
+    cache_release_locked(previous);
+}
+
+Preset& active_preset() {
+    return presetCache[activeEntry].preset;
+}
+
+bool set_active_preset(int index) {
+    if (index < 0 || index >= MAX_PRESETS) return false;
+    cache_lock();
+    bool ok = index == current_config.active_preset_index && activeEntry >= 0;
+    if (!ok) {
+        int e = cache_acquire_locked(index);
+        ok = e >= 0;
+        if (ok) {
+            cache_install_active_locked(e, index);
+        }
+    }
+    cache_unlock();
+    return ok;
+}
+
+bool set_preset_name(int index, const char* name) {
+    if (index < 0 || index >= MAX_PRESETS) return false;
+    cache_lock();
+    // A named preset's record carries its name, so renaming one that isn't
+    // resident pages it in to be saved under the new name. Emptying a slot
+    // only needs the record gone.
+    int e = name[0] != '\0' ? cache_acquire_locked(index) : cache_find_locked(index);
+    bool ok = e >= 0 || name[0] == '\0';
+    if (ok) {
+        strlcpy(current_config.presetNames[index], name, sizeof(current_config.presetNames[index]));
+        if (e >= 0) {
+            strlcpy(presetCache[e].preset.name, name, sizeof(presetCache[e].preset.name));
+        } else {
+            storedPresetClean[index] = false; // the next save removes the record
+        }
+    }
+    if (name[0] != '\0') {
+        cache_release_locked(e);
+    }
+    cache_unlock();
+    return ok;
+}
+
+void PresetRef::reset(int index) {
+    release();
+    if (index < 0 || index >= MAX_PRESETS) {
+        preset_cache_stats.failures++;
+        return;
+    }
+    cache_lock();
+    entry_ = cache_acquire_locked(index);
+    if (entry_ >= 0) {
+        preset_ = &presetCache[entry_].preset;
+    } else {
+        preset_cache_stats.failures++;
+    }
+    cache_unlock();
+}
+
+void PresetRef::release() {
+    if (entry_ >= 0) {
+        cache_lock();
+        cache_release_locked(entry_);
+        cache_unlock();
+    }
+    entry_ = -1;
+    preset_ = nullptr;
+}
+
+int preset_cache_resident() {
+    int resident = 0;
+    for (int e = 0; e < PRESET_CACHE_SLOTS; e++) {
+        if (presetCache[e].slot >= 0) resident++;
+    }
+    return resident;
+}
+
+bool config_copy_preset(int index, Preset& out) {
+    if (index < 0 || index >= MAX_PRESETS) return false;
+    {
+        ConfigLock lock;
+        if (current_config.presetNames[index][0] == '\0') return false;
+        cache_lock();
+        int e = cache_find_locked(index);
+        const Preset* pending = pendingWriteBacks[index].preset;
+        if (e >= 0) {
+            out = presetCache[e].preset;
+        } else if (pending != nullptr) {
+            out = *pending;
+        }
+        cache_unlock();
+        if (e >= 0 || pending != nullptr) return true;
+    }
+    // Not resident: its record is current, and reading it past the cache
+    // keeps a /backup walking all twelve from evicting the working set.
+    return read_preset_record(index, out) == StoreRead::Ok;
+}
+
+// Where the last successful load_config() came from ("store", "legacy" or
+// "defaults"); reported on /status.
+static const char* lastLoadSource = "defaults";
+
+// Set when the globals record couldn't be read for want of memory. The
+// defaults that boot falls back to must not be saved over a store that may
+// be perfectly good, so saves are refused until a reboot reads it (or a
+// restore replaces it).
+static bool storeHeldBack = false;
+
+// Apply a parsed config document (the /config.msgpack shape) to
+// current_config, migrating it first. Shared by the single-file loader
+// (legacy config, /restore) and the record store, which assembles the same
+// shape from its records so migrate_config sees one format either way.
+//
+// Presets that aren't resident go straight to their records, since RAM no
+// longer holds them - unless onFlash says the record already is exactly
+// this preset (a store load at the current schema).
+static bool apply_config_doc(JsonDocument& doc, const bool* onFlash = nullptr) {
     uint8_t file_version = doc["version"] | 0;
     if (file_version > CONFIG_CURRENT_VERSION) {
         DebugSerial.println("Config file version is newer than supported, using defaults");
@@ -396,6 +848,23 @@ bool load_config_from(const char* path) {
         return false;
     }
 
+    // Clamp: a corrupt/hand-edited file must not index outside the slots
+    int active_preset_index = doc["active_preset_index"] | 0;
+    if (active_preset_index < 0 || active_preset_index >= MAX_PRESETS) {
+        active_preset_index = 0;
+    }
+    // Claim the active preset's entry before changing anything, so running
+    // out of cache room can fail the load cleanly (it can't at boot, with
+    // the cache empty). A parsed non-active preset needs a scratch copy.
+    std::unique_ptr<Preset> scratch(new (std::nothrow) Preset());
+    cache_lock();
+    int activeClaim = scratch ? cache_acquire_locked(active_preset_index, true) : -1;
+    if (activeClaim < 0) {
+        cache_unlock();
+        DebugSerial.println("No room to load the config's active preset");
+        return false;
+    }
+
     // Load global settings
     current_config.version = CONFIG_CURRENT_VERSION;
     // A corrupt/hand-edited name must stay a valid DNS label
@@ -403,17 +872,12 @@ bool load_config_from(const char* path) {
     strlcpy(current_config.deviceName,
             is_valid_device_name(deviceName) ? deviceName : DEVICE_NAME_DEFAULT,
             sizeof(current_config.deviceName));
-    // Clamp: a corrupt/hand-edited file must not index outside presets[]
-    int active_preset_index = doc["active_preset_index"] | 0;
-    if (active_preset_index < 0 || active_preset_index >= MAX_PRESETS) {
-        active_preset_index = 0;
-    }
-    current_config.active_preset_index = active_preset_index;
     current_config.toneFrequency = doc["toneFrequency"] | 0;
     current_config.toneVolume = doc["toneVolume"] | 0;
     current_config.noiseVolume = doc["noiseVolume"] | 0;
     current_config.muted = doc["muted"] | false;
     current_config.mutePercent = doc["mutePercent"] | 0;
+    current_config.levelLog = doc["levelLog"] | false;
 
     JsonObject speakerGains = doc["speakerGains"];
     current_config.speakerGains.left = speakerGains["left"] | 1.0f;
@@ -430,101 +894,332 @@ bool load_config_from(const char* path) {
 
     // Load presets. Every slot is reset first so fields absent from the file
     // (and stale state from a previous config, e.g. during a restore) don't
-    // leak through. Only slots with a name carry data.
+    // leak through. Only slots with a name carry data. A resident preset is
+    // overwritten in place - including any unsaved edit, which the restore
+    // replaces - and left for the next save to store.
     JsonArray presets = doc["presets"];
     for (int i = 0; i < MAX_PRESETS; i++) {
-        Preset& preset = current_config.presets[i];
         JsonObject obj = presets[i];
         const char* name = obj["name"] | "";
-        strlcpy(preset.name, name, sizeof(preset.name));
-        if (preset.name[0] != '\0') {
+        strlcpy(current_config.presetNames[i], name, sizeof(current_config.presetNames[i]));
+        bool stored = onFlash != nullptr && onFlash[i];
+
+        int e = cache_find_locked(i);
+        Preset& preset = e >= 0 ? presetCache[e].preset : *scratch;
+        reset_preset(preset, name);
+        if (name[0] != '\0') {
             preset_from_json(obj, preset);
+        }
+        uint32_t crc = preset_state_crc(preset);
+
+        if (e >= 0 || stored) {
+            storedPresetCrc[i] = crc;
+            storedPresetClean[i] = stored;
+        } else if (name[0] == '\0') {
+            pending_drop_locked(i);
+            storedPresetClean[i] = false; // any record left behind goes next save
+        } else if (pendingWriteBacks[i].preset != nullptr) {
+            // A save may be writing the old copy right now; replace it
+            // rather than race that write to the record (this can't fail
+            // with a copy already allocated)
+            pending_put_locked(i, preset, crc);
         } else {
-            // In-place reset (no whole-Preset stack temporary)
-            build_preset_from_template(preset, DEFAULT_TEMPLATE_ID);
-            preset.name[0] = '\0';
+            bool ok;
+            size_t written = store_preset(i, preset, crc, ok);
+            config_store_stats.totalBytesWritten += written;
+            if (!ok) {
+                // Pages in as defaults under its name; not lost silently
+                DebugSerial.printf("Couldn't store preset %d (%s) while loading\n", i, name);
+            }
         }
     }
+    cache_install_active_locked(activeClaim, active_preset_index);
+    cache_unlock();
 
-    DebugSerial.println("Config loaded successfully");
+    config_snapshot_invalidate();
     return true;
 }
 
-void save_config() {
-    DebugSerial.println("Saving configuration to LittleFS...");
+// Load from the record store: the globals record, then one record per
+// preset slot (a missing record is an empty slot). A corrupt preset record
+// costs that preset alone; a corrupt globals record fails the whole load so
+// the caller can fall back to the legacy file or defaults.
+static bool load_config_from_store() {
+    std::unique_ptr<uint8_t[]> payload;
+    size_t length = 0;
+    uint8_t version = 0;
+    StoreRead globals = config_store_read(CONFIG_STORE_GLOBALS, payload, length, version);
+    if (globals != StoreRead::Ok) {
+        storeHeldBack = globals == StoreRead::NoMemory;
+        return false;
+    }
 
-    // Snapshot current_config into a JSON document under the config lock so
-    // an API handler can't mutate it mid-serialization. The lock is released
-    // before the slow flash writes below.
     JsonDocument doc;
-    config_lock();
-
-    doc["version"] = current_config.version;
-    doc["deviceName"] = current_config.deviceName;
-    doc["active_preset_index"] = current_config.active_preset_index;
-    doc["toneFrequency"] = current_config.toneFrequency;
-    doc["toneVolume"] = current_config.toneVolume;
-    doc["noiseVolume"] = current_config.noiseVolume;
-    doc["muted"] = current_config.muted;
-    doc["mutePercent"] = current_config.mutePercent;
-
-    JsonObject speakerGains = doc.createNestedObject("speakerGains");
-    speakerGains["left"] = current_config.speakerGains.left;
-    speakerGains["right"] = current_config.speakerGains.right;
-    speakerGains["sub"] = current_config.speakerGains.sub;
+    DeserializationError error = deserializeMsgPack(doc, (const uint8_t*)payload.get(), length);
+    payload.reset();
+    if (error == DeserializationError::NoMemory) {
+        storeHeldBack = true;
+        return false;
+    }
+    if (error) {
+        DebugSerial.print("Failed to deserialize config globals: ");
+        DebugSerial.println(error.c_str());
+        return false;
+    }
 
-    JsonObject inputGains = doc.createNestedObject("inputGains");
-    inputGains["spdif"] = current_config.inputGains.spdif;
-    inputGains["bluetooth"] = current_config.inputGains.bluetooth;
-    inputGains["usb"] = current_config.inputGains.usb;
-    inputGains["tone"] = current_config.inputGains.tone;
-    inputGains["analog"] = current_config.inputGains.analog;
-    inputGains["recorder"] = current_config.inputGains.recorder;
-
-    // Save presets, preserving slot positions (active_preset_index and the
-    // button/remote cycling are slot-based). Empty slots save name-only.
+    // Records are rewritten together after a migration, so their versions
+    // only disagree if power failed mid-rewrite. Migrating from the oldest
+    // is what the single file would have done.
+    uint8_t docVersion = version;
+    bool recordOk[MAX_PRESETS];
+    bool recordKept[MAX_PRESETS];
     JsonArray presets = doc.createNestedArray("presets");
     for (int i = 0; i < MAX_PRESETS; i++) {
-        JsonObject preset = presets.createNestedObject();
-        if (strlen(current_config.presets[i].name) > 0) {
-            preset_to_json(current_config.presets[i], preset);
-        } else {
-            preset["name"] = "";
+        JsonObject obj = presets.createNestedObject();
+        recordOk[i] = false;
+        recordKept[i] = false;
+        StoreRead result = config_store_read(i, payload, length, version);
+        if (result == StoreRead::Ok) {
+            JsonDocument record;
+            DeserializationError recordError = deserializeMsgPack(record, (const uint8_t*)payload.get(), length);
+            if (!recordError) {
+                obj.set(record.as<JsonObjectConst>());
+                recordOk[i] = true;
+                if (version < docVersion) docVersion = version;
+            } else if (recordError == DeserializationError::NoMemory) {
+                result = StoreRead::NoMemory;
+            } else {
+                DebugSerial.printf("Config record for preset slot %d doesn't parse, slot cleared\n", i);
+            }
         }
+        if (result == StoreRead::NoMemory) {
+            // Says nothing about the record: it stays on flash for the next
+            // boot, and the slot reads as empty until then
+            DebugSerial.printf("No memory to load preset slot %d, record left on flash\n", i);
+            recordKept[i] = true;
+        } else if (result == StoreRead::Missing) {
+            recordOk[i] = true; // an empty slot, stored as no record
+        } else if (result != StoreRead::Ok) {
+            DebugSerial.printf("Config record for preset slot %d is corrupt, slot cleared\n", i);
+        }
+        payload.reset();
+        if (obj["name"].isNull()) {
+            obj["name"] = "";
+        }
+    }
+    doc["version"] = docVersion;
+
+    // What was read back verbatim at the current schema is already on flash
+    // and is left there, as is a record there was no memory to read.
+    // Migrated slots are rewritten by the load; corrupt ones stay dirty, so
+    // the next save removes them.
+    bool onFlash[MAX_PRESETS];
+    for (int i = 0; i < MAX_PRESETS; i++) {
+        onFlash[i] = recordKept[i] || (recordOk[i] && docVersion == CONFIG_CURRENT_VERSION);
+    }
+    if (!apply_config_doc(doc, onFlash)) {
+        return false;
     }
 
-    config_unlock();
+    // A lost record may have been the active preset; play the first
+    // surviving one rather than an empty slot.
+    if (current_config.presetNames[current_config.active_preset_index][0] == '\0') {
+        int fallback = -1;
+        for (int i = 0; i < MAX_PRESETS && fallback < 0; i++) {
+            if (current_config.presetNames[i][0] != '\0') fallback = i;
+        }
+        if (fallback < 0) {
+            DebugSerial.println("Config store holds no presets");
+            return false;
+        }
+        set_active_preset(fallback);
+    }
+    return true;
+}
+
+bool load_config() {
+    if (config_store_present()) {
+        if (load_config_from_store()) {
+            lastLoadSource = "store";
+            DebugSerial.println("Config loaded from record store");
+            return true;
+        }
+        if (storeHeldBack) {
+            DebugSerial.println("No memory to read the config record store, saves held back");
+            return false;
+        }
+        DebugSerial.printf("Config record store unreadable, trying %s\n", CONFIG_FILE);
+    }
+    // Devices upgraded from the single-file format: the file is read once
+    // here, and the first save writes the records.
+    if (load_config_from(CONFIG_FILE)) {
+        lastLoadSource = "legacy";
+        return true;
+    }
+    return false;
+}
+
+bool load_config_from(const char* path) {
+    if (!LittleFS.exists(path)) {
+        DebugSerial.println("Config file not found, using defaults");
+        return false;
+    }
 
-    // Serialize to MessagePack. Write to a temp file first, then rename over
-    // the live config so a power loss mid-write can't corrupt it.
-    const char* tmpFile = "/config.tmp";
-    File file = LittleFS.open(tmpFile, "w");
+    File file = LittleFS.open(path, "r");
     if (!file) {
-        DebugSerial.println("Failed to open temp config file for writing");
-        return;
+        DebugSerial.println("Failed to open config file for reading");
+        return false;
+    }
+
+    // Create a buffer to hold the MessagePack data
+    size_t fileSize = file.size();
+    if (fileSize == 0) {
+        DebugSerial.println("Config file is empty");
+        file.close();
+        return false;
     }
 
-    size_t bytesWritten = serializeMsgPack(doc, file);
+    std::unique_ptr<char[]> buffer(new char[fileSize]);
+    file.readBytes(buffer.get(), fileSize);
     file.close();
 
-    if (bytesWritten == 0) {
-        DebugSerial.println("Failed to write config file");
-        LittleFS.remove(tmpFile);
-        return;
+    // Deserialize MessagePack
+    JsonDocument doc;
+    DeserializationError error = deserializeMsgPack(doc, buffer.get(), fileSize);
+
+    if (error) {
+        DebugSerial.print("Failed to deserialize config: ");
+        DebugSerial.println(error.c_str());
+        return false;
+    }
+
+    if (!apply_config_doc(doc)) {
+        return false;
     }
+    storeHeldBack = false;
 
-    if (!LittleFS.rename(tmpFile, CONFIG_FILE)) {
-        // Some FS implementations refuse to rename over an existing file
-        LittleFS.remove(CONFIG_FILE);
-        if (!LittleFS.rename(tmpFile, CONFIG_FILE)) {
-            DebugSerial.println("Failed to move temp config into place");
-            return;
+    DebugSerial.println("Config loaded successfully");
+    return true;
+}
+
+bool save_config() {
+    if (storeHeldBack) {
+        DebugSerial.println("Config save skipped: the record store wasn't read");
+        return false;
+    }
+    uint32_t started = micros();
+    size_t bytesWritten = 0;
+    uint8_t records = 0;
+    bool allOk = true;
+
+    // Globals: a few hundred bytes, so always serialized - the store skips
+    // the write when nothing in it changed. Read from the snapshot, so this
+    // takes the config lock only if the snapshot needs a rebuild.
+    {
+        ConfigSnapshotPtr snap = config_snapshot();
+        JsonDocument doc;
+        if (snap) {
+            globals_to_json(*snap, doc.to<JsonObject>());
+        }
+        bool ok = false;
+        size_t written = snap ? store_record(CONFIG_STORE_GLOBALS, doc, ok) : 0;
+        allOk &= ok;
+        if (written > 0) {
+            bytesWritten += written;
+            records++;
+        }
+    }
+
+    // Presets: only the resident ones whose contents changed since they were
+    // stored, edits evicted before this save, and emptied slots whose record
+    // is still on flash. A dirty preset is copied out under a short lock
+    // scope and serialized from the copy, so the lock is never held across
+    // JSON building or the flash write. A resident entry stays pinned until
+    // the record is down; an evicted edit is released only if nothing
+    // replaced it meanwhile.
+    std::unique_ptr<Preset> scratch(new (std::nothrow) Preset());
+    for (int i = 0; i < MAX_PRESETS && scratch; i++) {
+        uint32_t crc = 0;
+        int e;
+        bool pending = false;
+        uint16_t generation = 0;
+        {
+            ConfigLock lock;
+            cache_lock();
+            e = cache_find_locked(i);
+            bool dirty;
+            if (e >= 0) {
+                crc = preset_state_crc(presetCache[e].preset);
+                dirty = !storedPresetClean[i] || storedPresetCrc[i] != crc;
+                if (dirty) {
+                    *scratch = presetCache[e].preset;
+                    presetCache[e].pins++;
+                }
+            } else if (current_config.presetNames[i][0] == '\0') {
+                // Not resident and emptied: the record, if still there, goes
+                pending_drop_locked(i);
+                dirty = !storedPresetClean[i];
+                scratch->name[0] = '\0';
+            } else {
+                // Not resident: its record is current, unless an edit was
+                // evicted before it was stored
+                const PendingWriteBack& evicted = pendingWriteBacks[i];
+                pending = dirty = evicted.preset != nullptr;
+                if (dirty) {
+                    *scratch = *evicted.preset;
+                    crc = evicted.crc;
+                    generation = evicted.generation;
+                }
+            }
+            cache_unlock();
+            if (!dirty) {
+                continue;
+            }
+        }
+
+        bool ok;
+        bool removed = false;
+        size_t written = store_preset(i, *scratch, crc, ok, &removed);
+        if (e >= 0) {
+            cache_lock();
+            cache_release_locked(e);
+            cache_unlock();
+        } else if (pending && ok) {
+            cache_lock();
+            if (pendingWriteBacks[i].generation == generation) {
+                pending_drop_locked(i);
+            }
+            cache_unlock();
+        }
+        if (!ok) {
+            allOk = false;
+            continue; // stays dirty; the next save retries it
+        }
+        if (removed) records++;
+        if (written > 0) {
+            bytesWritten += written;
+            records++;
         }
     }
 
-    DebugSerial.print("Config saved successfully, ");
-    DebugSerial.print(bytesWritten);
-    DebugSerial.println(" bytes written");
+    if (!scratch) {
+        DebugSerial.println("No memory to save presets, will retry");
+        allOk = false;
+    }
+
+    uint32_t elapsedUs = micros() - started;
+    if (records > 0) {
+        config_store_stats.saves++;
+        config_store_stats.lastSaveUs = elapsedUs;
+        config_store_stats.lastSaveBytes = bytesWritten;
+        config_store_stats.lastSaveRecords = records;
+        config_store_stats.totalBytesWritten += bytesWritten;
+    }
+
+    DebugSerial.printf("Config saved: %u record(s), %u bytes written in %lu us%s\n",
+                       records, (unsigned)bytesWritten, (unsigned long)elapsedUs,
+                       allOk ? "" : " (some records failed, will retry)");
+    return allOk;
 }
 
 void reset_config_to_defaults() {
@@ -532,27 +1227,46 @@ void reset_config_to_defaults() {
 
     current_config.version = CONFIG_CURRENT_VERSION;
     strlcpy(current_config.deviceName, DEVICE_NAME_DEFAULT, sizeof(current_config.deviceName));
-    current_config.active_preset_index = 0;
     current_config.toneFrequency = 0;
     current_config.toneVolume = 0;
     current_config.noiseVolume = 0;
     current_config.muted = false;
     current_config.mutePercent = 0;
+    current_config.levelLog = false;
 
     current_config.speakerGains = SpeakerGains();
     current_config.inputGains = InputGains();
 
-    // First preset is 'Default' on the default template; the rest are unused
+    // First preset is 'Default' on the default template; the rest are
+    // unused. Resident copies are reset in place; every other slot's record
+    // is removed by the next save.
     for (int i = 0; i < MAX_PRESETS; i++) {
-        Preset& preset = current_config.presets[i];
-        build_preset_from_template(preset, DEFAULT_TEMPLATE_ID);
-        preset.name[0] = '\0';
+        strlcpy(current_config.presetNames[i], i == 0 ? "Default" : "",
+                sizeof(current_config.presetNames[i]));
+    }
+    cache_lock();
+    for (int e = 0; e < PRESET_CACHE_SLOTS; e++) {
+        PresetCacheEntry& entry = presetCache[e];
+        if (entry.slot >= 0) {
+            reset_preset(entry.preset, current_config.presetNames[entry.slot]);
+        }
+    }
+    // Only runs at boot, with at most the failed load's active preset
+    // resident, so there is always a free entry to claim.
+    int e = cache_acquire_locked(0, true);
+    if (e >= 0) {
+        cache_install_active_locked(e, 0);
+    } else {
+        DebugSerial.println("No room to page in the default preset");
     }
-    strlcpy(current_config.presets[0].name, "Default", sizeof(current_config.presets[0].name));
+    cache_unlock();
+    mark_all_presets_dirty();
+    config_snapshot_invalidate();
 }
 
 void init_config() {
     configMutex = xSemaphoreCreateMutex();
+    cacheMutex = xSemaphoreCreateMutex();
 
     // Initialize LittleFS
     if (!LittleFS.begin()) {
@@ -561,12 +1275,29 @@ void init_config() {
         return;
     }
 
-    // Try to load existing config
+    config_store_init();
+
+    // Try to load existing config; if that fails, use defaults
+    uint32_t loadStarted = micros();
     if (!load_config()) {
-        // If loading fails, use defaults and save them
         reset_config_to_defaults();
-        save_config();
+        lastLoadSource = "defaults";
     }
+    config_store_stats.bootLoadUs = micros() - loadStarted;
+    config_store_stats.bootSource = lastLoadSource;
+    DebugSerial.printf("Config load (%s) took %lu us\n", lastLoadSource,
+                       (unsigned long)config_store_stats.bootLoadUs);
+
+    // Writes whatever isn't on flash yet in record form: defaults, a legacy
+    // /config.msgpack being migrated, migrated or damaged records. A clean
+    // store load writes nothing.
+    save_config();
+
+    // The paging baseline: with every preset resident this was ~44KB of
+    // DRAM (sizeof(Preset) ~3.7KB x 12) before the heap even started.
+    DebugSerial.printf("Config RAM: %u bytes, %d of %d preset(s) resident; free internal heap %u\n",
+                       (unsigned)(sizeof(Config) + sizeof(presetCache)), preset_cache_resident(),
+                       PRESET_CACHE_SLOTS, (unsigned)heap_caps_get_free_size(MALLOC_CAP_INTERNAL));
 
     updateTeensyWithActivePresetParameters();
 }
@@ -575,12 +1306,23 @@ void init_config() {
 // The Teensy is dumb and per-channel: it never sees crossover ids or
 // templates. Everything below resolves references to concrete values first.
 
-void sendInputEqPointToTeensy(int index, const PEQPoint& point) {
-    char idStr[8];
+void sendInputEqPointToTeensy(int set, int index, const PEQPoint& point) {
+    char setStr[8], idStr[8];
+    snprintf(setStr, sizeof(setStr), "%d", set);
     snprintf(idStr, sizeof(idStr), "%d", index);
     char pointData[40];
     snprintf(pointData, sizeof(pointData), "%.1f %.2f %.2f", point.freq, point.q, point.gain);
-    sendToTeensy(CMD_SET_INPUT_EQ, idStr, pointData);
+    sendToTeensy(CMD_SET_INPUT_EQ, setStr, idStr, pointData);
+}
+
+void sendInputEqLevelsToTeensy(const InputEq& eq) {
+    char ref[8], spl[MAX_PEQ_SETS][8];
+    snprintf(ref, sizeof(ref), "%d", eq.refSpl);
+    for (int i = 0; i < MAX_PEQ_SETS; i++) {
+        snprintf(spl[i], sizeof(spl[i]), "%d", eq.sets[i].spl);
+    }
+    static_assert(MAX_PEQ_SETS == 3, "setInputEqSpl carries one level per set slot");
+    sendToTeensy(CMD_SET_INPUT_EQ_SPL, ref, spl[0], spl[1], spl[2]);
 }
 
 void sendOutputEqPointToTeensy(int channel, int band, const PEQPoint& point) {
@@ -627,7 +1369,7 @@ void sendDynamicsToTeensy(const Dynamics& dyn) {
 }
 
 void updateTeensyWithActivePresetParameters() {
-    Preset* activePreset = &current_config.presets[current_config.active_preset_index];
+    Preset* activePreset = &active_preset();
 
     // Silence the outputs for the duration of the sync. Everything below
     // lands one command at a time and the Teensy would otherwise play each
@@ -668,6 +1410,7 @@ void updateTeensyWithActivePresetParameters() {
 
         // Bare "setFir <ch>" clears the filter
         sendToTeensy(CMD_SET_FIR, a, output.fir[0] != '\0' ? output.fir : nullptr);
+        sendToTeensy(CMD_SET_OUTPUT_FIR_COMPILED, a, output.firCompiled ? "1" : "0");
 
         // Routing last, the same discipline the compressor uses below: the
         // source mix is what makes a channel audible at all, so it goes on
@@ -686,22 +1429,22 @@ void updateTeensyWithActivePresetParameters() {
     sendDynamicsToTeensy(activePreset->dynamics);
 
     // Shared input EQ. Points are always sent (even when EQ is disabled) so
-    // the Teensy has the right curve the moment EQ is enabled.
+    // the Teensy has the right curve the moment EQ is enabled. Every SPL set
+    // goes, slot by slot: the Teensy interpolates between them as the
+    // volume moves, without any further EQ commands.
     sendOnOffToTeensy(CMD_SET_INPUT_EQ_ENABLED, activePreset->inputEq.enabled);
-    int num_points = 0;
+    sendInputEqLevelsToTeensy(activePreset->inputEq);
     for (int i = 0; i < MAX_PEQ_SETS; i++) {
-        if (activePreset->inputEq.sets[i].spl == 0) {
-            const PEQSet& set = activePreset->inputEq.sets[i];
-            for (int j = 0; j < set.num_points; j++) {
-                sendInputEqPointToTeensy(j, set.points[j]);
-            }
-            num_points = set.num_points;
-            break;
+        const PEQSet& set = activePreset->inputEq.sets[i];
+        int num_points = set.spl == -1 ? 0 : set.num_points;
+        for (int j = 0; j < num_points; j++) {
+            sendInputEqPointToTeensy(i, j, set.points[j]);
         }
+        // Disable all bands beyond the active points
+        snprintf(a, sizeof(a), "%d", i);
+        snprintf(b, sizeof(b), "%d", num_points);
+        sendToTeensy(CMD_RESET_INPUT_EQ, a, b);
     }
-    // Disable all bands beyond the active points
-    snprintf(a, sizeof(a), "%d", num_points);
-    sendToTeensy(CMD_RESET_INPUT_EQ, a);
 
     // Send volume (per-preset) and mute state
     sendFloatToTeensy(CMD_SET_VOLUME, activePreset->volume / 100.0f);
@@ -726,6 +1469,10 @@ void updateTeensyWithActivePresetParameters() {
     // parameters and setInputGains uses all of them)
     sendFloatToTeensy(CMD_SET_PLAYBACK_GAIN, current_config.inputGains.recorder);
 
+    // Level log - the Teensy only acts on a change, so re-sending it on a
+    // preset switch doesn't restart a running log
+    sendOnOffToTeensy(CMD_SET_LEVEL_LOG, current_config.levelLog);
+
     // Queue the FIR reload before releasing, so the Teensy sees the load
     // request while still muted and can keep holding across the SD read.
     // Every caller of this function paired it with loadFirFilters() anyway.
@@ -737,7 +1484,7 @@ void updateTeensyWithActivePresetParameters() {
 }
 
 void loadFirFilters() {
-    Preset* activePreset = &current_config.presets[current_config.active_preset_index];
+    Preset* activePreset = &active_preset();
     // Stale failures must not outlive the load that caused them; the Teensy
     // re-reports any that still apply as FIRERR lines during this load.
     clearFirLoadErrors();
@@ -3,6 +3,7 @@
 
 #include <Arduino.h>
 #include <ArduinoJson.h>
+#include <memory>
 
 // --- Constants ---
 // V1 is a clean break for the 8-output ESP32-S3 + Teensy hardware
@@ -31,11 +32,13 @@
 #define MAX_OUTPUT_PEQ 10
 #define MAX_PEQ_SETS 3
 #define MAX_PEQ_POINTS 15   // input EQ points per SPL set
-#define FIR_TAP_POOL 12288  // taps shared across all outputs
+#define FIR_TAP_POOL 15360  // taps shared across all outputs
 #define MAX_DELAY_US 20000
 #define OUTPUT_GAIN_MIN_DB -40.0
 #define OUTPUT_GAIN_MAX_DB 10.0
 #define PRESET_VOLUME_DEFAULT 50
+#define INPUT_EQ_REF_SPL_DEFAULT 100 // dB SPL at full volume
+#define INPUT_EQ_SPL_MAX 120
 
 #define OUTPUT_LABEL_MAX_LEN 24
 #define XOVER_ID_MAX_LEN 15
@@ -47,6 +50,11 @@
 #define DEVICE_NAME_MAX_LEN 24
 #define DEVICE_NAME_DEFAULT "vybes"
 
+// The single-file MessagePack config. Storage proper is the per-preset
+// record store (config_store.h); this format lives on as the /backup and
+// /restore interchange file, and as the source a device upgraded from the
+// single-file firmware migrates from on first boot. That file is left in
+// place, never rewritten, so a downgrade finds the config as it was then.
 extern const char* CONFIG_FILE;
 
 // --- Data Structures ---
@@ -66,9 +74,12 @@ struct PEQSet {
 };
 
 // Shared input EQ (preference curve + SPL sets) applied to the L/R buses
-// ahead of the routing matrix
+// ahead of the routing matrix. The Teensy holds every set and plays the
+// curve between them for the listening level the master volume gives:
+// refSpl at full volume (see setInputEqSpl in teensy_protocol.h).
 struct InputEq {
     bool enabled = false;
+    int refSpl = INPUT_EQ_REF_SPL_DEFAULT;
     PEQSet sets[MAX_PEQ_SETS];
 };
 
@@ -113,6 +124,7 @@ struct Output {
     int num_peq = 0;
     bool eqEnabled = true; // PEQ bypass; the points above are kept either way
     char fir[FIR_FILENAME_LEN + 1] = ""; // filename on the Teensy SD, "" = none
+    bool firCompiled = false; // crossover + PEQ folded into the FIR (CMD_SET_OUTPUT_FIR_COMPILED)
     double delayUs = 0.0;
     double gainDb = 0.0;
     bool invert = false;
@@ -186,7 +198,10 @@ struct Config {
     // SSID. Configurable so several Vybes devices can share one network.
     char deviceName[DEVICE_NAME_MAX_LEN + 1] = DEVICE_NAME_DEFAULT;
     int active_preset_index = 0;
-    Preset presets[MAX_PRESETS];
+    // Every slot's name ("" = empty slot). The presets themselves are not
+    // held here: all but a few live only in the record store and are paged
+    // in on access - see PresetRef below.
+    char presetNames[MAX_PRESETS][PRESET_NAME_MAX_LEN] = {};
     // Add other global settings here if needed
     int toneFrequency = 0;
     int toneVolume = 0;
@@ -199,16 +214,86 @@ struct Config {
     int mutePercent = 0;            // 0-100
     SpeakerGains speakerGains;
     InputGains inputGains;
+    // Once-a-second level/spectrum log to the Teensy's SD card
+    // (CMD_SET_LEVEL_LOG). A device setting, not per preset.
+    bool levelLog = false;
 };
 
 // --- Global Configuration Variable ---
 extern Config current_config;
 
-// The preset the device is playing. active_preset_index is clamped on load
-// and whenever a preset is deleted, so this always names a real slot.
-inline Preset& active_preset() {
-    return current_config.presets[current_config.active_preset_index];
-}
+// --- Preset paging ---
+// A full Preset is ~3.7KB, so holding all twelve cost ~44KB of internal RAM
+// - more than one TLS socket - for presets that are mostly never touched
+// between reboots. Only the active preset and the few most recently used
+// are resident, in a fixed cache of PRESET_CACHE_SLOTS entries; the rest
+// are read from their store record (config_store.h) when a handler needs
+// one. An evicted preset that was edited since it was stored is handed to
+// the next save_config, which writes it outside every lock; until then a
+// page-in takes it back from there rather than from its stale record, so
+// paging never loses an edit.
+//
+// The active preset is always resident and never evicted. Every other
+// preset is reached through a PresetRef, which pins its cache entry for
+// the handle's lifetime. A handler holds at most one PresetRef at a time
+// (copy reads its source with config_copy_preset), so with two httpd tasks
+// at most three entries are ever pinned and a page-in always finds a
+// victim.
+#define PRESET_CACHE_SLOTS 4
+
+// The preset the device is playing. Always resident; the reference is
+// valid until the next set_active_preset().
+Preset& active_preset();
+
+// Make 'index' the active preset, paging it in first. Returns false (and
+// changes nothing) if it couldn't be read. Does not sync the Teensy.
+// Caller holds the config lock.
+bool set_active_preset(int index);
+
+// Name a slot - "" deletes the preset in it. Updates presetNames and the
+// preset itself (paging it in if needed). Returns false if it couldn't be
+// paged in. Caller holds the config lock.
+bool set_preset_name(int index, const char* name);
+
+// A pinned, possibly paged-in, preset slot. Test it before use: it is empty
+// if the index is out of range or the preset couldn't be read (the handler
+// should reply 503). Paging in an empty slot gives a default preset with no
+// name, ready to be filled in and named. The same locking rules apply as
+// for current_config: mutate under a ConfigLock.
+class PresetRef {
+public:
+    PresetRef() = default;
+    explicit PresetRef(int index) { reset(index); }
+    ~PresetRef() { release(); }
+    PresetRef(const PresetRef&) = delete;
+    PresetRef& operator=(const PresetRef&) = delete;
+
+    explicit operator bool() const { return preset_ != nullptr; }
+    Preset* operator->() const { return preset_; }
+    Preset& operator*() const { return *preset_; }
+    Preset* get() const { return preset_; }
+
+    // Release the current slot, if any, and pin 'index' instead
+    void reset(int index);
+    void release();
+
+private:
+    int entry_ = -1;
+    Preset* preset_ = nullptr;
+};
+
+// Paging counters, reported on GET /status ("presetCache")
+struct PresetCacheStats {
+    uint32_t hits = 0;
+    uint32_t pageIns = 0;    // reads from the record store
+    uint32_t writeBacks = 0; // evictions that handed an edit to the next save
+    uint32_t failures = 0;   // PresetRefs that came back empty
+};
+
+extern PresetCacheStats preset_cache_stats;
+
+// How many cache entries currently hold a preset
+int preset_cache_resident();
 
 // current_config is shared between the two httpd server tasks (API handlers)
 // and the loop task (debounced save, IR remote, button). Handlers must hold
@@ -225,6 +310,51 @@ struct ConfigLock {
     ConfigLock& operator=(const ConfigLock&) = delete;
 };
 
+// --- Read snapshots ---
+// An immutable, reference-counted copy of the globals, the preset names and
+// the active preset (snapshot_cell.h). Readers - GET handlers, /backup, the
+// save - work from one of these instead of holding the config lock while
+// they serialize and send, so they never make a writer wait on a socket.
+// Writers change nothing: they still mutate current_config under a
+// ConfigLock and call scheduleConfigWrite(), which invalidates the
+// snapshot; the next reader rebuilds it with one short locked copy.
+//
+// ~4.4KB each (the Preset dominates). Normally one exists; a request still
+// holding an old one keeps it alive until it finishes.
+struct ConfigSnapshot {
+    char deviceName[DEVICE_NAME_MAX_LEN + 1] = "";
+    int active_preset_index = 0;
+    int toneFrequency = 0;
+    int toneVolume = 0;
+    int noiseVolume = 0;
+    bool muted = false;
+    int mutePercent = 0;
+    SpeakerGains speakerGains;
+    InputGains inputGains;
+    bool levelLog = false;
+    char presetNames[MAX_PRESETS][PRESET_NAME_MAX_LEN] = {};
+    Preset active; // the preset at active_preset_index
+
+    // Slot of the named preset, or -1 (the snapshot's find_preset_by_name)
+    int find_preset(const char* name) const;
+};
+
+using ConfigSnapshotPtr = std::shared_ptr<const ConfigSnapshot>;
+
+// The current snapshot. Never null once init_config has run. Must not be
+// called with the config lock held (a rebuild takes it).
+ConfigSnapshotPtr config_snapshot();
+
+// Mark the snapshot stale after mutating current_config. Lock-free, safe
+// with or without the config lock held; scheduleConfigWrite() calls it.
+void config_snapshot_invalidate();
+
+// Copy one preset out, for readers that need a preset other than the
+// active one: from the cache under a short lock if it is resident, else
+// straight from its record without disturbing the cache. Returns false for
+// an empty slot or an unreadable record.
+bool config_copy_preset(int index, Preset& out);
+
 // --- Function Prototypes ---
 
 /**
@@ -234,13 +364,16 @@ struct ConfigLock {
 void init_config();
 
 /**
- * @brief Saves the current_config struct.
- * Call this after making any changes to the configuration.
+ * @brief Saves the current_config struct to the record store, rewriting only
+ * the records whose contents changed. Call scheduleConfigWrite() rather than
+ * this from handlers - saves are debounced.
+ * @return false if any record failed to write (it is retried next save).
  */
-void save_config();
+bool save_config();
 
 /**
- * @brief Loads the configuration from LittleFS.
+ * @brief Loads the configuration from the record store, falling back to a
+ * legacy /config.msgpack.
  * @return true if successful, false if there was an error.
  */
 bool load_config();
@@ -251,6 +384,14 @@ bool load_config();
  */
 bool load_config_from(const char* path);
 
+/**
+ * @brief Builds the whole config in the /config.msgpack document shape (the
+ * /backup format) from the snapshot plus one short locked copy per preset.
+ * Must not be called with the config lock held.
+ * @return false if the scratch buffers couldn't be allocated.
+ */
+bool config_to_json(JsonDocument& doc);
+
 /**
  * @brief Resets the configuration to its default state and saves to LittleFS.
  */
@@ -292,8 +433,12 @@ void dynamics_to_json(const Dynamics& dyn, JsonObject obj);
 
 void updateTeensyWithActivePresetParameters();
 
-// Queue a single shared-input-EQ point for the Teensy (band index + freq/q/gain)
-void sendInputEqPointToTeensy(int index, const PEQPoint& point);
+// Queue a single shared-input-EQ point for the Teensy (SPL set slot, band
+// index + freq/q/gain)
+void sendInputEqPointToTeensy(int set, int index, const PEQPoint& point);
+
+// Queue every set slot's SPL and the reference level (setInputEqSpl)
+void sendInputEqLevelsToTeensy(const InputEq& eq);
 
 // Queue a single output-PEQ point for the Teensy
 void sendOutputEqPointToTeensy(int channel, int band, const PEQPoint& point);
@@ -0,0 +1,196 @@
+#include "globals.h"
+#include "config_store.h"
+#include <LittleFS.h>
+#include <esp_rom_crc.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+ConfigStoreStats config_store_stats;
+
+static const uint32_t RECORD_MAGIC = 0x52435956; // "VYCR" little-endian
+static const size_t HEADER_BYTES = 16;
+// A full preset serializes to ~3KB; anything near this is not a record.
+static const size_t RECORD_MAX_PAYLOAD = 16 * 1024;
+
+// Serializes record writes between the loop task's debounced save and a
+// /restore completing on an httpd task - both may rewrite the same slot.
+static SemaphoreHandle_t storeMutex = nullptr;
+
+// CRC of each slot's payload as it currently sits on flash, so a save whose
+// serialized record came out identical (an edit reverted before the
+// debounce fired, a no-op PUT) costs no flash write at all. A record from
+// an older schema is always rewritten, even with an identical payload, so
+// its header stops asking for a migration that has already run.
+static uint32_t flashCrc[CONFIG_STORE_SLOTS];
+static uint8_t flashVersion[CONFIG_STORE_SLOTS];
+static bool flashValid[CONFIG_STORE_SLOTS];
+
+static void recordPath(int slot, char* path, size_t size, const char* ext) {
+    if (slot == CONFIG_STORE_GLOBALS) {
+        snprintf(path, size, CONFIG_STORE_DIR "/globals.%s", ext);
+    } else {
+        snprintf(path, size, CONFIG_STORE_DIR "/p%02d.%s", slot, ext);
+    }
+}
+
+static void putU32(uint8_t* p, uint32_t v) {
+    p[0] = v & 0xFF;
+    p[1] = (v >> 8) & 0xFF;
+    p[2] = (v >> 16) & 0xFF;
+    p[3] = (v >> 24) & 0xFF;
+}
+
+static uint32_t getU32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+uint32_t config_store_crc(const void* data, size_t length) {
+    return esp_rom_crc32_le(0, (const uint8_t*)data, length);
+}
+
+void config_store_init() {
+    if (storeMutex == nullptr) {
+        storeMutex = xSemaphoreCreateMutex();
+    }
+    if (!LittleFS.exists(CONFIG_STORE_DIR)) {
+        LittleFS.mkdir(CONFIG_STORE_DIR);
+    }
+}
+
+bool config_store_present() {
+    char path[32];
+    recordPath(CONFIG_STORE_GLOBALS, path, sizeof(path), "rec");
+    return LittleFS.exists(path);
+}
+
+static StoreRead read_record(int slot, std::unique_ptr<uint8_t[]>& payload,
+                             size_t& length, uint8_t& schemaVersion) {
+    char path[32];
+    recordPath(slot, path, sizeof(path), "rec");
+    const bool wasValid = flashValid[slot];
+    flashValid[slot] = false;
+    if (!LittleFS.exists(path)) {
+        return StoreRead::Missing;
+    }
+    File file = LittleFS.open(path, "r");
+    if (!file) {
+        return StoreRead::Missing;
+    }
+
+    uint8_t header[HEADER_BYTES];
+    if (file.read(header, HEADER_BYTES) != HEADER_BYTES ||
+        getU32(header) != RECORD_MAGIC || header[4] != CONFIG_STORE_FORMAT) {
+        file.close();
+        DebugSerial.printf("Config record %s: bad header\n", path);
+        return StoreRead::Corrupt;
+    }
+    schemaVersion = header[5];
+    length = getU32(header + 8);
+    uint32_t crc = getU32(header + 12);
+    if (length == 0 || length > RECORD_MAX_PAYLOAD || file.size() != HEADER_BYTES + length) {
+        file.close();
+        DebugSerial.printf("Config record %s: bad length %u\n", path, (unsigned)length);
+        return StoreRead::Corrupt;
+    }
+
+    payload.reset(new (std::nothrow) uint8_t[length]);
+    if (!payload) {
+        file.close();
+        DebugSerial.printf("Config record %s: no memory for %u bytes\n", path, (unsigned)length);
+        flashValid[slot] = wasValid; // nothing was learned about the record
+        return StoreRead::NoMemory;
+    }
+    size_t got = file.read(payload.get(), length);
+    file.close();
+    if (got != length || config_store_crc(payload.get(), length) != crc) {
+        DebugSerial.printf("Config record %s: CRC mismatch\n", path);
+        payload.reset();
+        return StoreRead::Corrupt;
+    }
+
+    flashCrc[slot] = crc;
+    flashVersion[slot] = schemaVersion;
+    flashValid[slot] = true;
+    return StoreRead::Ok;
+}
+
+// Under the write lock: presets are paged in at runtime now, so a read can
+// race a write-back of the same slot, and both update its flash state.
+StoreRead config_store_read(int slot, std::unique_ptr<uint8_t[]>& payload,
+                            size_t& length, uint8_t& schemaVersion) {
+    xSemaphoreTake(storeMutex, portMAX_DELAY);
+    StoreRead result = read_record(slot, payload, length, schemaVersion);
+    xSemaphoreGive(storeMutex);
+    return result;
+}
+
+size_t config_store_write(int slot, const uint8_t* payload, size_t length, bool& skipped) {
+    uint32_t crc = config_store_crc(payload, length);
+    skipped = false;
+
+    xSemaphoreTake(storeMutex, portMAX_DELAY);
+    if (flashValid[slot] && flashCrc[slot] == crc &&
+        flashVersion[slot] == CONFIG_CURRENT_VERSION) {
+        xSemaphoreGive(storeMutex);
+        skipped = true;
+        return 0;
+    }
+
+    uint8_t header[HEADER_BYTES] = {0};
+    putU32(header, RECORD_MAGIC);
+    header[4] = CONFIG_STORE_FORMAT;
+    header[5] = CONFIG_CURRENT_VERSION;
+    putU32(header + 8, (uint32_t)length);
+    putU32(header + 12, crc);
+
+    char path[32], tmpPath[32];
+    recordPath(slot, path, sizeof(path), "rec");
+    recordPath(slot, tmpPath, sizeof(tmpPath), "tmp");
+
+    size_t written = 0;
+    File file = LittleFS.open(tmpPath, "w");
+    if (file) {
+        written = file.write(header, HEADER_BYTES);
+        written += file.write(payload, length);
+        file.close();
+    }
+    if (written != HEADER_BYTES + length) {
+        DebugSerial.printf("Failed to write config record %s\n", tmpPath);
+        LittleFS.remove(tmpPath);
+        xSemaphoreGive(storeMutex);
+        return 0;
+    }
+
+    if (!LittleFS.rename(tmpPath, path)) {
+        // Some FS implementations refuse to rename over an existing file
+        LittleFS.remove(path);
+        if (!LittleFS.rename(tmpPath, path)) {
+            DebugSerial.printf("Failed to move config record %s into place\n", path);
+            flashValid[slot] = false;
+            xSemaphoreGive(storeMutex);
+            return 0;
+        }
+    }
+
+    flashCrc[slot] = crc;
+    flashVersion[slot] = CONFIG_CURRENT_VERSION;
+    flashValid[slot] = true;
+    xSemaphoreGive(storeMutex);
+    return written;
+}
+
+bool config_store_remove(int slot, bool& removed) {
+    char path[32];
+    recordPath(slot, path, sizeof(path), "rec");
+
+    xSemaphoreTake(storeMutex, portMAX_DELAY);
+    removed = LittleFS.exists(path);
+    bool ok = !removed || LittleFS.remove(path);
+    if (ok) {
+        flashValid[slot] = false;
+    } else {
+        removed = false;
+    }
+    xSemaphoreGive(storeMutex);
+    return ok;
+}
@@ -0,0 +1,74 @@
+#ifndef CONFIG_STORE_H
+#define CONFIG_STORE_H
+
+#include <Arduino.h>
+#include <memory>
+#include "config.h"
+
+// Record-per-slot storage for current_config.
+//
+// One file per preset slot (/cfg/pNN.rec) plus one for the global settings
+// (/cfg/globals.rec), so an edit to one preset rewrites one ~3KB record
+// instead of the whole 12-preset config. Each record is a fixed header
+// followed by the same MessagePack object /config.msgpack holds for that
+// piece, so the parse, migrate_config and the /backup format all stay
+// shared with the single-file path - only the container differs.
+//
+// Header (little-endian, 16 bytes):
+//   magic "VYCR" | u8 store format | u8 schema version (CONFIG_CURRENT_VERSION
+//   when written) | u16 reserved | u32 payload length | u32 CRC32 of payload
+//
+// A record whose magic, length or CRC doesn't check out is treated as
+// corrupt, never parsed. Writes go to a temp file and rename over the
+// record, so a power loss mid-write leaves the previous record intact.
+// Empty preset slots have no file at all.
+
+#define CONFIG_STORE_DIR "/cfg"
+#define CONFIG_STORE_FORMAT 1
+#define CONFIG_STORE_GLOBALS MAX_PRESETS // slot index of the globals record
+#define CONFIG_STORE_SLOTS (MAX_PRESETS + 1)
+
+// NoMemory is transient (the payload buffer couldn't be allocated) and says
+// nothing about the record itself - callers must not clear the slot for it.
+enum class StoreRead : uint8_t { Ok, Missing, Corrupt, NoMemory };
+
+// Call once after LittleFS is mounted: creates the store directory and the
+// write lock.
+void config_store_init();
+
+// True once a globals record exists - the marker that this device has been
+// migrated off the single-file /config.msgpack.
+bool config_store_present();
+
+// Read one record's payload. schemaVersion receives the header's version.
+StoreRead config_store_read(int slot, std::unique_ptr<uint8_t[]>& payload,
+                            size_t& length, uint8_t& schemaVersion);
+
+// Write one record. Returns the bytes written (header + payload), 0 on
+// failure. Skips the write - and returns 0 with 'skipped' set - when the
+// payload CRC matches what the slot already holds on flash.
+size_t config_store_write(int slot, const uint8_t* payload, size_t length, bool& skipped);
+
+// Delete a slot's record (an emptied preset). Returns false only if a
+// record existed and couldn't be removed; 'removed' says whether one went.
+bool config_store_remove(int slot, bool& removed);
+
+// CRC32 (IEEE, the ROM implementation) - also used by config.cpp to spot
+// which presets changed since they were last stored.
+uint32_t config_store_crc(const void* data, size_t length);
+
+// Save/load telemetry, reported on GET /status ("storage"). lastSaveBytes is
+// the flash-wear number: what one debounced save actually cost.
+struct ConfigStoreStats {
+    uint32_t saves = 0;            // debounced saves that wrote anything
+    uint32_t lastSaveUs = 0;       // wall time of the last save, lock waits included
+    uint32_t lastSaveBytes = 0;    // bytes written by the last save
+    uint8_t lastSaveRecords = 0;   // records rewritten (or removed) by it
+    uint32_t totalBytesWritten = 0;
+    uint32_t bootLoadUs = 0;       // load_config() at boot
+    const char* bootSource = "defaults"; // "store" | "legacy" | "defaults"
+};
+
+extern ConfigStoreStats config_store_stats;
+
+#endif // CONFIG_STORE_H
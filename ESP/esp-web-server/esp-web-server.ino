@@ -11,6 +11,7 @@
 #include "remote_control.h"
 #include "wifi_setup.h"
 #include "health.h"
+#include "mem_pool.h"
 
 // Define global objects
 RemoteControl remoteControl;
@@ -29,7 +30,10 @@ void handleDebounceWrite() {
     }
 }
 
+// Every mutation of current_config ends here, which makes it the one place
+// the read snapshot (config.h) needs invalidating.
 void scheduleConfigWrite() {
+    config_snapshot_invalidate();
     configChanged = true;
     lastConfigChange = millis();
 }
@@ -48,6 +52,10 @@ void setup() {
     DebugSerial.printf("Reset reason: %s\n", healthResetReasonName());
     initHealth();
 
+    // Before anything can broadcast or build a pooled JsonDocument, and
+    // while the heap is still one unfragmented piece (mem_pool.h)
+    initMemPools();
+
     // UART2 is the Teensy link. See docs/WIRING.md.
     TeensySerial.begin(TEENSY_BAUD, SERIAL_8N1, TEENSY_RX_PIN, TEENSY_TX_PIN);
 
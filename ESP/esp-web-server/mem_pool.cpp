@@ -0,0 +1,169 @@
+#include "globals.h"
+#include "mem_pool.h"
+#include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+
+#define MEM_POOL_CAPS (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)
+
+#ifndef MEM_POOL_0_SIZE
+#define MEM_POOL_0_SIZE 64
+#endif
+#ifndef MEM_POOL_0_COUNT
+#define MEM_POOL_0_COUNT 32
+#endif
+#ifndef MEM_POOL_1_SIZE
+#define MEM_POOL_1_SIZE 320
+#endif
+#ifndef MEM_POOL_1_COUNT
+#define MEM_POOL_1_COUNT 8
+#endif
+#ifndef MEM_POOL_2_SIZE
+#define MEM_POOL_2_SIZE 2048
+#endif
+#ifndef MEM_POOL_2_COUNT
+#define MEM_POOL_2_COUNT 3
+#endif
+
+// A free block's first word links to the next free block of its class.
+// Sizes must stay multiples of 4 so every block is word-aligned.
+struct FreeBlock {
+    FreeBlock *next;
+};
+
+struct PoolClass {
+    uint16_t blockSize;
+    uint16_t blockCount;
+    uint8_t *base = nullptr; // nullptr until initMemPools (or if it failed)
+    FreeBlock *freeList = nullptr;
+    MemPoolStats stats = {};
+};
+
+static PoolClass classes[MEM_POOL_CLASSES] = {
+    {MEM_POOL_0_SIZE, MEM_POOL_0_COUNT},
+    {MEM_POOL_1_SIZE, MEM_POOL_1_COUNT},
+    {MEM_POOL_2_SIZE, MEM_POOL_2_COUNT},
+};
+
+static uint32_t oversizeCount = 0;
+
+// A spinlock rather than a mutex: the critical sections are a few
+// instructions, and the allocator is called from the loop task and both
+// httpd tasks at up to ~30Hz each.
+static portMUX_TYPE poolLock = portMUX_INITIALIZER_UNLOCKED;
+
+void initMemPools() {
+    for (PoolClass &pool : classes) {
+        size_t bytes = (size_t)pool.blockSize * pool.blockCount;
+        pool.base = (uint8_t *)heap_caps_malloc(bytes, MEM_POOL_CAPS);
+        if (pool.base == nullptr) {
+            DebugSerial.printf("Memory pool %u B x %u: allocation failed, using the heap\n",
+                               pool.blockSize, pool.blockCount);
+            continue;
+        }
+        for (int i = pool.blockCount - 1; i >= 0; i--) {
+            FreeBlock *block = (FreeBlock *)(pool.base + (size_t)i * pool.blockSize);
+            block->next = pool.freeList;
+            pool.freeList = block;
+        }
+        pool.stats.blockSize = pool.blockSize;
+        pool.stats.blocks = pool.blockCount;
+    }
+}
+
+static PoolClass *owner_of(const void *ptr) {
+    const uint8_t *p = (const uint8_t *)ptr;
+    for (PoolClass &pool : classes) {
+        if (pool.base != nullptr && p >= pool.base &&
+            p < pool.base + (size_t)pool.blockSize * pool.blockCount) {
+            return &pool;
+        }
+    }
+    return nullptr;
+}
+
+void *poolAlloc(size_t size) {
+    if (size == 0) size = 1;
+    bool fits = false;
+    for (PoolClass &pool : classes) {
+        if (size > pool.blockSize) continue;
+        fits = true;
+        FreeBlock *block = nullptr;
+        portENTER_CRITICAL(&poolLock);
+        if (pool.freeList != nullptr) {
+            block = pool.freeList;
+            pool.freeList = block->next;
+            pool.stats.allocs++;
+            pool.stats.inUse++;
+            if (pool.stats.inUse > pool.stats.peakInUse) pool.stats.peakInUse = pool.stats.inUse;
+        } else if (pool.base != nullptr) {
+            pool.stats.exhausted++;
+        }
+        portEXIT_CRITICAL(&poolLock);
+        if (block != nullptr) return block;
+        // Smallest class that fits is empty: go to the heap rather than
+        // burn a bigger class's scarce blocks on a small request
+        break;
+    }
+    if (!fits) {
+        portENTER_CRITICAL(&poolLock);
+        oversizeCount++;
+        portEXIT_CRITICAL(&poolLock);
+    }
+    return heap_caps_malloc(size, MEM_POOL_CAPS);
+}
+
+void poolFree(void *ptr) {
+    if (ptr == nullptr) return;
+    PoolClass *pool = owner_of(ptr);
+    if (pool == nullptr) {
+        heap_caps_free(ptr);
+        return;
+    }
+    FreeBlock *block = (FreeBlock *)ptr;
+    portENTER_CRITICAL(&poolLock);
+    block->next = pool->freeList;
+    pool->freeList = block;
+    pool->stats.inUse--;
+    portEXIT_CRITICAL(&poolLock);
+}
+
+void *poolRealloc(void *ptr, size_t size) {
+    if (ptr == nullptr) return poolAlloc(size);
+    PoolClass *pool = owner_of(ptr);
+    if (pool == nullptr) {
+        return heap_caps_realloc(ptr, size, MEM_POOL_CAPS);
+    }
+    // Shrinks (ArduinoJson's shrinkToFit) and growth within the block stay
+    // put; the block is already paid for.
+    if (size <= pool->blockSize) return ptr;
+    void *grown = poolAlloc(size);
+    if (grown == nullptr) return nullptr;
+    memcpy(grown, ptr, pool->blockSize);
+    poolFree(ptr);
+    return grown;
+}
+
+class PoolJsonAllocator : public ArduinoJson::Allocator {
+public:
+    void *allocate(size_t size) override { return poolAlloc(size); }
+    void deallocate(void *ptr) override { poolFree(ptr); }
+    void *reallocate(void *ptr, size_t size) override { return poolRealloc(ptr, size); }
+};
+
+ArduinoJson::Allocator *pooledJsonAllocator() {
+    static PoolJsonAllocator allocator;
+    return &allocator;
+}
+
+void getMemPoolStats(MemPoolStats out[MEM_POOL_CLASSES]) {
+    portENTER_CRITICAL(&poolLock);
+    for (int i = 0; i < MEM_POOL_CLASSES; i++) {
+        out[i] = classes[i].stats;
+        out[i].blockSize = classes[i].blockSize;
+    }
+    portEXIT_CRITICAL(&poolLock);
+}
+
+uint32_t memPoolOversize() {
+    return oversizeCount;
+}
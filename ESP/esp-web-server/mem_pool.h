@@ -0,0 +1,61 @@
+#ifndef MEM_POOL_H
+#define MEM_POOL_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// Fixed-block pools for the hot transient allocations.
+//
+// Every websocket broadcast used to make three or four short-lived heap
+// allocations of assorted sizes - the JsonDocument's slot pool and strings,
+// the String serializeJson grew by realloc, and the per-listener copy
+// queueBroadcast hands to httpd. With the analyzer open that is 10-30 of
+// them a second, interleaved with the long-lived allocations TLS and the
+// config make, and it is exactly the churn health.cpp blames for the largest
+// free block dipping under the 16KB a TLS handshake needs.
+//
+// So those allocations come from here instead: a few size classes of
+// fixed-size blocks, each class carved out of one contiguous internal-RAM
+// allocation in initMemPools() at boot, before the heap has had a chance to
+// fragment. A freed block goes back on its class's free list and never
+// splits or merges anything in the general heap. A request larger than the
+// biggest class, or one arriving while its class is exhausted, falls back to
+// the heap and is counted - the counters (GET /status "memPools", /metrics)
+// say whether the classes below are sized right.
+//
+// Class sizes are build flags (MEM_POOL_<n>_SIZE / _COUNT, n = 0..2):
+//   64 B    x 32   websocket meter frames (VU, GRM), JSON strings
+//   320 B   x 8    an RTA frame broadcast (~270 B), small event payloads
+//   2048 B  x 3    ArduinoJson's slot pool (its first allocation per
+//                  document), serialized event payloads
+// ~10.5KB in all - reserved for good, but it is the same memory these
+// allocations held transiently anyway, minus the fragmentation.
+
+void initMemPools(); // in setup(), before anything that broadcasts
+
+// malloc/free/realloc over the pools. Safe from any task (a short critical
+// section guards each class's free list); poolFree and poolRealloc accept
+// heap pointers from a fallback, so callers never need to know which they
+// got. poolRealloc never moves a block that already fits.
+void *poolAlloc(size_t size);
+void poolFree(void *ptr);
+void *poolRealloc(void *ptr, size_t size);
+
+// An ArduinoJson allocator over the pools, for the documents built on the
+// hot paths: JsonDocument doc(pooledJsonAllocator());
+ArduinoJson::Allocator *pooledJsonAllocator();
+
+#define MEM_POOL_CLASSES 3
+
+struct MemPoolStats {
+    uint16_t blockSize;
+    uint16_t blocks;
+    uint16_t inUse;
+    uint16_t peakInUse;   // since boot
+    uint32_t allocs;      // served from this class
+    uint32_t exhausted;   // wanted this class, found it empty (went to the heap)
+};
+void getMemPoolStats(MemPoolStats out[MEM_POOL_CLASSES]);
+uint32_t memPoolOversize(); // requests bigger than every class (went to the heap)
+
+#endif // MEM_POOL_H
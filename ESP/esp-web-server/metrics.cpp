@@ -0,0 +1,293 @@
+#include "globals.h"
+#include "metrics.h"
+#include "config.h"
+#include "config_store.h"
+#include "health.h"
+#include "mem_pool.h"
+#include "static_assets.h"
+#include "teensy_comm.h"
+#include "websocket.h"
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+// Matches the listeners' max_uri_handlers (web_server.cpp): no server can
+// register more routes than that anyway.
+#define METRICS_MAX_ROUTES 60
+
+// Latency bucket upper bounds. Most handlers answer in well under 5ms; the
+// tail that matters is preset switches, FIR edits and anything that waits
+// on the config lock behind a debounced save (tens to hundreds of ms).
+static const uint32_t BUCKET_US[] = {1000, 5000, 10000, 25000, 50000, 100000,
+                                     250000, 500000, 1000000, 2500000};
+static const char *const BUCKET_LE[] = {"0.001", "0.005", "0.01", "0.025", "0.05", "0.1",
+                                        "0.25", "0.5", "1", "2.5"};
+#define BUCKET_COUNT (sizeof(BUCKET_US) / sizeof(BUCKET_US[0]))
+
+struct RouteMetrics {
+    const char *path;  // the literal passed to registerRoutes
+    http_method method;
+    uint32_t buckets[BUCKET_COUNT + 1]; // per bucket, not cumulative; last is +Inf
+    uint32_t count;
+    uint32_t errors;   // handler returned something other than ESP_OK
+    uint64_t sumUs;
+};
+
+// The table is filled while registerRoutes runs in setup() and only counted
+// into afterwards; the mutex covers the counters, which both httpd tasks
+// update.
+static RouteMetrics routes[METRICS_MAX_ROUTES];
+static int routeCount = 0;
+static SemaphoreHandle_t metricsMutex = nullptr;
+
+static int find_or_add_route(const char *path, http_method method) {
+    if (metricsMutex == nullptr) {
+        metricsMutex = xSemaphoreCreateMutex();
+    }
+    for (int i = 0; i < routeCount; i++) {
+        if (routes[i].method == method && strcmp(routes[i].path, path) == 0) return i;
+    }
+    if (routeCount >= METRICS_MAX_ROUTES) {
+        DebugSerial.printf("Metrics: route table full, %s not measured\n", path);
+        return -1;
+    }
+    RouteMetrics &route = routes[routeCount];
+    memset(&route, 0, sizeof(route));
+    route.path = path;
+    route.method = method;
+    return routeCount++;
+}
+
+static void observe(int index, uint32_t elapsedUs, esp_err_t result) {
+    size_t bucket = 0;
+    while (bucket < BUCKET_COUNT && elapsedUs > BUCKET_US[bucket]) bucket++;
+    xSemaphoreTake(metricsMutex, portMAX_DELAY);
+    RouteMetrics &route = routes[index];
+    route.buckets[bucket]++;
+    route.count++;
+    route.sumUs += elapsedUs;
+    if (result != ESP_OK) route.errors++;
+    xSemaphoreGive(metricsMutex);
+}
+
+PsychicHttpRequestCallback metricsTimed(const char *path, http_method method,
+                                        PsychicHttpRequestCallback handler) {
+    int index = find_or_add_route(path, method);
+    if (index < 0) return handler;
+    return [index, handler](PsychicRequest *request) {
+        uint32_t started = micros();
+        esp_err_t result = handler(request);
+        observe(index, micros() - started, result);
+        return result;
+    };
+}
+
+PsychicJsonRequestCallback metricsTimed(const char *path, http_method method,
+                                        PsychicJsonRequestCallback handler) {
+    int index = find_or_add_route(path, method);
+    if (index < 0) return handler;
+    return [index, handler](PsychicRequest *request, JsonVariant &json) {
+        uint32_t started = micros();
+        esp_err_t result = handler(request, json);
+        observe(index, micros() - started, result);
+        return result;
+    };
+}
+
+static const char *method_name(http_method method) {
+    switch (method) {
+        case HTTP_GET:    return "GET";
+        case HTTP_PUT:    return "PUT";
+        case HTTP_POST:   return "POST";
+        case HTTP_DELETE: return "DELETE";
+        default:          return "OTHER";
+    }
+}
+
+static void family(Print &out, const char *name, const char *type, const char *help) {
+    out.printf("# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+}
+
+static void sample(Print &out, const char *name, uint32_t value) {
+    out.printf("%s %u\n", name, (unsigned)value);
+}
+
+static void write_route_metrics(Print &out) {
+    family(out, "vybes_http_request_duration_seconds", "histogram",
+           "API handler run time by route (body parsing and socket writes excluded).");
+    for (int i = 0; i < routeCount; i++) {
+        // One route's counters at a time, so the lock is never held across
+        // a socket write
+        xSemaphoreTake(metricsMutex, portMAX_DELAY);
+        RouteMetrics route = routes[i];
+        xSemaphoreGive(metricsMutex);
+
+        const char *method = method_name(route.method);
+        uint32_t cumulative = 0;
+        for (size_t b = 0; b < BUCKET_COUNT; b++) {
+            cumulative += route.buckets[b];
+            out.printf("vybes_http_request_duration_seconds_bucket{path=\"%s\",method=\"%s\",le=\"%s\"} %u\n",
+                       route.path, method, BUCKET_LE[b], (unsigned)cumulative);
+        }
+        out.printf("vybes_http_request_duration_seconds_bucket{path=\"%s\",method=\"%s\",le=\"+Inf\"} %u\n",
+                   route.path, method, (unsigned)route.count);
+        out.printf("vybes_http_request_duration_seconds_sum{path=\"%s\",method=\"%s\"} %.6f\n",
+                   route.path, method, route.sumUs / 1e6);
+        out.printf("vybes_http_request_duration_seconds_count{path=\"%s\",method=\"%s\"} %u\n",
+                   route.path, method, (unsigned)route.count);
+    }
+
+    family(out, "vybes_http_request_errors_total", "counter",
+           "Handler calls that returned an error to the server (the client saw a dropped or 500 response).");
+    for (int i = 0; i < routeCount; i++) {
+        xSemaphoreTake(metricsMutex, portMAX_DELAY);
+        uint32_t errors = routes[i].errors;
+        xSemaphoreGive(metricsMutex);
+        out.printf("vybes_http_request_errors_total{path=\"%s\",method=\"%s\"} %u\n",
+                   routes[i].path, method_name(routes[i].method), (unsigned)errors);
+    }
+}
+
+static void write_teensy_metrics(Print &out) {
+    TeensyLinkStats link;
+    getTeensyLinkStats(link);
+    family(out, "vybes_teensy_queue_depth", "gauge", "Commands waiting for the Teensy UART.");
+    sample(out, "vybes_teensy_queue_depth", link.queueDepth);
+    family(out, "vybes_teensy_queue_high_water", "gauge", "Deepest the Teensy command queue has been since boot.");
+    sample(out, "vybes_teensy_queue_high_water", link.queueHighWater);
+    family(out, "vybes_teensy_queue_capacity", "gauge", "Teensy command queue slots.");
+    sample(out, "vybes_teensy_queue_capacity", link.queueCapacity);
+    family(out, "vybes_teensy_commands_total", "counter",
+           "Teensy commands by outcome: queued, coalesced into a pending one, cancelled by an EQ reset, dropped (queue full), sent.");
+    out.printf("vybes_teensy_commands_total{outcome=\"queued\"} %u\n", (unsigned)link.queued);
+    out.printf("vybes_teensy_commands_total{outcome=\"coalesced\"} %u\n", (unsigned)link.coalesced);
+    out.printf("vybes_teensy_commands_total{outcome=\"cancelled\"} %u\n", (unsigned)link.cancelled);
+    out.printf("vybes_teensy_commands_total{outcome=\"dropped\"} %u\n", (unsigned)link.dropped);
+    out.printf("vybes_teensy_commands_total{outcome=\"sent\"} %u\n", (unsigned)link.sent);
+    family(out, "vybes_teensy_rx_lines_total", "counter", "Lines received from the Teensy and handled.");
+    sample(out, "vybes_teensy_rx_lines_total", link.rxLines);
+    family(out, "vybes_teensy_rx_overflows_total", "counter", "Teensy lines dropped for overflowing the RX buffer.");
+    sample(out, "vybes_teensy_rx_overflows_total", link.rxOverflows);
+}
+
+// The Teensy's own telemetry (STATS, relayed every ping). Only once a line
+// has arrived, so a scrape never reports a zero CPU load it didn't measure.
+static void write_dsp_metrics(Print &out) {
+    TeensyStats stats;
+    getTeensyStats(stats);
+    if (!stats.valid) return;
+    family(out, "vybes_dsp_stats_age_seconds", "gauge", "Age of the last Teensy STATS line.");
+    out.printf("vybes_dsp_stats_age_seconds %.3f\n", (millis() - stats.receivedAt) / 1000.0);
+    family(out, "vybes_dsp_cpu_percent", "gauge", "Teensy audio processing load.");
+    out.printf("vybes_dsp_cpu_percent %.1f\n", stats.cpu);
+    family(out, "vybes_dsp_cpu_max_percent", "gauge", "Peak Teensy audio load over the last ping interval.");
+    out.printf("vybes_dsp_cpu_max_percent %.1f\n", stats.cpuMax);
+    family(out, "vybes_dsp_audio_blocks_max", "gauge", "Peak audio pool blocks in use since the Teensy booted.");
+    sample(out, "vybes_dsp_audio_blocks_max", stats.audioBlocksMax);
+    family(out, "vybes_dsp_audio_blocks_total", "gauge", "Audio pool size.");
+    sample(out, "vybes_dsp_audio_blocks_total", stats.audioBlocksTotal);
+    if (!stats.usbReported) return;
+    family(out, "vybes_dsp_usb_step_ppm", "gauge", "USB input resampler step offset (host clock drift).");
+    out.printf("vybes_dsp_usb_step_ppm %.1f\n", stats.usbStepPpm);
+    family(out, "vybes_dsp_usb_target_latency_seconds", "gauge", "Ring fill the USB input holds, adapted to the host's packet timing.");
+    out.printf("vybes_dsp_usb_target_latency_seconds %.4f\n", stats.usbTargetMs / 1e3);
+    family(out, "vybes_dsp_usb_glitches_total", "counter", "USB input glitch counters since the Teensy booted.");
+    out.printf("vybes_dsp_usb_glitches_total{kind=\"drop\"} %u\n", (unsigned)stats.usbDrops);
+    out.printf("vybes_dsp_usb_glitches_total{kind=\"starve\"} %u\n", (unsigned)stats.usbStarves);
+    out.printf("vybes_dsp_usb_glitches_total{kind=\"resync\"} %u\n", (unsigned)stats.usbResyncs);
+    out.printf("vybes_dsp_usb_glitches_total{kind=\"allocfail\"} %u\n", (unsigned)stats.usbAllocFails);
+    family(out, "vybes_dsp_usb_max_gap_seconds", "gauge", "Worst host packet gap over the last ping interval.");
+    out.printf("vybes_dsp_usb_max_gap_seconds %.6f\n", stats.usbMaxGapUs / 1e6);
+}
+
+static void write_websocket_metrics(Print &out) {
+    WebSocketStats ws;
+    getWebSocketStats(ws);
+    family(out, "vybes_websocket_clients", "gauge", "Connected live-updates clients by listener.");
+    out.printf("vybes_websocket_clients{listener=\"http\"} %d\n", ws.clientsHttp);
+    out.printf("vybes_websocket_clients{listener=\"https\"} %d\n", ws.clientsHttps);
+    family(out, "vybes_websocket_messages_total", "counter", "Broadcasts queued by stream.");
+    for (int i = 0; i < WS_STREAM_COUNT; i++) {
+        out.printf("vybes_websocket_messages_total{stream=\"%s\"} %u\n", webSocketStreamName(i),
+                   (unsigned)ws.messages[i]);
+    }
+    family(out, "vybes_websocket_sent_bytes_total", "counter",
+           "Broadcast payload bytes by stream, times the clients each was queued for.");
+    for (int i = 0; i < WS_STREAM_COUNT; i++) {
+        out.printf("vybes_websocket_sent_bytes_total{stream=\"%s\"} %u\n", webSocketStreamName(i),
+                   (unsigned)ws.bytes[i]);
+    }
+    family(out, "vybes_websocket_dropped_total", "counter", "Broadcasts that could not be queued.");
+    sample(out, "vybes_websocket_dropped_total", ws.dropped);
+}
+
+static void write_system_metrics(Print &out) {
+    family(out, "vybes_info", "gauge", "Firmware build, UI build and config version.");
+    out.printf("vybes_info{firmware=\"%s %s\",ui=\"%s\",config_version=\"%d\"} 1\n",
+               __DATE__, __TIME__, staticAssetBuildId(), CONFIG_CURRENT_VERSION);
+    family(out, "vybes_uptime_seconds", "gauge", "Time since boot.");
+    out.printf("vybes_uptime_seconds %.3f\n", esp_timer_get_time() / 1e6);
+
+    // Internal RAM only, like /status health (see health.h). Reading the
+    // largest block folds it into the watermark, as every observation should.
+    family(out, "vybes_heap_free_bytes", "gauge", "Free internal heap.");
+    sample(out, "vybes_heap_free_bytes", healthFreeInternal());
+    family(out, "vybes_heap_min_free_bytes", "gauge", "Lowest free internal heap since boot.");
+    sample(out, "vybes_heap_min_free_bytes", healthMinFreeInternal());
+    family(out, "vybes_heap_largest_free_block_bytes", "gauge", "Largest contiguous free internal block.");
+    sample(out, "vybes_heap_largest_free_block_bytes", healthLargestFreeBlock());
+    family(out, "vybes_heap_min_largest_free_block_bytes", "gauge", "Lowest largest free block seen since boot.");
+    sample(out, "vybes_heap_min_largest_free_block_bytes", healthMinLargestFreeBlock());
+
+    MemPoolStats pools[MEM_POOL_CLASSES];
+    getMemPoolStats(pools);
+    family(out, "vybes_mempool_blocks", "gauge", "Blocks per transient allocation pool class.");
+    for (const MemPoolStats &pool : pools) {
+        out.printf("vybes_mempool_blocks{size=\"%u\"} %u\n", pool.blockSize, pool.blocks);
+    }
+    family(out, "vybes_mempool_in_use", "gauge", "Pool blocks currently allocated.");
+    for (const MemPoolStats &pool : pools) {
+        out.printf("vybes_mempool_in_use{size=\"%u\"} %u\n", pool.blockSize, pool.inUse);
+    }
+    family(out, "vybes_mempool_peak_in_use", "gauge", "Most pool blocks allocated at once since boot.");
+    for (const MemPoolStats &pool : pools) {
+        out.printf("vybes_mempool_peak_in_use{size=\"%u\"} %u\n", pool.blockSize, pool.peakInUse);
+    }
+    family(out, "vybes_mempool_allocs_total", "counter", "Allocations served from each pool class.");
+    for (const MemPoolStats &pool : pools) {
+        out.printf("vybes_mempool_allocs_total{size=\"%u\"} %u\n", pool.blockSize, (unsigned)pool.allocs);
+    }
+    family(out, "vybes_mempool_heap_fallbacks_total", "counter",
+           "Pooled allocations that went to the heap: class exhausted, or bigger than every class.");
+    for (const MemPoolStats &pool : pools) {
+        out.printf("vybes_mempool_heap_fallbacks_total{size=\"%u\"} %u\n", pool.blockSize,
+                   (unsigned)pool.exhausted);
+    }
+    out.printf("vybes_mempool_heap_fallbacks_total{size=\"oversize\"} %u\n", (unsigned)memPoolOversize());
+
+    family(out, "vybes_config_saves_total", "counter", "Debounced config saves that wrote anything.");
+    sample(out, "vybes_config_saves_total", config_store_stats.saves);
+    family(out, "vybes_config_written_bytes_total", "counter", "Bytes written to flash by config saves.");
+    sample(out, "vybes_config_written_bytes_total", config_store_stats.totalBytesWritten);
+
+    StaticAssetStats assets = staticAssetStats();
+    family(out, "vybes_static_requests_total", "counter", "Web UI asset requests.");
+    sample(out, "vybes_static_requests_total", assets.requests);
+    family(out, "vybes_static_not_modified_total", "counter", "Web UI asset requests answered 304.");
+    sample(out, "vybes_static_not_modified_total", assets.notModified);
+    family(out, "vybes_static_sent_bytes_total", "counter", "Web UI asset body bytes sent.");
+    sample(out, "vybes_static_sent_bytes_total", assets.bytesSent);
+}
+
+// Streamed as a chunked response: the full exposition is ~30KB with every
+// route listed, which must not become one String on this heap.
+esp_err_t handleGetMetrics(PsychicRequest *request) {
+    PsychicStreamResponse response(request, "text/plain; version=0.0.4; charset=utf-8");
+    response.beginSend();
+    write_system_metrics(response);
+    write_teensy_metrics(response);
+    write_dsp_metrics(response);
+    write_websocket_metrics(response);
+    write_route_metrics(response);
+    return response.endSend();
+}
@@ -0,0 +1,32 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <PsychicHttp.h>
+
+// GET /metrics: the device's counters in the Prometheus text exposition
+// format (version 0.0.4), for a local collector to scrape.
+//
+// /status is the UI's view - user state plus a few health numbers - and is
+// shaped for the page, not for comparing firmware builds. /metrics carries
+// what /status never recorded: how long each API handler takes (a latency
+// histogram per route), how deep the Teensy command queue gets and how often
+// it coalesces or drops, RX lines lost to overflow, websocket clients and
+// bytes per stream, and the heap watermarks from health.cpp. Every series is
+// a plain counter or gauge read on demand; nothing here allocates per
+// request except the scrape itself.
+//
+// Routes are registered once per listener, but both listeners share one
+// series per (path, method) - a collector wants "PUT /preset/batch", not
+// which socket it arrived on.
+
+// Wrap a route handler so each call is counted and timed. Registers the
+// (path, method) pair on first use; past METRICS_MAX_ROUTES the handler is
+// returned unwrapped.
+PsychicHttpRequestCallback metricsTimed(const char *path, http_method method,
+                                        PsychicHttpRequestCallback handler);
+PsychicJsonRequestCallback metricsTimed(const char *path, http_method method,
+                                        PsychicJsonRequestCallback handler);
+
+esp_err_t handleGetMetrics(PsychicRequest *request);
+
+#endif // METRICS_H
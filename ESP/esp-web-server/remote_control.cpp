@@ -192,7 +192,7 @@ static int findAdjacentPreset(int from, int step) {
     int index = from;
     for (int i = 0; i < MAX_PRESETS; i++) {
         index = (index + step + MAX_PRESETS) % MAX_PRESETS;
-        if (strlen(current_config.presets[index].name) > 0) {
+        if (strlen(current_config.presetNames[index]) > 0) {
             return index;
         }
     }
@@ -209,7 +209,7 @@ void RemoteControl::next_preset() {
         return; // no presets in use
     }
     _selected_preset_index = index;
-    writeToScreen(current_config.presets[_selected_preset_index].name);
+    writeToScreen(current_config.presetNames[_selected_preset_index]);
     _preset_selection_time = millis();
 }
 
@@ -223,7 +223,7 @@ void RemoteControl::previous_preset() {
         return; // no presets in use
     }
     _selected_preset_index = index;
-    writeToScreen(current_config.presets[_selected_preset_index].name);
+    writeToScreen(current_config.presetNames[_selected_preset_index]);
     _preset_selection_time = millis();
 }
 
@@ -235,14 +235,29 @@ void RemoteControl::apply_preset() {
         return;
     }
     if (_selected_preset_index != current_config.active_preset_index) {
-        current_config.active_preset_index = _selected_preset_index;
+        // The same lock as the web handlers' switch, so this can't race
+        // their edits of the config or the preset cache
+        bool switched;
+        {
+            ConfigLock lock;
+            switched = set_active_preset(_selected_preset_index);
+            if (switched) {
+                scheduleConfigWrite();
+            }
+        }
+        if (!switched) {
+            // Couldn't page it in - snap the selection back
+            writeToScreen("Preset unavailable", 2000);
+            _selected_preset_index = current_config.active_preset_index;
+            _preset_selection_time = 0;
+            return;
+        }
         updateTeensyWithActivePresetParameters();
-        scheduleConfigWrite();
 
         // Prepare data for WebSocket broadcast
         JsonDocument doc;
         doc["messageType"] = "activePresetChanged";
-        doc["activePresetName"] = current_config.presets[current_config.active_preset_index].name;
+        doc["activePresetName"] = current_config.presetNames[current_config.active_preset_index];
         doc["activePresetIndex"] = current_config.active_preset_index;
 
         char ws_response_buffer[192];
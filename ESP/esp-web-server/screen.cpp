@@ -103,7 +103,7 @@ static void updateRecordingMessage() {
         // normal backlight timeout run its course
         wasRecording = false;
         lastShownSeconds = UINT32_MAX;
-        writeToScreen(current_config.presets[current_config.active_preset_index].name);
+        writeToScreen(current_config.presetNames[current_config.active_preset_index]);
     }
 }
 
@@ -0,0 +1,88 @@
+#ifndef SNAPSHOT_CELL_H
+#define SNAPSHOT_CELL_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+
+// A published, immutable, reference-counted copy of some shared state.
+//
+// Writers keep mutating the live state under whatever lock guards it and
+// then call invalidate() - one atomic increment, no lock. Readers call
+// get(fill): while nothing has changed they just take another reference to
+// the published copy; the first reader after a change runs fill() to build
+// a fresh one and publishes it. fill is where the live state's own lock is
+// taken, and it is held only for the copy - never across JSON serialization
+// or a socket send, which is what readers used to hold it for.
+//
+// A reader keeps its copy alive for as long as it holds the pointer, so a
+// newer version being published mid-request changes nothing for it.
+//
+// Generations: the generation is read BEFORE fill copies the state, so a
+// published copy can only ever be tagged older than what it holds, never
+// newer. A write racing the copy therefore costs one extra rebuild, never
+// a stale read. Two readers rebuilding at once is harmless: the newer tag
+// wins the publish.
+//
+// Header-only and std-only (std::mutex is pthreads on ESP-IDF) so the host
+// test suite can exercise and benchmark it (Teensy/test/test_config_snapshot).
+template <typename T>
+class SnapshotCell {
+public:
+    using Ptr = std::shared_ptr<const T>;
+
+    // Call after every mutation of the state the snapshot copies.
+    void invalidate() { generation_.fetch_add(1, std::memory_order_acq_rel); }
+
+    uint32_t generation() const { return generation_.load(std::memory_order_acquire); }
+
+    // The current snapshot, rebuilt with fill(T&) if a write invalidated it.
+    // Returns the previous (stale) copy if the rebuild can't allocate, and
+    // nullptr only if no copy was ever built.
+    template <typename Fill>
+    Ptr get(Fill&& fill) {
+        const uint32_t gen = generation();
+        {
+            std::lock_guard<std::mutex> guard(publishMutex_);
+            if (published_ && publishedGen_ == gen) {
+                return published_;
+            }
+        }
+
+        T* raw = new (std::nothrow) T();
+        if (raw == nullptr) {
+            std::lock_guard<std::mutex> guard(publishMutex_);
+            return published_;
+        }
+        std::shared_ptr<T> fresh(raw);
+        fill(*fresh);
+        rebuilds_.fetch_add(1, std::memory_order_relaxed);
+
+        Ptr result = fresh;
+        Ptr retired; // released outside the publish lock
+        {
+            std::lock_guard<std::mutex> guard(publishMutex_);
+            if (!published_ || gen >= publishedGen_) {
+                retired = published_;
+                published_ = result;
+                publishedGen_ = gen;
+            }
+        }
+        return result;
+    }
+
+    // How many times fill() has run - a read-mostly workload should see
+    // roughly one per write, not one per read.
+    uint32_t rebuilds() const { return rebuilds_.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint32_t> generation_{1};
+    std::atomic<uint32_t> rebuilds_{0};
+    std::mutex publishMutex_; // guards the two fields below; held for a pointer copy
+    Ptr published_;
+    uint32_t publishedGen_ = 0;
+};
+
+#endif // SNAPSHOT_CELL_H
@@ -0,0 +1,281 @@
+#include "globals.h"
+#include "static_assets.h"
+#include <LittleFS.h>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#define STATIC_ROOT "/dist"
+#define STATIC_BUILD_ID_PATH STATIC_ROOT "/build-id.txt"
+
+// Small, hot, and not worth a LittleFS open: favicon, manifest, build id.
+// index.html is deliberately too big for it (the stylesheet is inlined) -
+// it's the file the ETag already saves most on.
+#ifndef STATIC_RAM_CACHE_BYTES
+#define STATIC_RAM_CACHE_BYTES 4096
+#endif
+#define STATIC_RAM_CACHE_FILE_MAX 2048
+
+enum StaticEncoding : uint8_t { ENC_IDENTITY, ENC_GZIP, ENC_BROTLI, ENC_COUNT };
+static const char *const ENCODING_NAME[ENC_COUNT] = {nullptr, "gzip", "br"};
+static const char *const ENCODING_SUFFIX[ENC_COUNT] = {"", ".gz", ".br"};
+static const char *const ETAG_SUFFIX[ENC_COUNT] = {"", "-gz", "-br"};
+
+struct StaticAsset {
+    String path; // URL path, e.g. "/assets/vendor-3f2a91c4.js"
+    bool present[ENC_COUNT] = {};
+    uint32_t size[ENC_COUNT] = {};
+    std::unique_ptr<uint8_t[]> cached[ENC_COUNT];
+};
+
+// Built once in initStaticAssets, before either listener starts, and never
+// modified afterwards - both server tasks read it without a lock.
+static std::vector<StaticAsset> assets;
+static char buildId[33] = "";
+static size_t cachedBytes = 0;
+
+static std::atomic<uint32_t> statRequests{0};
+static std::atomic<uint32_t> statNotModified{0};
+static std::atomic<uint32_t> statRamHits{0};
+static std::atomic<uint32_t> statBytesSent{0};
+
+static StaticAsset *find_asset(const String &path) {
+    for (StaticAsset &asset : assets) {
+        if (asset.path == path) return &asset;
+    }
+    return nullptr;
+}
+
+// One /dist file: strip the root and any encoding suffix, and record it as
+// that variant of its URL path.
+static void add_file(const String &fsPath, uint32_t size) {
+    String path = fsPath.substring(strlen(STATIC_ROOT));
+    StaticEncoding encoding = ENC_IDENTITY;
+    for (int e = ENC_GZIP; e < ENC_COUNT; e++) {
+        if (path.endsWith(ENCODING_SUFFIX[e])) {
+            encoding = (StaticEncoding)e;
+            path.remove(path.length() - strlen(ENCODING_SUFFIX[e]));
+            break;
+        }
+    }
+    StaticAsset *asset = find_asset(path);
+    if (asset == nullptr) {
+        assets.emplace_back();
+        asset = &assets.back();
+        asset->path = path;
+    }
+    asset->present[encoding] = true;
+    asset->size[encoding] = size;
+}
+
+static void scan_dir(const char *dirPath) {
+    File dir = LittleFS.open(dirPath);
+    if (!dir || !dir.isDirectory()) return;
+    File entry = dir.openNextFile();
+    while (entry) {
+        String entryPath = entry.path();
+        if (entry.isDirectory()) {
+            entry.close();
+            scan_dir(entryPath.c_str());
+        } else {
+            add_file(entryPath, entry.size());
+            entry.close();
+        }
+        entry = dir.openNextFile();
+    }
+    dir.close();
+}
+
+static void read_build_id() {
+    File file = LittleFS.open(STATIC_BUILD_ID_PATH, "r");
+    if (!file) return;
+    size_t len = file.readBytes(buildId, sizeof(buildId) - 1);
+    file.close();
+    buildId[len] = '\0';
+    // Only [0-9a-f] goes inside the quoted ETag; anything else ends it
+    for (size_t i = 0; i < len; i++) {
+        if (!isxdigit((unsigned char)buildId[i])) {
+            buildId[i] = '\0';
+            break;
+        }
+    }
+}
+
+static void fill_ram_cache() {
+    size_t budget = STATIC_RAM_CACHE_BYTES;
+    for (StaticAsset &asset : assets) {
+        for (int e = 0; e < ENC_COUNT; e++) {
+            uint32_t size = asset.size[e];
+            if (!asset.present[e] || size == 0 || size > STATIC_RAM_CACHE_FILE_MAX || size > budget) continue;
+            std::unique_ptr<uint8_t[]> buffer(new (std::nothrow) uint8_t[size]);
+            if (!buffer) return;
+            File file = LittleFS.open(STATIC_ROOT + asset.path + ENCODING_SUFFIX[e], "r");
+            if (!file) continue;
+            size_t got = file.read(buffer.get(), size);
+            file.close();
+            if (got != size) continue;
+            asset.cached[e] = std::move(buffer);
+            budget -= size;
+            cachedBytes += size;
+        }
+    }
+}
+
+void initStaticAssets() {
+    scan_dir(STATIC_ROOT);
+    read_build_id();
+    fill_ram_cache();
+    DebugSerial.printf("Static assets: %u file(s), build %s, %u bytes cached in RAM\n",
+                       (unsigned)assets.size(), buildId[0] ? buildId : "(no build-id)",
+                       (unsigned)cachedBytes);
+}
+
+// True if the Accept-Encoding list names the coding (or *) without q=0.
+static bool accepts_encoding(const String &header, const char *coding) {
+    int from = 0;
+    int length = header.length();
+    while (from < length) {
+        int comma = header.indexOf(',', from);
+        if (comma < 0) comma = length;
+        String item = header.substring(from, comma);
+        from = comma + 1;
+        int semicolon = item.indexOf(';');
+        String name = semicolon < 0 ? item : item.substring(0, semicolon);
+        name.trim();
+        if (!name.equalsIgnoreCase(coding) && name != "*") continue;
+        if (semicolon >= 0) {
+            int q = item.indexOf("q=", semicolon);
+            if (q >= 0 && item.substring(q + 2).toFloat() <= 0.0f) return false;
+        }
+        return true;
+    }
+    return false;
+}
+
+static StaticEncoding choose_encoding(const StaticAsset &asset, const String &acceptEncoding) {
+    if (asset.present[ENC_BROTLI] && accepts_encoding(acceptEncoding, "br")) return ENC_BROTLI;
+    if (asset.present[ENC_GZIP] && accepts_encoding(acceptEncoding, "gzip")) return ENC_GZIP;
+    if (asset.present[ENC_IDENTITY]) return ENC_IDENTITY;
+    // Only compressed copies exist (the build deletes originals). Every
+    // browser takes gzip whether it says so or not - this is what the stock
+    // static handler always sent.
+    return asset.present[ENC_GZIP] ? ENC_GZIP : ENC_BROTLI;
+}
+
+static const char *content_type(const String &path) {
+    if (path.endsWith(".html")) return "text/html";
+    if (path.endsWith(".js") || path.endsWith(".mjs")) return "application/javascript";
+    if (path.endsWith(".css")) return "text/css";
+    if (path.endsWith(".svg")) return "image/svg+xml";
+    if (path.endsWith(".png")) return "image/png";
+    if (path.endsWith(".ico")) return "image/x-icon";
+    if (path.endsWith(".webmanifest")) return "application/manifest+json";
+    if (path.endsWith(".json")) return "application/json";
+    if (path.endsWith(".woff2")) return "font/woff2";
+    if (path.endsWith(".txt")) return "text/plain";
+    return "application/octet-stream";
+}
+
+// URL path the request maps to: query stripped, directories to index.html.
+static String request_path(PsychicRequest *request) {
+    String path = request->url();
+    int query = path.indexOf('?');
+    if (query >= 0) path.remove(query);
+    if (path.endsWith("/")) path += "index.html";
+    return path;
+}
+
+// The ETag header value has to outlive the response object, as do the other
+// strings handed to PsychicResponse.
+static void add_cache_headers(PsychicResponse &response, const StaticAsset &asset,
+                              StaticEncoding encoding, const char *etag) {
+    // Hashed filenames change with their content, so they never need a
+    // revalidation; everything else (index.html above all) must ask every
+    // time, which the ETag makes a header-only exchange.
+    if (asset.path.startsWith("/assets/")) {
+        response.addHeader("Cache-Control", "public, max-age=31536000, immutable");
+    } else {
+        response.addHeader("Cache-Control", "no-cache");
+    }
+    if (etag[0]) response.addHeader("ETag", etag);
+    int variants = 0;
+    for (int e = 0; e < ENC_COUNT; e++) variants += asset.present[e] ? 1 : 0;
+    if (variants > 1) response.addHeader("Vary", "Accept-Encoding");
+    if (ENCODING_NAME[encoding]) response.addHeader("Content-Encoding", ENCODING_NAME[encoding]);
+}
+
+class StaticAssetHandler : public PsychicHandler {
+public:
+    bool canHandle(PsychicRequest *request) override {
+        return request->method() == HTTP_GET && find_asset(request_path(request)) != nullptr;
+    }
+
+    esp_err_t handleRequest(PsychicRequest *request) override {
+        const StaticAsset *asset = find_asset(request_path(request));
+        if (asset == nullptr) return request->reply(404);
+        statRequests++;
+
+        StaticEncoding encoding = choose_encoding(*asset, request->header("Accept-Encoding"));
+        char etag[sizeof(buildId) + 8] = "";
+        if (buildId[0]) {
+            snprintf(etag, sizeof(etag), "\"%s%s\"", buildId, ETAG_SUFFIX[encoding]);
+        }
+
+        if (etag[0] && request->hasHeader("If-None-Match")) {
+            String match = request->header("If-None-Match");
+            if (match == "*" || match.indexOf(etag) >= 0) {
+                statNotModified++;
+                PsychicResponse response(request);
+                response.setCode(304);
+                add_cache_headers(response, *asset, encoding, etag);
+                return response.send();
+            }
+        }
+
+        const char *type = content_type(asset->path);
+        uint32_t size = asset->size[encoding];
+        statBytesSent += size;
+        if (asset->cached[encoding]) {
+            statRamHits++;
+            PsychicResponse response(request);
+            response.setCode(200);
+            response.setContentType(type);
+            add_cache_headers(response, *asset, encoding, etag);
+            response.setContent(asset->cached[encoding].get(), size);
+            return response.send();
+        }
+
+        // Opened by its exact variant name, so the response doesn't add a
+        // Content-Encoding of its own - add_cache_headers sets the right one.
+        String fsPath = STATIC_ROOT + asset->path + ENCODING_SUFFIX[encoding];
+        String typeString(type);
+        PsychicFileResponse response(request, LittleFS, fsPath, typeString);
+        add_cache_headers(response, *asset, encoding, etag);
+        return response.send();
+    }
+};
+
+PsychicHandler *createStaticAssetHandler() {
+    return new StaticAssetHandler();
+}
+
+StaticAssetStats staticAssetStats() {
+    StaticAssetStats stats;
+    stats.requests = statRequests.load();
+    stats.notModified = statNotModified.load();
+    stats.ramHits = statRamHits.load();
+    stats.bytesSent = statBytesSent.load();
+    return stats;
+}
+
+int staticAssetCount() {
+    return (int)assets.size();
+}
+
+size_t staticAssetCachedBytes() {
+    return cachedBytes;
+}
+
+const char *staticAssetBuildId() {
+    return buildId;
+}
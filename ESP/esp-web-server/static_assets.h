@@ -0,0 +1,44 @@
+#ifndef STATIC_ASSETS_H
+#define STATIC_ASSETS_H
+
+#include <Arduino.h>
+#include <PsychicHttp.h>
+
+// The web UI, served from LittleFS /dist.
+//
+// The WebUI build stores every text asset precompressed - foo.js.gz, and
+// foo.js.br when built with VYBES_BROTLI=1 - and deletes the original, so
+// the flash holds (and the radio sends) only compressed bytes. The handler
+// picks the variant the request's Accept-Encoding allows, best first.
+//
+// Revalidation: the build also writes /dist/build-id.txt, a hash of the whole
+// bundle. Every response carries an ETag derived from it (one per encoding),
+// and a matching If-None-Match gets a bodiless 304 - so a reload of
+// index.html costs a round trip instead of the page. Hashed /assets files
+// are cached by the browser forever and never revalidate at all.
+//
+// The /dist listing is read once at boot (uploadfs needs a reboot anyway),
+// so a request never probes LittleFS for variants that don't exist, and
+// files up to STATIC_RAM_CACHE_FILE_MAX are kept in RAM within a total
+// budget of STATIC_RAM_CACHE_BYTES (build flag; 0 disables it).
+
+void initStaticAssets(); // after LittleFS is mounted, before the servers start
+
+// A handler per listener, registered with addHandler() after every API route
+// so it only sees what nothing else matched.
+PsychicHandler *createStaticAssetHandler();
+
+// Telemetry for GET /status ("static"): bytesSent counts response bodies
+// only, so a cold load's cost is one before/after read of it.
+struct StaticAssetStats {
+    uint32_t requests;
+    uint32_t notModified;
+    uint32_t ramHits;
+    uint32_t bytesSent;
+};
+StaticAssetStats staticAssetStats();
+int staticAssetCount();
+size_t staticAssetCachedBytes();
+const char *staticAssetBuildId(); // "" when the dist predates build-id.txt
+
+#endif // STATIC_ASSETS_H
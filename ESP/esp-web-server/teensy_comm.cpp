@@ -5,12 +5,15 @@
 #include <freertos/FreeRTOS.h>
 #include <freertos/semphr.h>
 
-// Outgoing queue. A full V1 preset sync is ~190 commands worst case
-// (8 outputs x up to 19 commands each, plus input EQ, dynamics and globals).
-#define QUEUE_SIZE 220
+// Outgoing queue. A full V1 preset sync is ~225 commands worst case
+// (8 outputs x up to 19 commands each, plus all three input EQ SPL sets,
+// dynamics and globals). The indices are uint8_t: keep it under 256.
+#define QUEUE_SIZE 250
 // Incoming line assembly. Sized for the longest line the Teensy sends: a
-// 121-band RTA frame ("RTA " + 242 hex chars = 246 chars).
-#define RX_LINE_MAX 300
+// worst-case STATS line (STATS_LINE_MAX, teensy_protocol.h). The longest
+// spectrum frame, a 121-band per-output one ("RTAB <ch> " + 242 hex chars),
+// is 249 chars.
+#define RX_LINE_MAX STATS_LINE_MAX
 // Cached SD file list (newline separated "name size" lines; WAV and TXT
 // lines from newer Teensy firmware carry the exact tap count:
 // "name size taps")
@@ -32,6 +35,10 @@ static uint8_t queueCount = 0;
 // must run before the web servers start.
 static SemaphoreHandle_t queueMutex = nullptr;
 
+// Link counters for GET /metrics. The queue ones are updated under
+// queueMutex; the RX ones only by the loop task, and read unlocked.
+static TeensyLinkStats linkStats;
+
 // RX state
 static char rxLine[RX_LINE_MAX];
 static size_t rxLen = 0;
@@ -69,6 +76,18 @@ struct FirLoadError {
 };
 static FirLoadError firLoadErrors[NUM_OUTPUTS] = {};
 
+// Per-output "FIRC ch tailTaps truncDb" from the last compiled load; the
+// accuracy a compiled output traded for its CPU. Guarded by firCacheMutex.
+struct FirCompileReport {
+    bool valid;
+    uint16_t tailTaps;
+    float truncationDb;
+};
+static FirCompileReport firCompileReports[NUM_OUTPUTS] = {};
+
+// Latest "STATS" line from the Teensy. Guarded by firCacheMutex.
+static TeensyStats teensyStats;
+
 // --- Message building ---
 
 // The actual formatting lives in teensy_protocol.h (shared with the Teensy
@@ -109,13 +128,17 @@ static void firstTokens(const char* msg, char* t1, size_t s1, char* t2, size_t s
 
 // How many leading tokens (including the command itself) identify the
 // parameter a message sets. Channel-indexed commands are keyed by their
-// channel/band argument, setOutputEq by channel AND band.
+// channel/band argument, setOutputEq by channel AND band and setInputEq by
+// SPL set AND band.
 static int coalesceKeyTokens(const char* command) {
-    if (strcmp(command, CMD_SET_OUTPUT_EQ) == 0) return 3;
+    if (strcmp(command, CMD_SET_OUTPUT_EQ) == 0 ||
+        strcmp(command, CMD_SET_INPUT_EQ) == 0) {
+        return 3;
+    }
     if (strncmp(command, "setOutput", 9) == 0 ||
         strcmp(command, CMD_RESET_OUTPUT_EQ) == 0 ||
+        strcmp(command, CMD_RESET_INPUT_EQ) == 0 ||
         strcmp(command, CMD_SET_FIR) == 0 ||
-        strcmp(command, CMD_SET_INPUT_EQ) == 0 ||
         strcmp(command, CMD_SET_COMP_BAND) == 0 ||
         strcmp(command, CMD_SET_COMP_BAND_BYPASS) == 0) {
         return 2;
@@ -138,13 +161,20 @@ static bool isOrderedBarrier(const char* command) {
            strcmp(command, CMD_LOAD_FIR_FILES) == 0;
 }
 
+// The message past its "@<sample> " stamp, if it has one
+static const char* skipStamp(const char* msg) {
+    if (msg[0] != '@') return msg;
+    const char* space = strchr(msg, ' ');
+    return space != nullptr ? space + 1 : msg;
+}
+
 // Two messages coalesce when they set the same parameter: same command and
-// same identifying arguments. The newer message replaces the older one in
-// place, preserving queue order.
+// same identifying arguments, stamped or not. The newer message replaces
+// the older one in place, preserving queue order.
 static bool coalesces(const char* a, const char* b) {
     char a1[24], a2[24], a3[24], b1[24], b2[24], b3[24];
-    firstTokens(a, a1, sizeof(a1), a2, sizeof(a2), a3, sizeof(a3));
-    firstTokens(b, b1, sizeof(b1), b2, sizeof(b2), b3, sizeof(b3));
+    firstTokens(skipStamp(a), a1, sizeof(a1), a2, sizeof(a2), a3, sizeof(a3));
+    firstTokens(skipStamp(b), b1, sizeof(b1), b2, sizeof(b2), b3, sizeof(b3));
     if (strcmp(a1, b1) != 0) return false;
     if (isOrderedBarrier(a1)) return false;
     int keyTokens = coalesceKeyTokens(a1);
@@ -155,24 +185,24 @@ static bool coalesces(const char* a, const char* b) {
 
 // An EQ reset cancels any queued point-set it supersedes, so a stale pending
 // point can't re-enable a band the reset just disabled:
-//   "resetInputEq N"      cancels "setInputEq band…"      with band >= N
+//   "resetInputEq SET N"  cancels "setInputEq SET band…"  with band >= N
 //   "resetOutputEq CH N"  cancels "setOutputEq CH band…"  with band >= N
 static void cancelSupersededEqCommands(const char* resetMsg) {
     char t1[24], t2[24], t3[24];
     firstTokens(resetMsg, t1, sizeof(t1), t2, sizeof(t2), t3, sizeof(t3));
     bool perOutput = strcmp(t1, CMD_RESET_OUTPUT_EQ) == 0;
     const char* setCommand = perOutput ? CMD_SET_OUTPUT_EQ : CMD_SET_INPUT_EQ;
-    int fromIndex = atoi(perOutput ? t3 : t2);
+    int fromIndex = atoi(t3);
     for (uint8_t i = 0; i < queueCount; i++) {
         QueuedCommand& e = cmdQueue[(queueHead + i) % QUEUE_SIZE];
         if (e.msg[0] == '\0') continue;
         char e1[24], e2[24], e3[24];
         firstTokens(e.msg, e1, sizeof(e1), e2, sizeof(e2), e3, sizeof(e3));
         if (strcmp(e1, setCommand) != 0) continue;
-        if (perOutput) {
-            if (strcmp(e2, t2) == 0 && atoi(e3) >= fromIndex) e.msg[0] = '\0';
-        } else if (atoi(e2) >= fromIndex) {
+        bool superseded = strcmp(e2, t2) == 0 && atoi(e3) >= fromIndex;
+        if (superseded) {
             e.msg[0] = '\0'; // cancel; drained slots are skipped
+            linkStats.cancelled++;
         }
     }
 }
@@ -183,17 +213,21 @@ static bool enqueueMessage(const char* msg) {
         QueuedCommand& e = cmdQueue[(queueHead + i) % QUEUE_SIZE];
         if (e.msg[0] != '\0' && coalesces(e.msg, msg)) {
             strlcpy(e.msg, msg, sizeof(e.msg));
+            linkStats.coalesced++;
             return true;
         }
     }
     if (queueCount >= QUEUE_SIZE) {
         DebugSerial.print("Teensy queue full - dropping: ");
         DebugSerial.print(msg);
+        linkStats.dropped++;
         return false;
     }
     QueuedCommand& e = cmdQueue[(queueHead + queueCount) % QUEUE_SIZE];
     strlcpy(e.msg, msg, sizeof(e.msg));
     queueCount++;
+    linkStats.queued++;
+    if (queueCount > linkStats.queueHighWater) linkStats.queueHighWater = queueCount;
     return true;
 }
 
@@ -225,6 +259,33 @@ bool sendToTeensy(const char* command, const String& param1,
     );
 }
 
+bool sendStampedToTeensy(uint32_t dueSample, const char* command, const char* param1,
+                         const char* param2, const char* param3, const char* param4) {
+    char stamp[12];
+    snprintf(stamp, sizeof(stamp), "@%lu", (unsigned long)dueSample);
+    return sendToTeensy(stamp, command, param1, param2, param3, param4);
+}
+
+bool teensyClockAhead(uint32_t leadMs, uint32_t& sample) {
+    xSemaphoreTake(firCacheMutex, portMAX_DELAY);
+    const bool known = teensyStats.valid && teensyStats.clockReported;
+    const uint32_t clock = teensyStats.audioClock;
+    const uint32_t sinceMs = millis() - teensyStats.receivedAt;
+    xSemaphoreGive(firCacheMutex);
+    if (!known) return false;
+    // The clock wraps like the u32 it is; the stamp does too
+    sample = clock + (uint32_t)((uint64_t)(sinceMs + leadMs) * 44100 / 1000);
+    return true;
+}
+
+// A rebooted Teensy restarts its clock: stamps extrapolated from the old
+// one could hold a change back for seconds. Wait for the next clk=.
+static void forgetTeensyClock() {
+    xSemaphoreTake(firCacheMutex, portMAX_DELAY);
+    teensyStats.clockReported = false;
+    xSemaphoreGive(firCacheMutex);
+}
+
 void sendOnOffToTeensy(const char* command, bool on) {
     sendToTeensy(command, on ? "1" : "0", nullptr);
 }
@@ -363,6 +424,7 @@ static void resetRecorderStateAfterReboot() {
 void clearFirLoadErrors() {
     xSemaphoreTake(firCacheMutex, portMAX_DELAY);
     memset(firLoadErrors, 0, sizeof(firLoadErrors));
+    memset(firCompileReports, 0, sizeof(firCompileReports));
     xSemaphoreGive(firCacheMutex);
 }
 
@@ -379,11 +441,128 @@ bool getFirLoadError(int output, char* code, size_t codeSize,
     return present;
 }
 
+bool getFirCompileReport(int output, uint16_t& tailTaps, float& truncationDb) {
+    if (output < 0 || output >= NUM_OUTPUTS) return false;
+    xSemaphoreTake(firCacheMutex, portMAX_DELAY);
+    const FirCompileReport report = firCompileReports[output];
+    xSemaphoreGive(firCacheMutex);
+    if (!report.valid) return false;
+    tailTaps = report.tailTaps;
+    truncationDb = report.truncationDb;
+    return true;
+}
+
+void getTeensyStats(TeensyStats& out) {
+    xSemaphoreTake(firCacheMutex, portMAX_DELAY);
+    out = teensyStats;
+    xSemaphoreGive(firCacheMutex);
+}
+
+void teensyStatsToJson(const TeensyStats& stats, JsonObject out) {
+    out["available"] = stats.valid;
+    if (!stats.valid) return;
+    out["ageMs"] = (uint32_t)(millis() - stats.receivedAt);
+    out["cpu"] = stats.cpu;
+    out["cpuMax"] = stats.cpuMax;
+    JsonObject blocks = out.createNestedObject("audioBlocks");
+    blocks["used"] = stats.audioBlocks;
+    blocks["max"] = stats.audioBlocksMax;
+    blocks["total"] = stats.audioBlocksTotal;
+    JsonObject heap = out.createNestedObject("heap");
+    heap["unclaimed"] = stats.heapUnclaimed;
+    heap["reclaimable"] = stats.heapReclaimable;
+    if (stats.logReported) {
+        JsonObject log = out.createNestedObject("levelLog");
+        log["active"] = stats.logActive;
+        log["us"] = stats.logUs;
+        log["maxUs"] = stats.logMaxUs;
+        log["writtenBytes"] = stats.logWrittenBytes;
+    }
+    // Stamp planning: the clock has run ~44.1 samples/ms since receivedAt
+    if (stats.clockReported) out["audioClock"] = stats.audioClock;
+    if (stats.inputEqReported) out["inputEqMaxUs"] = stats.inputEqMaxUs;
+    if (!stats.usbReported) return;
+    JsonObject usb = out.createNestedObject("usb");
+    usb["streaming"] = stats.usbStreaming;
+    usb["bufferedMs"] = stats.usbBufferedMs;
+    usb["targetMs"] = stats.usbTargetMs;
+    usb["stepPpm"] = stats.usbStepPpm;
+    usb["drops"] = stats.usbDrops;
+    usb["starves"] = stats.usbStarves;
+    usb["stops"] = stats.usbStops;
+    usb["recoveries"] = stats.usbRecoveries;
+    usb["resyncs"] = stats.usbResyncs;
+    usb["allocFails"] = stats.usbAllocFails;
+    usb["falseStops"] = stats.usbFalseStops;
+    usb["maxGapUs"] = stats.usbMaxGapUs;
+}
+
+// "STATS key=value ..." (teensy_protocol.h). Unknown keys are skipped so
+// the Teensy can grow the line without an ESP update.
+static void handleStatsLine(const char* payload) {
+    TeensyStats parsed;
+    parsed.valid = true;
+    parsed.receivedAt = millis();
+    char buf[RX_LINE_MAX];
+    strlcpy(buf, payload, sizeof(buf));
+    char* save = nullptr;
+    for (char* token = strtok_r(buf, " ", &save); token; token = strtok_r(nullptr, " ", &save)) {
+        char* eq = strchr(token, '=');
+        if (eq == nullptr) continue;
+        *eq = '\0';
+        const char* key = token;
+        const char* value = eq + 1;
+        unsigned long count = strtoul(value, nullptr, 10);
+        if (strcmp(key, "cpu") == 0) parsed.cpu = atof(value);
+        else if (strcmp(key, "cpumax") == 0) parsed.cpuMax = atof(value);
+        else if (strcmp(key, "blk") == 0) parsed.audioBlocks = atoi(value);
+        else if (strcmp(key, "blkmax") == 0) parsed.audioBlocksMax = atoi(value);
+        else if (strcmp(key, "blktot") == 0) parsed.audioBlocksTotal = atoi(value);
+        else if (strcmp(key, "heap") == 0) parsed.heapUnclaimed = count;
+        else if (strcmp(key, "reclaim") == 0) parsed.heapReclaimable = count;
+        else if (strcmp(key, "usb") == 0) {
+            parsed.usbReported = true;
+            parsed.usbStreaming = count != 0;
+        }
+        else if (strcmp(key, "buf") == 0) parsed.usbBufferedMs = atof(value);
+        else if (strcmp(key, "tgt") == 0) parsed.usbTargetMs = atof(value);
+        else if (strcmp(key, "ppm") == 0) parsed.usbStepPpm = atof(value);
+        else if (strcmp(key, "drops") == 0) parsed.usbDrops = count;
+        else if (strcmp(key, "starves") == 0) parsed.usbStarves = count;
+        else if (strcmp(key, "stops") == 0) parsed.usbStops = count;
+        else if (strcmp(key, "recov") == 0) parsed.usbRecoveries = count;
+        else if (strcmp(key, "resyncs") == 0) parsed.usbResyncs = count;
+        else if (strcmp(key, "allocf") == 0) parsed.usbAllocFails = count;
+        else if (strcmp(key, "fstops") == 0) parsed.usbFalseStops = count;
+        else if (strcmp(key, "maxgap") == 0) parsed.usbMaxGapUs = count;
+        else if (strcmp(key, "log") == 0) {
+            parsed.logReported = true;
+            parsed.logActive = count != 0;
+        }
+        else if (strcmp(key, "logus") == 0) parsed.logUs = count;
+        else if (strcmp(key, "logmax") == 0) parsed.logMaxUs = count;
+        else if (strcmp(key, "logwr") == 0) parsed.logWrittenBytes = count;
+        else if (strcmp(key, "clk") == 0) {
+            parsed.clockReported = true;
+            parsed.audioClock = count;
+        }
+        else if (strcmp(key, "leq") == 0) {
+            parsed.inputEqReported = true;
+            parsed.inputEqMaxUs = count;
+        }
+    }
+    xSemaphoreTake(firCacheMutex, portMAX_DELAY);
+    teensyStats = parsed;
+    xSemaphoreGive(firCacheMutex);
+    broadcastTeensyStats(parsed);
+}
+
 // --- RX line handling ---
 
 // Handle one complete line from the Teensy. The Teensy sends:
 //   "EVENT boot"        on startup (triggers a full state re-sync)
 //   "PONG <uptimeMs>"   in reply to ping (reboot detection fallback)
+//   "STATS k=v ..."     runtime telemetry, right after each PONG
 //   "FILES" ... "EOT"   the SD file list, one "name size [taps]" line per file
 // Anything else is forwarded to the debug console.
 // Last uptime reported by the Teensy, for reboot detection. File-scope so
@@ -397,6 +576,11 @@ static void handleTeensyLine(const char* line) {
         broadcastRtaFrame(line + 4);
         return;
     }
+    // Per-output spectra: "RTAB <ch> <hex>", one channel per frame
+    if (strncmp(line, "RTAB ", 5) == 0 && line[5] >= '0' && line[5] <= '9' && line[6] == ' ') {
+        broadcastRtaBankFrame(line[5] - '0', line + 7);
+        return;
+    }
     if (strncmp(line, "GRM ", 4) == 0) {
         broadcastGrmFrame(line + 4);
         return;
@@ -415,6 +599,20 @@ static void handleTeensyLine(const char* line) {
         return;
     }
 
+    // IR measurement progress ("IR START ...", "IR PROGRESS 40",
+    // "IR DONE <file> ...") - same relay
+    if (strncmp(line, "IR ", 3) == 0) {
+        broadcastIrEvent(line + 3);
+        return;
+    }
+
+    // Level log state and range replies ("LOG STATE 1 0 3600",
+    // "LOG PT <seq> <hex>", "LOG END 300", ...) - same relay
+    if (strncmp(line, "LOG ", 4) == 0) {
+        broadcastLevelLogEvent(line + 4);
+        return;
+    }
+
     // "FIRERR <ch> <code> <file>": a channel's FIR filter did not load. Record
     // it and tell the UI immediately - silently running an uncorrected channel
     // is the worst possible failure mode for a room-correction box.
@@ -440,13 +638,28 @@ static void handleTeensyLine(const char* line) {
                 // A load only ever concerns the active preset, and the UI
                 // filters live messages by preset name.
                 broadcastFirLoadError(
-                    current_config.presets[current_config.active_preset_index].name,
+                    current_config.presetNames[current_config.active_preset_index],
                     (int)ch, code, file);
             }
         }
         return;
     }
 
+    // "FIRC <ch> <tailTaps> <truncDb>": a compiled output loaded, with its
+    // crossover and PEQ ringing out over tailTaps and truncDb cut off
+    if (strncmp(line, "FIRC ", 5) == 0) {
+        int ch = -1;
+        unsigned tail = 0;
+        float truncDb = 0.0f;
+        if (sscanf(line + 5, "%d %u %f", &ch, &tail, &truncDb) == 3 && ch >= 0 && ch < NUM_OUTPUTS) {
+            xSemaphoreTake(firCacheMutex, portMAX_DELAY);
+            firCompileReports[ch] = {true, (uint16_t)tail, truncDb};
+            xSemaphoreGive(firCacheMutex);
+            DebugSerial.printf("FIR compiled on output %d: %u tail taps, %.1f dB cut off\n", ch, tail, truncDb);
+        }
+        return;
+    }
+
     // "REC ..." recorder/player lines (state, errors, warnings) - see the
     // recorder section of teensy_protocol.h.
     if (strncmp(line, "REC ", 4) == 0) {
@@ -568,12 +781,18 @@ static void handleTeensyLine(const char* line) {
         // and the surplus is dropped - leaving the DSP half-configured.
         // Re-arm the baseline so only this sync runs.
         teensyLastUptime = 0;
+        forgetTeensyClock();
         updateTeensyWithActivePresetParameters();
         requestFirFilesRefresh();
         resetRecorderStateAfterReboot();
         return;
     }
 
+    if (strncmp(line, "STATS ", 6) == 0) {
+        handleStatsLine(line + 6);
+        return;
+    }
+
     if (strncmp(line, "PONG ", 5) == 0) {
         unsigned long& lastUptime = teensyLastUptime;
         unsigned long uptime = strtoul(line + 5, nullptr, 10);
@@ -581,6 +800,7 @@ static void handleTeensyLine(const char* line) {
         // boot event (e.g. it happened while we were rebooting too).
         if (lastUptime > 0 && uptime < lastUptime) {
             DebugSerial.println("Teensy reboot detected - re-syncing DSP state");
+            forgetTeensyClock();
             updateTeensyWithActivePresetParameters();
             requestFirFilesRefresh();
             resetRecorderStateAfterReboot();
@@ -593,6 +813,14 @@ static void handleTeensyLine(const char* line) {
     DebugSerial.println(line);
 }
 
+void getTeensyLinkStats(TeensyLinkStats& out) {
+    xSemaphoreTake(queueMutex, portMAX_DELAY);
+    out = linkStats;
+    out.queueDepth = queueCount;
+    xSemaphoreGive(queueMutex);
+    out.queueCapacity = QUEUE_SIZE;
+}
+
 // --- Setup / loop ---
 
 void initTeensyComm() {
@@ -625,6 +853,7 @@ void teensyCommLoop() {
                 memcpy(msg, cmdQueue[queueHead].msg, len);
                 queueHead = (queueHead + 1) % QUEUE_SIZE;
                 queueCount--;
+                linkStats.sent++;
             } else {
                 len = 0; // TX buffer full; try again next loop()
             }
@@ -645,7 +874,9 @@ void teensyCommLoop() {
             rxLine[rxLen] = '\0';
             if (rxOverflow) {
                 DebugSerial.println("Teensy RX line too long - dropped");
+                linkStats.rxOverflows++;
             } else if (rxLen > 0) {
+                linkStats.rxLines++;
                 handleTeensyLine(rxLine);
             }
             rxLen = 0;
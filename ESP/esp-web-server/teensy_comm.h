@@ -2,6 +2,7 @@
 #define TEENSY_COMM_H
 
 #include <Arduino.h>
+#include <ArduinoJson.h>
 
 #include "board_pins.h"
 // Command names, TEENSY_MSG_MAX and the message builder live in
@@ -33,6 +34,18 @@ bool sendToTeensy(const char* command, const String& param1,
                   const String& param2 = "", const String& param3 = "", const String& param4 = "",
                   const String& param5 = "");
 
+// Queue a command stamped "@<dueSample> " (teensy_protocol.h): a gain or
+// mute command takes effect at that sample, so several stamped alike land
+// together. Coalesces like the unstamped command; the newer stamp wins.
+bool sendStampedToTeensy(uint32_t dueSample, const char* command, const char* param1 = nullptr,
+                         const char* param2 = nullptr, const char* param3 = nullptr,
+                         const char* param4 = nullptr);
+
+// The Teensy's audio sample clock leadMs from now, extrapolated from the
+// last STATS clk=. False when there's none to go by (no STATS yet, a Teensy
+// that doesn't report clk=, or one that rebooted since).
+bool teensyClockAhead(uint32_t leadMs, uint32_t& sample);
+
 // Helper functions for common command types
 void sendOnOffToTeensy(const char* command, bool on);
 void sendIntToTeensy(const char* command, int value);
@@ -44,6 +57,75 @@ void sendStringToTeensy(const char* command, const String& value);
 // file lists) and handles Teensy reboot detection. Call from loop() only.
 void teensyCommLoop();
 
+// Link counters for GET /metrics. queueHighWater is the deepest the outgoing
+// queue has been since boot - a full preset sync is ~225 of QUEUE_SIZE (250),
+// so a reading near capacity means a second sync overlapped the first.
+// coalesced counts commands that replaced a pending one for the same
+// parameter, cancelled the EQ points a reset superseded, dropped the ones
+// refused because the queue was full. rxOverflows counts incoming lines
+// thrown away for exceeding the RX line buffer. Safe to call from any task.
+struct TeensyLinkStats {
+    uint32_t queueDepth = 0;
+    uint32_t queueHighWater = 0;
+    uint32_t queueCapacity = 0;
+    uint32_t queued = 0;
+    uint32_t coalesced = 0;
+    uint32_t cancelled = 0;
+    uint32_t dropped = 0;
+    uint32_t sent = 0;
+    uint32_t rxLines = 0;
+    uint32_t rxOverflows = 0;
+};
+void getTeensyLinkStats(TeensyLinkStats& out);
+
+// Teensy runtime telemetry, from the STATS line that follows every PONG
+// (teensy_protocol.h) - so refreshed every PING_INTERVAL_MS. Until now this
+// only reached the Teensy's USB console. cpuMax and usbMaxGapUs are peaks
+// over the interval since the previous line; the USB counters are totals
+// since the Teensy booted. usbReported is false on Teensy firmware built
+// with the stock USB input, which has none of those counters.
+struct TeensyStats {
+    bool valid = false;         // a STATS line has arrived since boot
+    uint32_t receivedAt = 0;    // millis() when it did
+    float cpu = 0.0f;           // AudioProcessorUsage, %
+    float cpuMax = 0.0f;
+    int audioBlocks = 0;        // audio pool blocks in use / peak / total
+    int audioBlocksMax = 0;
+    int audioBlocksTotal = 0;
+    uint32_t heapUnclaimed = 0; // RAM2 heap, see printMemoryStats
+    uint32_t heapReclaimable = 0;
+    bool usbReported = false;
+    bool usbStreaming = false;
+    float usbBufferedMs = 0.0f;
+    float usbTargetMs = 0.0f;   // fill the servo holds, adapted to the host
+    float usbStepPpm = 0.0f;    // host clock offset
+    uint32_t usbDrops = 0;
+    uint32_t usbStarves = 0;
+    uint32_t usbStops = 0;
+    uint32_t usbRecoveries = 0;
+    uint32_t usbResyncs = 0;
+    uint32_t usbAllocFails = 0;
+    uint32_t usbFalseStops = 0;
+    uint32_t usbMaxGapUs = 0;
+    bool logReported = false;
+    bool logActive = false;     // SD level log running
+    uint32_t logUs = 0;         // loop time it cost over the interval
+    uint32_t logMaxUs = 0;      // its slowest single pass
+    uint32_t logWrittenBytes = 0;
+    bool clockReported = false;
+    uint32_t audioClock = 0;    // sample clock "@<sample>" stamps are due on
+    bool inputEqReported = false;
+    uint32_t inputEqMaxUs = 0;  // slowest loudness retune of the input EQ
+};
+
+// Copy the latest telemetry under the cache lock. Safe from any task.
+void getTeensyStats(TeensyStats& out);
+
+// The shape GET /status ("teensy") and the teensyStats websocket message
+// share. ageMs is how old the reading is - a stale one means the Teensy
+// stopped answering pings.
+void teensyStatsToJson(const TeensyStats& stats, JsonObject out);
+
 // The SD file list is fetched asynchronously and cached (requested at boot,
 // when the Teensy reboots, and by requestFirFilesRefresh). Each cached line
 // is "name size" (V1 Teensy firmware) or just "name" (older firmware); WAV
@@ -62,6 +144,12 @@ void clearFirLoadErrors();
 bool getFirLoadError(int output, char* code, size_t codeSize,
                      char* file, size_t fileSize);
 
+// What the last load of a compiled output cut off (its "FIRC" line):
+// the ring-out taps kept and the energy past them in dB. Cleared with the
+// errors; a Teensy-side recompile replaces it. Returns false when the output
+// isn't compiled or hasn't reported since.
+bool getFirCompileReport(int output, uint16_t& tailTaps, float& truncationDb);
+
 // Size in bytes of a cached FIR file, or -1 when the file isn't in the cache
 // or was listed without a size. Safe to call from any task.
 long getCachedFirFileSize(const char* name);
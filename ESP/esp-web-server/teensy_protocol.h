@@ -10,6 +10,17 @@
 #include <stddef.h>
 #include <string.h>
 
+// Sample-stamped commands: any command may be prefixed "@<sample> ", where
+// <sample> is a decimal u32 on the Teensy's audio sample clock (44.1kHz,
+// counting from boot and wrapping every ~27h; STATS clk= reports where it
+// is). The gain commands - setVolume, setMute, setMutePercent,
+// setOutputGain, setOutputMute, setOutputInvert - then take effect at
+// exactly that sample, so several changes stamped alike land together
+// (e.g. a mute across all outputs, or a crossfade's two gains). A stamp
+// already past, or more than 10s ahead, applies at the next audio block,
+// as does an unstamped command. Every other command ignores the stamp; a
+// malformed stamp drops the line.
+
 // Output channel commands (V1, docs/CHANNEL_ARCHITECTURE.md). Channels are
 // 0-7; the ESP resolves crossover references to concrete frequencies before
 // sending, so the Teensy only ever sees per-channel numbers.
@@ -47,12 +58,20 @@
 #define CMD_SET_CONFIG_HOLD "setConfigHold"
 
 // Shared input EQ (L/R buses ahead of the routing matrix)
-//   setInputEq        <band> <freq> <q> <gain>
-//   resetInputEq      <fromBand>
+//   setInputEq        <set> <band> <freq> <q> <gain>
+//   resetInputEq      <set> <fromBand>
 //   setInputEqEnabled <0|1>
+//   setInputEqSpl     <refSpl> [<spl0> <spl1> <spl2>]
+// The Teensy holds all MAX_PEQ_SETS SPL sets; <set> is the slot index in
+// InputEq::sets (the older forms without it address set 0). setInputEqSpl
+// gives each slot's level in dB SPL (-1 = unused) and refSpl, the level
+// full volume plays at; from then on the Teensy follows setVolume along
+// the curve between the sets by itself, so a volume change costs no EQ
+// traffic.
 #define CMD_SET_INPUT_EQ "setInputEq"
 #define CMD_RESET_INPUT_EQ "resetInputEq"
 #define CMD_SET_INPUT_EQ_ENABLED "setInputEqEnabled"
+#define CMD_SET_INPUT_EQ_SPL "setInputEqSpl"
 
 // FIR Filter Commands. setFir is channel-indexed: "setFir <ch> <file>",
 // bare "setFir <ch>" clears. setFirEnabled is preset-level.
@@ -69,6 +88,22 @@
 #define CMD_SET_FIR "setFir"
 #define CMD_SET_FIR_ENABLED "setFirEnabled"
 #define CMD_LOAD_FIR_FILES "loadFirFiles"
+
+// Compiled FIR: "setOutputFirCompiled <ch> <0|1>". A compiled output folds
+// its crossover and PEQ into its FIR file at the next loadFirFiles - the
+// Teensy runs the file's taps through the IIR cascade as it streams them in,
+// lets the cascade ring out for up to FIR_COMPILE_TAIL_TAPS more taps, and
+// then bypasses the output's CrossoverFilter and PEQProcessor, so the
+// channel costs one convolution. The longer filter is charged to the pool:
+// the ESP charges the full tail for every compiled output with a file (the
+// Teensy sizes the real tail to the cascade's decay, never longer). Edits to
+// a compiled output's crossover or PEQ recompile it by themselves once they
+// stop for a second. Each compiled load reports what the tail cut off:
+//   FIRC <ch> <tailTaps> <truncDb>
+// truncDb is the energy past the tail against what was kept (-150 = none);
+// a low crossover or a narrow low bell is what rings past the cap.
+#define CMD_SET_OUTPUT_FIR_COMPILED "setOutputFirCompiled"
+#define FIR_COMPILE_TAIL_TAPS 1024
 #define CMD_GET_FILES "getFiles"
 
 // Preset-level master delay toggle: setDelaysEnabled <0|1>
@@ -87,6 +122,11 @@
 // RTA (real-time analyzer) streaming: "setRta 1" starts/keeps-alive,
 // "setRta 0" stops. The Teensy replies with "RTA <hex>" frames.
 #define CMD_SET_RTA "setRta"
+// Per-output spectra: "setRtaBank 1" starts/keeps-alive, "setRtaBank 0"
+// stops. The Teensy replies with "RTAB <ch> <hex>" frames, one channel at a
+// time round-robin: ch 0-7 are the outputs (post-chain), 8 the L+R input
+// mix; the hex payload is encoded exactly like an RTA frame.
+#define CMD_SET_RTA_BANK "setRtaBank"
 
 // Input-bus level meter streaming: same keepalive scheme as setRta. The
 // Teensy replies with "VU llrrf" frames at 20Hz - one hex byte per channel
@@ -116,14 +156,19 @@
 #define CMD_SET_COMP_STRENGTH "setCompStrength"
 #define CMD_SET_COMP_VOICE_PRIORITY "setCompVoicePriority"
 
-// GRM (compressor gain-reduction meter) streaming: same keepalive scheme as
-// setRta. The Teensy replies with "GRM <6 hex>" frames.
+// GRM (gain-reduction meter) streaming: same keepalive scheme as setRta.
+// The Teensy replies with "GRM <22 hex>" frames: one byte per compressor
+// band (3), then one per output's true-peak limiter (8, its deepest
+// reduction since the previous frame), each dB of reduction * 8. Firmware
+// from before the limiters sends the first 6 hex only.
 #define CMD_SET_GRM "setGrm"
 
 // Auto delay alignment probe.
-//   startDelayProbe <mask> <level>   mask = decimal 8-bit bitmap, bit n =
+//   startDelayProbe <mask> <level> [mic]
+//                                    mask = decimal 8-bit bitmap, bit n =
 //                                    output n (the ESP sets only enabled
-//                                    outputs); level = 0-100 (%)
+//                                    outputs); level = 0-100 (%); mic = 1 to
+//                                    analyze on the Teensy (below)
 //   stopDelayProbe
 // The Teensy plays one log chirp per masked output - outputs ascending,
 // then the same list reversed (the UI averages the two passes to cancel
@@ -136,7 +181,28 @@
 //   PROBE WARN unrouted <ch>
 //   PROBE DONE               (sequence complete, state restored)
 //   PROBE STOP               (stopped by command)
-//   PROBE ERR emptyMask | PROBE ERR aborted firLoad
+//   PROBE ERR emptyMask | PROBE ERR aborted firLoad | PROBE ERR aborted irMeasure
+//
+// With mic = 1 the arrivals are measured on the Teensy instead of a phone:
+// a measurement mic on the analog input's left channel is recorded to
+// PROBE_CAPTURE_PATH for the whole sequence, starting on the probe's first
+// audio block, so capture sample n is probe sample n and no clock but the
+// Teensy's is involved. Each chirp's window is then cross-correlated
+// against the chirp by FFT (IrDeconvolver, with the chirp's inverse filter:
+// the correlation comes out as the path's impulse response) and its peak
+// picked with sub-sample interpolation. After PROBE DONE, one line per slot:
+//   PROBE RESULT <slot> <ch> <lag> <peakDb> <confidence>
+//     lag: arrival in samples after the chirp's scheduled start (%.3f) -
+//          common I/O, FIR and limiter latency included, so only differences between
+//          outputs mean anything; peakDb: the response peak at unity drive;
+//          confidence: peak over background RMS - below
+//          PROBE_MIN_CONFIDENCE there is no arrival to speak of
+//   PROBE ANALYZED           (every slot reported, capture closed)
+//   PROBE ERR <code>         nosd, busy, mkdir, create, write, read, overrun
+// The mic mode needs the SD card, is refused (busy) while a recording
+// runs, and pauses the per-output spectrum stream like an IR measurement
+// (the correlation borrows its working memory). Stopping the probe or
+// loading a FIR during the analysis abandons it.
 #define CMD_START_DELAY_PROBE "startDelayProbe"
 #define CMD_STOP_DELAY_PROBE "stopDelayProbe"
 
@@ -161,6 +227,59 @@
 #define PROBE_FADE_SAMPLES 512        /* raised-cosine fade each end */
 #define PROBE_F0_HZ 60.0
 #define PROBE_F1_HZ 8000.0
+// On-device analysis window: lags -PROBE_LAG_PRE_SAMPLES up to
+// PROBE_LAG_WINDOW_SAMPLES - PROBE_LAG_PRE_SAMPLES (174ms - room for a long
+// FIR's latency, the full delay range and a large room) around each chirp.
+#define PROBE_LAG_PRE_SAMPLES 512
+#define PROBE_LAG_WINDOW_SAMPLES 8192
+// A response peak's max over the RMS of white noise alone is ~4-5 across
+// the window, so arrivals need clear air above that
+#define PROBE_MIN_CONFIDENCE 8
+#define PROBE_CAPTURE_PATH IR_MEASUREMENTS_DIR "/probe.wav"
+
+// Impulse response measurement: a measurement mic on the analog input's
+// left channel, one output at a time.
+//   startIrMeasure <ch> <level>      output 0-7, level 0-100 (%)
+//   stopIrMeasure
+// The Teensy solos the output (fixed level, same routing rules as the delay
+// probe), waits IR_SETTLE_MS for the amp ramp, then plays one log sweep
+// through it while recording the mic to the SD card. Sweep and capture start
+// on the same audio block, so lag 0 of the result means "played and captured
+// in the same update" and the peak's lag is the whole path's latency (I/O
+// buffering, FIR group delay, limiter lookahead, user delay, flight time). The capture is then
+// deconvolved in loop() - several seconds - into IR_MEASUREMENTS_DIR/
+// ir-NNN.wav: mono float32, IR_LENGTH samples, sample IR_PRE_SAMPLES = lag 0,
+// scaled so it reads as the path at unity drive (sweep amplitude and level
+// divided out). Reply lines (relayed to the web UI as irEvent):
+//   IR START <ch> <sweepSamples> <captureSamples>
+//   IR WARN unrouted <ch>        both source gains 0: expect silence
+//   IR CAPTURED                  capture on the card, deconvolution running
+//   IR PROGRESS <percent>        every 10%
+//   IR DONE <file> <peakIndex> <peakDb>
+//   IR STOP                      (stopped by command)
+//   IR ERR <code>                badch, nosd, busy, mkdir, full, create,
+//                                write, read, overrun, aborted
+// The per-output spectrum stream pauses for the duration (the deconvolution
+// borrows its working memory). A FIR load or a delay probe aborts the
+// measurement; recording and playback are refused (REC ERR busy) while it
+// runs, and it is refused (IR ERR busy) while a recording runs.
+#define CMD_START_IR_MEASURE "startIrMeasure"
+#define CMD_STOP_IR_MEASURE "stopIrMeasure"
+
+// Sweep/capture contract, shared by SweepSource/IrMeasurement (Teensy) and
+// the /measure/ir API (ESP). The capture only has to reach the end of the
+// result window: later samples never reach a kept lag.
+#define IR_SAMPLE_RATE 44100
+#define IR_SWEEP_SAMPLES 131072   /* 2.97s, 20Hz-20kHz */
+#define IR_SWEEP_F0_HZ 20.0
+#define IR_SWEEP_F1_HZ 20000.0
+#define IR_FADE_IN_SAMPLES 4096   /* raised cosine over 20-25Hz */
+#define IR_FADE_OUT_SAMPLES 256
+#define IR_PRE_SAMPLES 512        /* result samples before lag 0 */
+#define IR_LENGTH 16384           /* 371ms result, pre included */
+#define IR_CAPTURE_SAMPLES (IR_SWEEP_SAMPLES + IR_LENGTH - IR_PRE_SAMPLES)
+#define IR_SETTLE_MS 500
+#define IR_MEASUREMENTS_DIR "/measurements"
 
 // SD recorder / player. Recordings live in /recordings on the Teensy's SD
 // card as 16-bit 44.1kHz stereo WAVs named rec-NNN.wav; filenames on the
@@ -188,7 +307,74 @@
 #define CMD_STOP_PLAYBACK "stopPlayback"
 #define CMD_DELETE_RECORDING "deleteRecording"
 
+// Long-term level log. A background logger on the Teensy folds the input
+// RTA (into 1/3-octave bands), the input peak/clip meter and the
+// compressor's per-band gain reduction into one record per second and
+// appends it to LEVEL_LOG_PATH - a fixed-record ring holding the last
+// LEVEL_LOG_CAPACITY seconds (record layout in LevelLog.h on the Teensy).
+//   setLevelLog <0|1>                start/stop logging; the ESP persists the
+//                                    choice and re-sends it on every sync
+//   getLevelLog <from> <count> [step]
+//     from: first record (records are numbered in logged seconds since the
+//     file was created); negative counts back from the next record, so
+//     "-3600 3600" is the last logged hour. count: records to cover. step:
+//     records folded into each reply point (peaks and gain reduction by
+//     max, bands by mean power), raised as needed so no reply carries more
+//     than LEVEL_LOG_MAX_POINTS points.
+// Reply lines (relayed to the web UI as levelLogEvent):
+//   LOG STATE <on> <first> <next>    on start/stop, and ahead of every reply:
+//                                    records first..next-1 are on the card
+//   LOG RANGE <from> <count> <step>  the range actually served, clamped to it
+//   LOG PT <seq> <82 hex chars>      one point from record seq on: its first
+//                                    record's uptime (u32 seconds since boot,
+//                                    little-endian), then a byte each of
+//                                    flags, peak L, peak R, 3 x gain
+//                                    reduction and LEVEL_LOG_BANDS band
+//                                    levels. Flags: bit0/1 clip L/R, bit2
+//                                    bands valid, bit3 compressor on, bit4
+//                                    gap (seconds are missing before this
+//                                    record - logging restarted, or loop()
+//                                    stalled), bit5 the RTA was on a soloed
+//                                    output. Peaks are scaled as the VU
+//                                    frame, gain reduction as GRM, bands as
+//                                    RTA. Points with no readable record are
+//                                    left out.
+//   LOG END <points>
+//   LOG ERR <code>                   nosd, busy, mkdir, create, write, read
+// Logging costs ~64 bytes/s of card bandwidth (one sector write every
+// eight records) plus the RTA analysis it keeps running; STATS reports what
+// it actually spent (log=, logus=, logmax=, logwr=).
+#define CMD_SET_LEVEL_LOG "setLevelLog"
+#define CMD_GET_LEVEL_LOG "getLevelLog"
+
+#define LEVEL_LOG_DIR "/logs"
+#define LEVEL_LOG_PATH LEVEL_LOG_DIR "/levels.bin"
+#define LEVEL_LOG_INTERVAL_MS 1000
+#define LEVEL_LOG_CAPACITY 604800 /* 7 days of seconds, 38.7MB */
+#define LEVEL_LOG_BANDS 31        /* 1/3 octave, 20Hz-20kHz (ISO centres) */
+#define LEVEL_LOG_MAX_POINTS 300
+
 // System Commands
+//   ping    replies "PONG <uptimeMs>", then a runtime telemetry line of
+//           space-separated key=value tokens (unknown keys are ignored,
+//           missing ones read as absent):
+//     STATS cpu=<%> cpumax=<%> blk=<n> blkmax=<n> blktot=<n>
+//           heap=<bytes> reclaim=<bytes>
+//           [usb=<0|1> buf=<ms> tgt=<ms> ppm=<ppm> drops= starves= stops=
+//            recov= resyncs= allocf= fstops= maxgap=<us>] (async USB input only)
+//           log=<0|1> logus=<us> logmax=<us> logwr=<bytes>
+//           clk=<sample> leq=<us>
+//     cpumax and maxgap are peaks since the previous STATS line; the USB
+//     counters are totals since boot. tgt is the ring fill the USB servo
+//     holds, learned from the host's packet timing. logus is the loop() time the level
+//     log spent since the previous STATS line (its RTA analysis included
+//     when nothing else keeps the RTA running), logmax its longest single
+//     pass and logwr the bytes it wrote to the card in that interval. clk
+//     is the audio sample clock "@<sample>" stamps are due on. leq is the
+//     slowest input EQ retune (a volume step along the SPL sets' curve)
+//     since the previous STATS line.
+//     The line fits in STATS_LINE_MAX. The Teensy drops a line that
+//     doesn't rather than cut it short.
 #define CMD_SET_MUTE "setMute"
 #define CMD_SET_MUTE_PERCENT "setMutePercent"
 #define CMD_PING "ping"
@@ -197,6 +383,13 @@
 // Longest realistic message is "setFir <ch> <63-char filename>\n".
 #define TEENSY_MSG_MAX 80
 
+// Longest STATS line, including trailing newline and null. Worst case, with
+// every %lu at 10 digits, every %d at 11 and the floats (sent clamped to
+// +/-9999.9) at 7: 121 for the base fields, 185 for the USB ones, 58 for
+// log=, 15 each for clk= and leq=, plus the newline and null = 396.
+// Recount before adding a field. The ESP's RX buffer is at least this long.
+#define STATS_LINE_MAX 400
+
 // strlcpy with BSD semantics (returns the length of src, i.e. the intended
 // length), provided locally because it isn't part of standard C and the
 // native test build may not have it.
@@ -56,6 +56,7 @@ static void xoverRef(FilterSection& section, const char* id) {
 // Default spl=0 input EQ set: three flat points at 100/1000/10000 Hz
 static void defaultInputEq(InputEq& eq) {
     eq.enabled = false;
+    eq.refSpl = INPUT_EQ_REF_SPL_DEFAULT;
     for (int i = 0; i < MAX_PEQ_SETS; i++) {
         eq.sets[i] = PEQSet();
     }
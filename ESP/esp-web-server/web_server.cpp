@@ -5,6 +5,8 @@
 #include "api_system.h"
 #include "api_signal_generator.h"
 #include "api_probe.h"
+#include "api_ir.h"
+#include "api_level_log.h"
 #include "api_gains.h"
 #include "api_fir.h"
 #include "api_presets.h"
@@ -15,6 +17,8 @@
 #include "api_helpers.h"
 #include "teensy_comm.h"
 #include "config.h"
+#include "static_assets.h"
+#include "metrics.h"
 #include <ArduinoJson.h>
 
 // Both listeners serve identical routes. HTTPS exists so browsers grant
@@ -49,8 +53,26 @@ static bool loadCertificates() {
 }
 #endif // CONFIG_IDF_TARGET_ESP32S3
 
+// The backup is the single-file /config.msgpack format, built from the live
+// config - storage itself is per-preset records (config_store.h), but a
+// backup has to stay one file that any firmware's /restore accepts.
 static esp_err_t handleBackup(PsychicRequest *request) {
-    PsychicFileResponse response(request, LittleFS, CONFIG_FILE, "application/msgpack", true);
+    JsonDocument doc;
+    if (!config_to_json(doc)) {
+        return request->reply(503, "text/plain", "Not enough memory to build the backup");
+    }
+    size_t length = measureMsgPack(doc);
+    std::unique_ptr<uint8_t[]> buffer(new (std::nothrow) uint8_t[length]);
+    if (!buffer) {
+        return request->reply(503, "text/plain", "Not enough memory to build the backup");
+    }
+    serializeMsgPack(doc, buffer.get(), length);
+
+    PsychicResponse response(request);
+    response.setCode(200);
+    response.setContentType("application/msgpack");
+    response.addHeader("Content-Disposition", "attachment; filename=\"config.msgpack\"");
+    response.setContent(buffer.get(), length);
     return response.send();
 }
 
@@ -143,14 +165,14 @@ static esp_err_t finishRestore(PsychicRequest *request) {
         }
     }
 
-    // Valid: make it the live config file
-    if (!LittleFS.rename(RESTORE_TMP, CONFIG_FILE)) {
-        // Some FS implementations refuse to rename over an existing file
-        LittleFS.remove(CONFIG_FILE);
-        if (!LittleFS.rename(RESTORE_TMP, CONFIG_FILE)) {
-            DebugSerial.println("Failed to move restored config into place");
-            return request->reply(500, "text/plain", "Failed to move restored configuration into place");
-        }
+    // Valid: store it. The load already wrote the records of presets that
+    // aren't resident; this stores the globals and the resident ones, and
+    // removes records for slots the backup leaves empty, rather than
+    // waiting for the debounce.
+    LittleFS.remove(RESTORE_TMP);
+    if (!save_config()) {
+        DebugSerial.println("Failed to store restored config");
+        return request->reply(500, "text/plain", "Failed to store restored configuration");
     }
 
     // Apply the restored state to the DSP
@@ -166,75 +188,98 @@ static esp_err_t handleRestoreComplete(PsychicRequest *request) {
     return result;
 }
 
+// Every API route goes through here so GET /metrics can time it (metrics.h).
+// Both listeners land on the same series.
+static void route(PsychicHttpServer &s, const char *path, http_method method,
+                  PsychicHttpRequestCallback handler) {
+    s.on(path, method, metricsTimed(path, method, handler));
+}
+
+static void route(PsychicHttpServer &s, const char *path, http_method method,
+                  PsychicJsonRequestCallback handler) {
+    s.on(path, method, metricsTimed(path, method, handler));
+}
+
 // Register every route on the given server. Called once per listener - the
 // handlers are shared, endpoints (and the websocket handler) are per-server.
 static void registerRoutes(PsychicHttpServer &s, PsychicWebSocketHandler *ws) {
     // API Routes - System Status
-    s.on("/status", HTTP_GET, handleGetStatus);
-    s.on("/device/name", HTTP_PUT, handlePutDeviceName);
-    s.on("/mute/percent", HTTP_PUT, handlePutMutePercent);
-    s.on("/mute", HTTP_PUT, handlePutMute);
-    s.on("/volume", HTTP_PUT, handlePutVolume);
+    route(s, "/status", HTTP_GET, handleGetStatus);
+    route(s, "/metrics", HTTP_GET, handleGetMetrics);
+    route(s, "/device/name", HTTP_PUT, handlePutDeviceName);
+    route(s, "/mute/percent", HTTP_PUT, handlePutMutePercent);
+    route(s, "/mute", HTTP_PUT, handlePutMute);
+    route(s, "/volume", HTTP_PUT, handlePutVolume);
 
     // API Routes - Speaker & Input gains (JSON-body endpoints use the
     // PsychicJsonRequestCallback overload). /gains/speaker survives for the
     // remote/button path until that is reworked; the UI no longer calls it.
-    s.on("/gains/speaker", HTTP_PUT, handlePutSpeakerGain);
-    s.on("/gains/input", HTTP_PUT, (PsychicJsonRequestCallback)handlePutInputGains);
+    route(s, "/gains/speaker", HTTP_PUT, handlePutSpeakerGain);
+    route(s, "/gains/input", HTTP_PUT, (PsychicJsonRequestCallback)handlePutInputGains);
 
     // API Routes - FIR Filter Management
-    s.on("/fir/files", HTTP_GET, handleGetFirFiles);
-    s.on("/preset/fir/enabled", HTTP_PUT, handlePutPresetFirEnabled);
-    s.on("/preset/fir/pool", HTTP_GET, handleGetPresetFirPool);
+    route(s, "/fir/files", HTTP_GET, handleGetFirFiles);
+    route(s, "/preset/fir/enabled", HTTP_PUT, handlePutPresetFirEnabled);
+    route(s, "/preset/fir/pool", HTTP_GET, handleGetPresetFirPool);
 
     // API Routes - Signal Generator
-    s.on("/generate/tone/stop", HTTP_PUT, handlePutToneStop);
-    s.on("/generate/tone", HTTP_PUT, handlePutTone);
-    s.on("/noise", HTTP_PUT, handlePutNoise);
+    route(s, "/generate/tone/stop", HTTP_PUT, handlePutToneStop);
+    route(s, "/generate/tone", HTTP_PUT, handlePutTone);
+    route(s, "/noise", HTTP_PUT, handlePutNoise);
 
     // API Routes - Auto delay alignment probe
-    s.on("/probe/delay/start", HTTP_PUT, handlePutProbeDelayStart);
-    s.on("/probe/delay/stop", HTTP_PUT, handlePutProbeDelayStop);
+    route(s, "/probe/delay/start", HTTP_PUT, handlePutProbeDelayStart);
+    route(s, "/probe/delay/stop", HTTP_PUT, handlePutProbeDelayStop);
+
+    // API Routes - Impulse response measurement
+    route(s, "/measure/ir/start", HTTP_PUT, handlePutMeasureIrStart);
+    route(s, "/measure/ir/stop", HTTP_PUT, handlePutMeasureIrStop);
 
-    s.on("/preset/active", HTTP_PUT, handlePutActivePreset);
+    // API Routes - Long-term level log
+    route(s, "/log/levels", HTTP_PUT, handlePutLevelLog);
+    route(s, "/log/levels/query", HTTP_PUT, handlePutLevelLogQuery);
+
+    route(s, "/preset/active", HTTP_PUT, handlePutActivePreset);
 
     // Feature enablement
-    s.on("/preset/delay/enabled", HTTP_PUT, handlePutPresetDelayEnabled);
-    s.on("/preset/eq/enabled", HTTP_PUT, handlePutPresetEQEnabled);
-    s.on("/preset/crossover/enabled", HTTP_PUT, handlePutPresetCrossoverEnabled);
+    route(s, "/preset/delay/enabled", HTTP_PUT, handlePutPresetDelayEnabled);
+    route(s, "/preset/eq/enabled", HTTP_PUT, handlePutPresetEQEnabled);
+    route(s, "/preset/crossover/enabled", HTTP_PUT, handlePutPresetCrossoverEnabled);
 
     // API Routes - Input EQ (shared L/R preference curve + SPL sets)
-    s.on("/preset/eq", HTTP_PUT, (PsychicJsonRequestCallback)handlePutPresetEQPoints);
-    s.on("/preset/eq/point", HTTP_PUT, (PsychicJsonRequestCallback)handlePutPresetEQPoint);
+    route(s, "/preset/eq", HTTP_PUT, (PsychicJsonRequestCallback)handlePutPresetEQPoints);
+    route(s, "/preset/eq/point", HTTP_PUT, (PsychicJsonRequestCallback)handlePutPresetEQPoint);
 
     // API Routes - Crossover points
-    s.on("/preset/crossover", HTTP_PUT, handlePutPresetCrossover);
+    route(s, "/preset/crossover", HTTP_PUT, handlePutPresetCrossover);
 
     // API Routes - Dynamics (mixed-input multiband compressor)
-    s.on("/preset/dynamics", HTTP_PUT, (PsychicJsonRequestCallback)handlePutPresetDynamics);
-    s.on("/comp/solo", HTTP_POST, handlePostCompSolo);
+    route(s, "/preset/dynamics", HTTP_PUT, (PsychicJsonRequestCallback)handlePutPresetDynamics);
+    route(s, "/comp/solo", HTTP_POST, handlePostCompSolo);
 
     // API Routes - Output channels (V1)
-    s.on("/preset/output/label", HTTP_PUT, handlePutOutputLabel);
-    s.on("/preset/output/enabled", HTTP_PUT, handlePutOutputEnabled);
-    s.on("/preset/output/source", HTTP_PUT, (PsychicJsonRequestCallback)handlePutOutputSource);
-    s.on("/preset/output/gain", HTTP_PUT, handlePutOutputGain);
-    s.on("/preset/output/mute", HTTP_PUT, handlePutOutputMute);
-    s.on("/preset/output/invert", HTTP_PUT, handlePutOutputInvert);
-    s.on("/preset/output/delay", HTTP_PUT, handlePutOutputDelay);
-    s.on("/preset/output/filter", HTTP_PUT, (PsychicJsonRequestCallback)handlePutOutputFilter);
-    s.on("/preset/output/eq", HTTP_PUT, (PsychicJsonRequestCallback)handlePutOutputEq);
-    s.on("/preset/output/eq/point", HTTP_PUT, (PsychicJsonRequestCallback)handlePutOutputEqPoint);
-    s.on("/preset/output/eq/enabled", HTTP_PUT, handlePutOutputEqEnabled);
-    s.on("/preset/output/fir", HTTP_PUT, handlePutOutputFir);
+    route(s, "/preset/output/label", HTTP_PUT, handlePutOutputLabel);
+    route(s, "/preset/output/enabled", HTTP_PUT, handlePutOutputEnabled);
+    route(s, "/preset/output/source", HTTP_PUT, (PsychicJsonRequestCallback)handlePutOutputSource);
+    route(s, "/preset/output/gain", HTTP_PUT, handlePutOutputGain);
+    route(s, "/preset/output/mute", HTTP_PUT, handlePutOutputMute);
+    route(s, "/preset/output/invert", HTTP_PUT, handlePutOutputInvert);
+    route(s, "/preset/output/delay", HTTP_PUT, handlePutOutputDelay);
+    route(s, "/preset/output/filter", HTTP_PUT, (PsychicJsonRequestCallback)handlePutOutputFilter);
+    route(s, "/preset/output/eq", HTTP_PUT, (PsychicJsonRequestCallback)handlePutOutputEq);
+    route(s, "/preset/output/eq/point", HTTP_PUT, (PsychicJsonRequestCallback)handlePutOutputEqPoint);
+    route(s, "/preset/output/eq/enabled", HTTP_PUT, handlePutOutputEqEnabled);
+    route(s, "/preset/output/fir", HTTP_PUT, handlePutOutputFir);
+    route(s, "/preset/output/fir/compiled", HTTP_PUT, handlePutOutputFirCompiled);
+    route(s, "/preset/batch", HTTP_PUT, (PsychicJsonRequestCallback)handlePutPresetBatch);
 
     // API Routes - Preset Management
-    s.on("/templates", HTTP_GET, handleGetTemplates);
-    s.on("/presets", HTTP_GET, handleGetPresets);
-    s.on("/preset", HTTP_DELETE, handleDeletePreset);
-    s.on("/preset", HTTP_GET, handleGetPreset);
+    route(s, "/templates", HTTP_GET, handleGetTemplates);
+    route(s, "/presets", HTTP_GET, handleGetPresets);
+    route(s, "/preset", HTTP_DELETE, handleDeletePreset);
+    route(s, "/preset", HTTP_GET, handleGetPreset);
 
-    s.on("/preset", HTTP_POST, [](PsychicRequest *request) {
+    route(s, "/preset", HTTP_POST, [](PsychicRequest *request) {
         if (request->hasParam("action")) {
             String action = request->getParam("action")->value();
             if (action == "create") {
@@ -246,7 +291,7 @@ static void registerRoutes(PsychicHttpServer &s, PsychicWebSocketHandler *ws) {
         return request->reply(400, "text/plain", "Missing or unknown action");
     });
 
-    s.on("/preset", HTTP_PUT, [](PsychicRequest *request) {
+    route(s, "/preset", HTTP_PUT, [](PsychicRequest *request) {
         if (request->hasParam("action")) {
             String action = request->getParam("action")->value();
             if (action == "rename") {
@@ -257,28 +302,29 @@ static void registerRoutes(PsychicHttpServer &s, PsychicWebSocketHandler *ws) {
     });
 
     // API Routes - SD recorder / player
-    s.on("/recorder/record/start", HTTP_POST, handlePostRecordStart);
-    s.on("/recorder/record/stop", HTTP_POST, handlePostRecordStop);
-    s.on("/recorder/play/stop", HTTP_POST, handlePostRecorderPlayStop);
-    s.on("/recorder/play", HTTP_POST, handlePostRecorderPlay);
-    s.on("/recorder/file", HTTP_DELETE, handleDeleteRecording);
-    s.on("/recorder", HTTP_GET, handleGetRecorder);
+    route(s, "/recorder/record/start", HTTP_POST, handlePostRecordStart);
+    route(s, "/recorder/record/stop", HTTP_POST, handlePostRecordStop);
+    route(s, "/recorder/play/stop", HTTP_POST, handlePostRecorderPlayStop);
+    route(s, "/recorder/play", HTTP_POST, handlePostRecorderPlay);
+    route(s, "/recorder/file", HTTP_DELETE, handleDeleteRecording);
+    route(s, "/recorder", HTTP_GET, handleGetRecorder);
 
     // API Routes - Backup and Restore
-    s.on("/backup", HTTP_GET, handleBackup);
+    route(s, "/backup", HTTP_GET, handleBackup);
     s.maxUploadSize = RESTORE_MAX_SIZE; // rejects oversized Content-Lengths up front
     PsychicUploadHandler *restoreHandler = new PsychicUploadHandler();
     restoreHandler->onUpload(handleRestoreUpload);
-    restoreHandler->onRequest(handleRestoreComplete);
+    // Timed from the completion handler: the upload itself isn't counted
+    restoreHandler->onRequest(metricsTimed("/restore", HTTP_POST, handleRestoreComplete));
     s.on("/restore", HTTP_POST, restoreHandler);
 
     // Live updates websocket (one handler per listener - see websocket.h)
     s.on("/live-updates", ws);
 
-    // Static assets: hashed filenames under /assets cache forever; the rest
-    // of the dist (index.html, favicon, manifest, icons) serves from root.
-    s.serveStatic("/assets", LittleFS, "/dist/assets/", "public, max-age=31536000, immutable");
-    s.serveStatic("/", LittleFS, "/dist/")->setDefaultFile("index.html");
+    // Static assets (static_assets.h): precompressed variants by
+    // Accept-Encoding, ETag revalidation. Global handlers only run for URIs
+    // no route above matched.
+    s.addHandler(createStaticAssetHandler());
 
     s.onNotFound([](PsychicRequest *request) {
         return request->reply(404);
@@ -286,7 +332,10 @@ static void registerRoutes(PsychicHttpServer &s, PsychicWebSocketHandler *ws) {
 }
 
 void setupWebServer() {
-    // ~35 routes per listener (esp-idf's default cap is 8)
+    // Index /dist before either listener can take a request
+    initStaticAssets();
+
+    // ~50 routes per listener (esp-idf's default cap is 8)
     server.config.max_uri_handlers = 60;
     // esp-idf defaults this to 7, which was never budgeted against
     // CONFIG_LWIP_MAX_SOCKETS=16: 7 + listener + ctrl here, plus 3 + listener
@@ -3,6 +3,7 @@
 #include "web_server.h"
 #include "teensy_comm.h"
 #include "config.h" // NUM_OUTPUTS, for solo channel validation
+#include "mem_pool.h"
 #include <ArduinoJson.h>
 #include <atomic>
 
@@ -30,6 +31,15 @@ static int totalClients() {
     return wsHttpClients.load() + wsHttpsClients.load();
 }
 
+// Per-stream traffic for GET /metrics, counted when a broadcast is queued:
+// bytes are the payload times the listener's clients at that moment, so
+// they track what the radio was asked to carry. Broadcasts come from the
+// loop task and both httpd tasks, hence atomics.
+static const char *const STREAM_NAMES[WS_STREAM_COUNT] = {"events", "rta", "grm", "vu", "rtab"};
+static std::atomic<uint32_t> streamMessages[WS_STREAM_COUNT];
+static std::atomic<uint32_t> streamBytes[WS_STREAM_COUNT];
+static std::atomic<uint32_t> broadcastsDropped{0};
+
 // RTA subscription: the analyzer page sends "rta:keepalive" over the socket
 // every couple of seconds while it is open. While those keepalives are
 // fresh we keep the Teensy's RTA streaming enabled; when they stop (page
@@ -40,6 +50,11 @@ static int totalClients() {
 static unsigned long rtaLastClientKeepaliveAt = 0;
 static bool rtaActive = false;
 
+// Per-output spectra subscription: identical scheme, driven by
+// "rtab:keepalive" from the analyzer's output spectra panel.
+static unsigned long rtabLastClientKeepaliveAt = 0;
+static bool rtabActive = false;
+
 // GRM (compressor gain-reduction meter) subscription: identical scheme,
 // driven by "grm:keepalive" from any page showing the meters.
 static unsigned long grmLastClientKeepaliveAt = 0;
@@ -74,6 +89,10 @@ static void setupHandler(PsychicWebSocketHandler &handler, std::atomic<int> &cli
                 rtaLastClientKeepaliveAt = millis();
                 return ESP_OK;
             }
+            if (frame->len == 14 && strncmp((const char*)frame->payload, "rtab:keepalive", 14) == 0) {
+                rtabLastClientKeepaliveAt = millis();
+                return ESP_OK;
+            }
             if (frame->len == 13 && strncmp((const char*)frame->payload, "grm:keepalive", 13) == 0) {
                 grmLastClientKeepaliveAt = millis();
                 return ESP_OK;
@@ -115,6 +134,8 @@ void setupWebSocket() {
 }
 
 // A broadcast queued for one listener's httpd task (message copied inline).
+// Pool-allocated (mem_pool.h): these are the most frequent allocation on the
+// device while a meter streams.
 struct WsBroadcast {
     PsychicWebSocketHandler *handler;
     char msg[1]; // over-allocated to hold the whole message
@@ -123,33 +144,57 @@ struct WsBroadcast {
 static void wsBroadcastWork(void *arg) {
     WsBroadcast *b = (WsBroadcast *)arg;
     b->handler->sendAll(b->msg);
-    free(b);
+    poolFree(b);
 }
 
 static void queueBroadcast(PsychicHttpServer &server, PsychicWebSocketHandler &handler,
-                           std::atomic<int> &clientCount, const char *message) {
-    if (server.server == NULL || clientCount.load() == 0) {
+                           std::atomic<int> &clientCount, WsStream stream, const char *message) {
+    int clients = clientCount.load();
+    if (server.server == NULL || clients == 0) {
         return; // listener not started, or nobody to tell
     }
     size_t len = strlen(message);
-    WsBroadcast *b = (WsBroadcast *)malloc(sizeof(WsBroadcast) + len);
+    WsBroadcast *b = (WsBroadcast *)poolAlloc(sizeof(WsBroadcast) + len);
     if (b == NULL) {
+        broadcastsDropped++;
         return;
     }
     b->handler = &handler;
     memcpy(b->msg, message, len + 1);
     if (httpd_queue_work(server.server, wsBroadcastWork, b) != ESP_OK) {
-        free(b);
+        poolFree(b);
+        broadcastsDropped++;
+        return;
     }
+    streamMessages[stream]++;
+    streamBytes[stream] += len * clients;
 }
 
-static void broadcastToAllListeners(const char *message) {
-    queueBroadcast(server, wsHttp, wsHttpClients, message);
+static void broadcastToAllListeners(const char *message, WsStream stream = WS_STREAM_EVENTS) {
+    queueBroadcast(server, wsHttp, wsHttpClients, stream, message);
 #ifdef CONFIG_IDF_TARGET_ESP32S3
-    queueBroadcast(serverHttps, wsHttps, wsHttpsClients, message);
+    queueBroadcast(serverHttps, wsHttps, wsHttpsClients, stream, message);
 #endif
 }
 
+// Serialize a document into a pool block and broadcast it. The buffer is
+// only needed until each listener has taken its own copy.
+static void broadcastDocument(const JsonDocument &doc, bool log) {
+    size_t len = measureJson(doc);
+    char *buf = (char *)poolAlloc(len + 1);
+    if (buf == nullptr) {
+        broadcastsDropped++;
+        return;
+    }
+    serializeJson(doc, buf, len + 1);
+    if (log) {
+        broadcastWebSocket(buf);
+    } else {
+        broadcastToAllListeners(buf);
+    }
+    poolFree(buf);
+}
+
 // Do NOT send WS ping frames from the server: the browser's automatic pong
 // is dispatched to PsychicHttp's frame handler (esp-idf only intercepts
 // inbound PING/CLOSE itself), whose httpd_ws_recv_frame call errors on
@@ -170,7 +215,18 @@ void broadcastRtaFrame(const char* hexData) {
     if (len == 0 || len > 242) return; // up to 121 bands * 2 hex chars
     char buf[272];
     snprintf(buf, sizeof(buf), "{\"type\":\"rta\",\"d\":\"%s\"}", hexData);
-    broadcastToAllListeners(buf);
+    broadcastToAllListeners(buf, WS_STREAM_RTA);
+}
+
+// Forward one per-output spectrum frame ("RTAB <ch> <hex>"). ~20Hz, one
+// channel per frame, so again no debug logging.
+void broadcastRtaBankFrame(int ch, const char* hexData) {
+    if (totalClients() == 0) return;
+    size_t len = strlen(hexData);
+    if (ch < 0 || ch > NUM_OUTPUTS || len == 0 || len > 242) return; // ch 8 = input mix
+    char buf[284];
+    snprintf(buf, sizeof(buf), "{\"type\":\"rtab\",\"ch\":%d,\"d\":\"%s\"}", ch, hexData);
+    broadcastToAllListeners(buf, WS_STREAM_RTAB);
 }
 
 // Forward one delay-probe line (the payload after "PROBE ") to all clients
@@ -184,6 +240,27 @@ void broadcastProbeEvent(const char* line) {
     broadcastWebSocket(buf);
 }
 
+// Same for an IR measurement line (after "IR "), e.g.
+// {"messageType":"irEvent","line":"DONE ir-004.wav 3391 -2.7"}.
+void broadcastIrEvent(const char* line) {
+    if (totalClients() == 0) return;
+    size_t len = strlen(line);
+    if (len == 0 || len > 80) return;
+    char buf[128];
+    snprintf(buf, sizeof(buf), "{\"messageType\":\"irEvent\",\"line\":\"%s\"}", line);
+    broadcastWebSocket(buf);
+}
+
+// "PT <seq> <82 hex digits>" lines run to ~96 chars, hence the wider limit
+void broadcastLevelLogEvent(const char* line) {
+    if (totalClients() == 0) return;
+    size_t len = strlen(line);
+    if (len == 0 || len > 120) return;
+    char buf[168];
+    snprintf(buf, sizeof(buf), "{\"messageType\":\"levelLogEvent\",\"line\":\"%s\"}", line);
+    broadcastWebSocket(buf);
+}
+
 // Tell clients a channel's FIR filter failed to load, so the UI can stop
 // presenting that output as corrected when it is running without a filter.
 void broadcastFirLoadError(const char* presetName, int output,
@@ -192,22 +269,20 @@ void broadcastFirLoadError(const char* presetName, int output,
     if (presetName == nullptr || code == nullptr || file == nullptr) return;
     // Preset names are user-supplied, so serialize rather than snprintf into
     // a JSON template - a quote in a name would otherwise break the message.
-    JsonDocument doc;
+    JsonDocument doc(pooledJsonAllocator());
     doc["messageType"] = "firLoadError";
     doc["presetName"] = presetName;
     doc["output"] = output;
     doc["code"] = code;
     doc["file"] = file;
-    String out;
-    serializeJson(doc, out);
-    broadcastWebSocket(out.c_str());
+    broadcastDocument(doc, true);
 }
 
 // Full recorder/player snapshot, sent on every Teensy REC STATE line (at
 // most 1Hz while a recording or playback runs).
 void broadcastRecorderState(const RecorderState& state) {
     if (totalClients() == 0) return;
-    JsonDocument doc;
+    JsonDocument doc(pooledJsonAllocator());
     doc["messageType"] = "recorderState";
     doc["sdPresent"] = state.sdPresent;
     JsonObject rec = doc.createNestedObject("recording");
@@ -219,30 +294,34 @@ void broadcastRecorderState(const RecorderState& state) {
     play["file"] = state.playFile;
     play["seconds"] = state.playSeconds;
     play["length"] = state.playLength;
-    String out;
-    serializeJson(doc, out);
-    broadcastWebSocket(out.c_str());
+    broadcastDocument(doc, true);
 }
 
 void broadcastRecorderError(const char* code, const char* file) {
     if (totalClients() == 0) return;
-    JsonDocument doc;
+    JsonDocument doc(pooledJsonAllocator());
     doc["messageType"] = "recorderError";
     doc["code"] = code;
     doc["file"] = file;
-    String out;
-    serializeJson(doc, out);
-    broadcastWebSocket(out.c_str());
+    broadcastDocument(doc, true);
 }
 
 void broadcastRecorderWarning(const char* detail) {
     if (totalClients() == 0) return;
-    JsonDocument doc;
+    JsonDocument doc(pooledJsonAllocator());
     doc["messageType"] = "recorderWarning";
     doc["detail"] = detail;
-    String out;
-    serializeJson(doc, out);
-    broadcastWebSocket(out.c_str());
+    broadcastDocument(doc, true);
+}
+
+// Sent every ping interval whenever anyone is connected, so no debug
+// logging - it would drown the console.
+void broadcastTeensyStats(const TeensyStats& stats) {
+    if (totalClients() == 0) return;
+    JsonDocument doc(pooledJsonAllocator());
+    doc["messageType"] = "teensyStats";
+    teensyStatsToJson(stats, doc.createNestedObject("stats"));
+    broadcastDocument(doc, false);
 }
 
 void broadcastRecordingsChanged() {
@@ -255,10 +334,11 @@ void broadcastRecordingsChanged() {
 void broadcastGrmFrame(const char* hexData) {
     if (totalClients() == 0) return;
     size_t len = strlen(hexData);
-    if (len == 0 || len > 6) return; // 3 bands * 2 hex chars
-    char buf[48];
+    // 3 compressor bands, then 8 output limiters (older firmware: bands only)
+    if (len != 6 && len != 22) return;
+    char buf[64];
     snprintf(buf, sizeof(buf), "{\"type\":\"grm\",\"d\":\"%s\"}", hexData);
-    broadcastToAllListeners(buf);
+    broadcastToAllListeners(buf, WS_STREAM_GRM);
 }
 
 // Forward one VU frame (the hex payload after "VU ") to all clients.
@@ -269,7 +349,21 @@ void broadcastVuFrame(const char* hexData) {
     if (len == 0 || len > 5) return; // 2 peak bytes + 1 clip flag digit
     char buf[48];
     snprintf(buf, sizeof(buf), "{\"type\":\"vu\",\"d\":\"%s\"}", hexData);
-    broadcastToAllListeners(buf);
+    broadcastToAllListeners(buf, WS_STREAM_VU);
+}
+
+void getWebSocketStats(WebSocketStats &out) {
+    out.clientsHttp = wsHttpClients.load();
+    out.clientsHttps = wsHttpsClients.load();
+    for (int i = 0; i < WS_STREAM_COUNT; i++) {
+        out.messages[i] = streamMessages[i].load();
+        out.bytes[i] = streamBytes[i].load();
+    }
+    out.dropped = broadcastsDropped.load();
+}
+
+const char *webSocketStreamName(int stream) {
+    return stream >= 0 && stream < WS_STREAM_COUNT ? STREAM_NAMES[stream] : "unknown";
 }
 
 // Relay RTA/GRM interest to the Teensy: refresh each keepalive while a web
@@ -291,6 +385,21 @@ void websocketLoop() {
         sendToTeensy(CMD_SET_RTA, "0");
     }
 
+    bool wantRtab = rtabLastClientKeepaliveAt != 0 &&
+                    now - rtabLastClientKeepaliveAt < RTA_CLIENT_TIMEOUT_MS &&
+                    totalClients() > 0;
+    static unsigned long lastRtabRefreshAt = 0;
+    if (wantRtab) {
+        rtabActive = true;
+        if (now - lastRtabRefreshAt >= RTA_TEENSY_REFRESH_MS) {
+            lastRtabRefreshAt = now;
+            sendToTeensy(CMD_SET_RTA_BANK, "1");
+        }
+    } else if (rtabActive) {
+        rtabActive = false;
+        sendToTeensy(CMD_SET_RTA_BANK, "0");
+    }
+
     bool wantGrm = grmLastClientKeepaliveAt != 0 &&
                    now - grmLastClientKeepaliveAt < RTA_CLIENT_TIMEOUT_MS &&
                    totalClients() > 0;
@@ -21,6 +21,9 @@ void broadcastWebSocket(const char* message);
 // Forward one Teensy RTA frame (hex payload) to all websocket clients
 void broadcastRtaFrame(const char* hexData);
 
+// Forward one Teensy per-output spectrum frame (channel, hex payload)
+void broadcastRtaBankFrame(int ch, const char* hexData);
+
 // Forward one Teensy GRM (gain-reduction meter) frame to all clients
 void broadcastGrmFrame(const char* hexData);
 
@@ -31,6 +34,14 @@ void broadcastVuFrame(const char* hexData);
 // clients as a probeEvent message
 void broadcastProbeEvent(const char* line);
 
+// Forward one Teensy IR measurement line (payload after "IR ") to all
+// clients as an irEvent message
+void broadcastIrEvent(const char* line);
+
+// Forward one Teensy level-log line (payload after "LOG ") to all clients
+// as a levelLogEvent message
+void broadcastLevelLogEvent(const char* line);
+
 // Announce that an output's FIR filter failed to load (code: nosd, missing,
 // poolfull, toobig, nomem).
 void broadcastFirLoadError(const char* presetName, int output,
@@ -45,7 +56,30 @@ void broadcastRecorderError(const char* code, const char* file);
 void broadcastRecorderWarning(const char* detail);
 void broadcastRecordingsChanged();
 
-// Tracks client interest in RTA frames and relays it to the Teensy.
+// Teensy runtime telemetry (teensy_comm.h), relayed from every STATS line
+// (~every 5s) as a teensyStats message.
+struct TeensyStats; // teensy_comm.h
+void broadcastTeensyStats(const TeensyStats& stats);
+
+// Broadcast traffic by stream, for GET /metrics. "events" is every JSON
+// message (state changes, probe lines, recorder updates); the meters each
+// get their own because they dominate the byte count while a page shows
+// them. dropped counts broadcasts that never got queued (no heap, or the
+// listener's work queue refused them). Safe to call from any task.
+enum WsStream { WS_STREAM_EVENTS, WS_STREAM_RTA, WS_STREAM_GRM, WS_STREAM_VU, WS_STREAM_RTAB,
+                WS_STREAM_COUNT };
+struct WebSocketStats {
+    int clientsHttp;
+    int clientsHttps;
+    uint32_t messages[WS_STREAM_COUNT];
+    uint32_t bytes[WS_STREAM_COUNT];
+    uint32_t dropped;
+};
+void getWebSocketStats(WebSocketStats &out);
+const char *webSocketStreamName(int stream);
+
+// Tracks client interest in RTA (and the other meter) frames and relays it
+// to the Teensy.
 // Call from loop().
 void websocketLoop();
 
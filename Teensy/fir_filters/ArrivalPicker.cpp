@@ -0,0 +1,88 @@
+#include "ArrivalPicker.h"
+
+#include <math.h>
+
+// Lobe measurement, as delay-align.js: chunks whose peak holds at least
+// LOBE_EDGE of the arrival's belong to its main lobe, and LOBE_GUARD times
+// that half-width is excluded from the background - never less than ~3ms,
+// never so much that under a quarter of the window is left to measure.
+static const float LOBE_EDGE = 0.5f;
+static const int LOBE_GUARD = 2;
+static const int MIN_GUARD_CHUNKS = 3;
+
+void ArrivalPicker::begin(uint32_t preSamples, uint32_t lengthSamples) {
+  pre = preSamples;
+  length = lengthSamples;
+  count = 0;
+  last = 0.0f;
+  peakAt = 0;
+  peakAbs = 0.0f;
+  before = at = after = 0.0f;
+  wantAfter = false;
+  for (int c = 0; c < MAX_CHUNKS; c++) {
+    chunkMax[c] = 0.0f;
+    chunkEnergy[c] = 0.0f;
+  }
+}
+
+void ArrivalPicker::push(const float* h, int n) {
+  for (int i = 0; i < n && count < length; i++, count++) {
+    const float v = h[i];
+    const float a = fabsf(v);
+    if (wantAfter) {
+      after = v;
+      wantAfter = false;
+    }
+    if (a > peakAbs) {
+      peakAbs = a;
+      peakAt = count;
+      before = count > 0 ? last : 0.0f;
+      at = v;
+      after = 0.0f;
+      wantAfter = true;
+    }
+    const int c = (int)(count / CHUNK);
+    if (a > chunkMax[c]) chunkMax[c] = a;
+    chunkEnergy[c] += v * v;
+    last = v;
+  }
+}
+
+double ArrivalPicker::lag() const {
+  // Parabola through the peak and its neighbours, flipped so it opens
+  // downward whichever polarity the arrival has
+  double offset = 0.0;
+  const double s = at < 0.0f ? -1.0 : 1.0;
+  const double ym = s * before, y0 = s * at, yp = s * after;
+  const double denom = ym - 2.0 * y0 + yp;
+  if (peakAt > 0 && peakAt + 1 < count && denom < 0.0) {
+    offset = 0.5 * (ym - yp) / denom;
+  }
+  return (double)peakAt + offset - (double)pre;
+}
+
+float ArrivalPicker::confidence() const {
+  const int chunks = (int)(count / CHUNK);
+  if (peakAbs <= 0.0f || chunks == 0) return 0.0f;
+  const int pc = (int)(peakAt / CHUNK);
+
+  int lo = pc, hi = pc;
+  while (lo > 0 && chunkMax[lo - 1] >= LOBE_EDGE * peakAbs) lo--;
+  while (hi + 1 < chunks && chunkMax[hi + 1] >= LOBE_EDGE * peakAbs) hi++;
+  const int halfWidth = (pc - lo > hi - pc ? pc - lo : hi - pc) + 1;
+  int guard = LOBE_GUARD * halfWidth;
+  if (guard < MIN_GUARD_CHUNKS) guard = MIN_GUARD_CHUNKS;
+  if (guard > chunks / 4) guard = chunks / 4;
+
+  double energy = 0.0;
+  int used = 0;
+  for (int c = 0; c < chunks; c++) {
+    if (c >= pc - guard && c <= pc + guard) continue;
+    energy += chunkEnergy[c];
+    used++;
+  }
+  if (used == 0) return 0.0f;
+  const double rms = sqrt(energy / ((double)used * CHUNK));
+  if (rms <= 0.0) return 1e6f; // a synthetic, noiseless window
+  return (float)(peakAbs / rms);
+}
@@ -0,0 +1,57 @@
+#ifndef ARRIVAL_PICKER_H
+#define ARRIVAL_PICKER_H
+
+#include <stdint.h>
+
+// Arrival-time pick for the delay probe's on-device analysis: consumes one
+// slot's deconvolved response (IrDeconvolver's output blocks, in order) and
+// reports where its peak sits, to a fraction of a sample, and how far it
+// stands above the rest of the window. Shared by ProbeCapture and the
+// host-native tests - no Arduino/Audio dependencies.
+//
+// The same decisions as delay-align.js makes on the phone's recording, on a
+// response instead of a correlation envelope:
+//
+//   - the peak is the largest |h|, refined by a parabola through it and its
+//     neighbours (sign-corrected, so an inverted output fits the same way)
+//   - the background is the RMS of the window outside the peak's main lobe,
+//     and the lobe to exclude is measured, not assumed: a full-range output
+//     peaks within a few samples, a subwoofer spreads over tens of ms and
+//     would otherwise score its own skirts as noise
+//
+// Nothing but the peak's neighbourhood and 64-sample chunk statistics is
+// kept, so a window costs ~1KB however long it is.
+class ArrivalPicker {
+public:
+  static const int CHUNK = 64;
+  static const int MAX_CHUNKS = 128; // windows up to 8192 samples
+
+  // Start a window of length samples (a multiple of CHUNK, at most
+  // CHUNK * MAX_CHUNKS) whose sample pre is lag 0
+  void begin(uint32_t pre, uint32_t length);
+  // The window's next n samples
+  void push(const float* h, int n);
+
+  // Valid once the whole window is pushed. lag() is the peak's position
+  // relative to lag 0, in samples; confidence() the peak over the
+  // background RMS (0 for a silent window).
+  double lag() const;
+  float peak() const { return peakAbs; }
+  float confidence() const;
+
+private:
+  uint32_t pre = 0;
+  uint32_t length = 0;
+  uint32_t count = 0;
+  float last = 0.0f;       // the sample before the next one pushed
+  uint32_t peakAt = 0;
+  float peakAbs = 0.0f;
+  float before = 0.0f;     // h[peakAt - 1], h[peakAt], h[peakAt + 1]
+  float at = 0.0f;
+  float after = 0.0f;
+  bool wantAfter = false;
+  float chunkMax[MAX_CHUNKS];
+  float chunkEnergy[MAX_CHUNKS];
+};
+
+#endif // ARRIVAL_PICKER_H
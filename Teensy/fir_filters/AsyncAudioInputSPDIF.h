@@ -0,0 +1,116 @@
+/* Audio Library for Teensy 3.X
+ * Copyright (c) 2019, Paul Stoffregen, paul@pjrc.com
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+/*
+ by Alexander Walch
+ */
+
+// Vybes: vendored copy of the Audio library's AsyncAudioInputSPDIF3 (class
+// renamed), running on UsbResampler instead of the stock Resampler. The
+// instance is a global, so its resampler sits in RAM1: ~71KB instead of
+// ~194KB. The DMA, the lock/frequency detection and the latency servo are
+// upstream's unchanged. Besides the resampler swap:
+//  - the 5Hz buffer-level low-pass is computed here rather than with the
+//    library's biquad.h helpers (same RBJ design, same preload on a reset);
+//  - the SPDIF3 block configuration and the DPLL gain lookup come from
+//    AudioOutputSPDIF3, which only befriends the stock class (see the .cpp);
+//  - the DEBUG_SPDIF_IN prints are dropped;
+//  - idle skipping (setIdleEnabled): once unlocked or silent for
+//    InputActivity::SILENT_BLOCKS no blocks go out (zeros until then), and
+//    silent input is skipped rather than resampled until a non-zero sample
+//    arrives.
+// Quality: 1:1-ratio inputs (44.1kHz) run UsbResampler's fast kernel at 512x
+// oversampling; 48kHz and up need longer filters and get a lower
+// oversampling factor (test_usb_resampler checks both cases).
+// Upstream source: libraries/Audio/async_input_spdif3.{h,cpp}.
+
+#ifndef async_input_spdif_h_
+#define async_input_spdif_h_
+
+#include <Arduino.h>
+#include <AudioStream.h>
+#include <DMAChannel.h>
+#include <Quantizer.h>
+#include "UsbResampler.h"
+#include "InputActivity.h"
+
+class AsyncAudioInputSPDIF : public AudioStream
+{
+public:
+	///@param dither: if true, dithering is enabled
+	///@param noiseshaping: if true, noise shaping is enabled
+	///@param attenuation target attenuation [dB] of the anti-aliasing filter. Only used if AUDIO_SAMPLE_RATE_EXACT < input sample rate (input fs). The attenuation can't be reached if the needed filter length exceeds 2*USB_RESAMPLER_MAX_FILTER_SAMPLES+1
+	///@param minHalfFilterLength If AUDIO_SAMPLE_RATE_EXACT >= input fs), the filter length of the resampling filter is 2*minHalfFilterLength+1. If AUDIO_SAMPLE_RATE_EXACT < input fs the filter is maybe longer to reach the desired attenuation
+	///@param maxHalfFilterLength Can be used to restrict the maximum filter length at the cost of a lower attenuation
+	AsyncAudioInputSPDIF(bool dither=true, bool noiseshaping=true,float attenuation=100, int32_t minHalfFilterLength=20, int32_t maxHalfFilterLength=80);
+	~AsyncAudioInputSPDIF();
+	void begin();
+	virtual void update(void);
+	double getBufferedTime() const;
+	double getInputFrequency() const;
+	static bool isLocked();
+	double getTargetLantency() const;
+	double getAttenuation() const;
+	int32_t getHalfFilterLength() const;
+	// Vybes: idle skipping, off by default (upstream behaviour)
+	void setIdleEnabled(bool enabled) { _idleEnabled = enabled; }
+	bool idle() const { return _activity.idle(); }
+	uint32_t wakeups() const { return _activity.wakeups(); }
+protected:
+	static DMAChannel dma;
+	static void isr(void);
+private:
+	void resample(int16_t* data_left, int16_t* data_right, int32_t& block_offset, bool& silent);
+	bool skipSilence();
+	void monitorResampleBuffer();
+	void configure();
+	double getNewValidInputFrequ();
+	// Vybes: one biquad section standing in for the library's
+	// arm_biquad_cascade_df2T_instance_f64 + biquad.h helpers
+	double bufferLPF(double in);
+	void preloadBufferLPF(double val);
+
+	//accessed in isr ====
+	static volatile int32_t buffer_offset;
+	static volatile int32_t resample_offset;
+	static volatile uint32_t microsLast;
+	//====================
+
+	UsbResampler _resampler;
+	InputActivity _activity;
+	bool _idleEnabled=false;
+	Quantizer* quantizer[2];
+	double _lpfCoeffs[5];	// b0, b1, b2, a1, a2 (a0 normalised out)
+	double _lpfState[2];
+
+	volatile double _bufferedTime;
+	volatile double _lastValidInputFrequ;
+	double _inputFrequency=0.;
+	double _targetLatencyS;	//target latency [seconds]
+	const double _blockDuration=AUDIO_BLOCK_SAMPLES/AUDIO_SAMPLE_RATE; //[seconds]
+	double _maxLatency=2.*_blockDuration;
+};
+
+#endif
@@ -5,22 +5,22 @@
 // UsbResampler allows 1% adaption).
 static const double USB_NOMINAL_HZ = 44100.0;
 
-// Steady-state ring fill the servo holds (= added input latency) and the
-// hard ceiling beyond which we resync by dropping excess (host burst far
-// bigger than the cushion, or fill runaway before the servo converged).
-static const double TARGET_LATENCY_S = 0.008;
+// The hard ceiling beyond which we resync by dropping excess (host burst far
+// bigger than the cushion, or fill runaway before the servo converged). The
+// steady-state fill the servo holds (= added input latency) is learned per
+// host by UsbLatencyTarget, between 4 and 20ms.
 static const double MAX_LATENCY_S = 0.030;
 
-// Prefill before output resumes after a stream (re)start: the target fill
-// plus one output block and the resampler's lookahead, so the first blocks
-// don't immediately starve.
-static const uint32_t PREFILL_SAMPLES = 512;
+// Prefill before output resumes after a stream (re)start, on top of the
+// target fill: one output block and the resampler's lookahead, so the first
+// blocks don't immediately starve.
+static const uint32_t PREFILL_EXTRA_SAMPLES = 160;
 
 // No packet for this long = host stopped the stream (pause, track gap).
 static const uint32_t STOP_GAP_US = 100000;
 
 // One-pole smoothing of the latency error before the step PID (~5Hz at the
-// 344.5Hz update rate), standing in for AsyncAudioInputSPDIF3's biquad: the
+// 344.5Hz update rate), standing in for AsyncAudioInputSPDIF's biquad: the
 // raw fill sawtooths by a packet (~1ms) depending on update/packet phase.
 static const float DIFF_LPF_ALPHA = 0.09f;
 
@@ -54,7 +54,8 @@ AsyncAudioInputUSB::AsyncAudioInputUSB(bool dither, bool noiseshaping,
                                        int32_t maxHalfFilterLength)
     : AudioStream(0, NULL),
       diffFiltered(0.0f),
-      targetLatencyS(TARGET_LATENCY_S),
+      latency(AUDIO_BLOCK_SAMPLES * 1000.0f / AUDIO_SAMPLE_RATE_EXACT),
+      targetLatencyS(UsbLatencyTarget::START_MS * 1e-3),
       maxLatencyS(MAX_LATENCY_S),
       starveCount(0),
       recoveryCount(0),
@@ -62,7 +63,7 @@ AsyncAudioInputUSB::AsyncAudioInputUSB(bool dither, bool noiseshaping,
       stepAtKillPpm(0.0f),
       updatesSinceFix(0)
 {
-    ring = new UsbRxRing(PREFILL_SAMPLES, STOP_GAP_US);
+    ring = new UsbRxRing((uint32_t)(targetLatencyS * USB_NOMINAL_HZ) + PREFILL_EXTRA_SAMPLES, STOP_GAP_US);
     resampler = new UsbResampler(attenuation, minHalfFilterLength, maxHalfFilterLength);
     const float factor = powf(2, 15) - 1.f; // to 16 bit audio
     quantizer[0] = new Quantizer(AUDIO_SAMPLE_RATE_EXACT);
@@ -131,7 +132,15 @@ void AsyncAudioInputUSB::resyncToTarget()
     resampler->fixStep();
 }
 
-// Latency servo, the counterpart of AsyncAudioInputSPDIF3's
+// Follow the learned target: the servo holds the new fill from the next
+// update on, and the next stream start prefills for it.
+void AsyncAudioInputUSB::retarget()
+{
+    targetLatencyS = latency.targetMs() * 1e-3;
+    ring->setPrefill((uint32_t)(targetLatencyS * USB_NOMINAL_HZ) + PREFILL_EXTRA_SAMPLES);
+}
+
+// Latency servo, the counterpart of AsyncAudioInputSPDIF's
 // monitorResampleBuffer(): on gross overshoot resync hard first (so the PID
 // never sees the excursion), otherwise low-pass and clamp the fill error
 // and feed it to the resampler's step PID.
@@ -153,8 +162,9 @@ void AsyncAudioInputUSB::servo()
 // Fill one output block through the resampler, in up to two passes when the
 // readable run wraps around the physical end of the ring (the resampler
 // carries its fractional position and filter history across calls).
-int AsyncAudioInputUSB::resampleBlock(int16_t* dstL, int16_t* dstR)
+int AsyncAudioInputUSB::resampleBlock(int16_t* dstL, int16_t* dstR, bool& silent)
 {
+    silent = true;
     if (!resampler->initialized()) return 0;
     float outL[AUDIO_BLOCK_SAMPLES];
     float outR[AUDIO_BLOCK_SAMPLES];
@@ -171,20 +181,60 @@ int AsyncAudioInputUSB::resampleBlock(int16_t* dstL, int16_t* dstR)
         filled += got;
         if (processed < run) break; // stopped on lookahead, not on the wrap
     }
+    // Judged before the quantizer, whose dither is never silent
+    silent = InputActivity::silent(outL, filled) && InputActivity::silent(outR, filled);
     quantizer[0]->quantize(outL, dstL, filled);
     quantizer[1]->quantize(outR, dstR, filled);
     return filled;
 }
 
+// Idle counterpart of resampleBlock(): when everything readable is exact
+// zeros, move the resampler over it as resampling would (UsbResampler::skip)
+// without producing samples. Runs are capped at what was scanned - the USB
+// interrupt may append audio meanwhile. Returns false, having consumed
+// nothing, if any of it is signal.
+bool AsyncAudioInputUSB::skipSilentBlock(int& filled)
+{
+    filled = 0;
+    uint32_t scanned = ring->available();
+    if (!ring->silent(scanned)) return false;
+    for (int pass = 0; pass < 2 && filled < AUDIO_BLOCK_SAMPLES; pass++) {
+        uint32_t run = ring->contiguous();
+        if (run > scanned) run = scanned;
+        if (run == 0) break;
+        uint16_t processed = 0;
+        uint16_t got = 0;
+        resampler->skip(ring->leftAt(), ring->rightAt(), (uint16_t)run, processed,
+                        (uint16_t)(AUDIO_BLOCK_SAMPLES - filled), got);
+        ring->consume(processed);
+        scanned -= processed;
+        filled += got;
+        if (processed < run) break;
+    }
+    return true;
+}
+
+// Starve accounting and the latency adaption, once per block produced or
+// skipped. Mid-stream the target only slews (see UsbLatencyTarget), which
+// the servo follows by nudging the step - no samples skipped or padded.
+void AsyncAudioInputUSB::countBlock(int filled)
+{
+    if (filled < AUDIO_BLOCK_SAMPLES) {
+        starveCount++;
+        lastStarveFilled = (uint16_t)filled;
+    }
+    latency.update(ring->takeJitterGapUs(), filled < AUDIO_BLOCK_SAMPLES);
+    retarget();
+}
+
 // Glitch reporter. Runs in loop(), never in the audio/USB interrupts where
 // Serial output would deadlock: polls the counters at ~25ms and prints the
 // instant one moves, placing a single audible click in time to 25ms.
 //
 // Deliberately event-driven rather than periodic. Teensy's USB CDC write
 // blocks for up to TX_TIMEOUT (~120ms) when a host holds the port open but
-// stops draining it, and a stall that long in loop() coarsens
-// updateAudioVolume()'s gain smoothing - i.e. a debug print that causes the
-// very artefact it is here to find. These lines only fire when something has
+// stops draining it, and a stall that long in loop() holds up every
+// command behind it - a volume or mute change lands late enough to hear. These lines only fire when something has
 // already gone wrong; steady-state health belongs in the 20s summary.
 void AsyncAudioInputUSB::diagLoop()
 {
@@ -227,6 +277,22 @@ void AsyncAudioInputUSB::diagLoop()
 
 }
 
+// No audio to give this block. With idle skipping on, a stream that just
+// went away rings out like one that went quiet: zero blocks until the
+// activity hold runs out, so the filters downstream decay instead of
+// freezing mid-tail. Off, nothing is sent, as AudioInputUSB does.
+void AsyncAudioInputUSB::holdSilence()
+{
+    activity.update(false, true);
+    if (!idleEnabled || activity.idle()) return;
+    audio_block_t* block = allocate();
+    if (block == nullptr) { allocFailCount++; return; }
+    memset(block->data, 0, sizeof(block->data));
+    transmit(block, 0);
+    transmit(block, 1);
+    release(block);
+}
+
 void AsyncAudioInputUSB::update(void)
 {
     if (ring == nullptr || resampler == nullptr) return;
@@ -234,6 +300,7 @@ void AsyncAudioInputUSB::update(void)
         // idle or prefilling: transmit nothing (silence downstream, like
         // AudioInputUSB with no data) and keep the servo state neutral
         diffFiltered = 0.0f;
+        holdSilence();
         return;
     }
     if (!resampler->initialized()) {
@@ -252,16 +319,21 @@ void AsyncAudioInputUSB::update(void)
         const uint32_t target = (uint32_t)(targetLatencyS * USB_NOMINAL_HZ);
         const uint32_t avail = ring->available();
         if (avail > target) ring->consume(avail - target);
+        holdSilence();
         return;
     }
     if (ring->justStarted()) {
         // Stream (re)start: hosts front-load tens of ms on stream open;
         // trim straight to the target so the servo starts from zero error.
+        // The trim is silent here (nothing has played yet), so it is also
+        // where the learned target takes effect in one go.
+        latency.streamStarted();
+        retarget();
         resyncToTarget();
     }
     servo();
 
-    // Anti-windup, the counterpart of AsyncAudioInputSPDIF3's settled
+    // Anti-windup, the counterpart of AsyncAudioInputSPDIF's settled
     // fixStep(): with the error settled, periodically bake the adapted step
     // in as the new baseline and clear the PID integrator, so slow integral
     // windup can never creep toward the 1% kill switch.
@@ -270,6 +342,14 @@ void AsyncAudioInputUSB::update(void)
         if (fabsf(diffFiltered) < 0.0005f) { resampler->fixStep(); fixStepCount++; }
     }
 
+    // Idle on silence: skip it and send nothing while it lasts
+    int filled;
+    if (idleEnabled && activity.idle() && skipSilentBlock(filled)) {
+        countBlock(filled);
+        activity.update(true, true);
+        return;
+    }
+
     audio_block_t* left = allocate();
     if (left == nullptr) { allocFailCount++; return; }
     audio_block_t* right = allocate();
@@ -278,12 +358,18 @@ void AsyncAudioInputUSB::update(void)
         release(left);
         return;
     }
-    const int filled = resampleBlock(left->data, right->data);
+    bool silent;
+    filled = resampleBlock(left->data, right->data, silent);
     if (filled < AUDIO_BLOCK_SAMPLES) {
         memset(left->data + filled, 0, (AUDIO_BLOCK_SAMPLES - filled) * sizeof(int16_t));
         memset(right->data + filled, 0, (AUDIO_BLOCK_SAMPLES - filled) * sizeof(int16_t));
-        starveCount++;
-        lastStarveFilled = (uint16_t)filled;
+    }
+    countBlock(filled);
+    activity.update(true, silent);
+    if (idleEnabled && activity.idle()) {
+        release(left);
+        release(right);
+        return;
     }
     transmit(left, 0);
     release(left);
@@ -4,6 +4,8 @@
 #include <Arduino.h>
 #include <AudioStream.h>
 #include <Quantizer.h>
+#include "InputActivity.h"
+#include "UsbLatencyTarget.h"
 #include "UsbResampler.h"
 #include "UsbRxRing.h"
 
@@ -11,14 +13,22 @@
 // jitter. The core fork's usb_audio_rx_hook hands every raw isochronous
 // packet to this class before the stock AudioInputUSB buffering; packets go
 // into a ~46ms ring (UsbRxRing) and update() resamples to the local audio
-// clock with the same resampler/quantizer machinery AsyncAudioInputSPDIF3
+// clock with the same resampler/quantizer machinery AsyncAudioInputSPDIF
 // uses (UsbResampler is a slimmed vendored copy), servoing the resample step
 // on ring fill level. The USB feedback endpoint keeps reporting nominal
 // 44.1kHz - all rate matching happens here, so it also works with hosts
-// that ignore the feedback endpoint.
+// that ignore the feedback endpoint. The fill the servo holds adapts to
+// the host's packet timing (UsbLatencyTarget): a steady host gets a few ms,
+// one that delivers in bursts or stalls gets more.
+//
+// With idle skipping on (setIdleEnabled), a stream stopped or playing
+// digital silence for InputActivity::SILENT_BLOCKS sends no blocks (zeros
+// until then, so the filters downstream ring out), and the silent ring
+// content is skipped rather than resampled - the servo and the latency
+// adaption keep running, so a resume picks up mid-stream cleanly.
 //
 // The UsbResampler (~71KB) and the ring live on the heap (RAM2), keeping
-// RAM1 untouched and leaving the full 12288-tap FIR pool viable. Host
+// RAM1 untouched and leaving the full FIR pool viable. Host
 // volume/mute (the USB feature unit) is ignored, matching how the sketch
 // uses AudioInputUSB - input gain lives in the mixers.
 //
@@ -36,6 +46,7 @@ public:
 
     bool streaming() const { return ring && ring->streaming(); }
     float bufferedMs() const;
+    float targetMs() const { return (float)(targetLatencyS * 1000.0); } // fill the servo holds (learned)
     double stepPpm() const;   // resample step offset from 1.0 in ppm (= measured host clock offset)
     uint32_t drops() const { return ring ? ring->drops() : 0; }   // frames dropped, ring full
     uint32_t stops() const { return ring ? ring->stops() : 0; }   // stream stop/start transitions
@@ -45,6 +56,9 @@ public:
     uint32_t allocFails() const { return allocFailCount; }        // audio pool empty, block never transmitted
     uint32_t falseStops() const { return ring ? ring->falseStops() : 0; }
     uint32_t takeMaxGapUs() { return ring ? ring->takeMaxGapUs() : 0; } // host packet gap since last call
+    void setIdleEnabled(bool enabled) { idleEnabled = enabled; }  // off by default
+    bool idle() const { return activity.idle(); }
+    uint32_t wakeups() const { return activity.wakeups(); }
 
     // Call from loop(): prints a line whenever any glitch counter moves, plus
     // a periodic trace of fill/step/packet-gap. Cheap when nothing happens.
@@ -61,8 +75,12 @@ public:
 
 private:
     void servo();
+    void retarget();
     void resyncToTarget();
-    int resampleBlock(int16_t* dstL, int16_t* dstR);
+    int resampleBlock(int16_t* dstL, int16_t* dstR, bool& silent);
+    bool skipSilentBlock(int& filled);
+    void holdSilence();
+    void countBlock(int filled);
 
     static AsyncAudioInputUSB* instance;
 
@@ -70,6 +88,9 @@ private:
     UsbResampler* resampler;
     Quantizer* quantizer[2];
     float diffFiltered;    // low-passed latency error fed to the step PID
+    UsbLatencyTarget latency;
+    InputActivity activity;
+    bool idleEnabled = false;
     double targetLatencyS;
     double maxLatencyS;
     uint32_t starveCount;
@@ -7,7 +7,7 @@ static_assert(AUDIO_BLOCK_SAMPLES == FirEngine::BLOCK_SAMPLES,
 
 // Default constructor implementation
 AudioFilterFIRFloat::AudioFilterFIRFloat()
-  : AudioStream(1, inputQueueArray),
+  : AudioStreamF32(1, inputQueueArray, floatQueueArray),
     enabled(true),
     wasProcessing(false)
 {
@@ -86,33 +86,26 @@ void AudioFilterFIRFloat::commitLoad() {
 void AudioFilterFIRFloat::update(void) {
   unsigned long start_us = micros();
 
-  audio_block_t* block = receiveReadOnly(0);
-  if (!block) {
+  // If filter is disabled or not configured, pass data through unchanged
+  if (!enabled || engine.taps() == 0) {
     wasProcessing = false;
+    passThrough(0, 0);
     return;
   }
 
-  // If filter is disabled or not configured, pass data through unchanged
-  if (!enabled || engine.taps() == 0) {
+  audio_block_f32_t* block = receiveF32(0);
+  if (!block) {
     wasProcessing = false;
-    transmit(block);
-    release(block);
     return;
   }
 
-  audio_block_t* outBlock = allocate();
+  audio_block_f32_t* outBlock = allocateF32();
   if (!outBlock) {
     wasProcessing = false;
-    release(block);
+    releaseF32(block);
     return;
   }
 
-  float inputF32[AUDIO_BLOCK_SAMPLES];
-  float outputF32[AUDIO_BLOCK_SAMPLES];
-
-  arm_q15_to_float(block->data, inputF32, AUDIO_BLOCK_SAMPLES);
-  release(block);
-
   // After a gap (bypassed, upstream stalled, or fresh coefficients) the fast
   // engine's history is stale audio - restart it from silence.
   if (engine.fastLoaded() && !wasProcessing) {
@@ -126,12 +119,11 @@ void AudioFilterFIRFloat::update(void) {
   // No output scaling either: the filter output is the exact convolution of
   // the input with the loaded coefficients, so the active and bypassed paths
   // have identical gain.
-  engine.processBlock(inputF32, outputF32);
-
-  arm_float_to_q15(outputF32, outBlock->data, AUDIO_BLOCK_SAMPLES);
+  engine.processBlock(block->data, outBlock->data);
+  releaseF32(block);
 
-  transmit(outBlock);
-  release(outBlock);
+  transmitF32(outBlock);
+  releaseF32(outBlock);
 
   unsigned long elapsed_us = micros() - start_us;
   if (elapsed_us > max_update_us) {
@@ -4,13 +4,16 @@
 #include <Arduino.h>
 #include <Audio.h>
 #include "FirEngine.h"
+#include "AudioStreamF32.h"
 
 // Thin AudioStream wrapper around FirEngine, which holds the actual DSP
 // (direct-form CMSIS FIR and the uniformly partitioned overlap-save fast
 // convolution engine - see FirEngine.h). This class only adapts the engine
-// to the Teensy audio graph: q15<->float conversion, bypass, and making the
-// coefficient swap atomic with respect to the audio interrupt.
-class AudioFilterFIRFloat : public AudioStream {
+// to the Teensy audio graph: float blocks in and out (AudioStreamF32 - the
+// PEQ ahead of it is float-linked, the delay after it is int16), bypass,
+// and making the coefficient swap atomic with respect to the audio
+// interrupt.
+class AudioFilterFIRFloat : public AudioStreamF32 {
 
 public:
   // Default constructor
@@ -54,6 +57,7 @@ private:
   void commitLoad();
 
   audio_block_t *inputQueueArray[1];
+  audio_block_f32_t *floatQueueArray[1];
 
   FirEngine engine;
 
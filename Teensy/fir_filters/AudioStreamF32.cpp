@@ -0,0 +1,192 @@
+#include "AudioStreamF32.h"
+
+static_assert(F32BlockPool::SAMPLES == AUDIO_BLOCK_SAMPLES,
+              "float blocks must match the library's block size");
+
+F32BlockPool AudioStreamF32::pool;
+volatile uint32_t AudioStreamF32::conversions = 0;
+volatile uint32_t AudioStreamF32::floatHops = 0;
+
+AudioStreamF32::AudioStreamF32(unsigned char ninput, audio_block_t** iqueue,
+                               audio_block_f32_t** floatQueue)
+  : AudioStream(ninput, iqueue), floatQueue(floatQueue), numFloatInputs(ninput) {
+  for (unsigned char i = 0; i < ninput; i++) floatQueue[i] = nullptr;
+}
+
+void AudioStreamF32::initializeF32(audio_block_f32_t* blocks, uint16_t count) {
+  __disable_irq();
+  pool.begin(blocks, count);
+  __enable_irq();
+}
+
+void AudioStreamF32::resetPoolF32Max() {
+  __disable_irq();
+  pool.resetUsedMax();
+  __enable_irq();
+}
+
+uint32_t AudioStreamF32::takeConversions() {
+  __disable_irq();
+  const uint32_t n = conversions;
+  conversions = 0;
+  __enable_irq();
+  return n;
+}
+
+uint32_t AudioStreamF32::takeFloatHops() {
+  __disable_irq();
+  const uint32_t n = floatHops;
+  floatHops = 0;
+  __enable_irq();
+  return n;
+}
+
+audio_block_f32_t* AudioStreamF32::allocateF32() {
+  return pool.allocate();
+}
+
+void AudioStreamF32::releaseF32(audio_block_f32_t* block) {
+  pool.release(block);
+}
+
+audio_block_f32_t* AudioStreamF32::receiveF32(unsigned int index) {
+  if (index >= numFloatInputs) return nullptr;
+  audio_block_t* q = receiveReadOnly(index);
+  audio_block_f32_t* f = floatQueue[index];
+  if (f != nullptr) {
+    floatQueue[index] = nullptr;
+    if (q) release(q); // a float-linked input carries nothing else
+    return f;
+  }
+  if (q == nullptr) return nullptr;
+  f = allocateF32();
+  if (f != nullptr) {
+    arm_q15_to_float(q->data, f->data, AUDIO_BLOCK_SAMPLES);
+    conversions++;
+  }
+  release(q);
+  return f;
+}
+
+audio_block_f32_t* AudioStreamF32::receiveWritableF32(unsigned int index) {
+  audio_block_f32_t* f = receiveF32(index);
+  if (f == nullptr || f->refCount == 1) return f;
+  audio_block_f32_t* copy = allocateF32();
+  if (copy != nullptr) memcpy(copy->data, f->data, sizeof(copy->data));
+  releaseF32(f);
+  return copy;
+}
+
+audio_block_f32_t* AudioStreamF32::receiveLinkedF32(unsigned int index) {
+  if (index >= numFloatInputs) return nullptr;
+  audio_block_f32_t* f = floatQueue[index];
+  floatQueue[index] = nullptr;
+  return f;
+}
+
+bool AudioStreamF32::floatLinked(unsigned char index) const {
+  for (const AudioConnectionF32* c = floatDestinations; c != nullptr; c = c->next) {
+    if (c->srcIndex == index) return true;
+  }
+  return false;
+}
+
+void AudioStreamF32::transmitQ15(audio_block_f32_t* block, unsigned char index) {
+  audio_block_t* q = allocate();
+  if (q == nullptr) return;
+  arm_float_to_q15(block->data, q->data, AUDIO_BLOCK_SAMPLES);
+  conversions++;
+  transmit(q, index);
+  release(q);
+}
+
+void AudioStreamF32::transmitF32(audio_block_f32_t* block, unsigned char index) {
+  bool linked = false;
+  for (AudioConnectionF32* c = floatDestinations; c != nullptr; c = c->next) {
+    if (c->srcIndex != index) continue;
+    linked = true;
+    audio_block_f32_t*& slot = c->dst->floatQueue[c->dstIndex];
+    // An occupied slot means the destination skipped an update; like
+    // AudioStream::transmit, the newer block is the one dropped
+    if (slot == nullptr) {
+      pool.addRef(block);
+      slot = block;
+      floatHops++;
+    }
+  }
+  if (!linked) transmitQ15(block, index);
+}
+
+bool AudioStreamF32::passThrough(unsigned int in, unsigned char out) {
+  audio_block_t* q = receiveReadOnly(in);
+  audio_block_f32_t* f = in < numFloatInputs ? floatQueue[in] : nullptr;
+  if (f != nullptr) {
+    floatQueue[in] = nullptr;
+    if (q) release(q);
+    transmitF32(f, out);
+    releaseF32(f);
+    return true;
+  }
+  if (q == nullptr) return false;
+  if (floatLinked(out)) {
+    f = allocateF32();
+    if (f != nullptr) {
+      arm_q15_to_float(q->data, f->data, AUDIO_BLOCK_SAMPLES);
+      conversions++;
+      transmitF32(f, out);
+      releaseF32(f);
+    }
+  } else {
+    transmit(q, out);
+  }
+  release(q);
+  return true;
+}
+
+void AudioStreamF32::addFloatConnection() {
+  numFloatConnections++;
+  active = true;
+}
+
+void AudioStreamF32::removeFloatConnection() {
+  if (numFloatConnections > 0) numFloatConnections--;
+  if (numFloatConnections == 0 && numConnections == 0) active = false;
+}
+
+bool AudioConnectionF32::connect(AudioStreamF32& source, unsigned char sourceOutput,
+                                 AudioStreamF32& destination, unsigned char destinationInput) {
+  if (destinationInput >= destination.numFloatInputs) return false;
+  disconnect();
+  __disable_irq();
+  src = &source;
+  dst = &destination;
+  srcIndex = sourceOutput;
+  dstIndex = destinationInput;
+  next = source.floatDestinations;
+  source.floatDestinations = this;
+  source.addFloatConnection();
+  destination.addFloatConnection();
+  __enable_irq();
+  return true;
+}
+
+bool AudioConnectionF32::disconnect() {
+  if (src == nullptr) return false;
+  __disable_irq();
+  AudioConnectionF32** p = &src->floatDestinations;
+  while (*p != nullptr && *p != this) p = &(*p)->next;
+  if (*p == this) *p = next;
+  // A block still waiting at the destination goes back to the pool
+  audio_block_f32_t*& slot = dst->floatQueue[dstIndex];
+  if (slot != nullptr) {
+    AudioStreamF32::pool.release(slot);
+    slot = nullptr;
+  }
+  src->removeFloatConnection();
+  dst->removeFloatConnection();
+  src = nullptr;
+  dst = nullptr;
+  next = nullptr;
+  __enable_irq();
+  return true;
+}
@@ -0,0 +1,122 @@
+#ifndef AUDIO_STREAM_F32_H
+#define AUDIO_STREAM_F32_H
+
+#include <Arduino.h>
+#include <Audio.h>
+#include <arm_math.h>
+#include "F32BlockPool.h"
+
+// Float32 audio between the Vybes objects. The Audio library only moves
+// int16 blocks, so every float-processing object used to convert q15 in
+// and out - six roundings per output chain (crossover, PEQ, FIR), clipping
+// wherever an EQ boost pushed a hop past full scale. An AudioStreamF32 is
+// still an AudioStream (scheduled, CPU-counted and int16-connectable like
+// any other), but two of them can also be joined by an AudioConnectionF32,
+// which hands F32BlockPool blocks across instead. Conversion then happens
+// only where a float chain meets a stock int16 object: receiveF32() turns
+// an int16 input into float, transmitF32() turns float into int16 for an
+// output port with no float link.
+//
+// An output port feeds either AudioConnectionF32 links or ordinary
+// AudioConnections, never both: a float-linked port transmits no int16.
+// Like the int16 graph, a link delivers within the same update cycle only
+// when the source object was constructed before the destination.
+//
+// The scheduler only updates an AudioStream marked active, which the core
+// ties to its own connection count. A float link counts too: connecting
+// one activates both ends, and an object goes inactive only once its last
+// link of either kind is gone. AudioConnection::disconnect() can't see the
+// float links, though - dropping an object's last int16 link deactivates
+// it regardless - so rewire int16 first, float links after.
+//
+// The block pool is static and shared; the sketch hands it its storage
+// (initializeF32, next to firArena) after AudioMemory().
+typedef F32BlockPool::Block audio_block_f32_t;
+
+class AudioConnectionF32;
+
+class AudioStreamF32 : public AudioStream {
+public:
+  // floatQueue: one slot per input, like AudioStream's inputQueue
+  AudioStreamF32(unsigned char ninput, audio_block_t** iqueue, audio_block_f32_t** floatQueue);
+
+  static void initializeF32(audio_block_f32_t* blocks, uint16_t count);
+  static const F32BlockPool& poolF32() { return pool; }
+  static void resetPoolF32Max();
+
+  // Blocks converted between q15 and float, and blocks handed over float
+  // links (each one two conversions an int16 hop would have cost), since
+  // the previous call - loop() context
+  static uint32_t takeConversions();
+  static uint32_t takeFloatHops();
+
+protected:
+  static audio_block_f32_t* allocateF32();
+  static void releaseF32(audio_block_f32_t* block);
+
+  // The input as float: a linked block, else an int16 one converted (and
+  // released). nullptr when nothing arrived or the pool is empty. The
+  // caller owns one reference.
+  audio_block_f32_t* receiveF32(unsigned int index = 0);
+  // The same, safe to modify in place (copied if shared)
+  audio_block_f32_t* receiveWritableF32(unsigned int index = 0);
+  // Only a linked block, leaving int16 input to receiveReadOnly - for a
+  // consumer that takes q15 as cheaply as float
+  audio_block_f32_t* receiveLinkedF32(unsigned int index = 0);
+
+  // Send to every float link on the port, or as int16 if it has none.
+  // The caller keeps its reference.
+  void transmitF32(audio_block_f32_t* block, unsigned char index = 0);
+
+  // Bypass: forward whatever arrived on an input, converting only if the
+  // port needs the other format. Returns false if nothing arrived.
+  bool passThrough(unsigned int in, unsigned char out);
+
+  // AudioConnectionF32's share of the scheduling: keep the object active
+  // while any link, int16 or float, reaches it
+  void addFloatConnection();
+  void removeFloatConnection();
+
+private:
+  friend class AudioConnectionF32;
+
+  bool floatLinked(unsigned char index) const;
+  void transmitQ15(audio_block_f32_t* block, unsigned char index);
+
+  static F32BlockPool pool;
+  static volatile uint32_t conversions;
+  static volatile uint32_t floatHops;
+
+  audio_block_f32_t** floatQueue;
+  unsigned char numFloatInputs;
+  unsigned char numFloatConnections = 0; // float links in and out
+  AudioConnectionF32* floatDestinations = nullptr;
+};
+
+// A float link, wired like AudioConnection (at construction, or later with
+// connect()/disconnect() for links that move, such as the soloed output's
+// RTA tap).
+class AudioConnectionF32 {
+public:
+  AudioConnectionF32() {}
+  AudioConnectionF32(AudioStreamF32& source, unsigned char sourceOutput,
+                     AudioStreamF32& destination, unsigned char destinationInput) {
+    connect(source, sourceOutput, destination, destinationInput);
+  }
+  ~AudioConnectionF32() { disconnect(); }
+
+  bool connect(AudioStreamF32& source, unsigned char sourceOutput,
+               AudioStreamF32& destination, unsigned char destinationInput);
+  bool disconnect();
+
+private:
+  friend class AudioStreamF32;
+
+  AudioStreamF32* src = nullptr;
+  AudioStreamF32* dst = nullptr;
+  unsigned char srcIndex = 0;
+  unsigned char dstIndex = 0;
+  AudioConnectionF32* next = nullptr;
+};
+
+#endif // AUDIO_STREAM_F32_H
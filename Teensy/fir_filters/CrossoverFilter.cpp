@@ -1,7 +1,7 @@
 #include "CrossoverFilter.h"
 
 CrossoverFilter::CrossoverFilter()
-  : AudioStream(1, inputQueueArray), sampleRate(44100.0f) {
+  : AudioStreamF32(1, inputQueueArray, floatQueueArray), sampleRate(44100.0f), bypassed(false) {
   hp.count = 0;
   lp.count = 0;
   for (int i = 0; i < 2; i++) {
@@ -33,19 +33,26 @@ void CrossoverFilter::setLowpass(float freq, CrossoverType type) {
   applyBranch(lp, lpState, freq, type);
 }
 
-void CrossoverFilter::update(void) {
-  audio_block_t* block = receiveReadOnly();
-  if (!block) return;
+void CrossoverFilter::setBypass(bool bypass) {
+  if (bypass == bypassed) return;
+  AudioNoInterrupts();
+  bypassed = bypass;
+  for (int i = 0; i < 2; i++) {
+    hpState[i] = {0.0f, 0.0f};
+    lpState[i] = {0.0f, 0.0f};
+  }
+  AudioInterrupts();
+}
 
-  if (hp.count == 0 && lp.count == 0) {
-    transmit(block);
-    release(block);
+void CrossoverFilter::update(void) {
+  if (bypassed || (hp.count == 0 && lp.count == 0)) {
+    passThrough(0, 0);
     return;
   }
 
-  float buffer[AUDIO_BLOCK_SAMPLES];
-  arm_q15_to_float(block->data, buffer, AUDIO_BLOCK_SAMPLES);
-  release(block);
+  audio_block_f32_t* block = receiveWritableF32();
+  if (!block) return;
+  float* buffer = block->data;
 
   for (int s = 0; s < hp.count; s++) {
     const XoverSection& c = hp.section[s];
@@ -62,9 +69,6 @@ void CrossoverFilter::update(void) {
     }
   }
 
-  audio_block_t* out = allocate();
-  if (!out) return;
-  arm_float_to_q15(buffer, out->data, AUDIO_BLOCK_SAMPLES);
-  transmit(out);
-  release(out);
+  transmitF32(block);
+  releaseF32(block);
 }
@@ -5,12 +5,14 @@
 #include <Audio.h>
 #include <arm_math.h>
 #include "CrossoverMath.h"
+#include "AudioStreamF32.h"
 
 // Per-output HP + LP crossover: up to two SVF sections per branch, processed
-// in float32 (see CrossoverMath.h for the section math and type table).
+// in float32 (see CrossoverMath.h for the section math and type table),
+// and float-linked on to the output PEQ (AudioStreamF32).
 // Bypass lives inside the object - with both branches off, blocks pass
 // through untouched - so the audio graph never rewires patchcords.
-class CrossoverFilter : public AudioStream {
+class CrossoverFilter : public AudioStreamF32 {
 public:
   CrossoverFilter();
 
@@ -22,6 +24,12 @@ public:
   void setHighpass(float freq, CrossoverType type);
   void setLowpass(float freq, CrossoverType type);
 
+  // Pass blocks through untouched while keeping the branches configured -
+  // for an output whose crossover has been compiled into its FIR. Leaving
+  // bypass restarts from silent integrators.
+  void setBypass(bool bypassed);
+  bool isBypassed() const { return bypassed; }
+
   virtual void update(void) override;
 
 private:
@@ -29,10 +37,12 @@ private:
                    float freq, CrossoverType type);
 
   audio_block_t* inputQueueArray[1];
+  audio_block_f32_t* floatQueueArray[1];
   float sampleRate;
 
   XoverBranch hp, lp;
   XoverSectionState hpState[2], lpState[2];
+  volatile bool bypassed;
 };
 
 #endif // CROSSOVER_FILTER_H
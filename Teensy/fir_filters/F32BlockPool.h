@@ -0,0 +1,79 @@
+#ifndef F32_BLOCK_POOL_H
+#define F32_BLOCK_POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Hardware-free pool of reference-counted float audio blocks, the float
+// counterpart of the Audio library's audio_block_t pool: AudioStreamF32
+// hands these between the Vybes objects so a chain of them passes float32
+// from end to end instead of rounding to q15 at every hop. The storage is
+// the caller's (a static array, budgeted like firArena - see the sketch);
+// begin() threads it onto a free list.
+//
+// Threading: allocate/addRef/release run in the audio interrupt only, like
+// the library's pool; loop() only reads the counters.
+class F32BlockPool {
+public:
+    static const int SAMPLES = 128; // AUDIO_BLOCK_SAMPLES
+
+    struct Block {
+        float data[SAMPLES];
+        uint8_t refCount;
+        Block* nextFree;
+    };
+
+    void begin(Block* storage, uint16_t count) {
+        capacity_ = count;
+        freeList = nullptr;
+        for (uint16_t i = count; i > 0; i--) {
+            storage[i - 1].refCount = 0;
+            storage[i - 1].nextFree = freeList;
+            freeList = &storage[i - 1];
+        }
+        used_ = 0;
+        usedMax_ = 0;
+        allocFails_ = 0;
+    }
+
+    // A block owned once, or nullptr (counted) when the pool is empty
+    Block* allocate() {
+        Block* b = freeList;
+        if (b == nullptr) {
+            allocFails_ = allocFails_ + 1;
+            return nullptr;
+        }
+        freeList = b->nextFree;
+        b->nextFree = nullptr;
+        b->refCount = 1;
+        used_ = used_ + 1;
+        if (used_ > usedMax_) usedMax_ = used_;
+        return b;
+    }
+
+    void addRef(Block* b) { b->refCount++; }
+
+    // Drop one reference; the last one returns the block to the pool
+    void release(Block* b) {
+        if (b == nullptr || b->refCount == 0) return;
+        if (--b->refCount > 0) return;
+        b->nextFree = freeList;
+        freeList = b;
+        used_ = used_ - 1;
+    }
+
+    uint16_t capacity() const { return capacity_; }
+    uint16_t used() const { return used_; }
+    uint16_t usedMax() const { return usedMax_; }
+    void resetUsedMax() { usedMax_ = used_; }
+    uint32_t allocFails() const { return allocFails_; }
+
+private:
+    Block* freeList = nullptr;
+    uint16_t capacity_ = 0;
+    volatile uint16_t used_ = 0;
+    volatile uint16_t usedMax_ = 0;
+    volatile uint32_t allocFails_ = 0;
+};
+
+#endif // F32_BLOCK_POOL_H
@@ -0,0 +1,115 @@
+#include "FirCompiler.h"
+
+#include <math.h>
+
+void FirCompiler::clear() {
+  hpCount = 0;
+  lpCount = 0;
+  bellCount = 0;
+  reset();
+}
+
+void FirCompiler::addHighpass(const XoverBranch& b) {
+  for (int s = 0; s < b.count && hpCount < MAX_XOVER_SECTIONS / 2; s++) hp[hpCount++] = b.section[s];
+}
+
+void FirCompiler::addLowpass(const XoverBranch& b) {
+  for (int s = 0; s < b.count && lpCount < MAX_XOVER_SECTIONS / 2; s++) lp[lpCount++] = b.section[s];
+}
+
+void FirCompiler::addBell(const PeqSvfCoeffs& c) {
+  if (bellCount < MAX_PEQ_BANDS) bell[bellCount++] = c;
+}
+
+void FirCompiler::reset() {
+  for (int s = 0; s < MAX_XOVER_SECTIONS / 2; s++) {
+    hpState[s] = {0.0f, 0.0f};
+    lpState[s] = {0.0f, 0.0f};
+  }
+  for (int i = 0; i < MAX_PEQ_BANDS; i++) {
+    bellIc1[i] = 0.0f;
+    bellIc2[i] = 0.0f;
+  }
+}
+
+float FirCompiler::step(float x) {
+  for (int s = 0; s < hpCount; s++) x = xoverProcessHighpass(hp[s], hpState[s], x);
+  for (int s = 0; s < lpCount; s++) x = xoverProcessLowpass(lp[s], lpState[s], x);
+  // PEQProcessor::processBand, one sample at a time
+  for (int i = 0; i < bellCount; i++) {
+    const PeqSvfCoeffs& c = bell[i];
+    float v3 = x - bellIc2[i];
+    float v1 = c.a1 * bellIc1[i] + c.a2 * v3;
+    float v2 = bellIc2[i] + c.a2 * bellIc1[i] + c.a3 * v3;
+    bellIc1[i] = 2.0f * v1 - bellIc1[i];
+    bellIc2[i] = 2.0f * v2 - bellIc2[i];
+    x = x + c.m1 * v1;
+  }
+  return x;
+}
+
+uint16_t FirCompiler::tailTaps(uint16_t maxTail, float floorDb) {
+  if (empty()) return 0;
+  // Two passes over the impulse response rather than a buffer of it: the
+  // total energy first, then the point where what's left falls to the floor
+  const uint32_t horizon = (uint32_t)maxTail + RESIDUAL_SAMPLES;
+  double total = 0.0;
+  reset();
+  for (uint32_t n = 0; n < horizon; n++) {
+    const float y = step(n == 0 ? 1.0f : 0.0f);
+    total += (double)y * y;
+  }
+  const double allowed = total * pow(10.0, floorDb / 10.0);
+  double remaining = total;
+  reset();
+  uint16_t taps = maxTail;
+  for (uint32_t n = 0; n < maxTail; n++) {
+    const float y = step(n == 0 ? 1.0f : 0.0f);
+    remaining -= (double)y * y;
+    if (remaining <= allowed) {
+      taps = (uint16_t)(n + 1);
+      break;
+    }
+  }
+  reset();
+  return taps;
+}
+
+FirCompiler::Feed::Feed(FirCompiler& c, CoeffFeed& in, uint16_t innerCount, uint16_t outCount)
+  : compiler(c), inner(in), innerTaps(innerCount), outTaps(outCount < innerCount ? innerCount : outCount) {
+  compiler.reset();
+}
+
+uint16_t FirCompiler::Feed::read(float* dst, uint16_t count) {
+  if (failed) return 0;
+  if (count > outTaps - done) count = outTaps - done;
+  // The file's share straight into dst, then through the cascade in place
+  uint16_t fromInner = 0;
+  if (done < innerTaps) {
+    uint16_t want = innerTaps - done < count ? innerTaps - done : count;
+    fromInner = inner.read(dst, want);
+    if (fromInner < want) {
+      failed = true;
+      return fromInner;
+    }
+  }
+  for (uint16_t i = 0; i < count; i++) {
+    const float y = compiler.step(i < fromInner ? dst[i] : 0.0f);
+    keptEnergy += (double)y * y;
+    dst[i] = y;
+  }
+  done += count;
+  return count;
+}
+
+float FirCompiler::Feed::truncationDb() {
+  if (compiler.empty() || keptEnergy <= 0.0) return TRUNCATION_NONE_DB;
+  double lost = 0.0;
+  for (uint16_t n = 0; n < RESIDUAL_SAMPLES; n++) {
+    const float y = compiler.step(0.0f);
+    lost += (double)y * y;
+  }
+  if (lost <= 0.0) return TRUNCATION_NONE_DB;
+  const float db = (float)(10.0 * log10(lost / keptEnergy));
+  return db < TRUNCATION_NONE_DB ? TRUNCATION_NONE_DB : db;
+}
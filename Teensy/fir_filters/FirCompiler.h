@@ -0,0 +1,96 @@
+#ifndef FIR_COMPILER_H
+#define FIR_COMPILER_H
+
+// Folding an output's crossover and PEQ into its FIR at load time, shared by
+// the sketch (on the Teensy) and the host-native test suite - no
+// Arduino/Audio dependencies.
+//
+// An output in compiled mode runs one filter: its FIR file convolved with
+// the impulse response of the IIR cascade it would otherwise run per block
+// (HP sections, LP sections, then the PEQ bells - the chain's own order, with
+// the same float32 section math as CrossoverFilter and PEQProcessor). The
+// convolution costs nothing extra at load time: Feed runs the file's taps
+// through the cascade as the engine pulls them off the SD card, then lets
+// the cascade ring out for tail more taps. Whatever it would ring for after
+// that is lost - tailTaps() sizes the tail to the point the cascade's own
+// impulse response has decayed to floorDb, up to a cap, and Feed measures
+// what was actually cut off (truncationDb) so the sketch can report it.
+// Low crossovers and narrow low bells ring longest; a 20Hz LR4 highpass
+// won't fit a 1024-tap tail at -60dB and says so.
+
+#include <stdint.h>
+
+#include "CoeffSource.h"
+#include "CrossoverMath.h"
+#include "PEQMath.h"
+
+class FirCompiler {
+public:
+  static const int MAX_XOVER_SECTIONS = 4; // HP + LP, two sections each
+  // How long truncationDb() listens past the tail for what was cut off
+  static const uint16_t RESIDUAL_SAMPLES = 16384;
+  // Reported when nothing measurable was cut off (or nothing to compile)
+  static constexpr float TRUNCATION_NONE_DB = -150.0f;
+
+  FirCompiler() { clear(); }
+
+  // --- building the cascade ---
+
+  void clear();
+  // Branches in xoverComputeBranch's form; count 0 adds nothing
+  void addHighpass(const XoverBranch& hp);
+  void addLowpass(const XoverBranch& lp);
+  // A PEQ band's coefficients (peqComputeBellSvf); call only for bands the
+  // processor would run (enabled, gain != 0)
+  void addBell(const PeqSvfCoeffs& c);
+
+  bool empty() const { return hpCount + lpCount + bellCount == 0; }
+
+  // --- running it ---
+
+  // Silence the integrators
+  void reset();
+  // One sample through the whole cascade
+  float step(float x);
+
+  // Taps (up to maxTail) after which the cascade's impulse response holds
+  // no more than floorDb of its energy. Resets the cascade.
+  uint16_t tailTaps(uint16_t maxTail, float floorDb);
+
+  // The compiled filter, pulled like a file: innerTaps coefficients from
+  // inner through the cascade, then outTaps - innerTaps of ring-out. Resets
+  // the cascade when constructed; one Feed per load.
+  class Feed : public CoeffFeed {
+  public:
+    Feed(FirCompiler& compiler, CoeffFeed& inner, uint16_t innerTaps, uint16_t outTaps);
+    uint16_t read(float* dst, uint16_t count) override;
+
+    // Energy the compiled filter would have had past outTaps, relative to
+    // what it kept (dB; TRUNCATION_NONE_DB for none). Call once the feed
+    // has been read to the end - it runs the cascade on from there.
+    float truncationDb();
+
+  private:
+    FirCompiler& compiler;
+    CoeffFeed& inner;
+    uint16_t innerTaps;
+    uint16_t outTaps;
+    uint16_t done = 0;
+    double keptEnergy = 0.0;
+    bool failed = false;
+  };
+
+private:
+  XoverSection hp[MAX_XOVER_SECTIONS / 2];
+  XoverSection lp[MAX_XOVER_SECTIONS / 2];
+  XoverSectionState hpState[MAX_XOVER_SECTIONS / 2];
+  XoverSectionState lpState[MAX_XOVER_SECTIONS / 2];
+  PeqSvfCoeffs bell[MAX_PEQ_BANDS];
+  float bellIc1[MAX_PEQ_BANDS];
+  float bellIc2[MAX_PEQ_BANDS];
+  int hpCount;
+  int lpCount;
+  int bellCount;
+};
+
+#endif // FIR_COMPILER_H
@@ -0,0 +1,38 @@
+#include "FirLatency.h"
+
+#include <math.h>
+
+uint16_t FirLatencyProbe::read(float* dst, uint16_t count) {
+  const uint16_t got = inner.read(dst, count);
+  for (uint16_t i = 0; i < got; i++) {
+    const float a = fabsf(dst[i]);
+    if (wantAfter) {
+      afterPeak = a;
+      wantAfter = false;
+    }
+    // Strictly greater: of two equal taps the first is the peak, which puts
+    // an even-length linear-phase file's vertex halfway between them
+    if (a > peak) {
+      peak = a;
+      peakAt = pos;
+      beforePeak = last;
+      afterPeak = 0.0f;
+      wantAfter = true;
+    }
+    last = a;
+    pos++;
+  }
+  return got;
+}
+
+float FirLatencyProbe::latencySamples() const {
+  if (peak <= 0.0f) return 0.0f;
+  // Vertex of the parabola through the peak and its neighbours; it stays
+  // within half a sample either side since the peak is the largest of the three
+  const float den = beforePeak - 2.0f * peak + afterPeak;
+  float offset = den < 0.0f ? 0.5f * (beforePeak - afterPeak) / den : 0.0f;
+  if (offset > 0.5f) offset = 0.5f;
+  if (offset < -0.5f) offset = -0.5f;
+  const float at = (float)peakAt + offset;
+  return at < 0.0f ? 0.0f : at;
+}
@@ -0,0 +1,45 @@
+#ifndef FIR_LATENCY_H
+#define FIR_LATENCY_H
+
+// Measuring a FIR file's latency as it loads, shared by the sketch (on the
+// Teensy) and the host-native test suite - no Arduino/Audio dependencies.
+//
+// Delay alignment used to assume every file was linear phase and charge it
+// (N-1)/2 samples. A minimum-phase correction has its main arrival at the
+// first few taps, so that padded every other output by half the filter for
+// nothing. FirLatencyProbe sits between the file and whatever consumes it
+// (the engine, or FirCompiler::Feed) and finds the impulse response's
+// largest-magnitude tap on the way through, refined to a fraction of a
+// sample by a parabola through it and its neighbours. The peak is the main
+// arrival: the centre tap of a linear-phase file (exactly (N-1)/2, odd or
+// even N), tap 0 or so of a minimum-phase one, and wherever the direct sound
+// lands in a mixed-phase one, pre-ringing notwithstanding. It costs a
+// compare per tap and nothing filter-sized.
+
+#include <stdint.h>
+
+#include "CoeffSource.h"
+
+class FirLatencyProbe : public CoeffFeed {
+public:
+  explicit FirLatencyProbe(CoeffFeed& inner) : inner(inner) {}
+
+  // CoeffFeed: passes inner's coefficients through untouched
+  uint16_t read(float* dst, uint16_t count) override;
+
+  // The main arrival in samples from the first tap, once the feed has been
+  // read to the end (0 for an all-zero or empty filter)
+  float latencySamples() const;
+
+private:
+  CoeffFeed& inner;
+  uint32_t pos = 0;         // taps seen
+  uint32_t peakAt = 0;
+  float peak = 0.0f;        // |h| at peakAt
+  float beforePeak = 0.0f;  // |h| at peakAt - 1 (0 before the first tap)
+  float afterPeak = 0.0f;   // |h| at peakAt + 1 (0 past the last)
+  float last = 0.0f;        // |h| of the previous tap
+  bool wantAfter = false;   // the tap after the peak hasn't arrived yet
+};
+
+#endif // FIR_LATENCY_H
@@ -0,0 +1,194 @@
+#include "GainSchedule.h"
+
+#include <math.h>
+
+namespace GainSchedule {
+
+Params::Params() {
+  for (int ch = 0; ch < CHANNELS; ch++) {
+    outGain[ch] = 1.0f;
+    outMute[ch] = false;
+    outInvert[ch] = false;
+  }
+}
+
+void Params::apply(const Change& c) {
+  const bool on = c.value != 0.0f;
+  switch (c.param) {
+    case Param::Volume:
+      volume = c.value;
+      return;
+    case Param::Muted:
+      muted = on;
+      return;
+    case Param::MutePercent:
+      mutePercent = c.value < 0.0f ? 0.0f : (c.value > 100.0f ? 100.0f : c.value);
+      return;
+    default:
+      break;
+  }
+  if (c.ch >= CHANNELS) return;
+  switch (c.param) {
+    case Param::OutputGain:
+      outGain[c.ch] = powf(10.0f, c.value / 20.0f);
+      break;
+    case Param::OutputMute:
+      outMute[c.ch] = on;
+      break;
+    case Param::OutputInvert:
+      outInvert[c.ch] = on;
+      break;
+    default:
+      break;
+  }
+}
+
+float Params::target(int ch) const {
+  if (outMute[ch]) return 0.0f;
+  const float master = muted ? volume * (1.0f - mutePercent / 100.0f) : volume;
+  const float g = outGain[ch] * master;
+  return outInvert[ch] ? -g : g;
+}
+
+bool Queue::push(const Change& c) {
+  if (count == QUEUE_CAPACITY) return false;
+  // After everything due at or before it, so equal stamps keep their order
+  int at = count;
+  while (at > 0 && before(c.due, items[at - 1].due)) {
+    items[at] = items[at - 1];
+    at--;
+  }
+  items[at] = c;
+  count++;
+  return true;
+}
+
+const Change* Queue::due(uint32_t end) const {
+  if (count == 0 || !before(items[0].due, end)) return nullptr;
+  return &items[0];
+}
+
+void Queue::pop() {
+  if (count == 0) return;
+  for (int i = 1; i < count; i++) items[i - 1] = items[i];
+  count--;
+}
+
+float rampCoeff(float tauMs, float sampleRate) {
+  if (tauMs <= 0.0f) return 1.0f;
+  return 1.0f - expf(-1000.0f / (tauMs * sampleRate));
+}
+
+static inline int16_t saturate16(float v) {
+  if (v > 32767.0f) return 32767;
+  if (v < -32768.0f) return -32768;
+  return (int16_t)v;
+}
+
+static inline void store(int16_t& out, float v) { out = saturate16(v); }
+static inline void store(float& out, float v) { out = v; }
+
+template <typename T>
+static void ramp(const int16_t* in, T* out, int n, float& g, float target, float k) {
+  int i = 0;
+  for (; i < n && g != target; i++) {
+    g += (target - g) * k;
+    if (fabsf(target - g) < SNAP) g = target;
+    if (out != nullptr) store(out[i], in != nullptr ? in[i] * g : 0.0f);
+  }
+  if (out == nullptr) return;
+  // Settled: a plain scale for the rest of the segment
+  for (; i < n; i++) store(out[i], in != nullptr ? in[i] * g : 0.0f);
+}
+
+void rampSamples(const int16_t* in, int16_t* out, int n, float& g, float target, float k) {
+  ramp(in, out, n, g, target, k);
+}
+
+void rampSamplesFloat(const int16_t* in, float* out, int n, float& g, float target, float k) {
+  ramp(in, out, n, g, target, k);
+}
+
+Scheduler::Scheduler(float sampleRate) : k(rampCoeff(RAMP_TAU_MS, sampleRate)) {
+  for (int ch = 0; ch < CHANNELS; ch++) {
+    // Silent until the sketch publishes what the outputs should do
+    overrideOn[ch] = true;
+    overrideGain[ch] = 0.0f;
+    current[ch] = 0.0f;
+  }
+  segStart[0] = 0;
+  segStart[1] = 0;
+}
+
+bool Scheduler::schedule(Change c) {
+  if (before(c.due, clockSamples) || c.due - clockSamples > MAX_LEAD_SAMPLES) {
+    c.due = clockSamples;
+  }
+  if (queue.push(c)) return true;
+  params.apply(c);
+  return false;
+}
+
+void Scheduler::setOverride(int ch, bool active, float gain) {
+  if (ch < 0 || ch >= CHANNELS) return;
+  overrideOn[ch] = active;
+  overrideGain[ch] = gain;
+}
+
+float Scheduler::targetOf(int ch) const {
+  return overrideOn[ch] ? overrideGain[ch] : params.target(ch);
+}
+
+void Scheduler::beginBlock(int n) {
+  const uint32_t start = clockSamples;
+  const uint32_t end = start + (uint32_t)n;
+  blockSamples = n;
+  segments = 1;
+  segStart[0] = 0;
+  for (int ch = 0; ch < CHANNELS; ch++) segTarget[0][ch] = targetOf(ch);
+
+  for (const Change* c = queue.due(end); c != nullptr; c = queue.due(end)) {
+    const int offset = before(c->due, start) ? 0 : (int)(c->due - start);
+    if (offset > segStart[segments - 1]) {
+      if (segments == MAX_SEGMENTS) break; // the rest start the next block
+      segStart[segments] = offset;
+      segments++;
+    }
+    params.apply(*c);
+    queue.pop();
+    for (int ch = 0; ch < CHANNELS; ch++) segTarget[segments - 1][ch] = targetOf(ch);
+  }
+  segStart[segments] = n;
+}
+
+bool Scheduler::steady(int ch, float& gain) const {
+  gain = current[ch];
+  for (int s = 0; s < segments; s++) {
+    if (segTarget[s][ch] != gain) return false;
+  }
+  return true;
+}
+
+template <typename T>
+static void processSegments(const int16_t* in, T* out, int segments, const int* segStart,
+                            const float (*segTarget)[CHANNELS], int ch, float& g, float k) {
+  for (int s = 0; s < segments; s++) {
+    const int from = segStart[s];
+    ramp(in != nullptr ? in + from : nullptr, out != nullptr ? out + from : nullptr,
+         segStart[s + 1] - from, g, segTarget[s][ch], k);
+  }
+}
+
+void Scheduler::process(int ch, const int16_t* in, int16_t* out) {
+  processSegments(in, out, segments, segStart, segTarget, ch, current[ch], k);
+}
+
+void Scheduler::processFloat(int ch, const int16_t* in, float* out) {
+  processSegments(in, out, segments, segStart, segTarget, ch, current[ch], k);
+}
+
+void Scheduler::endBlock() {
+  clockSamples += (uint32_t)blockSamples;
+}
+
+} // namespace GainSchedule
@@ -0,0 +1,151 @@
+#ifndef GAIN_SCHEDULE_H
+#define GAIN_SCHEDULE_H
+
+// Timed output-gain changes and their per-sample ramps, shared by
+// OutputGainStage (on the Teensy) and the host-native test suite - no
+// Arduino/Audio dependencies.
+//
+// Every parameter that scales an output - master volume, mute and its
+// depth, per-output gain, mute and invert - is owned here and changed only
+// through schedule(). A change carries a due time on the audio sample clock
+// (clock() counts samples processed since boot); the audio update applies it
+// at exactly that sample, so changes stamped alike land together, and each
+// output's gain then glides to its new target along a per-sample one-pole
+// ramp (RAMP_TAU_MS), whatever loop() is doing. An unstamped change is due
+// at the next block.
+//
+// Threading: schedule()/setOverride() run in loop() context and
+// beginBlock() .. endBlock() in the audio interrupt; the caller keeps them
+// from interleaving (OutputGainStage wraps the loop side in
+// AudioNoInterrupts).
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace GainSchedule {
+
+static const int CHANNELS = 8;
+static const int QUEUE_CAPACITY = 32;
+// Distinct due times one block can apply at their exact sample; more than
+// that in one ~3ms block and the rest wait for the next block's start
+static const int MAX_SEGMENTS = 8;
+static const float RAMP_TAU_MS = 60.0f;
+// Within this of its target a ramp snaps to it (-80dB of full scale)
+static const float SNAP = 1e-4f;
+// A stamp further ahead than this is a client clock error, not a plan:
+// it is applied at once rather than parked for up to a day
+static const uint32_t MAX_LEAD_SAMPLES = 10u * 44100u;
+
+// Sample-clock order across the u32 wrap (every ~27h at 44.1kHz)
+static inline bool before(uint32_t a, uint32_t b) { return (int32_t)(a - b) < 0; }
+
+enum class Param : uint8_t {
+  Volume,       // value: linear master gain 0..1 (after the volume curve)
+  Muted,        // value: 0/1
+  MutePercent,  // value: 0..100, how far mute pulls the volume down
+  OutputGain,   // ch, value: dB
+  OutputMute,   // ch, value: 0/1
+  OutputInvert, // ch, value: 0/1
+};
+
+struct Change {
+  uint32_t due = 0;
+  Param param = Param::Volume;
+  uint8_t ch = 0;
+  float value = 0.0f;
+};
+
+// The parameters as the audio path currently applies them
+struct Params {
+  float volume = 0.5f;
+  bool muted = false;
+  float mutePercent = 100.0f;
+  float outGain[CHANNELS];  // linear
+  bool outMute[CHANNELS];
+  bool outInvert[CHANNELS];
+
+  Params();
+  void apply(const Change& c);
+  // Output gain * master volume, negated for invert, zero when muted
+  float target(int ch) const;
+};
+
+// Pending changes in due order; equal due times keep arrival order
+class Queue {
+public:
+  bool push(const Change& c); // false when full
+  // The earliest change if it is due before end, else nullptr
+  const Change* due(uint32_t end) const;
+  void pop(); // remove the earliest
+  int size() const { return count; }
+
+private:
+  Change items[QUEUE_CAPACITY];
+  int count = 0;
+};
+
+// One-pole per-sample coefficient for a time constant
+float rampCoeff(float tauMs, float sampleRate);
+
+// Scale n samples while g ramps toward target (g is updated); in == nullptr
+// is silence, which only advances the ramp. Saturates to int16.
+void rampSamples(const int16_t* in, int16_t* out, int n, float& g, float target, float k);
+// The same into floats at int16 scale, unsaturated, for a stage that
+// follows (OutputGainStage's limiters)
+void rampSamplesFloat(const int16_t* in, float* out, int n, float& g, float target, float k);
+
+class Scheduler {
+public:
+  explicit Scheduler(float sampleRate);
+
+  // --- loop side ---
+
+  // Queue c; a due time in the past (or absurdly far ahead) means "at the
+  // next block". A full queue applies c at once instead. False if it was
+  // not queued.
+  bool schedule(Change c);
+  // Replace an output's target with a fixed gain (config hold, delay probe,
+  // IR sweep, solo) until cleared; the ramp still rides the transition
+  void setOverride(int ch, bool active, float gain);
+
+  // Sample number of the next block's first sample
+  uint32_t clock() const { return clockSamples; }
+  float gain(int ch) const { return current[ch]; }
+  int pending() const { return queue.size(); }
+
+  // --- audio side, once per block of n samples ---
+
+  // Apply what falls due in this block and work out each output's targets
+  void beginBlock(int n);
+  // True if ch's gain holds one value for the whole block (no ramp, no
+  // change); gain is that value. The block can then be skipped (0), passed
+  // through (1) or scaled uniformly.
+  bool steady(int ch, float& gain) const;
+  // Scale one channel's block (in may be nullptr: silence; out nullptr
+  // only advances the ramp)
+  void process(int ch, const int16_t* in, int16_t* out);
+  void processFloat(int ch, const int16_t* in, float* out);
+  void endBlock();
+
+private:
+  float targetOf(int ch) const;
+
+  float k;
+  volatile uint32_t clockSamples = 0;
+  Queue queue;
+  Params params;
+  bool overrideOn[CHANNELS];
+  float overrideGain[CHANNELS];
+  float current[CHANNELS];
+
+  // The block being processed: segment s covers [segStart[s],
+  // segStart[s + 1]) and ramps toward segTarget[s]
+  int blockSamples = 0;
+  int segments = 0;
+  int segStart[MAX_SEGMENTS + 1];
+  float segTarget[MAX_SEGMENTS][CHANNELS];
+};
+
+} // namespace GainSchedule
+
+#endif // GAIN_SCHEDULE_H
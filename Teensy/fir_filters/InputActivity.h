@@ -0,0 +1,65 @@
+#ifndef INPUT_ACTIVITY_H
+#define INPUT_ACTIVITY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Hardware-free idle tracking for one input source, updated once per audio
+// block. A source goes idle after SILENT_BLOCKS blocks in a row with
+// nothing in them - digital silence, or no audio at all (SPDIF not locked,
+// USB stream stopped); the first block with anything in it wakes it again.
+// While idle the input stops transmitting blocks, so the mixers behind it
+// skip it, and the async inputs stop resampling (see UsbResampler::skip).
+//
+// SILENT_BLOCKS is long on purpose: once every source is idle the L/R
+// buses stop carrying blocks and the whole output chain stops with them,
+// so the last audio must have rung out of the longest FIR the pool can
+// hold first (the sketch static_asserts this against FIR_TAP_POOL). That
+// goes for a source lost mid-song too: the input sends zero blocks for it
+// until the hold runs out, rather than cutting the tails off.
+// Silence is exact zeros - dither from a source counts as signal.
+class InputActivity {
+public:
+    static const uint16_t SILENT_BLOCKS = 128; // ~371ms
+
+    // available: the source delivered this block at all. silent: what it
+    // delivered was all zeros (ignored when unavailable, which counts as
+    // silence).
+    void update(bool available, bool silent) {
+        if (available && !silent) {
+            if (idle_) wakeups_++;
+            silentRun = 0;
+            idle_ = false;
+            return;
+        }
+        if (silentRun < SILENT_BLOCKS) silentRun++;
+        if (silentRun >= SILENT_BLOCKS) idle_ = true;
+    }
+
+    // Starts idle: nothing has been heard from the source yet
+    bool idle() const { return idle_; }
+
+    // Idle -> active transitions since boot
+    uint32_t wakeups() const { return wakeups_; }
+
+    static bool silent(const int16_t* data, size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            if (data[i] != 0) return false;
+        }
+        return true;
+    }
+
+    static bool silent(const float* data, size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            if (data[i] != 0.0f) return false;
+        }
+        return true;
+    }
+
+private:
+    uint16_t silentRun = SILENT_BLOCKS;
+    bool idle_ = true;
+    uint32_t wakeups_ = 0;
+};
+
+#endif // INPUT_ACTIVITY_H
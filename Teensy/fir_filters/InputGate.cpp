@@ -0,0 +1,30 @@
+#include "InputGate.h"
+
+void InputGate::update() {
+    audio_block_t* in[2] = { receiveReadOnly(0), receiveReadOnly(1) };
+    bool silent = true;
+    for (int ch = 0; ch < 2; ch++) {
+        if (in[ch] != nullptr && !InputActivity::silent(in[ch]->data, AUDIO_BLOCK_SAMPLES)) silent = false;
+    }
+    const bool available = in[0] != nullptr || in[1] != nullptr;
+    activity.update(available, silent);
+    const bool pass = !idleEnabled || !activity.idle();
+    if (!available) {
+        // Ring out as for silence: zeros until the hold runs out
+        if (pass && idleEnabled) {
+            audio_block_t* zeros = allocate();
+            if (zeros != nullptr) {
+                memset(zeros->data, 0, sizeof(zeros->data));
+                transmit(zeros, 0);
+                transmit(zeros, 1);
+                release(zeros);
+            }
+        }
+        return;
+    }
+    for (int ch = 0; ch < 2; ch++) {
+        if (in[ch] == nullptr) continue;
+        if (pass) transmit(in[ch], ch);
+        release(in[ch]);
+    }
+}
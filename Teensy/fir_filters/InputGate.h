@@ -0,0 +1,34 @@
+#ifndef INPUT_GATE_H
+#define INPUT_GATE_H
+
+// Idle skipping for the stock inputs (Bluetooth and analog I2S), whose
+// update() can't be changed: a stereo pass-through that forwards the input's
+// blocks by pointer (no copy) and stops forwarding them once the pair has
+// been exact zeros (or missing - sent on as zeros meanwhile) for
+// InputActivity::SILENT_BLOCKS, so the input mixers behind it skip the
+// channel. The first non-zero block opens it again.
+// The async inputs do the same inside their own update(), where idling also
+// saves the resampling.
+
+#include <Arduino.h>
+#include <AudioStream.h>
+#include "InputActivity.h"
+
+class InputGate : public AudioStream {
+public:
+    InputGate() : AudioStream(2, inputQueueArray) {}
+
+    // Off: every block goes through, as if the gate weren't there
+    void setIdleEnabled(bool enabled) { idleEnabled = enabled; }
+    bool idle() const { return activity.idle(); }
+    uint32_t wakeups() const { return activity.wakeups(); }
+
+    virtual void update() override;
+
+private:
+    audio_block_t* inputQueueArray[2];
+    InputActivity activity;
+    bool idleEnabled = false;
+};
+
+#endif // INPUT_GATE_H
@@ -0,0 +1,184 @@
+#include "IrDeconvolver.h"
+#include "RtaFftTables.h"
+
+#include <math.h>
+#include <string.h>
+
+ExpSweep::ExpSweep(double sampleRate, double f0, double f1, uint32_t length,
+                   uint32_t fadeInSamples, uint32_t fadeOutSamples)
+  : fs(sampleRate), n(length), fadeIn(fadeInSamples), fadeOut(fadeOutSamples) {
+  w0 = 2.0 * M_PI * f0 / fs;
+  L = (double)n / log(f1 / f0);
+  r = exp(1.0 / L);
+  // theta[i] = sum of w0 r^m over m < i: ProbeSource's recurrence exactly,
+  // so the same class can stand in for the delay probe's chirp
+  K = w0 / (r - 1.0);
+  seek(0);
+}
+
+void ExpSweep::seek(uint32_t i) {
+  const double e = exp((double)i / L);
+  pos = i;
+  theta = K * (e - 1.0);
+  dtheta = K * e * (r - 1.0);
+}
+
+float ExpSweep::next() {
+  if (pos >= n) return 0.0f;
+  float w = 1.0f;
+  if (pos < fadeIn) {
+    w = 0.5f * (1.0f - cosf((float)M_PI * (float)pos / (float)fadeIn));
+  } else if (pos + fadeOut >= n) {
+    w = 0.5f * (1.0f - cosf((float)M_PI * (float)(n - 1 - pos) / (float)fadeOut));
+  }
+  // Reduce in double: theta reaches ~5e4 rad, where float has no phase left
+  const double ph = theta - 2.0 * M_PI * floor(theta / (2.0 * M_PI));
+  const float s = w * sinf((float)ph);
+  theta += dtheta;
+  dtheta *= r;
+  pos++;
+  return s;
+}
+
+void ExpSweep::fill(uint32_t start, int count, float* out) {
+  seek(start);
+  for (int i = 0; i < count; i++) out[i] = next();
+}
+
+double ExpSweep::inverseGain() const {
+  return M_PI * L / (2.0 * w0);
+}
+
+IrDeconvolver::IrDeconvolver() : sweep(44100.0, 20.0, 20000.0, PART, 0, 0) {
+  // Same hand-built 1024-point instance as RtaMultiRes, over the same
+  // PROGMEM tables (see there for why not arm_rfft_fast_init_f32)
+  rfft.Sint.fftLen = FFT_SIZE / 2;
+  rfft.Sint.pTwiddle = (const float32_t*)rtaTwiddleCoef512Bits;
+  rfft.Sint.pBitRevTable = rtaBitRevIndexTable512;
+  rfft.Sint.bitRevLength = 448; // ARMBITREVINDEXTABLE_512_TABLE_LENGTH
+  rfft.fftLenRFFT = FFT_SIZE;
+  rfft.pTwiddleRFFT = (float32_t*)rtaTwiddleCoefRfft1024Bits;
+}
+
+void IrDeconvolver::begin(const ExpSweep& s, float* arena, CoeffSource& source,
+                          uint64_t offset, uint32_t samples, uint32_t pre,
+                          uint32_t length, float scale, uint32_t origin) {
+  sweep = s;
+  src = &source;
+  dataOffset = offset;
+  captureSamples = samples;
+  firstLag = sweep.length() - 1 - pre + origin;
+  numParts = (int)((sweep.length() + PART - 1) / PART);
+  numBlocks = (int)(length / PART);
+  block = 0;
+  part = 0;
+  gain = (float)(scale / sweep.inverseGain());
+  peakAt = 0;
+  peak = 0.0f;
+  readFailed = false;
+
+  window = arena;
+  work = window + FFT_SIZE;
+  xSpec = work + FFT_SIZE;
+  hSpec = xSpec + FFT_SIZE;
+  acc = hSpec + FFT_SIZE;
+  out = nullptr;
+  active = true;
+}
+
+// count capture samples from index start (which may lie partly outside the
+// capture - zeros there) as floats at int16 full scale = 1.0
+bool IrDeconvolver::readCapture(int64_t start, int count, float* dst) {
+  int16_t raw[PART];
+  int64_t a = start < 0 ? 0 : start;
+  int64_t b = start + count;
+  if (b > (int64_t)captureSamples) b = captureSamples;
+  for (int i = 0; i < count; i++) dst[i] = 0.0f;
+  if (b <= a) return true;
+  const int valid = (int)(b - a);
+  if (!src->seek(dataOffset + 2 * (uint64_t)a)) return false;
+  if (src->read(raw, (size_t)valid * 2) != valid * 2) return false;
+  float* d = dst + (a - start);
+  for (int i = 0; i < valid; i++) d[i] = (float)raw[i] * (1.0f / 32768.0f);
+  return true;
+}
+
+// Partition j of the inverse filter, zero-padded to FFT_SIZE:
+// inv[m] = gain * e^((N-1-m)/L) * x[N-1-m] for m in [jP, jP + P).
+// Generated forward over the sweep indices it covers, then reversed.
+void IrDeconvolver::inversePartition(int j, float* dst) {
+  const uint32_t N = sweep.length();
+  const uint32_t first = (uint32_t)j * PART;
+  int count = PART;
+  if (first + count > N) count = (int)(N - first);
+  const uint32_t lo = N - first - count; // lowest sweep index covered
+  sweep.fill(lo, count, dst);
+  float env = gain * (float)exp((double)lo / sweep.rate());
+  const float envStep = (float)exp(1.0 / sweep.rate());
+  for (int i = 0; i < count; i++) {
+    dst[i] *= env;
+    env *= envStep;
+  }
+  for (int i = 0, k = count - 1; i < k; i++, k--) {
+    const float t = dst[i];
+    dst[i] = dst[k];
+    dst[k] = t;
+  }
+  memset(dst + count, 0, (FFT_SIZE - count) * sizeof(float));
+}
+
+bool IrDeconvolver::step() {
+  if (!active || readFailed || block == numBlocks) return false;
+  const int64_t k0 = (int64_t)firstLag + (int64_t)block * PART;
+
+  // The capture window slides back one partition per step: its newer half
+  // is the older half of the previous step's, so only PART samples are read
+  if (part == 0) {
+    memset(acc, 0, FFT_SIZE * sizeof(float));
+    if (!readCapture(k0 - PART, PART, window) || !readCapture(k0, PART, window + PART)) {
+      readFailed = true;
+      return false;
+    }
+  } else {
+    memmove(window + PART, window, PART * sizeof(float));
+    if (!readCapture(k0 - (int64_t)(part + 1) * PART, PART, window)) {
+      readFailed = true;
+      return false;
+    }
+  }
+  memcpy(work, window, FFT_SIZE * sizeof(float));
+  arm_rfft_fast_f32(&rfft, work, xSpec, 0);
+  inversePartition(part, work);
+  arm_rfft_fast_f32(&rfft, work, hSpec, 0);
+
+  // Packed [DC, Nyquist, re1, im1, ...] multiply-accumulate (as FirEngine)
+  acc[0] += xSpec[0] * hSpec[0];
+  acc[1] += xSpec[1] * hSpec[1];
+  for (int k = 2; k < FFT_SIZE; k += 2) {
+    const float xr = xSpec[k], xi = xSpec[k + 1];
+    const float hr = hSpec[k], hi = hSpec[k + 1];
+    acc[k]     += xr * hr - xi * hi;
+    acc[k + 1] += xr * hi + xi * hr;
+  }
+  if (++part < numParts) return false;
+
+  // Block complete: the second half of the circular result is valid
+  part = 0;
+  arm_rfft_fast_f32(&rfft, acc, work, 1);
+  out = work + PART;
+  for (int i = 0; i < PART; i++) {
+    const float v = fabsf(out[i]);
+    if (v > peak) {
+      peak = v;
+      peakAt = (uint32_t)block * PART + i;
+    }
+  }
+  block++;
+  return true;
+}
+
+int IrDeconvolver::progressPercent() const {
+  if (numBlocks == 0) return 0;
+  const int64_t doneSteps = (int64_t)block * numParts + part;
+  return (int)(doneSteps * 100 / ((int64_t)numBlocks * numParts));
+}
@@ -0,0 +1,133 @@
+#ifndef IR_DECONVOLVER_H
+#define IR_DECONVOLVER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <arm_math.h>
+#include "CoeffSource.h"
+
+// Exponential (log) sweep and its FFT deconvolution for the on-device
+// impulse response measurement. Shared by SweepSource (the AudioStream that
+// plays the sweep), IrMeasurement (capture and SD plumbing) and the host-
+// native tests - no Arduino/Audio dependencies.
+//
+// The sweep is Farina's: x[n] = sin(K (e^(n/L) - 1)), frequency rising from
+// f0 to f1 over N samples, L = N / ln(f1/f0) samples per e-fold, with K
+// chosen so the first phase step is exactly w0 - which makes it, fades
+// included, the same waveform ProbeSource plays for the delay probe. Its inverse
+// filter is the time-reversed sweep weighted by e^(n/L) (+6dB/octave, undoing
+// the sweep's pink energy spectrum), so sweep * inverse is a band-limited
+// delta and capture * inverse is the system's impulse response. Harmonic
+// distortion lands at negative lags (L ln k before the linear response),
+// outside the window kept here.
+class ExpSweep {
+public:
+  // fadeIn/fadeOut: raised-cosine ramps at each end (the fade-in over the
+  // bottom few Hz keeps the start click from exciting the whole band)
+  ExpSweep(double sampleRate, double f0, double f1, uint32_t length,
+           uint32_t fadeIn, uint32_t fadeOut);
+
+  uint32_t length() const { return n; }
+  // Samples per e-fold of frequency
+  double rate() const { return L; }
+
+  // Position at sample i. The phase is re-seeded from the closed form, then
+  // next() advances it with the exact recurrence (theta += d, d *= e^(1/L)),
+  // so any start point reproduces the same waveform a continuous run does.
+  void seek(uint32_t i);
+  // Sample at the current position (0 past the end), then advance
+  float next();
+  void fill(uint32_t start, int count, float* out);
+
+  // Magnitude of sweep * inverse filter in the passband: flat, and by
+  // stationary phase pi L / (2 w0) with w0 = 2 pi f0 / fs (rad/sample). The
+  // deconvolver divides it out so a unity system deconvolves to unity gain.
+  double inverseGain() const;
+
+private:
+  double fs, w0, L, K, r;
+  uint32_t n, fadeIn, fadeOut;
+  uint32_t pos = 0;
+  double theta = 0.0, dtheta = 0.0;
+};
+
+// Chunked overlap-save deconvolution of a captured sweep response against
+// the sweep's inverse filter, producing a window of the impulse response:
+// result sample i = h[i - pre], where h[0] is zero delay between the first
+// sweep sample played and capture sample origin (0 for a capture started
+// with the sweep; the delay probe's captures hold several chirps).
+//
+// The full linear convolution would need an FFT the size of the capture
+// (~200k points). Instead each PART-sample output block is the sum, over
+// every PART-sample partition of the inverse filter, of one 2*PART-point
+// spectral product - so the working set is five FFT_SIZE buffers (~20KB)
+// whatever the sweep length. Neither side is stored whole: the capture is
+// re-read from its source (the SD file) a partition at a time, sliding
+// backwards through it, and each inverse partition is regenerated from the
+// sweep's closed form, which is cheaper than keeping ~1MB of spectra. step()
+// does one partition product, so the caller spreads the run over as many
+// loop() passes as it likes.
+class IrDeconvolver {
+public:
+  static const int PART = 512;
+  static const int FFT_SIZE = 2 * PART;
+  // time window, FFT scratch, capture spectrum, inverse spectrum, accumulator
+  static const size_t ARENA_FLOATS = 5 * (size_t)FFT_SIZE; // 20KB
+
+  IrDeconvolver();
+
+  // Start a run. arena holds ARENA_FLOATS and stays the deconvolver's until
+  // done() or abort(). The capture is captureSamples mono int16 samples at
+  // byte dataOffset of source. length (a multiple of PART) is the result's
+  // length including the pre samples; scale multiplies the result (pass
+  // 1 / the sweep's playback gain so the IR reads as the path's own).
+  // origin is the capture sample the sweep started on.
+  void begin(const ExpSweep& sweep, float* arena, CoeffSource& source,
+             uint64_t dataOffset, uint32_t captureSamples, uint32_t pre,
+             uint32_t length, float scale, uint32_t origin = 0);
+
+  // One partition product. True when it completed an output block, which
+  // output() then holds (PART samples) until the next call.
+  bool step();
+  const float* output() const { return out; }
+
+  bool done() const { return active && block == numBlocks; }
+  // A capture read came up short: the run stops and step() returns false
+  bool failed() const { return readFailed; }
+  void abort() { active = false; }
+
+  int progressPercent() const;
+
+  // Largest |h| so far and its index in the result
+  uint32_t peakIndex() const { return peakAt; }
+  float peakValue() const { return peak; }
+
+private:
+  ExpSweep sweep;
+  CoeffSource* src = nullptr;
+  uint64_t dataOffset = 0;
+  uint32_t captureSamples = 0;
+  uint32_t firstLag = 0;   // capture*inverse index of result sample 0
+  int numParts = 0;        // inverse-filter partitions
+  int numBlocks = 0;       // result blocks
+  int block = 0;           // current result block
+  int part = 0;            // next partition of the current block
+  float gain = 1.0f;       // inverse normalization * caller scale
+  bool active = false;
+  bool readFailed = false;
+  uint32_t peakAt = 0;
+  float peak = 0.0f;
+
+  float* window = nullptr; // capture samples [k0 - (part+1)P, k0 - part*P + P)
+  float* work = nullptr;
+  float* xSpec = nullptr;
+  float* hSpec = nullptr;
+  float* acc = nullptr;
+  const float* out = nullptr;
+  arm_rfft_fast_instance_f32 rfft;
+
+  bool readCapture(int64_t start, int count, float* dst);
+  void inversePartition(int j, float* dst);
+};
+
+#endif // IR_DECONVOLVER_H
@@ -0,0 +1,229 @@
+#include "IrMeasurement.h"
+#include "SdRecorder.h"
+#include "WavFormat.h"
+
+#include <math.h>
+
+static const char* const CAPTURE_PATH = IR_MEASUREMENTS_DIR "/capture.wav";
+
+// As SdRecorder: a queue this close to its 53-block ceiling almost
+// certainly dropped blocks. A recording survives that with a glitch; a
+// capture does not - every later sample would sit at the wrong lag.
+static const int OVERRUN_WATERMARK = 45;
+
+// Deconvolution work per service() call. A step is one partition product
+// (two 1024-point FFTs) plus a 1KB card read, so this is a handful of steps
+// and loop() still turns over every couple of ms.
+static const unsigned long ANALYSIS_BUDGET_US = 2000;
+
+IrMeasurement::IrMeasurement(SweepSource& sweep, AudioRecordQueue& capture)
+    : sweepSource(sweep), queue(capture) {}
+
+const char* IrMeasurement::start(float* workArena, float amplitude, float resultScale) {
+    if (phase != IDLE) abort();
+
+    if (!SD.exists(IR_MEASUREMENTS_DIR) && !SD.mkdir(IR_MEASUREMENTS_DIR)) {
+        return "mkdir";
+    }
+    if (!nextNumberedWavName(IR_MEASUREMENTS_DIR, "ir-", name, sizeof(name))) {
+        name[0] = '\0';
+        return "full";
+    }
+
+    // Both headers carry their final sizes up front: the lengths are fixed
+    // by the IR_* contract, and a run that fails removes its files anyway
+    uint8_t header[WavFormat::HEADER_BYTES];
+    SD.remove(CAPTURE_PATH); // FILE_WRITE_BEGIN would keep a longer old tail
+    captureFile = SD.open(CAPTURE_PATH, FILE_WRITE_BEGIN);
+    WavFormat::buildHeader(header, IR_CAPTURE_SAMPLES * 2, IR_SAMPLE_RATE, 1, 16);
+    if (!captureFile || captureFile.write(header, sizeof(header)) != sizeof(header)) {
+        closeFiles(true);
+        name[0] = '\0';
+        return "create";
+    }
+    char path[48];
+    snprintf(path, sizeof(path), IR_MEASUREMENTS_DIR "/%s", name);
+    irFile = SD.open(path, FILE_WRITE_BEGIN);
+    WavFormat::buildHeader(header, IR_LENGTH * sizeof(float), IR_SAMPLE_RATE, 1, 32,
+                           WavFormat::FORMAT_IEEE_FLOAT);
+    if (!irFile || irFile.write(header, sizeof(header)) != sizeof(header)) {
+        closeFiles(true);
+        name[0] = '\0';
+        return "create";
+    }
+
+    arena = workArena;
+    amp = amplitude;
+    scale = resultScale;
+    captured = 0;
+    progressReported = 0;
+    capturedPending = false;
+    donePending = false;
+    pendingError = nullptr;
+    settleStartMs = millis();
+    phase = SETTLING;
+    return nullptr;
+}
+
+void IrMeasurement::closeFiles(bool remove) {
+    if (captureFile) captureFile.close();
+    if (irFile) irFile.close();
+    if (remove) {
+        SD.remove(CAPTURE_PATH);
+        if (name[0]) {
+            char path[48];
+            snprintf(path, sizeof(path), IR_MEASUREMENTS_DIR "/%s", name);
+            SD.remove(path);
+        }
+    }
+}
+
+void IrMeasurement::abort() {
+    if (phase == IDLE) return;
+    AudioNoInterrupts();
+    sweepSource.stop();
+    queue.end();
+    AudioInterrupts();
+    queue.clear();
+    deconv.abort();
+    closeFiles(true);
+    phase = IDLE;
+}
+
+void IrMeasurement::fail(const char* code) {
+    abort();
+    pendingError = code;
+}
+
+// Append two capture blocks as one 512-byte sector. False when a pair isn't
+// queued yet or the write failed.
+bool IrMeasurement::drainOnePair() {
+    if (queue.available() < 2) return false;
+
+    int16_t pair[AUDIO_BLOCK_SAMPLES * 2]; // 512 bytes of loop stack
+    memcpy(pair, queue.readBuffer(), AUDIO_BLOCK_SAMPLES * sizeof(int16_t));
+    queue.freeBuffer();
+    memcpy(pair + AUDIO_BLOCK_SAMPLES, queue.readBuffer(), AUDIO_BLOCK_SAMPLES * sizeof(int16_t));
+    queue.freeBuffer();
+
+    // The last pair may run past the contract length; keep only what's owed
+    uint32_t n = IR_CAPTURE_SAMPLES - captured;
+    if (n > AUDIO_BLOCK_SAMPLES * 2) n = AUDIO_BLOCK_SAMPLES * 2;
+    if (captureFile.write((const uint8_t*)pair, n * 2) != n * 2) {
+        fail("write");
+        return false;
+    }
+    captured += n;
+    return true;
+}
+
+void IrMeasurement::beginAnalysis() {
+    AudioNoInterrupts();
+    sweepSource.stop();
+    queue.end();
+    AudioInterrupts();
+    queue.clear();
+
+    // Reopen the capture for reading: the data is only certain to be on the
+    // card (and readable through the same FAT) once the write handle closes
+    captureFile.close();
+    captureFile = SD.open(CAPTURE_PATH, FILE_READ);
+    if (!captureFile) {
+        fail("read");
+        return;
+    }
+    const ExpSweep shape(IR_SAMPLE_RATE, IR_SWEEP_F0_HZ, IR_SWEEP_F1_HZ, IR_SWEEP_SAMPLES,
+                         IR_FADE_IN_SAMPLES, IR_FADE_OUT_SAMPLES);
+    deconv.begin(shape, arena, captureReader, WavFormat::HEADER_BYTES, IR_CAPTURE_SAMPLES,
+                 IR_PRE_SAMPLES, IR_LENGTH, scale);
+    capturedPending = true;
+    phase = ANALYZING;
+}
+
+void IrMeasurement::analyze() {
+    elapsedMicros budget;
+    while (budget < ANALYSIS_BUDGET_US) {
+        if (deconv.step()) {
+            const size_t bytes = IrDeconvolver::PART * sizeof(float);
+            if (irFile.write((const uint8_t*)deconv.output(), bytes) != bytes) {
+                fail("write");
+                return;
+            }
+        }
+        if (deconv.failed()) {
+            fail("read");
+            return;
+        }
+        if (deconv.done()) {
+            closeFiles(false);
+            phase = IDLE;
+            donePending = true;
+            return;
+        }
+    }
+}
+
+void IrMeasurement::service() {
+    switch (phase) {
+    case IDLE:
+        return;
+
+    case SETTLING:
+        if (millis() - settleStartMs < IR_SETTLE_MS) return;
+        // Same update for both: lag 0 of the result is "sent and captured
+        // in the same block" (see teensy_protocol.h)
+        queue.clear();
+        AudioNoInterrupts();
+        queue.begin();
+        sweepSource.start(amp);
+        AudioInterrupts();
+        phase = CAPTURING;
+        return;
+
+    case CAPTURING:
+        if (queue.available() >= OVERRUN_WATERMARK) {
+            fail("overrun");
+            return;
+        }
+        while (captured < IR_CAPTURE_SAMPLES && drainOnePair()) {}
+        if (phase != CAPTURING) return; // a write failed
+        if (captured >= IR_CAPTURE_SAMPLES) beginAnalysis();
+        return;
+
+    case ANALYZING:
+        analyze();
+        return;
+    }
+}
+
+float IrMeasurement::peakDb() const {
+    const float p = deconv.peakValue();
+    return p > 1e-10f ? 20.0f * log10f(p) : -200.0f;
+}
+
+bool IrMeasurement::consumeCaptured() {
+    if (!capturedPending) return false;
+    capturedPending = false;
+    return true;
+}
+
+int IrMeasurement::consumeProgress() {
+    if (phase != ANALYZING && !donePending) return -1;
+    const int p = donePending ? 100 : deconv.progressPercent();
+    if (p < progressReported + 10) return -1;
+    progressReported += 10;
+    return progressReported;
+}
+
+bool IrMeasurement::consumeDone() {
+    // Progress first: the reporter drains every step before DONE goes out
+    if (!donePending || progressReported < 100) return false;
+    donePending = false;
+    return true;
+}
+
+const char* IrMeasurement::consumeError() {
+    const char* e = pendingError;
+    pendingError = nullptr;
+    return e;
+}
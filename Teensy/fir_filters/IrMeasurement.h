@@ -0,0 +1,89 @@
+#ifndef IR_MEASUREMENT_H
+#define IR_MEASUREMENT_H
+
+// On-device impulse response measurement (protocol: startIrMeasure in
+// teensy_protocol.h). Sequences one run:
+//
+//   SETTLING   the sketch has soloed the output; wait IR_SETTLE_MS for the
+//              amp ramp, then start the sweep and the mic capture on the
+//              same audio block
+//   CAPTURING  drain the capture queue to IR_MEASUREMENTS_DIR/capture.wav
+//              (mono 16-bit, two blocks per 512-byte write, like SdRecorder)
+//              until IR_CAPTURE_SAMPLES are on the card
+//   ANALYZING  IrDeconvolver reads the capture back and writes the result,
+//              a block at a time, to ir-NNN.wav (mono float32) - a couple of
+//              ms of work per service() call, so loop() stays responsive
+//
+// The deconvolution's ~20KB of scratch is lent by the caller (the idle
+// per-output analyzer's arena) rather than reserved: this runs for a few
+// seconds now and then, and RAM2 has no 20KB to keep for it.
+//
+// All SD access happens in loop() context. Outcomes surface as one-shot
+// events for the sketch's reporter, like SdRecorder's.
+
+#include <Arduino.h>
+#include <Audio.h>
+#include <SD.h>
+#include "FIRLoader.h"
+#include "IrDeconvolver.h"
+#include "SweepSource.h"
+
+class IrMeasurement {
+public:
+    IrMeasurement(SweepSource& sweep, AudioRecordQueue& capture);
+
+    // Open both files and begin settling. arena holds
+    // IrDeconvolver::ARENA_FLOATS and stays ours until isActive() goes false.
+    // amplitude is the sweep's level into the chain; scale multiplies the
+    // result. Returns nullptr or a static error code: mkdir, full, create.
+    const char* start(float* arena, float amplitude, float scale);
+
+    // Stop wherever the run is and remove its files. No-op when idle.
+    void abort();
+
+    // Advance the run; call from loop().
+    void service();
+
+    bool isActive() const { return phase != IDLE; }
+    // The sweep is playing or about to: the sketch keeps the output soloed
+    bool isSounding() const { return phase == SETTLING || phase == CAPTURING; }
+    const char* fileName() const { return name; }
+    uint32_t peakIndex() const { return deconv.peakIndex(); }
+    float peakDb() const;
+
+    // One-shot events. consumeProgress() returns each 10% step once (-1 when
+    // none is due). An error has already ended the run and removed its files.
+    bool consumeCaptured();
+    int consumeProgress();
+    bool consumeDone();
+    const char* consumeError();
+
+private:
+    enum Phase { IDLE, SETTLING, CAPTURING, ANALYZING };
+
+    bool drainOnePair();
+    void beginAnalysis();
+    void analyze();
+    void fail(const char* code);
+    void closeFiles(bool remove);
+
+    SweepSource& sweepSource;
+    AudioRecordQueue& queue;
+    IrDeconvolver deconv;
+    File captureFile;
+    File irFile;
+    FIRLoader::FileSource captureReader{captureFile};
+    char name[16] = "";
+    Phase phase = IDLE;
+    float* arena = nullptr;
+    float amp = 0.0f;
+    float scale = 1.0f;
+    unsigned long settleStartMs = 0;
+    uint32_t captured = 0;
+    int progressReported = 0;
+    bool capturedPending = false;
+    bool donePending = false;
+    const char* pendingError = nullptr;
+};
+
+#endif // IR_MEASUREMENT_H
@@ -0,0 +1,268 @@
+#include "LevelLog.h"
+
+#include <math.h>
+#include <string.h>
+
+namespace LevelLog {
+
+static const size_t FLAGS_OFFSET = 8;
+static const size_t PEAK_OFFSET = 9;
+static const size_t GR_OFFSET = PEAK_OFFSET + 2;
+static const size_t BAND_OFFSET = GR_OFFSET + COMP_NUM_BANDS;
+static const size_t CHECK_OFFSET = RECORD_BYTES - 1;
+
+static void writeU16(uint8_t* p, uint16_t v) {
+  p[0] = (uint8_t)(v & 0xFF);
+  p[1] = (uint8_t)(v >> 8);
+}
+
+static void writeU32(uint8_t* p, uint32_t v) {
+  for (int i = 0; i < 4; i++) p[i] = (uint8_t)(v >> (8 * i));
+}
+
+static uint16_t readU16(const uint8_t* p) {
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t readU32(const uint8_t* p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint8_t checkByte(const uint8_t* rec) {
+  uint8_t sum = CHECK_SEED;
+  for (size_t i = 0; i < CHECK_OFFSET; i++) sum = (uint8_t)(sum + rec[i]);
+  return sum;
+}
+
+// Header fields after the magic
+static const size_t H_VERSION = 4;
+static const size_t H_RECORD_BYTES = 6;
+static const size_t H_CAPACITY = 8;
+static const size_t H_INTERVAL_MS = 12;
+static const size_t H_BANDS = 14;
+static const size_t H_GR_BANDS = 15;
+static const size_t H_BAND_K_LO = 16;
+static const size_t H_BAND_K_STEP = 17;
+
+void buildHeader(uint8_t* out, uint32_t capacity) {
+  memset(out, 0, HEADER_BYTES);
+  memcpy(out, "VYLV", 4);
+  writeU16(out + H_VERSION, VERSION);
+  writeU16(out + H_RECORD_BYTES, (uint16_t)RECORD_BYTES);
+  writeU32(out + H_CAPACITY, capacity);
+  writeU16(out + H_INTERVAL_MS, LEVEL_LOG_INTERVAL_MS);
+  out[H_BANDS] = LEVEL_LOG_BANDS;
+  out[H_GR_BANDS] = COMP_NUM_BANDS;
+  out[H_BAND_K_LO] = BAND_K_LO;
+  out[H_BAND_K_STEP] = BAND_K_STEP;
+}
+
+bool parseHeader(const uint8_t* in, uint32_t& capacity) {
+  if (memcmp(in, "VYLV", 4) != 0) return false;
+  if (readU16(in + H_VERSION) != VERSION || readU16(in + H_RECORD_BYTES) != RECORD_BYTES) return false;
+  if (readU16(in + H_INTERVAL_MS) != LEVEL_LOG_INTERVAL_MS) return false;
+  if (in[H_BANDS] != LEVEL_LOG_BANDS || in[H_GR_BANDS] != COMP_NUM_BANDS) return false;
+  if (in[H_BAND_K_LO] != BAND_K_LO || in[H_BAND_K_STEP] != BAND_K_STEP) return false;
+  const uint32_t c = readU32(in + H_CAPACITY);
+  if (c == 0 || c % RECORDS_PER_SECTOR != 0) return false;
+  capacity = c;
+  return true;
+}
+
+void pack(const Record& r, uint8_t* out) {
+  memset(out, 0, RECORD_BYTES);
+  writeU32(out, r.seq);
+  writeU32(out + 4, r.uptime);
+  out[FLAGS_OFFSET] = r.flags;
+  memcpy(out + PEAK_OFFSET, r.peak, 2);
+  memcpy(out + GR_OFFSET, r.gr, COMP_NUM_BANDS);
+  memcpy(out + BAND_OFFSET, r.band, LEVEL_LOG_BANDS);
+  out[CHECK_OFFSET] = checkByte(out);
+}
+
+bool unpack(const uint8_t* in, Record& r) {
+  if (in[CHECK_OFFSET] != checkByte(in)) return false;
+  r.seq = readU32(in);
+  r.uptime = readU32(in + 4);
+  r.flags = in[FLAGS_OFFSET];
+  memcpy(r.peak, in + PEAK_OFFSET, 2);
+  memcpy(r.gr, in + GR_OFFSET, COMP_NUM_BANDS);
+  memcpy(r.band, in + BAND_OFFSET, LEVEL_LOG_BANDS);
+  return true;
+}
+
+void pointHex(const Record& r, char* out) {
+  static const char HEX_DIGITS[] = "0123456789abcdef";
+  uint8_t rec[RECORD_BYTES];
+  pack(r, rec);
+  for (size_t i = 0; i < POINT_BYTES; i++) {
+    const uint8_t v = rec[POINT_OFFSET + i];
+    out[2 * i] = HEX_DIGITS[v >> 4];
+    out[2 * i + 1] = HEX_DIGITS[v & 0x0F];
+  }
+  out[POINT_HEX_CHARS] = '\0';
+}
+
+uint8_t powerByte(float power) {
+  const float dB = (power > 1e-10f) ? 10.0f * log10f(power) : -100.0f;
+  const int v = (int)roundf((dB + 100.0f) * 2.0f);
+  return (uint8_t)(v < 0 ? 0 : (v > 255 ? 255 : v));
+}
+
+float bytePower(uint8_t v) {
+  return powf(10.0f, (v * 0.5f - 100.0f) / 10.0f);
+}
+
+uint8_t peakByte(float peak) {
+  if (peak <= 0.001f) return 0; // below -60dBFS
+  const int v = (int)roundf((20.0f * log10f(peak) + 60.0f) * (255.0f / 60.0f));
+  return (uint8_t)(v < 0 ? 0 : (v > 255 ? 255 : v));
+}
+
+uint8_t grByte(float dB) {
+  const int v = (int)roundf(dB * 8.0f);
+  return (uint8_t)(v < 0 ? 0 : (v > 255 ? 255 : v));
+}
+
+static bool readSlot(CoeffSource& file, uint32_t slot, Record& r) {
+  uint8_t buf[RECORD_BYTES];
+  if (!file.seek(HEADER_BYTES + (uint64_t)slot * RECORD_BYTES)) return false;
+  if (file.read(buf, RECORD_BYTES) != (int)RECORD_BYTES) return false;
+  return unpack(buf, r);
+}
+
+bool findNext(CoeffSource& file, uint32_t& capacity, uint32_t& next) {
+  uint8_t header[HEADER_BYTES];
+  if (!file.seek(0) || file.read(header, HEADER_BYTES) != (int)HEADER_BYTES) return false;
+  if (!parseHeader(header, capacity)) return false;
+
+  uint64_t slots = (file.size() - HEADER_BYTES) / RECORD_BYTES;
+  if (slots > capacity) slots = capacity;
+  next = 0;
+  if (slots == 0) return true;
+
+  Record r;
+  if (!readSlot(file, 0, r) || r.seq % capacity != 0) {
+    // Slot 0 torn: nothing else was written yet, or the ring had just
+    // wrapped and its last slot holds the newest intact record
+    if (slots == capacity && readSlot(file, capacity - 1, r)) next = r.seq + 1;
+    return true;
+  }
+
+  // Slot s holds seq lap + s up to where the newest lap ends, then the
+  // lap before it (or nothing, before the first wrap). Find the first slot
+  // off slot 0's lap; a torn record counts as off it.
+  const uint32_t lap = r.seq;
+  uint32_t lo = 1, hi = (uint32_t)slots;
+  while (lo < hi) {
+    const uint32_t mid = lo + (hi - lo) / 2;
+    if (readSlot(file, mid, r) && r.seq == lap + mid) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  next = lap + lo;
+  return true;
+}
+
+Range clampRange(int32_t from, uint32_t count, uint32_t step, uint32_t first, uint32_t next) {
+  int64_t start = from < 0 ? (int64_t)next + from : (int64_t)from;
+  int64_t end = start + count;
+  if (start < first) start = first;
+  if (start > next) start = next;
+  if (end > next) end = next;
+
+  Range r;
+  r.from = (uint32_t)start;
+  r.count = end > start ? (uint32_t)(end - start) : 0;
+  r.step = step < 1 ? 1 : step;
+  const uint32_t minStep = (r.count + LEVEL_LOG_MAX_POINTS - 1) / LEVEL_LOG_MAX_POINTS;
+  if (r.step < minStep) r.step = minStep;
+  return r;
+}
+
+void Accumulator::reset() {
+  for (int j = 0; j < LEVEL_LOG_BANDS; j++) bandSum[j] = 0.0f;
+  spectra = 0;
+  peak[0] = peak[1] = 0.0f;
+  clip[0] = clip[1] = false;
+  for (int b = 0; b < COMP_NUM_BANDS; b++) gr[b] = 0.0f;
+  comp = false;
+  solo = false;
+}
+
+void Accumulator::addSpectrum(const float* power, int count, int kLo, bool fromSolo) {
+  for (int j = 0; j < LEVEL_LOG_BANDS; j++) {
+    const int centre = BAND_K_LO + BAND_K_STEP * j - kLo;
+    float sum = 0.0f;
+    for (int d = -2; d <= 2; d++) {
+      const int b = centre + d;
+      if (b < 0 || b >= count) continue;
+      sum += (d == -2 || d == 2) ? 0.5f * power[b] : power[b];
+    }
+    bandSum[j] += sum;
+  }
+  spectra++;
+  solo = solo || fromSolo;
+}
+
+void Accumulator::addPeaks(float left, float right, bool clipLeft, bool clipRight) {
+  if (left > peak[0]) peak[0] = left;
+  if (right > peak[1]) peak[1] = right;
+  clip[0] = clip[0] || clipLeft;
+  clip[1] = clip[1] || clipRight;
+}
+
+void Accumulator::addGainReduction(const float* dB, bool compOn) {
+  for (int b = 0; b < COMP_NUM_BANDS; b++) {
+    if (dB[b] > gr[b]) gr[b] = dB[b];
+  }
+  comp = comp || compOn;
+}
+
+void Accumulator::take(Record& r) {
+  r.flags = (clip[0] ? FLAG_CLIP_L : 0) | (clip[1] ? FLAG_CLIP_R : 0) |
+            (spectra > 0 ? FLAG_BANDS : 0) | (comp ? FLAG_COMP : 0) | (solo ? FLAG_SOLO : 0);
+  r.peak[0] = peakByte(peak[0]);
+  r.peak[1] = peakByte(peak[1]);
+  for (int b = 0; b < COMP_NUM_BANDS; b++) r.gr[b] = grByte(gr[b]);
+  for (int j = 0; j < LEVEL_LOG_BANDS; j++) {
+    r.band[j] = spectra > 0 ? powerByte(bandSum[j] / spectra) : 0;
+  }
+  reset();
+}
+
+void Bucket::reset() {
+  acc = Record();
+  for (int j = 0; j < LEVEL_LOG_BANDS; j++) bandSum[j] = 0.0f;
+  records = 0;
+  spectra = 0;
+}
+
+void Bucket::add(const Record& r) {
+  if (records == 0) acc.uptime = r.uptime;
+  records++;
+  acc.flags |= r.flags;
+  for (int c = 0; c < 2; c++) {
+    if (r.peak[c] > acc.peak[c]) acc.peak[c] = r.peak[c];
+  }
+  for (int b = 0; b < COMP_NUM_BANDS; b++) {
+    if (r.gr[b] > acc.gr[b]) acc.gr[b] = r.gr[b];
+  }
+  if (r.flags & FLAG_BANDS) {
+    for (int j = 0; j < LEVEL_LOG_BANDS; j++) bandSum[j] += bytePower(r.band[j]);
+    spectra++;
+  }
+}
+
+void Bucket::take(uint32_t seq, Record& out) {
+  out = acc;
+  out.seq = seq;
+  for (int j = 0; j < LEVEL_LOG_BANDS; j++) {
+    out.band[j] = spectra > 0 ? powerByte(bandSum[j] / spectra) : 0;
+  }
+  reset();
+}
+
+} // namespace LevelLog
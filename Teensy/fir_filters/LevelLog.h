@@ -0,0 +1,163 @@
+#ifndef LEVEL_LOG_H
+#define LEVEL_LOG_H
+
+// Record format and decimation for the long-term level log (protocol:
+// setLevelLog / getLevelLog in teensy_protocol.h). Pure C++ with no
+// Arduino dependencies, like WavFormat.h, so the host-native test suite
+// covers what LevelLogger puts on the card and reads back.
+//
+// File layout (LEVEL_LOG_PATH), little-endian throughout:
+//
+//   header   HEADER_BYTES (one sector): "VYLV", version, record size,
+//            capacity, interval and band layout, the rest zero
+//   records  capacity fixed slots of RECORD_BYTES; record seq lives in
+//            slot seq % capacity, so the file is a ring of the last
+//            `capacity` seconds and any record is one seek away
+//
+// Record (RECORD_BYTES):
+//
+//    0  u32 seq       records logged since the file was created
+//    4  u32 uptime    seconds since boot when the record closed
+//    8  u8  flags     FLAG_* below
+//    9  u8  peak[2]   input peak L/R over the second, scaled as a VU frame
+//   11  u8  gr[3]     largest gain reduction per compressor band, as GRM
+//   14  u8  band[31]  1/3-octave mean power over the second, as RTA
+//   45  -             reserved, zero
+//   63  u8  check     CHECK_SEED + the sum of bytes 0-62: a slot never
+//                     written, or torn by a power cut, fails it
+//
+// Eight records fill a sector and the header is one, so records are
+// appended a sector at a time without read-modify-write.
+
+#include <stddef.h>
+#include <stdint.h>
+#include "CoeffSource.h"
+#include "CompressorMath.h"
+#include "teensy_protocol.h"
+
+namespace LevelLog {
+
+static const size_t HEADER_BYTES = 512;
+static const size_t RECORD_BYTES = 64;
+static const uint32_t RECORDS_PER_SECTOR = 8;
+static const uint16_t VERSION = 1;
+static const uint8_t CHECK_SEED = 0x5A;
+
+// The reply payload: uptime through the last band (record bytes 4-44)
+static const size_t POINT_OFFSET = 4;
+static const size_t POINT_BYTES = 4 + 1 + 2 + COMP_NUM_BANDS + LEVEL_LOG_BANDS;
+static const size_t POINT_HEX_CHARS = 2 * POINT_BYTES;
+
+// 1/3-octave centres in fortieths of a decade (the RTA's band grid):
+// band j sits at 10^((BAND_K_LO + BAND_K_STEP * j) / 40), 20Hz to 20kHz
+static const int BAND_K_LO = 52;
+static const int BAND_K_STEP = 4;
+
+enum : uint8_t {
+  FLAG_CLIP_L = 0x01,
+  FLAG_CLIP_R = 0x02,
+  FLAG_BANDS = 0x04, // band[] holds a spectrum (the RTA had published)
+  FLAG_COMP = 0x08,  // the compressor was enabled
+  FLAG_GAP = 0x10,   // seconds missing before this record
+  FLAG_SOLO = 0x20,  // the RTA was tapping a soloed output, not the input
+};
+
+struct Record {
+  uint32_t seq = 0;
+  uint32_t uptime = 0;
+  uint8_t flags = 0;
+  uint8_t peak[2] = {0, 0};
+  uint8_t gr[COMP_NUM_BANDS] = {};
+  uint8_t band[LEVEL_LOG_BANDS] = {};
+};
+
+// out[HEADER_BYTES] for a ring of capacity records (a multiple of
+// RECORDS_PER_SECTOR)
+void buildHeader(uint8_t* out, uint32_t capacity);
+// The capacity of a header this firmware wrote; false for anything else
+bool parseHeader(const uint8_t* in, uint32_t& capacity);
+
+void pack(const Record& r, uint8_t* out);
+// False for a slot that was never written or was torn
+bool unpack(const uint8_t* in, Record& r);
+
+// The reply payload as POINT_HEX_CHARS lowercase hex digits plus a NUL
+void pointHex(const Record& r, char* out);
+
+static inline uint64_t slotOffset(uint32_t seq, uint32_t capacity) {
+  return HEADER_BYTES + (uint64_t)(seq % capacity) * RECORD_BYTES;
+}
+
+// Byte scales, shared with the live RTA, VU and GRM frames
+uint8_t powerByte(float power);   // (dB + 100) * 2
+float bytePower(uint8_t v);
+uint8_t peakByte(float peak);     // dBFS -60..0 onto 0..255
+uint8_t grByte(float dB);         // dB * 8
+
+// Read an existing log's capacity and the seq its next record gets: the
+// newest intact record's plus one. False if the header is not ours.
+// ~20 record reads however full the ring is (a binary search for the
+// point where the ring wrapped).
+bool findNext(CoeffSource& file, uint32_t& capacity, uint32_t& next);
+
+// The part of a getLevelLog request the log can serve: records
+// [first, next) exist. from < 0 counts back from next. step is raised so
+// the range fits in LEVEL_LOG_MAX_POINTS points.
+struct Range {
+  uint32_t from = 0;
+  uint32_t count = 0;
+  uint32_t step = 1;
+};
+Range clampRange(int32_t from, uint32_t count, uint32_t step, uint32_t first, uint32_t next);
+
+// One second's worth of meter readings, decimated into a record. Every
+// add*() may be called any number of times per second.
+class Accumulator {
+public:
+  Accumulator() { reset(); }
+  void reset();
+
+  // One published RTA spectrum: count bands of power, band b centred on
+  // 10^((kLo + b) / 40) (1/12 octave). Each 1/3-octave band sums the five
+  // finer bands around its centre, the outer two at half weight - exactly
+  // its span - and the second's bands are the mean of its spectra.
+  void addSpectrum(const float* power, int count, int kLo, bool solo);
+  // Peak meter readings (linear 0..1), max-held over the second
+  void addPeaks(float left, float right, bool clipLeft, bool clipRight);
+  // Compressor gain reduction, dB per band, max-held over the second
+  void addGainReduction(const float* dB, bool compOn);
+
+  // The second so far into r's payload fields; starts the next one
+  void take(Record& r);
+
+private:
+  float bandSum[LEVEL_LOG_BANDS];
+  int spectra;
+  float peak[2];
+  bool clip[2];
+  float gr[COMP_NUM_BANDS];
+  bool comp;
+  bool solo;
+};
+
+// Several records folded into one reply point: the same reductions as the
+// Accumulator's over a longer span
+class Bucket {
+public:
+  Bucket() { reset(); }
+  void reset();
+  void add(const Record& r);
+  bool empty() const { return records == 0; }
+  // The point, stamped with seq; resets
+  void take(uint32_t seq, Record& out);
+
+private:
+  Record acc;
+  float bandSum[LEVEL_LOG_BANDS];
+  int records;
+  int spectra;
+};
+
+} // namespace LevelLog
+
+#endif // LEVEL_LOG_H
@@ -0,0 +1,181 @@
+#include "LevelLogger.h"
+#include "FIRLoader.h"
+
+#define LEVEL_LOG_OLD_PATH LEVEL_LOG_PATH ".old"
+
+// Read the card's log into capacity/nextSeq, creating it (or replacing one
+// this firmware can't extend) when needed
+const char* LevelLogger::load() {
+    if (!SD.exists(LEVEL_LOG_DIR) && !SD.mkdir(LEVEL_LOG_DIR)) {
+        return "mkdir";
+    }
+    File f = SD.open(LEVEL_LOG_PATH, FILE_READ);
+    if (f) {
+        FIRLoader::FileSource src(f);
+        const bool ours = LevelLog::findNext(src, capacity, nextSeq);
+        f.close();
+        if (ours) return nullptr;
+        // Another layout (or not a log at all): keep it for inspection,
+        // replacing the last one set aside
+        SD.remove(LEVEL_LOG_OLD_PATH);
+        if (!SD.rename(LEVEL_LOG_PATH, LEVEL_LOG_OLD_PATH)) SD.remove(LEVEL_LOG_PATH);
+    }
+
+    capacity = LEVEL_LOG_CAPACITY;
+    nextSeq = 0;
+    uint8_t header[LevelLog::HEADER_BYTES];
+    LevelLog::buildHeader(header, capacity);
+    f = SD.open(LEVEL_LOG_PATH, FILE_WRITE_BEGIN);
+    const bool ok = f && f.write(header, sizeof(header)) == sizeof(header);
+    if (f) f.close();
+    if (!ok) {
+        SD.remove(LEVEL_LOG_PATH);
+        return "create";
+    }
+    return nullptr;
+}
+
+const char* LevelLogger::start() {
+    if (active) return nullptr; // already running: not an error
+    const char* err = load();
+    if (err != nullptr) return err;
+    stagedCount = 0;
+    pendingError = nullptr;
+    active = true;
+    return nullptr;
+}
+
+void LevelLogger::stop() {
+    if (!active) return;
+    flush();
+    active = false;
+}
+
+// Write the staged records into their slots. They are consecutive and never
+// cross a sector (the header is one, and a sector holds eight), so this is
+// at most one sector of data.
+bool LevelLogger::flush() {
+    if (stagedCount == 0) return true;
+    const size_t bytes = stagedCount * LevelLog::RECORD_BYTES;
+    File f = SD.open(LEVEL_LOG_PATH, FILE_WRITE_BEGIN);
+    const bool ok = f && f.seek(LevelLog::slotOffset(stagedFirst, capacity)) &&
+                    f.write(staged, bytes) == bytes;
+    if (f) f.close();
+    stagedCount = 0;
+    if (!ok) {
+        pendingError = "write"; // card pulled or full: stop logging
+        active = false;
+        return false;
+    }
+    bytesWritten += bytes;
+    return true;
+}
+
+bool LevelLogger::append(LevelLog::Record& r) {
+    if (!active) return false;
+    r.seq = nextSeq++;
+    if (stagedCount == 0) stagedFirst = r.seq;
+    LevelLog::pack(r, staged + stagedCount * LevelLog::RECORD_BYTES);
+    stagedCount++;
+    if (nextSeq % LevelLog::RECORDS_PER_SECTOR != 0) return false;
+    flush();
+    return true;
+}
+
+const char* LevelLogger::beginQuery(int32_t from, uint32_t count, uint32_t step) {
+    endQuery();
+    queryEndPending = false;
+    if (active) flush(); // a failure surfaces through consumeError()
+
+    queryFile = SD.open(LEVEL_LOG_PATH, FILE_READ);
+    if (!active) {
+        capacity = LEVEL_LOG_CAPACITY;
+        nextSeq = 0;
+        if (queryFile) {
+            FIRLoader::FileSource src(queryFile);
+            if (!LevelLog::findNext(src, capacity, nextSeq)) nextSeq = 0;
+        }
+    }
+    queryRange = LevelLog::clampRange(from, count, step, first(), nextSeq);
+    if (queryRange.count > 0 && !queryFile) return "read";
+
+    bucket.reset();
+    querySeq = pointFrom = queryRange.from;
+    points = 0;
+    querying = true;
+    if (queryRange.count == 0) endQuery(); // nothing to read: just END
+    return nullptr;
+}
+
+void LevelLogger::endQuery() {
+    if (queryFile) queryFile.close();
+    if (querying) queryEndPending = true;
+    querying = false;
+}
+
+bool LevelLogger::queryPoint(LevelLog::Record& point) {
+    if (!querying) return false;
+    const uint32_t end = queryRange.from + queryRange.count;
+    uint8_t buf[LevelLog::RECORDS_PER_SECTOR * LevelLog::RECORD_BYTES]; // 512 bytes of loop stack
+    uint32_t budget = QUERY_BUDGET_RECORDS;
+
+    while (budget > 0) {
+        uint32_t pointEnd = pointFrom + queryRange.step;
+        if (pointEnd > end) pointEnd = end;
+        if (querySeq >= pointEnd) {
+            const bool any = !bucket.empty();
+            if (any) bucket.take(pointFrom, point);
+            pointFrom = pointEnd;
+            if (pointFrom >= end) endQuery();
+            if (any) {
+                points++;
+                return true;
+            }
+            if (!querying) return false;
+            continue;
+        }
+
+        // Up to a sector, never past the ring's end or the point's
+        const uint32_t slot = querySeq % capacity;
+        uint32_t n = pointEnd - querySeq;
+        if (n > LevelLog::RECORDS_PER_SECTOR) n = LevelLog::RECORDS_PER_SECTOR;
+        if (n > capacity - slot) n = capacity - slot;
+        if (n > budget) n = budget;
+        const size_t bytes = n * LevelLog::RECORD_BYTES;
+        if (!queryFile.seek(LevelLog::slotOffset(querySeq, capacity)) ||
+            queryFile.read(buf, bytes) != (int)bytes) {
+            pendingError = "read";
+            endQuery();
+            return false;
+        }
+        for (uint32_t i = 0; i < n; i++) {
+            // A slot overwritten since the query started holds a newer lap
+            LevelLog::Record r;
+            if (LevelLog::unpack(buf + i * LevelLog::RECORD_BYTES, r) && r.seq == querySeq + i) {
+                bucket.add(r);
+            }
+        }
+        querySeq += n;
+        budget -= n;
+    }
+    return false;
+}
+
+bool LevelLogger::consumeQueryEnd(uint32_t& outPoints) {
+    if (!queryEndPending) return false;
+    queryEndPending = false;
+    outPoints = points;
+    return true;
+}
+
+const char* LevelLogger::consumeError() {
+    const char* e = pendingError;
+    pendingError = nullptr;
+    return e;
+}
+
+uint32_t LevelLogger::takeBytesWritten() {
+    const uint32_t b = bytesWritten;
+    bytesWritten = 0;
+    return b;
+}
@@ -0,0 +1,96 @@
+#ifndef LEVEL_LOGGER_H
+#define LEVEL_LOGGER_H
+
+// The long-term level log's card side (protocol: setLevelLog / getLevelLog
+// in teensy_protocol.h; format and decimation in LevelLog.h). The sketch
+// decimates the meters into one LevelLog::Record a second and hands it to
+// append(); this numbers it and writes it into the ring file.
+//
+// Records are staged in a one-sector buffer and written when the sector
+// fills - every eight seconds, ~64 bytes/s - each time through an open,
+// one write and a close, so between writes no file is open and no card
+// transfer is in flight. A power cut costs at most the staged seconds; the
+// torn or missing tail is found and overwritten on the next start.
+//
+// A range read (beginQuery/queryPoint) walks the ring through its own read
+// handle, a bounded number of records per call, folding them into reply
+// points with LevelLog::Bucket.
+//
+// All SD access happens in loop() context, like every other card user in
+// this firmware.
+
+#include <Arduino.h>
+#include <SD.h>
+#include "LevelLog.h"
+
+class LevelLogger {
+public:
+    // Open the log - created on first use; a file in another format is set
+    // aside as LEVEL_LOG_PATH ".old" - and resume numbering after its newest
+    // intact record. Returns nullptr or a static error code: mkdir, create.
+    const char* start();
+
+    // Write out the staged records and stop. No-op when idle.
+    void stop();
+
+    bool isActive() const { return active; }
+
+    // Number r (its seq) and stage it. True when this wrote a sector to the
+    // card. A failed write stops the logger and surfaces via consumeError().
+    bool append(LevelLog::Record& r);
+
+    // Records [first(), next()) are in the log. Valid while active and
+    // after beginQuery().
+    uint32_t first() const { return nextSeq > capacity ? nextSeq - capacity : 0; }
+    uint32_t next() const { return nextSeq; }
+
+    // Start serving a getLevelLog request (staged records are written out
+    // first). A missing or foreign file reads as an empty log. Returns
+    // nullptr or a static error code: read. range() is what will be served.
+    const char* beginQuery(int32_t from, uint32_t count, uint32_t step);
+    const LevelLog::Range& range() const { return queryRange; }
+    bool queryActive() const { return querying; }
+
+    // Advance the query by at most QUERY_BUDGET_RECORDS records. True with
+    // point filled when a point is complete; points without one readable
+    // record are skipped.
+    bool queryPoint(LevelLog::Record& point);
+
+    // One-shot events: the query finished (with the points it produced), or
+    // a write/read failed - a write failure has stopped the logger, a read
+    // failure ended the query.
+    bool consumeQueryEnd(uint32_t& points);
+    const char* consumeError();
+
+    // Record bytes written since the previous call (for STATS)
+    uint32_t takeBytesWritten();
+
+private:
+    // Records read per queryPoint() call: 4KB, a few ms of card time
+    static const uint32_t QUERY_BUDGET_RECORDS = 64;
+
+    const char* load();
+    bool flush();
+    void endQuery();
+
+    bool active = false;
+    uint32_t capacity = LEVEL_LOG_CAPACITY;
+    uint32_t nextSeq = 0;
+    uint8_t staged[LevelLog::RECORDS_PER_SECTOR * LevelLog::RECORD_BYTES];
+    uint32_t stagedCount = 0;
+    uint32_t stagedFirst = 0;
+    uint32_t bytesWritten = 0;
+
+    File queryFile;
+    bool querying = false;
+    LevelLog::Range queryRange;
+    LevelLog::Bucket bucket;
+    uint32_t querySeq = 0;   // next record to read
+    uint32_t pointFrom = 0;  // first record of the point being folded
+    uint32_t points = 0;
+    bool queryEndPending = false;
+
+    const char* pendingError = nullptr;
+};
+
+#endif // LEVEL_LOGGER_H
@@ -0,0 +1,173 @@
+#include "LoudnessEq.h"
+
+#include <math.h>
+
+static const PEQBand OFF_BAND = {1000.0f, 0.0f, 1.0f, false};
+
+// Geometric for frequency and Q (both live on log axes); linear when a
+// corrupt non-positive value would make that meaningless
+static inline float geo(float a, float b, float t) {
+  if (a <= 0.0f || b <= 0.0f) return a + (b - a) * t;
+  return a * powf(b / a, t);
+}
+
+static inline bool sameBand(const PEQBand& a, const PEQBand& b) {
+  return a.frequency == b.frequency && a.gain == b.gain && a.q == b.q && a.enabled == b.enabled;
+}
+
+LoudnessEq::Coeffs::Coeffs() {
+  for (int i = 0; i < MAX_PEQ_BANDS; i++) {
+    // No real band has a negative frequency: the first computeCoeffs()
+    // fills every band
+    bands[i] = {-1.0f, 0.0f, 1.0f, false};
+    svf[i] = {0.0f, 0.0f, 0.0f, 0.0f};
+    active[i] = false;
+  }
+}
+
+LoudnessEq::LoudnessEq() {
+  for (int s = 0; s < SETS; s++) {
+    setSpl[s] = s == 0 ? 0 : UNUSED;
+    for (int i = 0; i < MAX_PEQ_BANDS; i++) sets[s][i] = OFF_BAND;
+  }
+}
+
+void LoudnessEq::setBand(int set, int band, const PEQBand& b) {
+  if (set < 0 || set >= SETS || band < 0 || band >= MAX_PEQ_BANDS) return;
+  sets[set][band] = b;
+  dirty = true;
+  boostValid = false;
+}
+
+void LoudnessEq::resetBands(int set, int fromBand) {
+  if (set < 0 || set >= SETS) return;
+  if (fromBand < 0) fromBand = 0;
+  for (int i = fromBand; i < MAX_PEQ_BANDS; i++) sets[set][i] = OFF_BAND;
+  dirty = true;
+  boostValid = false;
+}
+
+void LoudnessEq::setLevels(float refSpl, const int* spl, int count) {
+  ref = refSpl;
+  for (int s = 0; s < SETS; s++) setSpl[s] = s < count && spl[s] >= 0 ? spl[s] : UNUSED;
+  // A new reference moves the level track() picks up next
+  dirty = true;
+  boostValid = false;
+}
+
+int LoudnessEq::activeSets() const {
+  int n = 0;
+  for (int s = 0; s < SETS; s++) {
+    if (setSpl[s] != UNUSED) n++;
+  }
+  return n;
+}
+
+float LoudnessEq::levelFor(float volumeGain) const {
+  const float g = volumeGain > MIN_GAIN ? volumeGain : MIN_GAIN;
+  return ref + 20.0f * log10f(g);
+}
+
+bool LoudnessEq::track(float volumeGain) {
+  const int s = (int)roundf(levelFor(volumeGain) / LEVEL_STEP_DB);
+  if (s != step) {
+    step = s;
+    current = s * LEVEL_STEP_DB;
+    dirty = true;
+  }
+  return dirty;
+}
+
+void LoudnessEq::bracket(float level, int& lo, int& hi, float& t) const {
+  lo = -1;
+  hi = -1;
+  for (int s = 0; s < SETS; s++) {
+    const int k = setSpl[s];
+    if (k == UNUSED) continue;
+    if (k <= level && (lo < 0 || k > setSpl[lo])) lo = s;
+    if (k >= level && (hi < 0 || k < setSpl[hi])) hi = s;
+  }
+  t = 0.0f;
+  if (lo < 0) {
+    lo = hi; // below every set: the lowest one
+  } else if (hi < 0) {
+    hi = lo; // above every set: the highest one
+  } else if (setSpl[hi] > setSpl[lo]) {
+    t = (level - setSpl[lo]) / (float)(setSpl[hi] - setSpl[lo]);
+  }
+}
+
+void LoudnessEq::curveAt(float level, PEQBand* out) const {
+  int lo, hi;
+  float t;
+  bracket(level, lo, hi, t);
+  if (lo < 0) {
+    for (int i = 0; i < MAX_PEQ_BANDS; i++) out[i] = OFF_BAND;
+    return;
+  }
+  if (t == 0.0f || lo == hi) {
+    for (int i = 0; i < MAX_PEQ_BANDS; i++) out[i] = sets[lo][i];
+    return;
+  }
+  for (int i = 0; i < MAX_PEQ_BANDS; i++) {
+    PEQBand a = sets[lo][i];
+    PEQBand b = sets[hi][i];
+    if (!a.enabled && !b.enabled) {
+      out[i] = a;
+      continue;
+    }
+    // A band only one set uses grows out of (or shrinks into) 0dB in place
+    if (!a.enabled) a = {b.frequency, 0.0f, b.q, true};
+    if (!b.enabled) b = {a.frequency, 0.0f, a.q, true};
+    out[i].frequency = geo(a.frequency, b.frequency, t);
+    out[i].q = geo(a.q, b.q, t);
+    out[i].gain = a.gain + (b.gain - a.gain) * t;
+    out[i].enabled = true;
+  }
+}
+
+int LoudnessEq::computeCoeffs(float sampleRate, Coeffs& c) {
+  PEQBand target[MAX_PEQ_BANDS];
+  curve(target);
+  dirty = false;
+  int changed = 0;
+  for (int i = 0; i < MAX_PEQ_BANDS; i++) {
+    if (sameBand(target[i], c.bands[i])) continue;
+    c.bands[i] = target[i];
+    c.active[i] = target[i].enabled && target[i].gain != 0.0f;
+    if (c.active[i]) {
+      c.svf[i] = peqComputeBellSvf(target[i].frequency, target[i].gain, target[i].q, sampleRate);
+    }
+    changed++;
+  }
+  return changed;
+}
+
+float LoudnessEq::maxBoostDb() {
+  if (boostValid) return boostDb;
+  int order[SETS];
+  int n = 0;
+  for (int s = 0; s < SETS; s++) {
+    if (setSpl[s] == UNUSED) continue;
+    // Insertion sort by level (three slots at most)
+    int at = n++;
+    while (at > 0 && setSpl[order[at - 1]] > setSpl[s]) {
+      order[at] = order[at - 1];
+      at--;
+    }
+    order[at] = s;
+  }
+
+  float maxBoost = 0.0f;
+  PEQBand bandsAt[MAX_PEQ_BANDS];
+  for (int c = 0; c < 2 * n - 1; c++) {
+    const int a = setSpl[order[c / 2]];
+    const int b = setSpl[order[(c + 1) / 2]];
+    curveAt(0.5f * (a + b), bandsAt);
+    const float boost = peqMaxBoostDb(bandsAt, MAX_PEQ_BANDS);
+    if (boost > maxBoost) maxBoost = boost;
+  }
+  boostDb = maxBoost;
+  boostValid = true;
+  return maxBoost;
+}
@@ -0,0 +1,101 @@
+#ifndef LOUDNESS_EQ_H
+#define LOUDNESS_EQ_H
+
+// The shared input EQ's SPL sets and the curve between them, shared by the
+// sketch (on the Teensy) and the host-native test suite - no Arduino/Audio
+// dependencies.
+//
+// The ESP stores up to SETS curves per preset, each for a listening level
+// (its spl, dB SPL). All of them live here, and the curve that plays is
+// interpolated band by band between the two sets whose levels bracket the
+// current one - frequency and Q geometrically, gain linearly - and held at
+// the outermost set past either end. A band enabled in only one of the two
+// fades in from 0dB at the same frequency and Q. The listening level
+// follows the master volume: refSpl at full volume, less the volume's gain
+// in dB. With one set (the usual spl 0 preference curve) it plays at every
+// volume, exactly as before the sets reached the Teensy.
+//
+// Following the volume is loop() work: track() quantizes the level to
+// LEVEL_STEP_DB and reports whether it moved, and computeCoeffs()
+// recomputes only the bands whose interpolated parameters changed. The
+// sketch then copies the result into both PEQ processors in one
+// AudioNoInterrupts section (PEQProcessor::loadCoeffs), so a volume sweep
+// costs the audio interrupt one short copy per step and the UART nothing
+// beyond the setVolume commands themselves.
+
+#include "PEQMath.h"
+
+class LoudnessEq {
+public:
+  static const int SETS = 3;          // must match MAX_PEQ_SETS on the ESP
+  static const int UNUSED = -1;       // a set slot's spl when it holds no curve
+  static constexpr float LEVEL_STEP_DB = 0.25f;
+  static constexpr float DEFAULT_REF_SPL = 100.0f;
+  // Below this the level is "silent" and stays put (volume 0)
+  static constexpr float MIN_GAIN = 1e-5f; // -100dB
+
+  // The curve the processors are loaded with, and the coefficients for it
+  struct Coeffs {
+    PEQBand bands[MAX_PEQ_BANDS];
+    PeqSvfCoeffs svf[MAX_PEQ_BANDS];
+    bool active[MAX_PEQ_BANDS]; // enabled and not 0dB
+    Coeffs();
+  };
+
+  // Slot 0 in use at spl 0 with every band off, the others unused
+  LoudnessEq();
+
+  // --- set editing (loop side) ---
+
+  void setBand(int set, int band, const PEQBand& b);
+  // Disable bands fromBand.. of one set
+  void resetBands(int set, int fromBand);
+  // Every slot's level (UNUSED frees one; missing slots are freed) and the
+  // level full volume plays at
+  void setLevels(float refSpl, const int* spl, int count);
+
+  int spl(int set) const { return setSpl[set]; }
+  float refSpl() const { return ref; }
+  const PEQBand* bands(int set) const { return sets[set]; }
+  int activeSets() const;
+
+  // --- following the volume ---
+
+  // Listening level for a master gain (linear, after the volume curve)
+  float levelFor(float volumeGain) const;
+  // Move to the level volumeGain plays at, in LEVEL_STEP_DB steps. True when
+  // the curve may have changed since the last computeCoeffs() (a step, or
+  // an edit to the sets).
+  bool track(float volumeGain);
+  float level() const { return current; }
+
+  // The curve at a level / at the tracked level
+  void curveAt(float level, PEQBand* out) const;
+  void curve(PEQBand* out) const { curveAt(current, out); }
+
+  // Bring c up to the curve at the tracked level, recomputing only the
+  // bands that changed. Returns how many were recomputed.
+  int computeCoeffs(float sampleRate, Coeffs& c);
+
+  // Largest boost (dB) the curve reaches at any level, sampled at each set
+  // and halfway between neighbours - a pre-EQ pad sized once for the whole
+  // volume range, rather than stepping with it. Cached until the next edit,
+  // so re-applying the pad (bypass toggles, volume steps) costs nothing.
+  float maxBoostDb();
+
+private:
+  // The sets bracketing a level: lo/hi slots (-1 when none) and how far
+  // from lo to hi it sits
+  void bracket(float level, int& lo, int& hi, float& t) const;
+
+  PEQBand sets[SETS][MAX_PEQ_BANDS];
+  int setSpl[SETS];
+  float ref = DEFAULT_REF_SPL;
+  float current = 0.0f;
+  int step = 0;
+  bool dirty = true;
+  float boostDb = 0.0f;
+  bool boostValid = false;
+};
+
+#endif // LOUDNESS_EQ_H
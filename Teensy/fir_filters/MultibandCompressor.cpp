@@ -9,7 +9,7 @@
 #define COMP_DUCK_RELEASE_MS 200.0f
 
 MultibandCompressor::MultibandCompressor()
-  : AudioStream(2, inputQueueArray), sampleRate(44100.0f),
+  : AudioStreamF32(2, inputQueueArray, floatQueueArray), sampleRate(44100.0f),
     enabled(false), solo(-1), voiceDuckDb(0.0f) {
   xoverFreq[0] = 250.0f;
   xoverFreq[1] = 4000.0f;
@@ -125,28 +125,18 @@ static inline float runBranchLp(const XoverBranch& br, XoverSectionState* st, fl
 }
 
 void MultibandCompressor::update(void) {
-  audio_block_t* in[2] = { receiveReadOnly(0), receiveReadOnly(1) };
-
-  if (!enabled) {
-    for (int ch = 0; ch < 2; ch++) {
-      if (in[ch]) {
-        transmit(in[ch], ch);
-        release(in[ch]);
-      }
-    }
+  if (!enabled || !bandBuf) {
+    for (int ch = 0; ch < 2; ch++) passThrough(ch, ch);
     return;
   }
-  if (!bandBuf) return;
+  audio_block_f32_t* in[2] = { receiveF32(0), receiveF32(1) };
 
   // Pass 1: split both channels into bands, tracking the block peak per band
   float peak[COMP_NUM_BANDS] = {0.0f, 0.0f, 0.0f};
   for (int ch = 0; ch < 2; ch++) {
-    float inBuf[AUDIO_BLOCK_SAMPLES];
-    if (in[ch]) {
-      arm_q15_to_float(in[ch]->data, inBuf, AUDIO_BLOCK_SAMPLES);
-    } else {
-      memset(inBuf, 0, sizeof(inBuf));
-    }
+    float silence[AUDIO_BLOCK_SAMPLES];
+    if (!in[ch]) memset(silence, 0, sizeof(silence));
+    const float* inBuf = in[ch] ? in[ch]->data : silence;
     float* bands = bandBuf + ch * COMP_NUM_BANDS * AUDIO_BLOCK_SAMPLES;
     for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) {
       const float x = inBuf[i];
@@ -181,13 +171,13 @@ void MultibandCompressor::update(void) {
   compComputeTargets(params, envDb, voiceDuckDb, targetGain, grNow);
 
   // Pass 2: ramp gains per sample and recombine
-  audio_block_t* out[2] = { allocate(), allocate() };
+  audio_block_f32_t* out[2] = { allocateF32(), allocateF32() };
   const int soloBand = solo;
   for (int ch = 0; ch < 2; ch++) {
     if (!out[ch]) continue;
     const float* bands = bandBuf + ch * COMP_NUM_BANDS * AUDIO_BLOCK_SAMPLES;
     float g[COMP_NUM_BANDS] = { gain[0], gain[1], gain[2] };
-    float outBuf[AUDIO_BLOCK_SAMPLES];
+    float* outBuf = out[ch]->data;
     for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) {
       float acc = 0.0f;
       for (int b = 0; b < COMP_NUM_BANDS; b++) {
@@ -204,7 +194,6 @@ void MultibandCompressor::update(void) {
     if (ch == 1) {
       for (int b = 0; b < COMP_NUM_BANDS; b++) gain[b] = g[b];
     }
-    arm_float_to_q15(outBuf, out[ch]->data, AUDIO_BLOCK_SAMPLES);
   }
 
   // Report the reduction actually applied (smoothed gain vs scaled makeup)
@@ -216,10 +205,10 @@ void MultibandCompressor::update(void) {
   }
 
   for (int ch = 0; ch < 2; ch++) {
-    if (in[ch]) release(in[ch]);
+    if (in[ch]) releaseF32(in[ch]);
     if (out[ch]) {
-      transmit(out[ch], ch);
-      release(out[ch]);
+      transmitF32(out[ch], ch);
+      releaseF32(out[ch]);
     }
   }
 }
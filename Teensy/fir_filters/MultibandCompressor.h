@@ -6,6 +6,7 @@
 #include <arm_math.h>
 #include "CrossoverMath.h"
 #include "CompressorMath.h"
+#include "AudioStreamF32.h"
 
 // Stereo-linked 3-band compressor for the mixed input bus. Sits between the
 // shared input EQ and the eight output source mixers, so every output hears
@@ -21,7 +22,9 @@
 // control: the static curve computes a target gain every 128 samples and a
 // per-sample one-pole ramps toward it at the band's attack/release rate.
 // Bypass lives inside the object - disabled, blocks pass through untouched.
-class MultibandCompressor : public AudioStream {
+// Takes the input EQ's float blocks (AudioStreamF32) and sends int16 to the
+// output source mixers.
+class MultibandCompressor : public AudioStreamF32 {
 public:
   MultibandCompressor();
   ~MultibandCompressor();
@@ -54,6 +57,7 @@ private:
   void resetGains();
 
   audio_block_t* inputQueueArray[2];
+  audio_block_f32_t* floatQueueArray[2];
   float sampleRate;
 
   volatile bool enabled;
@@ -0,0 +1,62 @@
+#include "OutputGainStage.h"
+
+OutputGainStage::OutputGainStage()
+    : AudioStream(CHANNELS, inputQueueArray), sched(AUDIO_SAMPLE_RATE_EXACT) {
+    for (int ch = 0; ch < CHANNELS; ch++) limiter[ch].begin(AUDIO_SAMPLE_RATE_EXACT);
+}
+
+bool OutputGainStage::schedule(const GainSchedule::Change& c) {
+    AudioNoInterrupts();
+    const bool queued = sched.schedule(c);
+    AudioInterrupts();
+    return queued;
+}
+
+void OutputGainStage::setOverride(int ch, bool active, float gain) {
+    if (ch < 0 || ch >= CHANNELS) return;
+    if (overrideOn[ch] == active && (!active || overrideGain[ch] == gain)) return;
+    overrideOn[ch] = active;
+    overrideGain[ch] = gain;
+    AudioNoInterrupts();
+    sched.setOverride(ch, active, gain);
+    AudioInterrupts();
+}
+
+float OutputGainStage::takeLimiterReductionDb(int ch) {
+    if (ch < 0 || ch >= CHANNELS) return 0.0f;
+    AudioNoInterrupts();
+    const float g = limiter[ch].takeMinGain();
+    AudioInterrupts();
+    return g > 0.0f ? -20.0f * log10f(g) : 120.0f;
+}
+
+void OutputGainStage::update() {
+    float scaled[AUDIO_BLOCK_SAMPLES];
+    sched.beginBlock(AUDIO_BLOCK_SAMPLES);
+    for (int ch = 0; ch < CHANNELS; ch++) {
+        audio_block_t* in = receiveReadOnly(ch);
+        float gain;
+        const bool steady = sched.steady(ch, gain);
+        const bool silent = in == nullptr || (steady && gain == 0.0f);
+        if (silent) {
+            if (!steady) sched.process(ch, nullptr, nullptr); // only the ramp moves
+        } else {
+            sched.processFloat(ch, in->data, scaled);
+        }
+        if (in != nullptr) release(in);
+        // Silence into a drained limiter: nothing to send
+        if (silent && limiter[ch].idle()) {
+            limiter[ch].process(nullptr, nullptr, AUDIO_BLOCK_SAMPLES);
+            continue;
+        }
+
+        audio_block_t* out = allocate();
+        // Pool exhausted: still run the block, so the delay stays on time
+        limiter[ch].process(silent ? nullptr : scaled, out != nullptr ? out->data : nullptr,
+                            AUDIO_BLOCK_SAMPLES);
+        if (out == nullptr) continue;
+        transmit(out, ch);
+        release(out);
+    }
+    sched.endBlock();
+}
@@ -0,0 +1,61 @@
+#ifndef OUTPUT_GAIN_STAGE_H
+#define OUTPUT_GAIN_STAGE_H
+
+// The last stage of all eight output chains: master volume, mute, and each
+// output's gain and polarity, in one AudioStream so a change that touches
+// several outputs lands on all of them in the same block. Replaces a bank of
+// AudioAmplifiers whose gains loop() used to slew on millis().
+//
+// Parameter changes go through schedule() with a due time on the audio
+// sample clock (clock(); "@<sample>" command stamps, see teensy_protocol.h)
+// and are applied at exactly that sample inside update(), where each
+// output's gain also ramps per sample (GainSchedule.h).
+//
+// Each output then goes through its own TruePeakLimiter, fed the scaled
+// samples before they are saturated, so a gain boost is limited rather than
+// clipped and no output leaves above the ceiling. Every output is delayed by
+// the same TruePeakLimiter::LATENCY, which keeps them aligned (applyDelays
+// counts it). A silent output costs nothing once its limiter
+// has drained.
+
+#include <Arduino.h>
+#include <Audio.h>
+#include "GainSchedule.h"
+#include "TruePeakLimiter.h"
+
+class OutputGainStage : public AudioStream {
+public:
+    static const int CHANNELS = GainSchedule::CHANNELS;
+
+    OutputGainStage();
+
+    // Queue a change (loop context). due is a sample on clock(); pass
+    // clock() for "at the next block". Returns false if the queue was full
+    // and it was applied at once.
+    bool schedule(const GainSchedule::Change& c);
+
+    // Hold an output at a fixed gain instead of its parameters (config hold,
+    // delay probe, IR sweep, solo), or release it (loop context). Cheap to
+    // call every loop() pass: only a change touches the audio side.
+    void setOverride(int ch, bool active, float gain);
+
+    // Sample number of the next block's first sample. Counts from boot and
+    // wraps every ~27h.
+    uint32_t clock() const { return sched.clock(); }
+    // Gain an output is at right now (for diagnostics)
+    float gain(int ch) const { return sched.gain(ch); }
+    // Deepest limiter gain reduction on an output since the previous call,
+    // in dB (>= 0)
+    float takeLimiterReductionDb(int ch);
+
+    virtual void update() override;
+
+private:
+    audio_block_t* inputQueueArray[CHANNELS];
+    GainSchedule::Scheduler sched;
+    TruePeakLimiter limiter[CHANNELS];
+    bool overrideOn[CHANNELS] = {true, true, true, true, true, true, true, true};
+    float overrideGain[CHANNELS] = {};
+};
+
+#endif // OUTPUT_GAIN_STAGE_H
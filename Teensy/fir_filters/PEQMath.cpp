@@ -48,3 +48,120 @@ float calculateBellFilter(float freq, float centerFreq, float gain, float q) {
   float den = c + db * db;
   return 10.0f * log10f(num / den);
 }
+
+// --- Maximum boost search ---
+
+// One band's power response, |H|^2 = (c + na*u) / (c + da*u) with
+// u = (f/f0)^2 and c = (1 - u)^2: calculateBellFilter without the powf and
+// log10f, which only depend on the band
+struct BellPower {
+  float invF0;
+  float na; // (A/Q)^2
+  float da; // (1/(A*Q))^2
+};
+
+static const int MAX_BOOST_GRID = 100;         // the 100-point sweep this replaced
+static const float MAX_BOOST_REFINE_DB = 3.0f; // brackets this close to the best get refined
+static const int MAX_BOOST_BISECT_STEPS = 14;  // a tenth of an octave / 2^14
+static const float LOG2_20HZ = 4.321928f;      // log2(20)
+static const float LOG2_20KHZ = 14.287712f;    // log2(20000)
+static const float MAX_BOOST_GRID_STEP = (LOG2_20KHZ - LOG2_20HZ) / (MAX_BOOST_GRID - 1);
+static const int MAX_BOOST_CANDIDATES = MAX_BOOST_GRID + 3 * MAX_PEQ_BANDS;
+
+static inline void addCandidate(float* x, int& nx, float xc) {
+  if (xc > LOG2_20HZ && xc < LOG2_20KHZ) x[nx++] = xc;
+}
+
+// Summed power response at x = log2(freq), as a power ratio, and its slope
+// along x (d(ln p)/dx, without the constant 2*ln2 - only the sign is used)
+static float bellPowerAt(const BellPower* b, int n, float x, float* slope) {
+  float f = exp2f(x);
+  float p = 1.0f;
+  float s = 0.0f;
+  for (int i = 0; i < n; i++) {
+    float o = f * b[i].invF0;
+    float u = o * o;
+    float v = 1.0f - u;
+    float c = v * v;
+    float num = c + b[i].na * u;
+    float den = c + b[i].da * u;
+    // One division for both: num/den, and d(ln|H|^2)/du = num'/num - den'/den
+    // times u for a common axis (du/dx = 2*ln2*u)
+    float r = 1.0f / (num * den);
+    p *= num * num * r;
+    s += u * ((b[i].na - 2.0f * v) * den - (b[i].da - 2.0f * v) * num) * r;
+  }
+  *slope = s;
+  return p;
+}
+
+float peqMaxBoostDb(const PEQBand* bands, int numBands) {
+  BellPower b[MAX_PEQ_BANDS];
+  float x[MAX_BOOST_CANDIDATES];
+  int n = 0;
+  int nx = 0;
+  for (int i = 0; i < numBands && n < MAX_PEQ_BANDS; i++) {
+    const PEQBand& band = bands[i];
+    // Same early-outs as calculateBellFilter
+    if (!band.enabled || band.gain == 0.0f || band.q <= 0.0f || band.frequency <= 0.0f) continue;
+    float A = powf(10.0f, band.gain / 40.0f);
+    float na = A / band.q;
+    float da = 1.0f / (A * band.q);
+    b[n++] = {1.0f / band.frequency, na * na, da * da};
+    // Every center is a candidate, and so are its flanks, half the bell's
+    // 1.44/Q octave bandwidth each way: where bells interact the curve
+    // turns on their scale, not the grid's, and two turns sharing one gap
+    // between candidates would hide a peak from the slope test below
+    float xc = log2f(band.frequency);
+    float half = 0.72f / band.q;
+    addCandidate(x, nx, xc);
+    addCandidate(x, nx, xc - half);
+    addCandidate(x, nx, xc + half);
+  }
+  if (n == 0) return 0.0f;
+
+  for (int k = 0; k < MAX_BOOST_GRID; k++) {
+    x[nx++] = LOG2_20HZ + MAX_BOOST_GRID_STEP * k;
+  }
+  // Insertion sort (145 candidates at most)
+  for (int i = 1; i < nx; i++) {
+    float v = x[i];
+    int j = i;
+    while (j > 0 && x[j - 1] > v) {
+      x[j] = x[j - 1];
+      j--;
+    }
+    x[j] = v;
+  }
+
+  float p[MAX_BOOST_CANDIDATES];
+  float slope[MAX_BOOST_CANDIDATES];
+  float best = 0.0f;
+  for (int i = 0; i < nx; i++) {
+    p[i] = bellPowerAt(b, n, x[i], &slope[i]);
+    if (p[i] > best) best = p[i];
+  }
+
+  // A maximum lies wherever the slope turns from rising to falling between
+  // neighbouring candidates - even when both samples sit below a third one,
+  // as with two close peaks. Bisect on the slope's sign for each bracket
+  // that could still beat the best sample.
+  const float refineFloor = best * powf(10.0f, -MAX_BOOST_REFINE_DB / 10.0f);
+  for (int i = 0; i + 1 < nx; i++) {
+    if (!(slope[i] > 0.0f && slope[i + 1] < 0.0f)) continue;
+    if (p[i] < refineFloor && p[i + 1] < refineFloor) continue;
+    float lo = x[i];
+    float hi = x[i + 1];
+    for (int k = 0; k < MAX_BOOST_BISECT_STEPS; k++) {
+      float mid = 0.5f * (lo + hi);
+      float s;
+      bellPowerAt(b, n, mid, &s);
+      if (s > 0.0f) lo = mid;
+      else hi = mid;
+    }
+    float s;
+    float peak = bellPowerAt(b, n, 0.5f * (lo + hi), &s);
+    if (peak > best) best = peak;
+  }
+  return best > 1.0f ? 10.0f * log10f(best) : 0.0f;
+}
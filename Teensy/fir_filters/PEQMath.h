@@ -5,6 +5,17 @@
 // the Teensy) and the host-native test suite - no Arduino/Audio
 // dependencies.
 
+// Must match MAX_PEQ_POINTS on the ESP and the point limit in the WebUI
+#define MAX_PEQ_BANDS 15
+
+// PEQ Band structure
+struct PEQBand {
+  float frequency;
+  float gain;
+  float q;
+  bool enabled;
+};
+
 // Cytomic/Simper trapezoidal SVF bell coefficients (see PEQProcessor.cpp for
 // the filter loop that consumes them).
 struct PeqSvfCoeffs {
@@ -23,4 +34,15 @@ PeqSvfCoeffs peqComputeBellSvf(float frequency, float gain, float q, float sampl
 // see, what is compensated for, and what you hear all agree.
 float calculateBellFilter(float freq, float centerFreq, float gain, float q);
 
+// Largest boost (dB) of the summed response of numBands bands between 20Hz
+// and 20kHz - the headroom a pre-EQ pad has to give; 0 when the curve only
+// cuts. Disabled bands are skipped. The candidates are the 100 log-spaced
+// points the pad used to be sampled at plus every band's center and flanks,
+// and each maximum between two of them is found by bisecting on the
+// analytic slope: never below the old sweep, within hundredths of a dB of
+// the true peak where the sweep fell between points, and several times
+// cheaper - the bands multiply in linear power, with one log10 per search
+// instead of one powf and log10f per band per point.
+float peqMaxBoostDb(const PEQBand* bands, int numBands);
+
 #endif // PEQ_MATH_H
@@ -1,7 +1,7 @@
 #include "PEQProcessor.h"
 #include <math.h>
 
-PEQProcessor::PEQProcessor() : AudioStream(1, inputQueue),
+PEQProcessor::PEQProcessor() : AudioStreamF32(1, inputQueue, floatQueue),
                                sampleRate(44100.0f), initialized(false), bypassed(false) {
   for (int i = 0; i < MAX_PEQ_BANDS; i++) {
     bands[i] = {1000.0f, 0.0f, 1.0f, false};
@@ -100,24 +100,9 @@ int PEQProcessor::getActiveBandCount() const {
   return count;
 }
 
+// Peak of the summed response, 20Hz to 20kHz (see peqMaxBoostDb)
 float PEQProcessor::calculateMaxEqBoost(const PEQBand* currentBands, int numBands) const {
-  float maxBoost = 0.0f;
-  // Sample the summed response logarithmically from 20Hz to 20kHz. Cascaded
-  // filters multiply in linear gain, so their dB responses add.
-  const int numSamples = 100;
-  for (int i = 0; i < numSamples; ++i) {
-    float freq = 20.0f * powf(1000.0f, (float)i / (numSamples - 1)); // 20Hz .. 20kHz
-    float currentTotalGain = 0.0f;
-    for (int j = 0; j < numBands; j++) {
-      if (currentBands[j].enabled) {
-        currentTotalGain += calculateBellFilter(freq, currentBands[j].frequency, currentBands[j].gain, currentBands[j].q);
-      }
-    }
-    if (currentTotalGain > maxBoost) {
-      maxBoost = currentTotalGain;
-    }
-  }
-  return maxBoost;
+  return peqMaxBoostDb(currentBands, numBands);
 }
 
 void PEQProcessor::applyPreEQGain(float maxBoost, AudioAmplifier& leftAmp, AudioAmplifier& rightAmp) {
@@ -168,6 +153,27 @@ void PEQProcessor::updateFilter(int bandIndex) {
   f.active = true;
 }
 
+bool PEQProcessor::loadCoeffs(const PEQBand* newBands, const PeqSvfCoeffs* coeffs, const bool* active) {
+  if (!initialized || animation.active) return false;
+  for (int i = 0; i < MAX_PEQ_BANDS; i++) {
+    bands[i] = newBands[i];
+    SVFBand& f = svf[i];
+    if (active[i] != f.active) {
+      // Starting or stopping: from silent integrators, as updateFilter does
+      f.ic1eq = 0.0f;
+      f.ic2eq = 0.0f;
+    }
+    if (active[i]) {
+      f.a1 = coeffs[i].a1;
+      f.a2 = coeffs[i].a2;
+      f.a3 = coeffs[i].a3;
+      f.m1 = coeffs[i].m1;
+    }
+    f.active = active[i];
+  }
+  return true;
+}
+
 void PEQProcessor::processBand(int bandIndex, float32_t* buffer, int numSamples) {
   SVFBand& f = svf[bandIndex];
   float a1 = f.a1, a2 = f.a2, a3 = f.a3, m1 = f.m1;
@@ -302,18 +308,14 @@ void PEQProcessor::toggleBypass() {
 void PEQProcessor::update(void) {
   updateAnimationState();
 
-  audio_block_t *block = receiveReadOnly();
-  if (!block) return;
-
   if (bypassed) {
-    transmit(block);
-    release(block);
+    passThrough(0, 0);
     return;
   }
 
-  float32_t float_buffer[AUDIO_BLOCK_SAMPLES];
-  arm_q15_to_float(block->data, float_buffer, AUDIO_BLOCK_SAMPLES);
-  release(block);
+  audio_block_f32_t *block = receiveWritableF32();
+  if (!block) return;
+  float32_t *float_buffer = block->data;
 
   // Cascade all active bands
   for (int i = 0; i < MAX_PEQ_BANDS; i++) {
@@ -322,15 +324,8 @@ void PEQProcessor::update(void) {
     }
   }
 
-  audio_block_t *output_block = allocate();
-  if (!output_block) {
-    return;
-  }
-
-  arm_float_to_q15(float_buffer, output_block->data, AUDIO_BLOCK_SAMPLES);
-
-  transmit(output_block);
-  release(output_block);
+  transmitF32(block);
+  releaseF32(block);
 }
 
 // calculateBellFilter (the exact bell magnitude response used for gain
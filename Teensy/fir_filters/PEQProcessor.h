@@ -6,22 +6,12 @@
 #include <arm_math.h>
 #include <Audio.h>
 #include "PEQMath.h"
+#include "AudioStreamF32.h"
 
 #ifndef PI
 #define PI 3.14159265359f
 #endif
 
-// Must match MAX_PEQ_POINTS on the ESP and the point limit in the WebUI
-#define MAX_PEQ_BANDS 15
-
-// PEQ Band structure
-struct PEQBand {
-  float frequency;
-  float gain;
-  float q;
-  bool enabled;
-};
-
 // Animation structure (used for smooth morphs between EQ curves)
 struct AnimationState {
   bool active;
@@ -36,7 +26,9 @@ struct AnimationState {
 // the Cytomic/Simper trapezoidal state-variable filter, which matches the
 // standard RBJ bell response exactly and stays numerically well-behaved in
 // float32 all the way down to 20Hz - so one topology serves all bands.
-class PEQProcessor : public AudioStream {
+// Float in and out (AudioStreamF32), so a boost is carried past full scale
+// to the next float stage instead of clipping here.
+class PEQProcessor : public AudioStreamF32 {
 public:
   PEQProcessor();
 
@@ -56,6 +48,13 @@ public:
   float calculateMaxEqBoost(const PEQBand* currentBands, int numBands) const;
   void applyPreEQGain(float maxBoost, AudioAmplifier& leftAmp, AudioAmplifier& rightAmp);
 
+  // Swap in a whole curve computed in loop() context (LoudnessEq): the
+  // bands and their ready-made coefficients, active = enabled and not 0dB.
+  // No locking of its own - the caller holds AudioNoInterrupts, so both
+  // channels change in the same block. False, changing nothing, while a
+  // morph is running.
+  bool loadCoeffs(const PEQBand* newBands, const PeqSvfCoeffs* coeffs, const bool* active);
+
   // Animation (smooth morph between curves)
   void animateToBands(const PEQBand* targetBands, int numBands, unsigned long durationMs = 50);
   void setAnimationSpeed(unsigned long durationMs);
@@ -81,6 +80,7 @@ private:
   };
 
   audio_block_t *inputQueue[1];
+  audio_block_f32_t *floatQueue[1];
   float sampleRate;
   bool initialized;
   bool bypassed;
@@ -0,0 +1,189 @@
+#include "ProbeCapture.h"
+#include "WavFormat.h"
+#include "teensy_protocol.h"
+
+#include <math.h>
+
+// As IrMeasurement: a dropped block would put every later chirp at the
+// wrong lag, so a queue this close to its ceiling ends the run
+static const int OVERRUN_WATERMARK = 45;
+
+// Correlation work per service() call, as IrMeasurement's deconvolution
+static const unsigned long ANALYSIS_BUDGET_US = 2000;
+
+ProbeCapture::ProbeCapture(AudioRecordQueue& capture) : queue(capture) {}
+
+const char* ProbeCapture::start(float* workArena, int nChirps, float resultScale) {
+    if (phase != IDLE) abort();
+
+    if (!SD.exists(IR_MEASUREMENTS_DIR) && !SD.mkdir(IR_MEASUREMENTS_DIR)) {
+        return "mkdir";
+    }
+    // The sequence's length is fixed by the PROBE_* contract and the chirp
+    // count, so the header carries the final size up front
+    total = PROBE_PRE_ROLL_SAMPLES + (uint32_t)(nChirps - 1) * PROBE_SPACING_SAMPLES
+            + PROBE_CHIRP_SAMPLES + PROBE_TAIL_SAMPLES;
+    uint8_t header[WavFormat::HEADER_BYTES];
+    SD.remove(PROBE_CAPTURE_PATH); // FILE_WRITE_BEGIN would keep a longer old tail
+    captureFile = SD.open(PROBE_CAPTURE_PATH, FILE_WRITE_BEGIN);
+    WavFormat::buildHeader(header, total * 2, PROBE_SAMPLE_RATE, 1, 16);
+    if (!captureFile || captureFile.write(header, sizeof(header)) != sizeof(header)) {
+        if (captureFile) captureFile.close();
+        SD.remove(PROBE_CAPTURE_PATH);
+        return "create";
+    }
+
+    arena = workArena;
+    scale = resultScale;
+    chirps = nChirps;
+    slot = 0;
+    captured = 0;
+    resultPending = false;
+    analyzedPending = false;
+    pendingError = nullptr;
+    queue.clear();
+    phase = CAPTURING;
+    return nullptr;
+}
+
+void ProbeCapture::beginCapture() {
+    if (phase == CAPTURING) queue.begin();
+}
+
+void ProbeCapture::abort() {
+    if (phase == IDLE) return;
+    AudioNoInterrupts();
+    queue.end();
+    AudioInterrupts();
+    queue.clear();
+    deconv.abort();
+    if (captureFile) captureFile.close();
+    SD.remove(PROBE_CAPTURE_PATH);
+    resultPending = false;
+    phase = IDLE;
+}
+
+void ProbeCapture::fail(const char* code) {
+    abort();
+    pendingError = code;
+}
+
+// Append two capture blocks as one 512-byte sector (as IrMeasurement)
+bool ProbeCapture::drainOnePair() {
+    if (queue.available() < 2) return false;
+
+    int16_t pair[AUDIO_BLOCK_SAMPLES * 2]; // 512 bytes of loop stack
+    memcpy(pair, queue.readBuffer(), AUDIO_BLOCK_SAMPLES * sizeof(int16_t));
+    queue.freeBuffer();
+    memcpy(pair + AUDIO_BLOCK_SAMPLES, queue.readBuffer(), AUDIO_BLOCK_SAMPLES * sizeof(int16_t));
+    queue.freeBuffer();
+
+    uint32_t n = total - captured;
+    if (n > AUDIO_BLOCK_SAMPLES * 2) n = AUDIO_BLOCK_SAMPLES * 2;
+    if (captureFile.write((const uint8_t*)pair, n * 2) != n * 2) {
+        fail("write");
+        return false;
+    }
+    captured += n;
+    return true;
+}
+
+void ProbeCapture::beginAnalysis() {
+    AudioNoInterrupts();
+    queue.end();
+    AudioInterrupts();
+    queue.clear();
+
+    // Reopen for reading once the write handle has closed (as IrMeasurement)
+    captureFile.close();
+    captureFile = SD.open(PROBE_CAPTURE_PATH, FILE_READ);
+    if (!captureFile) {
+        fail("read");
+        return;
+    }
+    slot = 0;
+    phase = ANALYZING;
+    beginSlot();
+}
+
+// Correlate the window around chirp slot's scheduled start: lag 0 of the
+// result is "heard on the sample it was played"
+void ProbeCapture::beginSlot() {
+    const ExpSweep chirp(PROBE_SAMPLE_RATE, PROBE_F0_HZ, PROBE_F1_HZ, PROBE_CHIRP_SAMPLES,
+                         PROBE_FADE_SAMPLES, PROBE_FADE_SAMPLES);
+    const uint32_t start = PROBE_PRE_ROLL_SAMPLES + (uint32_t)slot * PROBE_SPACING_SAMPLES;
+    deconv.begin(chirp, arena, captureReader, WavFormat::HEADER_BYTES, total,
+                 PROBE_LAG_PRE_SAMPLES, PROBE_LAG_WINDOW_SAMPLES, scale, start);
+    picker.begin(PROBE_LAG_PRE_SAMPLES, PROBE_LAG_WINDOW_SAMPLES);
+}
+
+void ProbeCapture::analyze() {
+    elapsedMicros budget;
+    while (budget < ANALYSIS_BUDGET_US) {
+        if (deconv.step()) picker.push(deconv.output(), IrDeconvolver::PART);
+        if (deconv.failed()) {
+            fail("read");
+            return;
+        }
+        if (deconv.done()) {
+            resultPending = true;
+            return;
+        }
+    }
+}
+
+void ProbeCapture::service() {
+    switch (phase) {
+    case IDLE:
+        return;
+
+    case CAPTURING:
+        if (queue.available() >= OVERRUN_WATERMARK) {
+            fail("overrun");
+            return;
+        }
+        while (captured < total && drainOnePair()) {}
+        if (phase != CAPTURING) return; // a write failed
+        if (captured >= total) beginAnalysis();
+        return;
+
+    case ANALYZING:
+        // Hold each slot's picker until the reporter has read it
+        if (resultPending) return;
+        if (deconv.done()) {
+            if (++slot < chirps) {
+                beginSlot();
+            } else {
+                captureFile.close(); // kept on the card for inspection
+                phase = IDLE;
+                analyzedPending = true;
+            }
+            return;
+        }
+        analyze();
+        return;
+    }
+}
+
+bool ProbeCapture::consumeResult(int& outSlot, double& lag, float& peakDb, float& confidence) {
+    if (!resultPending) return false;
+    resultPending = false;
+    outSlot = slot;
+    lag = picker.lag();
+    const float p = picker.peak();
+    peakDb = p > 1e-10f ? 20.0f * log10f(p) : -200.0f;
+    confidence = picker.confidence();
+    return true;
+}
+
+bool ProbeCapture::consumeAnalyzed() {
+    if (!analyzedPending) return false;
+    analyzedPending = false;
+    return true;
+}
+
+const char* ProbeCapture::consumeError() {
+    const char* e = pendingError;
+    pendingError = nullptr;
+    return e;
+}
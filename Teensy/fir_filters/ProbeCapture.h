@@ -0,0 +1,89 @@
+#ifndef PROBE_CAPTURE_H
+#define PROBE_CAPTURE_H
+
+// On-device arrival analysis for the auto delay alignment probe (protocol:
+// startDelayProbe ... mic in teensy_protocol.h). The sketch runs the chirp
+// sequence as always; this records the measurement mic alongside it and
+// then measures every chirp's arrival:
+//
+//   CAPTURING  drain the mic queue to PROBE_CAPTURE_PATH (mono 16-bit, two
+//              blocks per 512-byte write, as IrMeasurement) until the whole
+//              sequence is on the card. The queue is started in the same
+//              audio update as ProbeSource, so capture sample n is probe
+//              sample n and every chirp's scheduled start is known exactly.
+//   ANALYZING  one slot at a time: IrDeconvolver cross-correlates the
+//              slot's window against the chirp (its inverse filter, so the
+//              result is the path's impulse response) and ArrivalPicker
+//              reads off the sub-sample arrival lag - a couple of ms of work
+//              per service() call, ~50ms per slot
+//
+// Scratch is lent by the caller (the per-output analyzer's arena), exactly
+// as for IrMeasurement; the two never run at once and share the mic queue.
+//
+// All SD access happens in loop() context. Outcomes surface as one-shot
+// events for the sketch's reporter, like IrMeasurement's.
+
+#include <Arduino.h>
+#include <Audio.h>
+#include <SD.h>
+#include "ArrivalPicker.h"
+#include "FIRLoader.h"
+#include "IrDeconvolver.h"
+
+class ProbeCapture {
+public:
+    explicit ProbeCapture(AudioRecordQueue& capture);
+
+    // Create the capture file for an nChirps sequence. arena holds
+    // IrDeconvolver::ARENA_FLOATS and stays ours until isActive() goes
+    // false; scale multiplies the responses (1 / the chirp's drive). Returns
+    // nullptr or a static error code: mkdir, create. The capture itself
+    // waits for beginCapture().
+    const char* start(float* arena, int nChirps, float scale);
+
+    // Start recording. Call inside the same AudioNoInterrupts() section as
+    // ProbeSource::start(), so both begin on the same update.
+    void beginCapture();
+
+    // Stop wherever the run is and remove the capture. No-op when idle.
+    void abort();
+
+    // Advance the run; call from loop().
+    void service();
+
+    bool isActive() const { return phase != IDLE; }
+
+    // One-shot events. consumeResult() hands out each slot's arrival once,
+    // in slot order; consumeAnalyzed() follows the last of them. An error
+    // has already ended the run and removed the capture.
+    bool consumeResult(int& slot, double& lag, float& peakDb, float& confidence);
+    bool consumeAnalyzed();
+    const char* consumeError();
+
+private:
+    enum Phase { IDLE, CAPTURING, ANALYZING };
+
+    bool drainOnePair();
+    void beginAnalysis();
+    void beginSlot();
+    void analyze();
+    void fail(const char* code);
+
+    AudioRecordQueue& queue;
+    IrDeconvolver deconv;
+    ArrivalPicker picker;
+    File captureFile;
+    FIRLoader::FileSource captureReader{captureFile};
+    Phase phase = IDLE;
+    float* arena = nullptr;
+    float scale = 1.0f;
+    int chirps = 0;
+    int slot = 0;
+    uint32_t total = 0;      // capture length: the whole sequence
+    uint32_t captured = 0;
+    bool resultPending = false;
+    bool analyzedPending = false;
+    const char* pendingError = nullptr;
+};
+
+#endif // PROBE_CAPTURE_H
@@ -0,0 +1,49 @@
+#include "RtaAnalyzer.h"
+
+// The working memory is a fixed static, not a heap allocation: it
+// lives for the life of the device anyway, and an unchecked new here is
+// exactly how the analyzer once crashed the DSP - the static FIR arena
+// tightened the RAM2 heap, one of RtaFFT4096's constructor allocations
+// quietly returned nullptr at static-init, and the first analyze() stored
+// through it (DACCVIOL at 0x0, loud buzz until the auto-reboot). Static
+// reservation makes the RTA's memory a link-time fact instead of a boot-
+// order gamble. One RTA instance exists (fir_filters.ino). It sits in RAM1
+// (~35KB) since the SPDIF input moved to the slim resampler, leaving RAM2
+// to the FIR pool.
+static float rtaArena[RtaMultiRes::ARENA_FLOATS];
+
+RtaAnalyzer::RtaAnalyzer()
+  : AudioStreamF32(1, inputQueueArray, floatQueueArray),
+    core(AUDIO_SAMPLE_RATE_EXACT, rtaArena)
+{
+}
+
+void RtaAnalyzer::update(void) {
+  audio_block_f32_t* linked = receiveLinkedF32();
+  if (linked) {
+    core.push(linked->data, AUDIO_BLOCK_SAMPLES);
+    releaseF32(linked);
+    return;
+  }
+  audio_block_t* block = receiveReadOnly();
+  if (!block) return;
+  core.push(block->data, AUDIO_BLOCK_SAMPLES);
+  release(block);
+}
+
+bool RtaAnalyzer::service() {
+  const int s = core.segmentDue();
+  if (s < 0) return false;
+  // Only the copy races update(); the FFT runs with audio live
+  AudioNoInterrupts();
+  core.snapshot(s);
+  AudioInterrupts();
+  core.transform(s);
+  return true;
+}
+
+void RtaAnalyzer::reset() {
+  AudioNoInterrupts();
+  core.reset();
+  AudioInterrupts();
+}
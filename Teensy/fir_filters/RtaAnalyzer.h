@@ -0,0 +1,59 @@
+#ifndef RTA_ANALYZER_H
+#define RTA_ANALYZER_H
+
+#include <Audio.h>
+#include "RtaMultiRes.h"
+#include "AudioStreamF32.h"
+
+// Spectrum tap for the RTA: the AudioStream face of RtaMultiRes (see there
+// for the decimated multi-resolution scheme and the Welch averaging).
+// Replaced RtaFFT4096, whose single 4096-point transform had 10.77Hz bins -
+// still coarse for the 1/12-octave bands at 20-60Hz where room modes live -
+// and which dropped every block that arrived while a finished capture
+// waited for loop().
+//
+// The audio ISR only decimates and appends (update() feeds each 128-sample
+// block to the stage rings, ~1k multiply-adds). The FFTs run in loop
+// context, one due segment per service() call, each snapshot taken with the
+// audio interrupt briefly masked; a frame then only publishes the averages.
+// It takes int16 (the input scope's mixer) or a float link (a soloed
+// output's crossover - see AudioStreamF32), so a driver's post-EQ level is
+// read past full scale rather than clipped.
+class RtaAnalyzer : public AudioStreamF32 {
+public:
+  RtaAnalyzer();
+
+  virtual void update(void) override;
+
+  // Build the sparse band table (setup, before streaming starts)
+  bool setBands(const float* lo, const float* hi, int count) {
+    return core.setBands(lo, hi, count);
+  }
+
+  // Analyze one due segment, if any. Call on every loop pass while the RTA
+  // is streaming; stage 0 falls due every ~11.6ms.
+  bool service();
+
+  // True once every stage has analyzed a segment since the last reset()
+  bool available() const { return core.ready(); }
+
+  // Fold the segments analyzed since the previous frame into the band
+  // levels (see RtaMultiRes::publish)
+  void publish() { core.publish(); }
+
+  // Drop all history, e.g. when the tap is rewired to another source, so
+  // no frame mixes the old signal into the slow stages' long windows.
+  void reset();
+
+  // Published power of band b. A full-scale sine reads ~1.0, matching
+  // AudioAnalyzeFFT1024's read() normalization so the dB scale on the wire
+  // stays comparable.
+  float bandPower(int band) const { return core.bandPower(band); }
+
+private:
+  audio_block_t* inputQueueArray[1];
+  audio_block_f32_t* floatQueueArray[1];
+  RtaMultiRes core;
+};
+
+#endif // RTA_ANALYZER_H
@@ -0,0 +1,180 @@
+#include "RtaBank.h"
+#include "RtaFftTables.h"
+
+#include <math.h>
+#include <new>
+#include <string.h>
+
+RtaBank::RtaBank(float sampleRate, float* arena) : fs(sampleRate), base(arena) {
+  // Hand-built instance over our PROGMEM tables (see RtaMultiRes)
+  rfft.Sint.fftLen = FFT_SIZE / 2;
+  rfft.Sint.pTwiddle = (const float32_t*)rtaTwiddleCoef256Bits;
+  rfft.Sint.pBitRevTable = rtaBitRevIndexTable256;
+  rfft.Sint.bitRevLength = 440; // ARMBITREVINDEXTABLE_256_TABLE_LENGTH
+  rfft.fftLenRFFT = FFT_SIZE;
+  rfft.pTwiddleRFFT = (float32_t*)rtaTwiddleCoefRfft512Bits;
+
+  rebuild();
+}
+
+// Everything that lives in the arena: carve it, then lay down the window
+// and fresh decimators. The band table is in there too, so it is dropped.
+void RtaBank::rebuild() {
+  float* p = base;
+  for (int ch = 0; ch < RTA_BANK_CHANNELS; ch++) {
+    for (int s = 0; s < RTA_STAGES; s++) {
+      ring[ch][s] = (int16_t*)p;
+      p += FFT_SIZE / 2;
+    }
+  }
+  window = p;   p += FFT_SIZE;
+  work = p;     p += FFT_SIZE;
+  spectrum = p; p += FFT_SIZE;
+  for (int ch = 0; ch < RTA_BANK_CHANNELS; ch++) { bandAccum[ch] = p; p += RTA_MAX_BANDS; }
+  weights = p;  p += RTA_BANK_MAX_BAND_WEIGHTS;
+  for (int ch = 0; ch < RTA_BANK_CHANNELS; ch++) {
+    decim[ch] = (RtaHalfBand*)p;
+    for (int d = 0; d < 2 * (RTA_STAGES - 1); d++) new (&decim[ch][d]) RtaHalfBand();
+    p += 2 * (RTA_STAGES - 1) * sizeof(RtaHalfBand) / sizeof(float);
+  }
+
+  // As RtaMultiRes, plus the int16 -> float conversion the rings defer
+  const float scale = 4.0f / (float)FFT_SIZE / 32768.0f;
+  for (int i = 0; i < FFT_SIZE; i++) {
+    window[i] = (0.5f - 0.5f * cosf(2.0f * (float)M_PI * i / (FFT_SIZE - 1))) * scale;
+  }
+
+  numBands = 0;
+  numWeights = 0;
+  reset();
+}
+
+bool RtaBank::setBands(const float* lo, const float* hi, int count) {
+  return rtaBuildBandTable(fs, FFT_SIZE, lo, hi, count, spans, RTA_MAX_BANDS,
+                           weights, RTA_BANK_MAX_BAND_WEIGHTS, numBands, numWeights);
+}
+
+void RtaBank::reset() {
+  for (int ch = 0; ch < RTA_BANK_CHANNELS; ch++) {
+    for (int s = 0; s < RTA_STAGES; s++) {
+      memset(ring[ch][s], 0, FFT_SIZE * sizeof(int16_t));
+      head[ch][s] = 0;
+      fill[ch][s] = 0;
+      pending[ch][s] = 0;
+      segments[ch][s] = 0;
+      stale[ch][s] = false;
+    }
+    memset(bandAccum[ch], 0, RTA_MAX_BANDS * sizeof(float));
+    for (int d = 0; d < 2 * (RTA_STAGES - 1); d++) decim[ch][d].reset();
+  }
+  cursor = SLOTS - 1;
+}
+
+void RtaBank::write(int ch, int stage, const float* x, int n) {
+  int16_t* r = ring[ch][stage];
+  int h = head[ch][stage];
+  for (int i = 0; i < n; i++) {
+    // The decimators can ring slightly past full scale on clipped input
+    const float v = x[i];
+    r[h] = (v >= 32767.0f) ? 32767 : (v <= -32768.0f) ? -32768 : (int16_t)lrintf(v);
+    h = (h + 1) & (FFT_SIZE - 1);
+  }
+  head[ch][stage] = (uint16_t)h;
+  int f = fill[ch][stage] + n;
+  fill[ch][stage] = (uint16_t)((f > FFT_SIZE) ? FFT_SIZE : f);
+  int q = pending[ch][stage] + n;
+  pending[ch][stage] = (uint16_t)((q > FFT_SIZE) ? FFT_SIZE : q);
+}
+
+void RtaBank::push(int ch, const int16_t* samples, int n) {
+  if (ch < 0 || ch >= RTA_BANK_CHANNELS) return;
+  if (n > RtaHalfBand::MAX_BLOCK) n = RtaHalfBand::MAX_BLOCK;
+  n &= ~15;
+  // The cascade runs in int16 units so the rings need no rescaling
+  float a[RtaHalfBand::MAX_BLOCK];
+  float b[RtaHalfBand::MAX_BLOCK / 2];
+  for (int i = 0; i < n; i++) a[i] = (float)samples[i];
+  write(ch, 0, a, n);
+
+  RtaHalfBand* d = decim[ch];
+  for (int s = 1; s < RTA_STAGES; s++) {
+    d[2 * s - 2].process(a, n, b);
+    d[2 * s - 1].process(b, n / 2, a);
+    n /= 4;
+    write(ch, s, a, n);
+  }
+}
+
+bool RtaBank::nextDue(int& ch, int& stage) {
+  for (int i = 1; i <= SLOTS; i++) {
+    const int slot = (cursor + i) % SLOTS;
+    const int c = slot / RTA_STAGES;
+    const int s = slot % RTA_STAGES;
+    if (fill[c][s] == FFT_SIZE && pending[c][s] >= HOP) {
+      cursor = slot;
+      ch = c;
+      stage = s;
+      return true;
+    }
+  }
+  return false;
+}
+
+void RtaBank::snapshot(int ch, int stage) {
+  const int16_t* r = ring[ch][stage];
+  const int h = head[ch][stage]; // oldest sample
+  for (int i = 0; i < FFT_SIZE; i++) {
+    work[i] = (float)r[(h + i) & (FFT_SIZE - 1)] * window[i];
+  }
+  pending[ch][stage] = 0;
+}
+
+void RtaBank::transform(int ch, int stage) {
+  arm_rfft_fast_f32(&rfft, work, spectrum, 0);
+
+  // Power in place over the packed re/im pairs (DC's slot holds DC alone;
+  // bands never read it or the Nyquist bin)
+  float* power = spectrum;
+  power[0] = spectrum[0] * spectrum[0];
+  for (int i = 1; i < NUM_BINS; i++) {
+    const float re = spectrum[2 * i];
+    const float im = spectrum[2 * i + 1];
+    power[i] = re * re + im * im;
+  }
+
+  float* acc = bandAccum[ch];
+  const bool restart = stale[ch][stage];
+  for (int b = 0; b < numBands; b++) {
+    const RtaBandSpan& span = spans[b];
+    if (span.stage != stage) continue;
+    const float* p = power + span.firstBin;
+    const float* w = weights + span.offset;
+    float sum = 0.0f;
+    for (int i = 0; i < span.bins; i++) sum += p[i] * w[i];
+    acc[b] = restart ? sum : acc[b] + sum;
+  }
+  if (restart) {
+    segments[ch][stage] = 0;
+    stale[ch][stage] = false;
+  }
+  if (segments[ch][stage] < UINT16_MAX) segments[ch][stage]++;
+}
+
+bool RtaBank::ready(int ch) const {
+  for (int s = 0; s < RTA_STAGES; s++) {
+    if (segments[ch][s] == 0) return false;
+  }
+  return true;
+}
+
+bool RtaBank::publish(int ch, float* out) {
+  if (ch < 0 || ch >= RTA_BANK_CHANNELS || !ready(ch)) return false;
+  float scale[RTA_STAGES];
+  for (int s = 0; s < RTA_STAGES; s++) {
+    scale[s] = 1.0f / (float)segments[ch][s];
+    stale[ch][s] = true;
+  }
+  const float* acc = bandAccum[ch];
+  for (int b = 0; b < numBands; b++) out[b] = acc[b] * scale[spans[b].stage];
+  return true;
+}
@@ -0,0 +1,117 @@
+#ifndef RTA_BANK_H
+#define RTA_BANK_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <arm_math.h>
+#include "RtaMultiRes.h"
+
+// Per-output spectrum core: RtaMultiRes's decimated three-stage analysis
+// run on every output plus the input mix at once, for the web UI's
+// per-driver spectra. Shared by RtaBankAnalyzer (the AudioStream tap) and
+// the host-native tests - no Arduino/Audio dependencies.
+//
+// Nine channels of RtaMultiRes would cost ~315KB; this trims the same
+// scheme to fit beside firArena:
+//
+//   - 512-point FFTs instead of 1024 (86Hz / 21.5Hz / 5.4Hz bins on the
+//     three stages - still 2x the old single-FFT resolution in the bass)
+//   - int16 rings (the signals are int16 audio blocks to begin with)
+//   - one window, FFT scratch and band-weight table for all channels
+//   - band accumulators instead of per-bin ones: each segment's power is
+//     folded into the bands as soon as it is transformed
+//
+// leaving ~45KB of arena for all nine channels (ARENA_FLOATS).
+//
+// FFTs are time-multiplexed: nextDue() walks a round-robin cursor over the
+// 27 (channel, stage) slots, so every channel and every stage gets its
+// turn however few segments the caller's CPU budget allows. Segments that
+// fall due faster than they are serviced are dropped (the ring just
+// advances), thinning the Welch average instead of queueing work.
+#define RTA_BANK_CHANNELS 9     // outputs 0-7, then the input mix
+#define RTA_BANK_INPUT_MIX 8
+// The 121-band set needs 563 weight entries at 512 points
+#define RTA_BANK_MAX_BAND_WEIGHTS 640
+
+class RtaBank {
+public:
+  static const int FFT_SIZE = 512;
+  static const int NUM_BINS = FFT_SIZE / 2; // 256
+  static const int HOP = FFT_SIZE / 2;      // 50% overlap
+  static const int SLOTS = RTA_BANK_CHANNELS * RTA_STAGES;
+  // Floats of caller-provided working memory: int16 rings (two samples per
+  // float), window/work/spectrum, band accumulators, the band weights and
+  // the decimators - 11320 floats, ~45KB.
+  static const size_t ARENA_FLOATS =
+      (size_t)SLOTS * FFT_SIZE / 2
+      + 3 * (size_t)FFT_SIZE
+      + (size_t)RTA_BANK_CHANNELS * RTA_MAX_BANDS
+      + RTA_BANK_MAX_BAND_WEIGHTS
+      + (size_t)RTA_BANK_CHANNELS * 2 * (RTA_STAGES - 1) * sizeof(RtaHalfBand) / sizeof(float);
+
+  // arena must hold ARENA_FLOATS and outlive the instance
+  RtaBank(float sampleRate, float* arena);
+
+  // Same contract as RtaMultiRes::setBands, at this bank's FFT size
+  bool setBands(const float* lo, const float* hi, int count);
+  int bandCount() const { return numBands; }
+  int bandWeightCount() const { return numWeights; }
+
+  // Forget all history; the caller serializes against push()
+  void reset();
+
+  // Re-initialize the arena after another user has borrowed it (see
+  // RtaBankAnalyzer::lendArena): window, decimators and history. The band
+  // table lived there too, so bandCount() is 0 until setBands() again.
+  void rebuild();
+
+  // Feed n samples of channel ch (same n rules as RtaMultiRes::push)
+  void push(int ch, const int16_t* samples, int n);
+
+  // The next (channel, stage) with a segment due after the last one
+  // handed out, round-robin; false if none. snapshot() copies it (the only
+  // read of what push() writes), transform() runs the FFT and folds the
+  // segment's power into that channel's band accumulators.
+  bool nextDue(int& ch, int& stage);
+  void snapshot(int ch, int stage);
+  void transform(int ch, int stage);
+
+  // True once every stage of ch has contributed a segment since reset
+  bool ready(int ch) const;
+
+  // Write ch's band powers (bandCount() values) averaged over the segments
+  // since its previous publish. A stage with no new segment re-reports its
+  // last average. False, writing nothing, until ready(ch).
+  bool publish(int ch, float* out);
+
+  int stageFor(float lo, float hi) const { return rtaStageFor(fs, FFT_SIZE, lo, hi); }
+  float sampleRate(int stage) const { return fs / (float)(1 << (2 * stage)); }
+  float binWidthHz(int stage) const { return sampleRate(stage) / (float)FFT_SIZE; }
+
+private:
+  float fs;
+  float* base;
+  int16_t* ring[RTA_BANK_CHANNELS][RTA_STAGES];
+  float* window;   // Hanning, with int16 and FFT scaling folded in
+  float* work;
+  float* spectrum;
+  float* bandAccum[RTA_BANK_CHANNELS];
+  float* weights;
+  RtaHalfBand* decim[RTA_BANK_CHANNELS]; // 2 * (RTA_STAGES - 1) each
+  RtaBandSpan spans[RTA_MAX_BANDS];
+  int numBands = 0;
+  int numWeights = 0;
+  volatile uint16_t head[RTA_BANK_CHANNELS][RTA_STAGES];
+  volatile uint16_t fill[RTA_BANK_CHANNELS][RTA_STAGES];
+  volatile uint16_t pending[RTA_BANK_CHANNELS][RTA_STAGES];
+  uint16_t segments[RTA_BANK_CHANNELS][RTA_STAGES];
+  // Published since the stage's last segment: the next segment restarts
+  // the average rather than adding to the one already reported
+  bool stale[RTA_BANK_CHANNELS][RTA_STAGES];
+  int cursor = SLOTS - 1;
+  arm_rfft_fast_instance_f32 rfft;
+
+  void write(int ch, int stage, const float* x, int n);
+};
+
+#endif // RTA_BANK_H
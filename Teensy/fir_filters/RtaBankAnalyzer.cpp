@@ -0,0 +1,63 @@
+#include "RtaBankAnalyzer.h"
+
+// Fixed RAM1 reservation, like the RTA's own arena (see RtaAnalyzer.cpp
+// for why these are never heap allocations and why RAM1); ~45KB. One
+// instance exists.
+static float rtaBankArena[RtaBank::ARENA_FLOATS];
+
+RtaBankAnalyzer::RtaBankAnalyzer()
+  : AudioStream(RTA_BANK_CHANNELS, inputQueueArray),
+    core(AUDIO_SAMPLE_RATE_EXACT, rtaBankArena)
+{
+}
+
+void RtaBankAnalyzer::update(void) {
+  // A muted output (amp gain 0) transmits no block at all; feed it silence
+  // so its trace drops to the floor instead of freezing on the last frame
+  static const int16_t silence[AUDIO_BLOCK_SAMPLES] = {0};
+  for (int ch = 0; ch < RTA_BANK_CHANNELS; ch++) {
+    audio_block_t* block = receiveReadOnly(ch);
+    if (running) core.push(ch, block ? block->data : silence, AUDIO_BLOCK_SAMPLES);
+    if (block) release(block);
+  }
+}
+
+bool RtaBankAnalyzer::service() {
+  if (!running) return false;
+  if (sinceFft < RTA_BANK_MIN_FFT_INTERVAL_US) return false;
+  int ch, s;
+  if (!core.nextDue(ch, s)) return false;
+  // Only the copy races update(); the FFT runs with audio live
+  AudioNoInterrupts();
+  core.snapshot(ch, s);
+  AudioInterrupts();
+  core.transform(ch, s);
+  sinceFft = 0;
+  return true;
+}
+
+bool RtaBankAnalyzer::start() {
+  if (lent) return false;
+  AudioNoInterrupts();
+  core.reset();
+  running = true;
+  AudioInterrupts();
+  return true;
+}
+
+float* RtaBankAnalyzer::lendArena(size_t& floats) {
+  // update() checks running under the audio interrupt, so once this
+  // returns nothing touches the arena but the borrower
+  AudioNoInterrupts();
+  running = false;
+  AudioInterrupts();
+  lent = true;
+  floats = RtaBank::ARENA_FLOATS;
+  return rtaBankArena;
+}
+
+void RtaBankAnalyzer::reclaimArena() {
+  if (!lent) return;
+  core.rebuild();
+  lent = false;
+}
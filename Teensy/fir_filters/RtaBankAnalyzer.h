@@ -0,0 +1,60 @@
+#ifndef RTA_BANK_ANALYZER_H
+#define RTA_BANK_ANALYZER_H
+
+#include <Audio.h>
+#include "RtaBank.h"
+
+// Per-output spectrum tap: the AudioStream face of RtaBank. Inputs 0-7 take
+// the eight outputs post-chain (after gain, so each trace is what that
+// driver is actually sent), input 8 the L+R source mix - all concurrently,
+// where the single RTA has to be rebound to one soloed output at a time.
+//
+// update() only decimates and appends each received block (~1k multiply-
+// adds per channel). The FFTs run in loop context, at most one per
+// service() call and no more often than RTA_BANK_MIN_FFT_INTERVAL_US, so
+// the analyzer's CPU cost is capped however many channels fall due; the
+// round-robin in RtaBank::nextDue shares that budget across channels.
+#define RTA_BANK_MIN_FFT_INTERVAL_US 1000 // <= 1000 512-point FFTs/s, ~2% CPU
+
+class RtaBankAnalyzer : public AudioStream {
+public:
+  RtaBankAnalyzer();
+
+  virtual void update(void) override;
+
+  bool setBands(const float* lo, const float* hi, int count) {
+    return core.setBands(lo, hi, count);
+  }
+
+  // Analyze one due segment if the budget allows. Call on every loop pass
+  // while streaming.
+  bool service();
+
+  bool available(int ch) const { return core.ready(ch); }
+
+  // ch's band powers since its previous publish (RtaBank::publish)
+  bool publish(int ch, float* out) { return core.publish(ch, out); }
+
+  // start() drops all history (no frame carries audio from before) and
+  // begins capturing; stop() makes update() a no-op again. start() is
+  // refused (false) while the arena is lent out.
+  bool start();
+  void stop() { running = false; }
+
+  // Hand the idle arena (RtaBank::ARENA_FLOATS floats) to a one-off user -
+  // the IR measurement's deconvolution - instead of reserving more RAM2.
+  // Stops the analyzer. reclaimArena() rebuilds the bank; the caller then
+  // re-applies setBands().
+  float* lendArena(size_t& floats);
+  void reclaimArena();
+  bool arenaLent() const { return lent; }
+
+private:
+  audio_block_t* inputQueueArray[RTA_BANK_CHANNELS];
+  RtaBank core;
+  volatile bool running = false;
+  bool lent = false;
+  elapsedMicros sinceFft;
+};
+
+#endif // RTA_BANK_ANALYZER_H
@@ -1,1280 +1,469 @@
 // Auto-generated by scratchpad/gen_tables.py - do not edit.
 //
-// Flash-resident copies of the three CMSIS-DSP tables RtaFFT4096 needs
-// (cfft-2048 twiddles + bit-reversal, rfft-4096 twiddles). The Teensy 4
-// linker maps the core library's copies (.rodata) into DTCM, which costs
-// 40KB of RAM1; PROGMEM places these in flash, where the ~10Hz RTA
-// analysis reads them through the cache with no measurable penalty.
-// Extracted bit-exact from a firmware image that linked the originals.
+// Flash-resident copies of the CMSIS-DSP tables RtaMultiRes needs
+// (cfft-512 twiddles + bit-reversal, rfft-1024 twiddles) and RtaBank's
+// half-size set (cfft-256, rfft-512). The Teensy 4 linker maps the core
+// library's copies (.rodata) into DTCM; PROGMEM places these in flash, where
+// the analyzers read them through the cache with no measurable penalty.
+// Same values as the CMSIS originals (twiddles are float32(cos/sin) of the
+// exact angles); test_rta_multires and test_rta_bank check the transforms
+// they drive against known tones on the host.
 #include "RtaFftTables.h"
 
-const uint16_t rtaBitRevIndexTable2048[3808] PROGMEM = {
-  0x0008, 0x1000, 0x0010, 0x2000, 0x0018, 0x3000, 0x0020, 0x0200, 0x0028, 0x1200, 0x0030, 0x2200, 0x0038, 0x3200, 0x0040, 0x0400,
-  0x0048, 0x1400, 0x0050, 0x2400, 0x0058, 0x3400, 0x0060, 0x0600, 0x0068, 0x1600, 0x0070, 0x2600, 0x0078, 0x3600, 0x0080, 0x0800,
-  0x0088, 0x1800, 0x0090, 0x2800, 0x0098, 0x3800, 0x00a0, 0x0a00, 0x00a8, 0x1a00, 0x00b0, 0x2a00, 0x00b8, 0x3a00, 0x00c0, 0x0c00,
-  0x00c8, 0x1c00, 0x00d0, 0x2c00, 0x00d8, 0x3c00, 0x00e0, 0x0e00, 0x00e8, 0x1e00, 0x00f0, 0x2e00, 0x00f8, 0x3e00, 0x0100, 0x0400,
-  0x0108, 0x1040, 0x0110, 0x2040, 0x0118, 0x3040, 0x0120, 0x0240, 0x0128, 0x1240, 0x0130, 0x2240, 0x0138, 0x3240, 0x0140, 0x0440,
-  0x0148, 0x1440, 0x0150, 0x2440, 0x0158, 0x3440, 0x0160, 0x0640, 0x0168, 0x1640, 0x0170, 0x2640, 0x0178, 0x3640, 0x0180, 0x0840,
-  0x0188, 0x1840, 0x0190, 0x2840, 0x0198, 0x3840, 0x01a0, 0x0a40, 0x01a8, 0x1a40, 0x01b0, 0x2a40, 0x01b8, 0x3a40, 0x01c0, 0x0c40,
-  0x01c8, 0x1c40, 0x01d0, 0x2c40, 0x01d8, 0x3c40, 0x01e0, 0x0e40, 0x01e8, 0x1e40, 0x01f0, 0x2e40, 0x01f8, 0x3e40, 0x0200, 0x0800,
-  0x0208, 0x1080, 0x0210, 0x2080, 0x0218, 0x3080, 0x0220, 0x0280, 0x0228, 0x1280, 0x0230, 0x2280, 0x0238, 0x3280, 0x0240, 0x0480,
-  0x0248, 0x1480, 0x0250, 0x2480, 0x0258, 0x3480, 0x0260, 0x0680, 0x0268, 0x1680, 0x0270, 0x2680, 0x0278, 0x3680, 0x0280, 0x0880,
-  0x0288, 0x1880, 0x0290, 0x2880, 0x0298, 0x3880, 0x02a0, 0x0a80, 0x02a8, 0x1a80, 0x02b0, 0x2a80, 0x02b8, 0x3a80, 0x02c0, 0x0c80,
-  0x02c8, 0x1c80, 0x02d0, 0x2c80, 0x02d8, 0x3c80, 0x02e0, 0x0e80, 0x02e8, 0x1e80, 0x02f0, 0x2e80, 0x02f8, 0x3e80, 0x0300, 0x0c00,
-  0x0308, 0x10c0, 0x0310, 0x20c0, 0x0318, 0x30c0, 0x0320, 0x0c80, 0x0328, 0x12c0, 0x0330, 0x22c0, 0x0338, 0x32c0, 0x0340, 0x04c0,
-  0x0348, 0x14c0, 0x0350, 0x24c0, 0x0358, 0x34c0, 0x0360, 0x06c0, 0x0368, 0x16c0, 0x0370, 0x26c0, 0x0378, 0x36c0, 0x0380, 0x08c0,
-  0x0388, 0x18c0, 0x0390, 0x28c0, 0x0398, 0x38c0, 0x03a0, 0x0ac0, 0x03a8, 0x1ac0, 0x03b0, 0x2ac0, 0x03b8, 0x3ac0, 0x03c0, 0x0cc0,
-  0x03c8, 0x1cc0, 0x03d0, 0x2cc0, 0x03d8, 0x3cc0, 0x03e0, 0x0ec0, 0x03e8, 0x1ec0, 0x03f0, 0x2ec0, 0x03f8, 0x3ec0, 0x0408, 0x1100,
-  0x0410, 0x2100, 0x0418, 0x3100, 0x0420, 0x0c00, 0x0428, 0x1300, 0x0430, 0x2300, 0x0438, 0x3300, 0x0440, 0x0500, 0x0448, 0x1500,
-  0x0450, 0x2500, 0x0458, 0x3500, 0x0460, 0x0700, 0x0468, 0x1700, 0x0470, 0x2700, 0x0478, 0x3700, 0x0480, 0x0900, 0x0488, 0x1900,
-  0x0490, 0x2900, 0x0498, 0x3900, 0x04a0, 0x0b00, 0x04a8, 0x1b00, 0x04b0, 0x2b00, 0x04b8, 0x3b00, 0x04c0, 0x0d00, 0x04c8, 0x1d00,
-  0x04d0, 0x2d00, 0x04d8, 0x3d00, 0x04e0, 0x0f00, 0x04e8, 0x1f00, 0x04f0, 0x2f00, 0x04f8, 0x3f00, 0x0508, 0x1140, 0x0510, 0x2140,
-  0x0518, 0x3140, 0x0520, 0x0d00, 0x0528, 0x1340, 0x0530, 0x2340, 0x0538, 0x3340, 0x0548, 0x1540, 0x0550, 0x2540, 0x0558, 0x3540,
-  0x0560, 0x0740, 0x0568, 0x1740, 0x0570, 0x2740, 0x0578, 0x3740, 0x0580, 0x0940, 0x0588, 0x1940, 0x0590, 0x2940, 0x0598, 0x3940,
-  0x05a0, 0x0b40, 0x05a8, 0x1b40, 0x05b0, 0x2b40, 0x05b8, 0x3b40, 0x05c0, 0x0d40, 0x05c8, 0x1d40, 0x05d0, 0x2d40, 0x05d8, 0x3d40,
-  0x05e0, 0x0f40, 0x05e8, 0x1f40, 0x05f0, 0x2f40, 0x05f8, 0x3f40, 0x0600, 0x0840, 0x0608, 0x1180, 0x0610, 0x2180, 0x0618, 0x3180,
-  0x0620, 0x08c0, 0x0628, 0x1380, 0x0630, 0x2380, 0x0638, 0x3380, 0x0640, 0x0940, 0x0648, 0x1580, 0x0650, 0x2580, 0x0658, 0x3580,
-  0x0660, 0x0780, 0x0668, 0x1780, 0x0670, 0x2780, 0x0678, 0x3780, 0x0680, 0x0980, 0x0688, 0x1980, 0x0690, 0x2980, 0x0698, 0x3980,
-  0x06a0, 0x0b80, 0x06a8, 0x1b80, 0x06b0, 0x2b80, 0x06b8, 0x3b80, 0x06c0, 0x0d80, 0x06c8, 0x1d80, 0x06d0, 0x2d80, 0x06d8, 0x3d80,
-  0x06e0, 0x0f80, 0x06e8, 0x1f80, 0x06f0, 0x2f80, 0x06f8, 0x3f80, 0x0700, 0x0c40, 0x0708, 0x11c0, 0x0710, 0x21c0, 0x0718, 0x31c0,
-  0x0720, 0x0cc0, 0x0728, 0x13c0, 0x0730, 0x23c0, 0x0738, 0x33c0, 0x0740, 0x0d40, 0x0748, 0x15c0, 0x0750, 0x25c0, 0x0758, 0x35c0,
-  0x0760, 0x07c0, 0x0768, 0x17c0, 0x0770, 0x27c0, 0x0778, 0x37c0, 0x0780, 0x09c0, 0x0788, 0x19c0, 0x0790, 0x29c0, 0x0798, 0x39c0,
-  0x07a0, 0x0bc0, 0x07a8, 0x1bc0, 0x07b0, 0x2bc0, 0x07b8, 0x3bc0, 0x07c0, 0x0dc0, 0x07c8, 0x1dc0, 0x07d0, 0x2dc0, 0x07d8, 0x3dc0,
-  0x07e0, 0x0fc0, 0x07e8, 0x1fc0, 0x07f0, 0x2fc0, 0x07f8, 0x3fc0, 0x0800, 0x1000, 0x0808, 0x1008, 0x0810, 0x2008, 0x0818, 0x3008,
-  0x0820, 0x1080, 0x0828, 0x1208, 0x0830, 0x2208, 0x0838, 0x3208, 0x0840, 0x1100, 0x0848, 0x1408, 0x0850, 0x2408, 0x0858, 0x3408,
-  0x0860, 0x1180, 0x0868, 0x1608, 0x0870, 0x2608, 0x0878, 0x3608, 0x0880, 0x1008, 0x0888, 0x1808, 0x0890, 0x2808, 0x0898, 0x3808,
-  0x08a0, 0x0a08, 0x08a8, 0x1a08, 0x08b0, 0x2a08, 0x08b8, 0x3a08, 0x08c0, 0x0c08, 0x08c8, 0x1c08, 0x08d0, 0x2c08, 0x08d8, 0x3c08,
-  0x08e0, 0x0e08, 0x08e8, 0x1e08, 0x08f0, 0x2e08, 0x08f8, 0x3e08, 0x0900, 0x1400, 0x0908, 0x1048, 0x0910, 0x2048, 0x0918, 0x3048,
-  0x0920, 0x1480, 0x0928, 0x1248, 0x0930, 0x2248, 0x0938, 0x3248, 0x0940, 0x1500, 0x0948, 0x1448, 0x0950, 0x2448, 0x0958, 0x3448,
-  0x0960, 0x1580, 0x0968, 0x1648, 0x0970, 0x2648, 0x0978, 0x3648, 0x0980, 0x1408, 0x0988, 0x1848, 0x0990, 0x2848, 0x0998, 0x3848,
-  0x09a0, 0x0a48, 0x09a8, 0x1a48, 0x09b0, 0x2a48, 0x09b8, 0x3a48, 0x09c0, 0x0c48, 0x09c8, 0x1c48, 0x09d0, 0x2c48, 0x09d8, 0x3c48,
-  0x09e0, 0x0e48, 0x09e8, 0x1e48, 0x09f0, 0x2e48, 0x09f8, 0x3e48, 0x0a00, 0x1800, 0x0a08, 0x1088, 0x0a10, 0x2088, 0x0a18, 0x3088,
-  0x0a20, 0x1880, 0x0a28, 0x1288, 0x0a30, 0x2288, 0x0a38, 0x3288, 0x0a40, 0x1900, 0x0a48, 0x1488, 0x0a50, 0x2488, 0x0a58, 0x3488,
-  0x0a60, 0x1980, 0x0a68, 0x1688, 0x0a70, 0x2688, 0x0a78, 0x3688, 0x0a80, 0x1808, 0x0a88, 0x1888, 0x0a90, 0x2888, 0x0a98, 0x3888,
-  0x0aa0, 0x1888, 0x0aa8, 0x1a88, 0x0ab0, 0x2a88, 0x0ab8, 0x3a88, 0x0ac0, 0x0c88, 0x0ac8, 0x1c88, 0x0ad0, 0x2c88, 0x0ad8, 0x3c88,
-  0x0ae0, 0x0e88, 0x0ae8, 0x1e88, 0x0af0, 0x2e88, 0x0af8, 0x3e88, 0x0b00, 0x1c00, 0x0b08, 0x10c8, 0x0b10, 0x20c8, 0x0b18, 0x30c8,
-  0x0b20, 0x1c80, 0x0b28, 0x12c8, 0x0b30, 0x22c8, 0x0b38, 0x32c8, 0x0b40, 0x1d00, 0x0b48, 0x14c8, 0x0b50, 0x24c8, 0x0b58, 0x34c8,
-  0x0b60, 0x1d80, 0x0b68, 0x16c8, 0x0b70, 0x26c8, 0x0b78, 0x36c8, 0x0b80, 0x1c08, 0x0b88, 0x18c8, 0x0b90, 0x28c8, 0x0b98, 0x38c8,
-  0x0ba0, 0x1c88, 0x0ba8, 0x1ac8, 0x0bb0, 0x2ac8, 0x0bb8, 0x3ac8, 0x0bc0, 0x0cc8, 0x0bc8, 0x1cc8, 0x0bd0, 0x2cc8, 0x0bd8, 0x3cc8,
-  0x0be0, 0x0ec8, 0x0be8, 0x1ec8, 0x0bf0, 0x2ec8, 0x0bf8, 0x3ec8, 0x0c00, 0x1040, 0x0c08, 0x1108, 0x0c10, 0x2108, 0x0c18, 0x3108,
-  0x0c20, 0x10c0, 0x0c28, 0x1308, 0x0c30, 0x2308, 0x0c38, 0x3308, 0x0c40, 0x1140, 0x0c48, 0x1508, 0x0c50, 0x2508, 0x0c58, 0x3508,
-  0x0c60, 0x11c0, 0x0c68, 0x1708, 0x0c70, 0x2708, 0x0c78, 0x3708, 0x0c80, 0x1048, 0x0c88, 0x1908, 0x0c90, 0x2908, 0x0c98, 0x3908,
-  0x0ca0, 0x10c8, 0x0ca8, 0x1b08, 0x0cb0, 0x2b08, 0x0cb8, 0x3b08, 0x0cc0, 0x0d08, 0x0cc8, 0x1d08, 0x0cd0, 0x2d08, 0x0cd8, 0x3d08,
-  0x0ce0, 0x0f08, 0x0ce8, 0x1f08, 0x0cf0, 0x2f08, 0x0cf8, 0x3f08, 0x0d00, 0x1440, 0x0d08, 0x1148, 0x0d10, 0x2148, 0x0d18, 0x3148,
-  0x0d20, 0x14c0, 0x0d28, 0x1348, 0x0d30, 0x2348, 0x0d38, 0x3348, 0x0d40, 0x1540, 0x0d48, 0x1548, 0x0d50, 0x2548, 0x0d58, 0x3548,
-  0x0d60, 0x15c0, 0x0d68, 0x1748, 0x0d70, 0x2748, 0x0d78, 0x3748, 0x0d80, 0x1448, 0x0d88, 0x1948, 0x0d90, 0x2948, 0x0d98, 0x3948,
-  0x0da0, 0x14c8, 0x0da8, 0x1b48, 0x0db0, 0x2b48, 0x0db8, 0x3b48, 0x0dc0, 0x1548, 0x0dc8, 0x1d48, 0x0dd0, 0x2d48, 0x0dd8, 0x3d48,
-  0x0de0, 0x0f48, 0x0de8, 0x1f48, 0x0df0, 0x2f48, 0x0df8, 0x3f48, 0x0e00, 0x1840, 0x0e08, 0x1188, 0x0e10, 0x2188, 0x0e18, 0x3188,
-  0x0e20, 0x18c0, 0x0e28, 0x1388, 0x0e30, 0x2388, 0x0e38, 0x3388, 0x0e40, 0x1940, 0x0e48, 0x1588, 0x0e50, 0x2588, 0x0e58, 0x3588,
-  0x0e60, 0x19c0, 0x0e68, 0x1788, 0x0e70, 0x2788, 0x0e78, 0x3788, 0x0e80, 0x1848, 0x0e88, 0x1988, 0x0e90, 0x2988, 0x0e98, 0x3988,
-  0x0ea0, 0x18c8, 0x0ea8, 0x1b88, 0x0eb0, 0x2b88, 0x0eb8, 0x3b88, 0x0ec0, 0x1948, 0x0ec8, 0x1d88, 0x0ed0, 0x2d88, 0x0ed8, 0x3d88,
-  0x0ee0, 0x0f88, 0x0ee8, 0x1f88, 0x0ef0, 0x2f88, 0x0ef8, 0x3f88, 0x0f00, 0x1c40, 0x0f08, 0x11c8, 0x0f10, 0x21c8, 0x0f18, 0x31c8,
-  0x0f20, 0x1cc0, 0x0f28, 0x13c8, 0x0f30, 0x23c8, 0x0f38, 0x33c8, 0x0f40, 0x1d40, 0x0f48, 0x15c8, 0x0f50, 0x25c8, 0x0f58, 0x35c8,
-  0x0f60, 0x1dc0, 0x0f68, 0x17c8, 0x0f70, 0x27c8, 0x0f78, 0x37c8, 0x0f80, 0x1c48, 0x0f88, 0x19c8, 0x0f90, 0x29c8, 0x0f98, 0x39c8,
-  0x0fa0, 0x1cc8, 0x0fa8, 0x1bc8, 0x0fb0, 0x2bc8, 0x0fb8, 0x3bc8, 0x0fc0, 0x1d48, 0x0fc8, 0x1dc8, 0x0fd0, 0x2dc8, 0x0fd8, 0x3dc8,
-  0x0fe0, 0x1dc8, 0x0fe8, 0x1fc8, 0x0ff0, 0x2fc8, 0x0ff8, 0x3fc8, 0x1000, 0x2000, 0x1008, 0x1010, 0x1010, 0x2010, 0x1018, 0x3010,
-  0x1020, 0x2080, 0x1028, 0x1210, 0x1030, 0x2210, 0x1038, 0x3210, 0x1040, 0x2100, 0x1048, 0x1410, 0x1050, 0x2410, 0x1058, 0x3410,
-  0x1060, 0x2180, 0x1068, 0x1610, 0x1070, 0x2610, 0x1078, 0x3610, 0x1080, 0x2008, 0x1088, 0x1810, 0x1090, 0x2810, 0x1098, 0x3810,
-  0x10a0, 0x2088, 0x10a8, 0x1a10, 0x10b0, 0x2a10, 0x10b8, 0x3a10, 0x10c0, 0x2108, 0x10c8, 0x1c10, 0x10d0, 0x2c10, 0x10d8, 0x3c10,
-  0x10e0, 0x2188, 0x10e8, 0x1e10, 0x10f0, 0x2e10, 0x10f8, 0x3e10, 0x1100, 0x2400, 0x1108, 0x2410, 0x1110, 0x2050, 0x1118, 0x3050,
-  0x1120, 0x2480, 0x1128, 0x1250, 0x1130, 0x2250, 0x1138, 0x3250, 0x1140, 0x2500, 0x1148, 0x1450, 0x1150, 0x2450, 0x1158, 0x3450,
-  0x1160, 0x2580, 0x1168, 0x1650, 0x1170, 0x2650, 0x1178, 0x3650, 0x1180, 0x2408, 0x1188, 0x1850, 0x1190, 0x2850, 0x1198, 0x3850,
-  0x11a0, 0x2488, 0x11a8, 0x1a50, 0x11b0, 0x2a50, 0x11b8, 0x3a50, 0x11c0, 0x2508, 0x11c8, 0x1c50, 0x11d0, 0x2c50, 0x11d8, 0x3c50,
-  0x11e0, 0x2588, 0x11e8, 0x1e50, 0x11f0, 0x2e50, 0x11f8, 0x3e50, 0x1200, 0x2800, 0x1208, 0x2810, 0x1210, 0x2090, 0x1218, 0x3090,
-  0x1220, 0x2880, 0x1228, 0x1290, 0x1230, 0x2290, 0x1238, 0x3290, 0x1240, 0x2900, 0x1248, 0x1490, 0x1250, 0x2490, 0x1258, 0x3490,
-  0x1260, 0x2980, 0x1268, 0x1690, 0x1270, 0x2690, 0x1278, 0x3690, 0x1280, 0x2808, 0x1288, 0x1890, 0x1290, 0x2890, 0x1298, 0x3890,
-  0x12a0, 0x2888, 0x12a8, 0x1a90, 0x12b0, 0x2a90, 0x12b8, 0x3a90, 0x12c0, 0x2908, 0x12c8, 0x1c90, 0x12d0, 0x2c90, 0x12d8, 0x3c90,
-  0x12e0, 0x2988, 0x12e8, 0x1e90, 0x12f0, 0x2e90, 0x12f8, 0x3e90, 0x1300, 0x2c00, 0x1308, 0x2c10, 0x1310, 0x20d0, 0x1318, 0x30d0,
-  0x1320, 0x2c80, 0x1328, 0x2c90, 0x1330, 0x22d0, 0x1338, 0x32d0, 0x1340, 0x2d00, 0x1348, 0x14d0, 0x1350, 0x24d0, 0x1358, 0x34d0,
-  0x1360, 0x2d80, 0x1368, 0x16d0, 0x1370, 0x26d0, 0x1378, 0x36d0, 0x1380, 0x2c08, 0x1388, 0x18d0, 0x1390, 0x28d0, 0x1398, 0x38d0,
-  0x13a0, 0x2c88, 0x13a8, 0x1ad0, 0x13b0, 0x2ad0, 0x13b8, 0x3ad0, 0x13c0, 0x2d08, 0x13c8, 0x1cd0, 0x13d0, 0x2cd0, 0x13d8, 0x3cd0,
-  0x13e0, 0x2d88, 0x13e8, 0x1ed0, 0x13f0, 0x2ed0, 0x13f8, 0x3ed0, 0x1400, 0x2040, 0x1408, 0x2050, 0x1410, 0x2110, 0x1418, 0x3110,
-  0x1420, 0x20c0, 0x1428, 0x20d0, 0x1430, 0x2310, 0x1438, 0x3310, 0x1440, 0x2140, 0x1448, 0x1510, 0x1450, 0x2510, 0x1458, 0x3510,
-  0x1460, 0x21c0, 0x1468, 0x1710, 0x1470, 0x2710, 0x1478, 0x3710, 0x1480, 0x2048, 0x1488, 0x1910, 0x1490, 0x2910, 0x1498, 0x3910,
-  0x14a0, 0x20c8, 0x14a8, 0x1b10, 0x14b0, 0x2b10, 0x14b8, 0x3b10, 0x14c0, 0x2148, 0x14c8, 0x1d10, 0x14d0, 0x2d10, 0x14d8, 0x3d10,
-  0x14e0, 0x21c8, 0x14e8, 0x1f10, 0x14f0, 0x2f10, 0x14f8, 0x3f10, 0x1500, 0x2440, 0x1508, 0x2450, 0x1510, 0x2150, 0x1518, 0x3150,
-  0x1520, 0x24c0, 0x1528, 0x24d0, 0x1530, 0x2350, 0x1538, 0x3350, 0x1540, 0x2540, 0x1548, 0x1550, 0x1550, 0x2550, 0x1558, 0x3550,
-  0x1560, 0x25c0, 0x1568, 0x1750, 0x1570, 0x2750, 0x1578, 0x3750, 0x1580, 0x2448, 0x1588, 0x1950, 0x1590, 0x2950, 0x1598, 0x3950,
-  0x15a0, 0x24c8, 0x15a8, 0x1b50, 0x15b0, 0x2b50, 0x15b8, 0x3b50, 0x15c0, 0x2548, 0x15c8, 0x1d50, 0x15d0, 0x2d50, 0x15d8, 0x3d50,
-  0x15e0, 0x25c8, 0x15e8, 0x1f50, 0x15f0, 0x2f50, 0x15f8, 0x3f50, 0x1600, 0x2840, 0x1608, 0x2850, 0x1610, 0x2190, 0x1618, 0x3190,
-  0x1620, 0x28c0, 0x1628, 0x28d0, 0x1630, 0x2390, 0x1638, 0x3390, 0x1640, 0x2940, 0x1648, 0x2950, 0x1650, 0x2590, 0x1658, 0x3590,
-  0x1660, 0x29c0, 0x1668, 0x1790, 0x1670, 0x2790, 0x1678, 0x3790, 0x1680, 0x2848, 0x1688, 0x1990, 0x1690, 0x2990, 0x1698, 0x3990,
-  0x16a0, 0x28c8, 0x16a8, 0x1b90, 0x16b0, 0x2b90, 0x16b8, 0x3b90, 0x16c0, 0x2948, 0x16c8, 0x1d90, 0x16d0, 0x2d90, 0x16d8, 0x3d90,
-  0x16e0, 0x29c8, 0x16e8, 0x1f90, 0x16f0, 0x2f90, 0x16f8, 0x3f90, 0x1700, 0x2c40, 0x1708, 0x2c50, 0x1710, 0x21d0, 0x1718, 0x31d0,
-  0x1720, 0x2cc0, 0x1728, 0x2cd0, 0x1730, 0x23d0, 0x1738, 0x33d0, 0x1740, 0x2d40, 0x1748, 0x2d50, 0x1750, 0x25d0, 0x1758, 0x35d0,
-  0x1760, 0x2dc0, 0x1768, 0x17d0, 0x1770, 0x27d0, 0x1778, 0x37d0, 0x1780, 0x2c48, 0x1788, 0x19d0, 0x1790, 0x29d0, 0x1798, 0x39d0,
-  0x17a0, 0x2cc8, 0x17a8, 0x1bd0, 0x17b0, 0x2bd0, 0x17b8, 0x3bd0, 0x17c0, 0x2d48, 0x17c8, 0x1dd0, 0x17d0, 0x2dd0, 0x17d8, 0x3dd0,
-  0x17e0, 0x2dc8, 0x17e8, 0x1fd0, 0x17f0, 0x2fd0, 0x17f8, 0x3fd0, 0x1800, 0x3000, 0x1808, 0x3010, 0x1810, 0x2018, 0x1818, 0x3018,
-  0x1820, 0x3080, 0x1828, 0x3090, 0x1830, 0x2218, 0x1838, 0x3218, 0x1840, 0x3100, 0x1848, 0x3110, 0x1850, 0x2418, 0x1858, 0x3418,
-  0x1860, 0x3180, 0x1868, 0x3190, 0x1870, 0x2618, 0x1878, 0x3618, 0x1880, 0x3008, 0x1888, 0x3018, 0x1890, 0x2818, 0x1898, 0x3818,
-  0x18a0, 0x3088, 0x18a8, 0x1a18, 0x18b0, 0x2a18, 0x18b8, 0x3a18, 0x18c0, 0x3108, 0x18c8, 0x1c18, 0x18d0, 0x2c18, 0x18d8, 0x3c18,
-  0x18e0, 0x3188, 0x18e8, 0x1e18, 0x18f0, 0x2e18, 0x18f8, 0x3e18, 0x1900, 0x3400, 0x1908, 0x3410, 0x1910, 0x2058, 0x1918, 0x3058,
-  0x1920, 0x3480, 0x1928, 0x3490, 0x1930, 0x2258, 0x1938, 0x3258, 0x1940, 0x3500, 0x1948, 0x3510, 0x1950, 0x2458, 0x1958, 0x3458,
-  0x1960, 0x3580, 0x1968, 0x3590, 0x1970, 0x2658, 0x1978, 0x3658, 0x1980, 0x3408, 0x1988, 0x3418, 0x1990, 0x2858, 0x1998, 0x3858,
-  0x19a0, 0x3488, 0x19a8, 0x1a58, 0x19b0, 0x2a58, 0x19b8, 0x3a58, 0x19c0, 0x3508, 0x19c8, 0x1c58, 0x19d0, 0x2c58, 0x19d8, 0x3c58,
-  0x19e0, 0x3588, 0x19e8, 0x1e58, 0x19f0, 0x2e58, 0x19f8, 0x3e58, 0x1a00, 0x3800, 0x1a08, 0x3810, 0x1a10, 0x2098, 0x1a18, 0x3098,
-  0x1a20, 0x3880, 0x1a28, 0x3890, 0x1a30, 0x2298, 0x1a38, 0x3298, 0x1a40, 0x3900, 0x1a48, 0x3910, 0x1a50, 0x2498, 0x1a58, 0x3498,
-  0x1a60, 0x3980, 0x1a68, 0x3990, 0x1a70, 0x2698, 0x1a78, 0x3698, 0x1a80, 0x3808, 0x1a88, 0x3818, 0x1a90, 0x2898, 0x1a98, 0x3898,
-  0x1aa0, 0x3888, 0x1aa8, 0x3898, 0x1ab0, 0x2a98, 0x1ab8, 0x3a98, 0x1ac0, 0x3908, 0x1ac8, 0x1c98, 0x1ad0, 0x2c98, 0x1ad8, 0x3c98,
-  0x1ae0, 0x3988, 0x1ae8, 0x1e98, 0x1af0, 0x2e98, 0x1af8, 0x3e98, 0x1b00, 0x3c00, 0x1b08, 0x3c10, 0x1b10, 0x20d8, 0x1b18, 0x30d8,
-  0x1b20, 0x3c80, 0x1b28, 0x3c90, 0x1b30, 0x22d8, 0x1b38, 0x32d8, 0x1b40, 0x3d00, 0x1b48, 0x3d10, 0x1b50, 0x24d8, 0x1b58, 0x34d8,
-  0x1b60, 0x3d80, 0x1b68, 0x3d90, 0x1b70, 0x26d8, 0x1b78, 0x36d8, 0x1b80, 0x3c08, 0x1b88, 0x3c18, 0x1b90, 0x28d8, 0x1b98, 0x38d8,
-  0x1ba0, 0x3c88, 0x1ba8, 0x3c98, 0x1bb0, 0x2ad8, 0x1bb8, 0x3ad8, 0x1bc0, 0x3d08, 0x1bc8, 0x1cd8, 0x1bd0, 0x2cd8, 0x1bd8, 0x3cd8,
-  0x1be0, 0x3d88, 0x1be8, 0x1ed8, 0x1bf0, 0x2ed8, 0x1bf8, 0x3ed8, 0x1c00, 0x3040, 0x1c08, 0x3050, 0x1c10, 0x2118, 0x1c18, 0x3118,
-  0x1c20, 0x30c0, 0x1c28, 0x30d0, 0x1c30, 0x2318, 0x1c38, 0x3318, 0x1c40, 0x3140, 0x1c48, 0x3150, 0x1c50, 0x2518, 0x1c58, 0x3518,
-  0x1c60, 0x31c0, 0x1c68, 0x31d0, 0x1c70, 0x2718, 0x1c78, 0x3718, 0x1c80, 0x3048, 0x1c88, 0x3058, 0x1c90, 0x2918, 0x1c98, 0x3918,
-  0x1ca0, 0x30c8, 0x1ca8, 0x30d8, 0x1cb0, 0x2b18, 0x1cb8, 0x3b18, 0x1cc0, 0x3148, 0x1cc8, 0x1d18, 0x1cd0, 0x2d18, 0x1cd8, 0x3d18,
-  0x1ce0, 0x31c8, 0x1ce8, 0x1f18, 0x1cf0, 0x2f18, 0x1cf8, 0x3f18, 0x1d00, 0x3440, 0x1d08, 0x3450, 0x1d10, 0x2158, 0x1d18, 0x3158,
-  0x1d20, 0x34c0, 0x1d28, 0x34d0, 0x1d30, 0x2358, 0x1d38, 0x3358, 0x1d40, 0x3540, 0x1d48, 0x3550, 0x1d50, 0x2558, 0x1d58, 0x3558,
-  0x1d60, 0x35c0, 0x1d68, 0x35d0, 0x1d70, 0x2758, 0x1d78, 0x3758, 0x1d80, 0x3448, 0x1d88, 0x3458, 0x1d90, 0x2958, 0x1d98, 0x3958,
-  0x1da0, 0x34c8, 0x1da8, 0x34d8, 0x1db0, 0x2b58, 0x1db8, 0x3b58, 0x1dc0, 0x3548, 0x1dc8, 0x3558, 0x1dd0, 0x2d58, 0x1dd8, 0x3d58,
-  0x1de0, 0x35c8, 0x1de8, 0x1f58, 0x1df0, 0x2f58, 0x1df8, 0x3f58, 0x1e00, 0x3840, 0x1e08, 0x3850, 0x1e10, 0x2198, 0x1e18, 0x3198,
-  0x1e20, 0x38c0, 0x1e28, 0x38d0, 0x1e30, 0x2398, 0x1e38, 0x3398, 0x1e40, 0x3940, 0x1e48, 0x3950, 0x1e50, 0x2598, 0x1e58, 0x3598,
-  0x1e60, 0x39c0, 0x1e68, 0x39d0, 0x1e70, 0x2798, 0x1e78, 0x3798, 0x1e80, 0x3848, 0x1e88, 0x3858, 0x1e90, 0x2998, 0x1e98, 0x3998,
-  0x1ea0, 0x38c8, 0x1ea8, 0x38d8, 0x1eb0, 0x2b98, 0x1eb8, 0x3b98, 0x1ec0, 0x3948, 0x1ec8, 0x3958, 0x1ed0, 0x2d98, 0x1ed8, 0x3d98,
-  0x1ee0, 0x39c8, 0x1ee8, 0x1f98, 0x1ef0, 0x2f98, 0x1ef8, 0x3f98, 0x1f00, 0x3c40, 0x1f08, 0x3c50, 0x1f10, 0x21d8, 0x1f18, 0x31d8,
-  0x1f20, 0x3cc0, 0x1f28, 0x3cd0, 0x1f30, 0x23d8, 0x1f38, 0x33d8, 0x1f40, 0x3d40, 0x1f48, 0x3d50, 0x1f50, 0x25d8, 0x1f58, 0x35d8,
-  0x1f60, 0x3dc0, 0x1f68, 0x3dd0, 0x1f70, 0x27d8, 0x1f78, 0x37d8, 0x1f80, 0x3c48, 0x1f88, 0x3c58, 0x1f90, 0x29d8, 0x1f98, 0x39d8,
-  0x1fa0, 0x3cc8, 0x1fa8, 0x3cd8, 0x1fb0, 0x2bd8, 0x1fb8, 0x3bd8, 0x1fc0, 0x3d48, 0x1fc8, 0x3d58, 0x1fd0, 0x2dd8, 0x1fd8, 0x3dd8,
-  0x1fe0, 0x3dc8, 0x1fe8, 0x3dd8, 0x1ff0, 0x2fd8, 0x1ff8, 0x3fd8, 0x2008, 0x2080, 0x2010, 0x2020, 0x2018, 0x3020, 0x2028, 0x2880,
-  0x2030, 0x2220, 0x2038, 0x3220, 0x2040, 0x2100, 0x2048, 0x20c0, 0x2050, 0x2420, 0x2058, 0x3420, 0x2060, 0x2410, 0x2068, 0x28c0,
-  0x2070, 0x2620, 0x2078, 0x3620, 0x2088, 0x3080, 0x2090, 0x2820, 0x2098, 0x3820, 0x20a0, 0x3008, 0x20a8, 0x3880, 0x20b0, 0x2a20,
-  0x20b8, 0x3a20, 0x20c0, 0x2108, 0x20c8, 0x30c0, 0x20d0, 0x2c20, 0x20d8, 0x3c20, 0x20e0, 0x3108, 0x20e8, 0x38c0, 0x20f0, 0x2e20,
-  0x20f8, 0x3e20, 0x2100, 0x2400, 0x2108, 0x2180, 0x2110, 0x2410, 0x2118, 0x3060, 0x2120, 0x2420, 0x2128, 0x2980, 0x2130, 0x2260,
-  0x2138, 0x3260, 0x2140, 0x2500, 0x2148, 0x21c0, 0x2150, 0x2460, 0x2158, 0x3460, 0x2160, 0x2450, 0x2168, 0x29c0, 0x2170, 0x2660,
-  0x2178, 0x3660, 0x2180, 0x2408, 0x2188, 0x3180, 0x2190, 0x2860, 0x2198, 0x3860, 0x21a0, 0x3408, 0x21a8, 0x3980, 0x21b0, 0x2a60,
-  0x21b8, 0x3a60, 0x21c0, 0x2508, 0x21c8, 0x31c0, 0x21d0, 0x2c60, 0x21d8, 0x3c60, 0x21e0, 0x3508, 0x21e8, 0x39c0, 0x21f0, 0x2e60,
-  0x21f8, 0x3e60, 0x2200, 0x3000, 0x2208, 0x3080, 0x2210, 0x3008, 0x2218, 0x30a0, 0x2220, 0x3010, 0x2228, 0x2888, 0x2230, 0x22a0,
-  0x2238, 0x32a0, 0x2240, 0x3040, 0x2248, 0x30c0, 0x2250, 0x24a0, 0x2258, 0x34a0, 0x2260, 0x3050, 0x2268, 0x28c8, 0x2270, 0x26a0,
-  0x2278, 0x36a0, 0x2280, 0x3020, 0x2288, 0x3088, 0x2290, 0x28a0, 0x2298, 0x38a0, 0x22a0, 0x3018, 0x22a8, 0x3888, 0x22b0, 0x2aa0,
-  0x22b8, 0x3aa0, 0x22c0, 0x3060, 0x22c8, 0x30c8, 0x22d0, 0x2ca0, 0x22d8, 0x3ca0, 0x22e0, 0x3118, 0x22e8, 0x38c8, 0x22f0, 0x2ea0,
-  0x22f8, 0x3ea0, 0x2300, 0x3100, 0x2308, 0x3180, 0x2310, 0x3108, 0x2318, 0x30e0, 0x2320, 0x3110, 0x2328, 0x2988, 0x2330, 0x3118,
-  0x2338, 0x32e0, 0x2340, 0x3140, 0x2348, 0x31c0, 0x2350, 0x24e0, 0x2358, 0x34e0, 0x2360, 0x3150, 0x2368, 0x29c8, 0x2370, 0x26e0,
-  0x2378, 0x36e0, 0x2380, 0x2418, 0x2388, 0x3188, 0x2390, 0x28e0, 0x2398, 0x38e0, 0x23a0, 0x3418, 0x23a8, 0x3988, 0x23b0, 0x2ae0,
-  0x23b8, 0x3ae0, 0x23c0, 0x2518, 0x23c8, 0x31c8, 0x23d0, 0x2ce0, 0x23d8, 0x3ce0, 0x23e0, 0x3518, 0x23e8, 0x39c8, 0x23f0, 0x2ee0,
-  0x23f8, 0x3ee0, 0x2408, 0x2480, 0x2410, 0x2420, 0x2418, 0x3120, 0x2428, 0x2c80, 0x2430, 0x3110, 0x2438, 0x3320, 0x2440, 0x2500,
-  0x2448, 0x24c0, 0x2450, 0x2520, 0x2458, 0x3520, 0x2460, 0x2510, 0x2468, 0x2cc0, 0x2470, 0x2720, 0x2478, 0x3720, 0x2488, 0x3480,
-  0x2490, 0x2920, 0x2498, 0x3920, 0x24a0, 0x3048, 0x24a8, 0x3c80, 0x24b0, 0x2b20, 0x24b8, 0x3b20, 0x24c0, 0x2508, 0x24c8, 0x34c0,
-  0x24d0, 0x2d20, 0x24d8, 0x3d20, 0x24e0, 0x3148, 0x24e8, 0x3cc0, 0x24f0, 0x2f20, 0x24f8, 0x3f20, 0x2508, 0x2580, 0x2510, 0x2520,
-  0x2518, 0x3160, 0x2528, 0x2d80, 0x2530, 0x3150, 0x2538, 0x3360, 0x2548, 0x25c0, 0x2550, 0x2560, 0x2558, 0x3560, 0x2568, 0x2dc0,
-  0x2570, 0x2760, 0x2578, 0x3760, 0x2588, 0x3580, 0x2590, 0x2960, 0x2598, 0x3960, 0x25a0, 0x3448, 0x25a8, 0x3d80, 0x25b0, 0x2b60,
-  0x25b8, 0x3b60, 0x25c8, 0x35c0, 0x25d0, 0x2d60, 0x25d8, 0x3d60, 0x25e0, 0x3548, 0x25e8, 0x3dc0, 0x25f0, 0x2f60, 0x25f8, 0x3f60,
-  0x2600, 0x3400, 0x2608, 0x3480, 0x2610, 0x3408, 0x2618, 0x31a0, 0x2620, 0x3410, 0x2628, 0x2c88, 0x2630, 0x3418, 0x2638, 0x33a0,
-  0x2640, 0x3440, 0x2648, 0x34c0, 0x2650, 0x3448, 0x2658, 0x35a0, 0x2660, 0x3450, 0x2668, 0x2cc8, 0x2670, 0x27a0, 0x2678, 0x37a0,
-  0x2680, 0x3420, 0x2688, 0x3488, 0x2690, 0x29a0, 0x2698, 0x39a0, 0x26a0, 0x3058, 0x26a8, 0x3c88, 0x26b0, 0x2ba0, 0x26b8, 0x3ba0,
-  0x26c0, 0x3460, 0x26c8, 0x34c8, 0x26d0, 0x2da0, 0x26d8, 0x3da0, 0x26e0, 0x3158, 0x26e8, 0x3cc8, 0x26f0, 0x2fa0, 0x26f8, 0x3fa0,
-  0x2700, 0x3500, 0x2708, 0x3580, 0x2710, 0x3508, 0x2718, 0x31e0, 0x2720, 0x3510, 0x2728, 0x2d88, 0x2730, 0x3518, 0x2738, 0x33e0,
-  0x2740, 0x3540, 0x2748, 0x35c0, 0x2750, 0x3548, 0x2758, 0x35e0, 0x2760, 0x3550, 0x2768, 0x2dc8, 0x2770, 0x27e0, 0x2778, 0x37e0,
-  0x2780, 0x3520, 0x2788, 0x3588, 0x2790, 0x29e0, 0x2798, 0x39e0, 0x27a0, 0x3458, 0x27a8, 0x3d88, 0x27b0, 0x2be0, 0x27b8, 0x3be0,
-  0x27c0, 0x3560, 0x27c8, 0x35c8, 0x27d0, 0x2de0, 0x27d8, 0x3de0, 0x27e0, 0x3558, 0x27e8, 0x3dc8, 0x27f0, 0x2fe0, 0x27f8, 0x3fe0,
-  0x2808, 0x2820, 0x2810, 0x2880, 0x2818, 0x3028, 0x2828, 0x2890, 0x2830, 0x2888, 0x2838, 0x3228, 0x2840, 0x2c00, 0x2848, 0x2c20,
-  0x2850, 0x2c80, 0x2858, 0x3428, 0x2860, 0x2c08, 0x2868, 0x28d0, 0x2870, 0x2c88, 0x2878, 0x3628, 0x2888, 0x3090, 0x2898, 0x3828,
-  0x28a0, 0x3028, 0x28a8, 0x3890, 0x28b0, 0x2a28, 0x28b8, 0x3a28, 0x28c0, 0x2c10, 0x28c8, 0x30d0, 0x28d0, 0x2c28, 0x28d8, 0x3c28,
-  0x28e0, 0x2c18, 0x28e8, 0x38d0, 0x28f0, 0x2e28, 0x28f8, 0x3e28, 0x2900, 0x2c00, 0x2908, 0x2c08, 0x2910, 0x2c10, 0x2918, 0x3068,
-  0x2920, 0x2c20, 0x2928, 0x2990, 0x2930, 0x30d0, 0x2938, 0x3268, 0x2940, 0x2c40, 0x2948, 0x2c60, 0x2950, 0x2cc0, 0x2958, 0x3468,
-  0x2960, 0x2c48, 0x2968, 0x29d0, 0x2970, 0x2cc8, 0x2978, 0x3668, 0x2980, 0x2c80, 0x2988, 0x3190, 0x2990, 0x2c28, 0x2998, 0x3868,
-  0x29a0, 0x3428, 0x29a8, 0x3990, 0x29b0, 0x2a68, 0x29b8, 0x3a68, 0x29c0, 0x2c50, 0x29c8, 0x31d0, 0x29d0, 0x2c68, 0x29d8, 0x3c68,
-  0x29e0, 0x2c58, 0x29e8, 0x39d0, 0x29f0, 0x2e68, 0x29f8, 0x3e68, 0x2a00, 0x3800, 0x2a08, 0x3820, 0x2a10, 0x3880, 0x2a18, 0x30a8,
-  0x2a20, 0x3808, 0x2a28, 0x3828, 0x2a30, 0x3888, 0x2a38, 0x32a8, 0x2a40, 0x3c00, 0x2a48, 0x3c20, 0x2a50, 0x3c80, 0x2a58, 0x34a8,
-  0x2a60, 0x3c08, 0x2a68, 0x3c28, 0x2a70, 0x3c88, 0x2a78, 0x36a8, 0x2a80, 0x3810, 0x2a88, 0x3098, 0x2a90, 0x3890, 0x2a98, 0x38a8,
-  0x2aa0, 0x3818, 0x2aa8, 0x3898, 0x2ab0, 0x3898, 0x2ab8, 0x3aa8, 0x2ac0, 0x3c10, 0x2ac8, 0x30d8, 0x2ad0, 0x2ca8, 0x2ad8, 0x3ca8,
-  0x2ae0, 0x3c18, 0x2ae8, 0x38d8, 0x2af0, 0x2ea8, 0x2af8, 0x3ea8, 0x2b00, 0x3840, 0x2b08, 0x3860, 0x2b10, 0x38c0, 0x2b18, 0x30e8,
-  0x2b20, 0x3848, 0x2b28, 0x3868, 0x2b30, 0x38c8, 0x2b38, 0x32e8, 0x2b40, 0x3c40, 0x2b48, 0x3c60, 0x2b50, 0x3cc0, 0x2b58, 0x34e8,
-  0x2b60, 0x3c48, 0x2b68, 0x3c68, 0x2b70, 0x3cc8, 0x2b78, 0x36e8, 0x2b80, 0x3850, 0x2b88, 0x3198, 0x2b90, 0x38d0, 0x2b98, 0x38e8,
-  0x2ba0, 0x3858, 0x2ba8, 0x3998, 0x2bb0, 0x38d8, 0x2bb8, 0x3ae8, 0x2bc0, 0x3c50, 0x2bc8, 0x31d8, 0x2bd0, 0x2ce8, 0x2bd8, 0x3ce8,
-  0x2be0, 0x3c58, 0x2be8, 0x39d8, 0x2bf0, 0x2ee8, 0x2bf8, 0x3ee8, 0x2c08, 0x2c20, 0x2c10, 0x2c80, 0x2c18, 0x3128, 0x2c28, 0x2c90,
-  0x2c30, 0x3190, 0x2c38, 0x3328, 0x2c40, 0x2d00, 0x2c48, 0x2d20, 0x2c50, 0x2d80, 0x2c58, 0x3528, 0x2c60, 0x2d08, 0x2c68, 0x2cd0,
-  0x2c70, 0x2d88, 0x2c78, 0x3728, 0x2c88, 0x3490, 0x2c98, 0x3928, 0x2ca0, 0x3068, 0x2ca8, 0x3c90, 0x2cb0, 0x3868, 0x2cb8, 0x3b28,
-  0x2cc0, 0x2d10, 0x2cc8, 0x34d0, 0x2cd0, 0x2d28, 0x2cd8, 0x3d28, 0x2ce0, 0x2d18, 0x2ce8, 0x3cd0, 0x2cf0, 0x2f28, 0x2cf8, 0x3f28,
-  0x2d08, 0x2d20, 0x2d10, 0x2d80, 0x2d18, 0x3168, 0x2d28, 0x2d90, 0x2d30, 0x31d0, 0x2d38, 0x3368, 0x2d48, 0x2d60, 0x2d50, 0x2dc0,
-  0x2d58, 0x3568, 0x2d68, 0x2dd0, 0x2d70, 0x2dc8, 0x2d78, 0x3768, 0x2d88, 0x3590, 0x2d98, 0x3968, 0x2da0, 0x3468, 0x2da8, 0x3d90,
-  0x2db0, 0x3c68, 0x2db8, 0x3b68, 0x2dc8, 0x35d0, 0x2dd8, 0x3d68, 0x2de0, 0x3568, 0x2de8, 0x3dd0, 0x2df0, 0x2f68, 0x2df8, 0x3f68,
-  0x2e00, 0x3900, 0x2e08, 0x3920, 0x2e10, 0x3980, 0x2e18, 0x31a8, 0x2e20, 0x3908, 0x2e28, 0x3928, 0x2e30, 0x3988, 0x2e38, 0x33a8,
-  0x2e40, 0x3d00, 0x2e48, 0x3d20, 0x2e50, 0x3d80, 0x2e58, 0x35a8, 0x2e60, 0x3d08, 0x2e68, 0x3d28, 0x2e70, 0x3d88, 0x2e78, 0x37a8,
-  0x2e80, 0x3910, 0x2e88, 0x3498, 0x2e90, 0x3990, 0x2e98, 0x39a8, 0x2ea0, 0x3918, 0x2ea8, 0x3c98, 0x2eb0, 0x3998, 0x2eb8, 0x3ba8,
-  0x2ec0, 0x3d10, 0x2ec8, 0x34d8, 0x2ed0, 0x3d90, 0x2ed8, 0x3da8, 0x2ee0, 0x3d18, 0x2ee8, 0x3cd8, 0x2ef0, 0x2fa8, 0x2ef8, 0x3fa8,
-  0x2f00, 0x3940, 0x2f08, 0x3960, 0x2f10, 0x39c0, 0x2f18, 0x31e8, 0x2f20, 0x3948, 0x2f28, 0x3968, 0x2f30, 0x39c8, 0x2f38, 0x33e8,
-  0x2f40, 0x3d40, 0x2f48, 0x3d60, 0x2f50, 0x3dc0, 0x2f58, 0x35e8, 0x2f60, 0x3d48, 0x2f68, 0x3d68, 0x2f70, 0x3dc8, 0x2f78, 0x37e8,
-  0x2f80, 0x3950, 0x2f88, 0x3598, 0x2f90, 0x39d0, 0x2f98, 0x39e8, 0x2fa0, 0x3958, 0x2fa8, 0x3d98, 0x2fb0, 0x39d8, 0x2fb8, 0x3be8,
-  0x2fc0, 0x3d50, 0x2fc8, 0x35d8, 0x2fd0, 0x3dd0, 0x2fd8, 0x3de8, 0x2fe0, 0x3d58, 0x2fe8, 0x3dd8, 0x2ff0, 0x3dd8, 0x2ff8, 0x3fe8,
-  0x3018, 0x3030, 0x3038, 0x3230, 0x3040, 0x3100, 0x3048, 0x3108, 0x3050, 0x3110, 0x3058, 0x3430, 0x3060, 0x3120, 0x3068, 0x3128,
-  0x3070, 0x3418, 0x3078, 0x3630, 0x3088, 0x30a0, 0x3098, 0x3830, 0x30a8, 0x38a0, 0x30b0, 0x3888, 0x30b8, 0x3a30, 0x30c0, 0x3180,
-  0x30c8, 0x30e0, 0x30d0, 0x3190, 0x30d8, 0x3c30, 0x30e0, 0x3188, 0x30e8, 0x38e0, 0x30f0, 0x3988, 0x30f8, 0x3e30, 0x3100, 0x3400,
-  0x3108, 0x3408, 0x3110, 0x3410, 0x3118, 0x3418, 0x3120, 0x3420, 0x3128, 0x3428, 0x3130, 0x3430, 0x3138, 0x3270, 0x3140, 0x3500,
-  0x3148, 0x3508, 0x3150, 0x3510, 0x3158, 0x3470, 0x3160, 0x3520, 0x3168, 0x3528, 0x3170, 0x3458, 0x3178, 0x3670, 0x3180, 0x3480,
-  0x3188, 0x31a0, 0x3190, 0x3490, 0x3198, 0x3870, 0x31a0, 0x3488, 0x31a8, 0x39a0, 0x31b0, 0x3c88, 0x31b8, 0x3a70, 0x31c0, 0x3580,
-  0x31c8, 0x31e0, 0x31d0, 0x3590, 0x31d8, 0x3c70, 0x31e0, 0x3588, 0x31e8, 0x39e0, 0x31f0, 0x3d88, 0x31f8, 0x3e70, 0x3200, 0x3800,
-  0x3208, 0x3880, 0x3210, 0x3808, 0x3218, 0x3888, 0x3220, 0x3810, 0x3228, 0x3890, 0x3230, 0x3818, 0x3238, 0x32b0, 0x3240, 0x3840,
-  0x3248, 0x38c0, 0x3250, 0x3848, 0x3258, 0x34b0, 0x3260, 0x3850, 0x3268, 0x38d0, 0x3270, 0x3858, 0x3278, 0x36b0, 0x3280, 0x3820,
-  0x3288, 0x38a0, 0x3290, 0x3828, 0x3298, 0x38b0, 0x32a0, 0x3830, 0x32a8, 0x38a8, 0x32b0, 0x3898, 0x32b8, 0x3ab0, 0x32c0, 0x3860,
-  0x32c8, 0x38e0, 0x32d0, 0x3868, 0x32d8, 0x3cb0, 0x32e0, 0x3870, 0x32e8, 0x38e8, 0x32f0, 0x3998, 0x32f8, 0x3eb0, 0x3300, 0x3900,
-  0x3308, 0x3980, 0x3310, 0x3908, 0x3318, 0x3988, 0x3320, 0x3910, 0x3328, 0x3990, 0x3330, 0x3918, 0x3338, 0x3998, 0x3340, 0x3940,
-  0x3348, 0x39c0, 0x3350, 0x3948, 0x3358, 0x34f0, 0x3360, 0x3950, 0x3368, 0x39d0, 0x3370, 0x3958, 0x3378, 0x36f0, 0x3380, 0x3920,
-  0x3388, 0x39a0, 0x3390, 0x3928, 0x3398, 0x38f0, 0x33a0, 0x3498, 0x33a8, 0x39a8, 0x33b0, 0x3c98, 0x33b8, 0x3af0, 0x33c0, 0x3960,
-  0x33c8, 0x39e0, 0x33d0, 0x3968, 0x33d8, 0x3cf0, 0x33e0, 0x3598, 0x33e8, 0x39e8, 0x33f0, 0x3d98, 0x33f8, 0x3ef0, 0x3418, 0x3430,
-  0x3438, 0x3918, 0x3440, 0x3500, 0x3448, 0x3508, 0x3450, 0x3510, 0x3458, 0x3530, 0x3460, 0x3520, 0x3468, 0x3528, 0x3470, 0x3518,
-  0x3478, 0x3730, 0x3488, 0x34a0, 0x3498, 0x3930, 0x34a8, 0x3ca0, 0x34b0, 0x38c8, 0x34b8, 0x3b30, 0x34c0, 0x3580, 0x34c8, 0x34e0,
-  0x34d0, 0x3590, 0x34d8, 0x3d30, 0x34e0, 0x3588, 0x34e8, 0x3ce0, 0x34f0, 0x39c8, 0x34f8, 0x3f30, 0x3518, 0x3530, 0x3538, 0x3958,
-  0x3558, 0x3570, 0x3578, 0x3770, 0x3588, 0x35a0, 0x3598, 0x3970, 0x35a8, 0x3da0, 0x35b0, 0x3cc8, 0x35b8, 0x3b70, 0x35c8, 0x35e0,
-  0x35d8, 0x3d70, 0x35e8, 0x3de0, 0x35f0, 0x3dc8, 0x35f8, 0x3f70, 0x3600, 0x3c00, 0x3608, 0x3c80, 0x3610, 0x3c08, 0x3618, 0x3c88,
-  0x3620, 0x3c10, 0x3628, 0x3c90, 0x3630, 0x3c18, 0x3638, 0x3c98, 0x3640, 0x3c40, 0x3648, 0x3cc0, 0x3650, 0x3c48, 0x3658, 0x3cc8,
-  0x3660, 0x3c50, 0x3668, 0x3cd0, 0x3670, 0x3c58, 0x3678, 0x37b0, 0x3680, 0x3c20, 0x3688, 0x3ca0, 0x3690, 0x3c28, 0x3698, 0x39b0,
-  0x36a0, 0x3c30, 0x36a8, 0x3ca8, 0x36b0, 0x38d8, 0x36b8, 0x3bb0, 0x36c0, 0x3c60, 0x36c8, 0x3ce0, 0x36d0, 0x3c68, 0x36d8, 0x3db0,
-  0x36e0, 0x3c70, 0x36e8, 0x3ce8, 0x36f0, 0x39d8, 0x36f8, 0x3fb0, 0x3700, 0x3d00, 0x3708, 0x3d80, 0x3710, 0x3d08, 0x3718, 0x3d88,
-  0x3720, 0x3d10, 0x3728, 0x3d90, 0x3730, 0x3d18, 0x3738, 0x3d98, 0x3740, 0x3d40, 0x3748, 0x3dc0, 0x3750, 0x3d48, 0x3758, 0x3dc8,
-  0x3760, 0x3d50, 0x3768, 0x3dd0, 0x3770, 0x3d58, 0x3778, 0x37f0, 0x3780, 0x3d20, 0x3788, 0x3da0, 0x3790, 0x3d28, 0x3798, 0x39f0,
-  0x37a0, 0x3d30, 0x37a8, 0x3da8, 0x37b0, 0x3cd8, 0x37b8, 0x3bf0, 0x37c0, 0x3d60, 0x37c8, 0x3de0, 0x37d0, 0x3d68, 0x37d8, 0x3df0,
-  0x37e0, 0x3d70, 0x37e8, 0x3de8, 0x37f0, 0x3dd8, 0x37f8, 0x3ff0, 0x3838, 0x3898, 0x3840, 0x3900, 0x3848, 0x3908, 0x3850, 0x3910,
-  0x3858, 0x3918, 0x3860, 0x3920, 0x3868, 0x3928, 0x3870, 0x3930, 0x3878, 0x3c98, 0x38a8, 0x38b0, 0x38b8, 0x3a38, 0x38c0, 0x3980,
-  0x38c8, 0x3988, 0x38d0, 0x3990, 0x38d8, 0x3c38, 0x38e0, 0x39a0, 0x38e8, 0x38f0, 0x38f8, 0x3e38, 0x38f0, 0x39a8, 0x3900, 0x3c00,
-  0x3908, 0x3c08, 0x3910, 0x3c10, 0x3918, 0x3c18, 0x3920, 0x3c20, 0x3928, 0x3c28, 0x3930, 0x3c30, 0x3938, 0x3c38, 0x3940, 0x3d00,
-  0x3948, 0x3d08, 0x3950, 0x3d10, 0x3958, 0x3d18, 0x3960, 0x3d20, 0x3968, 0x3d28, 0x3970, 0x3d30, 0x3978, 0x3cd8, 0x3980, 0x3c80,
-  0x3988, 0x3c88, 0x3990, 0x3c90, 0x3998, 0x3c98, 0x39a0, 0x3ca0, 0x39a8, 0x39b0, 0x39b8, 0x3a78, 0x39b0, 0x3ca8, 0x39c0, 0x3d80,
-  0x39c8, 0x3d88, 0x39d0, 0x3d90, 0x39d8, 0x3c78, 0x39e0, 0x3da0, 0x39e8, 0x39f0, 0x39f8, 0x3e78, 0x39f0, 0x3da8, 0x3a08, 0x3a10,
-  0x3a10, 0x3a20, 0x3a18, 0x3a30, 0x3a20, 0x3a80, 0x3a28, 0x3a90, 0x3a30, 0x3aa0, 0x3a38, 0x3ab0, 0x3a40, 0x3b00, 0x3a48, 0x3b10,
-  0x3a50, 0x3b20, 0x3a58, 0x3b30, 0x3a60, 0x3b80, 0x3a68, 0x3b90, 0x3a70, 0x3ba0, 0x3a78, 0x3bb0, 0x3a88, 0x3aa0, 0x3a98, 0x3ab0,
-  0x3aa8, 0x3ab0, 0x3ac0, 0x3b08, 0x3ac8, 0x3b18, 0x3ad0, 0x3b28, 0x3ad8, 0x3cb8, 0x3ae0, 0x3b88, 0x3ae8, 0x3b98, 0x3af0, 0x3ba8,
-  0x3af8, 0x3eb8, 0x3b00, 0x3e00, 0x3b08, 0x3e10, 0x3b10, 0x3e20, 0x3b18, 0x3e30, 0x3b20, 0x3e80, 0x3b28, 0x3e90, 0x3b30, 0x3ea0,
-  0x3b38, 0x3eb0, 0x3b40, 0x3f00, 0x3b48, 0x3f10, 0x3b50, 0x3f20, 0x3b58, 0x3f30, 0x3b60, 0x3f80, 0x3b68, 0x3f90, 0x3b70, 0x3fa0,
-  0x3b78, 0x3fb0, 0x3b80, 0x3e08, 0x3b88, 0x3e18, 0x3b90, 0x3e28, 0x3b98, 0x3e38, 0x3ba0, 0x3e88, 0x3ba8, 0x3e98, 0x3bb0, 0x3ea8,
-  0x3bb8, 0x3eb8, 0x3bc0, 0x3f08, 0x3bc8, 0x3f18, 0x3bd0, 0x3f28, 0x3bd8, 0x3cf8, 0x3be0, 0x3f88, 0x3be8, 0x3f98, 0x3bf0, 0x3fa8,
-  0x3bf8, 0x3ef8, 0x3c38, 0x3c98, 0x3c40, 0x3d00, 0x3c48, 0x3d08, 0x3c50, 0x3d10, 0x3c58, 0x3d18, 0x3c60, 0x3d20, 0x3c68, 0x3d28,
-  0x3c70, 0x3d30, 0x3c78, 0x3d98, 0x3ca8, 0x3cb0, 0x3cb8, 0x3eb0, 0x3cc0, 0x3d80, 0x3cc8, 0x3d88, 0x3cd0, 0x3d90, 0x3cd8, 0x3d38,
-  0x3ce0, 0x3da0, 0x3ce8, 0x3cf0, 0x3cf0, 0x3da8, 0x3cf8, 0x3f38, 0x3d38, 0x3d98, 0x3d78, 0x3dd8, 0x3da8, 0x3db0, 0x3db8, 0x3fb0,
-  0x3de8, 0x3df0, 0x3e08, 0x3e80, 0x3df8, 0x3f78, 0x3e10, 0x3e80, 0x3e18, 0x3e88, 0x3e20, 0x3e80, 0x3e28, 0x3e90, 0x3e30, 0x3e88,
-  0x3e38, 0x3e98, 0x3e40, 0x3f00, 0x3e48, 0x3f20, 0x3e50, 0x3f80, 0x3e58, 0x3fa0, 0x3e60, 0x3f08, 0x3e68, 0x3f28, 0x3e70, 0x3f88,
-  0x3e78, 0x3fa8, 0x3e88, 0x3ea0, 0x3e98, 0x3ea8, 0x3ec0, 0x3f10, 0x3ea8, 0x3eb0, 0x3ec8, 0x3f30, 0x3ed0, 0x3f90, 0x3ed8, 0x3fb0,
-  0x3ee0, 0x3f18, 0x3ee8, 0x3f38, 0x3ef0, 0x3f98, 0x3f08, 0x3f80, 0x3ef8, 0x3fb8, 0x3f10, 0x3f80, 0x3f18, 0x3f88, 0x3f20, 0x3f80,
-  0x3f28, 0x3f90, 0x3f30, 0x3f88, 0x3f38, 0x3f98, 0x3f48, 0x3f50, 0x3f50, 0x3f60, 0x3f58, 0x3f70, 0x3f60, 0x3fc0, 0x3f68, 0x3fd0,
-  0x3f70, 0x3fe0, 0x3f78, 0x3ff0, 0x3f88, 0x3fa0, 0x3f98, 0x3fa8, 0x3fa8, 0x3fb0, 0x3fd8, 0x3ff0, 0x3fc8, 0x3fe0, 0x3fe8, 0x3ff0,
+const uint16_t rtaBitRevIndexTable512[448] PROGMEM = {
+  0x0008, 0x0200, 0x0010, 0x0400, 0x0018, 0x0600, 0x0020, 0x0800, 0x0028, 0x0a00, 0x0030, 0x0c00, 0x0038, 0x0e00, 0x0048, 0x0240,
+  0x0050, 0x0440, 0x0058, 0x0640, 0x0060, 0x0840, 0x0068, 0x0a40, 0x0070, 0x0c40, 0x0078, 0x0e40, 0x0088, 0x0280, 0x0090, 0x0480,
+  0x0098, 0x0680, 0x00a0, 0x0880, 0x00a8, 0x0a80, 0x00b0, 0x0c80, 0x00b8, 0x0e80, 0x00c8, 0x02c0, 0x00d0, 0x04c0, 0x00d8, 0x06c0,
+  0x00e0, 0x08c0, 0x00e8, 0x0ac0, 0x00f0, 0x0cc0, 0x00f8, 0x0ec0, 0x0108, 0x0300, 0x0110, 0x0500, 0x0118, 0x0700, 0x0120, 0x0900,
+  0x0128, 0x0b00, 0x0130, 0x0d00, 0x0138, 0x0f00, 0x0148, 0x0340, 0x0150, 0x0540, 0x0158, 0x0740, 0x0160, 0x0940, 0x0168, 0x0b40,
+  0x0170, 0x0d40, 0x0178, 0x0f40, 0x0188, 0x0380, 0x0190, 0x0580, 0x0198, 0x0780, 0x01a0, 0x0980, 0x01a8, 0x0b80, 0x01b0, 0x0d80,
+  0x01b8, 0x0f80, 0x01c8, 0x03c0, 0x01d0, 0x05c0, 0x01d8, 0x07c0, 0x01e0, 0x09c0, 0x01e8, 0x0bc0, 0x01f0, 0x0dc0, 0x01f8, 0x0fc0,
+  0x0210, 0x0408, 0x0218, 0x0608, 0x0220, 0x0808, 0x0228, 0x0a08, 0x0230, 0x0c08, 0x0238, 0x0e08, 0x0250, 0x0448, 0x0258, 0x0648,
+  0x0260, 0x0848, 0x0268, 0x0a48, 0x0270, 0x0c48, 0x0278, 0x0e48, 0x0290, 0x0488, 0x0298, 0x0688, 0x02a0, 0x0888, 0x02a8, 0x0a88,
+  0x02b0, 0x0c88, 0x02b8, 0x0e88, 0x02d0, 0x04c8, 0x02d8, 0x06c8, 0x02e0, 0x08c8, 0x02e8, 0x0ac8, 0x02f0, 0x0cc8, 0x02f8, 0x0ec8,
+  0x0310, 0x0508, 0x0318, 0x0708, 0x0320, 0x0908, 0x0328, 0x0b08, 0x0330, 0x0d08, 0x0338, 0x0f08, 0x0350, 0x0548, 0x0358, 0x0748,
+  0x0360, 0x0948, 0x0368, 0x0b48, 0x0370, 0x0d48, 0x0378, 0x0f48, 0x0390, 0x0588, 0x0398, 0x0788, 0x03a0, 0x0988, 0x03a8, 0x0b88,
+  0x03b0, 0x0d88, 0x03b8, 0x0f88, 0x03d0, 0x05c8, 0x03d8, 0x07c8, 0x03e0, 0x09c8, 0x03e8, 0x0bc8, 0x03f0, 0x0dc8, 0x03f8, 0x0fc8,
+  0x0418, 0x0610, 0x0420, 0x0810, 0x0428, 0x0a10, 0x0430, 0x0c10, 0x0438, 0x0e10, 0x0458, 0x0650, 0x0460, 0x0850, 0x0468, 0x0a50,
+  0x0470, 0x0c50, 0x0478, 0x0e50, 0x0498, 0x0690, 0x04a0, 0x0890, 0x04a8, 0x0a90, 0x04b0, 0x0c90, 0x04b8, 0x0e90, 0x04d8, 0x06d0,
+  0x04e0, 0x08d0, 0x04e8, 0x0ad0, 0x04f0, 0x0cd0, 0x04f8, 0x0ed0, 0x0518, 0x0710, 0x0520, 0x0910, 0x0528, 0x0b10, 0x0530, 0x0d10,
+  0x0538, 0x0f10, 0x0558, 0x0750, 0x0560, 0x0950, 0x0568, 0x0b50, 0x0570, 0x0d50, 0x0578, 0x0f50, 0x0598, 0x0790, 0x05a0, 0x0990,
+  0x05a8, 0x0b90, 0x05b0, 0x0d90, 0x05b8, 0x0f90, 0x05d8, 0x07d0, 0x05e0, 0x09d0, 0x05e8, 0x0bd0, 0x05f0, 0x0dd0, 0x05f8, 0x0fd0,
+  0x0620, 0x0818, 0x0628, 0x0a18, 0x0630, 0x0c18, 0x0638, 0x0e18, 0x0660, 0x0858, 0x0668, 0x0a58, 0x0670, 0x0c58, 0x0678, 0x0e58,
+  0x06a0, 0x0898, 0x06a8, 0x0a98, 0x06b0, 0x0c98, 0x06b8, 0x0e98, 0x06e0, 0x08d8, 0x06e8, 0x0ad8, 0x06f0, 0x0cd8, 0x06f8, 0x0ed8,
+  0x0720, 0x0918, 0x0728, 0x0b18, 0x0730, 0x0d18, 0x0738, 0x0f18, 0x0760, 0x0958, 0x0768, 0x0b58, 0x0770, 0x0d58, 0x0778, 0x0f58,
+  0x07a0, 0x0998, 0x07a8, 0x0b98, 0x07b0, 0x0d98, 0x07b8, 0x0f98, 0x07e0, 0x09d8, 0x07e8, 0x0bd8, 0x07f0, 0x0dd8, 0x07f8, 0x0fd8,
+  0x0828, 0x0a20, 0x0830, 0x0c20, 0x0838, 0x0e20, 0x0868, 0x0a60, 0x0870, 0x0c60, 0x0878, 0x0e60, 0x08a8, 0x0aa0, 0x08b0, 0x0ca0,
+  0x08b8, 0x0ea0, 0x08e8, 0x0ae0, 0x08f0, 0x0ce0, 0x08f8, 0x0ee0, 0x0928, 0x0b20, 0x0930, 0x0d20, 0x0938, 0x0f20, 0x0968, 0x0b60,
+  0x0970, 0x0d60, 0x0978, 0x0f60, 0x09a8, 0x0ba0, 0x09b0, 0x0da0, 0x09b8, 0x0fa0, 0x09e8, 0x0be0, 0x09f0, 0x0de0, 0x09f8, 0x0fe0,
+  0x0a30, 0x0c28, 0x0a38, 0x0e28, 0x0a70, 0x0c68, 0x0a78, 0x0e68, 0x0ab0, 0x0ca8, 0x0ab8, 0x0ea8, 0x0af0, 0x0ce8, 0x0af8, 0x0ee8,
+  0x0b30, 0x0d28, 0x0b38, 0x0f28, 0x0b70, 0x0d68, 0x0b78, 0x0f68, 0x0bb0, 0x0da8, 0x0bb8, 0x0fa8, 0x0bf0, 0x0de8, 0x0bf8, 0x0fe8,
+  0x0c38, 0x0e30, 0x0c78, 0x0e70, 0x0cb8, 0x0eb0, 0x0cf8, 0x0ef0, 0x0d38, 0x0f30, 0x0d78, 0x0f70, 0x0db8, 0x0fb0, 0x0df8, 0x0ff0,
 };
 
-const uint32_t rtaTwiddleCoef2048Bits[4096] PROGMEM = {
-  0x3f800000, 0x00000000, 0x3f7fffb1, 0x3b490fc7, 0x3f7ffec4, 0x3bc90f89, 0x3f7ffd39, 0x3c16cb59,
-  0x3f7ffb11, 0x3c490e90, 0x3f7ff84a, 0x3c7b514b, 0x3f7ff4e6, 0x3c96c9b6, 0x3f7ff0e3, 0x3cafea69,
-  0x3f7fec43, 0x3cc90ab0, 0x3f7fe705, 0x3ce22a7b, 0x3f7fe129, 0x3cfb49b9, 0x3f7fdaaf, 0x3d0a342f,
-  0x3f7fd398, 0x3d16c32c, 0x3f7fcbe2, 0x3d2351cc, 0x3f7fc38f, 0x3d2fe007, 0x3f7fba9e, 0x3d3c6dd5,
-  0x3f7fb10f, 0x3d48fb2f, 0x3f7fa6e3, 0x3d55880e, 0x3f7f9c18, 0x3d621468, 0x3f7f90b1, 0x3d6ea038,
-  0x3f7f84ab, 0x3d7b2b74, 0x3f7f7808, 0x3d83db0a, 0x3f7f6ac7, 0x3d8a200a, 0x3f7f5ce9, 0x3d9064b4,
-  0x3f7f4e6d, 0x3d96a905, 0x3f7f3f54, 0x3d9cecf9, 0x3f7f2f9d, 0x3da3308c, 0x3f7f1f49, 0x3da973ba,
-  0x3f7f0e58, 0x3dafb680, 0x3f7efcc9, 0x3db5f8da, 0x3f7eea9d, 0x3dbc3ac3, 0x3f7ed7d4, 0x3dc27c39,
-  0x3f7ec46d, 0x3dc8bd36, 0x3f7eb069, 0x3dcefdb7, 0x3f7e9bc9, 0x3dd53db9, 0x3f7e868b, 0x3ddb7d37,
-  0x3f7e70b0, 0x3de1bc2e, 0x3f7e5a38, 0x3de7fa9a, 0x3f7e4323, 0x3dee3876, 0x3f7e2b72, 0x3df475c0,
-  0x3f7e1324, 0x3dfab273, 0x3f7dfa38, 0x3e007745, 0x3f7de0b1, 0x3e039502, 0x3f7dc68c, 0x3e06b26e,
-  0x3f7dabcc, 0x3e09cf86, 0x3f7d906e, 0x3e0cec4a, 0x3f7d7474, 0x3e1008b7, 0x3f7d57de, 0x3e1324ca,
-  0x3f7d3aac, 0x3e164083, 0x3f7d1cdd, 0x3e195be0, 0x3f7cfe73, 0x3e1c76de, 0x3f7cdf6c, 0x3e1f917b,
-  0x3f7cbfc9, 0x3e22abb6, 0x3f7c9f8a, 0x3e25c58c, 0x3f7c7eb0, 0x3e28defc, 0x3f7c5d3a, 0x3e2bf804,
-  0x3f7c3b28, 0x3e2f10a2, 0x3f7c187a, 0x3e3228d4, 0x3f7bf531, 0x3e354098, 0x3f7bd14d, 0x3e3857ec,
-  0x3f7baccd, 0x3e3b6ecf, 0x3f7b87b2, 0x3e3e853e, 0x3f7b61fc, 0x3e419b37, 0x3f7b3bab, 0x3e44b0b9,
-  0x3f7b14be, 0x3e47c5c2, 0x3f7aed37, 0x3e4ada4f, 0x3f7ac516, 0x3e4dee60, 0x3f7a9c59, 0x3e5101f1,
-  0x3f7a7302, 0x3e541501, 0x3f7a4910, 0x3e57278f, 0x3f7a1e84, 0x3e5a3997, 0x3f79f35e, 0x3e5d4b1a,
-  0x3f79c79d, 0x3e605c13, 0x3f799b43, 0x3e636c83, 0x3f796e4e, 0x3e667c66, 0x3f7940c0, 0x3e698bba,
-  0x3f791298, 0x3e6c9a7f, 0x3f78e3d6, 0x3e6fa8b2, 0x3f78b47b, 0x3e72b651, 0x3f788486, 0x3e75c35a,
-  0x3f7853f8, 0x3e78cfcc, 0x3f7822d1, 0x3e7bdba4, 0x3f77f110, 0x3e7ee6e1, 0x3f77beb7, 0x3e80f8c0,
-  0x3f778bc5, 0x3e827dc0, 0x3f77583a, 0x3e840270, 0x3f772417, 0x3e8586ce, 0x3f76ef5b, 0x3e870ada,
-  0x3f76ba07, 0x3e888e93, 0x3f76841b, 0x3e8a11f8, 0x3f764d97, 0x3e8b9507, 0x3f76167a, 0x3e8d17c0,
-  0x3f75dec6, 0x3e8e9a22, 0x3f75a67b, 0x3e901c2c, 0x3f756d97, 0x3e919ddd, 0x3f75341d, 0x3e931f35,
-  0x3f74fa0b, 0x3e94a031, 0x3f74bf62, 0x3e9620d2, 0x3f748422, 0x3e97a117, 0x3f74484b, 0x3e9920fe,
-  0x3f740bdd, 0x3e9aa086, 0x3f73ced9, 0x3e9c1faf, 0x3f73913f, 0x3e9d9e78, 0x3f73530e, 0x3e9f1cdf,
-  0x3f731447, 0x3ea09ae5, 0x3f72d4eb, 0x3ea21887, 0x3f7294f8, 0x3ea395c5, 0x3f725470, 0x3ea5129f,
-  0x3f721352, 0x3ea68f12, 0x3f71d19f, 0x3ea80b1f, 0x3f718f57, 0x3ea986c4, 0x3f714c7a, 0x3eab0201,
-  0x3f710908, 0x3eac7cd4, 0x3f70c502, 0x3eadf73c, 0x3f708066, 0x3eaf713a, 0x3f703b37, 0x3eb0eacb,
-  0x3f6ff573, 0x3eb263ef, 0x3f6faf1b, 0x3eb3dca5, 0x3f6f6830, 0x3eb554ec, 0x3f6f20b0, 0x3eb6ccc3,
-  0x3f6ed89e, 0x3eb8442a, 0x3f6e8ff8, 0x3eb9bb1e, 0x3f6e46be, 0x3ebb31a0, 0x3f6dfcf2, 0x3ebca7af,
-  0x3f6db293, 0x3ebe1d4a, 0x3f6d67a1, 0x3ebf926f, 0x3f6d1c1d, 0x3ec1071e, 0x3f6cd007, 0x3ec27b55,
-  0x3f6c835e, 0x3ec3ef15, 0x3f6c3624, 0x3ec5625c, 0x3f6be858, 0x3ec6d529, 0x3f6b99fb, 0x3ec8477c,
-  0x3f6b4b0c, 0x3ec9b953, 0x3f6afb8c, 0x3ecb2aae, 0x3f6aab7b, 0x3ecc9b8b, 0x3f6a5ad9, 0x3ece0bea,
-  0x3f6a09a7, 0x3ecf7bca, 0x3f69b7e4, 0x3ed0eb2a, 0x3f696591, 0x3ed25a09, 0x3f6912ae, 0x3ed3c867,
-  0x3f68bf3c, 0x3ed53641, 0x3f686b39, 0x3ed6a399, 0x3f6816a8, 0x3ed8106b, 0x3f67c187, 0x3ed97cb9,
-  0x3f676bd8, 0x3edae880, 0x3f671599, 0x3edc53c1, 0x3f66becc, 0x3eddbe79, 0x3f666771, 0x3edf28a9,
-  0x3f660f88, 0x3ee0924f, 0x3f65b710, 0x3ee1fb6a, 0x3f655e0b, 0x3ee363fa, 0x3f650479, 0x3ee4cbfe,
-  0x3f64aa59, 0x3ee63375, 0x3f644fac, 0x3ee79a5d, 0x3f63f473, 0x3ee900b7, 0x3f6398ac, 0x3eea6681,
-  0x3f633c5a, 0x3eebcbbb, 0x3f62df7b, 0x3eed3063, 0x3f628210, 0x3eee9479, 0x3f62241a, 0x3eeff7fb,
-  0x3f61c598, 0x3ef15aea, 0x3f61668a, 0x3ef2bd43, 0x3f6106f2, 0x3ef41f07, 0x3f60a6cf, 0x3ef58035,
-  0x3f604621, 0x3ef6e0cb, 0x3f5fe4e9, 0x3ef840c8, 0x3f5f8327, 0x3ef9a02d, 0x3f5f20db, 0x3efafef7,
-  0x3f5ebe05, 0x3efc5d27, 0x3f5e5aa6, 0x3efdbabb, 0x3f5df6be, 0x3eff17b2, 0x3f5d924d, 0x3f003a06,
-  0x3f5d2d53, 0x3f00e7e4, 0x3f5cc7d1, 0x3f019573, 0x3f5c61c7, 0x3f0242b1, 0x3f5bfb34, 0x3f02ef9f,
-  0x3f5b941a, 0x3f039c3d, 0x3f5b2c79, 0x3f044889, 0x3f5ac450, 0x3f04f484, 0x3f5a5ba0, 0x3f05a02c,
-  0x3f59f26a, 0x3f064b82, 0x3f5988ad, 0x3f06f686, 0x3f591e6a, 0x3f07a136, 0x3f58b3a1, 0x3f084b92,
-  0x3f584853, 0x3f08f59b, 0x3f57dc7f, 0x3f099f4e, 0x3f577026, 0x3f0a48ad, 0x3f570348, 0x3f0af1b7,
-  0x3f5695e5, 0x3f0b9a6b, 0x3f5627fe, 0x3f0c42c9, 0x3f55b993, 0x3f0cead0, 0x3f554aa4, 0x3f0d9281,
-  0x3f54db31, 0x3f0e39da, 0x3f546b3b, 0x3f0ee0db, 0x3f53fac3, 0x3f0f8784, 0x3f5389c7, 0x3f102dd5,
-  0x3f531849, 0x3f10d3cd, 0x3f52a649, 0x3f11796b, 0x3f5233c6, 0x3f121eb0, 0x3f51c0c2, 0x3f12c39a,
-  0x3f514d3d, 0x3f13682a, 0x3f50d937, 0x3f140c5f, 0x3f5064af, 0x3f14b039, 0x3f4fefa8, 0x3f1553b7,
-  0x3f4f7a1f, 0x3f15f6d9, 0x3f4f0417, 0x3f16999f, 0x3f4e8d90, 0x3f173c07, 0x3f4e1689, 0x3f17de12,
-  0x3f4d9f02, 0x3f187fc0, 0x3f4d26fd, 0x3f19210f, 0x3f4cae79, 0x3f19c200, 0x3f4c3578, 0x3f1a6293,
-  0x3f4bbbf8, 0x3f1b02c6, 0x3f4b41fa, 0x3f1ba299, 0x3f4ac77f, 0x3f1c420c, 0x3f4a4c87, 0x3f1ce11f,
-  0x3f49d112, 0x3f1d7fd1, 0x3f495521, 0x3f1e1e22, 0x3f48d8b3, 0x3f1ebc12, 0x3f485bca, 0x3f1f599f,
-  0x3f47de65, 0x3f1ff6cb, 0x3f476085, 0x3f209393, 0x3f46e22a, 0x3f212ff9, 0x3f466354, 0x3f21cbfb,
-  0x3f45e403, 0x3f226799, 0x3f456439, 0x3f2302d3, 0x3f44e3f5, 0x3f239da9, 0x3f446337, 0x3f24381a,
-  0x3f43e200, 0x3f24d225, 0x3f436051, 0x3f256bcb, 0x3f42de29, 0x3f26050a, 0x3f425b89, 0x3f269de3,
-  0x3f41d870, 0x3f273656, 0x3f4154e1, 0x3f27ce61, 0x3f40d0da, 0x3f286605, 0x3f404c5c, 0x3f28fd41,
-  0x3f3fc767, 0x3f299415, 0x3f3f41fc, 0x3f2a2a80, 0x3f3ebc1b, 0x3f2ac082, 0x3f3e35c5, 0x3f2b561b,
-  0x3f3daef9, 0x3f2beb4a, 0x3f3d27b8, 0x3f2c800f, 0x3f3ca003, 0x3f2d1469, 0x3f3c17d9, 0x3f2da859,
-  0x3f3b8f3b, 0x3f2e3bde, 0x3f3b0629, 0x3f2ecef7, 0x3f3a7ca4, 0x3f2f61a5, 0x3f39f2ac, 0x3f2ff3e6,
-  0x3f396842, 0x3f3085bb, 0x3f38dd65, 0x3f311722, 0x3f385216, 0x3f31a81d, 0x3f37c655, 0x3f3238aa,
-  0x3f373a23, 0x3f32c8c9, 0x3f36ad7f, 0x3f33587a, 0x3f36206c, 0x3f33e7bc, 0x3f3592e7, 0x3f34768f,
-  0x3f3504f3, 0x3f3504f3, 0x3f34768f, 0x3f3592e7, 0x3f33e7bc, 0x3f36206c, 0x3f33587a, 0x3f36ad7f,
-  0x3f32c8c9, 0x3f373a23, 0x3f3238aa, 0x3f37c655, 0x3f31a81d, 0x3f385216, 0x3f311722, 0x3f38dd65,
-  0x3f3085bb, 0x3f396842, 0x3f2ff3e6, 0x3f39f2ac, 0x3f2f61a5, 0x3f3a7ca4, 0x3f2ecef7, 0x3f3b0629,
-  0x3f2e3bde, 0x3f3b8f3b, 0x3f2da859, 0x3f3c17d9, 0x3f2d1469, 0x3f3ca003, 0x3f2c800f, 0x3f3d27b8,
-  0x3f2beb4a, 0x3f3daef9, 0x3f2b561b, 0x3f3e35c5, 0x3f2ac082, 0x3f3ebc1b, 0x3f2a2a80, 0x3f3f41fc,
-  0x3f299415, 0x3f3fc767, 0x3f28fd41, 0x3f404c5c, 0x3f286605, 0x3f40d0da, 0x3f27ce61, 0x3f4154e1,
-  0x3f273656, 0x3f41d870, 0x3f269de3, 0x3f425b89, 0x3f26050a, 0x3f42de29, 0x3f256bcb, 0x3f436051,
-  0x3f24d225, 0x3f43e200, 0x3f24381a, 0x3f446337, 0x3f239da9, 0x3f44e3f5, 0x3f2302d3, 0x3f456439,
-  0x3f226799, 0x3f45e403, 0x3f21cbfb, 0x3f466354, 0x3f212ff9, 0x3f46e22a, 0x3f209393, 0x3f476085,
-  0x3f1ff6cb, 0x3f47de65, 0x3f1f599f, 0x3f485bca, 0x3f1ebc12, 0x3f48d8b3, 0x3f1e1e22, 0x3f495521,
-  0x3f1d7fd1, 0x3f49d112, 0x3f1ce11f, 0x3f4a4c87, 0x3f1c420c, 0x3f4ac77f, 0x3f1ba299, 0x3f4b41fa,
-  0x3f1b02c6, 0x3f4bbbf8, 0x3f1a6293, 0x3f4c3578, 0x3f19c200, 0x3f4cae79, 0x3f19210f, 0x3f4d26fd,
-  0x3f187fc0, 0x3f4d9f02, 0x3f17de12, 0x3f4e1689, 0x3f173c07, 0x3f4e8d90, 0x3f16999f, 0x3f4f0417,
-  0x3f15f6d9, 0x3f4f7a1f, 0x3f1553b7, 0x3f4fefa8, 0x3f14b039, 0x3f5064af, 0x3f140c5f, 0x3f50d937,
-  0x3f13682a, 0x3f514d3d, 0x3f12c39a, 0x3f51c0c2, 0x3f121eb0, 0x3f5233c6, 0x3f11796b, 0x3f52a649,
-  0x3f10d3cd, 0x3f531849, 0x3f102dd5, 0x3f5389c7, 0x3f0f8784, 0x3f53fac3, 0x3f0ee0db, 0x3f546b3b,
-  0x3f0e39da, 0x3f54db31, 0x3f0d9281, 0x3f554aa4, 0x3f0cead0, 0x3f55b993, 0x3f0c42c9, 0x3f5627fe,
-  0x3f0b9a6b, 0x3f5695e5, 0x3f0af1b7, 0x3f570348, 0x3f0a48ad, 0x3f577026, 0x3f099f4e, 0x3f57dc7f,
-  0x3f08f59b, 0x3f584853, 0x3f084b92, 0x3f58b3a1, 0x3f07a136, 0x3f591e6a, 0x3f06f686, 0x3f5988ad,
-  0x3f064b82, 0x3f59f26a, 0x3f05a02c, 0x3f5a5ba0, 0x3f04f484, 0x3f5ac450, 0x3f044889, 0x3f5b2c79,
-  0x3f039c3d, 0x3f5b941a, 0x3f02ef9f, 0x3f5bfb34, 0x3f0242b1, 0x3f5c61c7, 0x3f019573, 0x3f5cc7d1,
-  0x3f00e7e4, 0x3f5d2d53, 0x3f003a06, 0x3f5d924d, 0x3eff17b2, 0x3f5df6be, 0x3efdbabb, 0x3f5e5aa6,
-  0x3efc5d27, 0x3f5ebe05, 0x3efafef7, 0x3f5f20db, 0x3ef9a02d, 0x3f5f8327, 0x3ef840c8, 0x3f5fe4e9,
-  0x3ef6e0cb, 0x3f604621, 0x3ef58035, 0x3f60a6cf, 0x3ef41f07, 0x3f6106f2, 0x3ef2bd43, 0x3f61668a,
-  0x3ef15aea, 0x3f61c598, 0x3eeff7fb, 0x3f62241a, 0x3eee9479, 0x3f628210, 0x3eed3063, 0x3f62df7b,
-  0x3eebcbbb, 0x3f633c5a, 0x3eea6681, 0x3f6398ac, 0x3ee900b7, 0x3f63f473, 0x3ee79a5d, 0x3f644fac,
-  0x3ee63375, 0x3f64aa59, 0x3ee4cbfe, 0x3f650479, 0x3ee363fa, 0x3f655e0b, 0x3ee1fb6a, 0x3f65b710,
-  0x3ee0924f, 0x3f660f88, 0x3edf28a9, 0x3f666771, 0x3eddbe79, 0x3f66becc, 0x3edc53c1, 0x3f671599,
-  0x3edae880, 0x3f676bd8, 0x3ed97cb9, 0x3f67c187, 0x3ed8106b, 0x3f6816a8, 0x3ed6a399, 0x3f686b39,
-  0x3ed53641, 0x3f68bf3c, 0x3ed3c867, 0x3f6912ae, 0x3ed25a09, 0x3f696591, 0x3ed0eb2a, 0x3f69b7e4,
-  0x3ecf7bca, 0x3f6a09a7, 0x3ece0bea, 0x3f6a5ad9, 0x3ecc9b8b, 0x3f6aab7b, 0x3ecb2aae, 0x3f6afb8c,
-  0x3ec9b953, 0x3f6b4b0c, 0x3ec8477c, 0x3f6b99fb, 0x3ec6d529, 0x3f6be858, 0x3ec5625c, 0x3f6c3624,
-  0x3ec3ef15, 0x3f6c835e, 0x3ec27b55, 0x3f6cd007, 0x3ec1071e, 0x3f6d1c1d, 0x3ebf926f, 0x3f6d67a1,
-  0x3ebe1d4a, 0x3f6db293, 0x3ebca7af, 0x3f6dfcf2, 0x3ebb31a0, 0x3f6e46be, 0x3eb9bb1e, 0x3f6e8ff8,
-  0x3eb8442a, 0x3f6ed89e, 0x3eb6ccc3, 0x3f6f20b0, 0x3eb554ec, 0x3f6f6830, 0x3eb3dca5, 0x3f6faf1b,
-  0x3eb263ef, 0x3f6ff573, 0x3eb0eacb, 0x3f703b37, 0x3eaf713a, 0x3f708066, 0x3eadf73c, 0x3f70c502,
-  0x3eac7cd4, 0x3f710908, 0x3eab0201, 0x3f714c7a, 0x3ea986c4, 0x3f718f57, 0x3ea80b1f, 0x3f71d19f,
-  0x3ea68f12, 0x3f721352, 0x3ea5129f, 0x3f725470, 0x3ea395c5, 0x3f7294f8, 0x3ea21887, 0x3f72d4eb,
-  0x3ea09ae5, 0x3f731447, 0x3e9f1cdf, 0x3f73530e, 0x3e9d9e78, 0x3f73913f, 0x3e9c1faf, 0x3f73ced9,
-  0x3e9aa086, 0x3f740bdd, 0x3e9920fe, 0x3f74484b, 0x3e97a117, 0x3f748422, 0x3e9620d2, 0x3f74bf62,
-  0x3e94a031, 0x3f74fa0b, 0x3e931f35, 0x3f75341d, 0x3e919ddd, 0x3f756d97, 0x3e901c2c, 0x3f75a67b,
-  0x3e8e9a22, 0x3f75dec6, 0x3e8d17c0, 0x3f76167a, 0x3e8b9507, 0x3f764d97, 0x3e8a11f8, 0x3f76841b,
-  0x3e888e93, 0x3f76ba07, 0x3e870ada, 0x3f76ef5b, 0x3e8586ce, 0x3f772417, 0x3e840270, 0x3f77583a,
-  0x3e827dc0, 0x3f778bc5, 0x3e80f8c0, 0x3f77beb7, 0x3e7ee6e1, 0x3f77f110, 0x3e7bdba4, 0x3f7822d1,
-  0x3e78cfcc, 0x3f7853f8, 0x3e75c35a, 0x3f788486, 0x3e72b651, 0x3f78b47b, 0x3e6fa8b2, 0x3f78e3d6,
-  0x3e6c9a7f, 0x3f791298, 0x3e698bba, 0x3f7940c0, 0x3e667c66, 0x3f796e4e, 0x3e636c83, 0x3f799b43,
-  0x3e605c13, 0x3f79c79d, 0x3e5d4b1a, 0x3f79f35e, 0x3e5a3997, 0x3f7a1e84, 0x3e57278f, 0x3f7a4910,
-  0x3e541501, 0x3f7a7302, 0x3e5101f1, 0x3f7a9c59, 0x3e4dee60, 0x3f7ac516, 0x3e4ada4f, 0x3f7aed37,
-  0x3e47c5c2, 0x3f7b14be, 0x3e44b0b9, 0x3f7b3bab, 0x3e419b37, 0x3f7b61fc, 0x3e3e853e, 0x3f7b87b2,
-  0x3e3b6ecf, 0x3f7baccd, 0x3e3857ec, 0x3f7bd14d, 0x3e354098, 0x3f7bf531, 0x3e3228d4, 0x3f7c187a,
-  0x3e2f10a2, 0x3f7c3b28, 0x3e2bf804, 0x3f7c5d3a, 0x3e28defc, 0x3f7c7eb0, 0x3e25c58c, 0x3f7c9f8a,
-  0x3e22abb6, 0x3f7cbfc9, 0x3e1f917b, 0x3f7cdf6c, 0x3e1c76de, 0x3f7cfe73, 0x3e195be0, 0x3f7d1cdd,
-  0x3e164083, 0x3f7d3aac, 0x3e1324ca, 0x3f7d57de, 0x3e1008b7, 0x3f7d7474, 0x3e0cec4a, 0x3f7d906e,
-  0x3e09cf86, 0x3f7dabcc, 0x3e06b26e, 0x3f7dc68c, 0x3e039502, 0x3f7de0b1, 0x3e007745, 0x3f7dfa38,
-  0x3dfab273, 0x3f7e1324, 0x3df475c0, 0x3f7e2b72, 0x3dee3876, 0x3f7e4323, 0x3de7fa9a, 0x3f7e5a38,
-  0x3de1bc2e, 0x3f7e70b0, 0x3ddb7d37, 0x3f7e868b, 0x3dd53db9, 0x3f7e9bc9, 0x3dcefdb7, 0x3f7eb069,
-  0x3dc8bd36, 0x3f7ec46d, 0x3dc27c39, 0x3f7ed7d4, 0x3dbc3ac3, 0x3f7eea9d, 0x3db5f8da, 0x3f7efcc9,
-  0x3dafb680, 0x3f7f0e58, 0x3da973ba, 0x3f7f1f49, 0x3da3308c, 0x3f7f2f9d, 0x3d9cecf9, 0x3f7f3f54,
-  0x3d96a905, 0x3f7f4e6d, 0x3d9064b4, 0x3f7f5ce9, 0x3d8a200a, 0x3f7f6ac7, 0x3d83db0a, 0x3f7f7808,
-  0x3d7b2b74, 0x3f7f84ab, 0x3d6ea038, 0x3f7f90b1, 0x3d621468, 0x3f7f9c18, 0x3d55880e, 0x3f7fa6e3,
-  0x3d48fb2f, 0x3f7fb10f, 0x3d3c6dd5, 0x3f7fba9e, 0x3d2fe007, 0x3f7fc38f, 0x3d2351cc, 0x3f7fcbe2,
-  0x3d16c32c, 0x3f7fd398, 0x3d0a342f, 0x3f7fdaaf, 0x3cfb49b9, 0x3f7fe129, 0x3ce22a7b, 0x3f7fe705,
-  0x3cc90ab0, 0x3f7fec43, 0x3cafea69, 0x3f7ff0e3, 0x3c96c9b6, 0x3f7ff4e6, 0x3c7b514b, 0x3f7ff84a,
-  0x3c490e90, 0x3f7ffb11, 0x3c16cb59, 0x3f7ffd39, 0x3bc90f89, 0x3f7ffec4, 0x3b490fc7, 0x3f7fffb1,
-  0x00000000, 0x3f800000, 0xbb490fc7, 0x3f7fffb1, 0xbbc90f89, 0x3f7ffec4, 0xbc16cb59, 0x3f7ffd39,
-  0xbc490e90, 0x3f7ffb11, 0xbc7b514b, 0x3f7ff84a, 0xbc96c9b6, 0x3f7ff4e6, 0xbcafea69, 0x3f7ff0e3,
-  0xbcc90ab0, 0x3f7fec43, 0xbce22a7b, 0x3f7fe705, 0xbcfb49b9, 0x3f7fe129, 0xbd0a342f, 0x3f7fdaaf,
-  0xbd16c32c, 0x3f7fd398, 0xbd2351cc, 0x3f7fcbe2, 0xbd2fe007, 0x3f7fc38f, 0xbd3c6dd5, 0x3f7fba9e,
-  0xbd48fb2f, 0x3f7fb10f, 0xbd55880e, 0x3f7fa6e3, 0xbd621468, 0x3f7f9c18, 0xbd6ea038, 0x3f7f90b1,
-  0xbd7b2b74, 0x3f7f84ab, 0xbd83db0a, 0x3f7f7808, 0xbd8a200a, 0x3f7f6ac7, 0xbd9064b4, 0x3f7f5ce9,
-  0xbd96a905, 0x3f7f4e6d, 0xbd9cecf9, 0x3f7f3f54, 0xbda3308c, 0x3f7f2f9d, 0xbda973ba, 0x3f7f1f49,
-  0xbdafb680, 0x3f7f0e58, 0xbdb5f8da, 0x3f7efcc9, 0xbdbc3ac3, 0x3f7eea9d, 0xbdc27c39, 0x3f7ed7d4,
-  0xbdc8bd36, 0x3f7ec46d, 0xbdcefdb7, 0x3f7eb069, 0xbdd53db9, 0x3f7e9bc9, 0xbddb7d37, 0x3f7e868b,
-  0xbde1bc2e, 0x3f7e70b0, 0xbde7fa9a, 0x3f7e5a38, 0xbdee3876, 0x3f7e4323, 0xbdf475c0, 0x3f7e2b72,
-  0xbdfab273, 0x3f7e1324, 0xbe007745, 0x3f7dfa38, 0xbe039502, 0x3f7de0b1, 0xbe06b26e, 0x3f7dc68c,
-  0xbe09cf86, 0x3f7dabcc, 0xbe0cec4a, 0x3f7d906e, 0xbe1008b7, 0x3f7d7474, 0xbe1324ca, 0x3f7d57de,
-  0xbe164083, 0x3f7d3aac, 0xbe195be0, 0x3f7d1cdd, 0xbe1c76de, 0x3f7cfe73, 0xbe1f917b, 0x3f7cdf6c,
-  0xbe22abb6, 0x3f7cbfc9, 0xbe25c58c, 0x3f7c9f8a, 0xbe28defc, 0x3f7c7eb0, 0xbe2bf804, 0x3f7c5d3a,
-  0xbe2f10a2, 0x3f7c3b28, 0xbe3228d4, 0x3f7c187a, 0xbe354098, 0x3f7bf531, 0xbe3857ec, 0x3f7bd14d,
-  0xbe3b6ecf, 0x3f7baccd, 0xbe3e853e, 0x3f7b87b2, 0xbe419b37, 0x3f7b61fc, 0xbe44b0b9, 0x3f7b3bab,
-  0xbe47c5c2, 0x3f7b14be, 0xbe4ada4f, 0x3f7aed37, 0xbe4dee60, 0x3f7ac516, 0xbe5101f1, 0x3f7a9c59,
-  0xbe541501, 0x3f7a7302, 0xbe57278f, 0x3f7a4910, 0xbe5a3997, 0x3f7a1e84, 0xbe5d4b1a, 0x3f79f35e,
-  0xbe605c13, 0x3f79c79d, 0xbe636c83, 0x3f799b43, 0xbe667c66, 0x3f796e4e, 0xbe698bba, 0x3f7940c0,
-  0xbe6c9a7f, 0x3f791298, 0xbe6fa8b2, 0x3f78e3d6, 0xbe72b651, 0x3f78b47b, 0xbe75c35a, 0x3f788486,
-  0xbe78cfcc, 0x3f7853f8, 0xbe7bdba4, 0x3f7822d1, 0xbe7ee6e1, 0x3f77f110, 0xbe80f8c0, 0x3f77beb7,
-  0xbe827dc0, 0x3f778bc5, 0xbe840270, 0x3f77583a, 0xbe8586ce, 0x3f772417, 0xbe870ada, 0x3f76ef5b,
-  0xbe888e93, 0x3f76ba07, 0xbe8a11f8, 0x3f76841b, 0xbe8b9507, 0x3f764d97, 0xbe8d17c0, 0x3f76167a,
-  0xbe8e9a22, 0x3f75dec6, 0xbe901c2c, 0x3f75a67b, 0xbe919ddd, 0x3f756d97, 0xbe931f35, 0x3f75341d,
-  0xbe94a031, 0x3f74fa0b, 0xbe9620d2, 0x3f74bf62, 0xbe97a117, 0x3f748422, 0xbe9920fe, 0x3f74484b,
-  0xbe9aa086, 0x3f740bdd, 0xbe9c1faf, 0x3f73ced9, 0xbe9d9e78, 0x3f73913f, 0xbe9f1cdf, 0x3f73530e,
-  0xbea09ae5, 0x3f731447, 0xbea21887, 0x3f72d4eb, 0xbea395c5, 0x3f7294f8, 0xbea5129f, 0x3f725470,
-  0xbea68f12, 0x3f721352, 0xbea80b1f, 0x3f71d19f, 0xbea986c4, 0x3f718f57, 0xbeab0201, 0x3f714c7a,
-  0xbeac7cd4, 0x3f710908, 0xbeadf73c, 0x3f70c502, 0xbeaf713a, 0x3f708066, 0xbeb0eacb, 0x3f703b37,
-  0xbeb263ef, 0x3f6ff573, 0xbeb3dca5, 0x3f6faf1b, 0xbeb554ec, 0x3f6f6830, 0xbeb6ccc3, 0x3f6f20b0,
-  0xbeb8442a, 0x3f6ed89e, 0xbeb9bb1e, 0x3f6e8ff8, 0xbebb31a0, 0x3f6e46be, 0xbebca7af, 0x3f6dfcf2,
-  0xbebe1d4a, 0x3f6db293, 0xbebf926f, 0x3f6d67a1, 0xbec1071e, 0x3f6d1c1d, 0xbec27b55, 0x3f6cd007,
-  0xbec3ef15, 0x3f6c835e, 0xbec5625c, 0x3f6c3624, 0xbec6d529, 0x3f6be858, 0xbec8477c, 0x3f6b99fb,
-  0xbec9b953, 0x3f6b4b0c, 0xbecb2aae, 0x3f6afb8c, 0xbecc9b8b, 0x3f6aab7b, 0xbece0bea, 0x3f6a5ad9,
-  0xbecf7bca, 0x3f6a09a7, 0xbed0eb2a, 0x3f69b7e4, 0xbed25a09, 0x3f696591, 0xbed3c867, 0x3f6912ae,
-  0xbed53641, 0x3f68bf3c, 0xbed6a399, 0x3f686b39, 0xbed8106b, 0x3f6816a8, 0xbed97cb9, 0x3f67c187,
-  0xbedae880, 0x3f676bd8, 0xbedc53c1, 0x3f671599, 0xbeddbe79, 0x3f66becc, 0xbedf28a9, 0x3f666771,
-  0xbee0924f, 0x3f660f88, 0xbee1fb6a, 0x3f65b710, 0xbee363fa, 0x3f655e0b, 0xbee4cbfe, 0x3f650479,
-  0xbee63375, 0x3f64aa59, 0xbee79a5d, 0x3f644fac, 0xbee900b7, 0x3f63f473, 0xbeea6681, 0x3f6398ac,
-  0xbeebcbbb, 0x3f633c5a, 0xbeed3063, 0x3f62df7b, 0xbeee9479, 0x3f628210, 0xbeeff7fb, 0x3f62241a,
-  0xbef15aea, 0x3f61c598, 0xbef2bd43, 0x3f61668a, 0xbef41f07, 0x3f6106f2, 0xbef58035, 0x3f60a6cf,
-  0xbef6e0cb, 0x3f604621, 0xbef840c8, 0x3f5fe4e9, 0xbef9a02d, 0x3f5f8327, 0xbefafef7, 0x3f5f20db,
-  0xbefc5d27, 0x3f5ebe05, 0xbefdbabb, 0x3f5e5aa6, 0xbeff17b2, 0x3f5df6be, 0xbf003a06, 0x3f5d924d,
-  0xbf00e7e4, 0x3f5d2d53, 0xbf019573, 0x3f5cc7d1, 0xbf0242b1, 0x3f5c61c7, 0xbf02ef9f, 0x3f5bfb34,
-  0xbf039c3d, 0x3f5b941a, 0xbf044889, 0x3f5b2c79, 0xbf04f484, 0x3f5ac450, 0xbf05a02c, 0x3f5a5ba0,
-  0xbf064b82, 0x3f59f26a, 0xbf06f686, 0x3f5988ad, 0xbf07a136, 0x3f591e6a, 0xbf084b92, 0x3f58b3a1,
-  0xbf08f59b, 0x3f584853, 0xbf099f4e, 0x3f57dc7f, 0xbf0a48ad, 0x3f577026, 0xbf0af1b7, 0x3f570348,
-  0xbf0b9a6b, 0x3f5695e5, 0xbf0c42c9, 0x3f5627fe, 0xbf0cead0, 0x3f55b993, 0xbf0d9281, 0x3f554aa4,
-  0xbf0e39da, 0x3f54db31, 0xbf0ee0db, 0x3f546b3b, 0xbf0f8784, 0x3f53fac3, 0xbf102dd5, 0x3f5389c7,
-  0xbf10d3cd, 0x3f531849, 0xbf11796b, 0x3f52a649, 0xbf121eb0, 0x3f5233c6, 0xbf12c39a, 0x3f51c0c2,
-  0xbf13682a, 0x3f514d3d, 0xbf140c5f, 0x3f50d937, 0xbf14b039, 0x3f5064af, 0xbf1553b7, 0x3f4fefa8,
-  0xbf15f6d9, 0x3f4f7a1f, 0xbf16999f, 0x3f4f0417, 0xbf173c07, 0x3f4e8d90, 0xbf17de12, 0x3f4e1689,
-  0xbf187fc0, 0x3f4d9f02, 0xbf19210f, 0x3f4d26fd, 0xbf19c200, 0x3f4cae79, 0xbf1a6293, 0x3f4c3578,
-  0xbf1b02c6, 0x3f4bbbf8, 0xbf1ba299, 0x3f4b41fa, 0xbf1c420c, 0x3f4ac77f, 0xbf1ce11f, 0x3f4a4c87,
-  0xbf1d7fd1, 0x3f49d112, 0xbf1e1e22, 0x3f495521, 0xbf1ebc12, 0x3f48d8b3, 0xbf1f599f, 0x3f485bca,
-  0xbf1ff6cb, 0x3f47de65, 0xbf209393, 0x3f476085, 0xbf212ff9, 0x3f46e22a, 0xbf21cbfb, 0x3f466354,
-  0xbf226799, 0x3f45e403, 0xbf2302d3, 0x3f456439, 0xbf239da9, 0x3f44e3f5, 0xbf24381a, 0x3f446337,
-  0xbf24d225, 0x3f43e200, 0xbf256bcb, 0x3f436051, 0xbf26050a, 0x3f42de29, 0xbf269de3, 0x3f425b89,
-  0xbf273656, 0x3f41d870, 0xbf27ce61, 0x3f4154e1, 0xbf286605, 0x3f40d0da, 0xbf28fd41, 0x3f404c5c,
-  0xbf299415, 0x3f3fc767, 0xbf2a2a80, 0x3f3f41fc, 0xbf2ac082, 0x3f3ebc1b, 0xbf2b561b, 0x3f3e35c5,
-  0xbf2beb4a, 0x3f3daef9, 0xbf2c800f, 0x3f3d27b8, 0xbf2d1469, 0x3f3ca003, 0xbf2da859, 0x3f3c17d9,
-  0xbf2e3bde, 0x3f3b8f3b, 0xbf2ecef7, 0x3f3b0629, 0xbf2f61a5, 0x3f3a7ca4, 0xbf2ff3e6, 0x3f39f2ac,
-  0xbf3085bb, 0x3f396842, 0xbf311722, 0x3f38dd65, 0xbf31a81d, 0x3f385216, 0xbf3238aa, 0x3f37c655,
-  0xbf32c8c9, 0x3f373a23, 0xbf33587a, 0x3f36ad7f, 0xbf33e7bc, 0x3f36206c, 0xbf34768f, 0x3f3592e7,
-  0xbf3504f3, 0x3f3504f3, 0xbf3592e7, 0x3f34768f, 0xbf36206c, 0x3f33e7bc, 0xbf36ad7f, 0x3f33587a,
-  0xbf373a23, 0x3f32c8c9, 0xbf37c655, 0x3f3238aa, 0xbf385216, 0x3f31a81d, 0xbf38dd65, 0x3f311722,
-  0xbf396842, 0x3f3085bb, 0xbf39f2ac, 0x3f2ff3e6, 0xbf3a7ca4, 0x3f2f61a5, 0xbf3b0629, 0x3f2ecef7,
-  0xbf3b8f3b, 0x3f2e3bde, 0xbf3c17d9, 0x3f2da859, 0xbf3ca003, 0x3f2d1469, 0xbf3d27b8, 0x3f2c800f,
-  0xbf3daef9, 0x3f2beb4a, 0xbf3e35c5, 0x3f2b561b, 0xbf3ebc1b, 0x3f2ac082, 0xbf3f41fc, 0x3f2a2a80,
-  0xbf3fc767, 0x3f299415, 0xbf404c5c, 0x3f28fd41, 0xbf40d0da, 0x3f286605, 0xbf4154e1, 0x3f27ce61,
-  0xbf41d870, 0x3f273656, 0xbf425b89, 0x3f269de3, 0xbf42de29, 0x3f26050a, 0xbf436051, 0x3f256bcb,
-  0xbf43e200, 0x3f24d225, 0xbf446337, 0x3f24381a, 0xbf44e3f5, 0x3f239da9, 0xbf456439, 0x3f2302d3,
-  0xbf45e403, 0x3f226799, 0xbf466354, 0x3f21cbfb, 0xbf46e22a, 0x3f212ff9, 0xbf476085, 0x3f209393,
-  0xbf47de65, 0x3f1ff6cb, 0xbf485bca, 0x3f1f599f, 0xbf48d8b3, 0x3f1ebc12, 0xbf495521, 0x3f1e1e22,
-  0xbf49d112, 0x3f1d7fd1, 0xbf4a4c87, 0x3f1ce11f, 0xbf4ac77f, 0x3f1c420c, 0xbf4b41fa, 0x3f1ba299,
-  0xbf4bbbf8, 0x3f1b02c6, 0xbf4c3578, 0x3f1a6293, 0xbf4cae79, 0x3f19c200, 0xbf4d26fd, 0x3f19210f,
-  0xbf4d9f02, 0x3f187fc0, 0xbf4e1689, 0x3f17de12, 0xbf4e8d90, 0x3f173c07, 0xbf4f0417, 0x3f16999f,
-  0xbf4f7a1f, 0x3f15f6d9, 0xbf4fefa8, 0x3f1553b7, 0xbf5064af, 0x3f14b039, 0xbf50d937, 0x3f140c5f,
-  0xbf514d3d, 0x3f13682a, 0xbf51c0c2, 0x3f12c39a, 0xbf5233c6, 0x3f121eb0, 0xbf52a649, 0x3f11796b,
-  0xbf531849, 0x3f10d3cd, 0xbf5389c7, 0x3f102dd5, 0xbf53fac3, 0x3f0f8784, 0xbf546b3b, 0x3f0ee0db,
-  0xbf54db31, 0x3f0e39da, 0xbf554aa4, 0x3f0d9281, 0xbf55b993, 0x3f0cead0, 0xbf5627fe, 0x3f0c42c9,
-  0xbf5695e5, 0x3f0b9a6b, 0xbf570348, 0x3f0af1b7, 0xbf577026, 0x3f0a48ad, 0xbf57dc7f, 0x3f099f4e,
-  0xbf584853, 0x3f08f59b, 0xbf58b3a1, 0x3f084b92, 0xbf591e6a, 0x3f07a136, 0xbf5988ad, 0x3f06f686,
-  0xbf59f26a, 0x3f064b82, 0xbf5a5ba0, 0x3f05a02c, 0xbf5ac450, 0x3f04f484, 0xbf5b2c79, 0x3f044889,
-  0xbf5b941a, 0x3f039c3d, 0xbf5bfb34, 0x3f02ef9f, 0xbf5c61c7, 0x3f0242b1, 0xbf5cc7d1, 0x3f019573,
-  0xbf5d2d53, 0x3f00e7e4, 0xbf5d924d, 0x3f003a06, 0xbf5df6be, 0x3eff17b2, 0xbf5e5aa6, 0x3efdbabb,
-  0xbf5ebe05, 0x3efc5d27, 0xbf5f20db, 0x3efafef7, 0xbf5f8327, 0x3ef9a02d, 0xbf5fe4e9, 0x3ef840c8,
-  0xbf604621, 0x3ef6e0cb, 0xbf60a6cf, 0x3ef58035, 0xbf6106f2, 0x3ef41f07, 0xbf61668a, 0x3ef2bd43,
-  0xbf61c598, 0x3ef15aea, 0xbf62241a, 0x3eeff7fb, 0xbf628210, 0x3eee9479, 0xbf62df7b, 0x3eed3063,
-  0xbf633c5a, 0x3eebcbbb, 0xbf6398ac, 0x3eea6681, 0xbf63f473, 0x3ee900b7, 0xbf644fac, 0x3ee79a5d,
-  0xbf64aa59, 0x3ee63375, 0xbf650479, 0x3ee4cbfe, 0xbf655e0b, 0x3ee363fa, 0xbf65b710, 0x3ee1fb6a,
-  0xbf660f88, 0x3ee0924f, 0xbf666771, 0x3edf28a9, 0xbf66becc, 0x3eddbe79, 0xbf671599, 0x3edc53c1,
-  0xbf676bd8, 0x3edae880, 0xbf67c187, 0x3ed97cb9, 0xbf6816a8, 0x3ed8106b, 0xbf686b39, 0x3ed6a399,
-  0xbf68bf3c, 0x3ed53641, 0xbf6912ae, 0x3ed3c867, 0xbf696591, 0x3ed25a09, 0xbf69b7e4, 0x3ed0eb2a,
-  0xbf6a09a7, 0x3ecf7bca, 0xbf6a5ad9, 0x3ece0bea, 0xbf6aab7b, 0x3ecc9b8b, 0xbf6afb8c, 0x3ecb2aae,
-  0xbf6b4b0c, 0x3ec9b953, 0xbf6b99fb, 0x3ec8477c, 0xbf6be858, 0x3ec6d529, 0xbf6c3624, 0x3ec5625c,
-  0xbf6c835e, 0x3ec3ef15, 0xbf6cd007, 0x3ec27b55, 0xbf6d1c1d, 0x3ec1071e, 0xbf6d67a1, 0x3ebf926f,
-  0xbf6db293, 0x3ebe1d4a, 0xbf6dfcf2, 0x3ebca7af, 0xbf6e46be, 0x3ebb31a0, 0xbf6e8ff8, 0x3eb9bb1e,
-  0xbf6ed89e, 0x3eb8442a, 0xbf6f20b0, 0x3eb6ccc3, 0xbf6f6830, 0x3eb554ec, 0xbf6faf1b, 0x3eb3dca5,
-  0xbf6ff573, 0x3eb263ef, 0xbf703b37, 0x3eb0eacb, 0xbf708066, 0x3eaf713a, 0xbf70c502, 0x3eadf73c,
-  0xbf710908, 0x3eac7cd4, 0xbf714c7a, 0x3eab0201, 0xbf718f57, 0x3ea986c4, 0xbf71d19f, 0x3ea80b1f,
-  0xbf721352, 0x3ea68f12, 0xbf725470, 0x3ea5129f, 0xbf7294f8, 0x3ea395c5, 0xbf72d4eb, 0x3ea21887,
-  0xbf731447, 0x3ea09ae5, 0xbf73530e, 0x3e9f1cdf, 0xbf73913f, 0x3e9d9e78, 0xbf73ced9, 0x3e9c1faf,
-  0xbf740bdd, 0x3e9aa086, 0xbf74484b, 0x3e9920fe, 0xbf748422, 0x3e97a117, 0xbf74bf62, 0x3e9620d2,
-  0xbf74fa0b, 0x3e94a031, 0xbf75341d, 0x3e931f35, 0xbf756d97, 0x3e919ddd, 0xbf75a67b, 0x3e901c2c,
-  0xbf75dec6, 0x3e8e9a22, 0xbf76167a, 0x3e8d17c0, 0xbf764d97, 0x3e8b9507, 0xbf76841b, 0x3e8a11f8,
-  0xbf76ba07, 0x3e888e93, 0xbf76ef5b, 0x3e870ada, 0xbf772417, 0x3e8586ce, 0xbf77583a, 0x3e840270,
-  0xbf778bc5, 0x3e827dc0, 0xbf77beb7, 0x3e80f8c0, 0xbf77f110, 0x3e7ee6e1, 0xbf7822d1, 0x3e7bdba4,
-  0xbf7853f8, 0x3e78cfcc, 0xbf788486, 0x3e75c35a, 0xbf78b47b, 0x3e72b651, 0xbf78e3d6, 0x3e6fa8b2,
-  0xbf791298, 0x3e6c9a7f, 0xbf7940c0, 0x3e698bba, 0xbf796e4e, 0x3e667c66, 0xbf799b43, 0x3e636c83,
-  0xbf79c79d, 0x3e605c13, 0xbf79f35e, 0x3e5d4b1a, 0xbf7a1e84, 0x3e5a3997, 0xbf7a4910, 0x3e57278f,
-  0xbf7a7302, 0x3e541501, 0xbf7a9c59, 0x3e5101f1, 0xbf7ac516, 0x3e4dee60, 0xbf7aed37, 0x3e4ada4f,
-  0xbf7b14be, 0x3e47c5c2, 0xbf7b3bab, 0x3e44b0b9, 0xbf7b61fc, 0x3e419b37, 0xbf7b87b2, 0x3e3e853e,
-  0xbf7baccd, 0x3e3b6ecf, 0xbf7bd14d, 0x3e3857ec, 0xbf7bf531, 0x3e354098, 0xbf7c187a, 0x3e3228d4,
-  0xbf7c3b28, 0x3e2f10a2, 0xbf7c5d3a, 0x3e2bf804, 0xbf7c7eb0, 0x3e28defc, 0xbf7c9f8a, 0x3e25c58c,
-  0xbf7cbfc9, 0x3e22abb6, 0xbf7cdf6c, 0x3e1f917b, 0xbf7cfe73, 0x3e1c76de, 0xbf7d1cdd, 0x3e195be0,
-  0xbf7d3aac, 0x3e164083, 0xbf7d57de, 0x3e1324ca, 0xbf7d7474, 0x3e1008b7, 0xbf7d906e, 0x3e0cec4a,
-  0xbf7dabcc, 0x3e09cf86, 0xbf7dc68c, 0x3e06b26e, 0xbf7de0b1, 0x3e039502, 0xbf7dfa38, 0x3e007745,
-  0xbf7e1324, 0x3dfab273, 0xbf7e2b72, 0x3df475c0, 0xbf7e4323, 0x3dee3876, 0xbf7e5a38, 0x3de7fa9a,
-  0xbf7e70b0, 0x3de1bc2e, 0xbf7e868b, 0x3ddb7d37, 0xbf7e9bc9, 0x3dd53db9, 0xbf7eb069, 0x3dcefdb7,
-  0xbf7ec46d, 0x3dc8bd36, 0xbf7ed7d4, 0x3dc27c39, 0xbf7eea9d, 0x3dbc3ac3, 0xbf7efcc9, 0x3db5f8da,
-  0xbf7f0e58, 0x3dafb680, 0xbf7f1f49, 0x3da973ba, 0xbf7f2f9d, 0x3da3308c, 0xbf7f3f54, 0x3d9cecf9,
-  0xbf7f4e6d, 0x3d96a905, 0xbf7f5ce9, 0x3d9064b4, 0xbf7f6ac7, 0x3d8a200a, 0xbf7f7808, 0x3d83db0a,
-  0xbf7f84ab, 0x3d7b2b74, 0xbf7f90b1, 0x3d6ea038, 0xbf7f9c18, 0x3d621468, 0xbf7fa6e3, 0x3d55880e,
-  0xbf7fb10f, 0x3d48fb2f, 0xbf7fba9e, 0x3d3c6dd5, 0xbf7fc38f, 0x3d2fe007, 0xbf7fcbe2, 0x3d2351cc,
-  0xbf7fd398, 0x3d16c32c, 0xbf7fdaaf, 0x3d0a342f, 0xbf7fe129, 0x3cfb49b9, 0xbf7fe705, 0x3ce22a7b,
-  0xbf7fec43, 0x3cc90ab0, 0xbf7ff0e3, 0x3cafea69, 0xbf7ff4e6, 0x3c96c9b6, 0xbf7ff84a, 0x3c7b514b,
-  0xbf7ffb11, 0x3c490e90, 0xbf7ffd39, 0x3c16cb59, 0xbf7ffec4, 0x3bc90f89, 0xbf7fffb1, 0x3b490fc7,
-  0xbf800000, 0x00000000, 0xbf7fffb1, 0xbb490fc7, 0xbf7ffec4, 0xbbc90f89, 0xbf7ffd39, 0xbc16cb59,
-  0xbf7ffb11, 0xbc490e90, 0xbf7ff84a, 0xbc7b514b, 0xbf7ff4e6, 0xbc96c9b6, 0xbf7ff0e3, 0xbcafea69,
-  0xbf7fec43, 0xbcc90ab0, 0xbf7fe705, 0xbce22a7b, 0xbf7fe129, 0xbcfb49b9, 0xbf7fdaaf, 0xbd0a342f,
-  0xbf7fd398, 0xbd16c32c, 0xbf7fcbe2, 0xbd2351cc, 0xbf7fc38f, 0xbd2fe007, 0xbf7fba9e, 0xbd3c6dd5,
-  0xbf7fb10f, 0xbd48fb2f, 0xbf7fa6e3, 0xbd55880e, 0xbf7f9c18, 0xbd621468, 0xbf7f90b1, 0xbd6ea038,
-  0xbf7f84ab, 0xbd7b2b74, 0xbf7f7808, 0xbd83db0a, 0xbf7f6ac7, 0xbd8a200a, 0xbf7f5ce9, 0xbd9064b4,
-  0xbf7f4e6d, 0xbd96a905, 0xbf7f3f54, 0xbd9cecf9, 0xbf7f2f9d, 0xbda3308c, 0xbf7f1f49, 0xbda973ba,
-  0xbf7f0e58, 0xbdafb680, 0xbf7efcc9, 0xbdb5f8da, 0xbf7eea9d, 0xbdbc3ac3, 0xbf7ed7d4, 0xbdc27c39,
-  0xbf7ec46d, 0xbdc8bd36, 0xbf7eb069, 0xbdcefdb7, 0xbf7e9bc9, 0xbdd53db9, 0xbf7e868b, 0xbddb7d37,
-  0xbf7e70b0, 0xbde1bc2e, 0xbf7e5a38, 0xbde7fa9a, 0xbf7e4323, 0xbdee3876, 0xbf7e2b72, 0xbdf475c0,
-  0xbf7e1324, 0xbdfab273, 0xbf7dfa38, 0xbe007745, 0xbf7de0b1, 0xbe039502, 0xbf7dc68c, 0xbe06b26e,
-  0xbf7dabcc, 0xbe09cf86, 0xbf7d906e, 0xbe0cec4a, 0xbf7d7474, 0xbe1008b7, 0xbf7d57de, 0xbe1324ca,
-  0xbf7d3aac, 0xbe164083, 0xbf7d1cdd, 0xbe195be0, 0xbf7cfe73, 0xbe1c76de, 0xbf7cdf6c, 0xbe1f917b,
-  0xbf7cbfc9, 0xbe22abb6, 0xbf7c9f8a, 0xbe25c58c, 0xbf7c7eb0, 0xbe28defc, 0xbf7c5d3a, 0xbe2bf804,
-  0xbf7c3b28, 0xbe2f10a2, 0xbf7c187a, 0xbe3228d4, 0xbf7bf531, 0xbe354098, 0xbf7bd14d, 0xbe3857ec,
-  0xbf7baccd, 0xbe3b6ecf, 0xbf7b87b2, 0xbe3e853e, 0xbf7b61fc, 0xbe419b37, 0xbf7b3bab, 0xbe44b0b9,
-  0xbf7b14be, 0xbe47c5c2, 0xbf7aed37, 0xbe4ada4f, 0xbf7ac516, 0xbe4dee60, 0xbf7a9c59, 0xbe5101f1,
-  0xbf7a7302, 0xbe541501, 0xbf7a4910, 0xbe57278f, 0xbf7a1e84, 0xbe5a3997, 0xbf79f35e, 0xbe5d4b1a,
-  0xbf79c79d, 0xbe605c13, 0xbf799b43, 0xbe636c83, 0xbf796e4e, 0xbe667c66, 0xbf7940c0, 0xbe698bba,
-  0xbf791298, 0xbe6c9a7f, 0xbf78e3d6, 0xbe6fa8b2, 0xbf78b47b, 0xbe72b651, 0xbf788486, 0xbe75c35a,
-  0xbf7853f8, 0xbe78cfcc, 0xbf7822d1, 0xbe7bdba4, 0xbf77f110, 0xbe7ee6e1, 0xbf77beb7, 0xbe80f8c0,
-  0xbf778bc5, 0xbe827dc0, 0xbf77583a, 0xbe840270, 0xbf772417, 0xbe8586ce, 0xbf76ef5b, 0xbe870ada,
-  0xbf76ba07, 0xbe888e93, 0xbf76841b, 0xbe8a11f8, 0xbf764d97, 0xbe8b9507, 0xbf76167a, 0xbe8d17c0,
-  0xbf75dec6, 0xbe8e9a22, 0xbf75a67b, 0xbe901c2c, 0xbf756d97, 0xbe919ddd, 0xbf75341d, 0xbe931f35,
-  0xbf74fa0b, 0xbe94a031, 0xbf74bf62, 0xbe9620d2, 0xbf748422, 0xbe97a117, 0xbf74484b, 0xbe9920fe,
-  0xbf740bdd, 0xbe9aa086, 0xbf73ced9, 0xbe9c1faf, 0xbf73913f, 0xbe9d9e78, 0xbf73530e, 0xbe9f1cdf,
-  0xbf731447, 0xbea09ae5, 0xbf72d4eb, 0xbea21887, 0xbf7294f8, 0xbea395c5, 0xbf725470, 0xbea5129f,
-  0xbf721352, 0xbea68f12, 0xbf71d19f, 0xbea80b1f, 0xbf718f57, 0xbea986c4, 0xbf714c7a, 0xbeab0201,
-  0xbf710908, 0xbeac7cd4, 0xbf70c502, 0xbeadf73c, 0xbf708066, 0xbeaf713a, 0xbf703b37, 0xbeb0eacb,
-  0xbf6ff573, 0xbeb263ef, 0xbf6faf1b, 0xbeb3dca5, 0xbf6f6830, 0xbeb554ec, 0xbf6f20b0, 0xbeb6ccc3,
-  0xbf6ed89e, 0xbeb8442a, 0xbf6e8ff8, 0xbeb9bb1e, 0xbf6e46be, 0xbebb31a0, 0xbf6dfcf2, 0xbebca7af,
-  0xbf6db293, 0xbebe1d4a, 0xbf6d67a1, 0xbebf926f, 0xbf6d1c1d, 0xbec1071e, 0xbf6cd007, 0xbec27b55,
-  0xbf6c835e, 0xbec3ef15, 0xbf6c3624, 0xbec5625c, 0xbf6be858, 0xbec6d529, 0xbf6b99fb, 0xbec8477c,
-  0xbf6b4b0c, 0xbec9b953, 0xbf6afb8c, 0xbecb2aae, 0xbf6aab7b, 0xbecc9b8b, 0xbf6a5ad9, 0xbece0bea,
-  0xbf6a09a7, 0xbecf7bca, 0xbf69b7e4, 0xbed0eb2a, 0xbf696591, 0xbed25a09, 0xbf6912ae, 0xbed3c867,
-  0xbf68bf3c, 0xbed53641, 0xbf686b39, 0xbed6a399, 0xbf6816a8, 0xbed8106b, 0xbf67c187, 0xbed97cb9,
-  0xbf676bd8, 0xbedae880, 0xbf671599, 0xbedc53c1, 0xbf66becc, 0xbeddbe79, 0xbf666771, 0xbedf28a9,
-  0xbf660f88, 0xbee0924f, 0xbf65b710, 0xbee1fb6a, 0xbf655e0b, 0xbee363fa, 0xbf650479, 0xbee4cbfe,
-  0xbf64aa59, 0xbee63375, 0xbf644fac, 0xbee79a5d, 0xbf63f473, 0xbee900b7, 0xbf6398ac, 0xbeea6681,
-  0xbf633c5a, 0xbeebcbbb, 0xbf62df7b, 0xbeed3063, 0xbf628210, 0xbeee9479, 0xbf62241a, 0xbeeff7fb,
-  0xbf61c598, 0xbef15aea, 0xbf61668a, 0xbef2bd43, 0xbf6106f2, 0xbef41f07, 0xbf60a6cf, 0xbef58035,
-  0xbf604621, 0xbef6e0cb, 0xbf5fe4e9, 0xbef840c8, 0xbf5f8327, 0xbef9a02d, 0xbf5f20db, 0xbefafef7,
-  0xbf5ebe05, 0xbefc5d27, 0xbf5e5aa6, 0xbefdbabb, 0xbf5df6be, 0xbeff17b2, 0xbf5d924d, 0xbf003a06,
-  0xbf5d2d53, 0xbf00e7e4, 0xbf5cc7d1, 0xbf019573, 0xbf5c61c7, 0xbf0242b1, 0xbf5bfb34, 0xbf02ef9f,
-  0xbf5b941a, 0xbf039c3d, 0xbf5b2c79, 0xbf044889, 0xbf5ac450, 0xbf04f484, 0xbf5a5ba0, 0xbf05a02c,
-  0xbf59f26a, 0xbf064b82, 0xbf5988ad, 0xbf06f686, 0xbf591e6a, 0xbf07a136, 0xbf58b3a1, 0xbf084b92,
-  0xbf584853, 0xbf08f59b, 0xbf57dc7f, 0xbf099f4e, 0xbf577026, 0xbf0a48ad, 0xbf570348, 0xbf0af1b7,
-  0xbf5695e5, 0xbf0b9a6b, 0xbf5627fe, 0xbf0c42c9, 0xbf55b993, 0xbf0cead0, 0xbf554aa4, 0xbf0d9281,
-  0xbf54db31, 0xbf0e39da, 0xbf546b3b, 0xbf0ee0db, 0xbf53fac3, 0xbf0f8784, 0xbf5389c7, 0xbf102dd5,
-  0xbf531849, 0xbf10d3cd, 0xbf52a649, 0xbf11796b, 0xbf5233c6, 0xbf121eb0, 0xbf51c0c2, 0xbf12c39a,
-  0xbf514d3d, 0xbf13682a, 0xbf50d937, 0xbf140c5f, 0xbf5064af, 0xbf14b039, 0xbf4fefa8, 0xbf1553b7,
-  0xbf4f7a1f, 0xbf15f6d9, 0xbf4f0417, 0xbf16999f, 0xbf4e8d90, 0xbf173c07, 0xbf4e1689, 0xbf17de12,
-  0xbf4d9f02, 0xbf187fc0, 0xbf4d26fd, 0xbf19210f, 0xbf4cae79, 0xbf19c200, 0xbf4c3578, 0xbf1a6293,
-  0xbf4bbbf8, 0xbf1b02c6, 0xbf4b41fa, 0xbf1ba299, 0xbf4ac77f, 0xbf1c420c, 0xbf4a4c87, 0xbf1ce11f,
-  0xbf49d112, 0xbf1d7fd1, 0xbf495521, 0xbf1e1e22, 0xbf48d8b3, 0xbf1ebc12, 0xbf485bca, 0xbf1f599f,
-  0xbf47de65, 0xbf1ff6cb, 0xbf476085, 0xbf209393, 0xbf46e22a, 0xbf212ff9, 0xbf466354, 0xbf21cbfb,
-  0xbf45e403, 0xbf226799, 0xbf456439, 0xbf2302d3, 0xbf44e3f5, 0xbf239da9, 0xbf446337, 0xbf24381a,
-  0xbf43e200, 0xbf24d225, 0xbf436051, 0xbf256bcb, 0xbf42de29, 0xbf26050a, 0xbf425b89, 0xbf269de3,
-  0xbf41d870, 0xbf273656, 0xbf4154e1, 0xbf27ce61, 0xbf40d0da, 0xbf286605, 0xbf404c5c, 0xbf28fd41,
-  0xbf3fc767, 0xbf299415, 0xbf3f41fc, 0xbf2a2a80, 0xbf3ebc1b, 0xbf2ac082, 0xbf3e35c5, 0xbf2b561b,
-  0xbf3daef9, 0xbf2beb4a, 0xbf3d27b8, 0xbf2c800f, 0xbf3ca003, 0xbf2d1469, 0xbf3c17d9, 0xbf2da859,
-  0xbf3b8f3b, 0xbf2e3bde, 0xbf3b0629, 0xbf2ecef7, 0xbf3a7ca4, 0xbf2f61a5, 0xbf39f2ac, 0xbf2ff3e6,
-  0xbf396842, 0xbf3085bb, 0xbf38dd65, 0xbf311722, 0xbf385216, 0xbf31a81d, 0xbf37c655, 0xbf3238aa,
-  0xbf373a23, 0xbf32c8c9, 0xbf36ad7f, 0xbf33587a, 0xbf36206c, 0xbf33e7bc, 0xbf3592e7, 0xbf34768f,
-  0xbf3504f3, 0xbf3504f3, 0xbf34768f, 0xbf3592e7, 0xbf33e7bc, 0xbf36206c, 0xbf33587a, 0xbf36ad7f,
-  0xbf32c8c9, 0xbf373a23, 0xbf3238aa, 0xbf37c655, 0xbf31a81d, 0xbf385216, 0xbf311722, 0xbf38dd65,
-  0xbf3085bb, 0xbf396842, 0xbf2ff3e6, 0xbf39f2ac, 0xbf2f61a5, 0xbf3a7ca4, 0xbf2ecef7, 0xbf3b0629,
-  0xbf2e3bde, 0xbf3b8f3b, 0xbf2da859, 0xbf3c17d9, 0xbf2d1469, 0xbf3ca003, 0xbf2c800f, 0xbf3d27b8,
-  0xbf2beb4a, 0xbf3daef9, 0xbf2b561b, 0xbf3e35c5, 0xbf2ac082, 0xbf3ebc1b, 0xbf2a2a80, 0xbf3f41fc,
-  0xbf299415, 0xbf3fc767, 0xbf28fd41, 0xbf404c5c, 0xbf286605, 0xbf40d0da, 0xbf27ce61, 0xbf4154e1,
-  0xbf273656, 0xbf41d870, 0xbf269de3, 0xbf425b89, 0xbf26050a, 0xbf42de29, 0xbf256bcb, 0xbf436051,
-  0xbf24d225, 0xbf43e200, 0xbf24381a, 0xbf446337, 0xbf239da9, 0xbf44e3f5, 0xbf2302d3, 0xbf456439,
-  0xbf226799, 0xbf45e403, 0xbf21cbfb, 0xbf466354, 0xbf212ff9, 0xbf46e22a, 0xbf209393, 0xbf476085,
-  0xbf1ff6cb, 0xbf47de65, 0xbf1f599f, 0xbf485bca, 0xbf1ebc12, 0xbf48d8b3, 0xbf1e1e22, 0xbf495521,
-  0xbf1d7fd1, 0xbf49d112, 0xbf1ce11f, 0xbf4a4c87, 0xbf1c420c, 0xbf4ac77f, 0xbf1ba299, 0xbf4b41fa,
-  0xbf1b02c6, 0xbf4bbbf8, 0xbf1a6293, 0xbf4c3578, 0xbf19c200, 0xbf4cae79, 0xbf19210f, 0xbf4d26fd,
-  0xbf187fc0, 0xbf4d9f02, 0xbf17de12, 0xbf4e1689, 0xbf173c07, 0xbf4e8d90, 0xbf16999f, 0xbf4f0417,
-  0xbf15f6d9, 0xbf4f7a1f, 0xbf1553b7, 0xbf4fefa8, 0xbf14b039, 0xbf5064af, 0xbf140c5f, 0xbf50d937,
-  0xbf13682a, 0xbf514d3d, 0xbf12c39a, 0xbf51c0c2, 0xbf121eb0, 0xbf5233c6, 0xbf11796b, 0xbf52a649,
-  0xbf10d3cd, 0xbf531849, 0xbf102dd5, 0xbf5389c7, 0xbf0f8784, 0xbf53fac3, 0xbf0ee0db, 0xbf546b3b,
-  0xbf0e39da, 0xbf54db31, 0xbf0d9281, 0xbf554aa4, 0xbf0cead0, 0xbf55b993, 0xbf0c42c9, 0xbf5627fe,
-  0xbf0b9a6b, 0xbf5695e5, 0xbf0af1b7, 0xbf570348, 0xbf0a48ad, 0xbf577026, 0xbf099f4e, 0xbf57dc7f,
-  0xbf08f59b, 0xbf584853, 0xbf084b92, 0xbf58b3a1, 0xbf07a136, 0xbf591e6a, 0xbf06f686, 0xbf5988ad,
-  0xbf064b82, 0xbf59f26a, 0xbf05a02c, 0xbf5a5ba0, 0xbf04f484, 0xbf5ac450, 0xbf044889, 0xbf5b2c79,
-  0xbf039c3d, 0xbf5b941a, 0xbf02ef9f, 0xbf5bfb34, 0xbf0242b1, 0xbf5c61c7, 0xbf019573, 0xbf5cc7d1,
-  0xbf00e7e4, 0xbf5d2d53, 0xbf003a06, 0xbf5d924d, 0xbeff17b2, 0xbf5df6be, 0xbefdbabb, 0xbf5e5aa6,
-  0xbefc5d27, 0xbf5ebe05, 0xbefafef7, 0xbf5f20db, 0xbef9a02d, 0xbf5f8327, 0xbef840c8, 0xbf5fe4e9,
-  0xbef6e0cb, 0xbf604621, 0xbef58035, 0xbf60a6cf, 0xbef41f07, 0xbf6106f2, 0xbef2bd43, 0xbf61668a,
-  0xbef15aea, 0xbf61c598, 0xbeeff7fb, 0xbf62241a, 0xbeee9479, 0xbf628210, 0xbeed3063, 0xbf62df7b,
-  0xbeebcbbb, 0xbf633c5a, 0xbeea6681, 0xbf6398ac, 0xbee900b7, 0xbf63f473, 0xbee79a5d, 0xbf644fac,
-  0xbee63375, 0xbf64aa59, 0xbee4cbfe, 0xbf650479, 0xbee363fa, 0xbf655e0b, 0xbee1fb6a, 0xbf65b710,
-  0xbee0924f, 0xbf660f88, 0xbedf28a9, 0xbf666771, 0xbeddbe79, 0xbf66becc, 0xbedc53c1, 0xbf671599,
-  0xbedae880, 0xbf676bd8, 0xbed97cb9, 0xbf67c187, 0xbed8106b, 0xbf6816a8, 0xbed6a399, 0xbf686b39,
-  0xbed53641, 0xbf68bf3c, 0xbed3c867, 0xbf6912ae, 0xbed25a09, 0xbf696591, 0xbed0eb2a, 0xbf69b7e4,
-  0xbecf7bca, 0xbf6a09a7, 0xbece0bea, 0xbf6a5ad9, 0xbecc9b8b, 0xbf6aab7b, 0xbecb2aae, 0xbf6afb8c,
-  0xbec9b953, 0xbf6b4b0c, 0xbec8477c, 0xbf6b99fb, 0xbec6d529, 0xbf6be858, 0xbec5625c, 0xbf6c3624,
-  0xbec3ef15, 0xbf6c835e, 0xbec27b55, 0xbf6cd007, 0xbec1071e, 0xbf6d1c1d, 0xbebf926f, 0xbf6d67a1,
-  0xbebe1d4a, 0xbf6db293, 0xbebca7af, 0xbf6dfcf2, 0xbebb31a0, 0xbf6e46be, 0xbeb9bb1e, 0xbf6e8ff8,
-  0xbeb8442a, 0xbf6ed89e, 0xbeb6ccc3, 0xbf6f20b0, 0xbeb554ec, 0xbf6f6830, 0xbeb3dca5, 0xbf6faf1b,
-  0xbeb263ef, 0xbf6ff573, 0xbeb0eacb, 0xbf703b37, 0xbeaf713a, 0xbf708066, 0xbeadf73c, 0xbf70c502,
-  0xbeac7cd4, 0xbf710908, 0xbeab0201, 0xbf714c7a, 0xbea986c4, 0xbf718f57, 0xbea80b1f, 0xbf71d19f,
-  0xbea68f12, 0xbf721352, 0xbea5129f, 0xbf725470, 0xbea395c5, 0xbf7294f8, 0xbea21887, 0xbf72d4eb,
-  0xbea09ae5, 0xbf731447, 0xbe9f1cdf, 0xbf73530e, 0xbe9d9e78, 0xbf73913f, 0xbe9c1faf, 0xbf73ced9,
-  0xbe9aa086, 0xbf740bdd, 0xbe9920fe, 0xbf74484b, 0xbe97a117, 0xbf748422, 0xbe9620d2, 0xbf74bf62,
-  0xbe94a031, 0xbf74fa0b, 0xbe931f35, 0xbf75341d, 0xbe919ddd, 0xbf756d97, 0xbe901c2c, 0xbf75a67b,
-  0xbe8e9a22, 0xbf75dec6, 0xbe8d17c0, 0xbf76167a, 0xbe8b9507, 0xbf764d97, 0xbe8a11f8, 0xbf76841b,
-  0xbe888e93, 0xbf76ba07, 0xbe870ada, 0xbf76ef5b, 0xbe8586ce, 0xbf772417, 0xbe840270, 0xbf77583a,
-  0xbe827dc0, 0xbf778bc5, 0xbe80f8c0, 0xbf77beb7, 0xbe7ee6e1, 0xbf77f110, 0xbe7bdba4, 0xbf7822d1,
-  0xbe78cfcc, 0xbf7853f8, 0xbe75c35a, 0xbf788486, 0xbe72b651, 0xbf78b47b, 0xbe6fa8b2, 0xbf78e3d6,
-  0xbe6c9a7f, 0xbf791298, 0xbe698bba, 0xbf7940c0, 0xbe667c66, 0xbf796e4e, 0xbe636c83, 0xbf799b43,
-  0xbe605c13, 0xbf79c79d, 0xbe5d4b1a, 0xbf79f35e, 0xbe5a3997, 0xbf7a1e84, 0xbe57278f, 0xbf7a4910,
-  0xbe541501, 0xbf7a7302, 0xbe5101f1, 0xbf7a9c59, 0xbe4dee60, 0xbf7ac516, 0xbe4ada4f, 0xbf7aed37,
-  0xbe47c5c2, 0xbf7b14be, 0xbe44b0b9, 0xbf7b3bab, 0xbe419b37, 0xbf7b61fc, 0xbe3e853e, 0xbf7b87b2,
-  0xbe3b6ecf, 0xbf7baccd, 0xbe3857ec, 0xbf7bd14d, 0xbe354098, 0xbf7bf531, 0xbe3228d4, 0xbf7c187a,
-  0xbe2f10a2, 0xbf7c3b28, 0xbe2bf804, 0xbf7c5d3a, 0xbe28defc, 0xbf7c7eb0, 0xbe25c58c, 0xbf7c9f8a,
-  0xbe22abb6, 0xbf7cbfc9, 0xbe1f917b, 0xbf7cdf6c, 0xbe1c76de, 0xbf7cfe73, 0xbe195be0, 0xbf7d1cdd,
-  0xbe164083, 0xbf7d3aac, 0xbe1324ca, 0xbf7d57de, 0xbe1008b7, 0xbf7d7474, 0xbe0cec4a, 0xbf7d906e,
-  0xbe09cf86, 0xbf7dabcc, 0xbe06b26e, 0xbf7dc68c, 0xbe039502, 0xbf7de0b1, 0xbe007745, 0xbf7dfa38,
-  0xbdfab273, 0xbf7e1324, 0xbdf475c0, 0xbf7e2b72, 0xbdee3876, 0xbf7e4323, 0xbde7fa9a, 0xbf7e5a38,
-  0xbde1bc2e, 0xbf7e70b0, 0xbddb7d37, 0xbf7e868b, 0xbdd53db9, 0xbf7e9bc9, 0xbdcefdb7, 0xbf7eb069,
-  0xbdc8bd36, 0xbf7ec46d, 0xbdc27c39, 0xbf7ed7d4, 0xbdbc3ac3, 0xbf7eea9d, 0xbdb5f8da, 0xbf7efcc9,
-  0xbdafb680, 0xbf7f0e58, 0xbda973ba, 0xbf7f1f49, 0xbda3308c, 0xbf7f2f9d, 0xbd9cecf9, 0xbf7f3f54,
-  0xbd96a905, 0xbf7f4e6d, 0xbd9064b4, 0xbf7f5ce9, 0xbd8a200a, 0xbf7f6ac7, 0xbd83db0a, 0xbf7f7808,
-  0xbd7b2b74, 0xbf7f84ab, 0xbd6ea038, 0xbf7f90b1, 0xbd621468, 0xbf7f9c18, 0xbd55880e, 0xbf7fa6e3,
-  0xbd48fb2f, 0xbf7fb10f, 0xbd3c6dd5, 0xbf7fba9e, 0xbd2fe007, 0xbf7fc38f, 0xbd2351cc, 0xbf7fcbe2,
-  0xbd16c32c, 0xbf7fd398, 0xbd0a342f, 0xbf7fdaaf, 0xbcfb49b9, 0xbf7fe129, 0xbce22a7b, 0xbf7fe705,
-  0xbcc90ab0, 0xbf7fec43, 0xbcafea69, 0xbf7ff0e3, 0xbc96c9b6, 0xbf7ff4e6, 0xbc7b514b, 0xbf7ff84a,
-  0xbc490e90, 0xbf7ffb11, 0xbc16cb59, 0xbf7ffd39, 0xbbc90f89, 0xbf7ffec4, 0xbb490fc7, 0xbf7fffb1,
-  0x80000000, 0xbf800000, 0x3b490fc7, 0xbf7fffb1, 0x3bc90f89, 0xbf7ffec4, 0x3c16cb59, 0xbf7ffd39,
-  0x3c490e90, 0xbf7ffb11, 0x3c7b514b, 0xbf7ff84a, 0x3c96c9b6, 0xbf7ff4e6, 0x3cafea69, 0xbf7ff0e3,
-  0x3cc90ab0, 0xbf7fec43, 0x3ce22a7b, 0xbf7fe705, 0x3cfb49b9, 0xbf7fe129, 0x3d0a342f, 0xbf7fdaaf,
-  0x3d16c32c, 0xbf7fd398, 0x3d2351cc, 0xbf7fcbe2, 0x3d2fe007, 0xbf7fc38f, 0x3d3c6dd5, 0xbf7fba9e,
-  0x3d48fb2f, 0xbf7fb10f, 0x3d55880e, 0xbf7fa6e3, 0x3d621468, 0xbf7f9c18, 0x3d6ea038, 0xbf7f90b1,
-  0x3d7b2b74, 0xbf7f84ab, 0x3d83db0a, 0xbf7f7808, 0x3d8a200a, 0xbf7f6ac7, 0x3d9064b4, 0xbf7f5ce9,
-  0x3d96a905, 0xbf7f4e6d, 0x3d9cecf9, 0xbf7f3f54, 0x3da3308c, 0xbf7f2f9d, 0x3da973ba, 0xbf7f1f49,
-  0x3dafb680, 0xbf7f0e58, 0x3db5f8da, 0xbf7efcc9, 0x3dbc3ac3, 0xbf7eea9d, 0x3dc27c39, 0xbf7ed7d4,
-  0x3dc8bd36, 0xbf7ec46d, 0x3dcefdb7, 0xbf7eb069, 0x3dd53db9, 0xbf7e9bc9, 0x3ddb7d37, 0xbf7e868b,
-  0x3de1bc2e, 0xbf7e70b0, 0x3de7fa9a, 0xbf7e5a38, 0x3dee3876, 0xbf7e4323, 0x3df475c0, 0xbf7e2b72,
-  0x3dfab273, 0xbf7e1324, 0x3e007745, 0xbf7dfa38, 0x3e039502, 0xbf7de0b1, 0x3e06b26e, 0xbf7dc68c,
-  0x3e09cf86, 0xbf7dabcc, 0x3e0cec4a, 0xbf7d906e, 0x3e1008b7, 0xbf7d7474, 0x3e1324ca, 0xbf7d57de,
-  0x3e164083, 0xbf7d3aac, 0x3e195be0, 0xbf7d1cdd, 0x3e1c76de, 0xbf7cfe73, 0x3e1f917b, 0xbf7cdf6c,
-  0x3e22abb6, 0xbf7cbfc9, 0x3e25c58c, 0xbf7c9f8a, 0x3e28defc, 0xbf7c7eb0, 0x3e2bf804, 0xbf7c5d3a,
-  0x3e2f10a2, 0xbf7c3b28, 0x3e3228d4, 0xbf7c187a, 0x3e354098, 0xbf7bf531, 0x3e3857ec, 0xbf7bd14d,
-  0x3e3b6ecf, 0xbf7baccd, 0x3e3e853e, 0xbf7b87b2, 0x3e419b37, 0xbf7b61fc, 0x3e44b0b9, 0xbf7b3bab,
-  0x3e47c5c2, 0xbf7b14be, 0x3e4ada4f, 0xbf7aed37, 0x3e4dee60, 0xbf7ac516, 0x3e5101f1, 0xbf7a9c59,
-  0x3e541501, 0xbf7a7302, 0x3e57278f, 0xbf7a4910, 0x3e5a3997, 0xbf7a1e84, 0x3e5d4b1a, 0xbf79f35e,
-  0x3e605c13, 0xbf79c79d, 0x3e636c83, 0xbf799b43, 0x3e667c66, 0xbf796e4e, 0x3e698bba, 0xbf7940c0,
-  0x3e6c9a7f, 0xbf791298, 0x3e6fa8b2, 0xbf78e3d6, 0x3e72b651, 0xbf78b47b, 0x3e75c35a, 0xbf788486,
-  0x3e78cfcc, 0xbf7853f8, 0x3e7bdba4, 0xbf7822d1, 0x3e7ee6e1, 0xbf77f110, 0x3e80f8c0, 0xbf77beb7,
-  0x3e827dc0, 0xbf778bc5, 0x3e840270, 0xbf77583a, 0x3e8586ce, 0xbf772417, 0x3e870ada, 0xbf76ef5b,
-  0x3e888e93, 0xbf76ba07, 0x3e8a11f8, 0xbf76841b, 0x3e8b9507, 0xbf764d97, 0x3e8d17c0, 0xbf76167a,
-  0x3e8e9a22, 0xbf75dec6, 0x3e901c2c, 0xbf75a67b, 0x3e919ddd, 0xbf756d97, 0x3e931f35, 0xbf75341d,
-  0x3e94a031, 0xbf74fa0b, 0x3e9620d2, 0xbf74bf62, 0x3e97a117, 0xbf748422, 0x3e9920fe, 0xbf74484b,
-  0x3e9aa086, 0xbf740bdd, 0x3e9c1faf, 0xbf73ced9, 0x3e9d9e78, 0xbf73913f, 0x3e9f1cdf, 0xbf73530e,
-  0x3ea09ae5, 0xbf731447, 0x3ea21887, 0xbf72d4eb, 0x3ea395c5, 0xbf7294f8, 0x3ea5129f, 0xbf725470,
-  0x3ea68f12, 0xbf721352, 0x3ea80b1f, 0xbf71d19f, 0x3ea986c4, 0xbf718f57, 0x3eab0201, 0xbf714c7a,
-  0x3eac7cd4, 0xbf710908, 0x3eadf73c, 0xbf70c502, 0x3eaf713a, 0xbf708066, 0x3eb0eacb, 0xbf703b37,
-  0x3eb263ef, 0xbf6ff573, 0x3eb3dca5, 0xbf6faf1b, 0x3eb554ec, 0xbf6f6830, 0x3eb6ccc3, 0xbf6f20b0,
-  0x3eb8442a, 0xbf6ed89e, 0x3eb9bb1e, 0xbf6e8ff8, 0x3ebb31a0, 0xbf6e46be, 0x3ebca7af, 0xbf6dfcf2,
-  0x3ebe1d4a, 0xbf6db293, 0x3ebf926f, 0xbf6d67a1, 0x3ec1071e, 0xbf6d1c1d, 0x3ec27b55, 0xbf6cd007,
-  0x3ec3ef15, 0xbf6c835e, 0x3ec5625c, 0xbf6c3624, 0x3ec6d529, 0xbf6be858, 0x3ec8477c, 0xbf6b99fb,
-  0x3ec9b953, 0xbf6b4b0c, 0x3ecb2aae, 0xbf6afb8c, 0x3ecc9b8b, 0xbf6aab7b, 0x3ece0bea, 0xbf6a5ad9,
-  0x3ecf7bca, 0xbf6a09a7, 0x3ed0eb2a, 0xbf69b7e4, 0x3ed25a09, 0xbf696591, 0x3ed3c867, 0xbf6912ae,
-  0x3ed53641, 0xbf68bf3c, 0x3ed6a399, 0xbf686b39, 0x3ed8106b, 0xbf6816a8, 0x3ed97cb9, 0xbf67c187,
-  0x3edae880, 0xbf676bd8, 0x3edc53c1, 0xbf671599, 0x3eddbe79, 0xbf66becc, 0x3edf28a9, 0xbf666771,
-  0x3ee0924f, 0xbf660f88, 0x3ee1fb6a, 0xbf65b710, 0x3ee363fa, 0xbf655e0b, 0x3ee4cbfe, 0xbf650479,
-  0x3ee63375, 0xbf64aa59, 0x3ee79a5d, 0xbf644fac, 0x3ee900b7, 0xbf63f473, 0x3eea6681, 0xbf6398ac,
-  0x3eebcbbb, 0xbf633c5a, 0x3eed3063, 0xbf62df7b, 0x3eee9479, 0xbf628210, 0x3eeff7fb, 0xbf62241a,
-  0x3ef15aea, 0xbf61c598, 0x3ef2bd43, 0xbf61668a, 0x3ef41f07, 0xbf6106f2, 0x3ef58035, 0xbf60a6cf,
-  0x3ef6e0cb, 0xbf604621, 0x3ef840c8, 0xbf5fe4e9, 0x3ef9a02d, 0xbf5f8327, 0x3efafef7, 0xbf5f20db,
-  0x3efc5d27, 0xbf5ebe05, 0x3efdbabb, 0xbf5e5aa6, 0x3eff17b2, 0xbf5df6be, 0x3f003a06, 0xbf5d924d,
-  0x3f00e7e4, 0xbf5d2d53, 0x3f019573, 0xbf5cc7d1, 0x3f0242b1, 0xbf5c61c7, 0x3f02ef9f, 0xbf5bfb34,
-  0x3f039c3d, 0xbf5b941a, 0x3f044889, 0xbf5b2c79, 0x3f04f484, 0xbf5ac450, 0x3f05a02c, 0xbf5a5ba0,
-  0x3f064b82, 0xbf59f26a, 0x3f06f686, 0xbf5988ad, 0x3f07a136, 0xbf591e6a, 0x3f084b92, 0xbf58b3a1,
-  0x3f08f59b, 0xbf584853, 0x3f099f4e, 0xbf57dc7f, 0x3f0a48ad, 0xbf577026, 0x3f0af1b7, 0xbf570348,
-  0x3f0b9a6b, 0xbf5695e5, 0x3f0c42c9, 0xbf5627fe, 0x3f0cead0, 0xbf55b993, 0x3f0d9281, 0xbf554aa4,
-  0x3f0e39da, 0xbf54db31, 0x3f0ee0db, 0xbf546b3b, 0x3f0f8784, 0xbf53fac3, 0x3f102dd5, 0xbf5389c7,
-  0x3f10d3cd, 0xbf531849, 0x3f11796b, 0xbf52a649, 0x3f121eb0, 0xbf5233c6, 0x3f12c39a, 0xbf51c0c2,
-  0x3f13682a, 0xbf514d3d, 0x3f140c5f, 0xbf50d937, 0x3f14b039, 0xbf5064af, 0x3f1553b7, 0xbf4fefa8,
-  0x3f15f6d9, 0xbf4f7a1f, 0x3f16999f, 0xbf4f0417, 0x3f173c07, 0xbf4e8d90, 0x3f17de12, 0xbf4e1689,
-  0x3f187fc0, 0xbf4d9f02, 0x3f19210f, 0xbf4d26fd, 0x3f19c200, 0xbf4cae79, 0x3f1a6293, 0xbf4c3578,
-  0x3f1b02c6, 0xbf4bbbf8, 0x3f1ba299, 0xbf4b41fa, 0x3f1c420c, 0xbf4ac77f, 0x3f1ce11f, 0xbf4a4c87,
-  0x3f1d7fd1, 0xbf49d112, 0x3f1e1e22, 0xbf495521, 0x3f1ebc12, 0xbf48d8b3, 0x3f1f599f, 0xbf485bca,
-  0x3f1ff6cb, 0xbf47de65, 0x3f209393, 0xbf476085, 0x3f212ff9, 0xbf46e22a, 0x3f21cbfb, 0xbf466354,
-  0x3f226799, 0xbf45e403, 0x3f2302d3, 0xbf456439, 0x3f239da9, 0xbf44e3f5, 0x3f24381a, 0xbf446337,
-  0x3f24d225, 0xbf43e200, 0x3f256bcb, 0xbf436051, 0x3f26050a, 0xbf42de29, 0x3f269de3, 0xbf425b89,
-  0x3f273656, 0xbf41d870, 0x3f27ce61, 0xbf4154e1, 0x3f286605, 0xbf40d0da, 0x3f28fd41, 0xbf404c5c,
-  0x3f299415, 0xbf3fc767, 0x3f2a2a80, 0xbf3f41fc, 0x3f2ac082, 0xbf3ebc1b, 0x3f2b561b, 0xbf3e35c5,
-  0x3f2beb4a, 0xbf3daef9, 0x3f2c800f, 0xbf3d27b8, 0x3f2d1469, 0xbf3ca003, 0x3f2da859, 0xbf3c17d9,
-  0x3f2e3bde, 0xbf3b8f3b, 0x3f2ecef7, 0xbf3b0629, 0x3f2f61a5, 0xbf3a7ca4, 0x3f2ff3e6, 0xbf39f2ac,
-  0x3f3085bb, 0xbf396842, 0x3f311722, 0xbf38dd65, 0x3f31a81d, 0xbf385216, 0x3f3238aa, 0xbf37c655,
-  0x3f32c8c9, 0xbf373a23, 0x3f33587a, 0xbf36ad7f, 0x3f33e7bc, 0xbf36206c, 0x3f34768f, 0xbf3592e7,
-  0x3f3504f3, 0xbf3504f3, 0x3f3592e7, 0xbf34768f, 0x3f36206c, 0xbf33e7bc, 0x3f36ad7f, 0xbf33587a,
-  0x3f373a23, 0xbf32c8c9, 0x3f37c655, 0xbf3238aa, 0x3f385216, 0xbf31a81d, 0x3f38dd65, 0xbf311722,
-  0x3f396842, 0xbf3085bb, 0x3f39f2ac, 0xbf2ff3e6, 0x3f3a7ca4, 0xbf2f61a5, 0x3f3b0629, 0xbf2ecef7,
-  0x3f3b8f3b, 0xbf2e3bde, 0x3f3c17d9, 0xbf2da859, 0x3f3ca003, 0xbf2d1469, 0x3f3d27b8, 0xbf2c800f,
-  0x3f3daef9, 0xbf2beb4a, 0x3f3e35c5, 0xbf2b561b, 0x3f3ebc1b, 0xbf2ac082, 0x3f3f41fc, 0xbf2a2a80,
-  0x3f3fc767, 0xbf299415, 0x3f404c5c, 0xbf28fd41, 0x3f40d0da, 0xbf286605, 0x3f4154e1, 0xbf27ce61,
-  0x3f41d870, 0xbf273656, 0x3f425b89, 0xbf269de3, 0x3f42de29, 0xbf26050a, 0x3f436051, 0xbf256bcb,
-  0x3f43e200, 0xbf24d225, 0x3f446337, 0xbf24381a, 0x3f44e3f5, 0xbf239da9, 0x3f456439, 0xbf2302d3,
-  0x3f45e403, 0xbf226799, 0x3f466354, 0xbf21cbfb, 0x3f46e22a, 0xbf212ff9, 0x3f476085, 0xbf209393,
-  0x3f47de65, 0xbf1ff6cb, 0x3f485bca, 0xbf1f599f, 0x3f48d8b3, 0xbf1ebc12, 0x3f495521, 0xbf1e1e22,
-  0x3f49d112, 0xbf1d7fd1, 0x3f4a4c87, 0xbf1ce11f, 0x3f4ac77f, 0xbf1c420c, 0x3f4b41fa, 0xbf1ba299,
-  0x3f4bbbf8, 0xbf1b02c6, 0x3f4c3578, 0xbf1a6293, 0x3f4cae79, 0xbf19c200, 0x3f4d26fd, 0xbf19210f,
-  0x3f4d9f02, 0xbf187fc0, 0x3f4e1689, 0xbf17de12, 0x3f4e8d90, 0xbf173c07, 0x3f4f0417, 0xbf16999f,
-  0x3f4f7a1f, 0xbf15f6d9, 0x3f4fefa8, 0xbf1553b7, 0x3f5064af, 0xbf14b039, 0x3f50d937, 0xbf140c5f,
-  0x3f514d3d, 0xbf13682a, 0x3f51c0c2, 0xbf12c39a, 0x3f5233c6, 0xbf121eb0, 0x3f52a649, 0xbf11796b,
-  0x3f531849, 0xbf10d3cd, 0x3f5389c7, 0xbf102dd5, 0x3f53fac3, 0xbf0f8784, 0x3f546b3b, 0xbf0ee0db,
-  0x3f54db31, 0xbf0e39da, 0x3f554aa4, 0xbf0d9281, 0x3f55b993, 0xbf0cead0, 0x3f5627fe, 0xbf0c42c9,
-  0x3f5695e5, 0xbf0b9a6b, 0x3f570348, 0xbf0af1b7, 0x3f577026, 0xbf0a48ad, 0x3f57dc7f, 0xbf099f4e,
-  0x3f584853, 0xbf08f59b, 0x3f58b3a1, 0xbf084b92, 0x3f591e6a, 0xbf07a136, 0x3f5988ad, 0xbf06f686,
-  0x3f59f26a, 0xbf064b82, 0x3f5a5ba0, 0xbf05a02c, 0x3f5ac450, 0xbf04f484, 0x3f5b2c79, 0xbf044889,
-  0x3f5b941a, 0xbf039c3d, 0x3f5bfb34, 0xbf02ef9f, 0x3f5c61c7, 0xbf0242b1, 0x3f5cc7d1, 0xbf019573,
-  0x3f5d2d53, 0xbf00e7e4, 0x3f5d924d, 0xbf003a06, 0x3f5df6be, 0xbeff17b2, 0x3f5e5aa6, 0xbefdbabb,
-  0x3f5ebe05, 0xbefc5d27, 0x3f5f20db, 0xbefafef7, 0x3f5f8327, 0xbef9a02d, 0x3f5fe4e9, 0xbef840c8,
-  0x3f604621, 0xbef6e0cb, 0x3f60a6cf, 0xbef58035, 0x3f6106f2, 0xbef41f07, 0x3f61668a, 0xbef2bd43,
-  0x3f61c598, 0xbef15aea, 0x3f62241a, 0xbeeff7fb, 0x3f628210, 0xbeee9479, 0x3f62df7b, 0xbeed3063,
-  0x3f633c5a, 0xbeebcbbb, 0x3f6398ac, 0xbeea6681, 0x3f63f473, 0xbee900b7, 0x3f644fac, 0xbee79a5d,
-  0x3f64aa59, 0xbee63375, 0x3f650479, 0xbee4cbfe, 0x3f655e0b, 0xbee363fa, 0x3f65b710, 0xbee1fb6a,
-  0x3f660f88, 0xbee0924f, 0x3f666771, 0xbedf28a9, 0x3f66becc, 0xbeddbe79, 0x3f671599, 0xbedc53c1,
-  0x3f676bd8, 0xbedae880, 0x3f67c187, 0xbed97cb9, 0x3f6816a8, 0xbed8106b, 0x3f686b39, 0xbed6a399,
-  0x3f68bf3c, 0xbed53641, 0x3f6912ae, 0xbed3c867, 0x3f696591, 0xbed25a09, 0x3f69b7e4, 0xbed0eb2a,
-  0x3f6a09a7, 0xbecf7bca, 0x3f6a5ad9, 0xbece0bea, 0x3f6aab7b, 0xbecc9b8b, 0x3f6afb8c, 0xbecb2aae,
-  0x3f6b4b0c, 0xbec9b953, 0x3f6b99fb, 0xbec8477c, 0x3f6be858, 0xbec6d529, 0x3f6c3624, 0xbec5625c,
-  0x3f6c835e, 0xbec3ef15, 0x3f6cd007, 0xbec27b55, 0x3f6d1c1d, 0xbec1071e, 0x3f6d67a1, 0xbebf926f,
-  0x3f6db293, 0xbebe1d4a, 0x3f6dfcf2, 0xbebca7af, 0x3f6e46be, 0xbebb31a0, 0x3f6e8ff8, 0xbeb9bb1e,
-  0x3f6ed89e, 0xbeb8442a, 0x3f6f20b0, 0xbeb6ccc3, 0x3f6f6830, 0xbeb554ec, 0x3f6faf1b, 0xbeb3dca5,
-  0x3f6ff573, 0xbeb263ef, 0x3f703b37, 0xbeb0eacb, 0x3f708066, 0xbeaf713a, 0x3f70c502, 0xbeadf73c,
-  0x3f710908, 0xbeac7cd4, 0x3f714c7a, 0xbeab0201, 0x3f718f57, 0xbea986c4, 0x3f71d19f, 0xbea80b1f,
-  0x3f721352, 0xbea68f12, 0x3f725470, 0xbea5129f, 0x3f7294f8, 0xbea395c5, 0x3f72d4eb, 0xbea21887,
-  0x3f731447, 0xbea09ae5, 0x3f73530e, 0xbe9f1cdf, 0x3f73913f, 0xbe9d9e78, 0x3f73ced9, 0xbe9c1faf,
-  0x3f740bdd, 0xbe9aa086, 0x3f74484b, 0xbe9920fe, 0x3f748422, 0xbe97a117, 0x3f74bf62, 0xbe9620d2,
-  0x3f74fa0b, 0xbe94a031, 0x3f75341d, 0xbe931f35, 0x3f756d97, 0xbe919ddd, 0x3f75a67b, 0xbe901c2c,
-  0x3f75dec6, 0xbe8e9a22, 0x3f76167a, 0xbe8d17c0, 0x3f764d97, 0xbe8b9507, 0x3f76841b, 0xbe8a11f8,
-  0x3f76ba07, 0xbe888e93, 0x3f76ef5b, 0xbe870ada, 0x3f772417, 0xbe8586ce, 0x3f77583a, 0xbe840270,
-  0x3f778bc5, 0xbe827dc0, 0x3f77beb7, 0xbe80f8c0, 0x3f77f110, 0xbe7ee6e1, 0x3f7822d1, 0xbe7bdba4,
-  0x3f7853f8, 0xbe78cfcc, 0x3f788486, 0xbe75c35a, 0x3f78b47b, 0xbe72b651, 0x3f78e3d6, 0xbe6fa8b2,
-  0x3f791298, 0xbe6c9a7f, 0x3f7940c0, 0xbe698bba, 0x3f796e4e, 0xbe667c66, 0x3f799b43, 0xbe636c83,
-  0x3f79c79d, 0xbe605c13, 0x3f79f35e, 0xbe5d4b1a, 0x3f7a1e84, 0xbe5a3997, 0x3f7a4910, 0xbe57278f,
-  0x3f7a7302, 0xbe541501, 0x3f7a9c59, 0xbe5101f1, 0x3f7ac516, 0xbe4dee60, 0x3f7aed37, 0xbe4ada4f,
-  0x3f7b14be, 0xbe47c5c2, 0x3f7b3bab, 0xbe44b0b9, 0x3f7b61fc, 0xbe419b37, 0x3f7b87b2, 0xbe3e853e,
-  0x3f7baccd, 0xbe3b6ecf, 0x3f7bd14d, 0xbe3857ec, 0x3f7bf531, 0xbe354098, 0x3f7c187a, 0xbe3228d4,
-  0x3f7c3b28, 0xbe2f10a2, 0x3f7c5d3a, 0xbe2bf804, 0x3f7c7eb0, 0xbe28defc, 0x3f7c9f8a, 0xbe25c58c,
-  0x3f7cbfc9, 0xbe22abb6, 0x3f7cdf6c, 0xbe1f917b, 0x3f7cfe73, 0xbe1c76de, 0x3f7d1cdd, 0xbe195be0,
-  0x3f7d3aac, 0xbe164083, 0x3f7d57de, 0xbe1324ca, 0x3f7d7474, 0xbe1008b7, 0x3f7d906e, 0xbe0cec4a,
-  0x3f7dabcc, 0xbe09cf86, 0x3f7dc68c, 0xbe06b26e, 0x3f7de0b1, 0xbe039502, 0x3f7dfa38, 0xbe007745,
-  0x3f7e1324, 0xbdfab273, 0x3f7e2b72, 0xbdf475c0, 0x3f7e4323, 0xbdee3876, 0x3f7e5a38, 0xbde7fa9a,
-  0x3f7e70b0, 0xbde1bc2e, 0x3f7e868b, 0xbddb7d37, 0x3f7e9bc9, 0xbdd53db9, 0x3f7eb069, 0xbdcefdb7,
-  0x3f7ec46d, 0xbdc8bd36, 0x3f7ed7d4, 0xbdc27c39, 0x3f7eea9d, 0xbdbc3ac3, 0x3f7efcc9, 0xbdb5f8da,
-  0x3f7f0e58, 0xbdafb680, 0x3f7f1f49, 0xbda973ba, 0x3f7f2f9d, 0xbda3308c, 0x3f7f3f54, 0xbd9cecf9,
-  0x3f7f4e6d, 0xbd96a905, 0x3f7f5ce9, 0xbd9064b4, 0x3f7f6ac7, 0xbd8a200a, 0x3f7f7808, 0xbd83db0a,
-  0x3f7f84ab, 0xbd7b2b74, 0x3f7f90b1, 0xbd6ea038, 0x3f7f9c18, 0xbd621468, 0x3f7fa6e3, 0xbd55880e,
-  0x3f7fb10f, 0xbd48fb2f, 0x3f7fba9e, 0xbd3c6dd5, 0x3f7fc38f, 0xbd2fe007, 0x3f7fcbe2, 0xbd2351cc,
-  0x3f7fd398, 0xbd16c32c, 0x3f7fdaaf, 0xbd0a342f, 0x3f7fe129, 0xbcfb49b9, 0x3f7fe705, 0xbce22a7b,
-  0x3f7fec43, 0xbcc90ab0, 0x3f7ff0e3, 0xbcafea69, 0x3f7ff4e6, 0xbc96c9b6, 0x3f7ff84a, 0xbc7b514b,
-  0x3f7ffb11, 0xbc490e90, 0x3f7ffd39, 0xbc16cb59, 0x3f7ffec4, 0xbbc90f89, 0x3f7fffb1, 0xbb490fc7,
+const uint32_t rtaTwiddleCoef512Bits[1024] PROGMEM = {
+  0x3f800000, 0x00000000, 0x3f7ffb11, 0x3c490e90, 0x3f7fec43, 0x3cc90ab0, 0x3f7fd397, 0x3d16c32c,
+  0x3f7fb10f, 0x3d48fb30, 0x3f7f84ab, 0x3d7b2b74, 0x3f7f4e6d, 0x3d96a905, 0x3f7f0e58, 0x3dafb680,
+  0x3f7ec46d, 0x3dc8bd36, 0x3f7e70b0, 0x3de1bc2e, 0x3f7e1324, 0x3dfab273, 0x3f7dabcc, 0x3e09cf86,
+  0x3f7d3aac, 0x3e164083, 0x3f7cbfc9, 0x3e22abb6, 0x3f7c3b28, 0x3e2f10a2, 0x3f7baccd, 0x3e3b6ecf,
+  0x3f7b14be, 0x3e47c5c2, 0x3f7a7302, 0x3e541501, 0x3f79c79d, 0x3e605c13, 0x3f791298, 0x3e6c9a7f,
+  0x3f7853f8, 0x3e78cfcc, 0x3f778bc5, 0x3e827dc0, 0x3f76ba07, 0x3e888e93, 0x3f75dec6, 0x3e8e9a22,
+  0x3f74fa0b, 0x3e94a031, 0x3f740bdd, 0x3e9aa086, 0x3f731447, 0x3ea09ae5, 0x3f721352, 0x3ea68f12,
+  0x3f710908, 0x3eac7cd4, 0x3f6ff573, 0x3eb263ef, 0x3f6ed89e, 0x3eb8442a, 0x3f6db293, 0x3ebe1d4a,
+  0x3f6c835e, 0x3ec3ef15, 0x3f6b4b0c, 0x3ec9b953, 0x3f6a09a7, 0x3ecf7bca, 0x3f68bf3c, 0x3ed53641,
+  0x3f676bd8, 0x3edae880, 0x3f660f88, 0x3ee0924f, 0x3f64aa59, 0x3ee63375, 0x3f633c5a, 0x3eebcbbb,
+  0x3f61c598, 0x3ef15aea, 0x3f604621, 0x3ef6e0cb, 0x3f5ebe05, 0x3efc5d27, 0x3f5d2d53, 0x3f00e7e4,
+  0x3f5b941a, 0x3f039c3d, 0x3f59f26a, 0x3f064b82, 0x3f584853, 0x3f08f59b, 0x3f5695e5, 0x3f0b9a6b,
+  0x3f54db31, 0x3f0e39da, 0x3f531849, 0x3f10d3cd, 0x3f514d3d, 0x3f13682a, 0x3f4f7a1f, 0x3f15f6d9,
+  0x3f4d9f02, 0x3f187fc0, 0x3f4bbbf8, 0x3f1b02c6, 0x3f49d112, 0x3f1d7fd1, 0x3f47de65, 0x3f1ff6cb,
+  0x3f45e403, 0x3f226799, 0x3f43e200, 0x3f24d225, 0x3f41d870, 0x3f273656, 0x3f3fc767, 0x3f299415,
+  0x3f3daef9, 0x3f2beb4a, 0x3f3b8f3b, 0x3f2e3bde, 0x3f396842, 0x3f3085bb, 0x3f373a23, 0x3f32c8c9,
+  0x3f3504f3, 0x3f3504f3, 0x3f32c8c9, 0x3f373a23, 0x3f3085bb, 0x3f396842, 0x3f2e3bde, 0x3f3b8f3b,
+  0x3f2beb4a, 0x3f3daef9, 0x3f299415, 0x3f3fc767, 0x3f273656, 0x3f41d870, 0x3f24d225, 0x3f43e200,
+  0x3f226799, 0x3f45e403, 0x3f1ff6cb, 0x3f47de65, 0x3f1d7fd1, 0x3f49d112, 0x3f1b02c6, 0x3f4bbbf8,
+  0x3f187fc0, 0x3f4d9f02, 0x3f15f6d9, 0x3f4f7a1f, 0x3f13682a, 0x3f514d3d, 0x3f10d3cd, 0x3f531849,
+  0x3f0e39da, 0x3f54db31, 0x3f0b9a6b, 0x3f5695e5, 0x3f08f59b, 0x3f584853, 0x3f064b82, 0x3f59f26a,
+  0x3f039c3d, 0x3f5b941a, 0x3f00e7e4, 0x3f5d2d53, 0x3efc5d27, 0x3f5ebe05, 0x3ef6e0cb, 0x3f604621,
+  0x3ef15aea, 0x3f61c598, 0x3eebcbbb, 0x3f633c5a, 0x3ee63375, 0x3f64aa59, 0x3ee0924f, 0x3f660f88,
+  0x3edae880, 0x3f676bd8, 0x3ed53641, 0x3f68bf3c, 0x3ecf7bca, 0x3f6a09a7, 0x3ec9b953, 0x3f6b4b0c,
+  0x3ec3ef15, 0x3f6c835e, 0x3ebe1d4a, 0x3f6db293, 0x3eb8442a, 0x3f6ed89e, 0x3eb263ef, 0x3f6ff573,
+  0x3eac7cd4, 0x3f710908, 0x3ea68f12, 0x3f721352, 0x3ea09ae5, 0x3f731447, 0x3e9aa086, 0x3f740bdd,
+  0x3e94a031, 0x3f74fa0b, 0x3e8e9a22, 0x3f75dec6, 0x3e888e93, 0x3f76ba07, 0x3e827dc0, 0x3f778bc5,
+  0x3e78cfcc, 0x3f7853f8, 0x3e6c9a7f, 0x3f791298, 0x3e605c13, 0x3f79c79d, 0x3e541501, 0x3f7a7302,
+  0x3e47c5c2, 0x3f7b14be, 0x3e3b6ecf, 0x3f7baccd, 0x3e2f10a2, 0x3f7c3b28, 0x3e22abb6, 0x3f7cbfc9,
+  0x3e164083, 0x3f7d3aac, 0x3e09cf86, 0x3f7dabcc, 0x3dfab273, 0x3f7e1324, 0x3de1bc2e, 0x3f7e70b0,
+  0x3dc8bd36, 0x3f7ec46d, 0x3dafb680, 0x3f7f0e58, 0x3d96a905, 0x3f7f4e6d, 0x3d7b2b74, 0x3f7f84ab,
+  0x3d48fb30, 0x3f7fb10f, 0x3d16c32c, 0x3f7fd397, 0x3cc90ab0, 0x3f7fec43, 0x3c490e90, 0x3f7ffb11,
+  0x248d3132, 0x3f800000, 0xbc490e90, 0x3f7ffb11, 0xbcc90ab0, 0x3f7fec43, 0xbd16c32c, 0x3f7fd397,
+  0xbd48fb30, 0x3f7fb10f, 0xbd7b2b74, 0x3f7f84ab, 0xbd96a905, 0x3f7f4e6d, 0xbdafb680, 0x3f7f0e58,
+  0xbdc8bd36, 0x3f7ec46d, 0xbde1bc2e, 0x3f7e70b0, 0xbdfab273, 0x3f7e1324, 0xbe09cf86, 0x3f7dabcc,
+  0xbe164083, 0x3f7d3aac, 0xbe22abb6, 0x3f7cbfc9, 0xbe2f10a2, 0x3f7c3b28, 0xbe3b6ecf, 0x3f7baccd,
+  0xbe47c5c2, 0x3f7b14be, 0xbe541501, 0x3f7a7302, 0xbe605c13, 0x3f79c79d, 0xbe6c9a7f, 0x3f791298,
+  0xbe78cfcc, 0x3f7853f8, 0xbe827dc0, 0x3f778bc5, 0xbe888e93, 0x3f76ba07, 0xbe8e9a22, 0x3f75dec6,
+  0xbe94a031, 0x3f74fa0b, 0xbe9aa086, 0x3f740bdd, 0xbea09ae5, 0x3f731447, 0xbea68f12, 0x3f721352,
+  0xbeac7cd4, 0x3f710908, 0xbeb263ef, 0x3f6ff573, 0xbeb8442a, 0x3f6ed89e, 0xbebe1d4a, 0x3f6db293,
+  0xbec3ef15, 0x3f6c835e, 0xbec9b953, 0x3f6b4b0c, 0xbecf7bca, 0x3f6a09a7, 0xbed53641, 0x3f68bf3c,
+  0xbedae880, 0x3f676bd8, 0xbee0924f, 0x3f660f88, 0xbee63375, 0x3f64aa59, 0xbeebcbbb, 0x3f633c5a,
+  0xbef15aea, 0x3f61c598, 0xbef6e0cb, 0x3f604621, 0xbefc5d27, 0x3f5ebe05, 0xbf00e7e4, 0x3f5d2d53,
+  0xbf039c3d, 0x3f5b941a, 0xbf064b82, 0x3f59f26a, 0xbf08f59b, 0x3f584853, 0xbf0b9a6b, 0x3f5695e5,
+  0xbf0e39da, 0x3f54db31, 0xbf10d3cd, 0x3f531849, 0xbf13682a, 0x3f514d3d, 0xbf15f6d9, 0x3f4f7a1f,
+  0xbf187fc0, 0x3f4d9f02, 0xbf1b02c6, 0x3f4bbbf8, 0xbf1d7fd1, 0x3f49d112, 0xbf1ff6cb, 0x3f47de65,
+  0xbf226799, 0x3f45e403, 0xbf24d225, 0x3f43e200, 0xbf273656, 0x3f41d870, 0xbf299415, 0x3f3fc767,
+  0xbf2beb4a, 0x3f3daef9, 0xbf2e3bde, 0x3f3b8f3b, 0xbf3085bb, 0x3f396842, 0xbf32c8c9, 0x3f373a23,
+  0xbf3504f3, 0x3f3504f3, 0xbf373a23, 0x3f32c8c9, 0xbf396842, 0x3f3085bb, 0xbf3b8f3b, 0x3f2e3bde,
+  0xbf3daef9, 0x3f2beb4a, 0xbf3fc767, 0x3f299415, 0xbf41d870, 0x3f273656, 0xbf43e200, 0x3f24d225,
+  0xbf45e403, 0x3f226799, 0xbf47de65, 0x3f1ff6cb, 0xbf49d112, 0x3f1d7fd1, 0xbf4bbbf8, 0x3f1b02c6,
+  0xbf4d9f02, 0x3f187fc0, 0xbf4f7a1f, 0x3f15f6d9, 0xbf514d3d, 0x3f13682a, 0xbf531849, 0x3f10d3cd,
+  0xbf54db31, 0x3f0e39da, 0xbf5695e5, 0x3f0b9a6b, 0xbf584853, 0x3f08f59b, 0xbf59f26a, 0x3f064b82,
+  0xbf5b941a, 0x3f039c3d, 0xbf5d2d53, 0x3f00e7e4, 0xbf5ebe05, 0x3efc5d27, 0xbf604621, 0x3ef6e0cb,
+  0xbf61c598, 0x3ef15aea, 0xbf633c5a, 0x3eebcbbb, 0xbf64aa59, 0x3ee63375, 0xbf660f88, 0x3ee0924f,
+  0xbf676bd8, 0x3edae880, 0xbf68bf3c, 0x3ed53641, 0xbf6a09a7, 0x3ecf7bca, 0xbf6b4b0c, 0x3ec9b953,
+  0xbf6c835e, 0x3ec3ef15, 0xbf6db293, 0x3ebe1d4a, 0xbf6ed89e, 0x3eb8442a, 0xbf6ff573, 0x3eb263ef,
+  0xbf710908, 0x3eac7cd4, 0xbf721352, 0x3ea68f12, 0xbf731447, 0x3ea09ae5, 0xbf740bdd, 0x3e9aa086,
+  0xbf74fa0b, 0x3e94a031, 0xbf75dec6, 0x3e8e9a22, 0xbf76ba07, 0x3e888e93, 0xbf778bc5, 0x3e827dc0,
+  0xbf7853f8, 0x3e78cfcc, 0xbf791298, 0x3e6c9a7f, 0xbf79c79d, 0x3e605c13, 0xbf7a7302, 0x3e541501,
+  0xbf7b14be, 0x3e47c5c2, 0xbf7baccd, 0x3e3b6ecf, 0xbf7c3b28, 0x3e2f10a2, 0xbf7cbfc9, 0x3e22abb6,
+  0xbf7d3aac, 0x3e164083, 0xbf7dabcc, 0x3e09cf86, 0xbf7e1324, 0x3dfab273, 0xbf7e70b0, 0x3de1bc2e,
+  0xbf7ec46d, 0x3dc8bd36, 0xbf7f0e58, 0x3dafb680, 0xbf7f4e6d, 0x3d96a905, 0xbf7f84ab, 0x3d7b2b74,
+  0xbf7fb10f, 0x3d48fb30, 0xbf7fd397, 0x3d16c32c, 0xbf7fec43, 0x3cc90ab0, 0xbf7ffb11, 0x3c490e90,
+  0xbf800000, 0x250d3132, 0xbf7ffb11, 0xbc490e90, 0xbf7fec43, 0xbcc90ab0, 0xbf7fd397, 0xbd16c32c,
+  0xbf7fb10f, 0xbd48fb30, 0xbf7f84ab, 0xbd7b2b74, 0xbf7f4e6d, 0xbd96a905, 0xbf7f0e58, 0xbdafb680,
+  0xbf7ec46d, 0xbdc8bd36, 0xbf7e70b0, 0xbde1bc2e, 0xbf7e1324, 0xbdfab273, 0xbf7dabcc, 0xbe09cf86,
+  0xbf7d3aac, 0xbe164083, 0xbf7cbfc9, 0xbe22abb6, 0xbf7c3b28, 0xbe2f10a2, 0xbf7baccd, 0xbe3b6ecf,
+  0xbf7b14be, 0xbe47c5c2, 0xbf7a7302, 0xbe541501, 0xbf79c79d, 0xbe605c13, 0xbf791298, 0xbe6c9a7f,
+  0xbf7853f8, 0xbe78cfcc, 0xbf778bc5, 0xbe827dc0, 0xbf76ba07, 0xbe888e93, 0xbf75dec6, 0xbe8e9a22,
+  0xbf74fa0b, 0xbe94a031, 0xbf740bdd, 0xbe9aa086, 0xbf731447, 0xbea09ae5, 0xbf721352, 0xbea68f12,
+  0xbf710908, 0xbeac7cd4, 0xbf6ff573, 0xbeb263ef, 0xbf6ed89e, 0xbeb8442a, 0xbf6db293, 0xbebe1d4a,
+  0xbf6c835e, 0xbec3ef15, 0xbf6b4b0c, 0xbec9b953, 0xbf6a09a7, 0xbecf7bca, 0xbf68bf3c, 0xbed53641,
+  0xbf676bd8, 0xbedae880, 0xbf660f88, 0xbee0924f, 0xbf64aa59, 0xbee63375, 0xbf633c5a, 0xbeebcbbb,
+  0xbf61c598, 0xbef15aea, 0xbf604621, 0xbef6e0cb, 0xbf5ebe05, 0xbefc5d27, 0xbf5d2d53, 0xbf00e7e4,
+  0xbf5b941a, 0xbf039c3d, 0xbf59f26a, 0xbf064b82, 0xbf584853, 0xbf08f59b, 0xbf5695e5, 0xbf0b9a6b,
+  0xbf54db31, 0xbf0e39da, 0xbf531849, 0xbf10d3cd, 0xbf514d3d, 0xbf13682a, 0xbf4f7a1f, 0xbf15f6d9,
+  0xbf4d9f02, 0xbf187fc0, 0xbf4bbbf8, 0xbf1b02c6, 0xbf49d112, 0xbf1d7fd1, 0xbf47de65, 0xbf1ff6cb,
+  0xbf45e403, 0xbf226799, 0xbf43e200, 0xbf24d225, 0xbf41d870, 0xbf273656, 0xbf3fc767, 0xbf299415,
+  0xbf3daef9, 0xbf2beb4a, 0xbf3b8f3b, 0xbf2e3bde, 0xbf396842, 0xbf3085bb, 0xbf373a23, 0xbf32c8c9,
+  0xbf3504f3, 0xbf3504f3, 0xbf32c8c9, 0xbf373a23, 0xbf3085bb, 0xbf396842, 0xbf2e3bde, 0xbf3b8f3b,
+  0xbf2beb4a, 0xbf3daef9, 0xbf299415, 0xbf3fc767, 0xbf273656, 0xbf41d870, 0xbf24d225, 0xbf43e200,
+  0xbf226799, 0xbf45e403, 0xbf1ff6cb, 0xbf47de65, 0xbf1d7fd1, 0xbf49d112, 0xbf1b02c6, 0xbf4bbbf8,
+  0xbf187fc0, 0xbf4d9f02, 0xbf15f6d9, 0xbf4f7a1f, 0xbf13682a, 0xbf514d3d, 0xbf10d3cd, 0xbf531849,
+  0xbf0e39da, 0xbf54db31, 0xbf0b9a6b, 0xbf5695e5, 0xbf08f59b, 0xbf584853, 0xbf064b82, 0xbf59f26a,
+  0xbf039c3d, 0xbf5b941a, 0xbf00e7e4, 0xbf5d2d53, 0xbefc5d27, 0xbf5ebe05, 0xbef6e0cb, 0xbf604621,
+  0xbef15aea, 0xbf61c598, 0xbeebcbbb, 0xbf633c5a, 0xbee63375, 0xbf64aa59, 0xbee0924f, 0xbf660f88,
+  0xbedae880, 0xbf676bd8, 0xbed53641, 0xbf68bf3c, 0xbecf7bca, 0xbf6a09a7, 0xbec9b953, 0xbf6b4b0c,
+  0xbec3ef15, 0xbf6c835e, 0xbebe1d4a, 0xbf6db293, 0xbeb8442a, 0xbf6ed89e, 0xbeb263ef, 0xbf6ff573,
+  0xbeac7cd4, 0xbf710908, 0xbea68f12, 0xbf721352, 0xbea09ae5, 0xbf731447, 0xbe9aa086, 0xbf740bdd,
+  0xbe94a031, 0xbf74fa0b, 0xbe8e9a22, 0xbf75dec6, 0xbe888e93, 0xbf76ba07, 0xbe827dc0, 0xbf778bc5,
+  0xbe78cfcc, 0xbf7853f8, 0xbe6c9a7f, 0xbf791298, 0xbe605c13, 0xbf79c79d, 0xbe541501, 0xbf7a7302,
+  0xbe47c5c2, 0xbf7b14be, 0xbe3b6ecf, 0xbf7baccd, 0xbe2f10a2, 0xbf7c3b28, 0xbe22abb6, 0xbf7cbfc9,
+  0xbe164083, 0xbf7d3aac, 0xbe09cf86, 0xbf7dabcc, 0xbdfab273, 0xbf7e1324, 0xbde1bc2e, 0xbf7e70b0,
+  0xbdc8bd36, 0xbf7ec46d, 0xbdafb680, 0xbf7f0e58, 0xbd96a905, 0xbf7f4e6d, 0xbd7b2b74, 0xbf7f84ab,
+  0xbd48fb30, 0xbf7fb10f, 0xbd16c32c, 0xbf7fd397, 0xbcc90ab0, 0xbf7fec43, 0xbc490e90, 0xbf7ffb11,
+  0xa553c9ca, 0xbf800000, 0x3c490e90, 0xbf7ffb11, 0x3cc90ab0, 0xbf7fec43, 0x3d16c32c, 0xbf7fd397,
+  0x3d48fb30, 0xbf7fb10f, 0x3d7b2b74, 0xbf7f84ab, 0x3d96a905, 0xbf7f4e6d, 0x3dafb680, 0xbf7f0e58,
+  0x3dc8bd36, 0xbf7ec46d, 0x3de1bc2e, 0xbf7e70b0, 0x3dfab273, 0xbf7e1324, 0x3e09cf86, 0xbf7dabcc,
+  0x3e164083, 0xbf7d3aac, 0x3e22abb6, 0xbf7cbfc9, 0x3e2f10a2, 0xbf7c3b28, 0x3e3b6ecf, 0xbf7baccd,
+  0x3e47c5c2, 0xbf7b14be, 0x3e541501, 0xbf7a7302, 0x3e605c13, 0xbf79c79d, 0x3e6c9a7f, 0xbf791298,
+  0x3e78cfcc, 0xbf7853f8, 0x3e827dc0, 0xbf778bc5, 0x3e888e93, 0xbf76ba07, 0x3e8e9a22, 0xbf75dec6,
+  0x3e94a031, 0xbf74fa0b, 0x3e9aa086, 0xbf740bdd, 0x3ea09ae5, 0xbf731447, 0x3ea68f12, 0xbf721352,
+  0x3eac7cd4, 0xbf710908, 0x3eb263ef, 0xbf6ff573, 0x3eb8442a, 0xbf6ed89e, 0x3ebe1d4a, 0xbf6db293,
+  0x3ec3ef15, 0xbf6c835e, 0x3ec9b953, 0xbf6b4b0c, 0x3ecf7bca, 0xbf6a09a7, 0x3ed53641, 0xbf68bf3c,
+  0x3edae880, 0xbf676bd8, 0x3ee0924f, 0xbf660f88, 0x3ee63375, 0xbf64aa59, 0x3eebcbbb, 0xbf633c5a,
+  0x3ef15aea, 0xbf61c598, 0x3ef6e0cb, 0xbf604621, 0x3efc5d27, 0xbf5ebe05, 0x3f00e7e4, 0xbf5d2d53,
+  0x3f039c3d, 0xbf5b941a, 0x3f064b82, 0xbf59f26a, 0x3f08f59b, 0xbf584853, 0x3f0b9a6b, 0xbf5695e5,
+  0x3f0e39da, 0xbf54db31, 0x3f10d3cd, 0xbf531849, 0x3f13682a, 0xbf514d3d, 0x3f15f6d9, 0xbf4f7a1f,
+  0x3f187fc0, 0xbf4d9f02, 0x3f1b02c6, 0xbf4bbbf8, 0x3f1d7fd1, 0xbf49d112, 0x3f1ff6cb, 0xbf47de65,
+  0x3f226799, 0xbf45e403, 0x3f24d225, 0xbf43e200, 0x3f273656, 0xbf41d870, 0x3f299415, 0xbf3fc767,
+  0x3f2beb4a, 0xbf3daef9, 0x3f2e3bde, 0xbf3b8f3b, 0x3f3085bb, 0xbf396842, 0x3f32c8c9, 0xbf373a23,
+  0x3f3504f3, 0xbf3504f3, 0x3f373a23, 0xbf32c8c9, 0x3f396842, 0xbf3085bb, 0x3f3b8f3b, 0xbf2e3bde,
+  0x3f3daef9, 0xbf2beb4a, 0x3f3fc767, 0xbf299415, 0x3f41d870, 0xbf273656, 0x3f43e200, 0xbf24d225,
+  0x3f45e403, 0xbf226799, 0x3f47de65, 0xbf1ff6cb, 0x3f49d112, 0xbf1d7fd1, 0x3f4bbbf8, 0xbf1b02c6,
+  0x3f4d9f02, 0xbf187fc0, 0x3f4f7a1f, 0xbf15f6d9, 0x3f514d3d, 0xbf13682a, 0x3f531849, 0xbf10d3cd,
+  0x3f54db31, 0xbf0e39da, 0x3f5695e5, 0xbf0b9a6b, 0x3f584853, 0xbf08f59b, 0x3f59f26a, 0xbf064b82,
+  0x3f5b941a, 0xbf039c3d, 0x3f5d2d53, 0xbf00e7e4, 0x3f5ebe05, 0xbefc5d27, 0x3f604621, 0xbef6e0cb,
+  0x3f61c598, 0xbef15aea, 0x3f633c5a, 0xbeebcbbb, 0x3f64aa59, 0xbee63375, 0x3f660f88, 0xbee0924f,
+  0x3f676bd8, 0xbedae880, 0x3f68bf3c, 0xbed53641, 0x3f6a09a7, 0xbecf7bca, 0x3f6b4b0c, 0xbec9b953,
+  0x3f6c835e, 0xbec3ef15, 0x3f6db293, 0xbebe1d4a, 0x3f6ed89e, 0xbeb8442a, 0x3f6ff573, 0xbeb263ef,
+  0x3f710908, 0xbeac7cd4, 0x3f721352, 0xbea68f12, 0x3f731447, 0xbea09ae5, 0x3f740bdd, 0xbe9aa086,
+  0x3f74fa0b, 0xbe94a031, 0x3f75dec6, 0xbe8e9a22, 0x3f76ba07, 0xbe888e93, 0x3f778bc5, 0xbe827dc0,
+  0x3f7853f8, 0xbe78cfcc, 0x3f791298, 0xbe6c9a7f, 0x3f79c79d, 0xbe605c13, 0x3f7a7302, 0xbe541501,
+  0x3f7b14be, 0xbe47c5c2, 0x3f7baccd, 0xbe3b6ecf, 0x3f7c3b28, 0xbe2f10a2, 0x3f7cbfc9, 0xbe22abb6,
+  0x3f7d3aac, 0xbe164083, 0x3f7dabcc, 0xbe09cf86, 0x3f7e1324, 0xbdfab273, 0x3f7e70b0, 0xbde1bc2e,
+  0x3f7ec46d, 0xbdc8bd36, 0x3f7f0e58, 0xbdafb680, 0x3f7f4e6d, 0xbd96a905, 0x3f7f84ab, 0xbd7b2b74,
+  0x3f7fb10f, 0xbd48fb30, 0x3f7fd397, 0xbd16c32c, 0x3f7fec43, 0xbcc90ab0, 0x3f7ffb11, 0xbc490e90,
 };
 
-const uint32_t rtaTwiddleCoefRfft4096Bits[4096] PROGMEM = {
-  0x00000000, 0x3f800000, 0x3ac90fd4, 0x3f7fffec, 0x3b490fc7, 0x3f7fffb1, 0x3b96cbc1, 0x3f7fff4e,
-  0x3bc90f89, 0x3f7ffec4, 0x3bfb5330, 0x3f7ffe13, 0x3c16cb59, 0x3f7ffd39, 0x3c2fed02, 0x3f7ffc39,
-  0x3c490e90, 0x3f7ffb11, 0x3c623000, 0x3f7ff9c1, 0x3c7b514b, 0x3f7ff84a, 0x3c8a3938, 0x3f7ff6ac,
-  0x3c96c9b6, 0x3f7ff4e6, 0x3ca35a1c, 0x3f7ff2f8, 0x3cafea69, 0x3f7ff0e3, 0x3cbc7a9b, 0x3f7feea7,
-  0x3cc90ab0, 0x3f7fec43, 0x3cd59aa6, 0x3f7fe9b8, 0x3ce22a7b, 0x3f7fe705, 0x3ceeba2d, 0x3f7fe42b,
-  0x3cfb49b9, 0x3f7fe129, 0x3d03ec90, 0x3f7fde00, 0x3d0a342f, 0x3f7fdaaf, 0x3d107bb8, 0x3f7fd737,
-  0x3d16c32c, 0x3f7fd398, 0x3d1d0a88, 0x3f7fcfd1, 0x3d2351cc, 0x3f7fcbe2, 0x3d2998f6, 0x3f7fc7cc,
-  0x3d2fe007, 0x3f7fc38f, 0x3d3626fc, 0x3f7fbf2a, 0x3d3c6dd5, 0x3f7fba9e, 0x3d42b491, 0x3f7fb5ea,
-  0x3d48fb2f, 0x3f7fb10f, 0x3d4f41af, 0x3f7fac0d, 0x3d55880e, 0x3f7fa6e3, 0x3d5bce4c, 0x3f7fa191,
-  0x3d621468, 0x3f7f9c18, 0x3d685a62, 0x3f7f9678, 0x3d6ea038, 0x3f7f90b1, 0x3d74e5e9, 0x3f7f8ac2,
-  0x3d7b2b74, 0x3f7f84ab, 0x3d80b86c, 0x3f7f7e6d, 0x3d83db0a, 0x3f7f7808, 0x3d86fd94, 0x3f7f717b,
-  0x3d8a200a, 0x3f7f6ac7, 0x3d8d426a, 0x3f7f63ec, 0x3d9064b4, 0x3f7f5ce9, 0x3d9386e7, 0x3f7f55bf,
-  0x3d96a905, 0x3f7f4e6d, 0x3d99cb0a, 0x3f7f46f4, 0x3d9cecf9, 0x3f7f3f54, 0x3da00ecf, 0x3f7f378d,
-  0x3da3308c, 0x3f7f2f9d, 0x3da65230, 0x3f7f2787, 0x3da973ba, 0x3f7f1f49, 0x3dac952b, 0x3f7f16e4,
-  0x3dafb680, 0x3f7f0e58, 0x3db2d7bb, 0x3f7f05a4, 0x3db5f8da, 0x3f7efcc9, 0x3db919dd, 0x3f7ef3c7,
-  0x3dbc3ac3, 0x3f7eea9d, 0x3dbf5b8d, 0x3f7ee14c, 0x3dc27c39, 0x3f7ed7d4, 0x3dc59cc6, 0x3f7ece34,
-  0x3dc8bd36, 0x3f7ec46d, 0x3dcbdd86, 0x3f7eba7f, 0x3dcefdb7, 0x3f7eb069, 0x3dd21dc8, 0x3f7ea62d,
-  0x3dd53db9, 0x3f7e9bc9, 0x3dd85d89, 0x3f7e913d, 0x3ddb7d37, 0x3f7e868b, 0x3dde9cc4, 0x3f7e7bb1,
-  0x3de1bc2e, 0x3f7e70b0, 0x3de4db76, 0x3f7e6588, 0x3de7fa9a, 0x3f7e5a38, 0x3deb199a, 0x3f7e4ec1,
-  0x3dee3876, 0x3f7e4323, 0x3df1572e, 0x3f7e375e, 0x3df475c0, 0x3f7e2b72, 0x3df7942c, 0x3f7e1f5e,
-  0x3dfab273, 0x3f7e1324, 0x3dfdd092, 0x3f7e06c2, 0x3e007745, 0x3f7dfa38, 0x3e02062e, 0x3f7ded88,
-  0x3e039502, 0x3f7de0b1, 0x3e0523c2, 0x3f7dd3b2, 0x3e06b26e, 0x3f7dc68c, 0x3e084105, 0x3f7db940,
-  0x3e09cf86, 0x3f7dabcc, 0x3e0b5df3, 0x3f7d9e30, 0x3e0cec4a, 0x3f7d906e, 0x3e0e7a8b, 0x3f7d8285,
-  0x3e1008b7, 0x3f7d7474, 0x3e1196cc, 0x3f7d663d, 0x3e1324ca, 0x3f7d57de, 0x3e14b2b2, 0x3f7d4959,
-  0x3e164083, 0x3f7d3aac, 0x3e17ce3d, 0x3f7d2bd8, 0x3e195be0, 0x3f7d1cdd, 0x3e1ae96b, 0x3f7d0dbc,
-  0x3e1c76de, 0x3f7cfe73, 0x3e1e0438, 0x3f7cef03, 0x3e1f917b, 0x3f7cdf6c, 0x3e211ea5, 0x3f7ccfae,
-  0x3e22abb6, 0x3f7cbfc9, 0x3e2438ad, 0x3f7cafbd, 0x3e25c58c, 0x3f7c9f8a, 0x3e275251, 0x3f7c8f31,
-  0x3e28defc, 0x3f7c7eb0, 0x3e2a6b8d, 0x3f7c6e08, 0x3e2bf804, 0x3f7c5d3a, 0x3e2d8461, 0x3f7c4c44,
-  0x3e2f10a2, 0x3f7c3b28, 0x3e309cc9, 0x3f7c29e5, 0x3e3228d4, 0x3f7c187a, 0x3e33b4c4, 0x3f7c06e9,
-  0x3e354098, 0x3f7bf531, 0x3e36cc50, 0x3f7be353, 0x3e3857ec, 0x3f7bd14d, 0x3e39e36c, 0x3f7bbf20,
-  0x3e3b6ecf, 0x3f7baccd, 0x3e3cfa15, 0x3f7b9a53, 0x3e3e853e, 0x3f7b87b2, 0x3e401049, 0x3f7b74ea,
-  0x3e419b37, 0x3f7b61fc, 0x3e432607, 0x3f7b4ee7, 0x3e44b0b9, 0x3f7b3bab, 0x3e463b4d, 0x3f7b2848,
-  0x3e47c5c2, 0x3f7b14be, 0x3e495018, 0x3f7b010e, 0x3e4ada4f, 0x3f7aed37, 0x3e4c6467, 0x3f7ad93a,
-  0x3e4dee60, 0x3f7ac516, 0x3e4f7838, 0x3f7ab0cb, 0x3e5101f1, 0x3f7a9c59, 0x3e528b89, 0x3f7a87c1,
-  0x3e541501, 0x3f7a7302, 0x3e559e58, 0x3f7a5e1c, 0x3e57278f, 0x3f7a4910, 0x3e58b0a4, 0x3f7a33dd,
-  0x3e5a3997, 0x3f7a1e84, 0x3e5bc26a, 0x3f7a0904, 0x3e5d4b1a, 0x3f79f35e, 0x3e5ed3a8, 0x3f79dd91,
-  0x3e605c13, 0x3f79c79d, 0x3e61e45c, 0x3f79b183, 0x3e636c83, 0x3f799b43, 0x3e64f486, 0x3f7984dc,
-  0x3e667c66, 0x3f796e4e, 0x3e680422, 0x3f79579a, 0x3e698bba, 0x3f7940c0, 0x3e6b132f, 0x3f7929bf,
-  0x3e6c9a7f, 0x3f791298, 0x3e6e21ab, 0x3f78fb4a, 0x3e6fa8b2, 0x3f78e3d6, 0x3e712f94, 0x3f78cc3b,
-  0x3e72b651, 0x3f78b47b, 0x3e743ce8, 0x3f789c93, 0x3e75c35a, 0x3f788486, 0x3e7749a6, 0x3f786c52,
-  0x3e78cfcc, 0x3f7853f8, 0x3e7a55cb, 0x3f783b77, 0x3e7bdba4, 0x3f7822d1, 0x3e7d6156, 0x3f780a04,
-  0x3e7ee6e1, 0x3f77f110, 0x3e803622, 0x3f77d7f7, 0x3e80f8c0, 0x3f77beb7, 0x3e81bb4a, 0x3f77a551,
-  0x3e827dc0, 0x3f778bc5, 0x3e834022, 0x3f777213, 0x3e840270, 0x3f77583a, 0x3e84c4aa, 0x3f773e3c,
-  0x3e8586ce, 0x3f772417, 0x3e8648df, 0x3f7709cc, 0x3e870ada, 0x3f76ef5b, 0x3e87ccc1, 0x3f76d4c4,
-  0x3e888e93, 0x3f76ba07, 0x3e895050, 0x3f769f24, 0x3e8a11f8, 0x3f76841b, 0x3e8ad38a, 0x3f7668ec,
-  0x3e8b9507, 0x3f764d97, 0x3e8c566e, 0x3f76321b, 0x3e8d17c0, 0x3f76167a, 0x3e8dd8fc, 0x3f75fab3,
-  0x3e8e9a22, 0x3f75dec6, 0x3e8f5b32, 0x3f75c2b3, 0x3e901c2c, 0x3f75a67b, 0x3e90dd10, 0x3f758a1c,
-  0x3e919ddd, 0x3f756d97, 0x3e925e94, 0x3f7550ed, 0x3e931f35, 0x3f75341d, 0x3e93dfbf, 0x3f751727,
-  0x3e94a031, 0x3f74fa0b, 0x3e95608d, 0x3f74dcc9, 0x3e9620d2, 0x3f74bf62, 0x3e96e100, 0x3f74a1d5,
-  0x3e97a117, 0x3f748422, 0x3e986116, 0x3f746649, 0x3e9920fe, 0x3f74484b, 0x3e99e0ce, 0x3f742a27,
-  0x3e9aa086, 0x3f740bdd, 0x3e9b6027, 0x3f73ed6e, 0x3e9c1faf, 0x3f73ced9, 0x3e9cdf20, 0x3f73b01f,
-  0x3e9d9e78, 0x3f73913f, 0x3e9e5db8, 0x3f737239, 0x3e9f1cdf, 0x3f73530e, 0x3e9fdbee, 0x3f7333be,
-  0x3ea09ae5, 0x3f731447, 0x3ea159c2, 0x3f72f4ac, 0x3ea21887, 0x3f72d4eb, 0x3ea2d733, 0x3f72b504,
-  0x3ea395c5, 0x3f7294f8, 0x3ea4543f, 0x3f7274c7, 0x3ea5129f, 0x3f725470, 0x3ea5d0e5, 0x3f7233f4,
-  0x3ea68f12, 0x3f721352, 0x3ea74d25, 0x3f71f28c, 0x3ea80b1f, 0x3f71d19f, 0x3ea8c8fe, 0x3f71b08e,
-  0x3ea986c4, 0x3f718f57, 0x3eaa446f, 0x3f716dfb, 0x3eab0201, 0x3f714c7a, 0x3eabbf77, 0x3f712ad4,
-  0x3eac7cd4, 0x3f710908, 0x3ead3a15, 0x3f70e717, 0x3eadf73c, 0x3f70c502, 0x3eaeb449, 0x3f70a2c6,
-  0x3eaf713a, 0x3f708066, 0x3eb02e10, 0x3f705de1, 0x3eb0eacb, 0x3f703b37, 0x3eb1a76b, 0x3f701867,
-  0x3eb263ef, 0x3f6ff573, 0x3eb32058, 0x3f6fd25a, 0x3eb3dca5, 0x3f6faf1b, 0x3eb498d6, 0x3f6f8bb8,
-  0x3eb554ec, 0x3f6f6830, 0x3eb610e6, 0x3f6f4483, 0x3eb6ccc3, 0x3f6f20b0, 0x3eb78884, 0x3f6efcba,
-  0x3eb8442a, 0x3f6ed89e, 0x3eb8ffb2, 0x3f6eb45d, 0x3eb9bb1e, 0x3f6e8ff8, 0x3eba766e, 0x3f6e6b6d,
-  0x3ebb31a0, 0x3f6e46be, 0x3ebbecb6, 0x3f6e21eb, 0x3ebca7af, 0x3f6dfcf2, 0x3ebd628b, 0x3f6dd7d5,
-  0x3ebe1d4a, 0x3f6db293, 0x3ebed7eb, 0x3f6d8d2d, 0x3ebf926f, 0x3f6d67a1, 0x3ec04cd5, 0x3f6d41f2,
-  0x3ec1071e, 0x3f6d1c1d, 0x3ec1c148, 0x3f6cf624, 0x3ec27b55, 0x3f6cd007, 0x3ec33544, 0x3f6ca9c5,
-  0x3ec3ef15, 0x3f6c835e, 0x3ec4a8c8, 0x3f6c5cd4, 0x3ec5625c, 0x3f6c3624, 0x3ec61bd2, 0x3f6c0f50,
-  0x3ec6d529, 0x3f6be858, 0x3ec78e62, 0x3f6bc13b, 0x3ec8477c, 0x3f6b99fb, 0x3ec90077, 0x3f6b7295,
-  0x3ec9b953, 0x3f6b4b0c, 0x3eca7210, 0x3f6b235e, 0x3ecb2aae, 0x3f6afb8c, 0x3ecbe32c, 0x3f6ad395,
-  0x3ecc9b8b, 0x3f6aab7b, 0x3ecd53ca, 0x3f6a833c, 0x3ece0bea, 0x3f6a5ad9, 0x3ecec3ea, 0x3f6a3252,
-  0x3ecf7bca, 0x3f6a09a7, 0x3ed0338a, 0x3f69e0d7, 0x3ed0eb2a, 0x3f69b7e4, 0x3ed1a2aa, 0x3f698ecc,
-  0x3ed25a09, 0x3f696591, 0x3ed31148, 0x3f693c32, 0x3ed3c867, 0x3f6912ae, 0x3ed47f64, 0x3f68e907,
-  0x3ed53641, 0x3f68bf3c, 0x3ed5ecfd, 0x3f68954c, 0x3ed6a399, 0x3f686b39, 0x3ed75a13, 0x3f684103,
-  0x3ed8106b, 0x3f6816a8, 0x3ed8c6a3, 0x3f67ec2a, 0x3ed97cb9, 0x3f67c187, 0x3eda32ad, 0x3f6796c1,
-  0x3edae880, 0x3f676bd8, 0x3edb9e31, 0x3f6740ca, 0x3edc53c1, 0x3f671599, 0x3edd092e, 0x3f66ea45,
-  0x3eddbe79, 0x3f66becc, 0x3ede73a2, 0x3f669330, 0x3edf28a9, 0x3f666771, 0x3edfdd8d, 0x3f663b8e,
-  0x3ee0924f, 0x3f660f88, 0x3ee146ee, 0x3f65e35e, 0x3ee1fb6a, 0x3f65b710, 0x3ee2afc4, 0x3f658aa0,
-  0x3ee363fa, 0x3f655e0b, 0x3ee4180e, 0x3f653154, 0x3ee4cbfe, 0x3f650479, 0x3ee57fcb, 0x3f64d77b,
-  0x3ee63375, 0x3f64aa59, 0x3ee6e6fb, 0x3f647d14, 0x3ee79a5d, 0x3f644fac, 0x3ee84d9c, 0x3f642221,
-  0x3ee900b7, 0x3f63f473, 0x3ee9b3ae, 0x3f63c6a1, 0x3eea6681, 0x3f6398ac, 0x3eeb1930, 0x3f636a95,
-  0x3eebcbbb, 0x3f633c5a, 0x3eec7e21, 0x3f630dfc, 0x3eed3063, 0x3f62df7b, 0x3eede280, 0x3f62b0d7,
-  0x3eee9479, 0x3f628210, 0x3eef464c, 0x3f625326, 0x3eeff7fb, 0x3f62241a, 0x3ef0a985, 0x3f61f4ea,
-  0x3ef15aea, 0x3f61c598, 0x3ef20c29, 0x3f619622, 0x3ef2bd43, 0x3f61668a, 0x3ef36e38, 0x3f6136d0,
-  0x3ef41f07, 0x3f6106f2, 0x3ef4cfb1, 0x3f60d6f2, 0x3ef58035, 0x3f60a6cf, 0x3ef63093, 0x3f607689,
-  0x3ef6e0cb, 0x3f604621, 0x3ef790dc, 0x3f601596, 0x3ef840c8, 0x3f5fe4e9, 0x3ef8f08e, 0x3f5fb419,
-  0x3ef9a02d, 0x3f5f8327, 0x3efa4fa5, 0x3f5f5212, 0x3efafef7, 0x3f5f20db, 0x3efbae22, 0x3f5eef81,
-  0x3efc5d27, 0x3f5ebe05, 0x3efd0c04, 0x3f5e8c67, 0x3efdbabb, 0x3f5e5aa6, 0x3efe694a, 0x3f5e28c3,
-  0x3eff17b2, 0x3f5df6be, 0x3effc5f3, 0x3f5dc497, 0x3f003a06, 0x3f5d924d, 0x3f0090ff, 0x3f5d5fe1,
-  0x3f00e7e4, 0x3f5d2d53, 0x3f013eb5, 0x3f5cfaa3, 0x3f019573, 0x3f5cc7d1, 0x3f01ec1c, 0x3f5c94dd,
-  0x3f0242b1, 0x3f5c61c7, 0x3f029932, 0x3f5c2e8e, 0x3f02ef9f, 0x3f5bfb34, 0x3f0345f8, 0x3f5bc7b8,
-  0x3f039c3d, 0x3f5b941a, 0x3f03f26d, 0x3f5b605a, 0x3f044889, 0x3f5b2c79, 0x3f049e91, 0x3f5af875,
-  0x3f04f484, 0x3f5ac450, 0x3f054a62, 0x3f5a9009, 0x3f05a02c, 0x3f5a5ba0, 0x3f05f5e2, 0x3f5a2716,
-  0x3f064b82, 0x3f59f26a, 0x3f06a10e, 0x3f59bd9c, 0x3f06f686, 0x3f5988ad, 0x3f074be8, 0x3f59539c,
-  0x3f07a136, 0x3f591e6a, 0x3f07f66f, 0x3f58e917, 0x3f084b92, 0x3f58b3a1, 0x3f08a0a1, 0x3f587e0b,
-  0x3f08f59b, 0x3f584853, 0x3f094a7f, 0x3f581279, 0x3f099f4e, 0x3f57dc7f, 0x3f09f409, 0x3f57a663,
-  0x3f0a48ad, 0x3f577026, 0x3f0a9d3d, 0x3f5739c7, 0x3f0af1b7, 0x3f570348, 0x3f0b461c, 0x3f56cca7,
-  0x3f0b9a6b, 0x3f5695e5, 0x3f0beea5, 0x3f565f02, 0x3f0c42c9, 0x3f5627fe, 0x3f0c96d7, 0x3f55f0d9,
-  0x3f0cead0, 0x3f55b993, 0x3f0d3eb3, 0x3f55822c, 0x3f0d9281, 0x3f554aa4, 0x3f0de638, 0x3f5512fb,
-  0x3f0e39da, 0x3f54db31, 0x3f0e8d65, 0x3f54a347, 0x3f0ee0db, 0x3f546b3b, 0x3f0f343b, 0x3f54330f,
-  0x3f0f8784, 0x3f53fac3, 0x3f0fdab8, 0x3f53c255, 0x3f102dd5, 0x3f5389c7, 0x3f1080dc, 0x3f535118,
-  0x3f10d3cd, 0x3f531849, 0x3f1126a7, 0x3f52df59, 0x3f11796b, 0x3f52a649, 0x3f11cc19, 0x3f526d18,
-  0x3f121eb0, 0x3f5233c6, 0x3f127130, 0x3f51fa54, 0x3f12c39a, 0x3f51c0c2, 0x3f1315ee, 0x3f518710,
-  0x3f13682a, 0x3f514d3d, 0x3f13ba50, 0x3f51134a, 0x3f140c5f, 0x3f50d937, 0x3f145e58, 0x3f509f03,
-  0x3f14b039, 0x3f5064af, 0x3f150204, 0x3f502a3b, 0x3f1553b7, 0x3f4fefa8, 0x3f15a554, 0x3f4fb4f4,
-  0x3f15f6d9, 0x3f4f7a1f, 0x3f164847, 0x3f4f3f2b, 0x3f16999f, 0x3f4f0417, 0x3f16eadf, 0x3f4ec8e4,
-  0x3f173c07, 0x3f4e8d90, 0x3f178d18, 0x3f4e521c, 0x3f17de12, 0x3f4e1689, 0x3f182ef5, 0x3f4ddad5,
-  0x3f187fc0, 0x3f4d9f02, 0x3f18d073, 0x3f4d6310, 0x3f19210f, 0x3f4d26fd, 0x3f197194, 0x3f4ceacb,
-  0x3f19c200, 0x3f4cae79, 0x3f1a1255, 0x3f4c7208, 0x3f1a6293, 0x3f4c3578, 0x3f1ab2b8, 0x3f4bf8c7,
-  0x3f1b02c6, 0x3f4bbbf8, 0x3f1b52bb, 0x3f4b7f09, 0x3f1ba299, 0x3f4b41fa, 0x3f1bf25f, 0x3f4b04cc,
-  0x3f1c420c, 0x3f4ac77f, 0x3f1c91a2, 0x3f4a8a13, 0x3f1ce11f, 0x3f4a4c87, 0x3f1d3084, 0x3f4a0edc,
-  0x3f1d7fd1, 0x3f49d112, 0x3f1dcf06, 0x3f499329, 0x3f1e1e22, 0x3f495521, 0x3f1e6d26, 0x3f4916fa,
-  0x3f1ebc12, 0x3f48d8b3, 0x3f1f0ae5, 0x3f489a4e, 0x3f1f599f, 0x3f485bca, 0x3f1fa841, 0x3f481d27,
-  0x3f1ff6cb, 0x3f47de65, 0x3f20453b, 0x3f479f84, 0x3f209393, 0x3f476085, 0x3f20e1d2, 0x3f472167,
-  0x3f212ff9, 0x3f46e22a, 0x3f217e06, 0x3f46a2ce, 0x3f21cbfb, 0x3f466354, 0x3f2219d7, 0x3f4623bb,
-  0x3f226799, 0x3f45e403, 0x3f22b543, 0x3f45a42d, 0x3f2302d3, 0x3f456439, 0x3f23504b, 0x3f452426,
-  0x3f239da9, 0x3f44e3f5, 0x3f23eaee, 0x3f44a3a5, 0x3f24381a, 0x3f446337, 0x3f24852c, 0x3f4422ab,
-  0x3f24d225, 0x3f43e200, 0x3f251f04, 0x3f43a138, 0x3f256bcb, 0x3f436051, 0x3f25b877, 0x3f431f4c,
-  0x3f26050a, 0x3f42de29, 0x3f265184, 0x3f429ce8, 0x3f269de3, 0x3f425b89, 0x3f26ea2a, 0x3f421a0b,
-  0x3f273656, 0x3f41d870, 0x3f278268, 0x3f4196b7, 0x3f27ce61, 0x3f4154e1, 0x3f281a40, 0x3f4112ec,
-  0x3f286605, 0x3f40d0da, 0x3f28b1b0, 0x3f408ea9, 0x3f28fd41, 0x3f404c5c, 0x3f2948b8, 0x3f4009f0,
-  0x3f299415, 0x3f3fc767, 0x3f29df57, 0x3f3f84c0, 0x3f2a2a80, 0x3f3f41fc, 0x3f2a758e, 0x3f3eff1b,
-  0x3f2ac082, 0x3f3ebc1b, 0x3f2b0b5b, 0x3f3e78ff, 0x3f2b561b, 0x3f3e35c5, 0x3f2ba0bf, 0x3f3df26e,
-  0x3f2beb4a, 0x3f3daef9, 0x3f2c35b9, 0x3f3d6b67, 0x3f2c800f, 0x3f3d27b8, 0x3f2cca49, 0x3f3ce3ec,
-  0x3f2d1469, 0x3f3ca003, 0x3f2d5e6f, 0x3f3c5bfc, 0x3f2da859, 0x3f3c17d9, 0x3f2df229, 0x3f3bd398,
-  0x3f2e3bde, 0x3f3b8f3b, 0x3f2e8578, 0x3f3b4ac1, 0x3f2ecef7, 0x3f3b0629, 0x3f2f185b, 0x3f3ac175,
-  0x3f2f61a5, 0x3f3a7ca4, 0x3f2faad3, 0x3f3a37b7, 0x3f2ff3e6, 0x3f39f2ac, 0x3f303cde, 0x3f39ad85,
-  0x3f3085bb, 0x3f396842, 0x3f30ce7c, 0x3f3922e1, 0x3f311722, 0x3f38dd65, 0x3f315fad, 0x3f3897cb,
-  0x3f31a81d, 0x3f385216, 0x3f31f071, 0x3f380c43, 0x3f3238aa, 0x3f37c655, 0x3f3280c7, 0x3f37804a,
-  0x3f32c8c9, 0x3f373a23, 0x3f3310af, 0x3f36f3df, 0x3f33587a, 0x3f36ad7f, 0x3f33a029, 0x3f366704,
-  0x3f33e7bc, 0x3f36206c, 0x3f342f34, 0x3f35d9b8, 0x3f34768f, 0x3f3592e7, 0x3f34bdcf, 0x3f354bfb,
-  0x3f3504f3, 0x3f3504f3, 0x3f354bfb, 0x3f34bdcf, 0x3f3592e7, 0x3f34768f, 0x3f35d9b8, 0x3f342f34,
-  0x3f36206c, 0x3f33e7bc, 0x3f366704, 0x3f33a029, 0x3f36ad7f, 0x3f33587a, 0x3f36f3df, 0x3f3310af,
-  0x3f373a23, 0x3f32c8c9, 0x3f37804a, 0x3f3280c7, 0x3f37c655, 0x3f3238aa, 0x3f380c43, 0x3f31f071,
-  0x3f385216, 0x3f31a81d, 0x3f3897cb, 0x3f315fad, 0x3f38dd65, 0x3f311722, 0x3f3922e1, 0x3f30ce7c,
-  0x3f396842, 0x3f3085bb, 0x3f39ad85, 0x3f303cde, 0x3f39f2ac, 0x3f2ff3e6, 0x3f3a37b7, 0x3f2faad3,
-  0x3f3a7ca4, 0x3f2f61a5, 0x3f3ac175, 0x3f2f185b, 0x3f3b0629, 0x3f2ecef7, 0x3f3b4ac1, 0x3f2e8578,
-  0x3f3b8f3b, 0x3f2e3bde, 0x3f3bd398, 0x3f2df229, 0x3f3c17d9, 0x3f2da859, 0x3f3c5bfc, 0x3f2d5e6f,
-  0x3f3ca003, 0x3f2d1469, 0x3f3ce3ec, 0x3f2cca49, 0x3f3d27b8, 0x3f2c800f, 0x3f3d6b67, 0x3f2c35b9,
-  0x3f3daef9, 0x3f2beb4a, 0x3f3df26e, 0x3f2ba0bf, 0x3f3e35c5, 0x3f2b561b, 0x3f3e78ff, 0x3f2b0b5b,
-  0x3f3ebc1b, 0x3f2ac082, 0x3f3eff1b, 0x3f2a758e, 0x3f3f41fc, 0x3f2a2a80, 0x3f3f84c0, 0x3f29df57,
-  0x3f3fc767, 0x3f299415, 0x3f4009f0, 0x3f2948b8, 0x3f404c5c, 0x3f28fd41, 0x3f408ea9, 0x3f28b1b0,
-  0x3f40d0da, 0x3f286605, 0x3f4112ec, 0x3f281a40, 0x3f4154e1, 0x3f27ce61, 0x3f4196b7, 0x3f278268,
-  0x3f41d870, 0x3f273656, 0x3f421a0b, 0x3f26ea2a, 0x3f425b89, 0x3f269de3, 0x3f429ce8, 0x3f265184,
-  0x3f42de29, 0x3f26050a, 0x3f431f4c, 0x3f25b877, 0x3f436051, 0x3f256bcb, 0x3f43a138, 0x3f251f04,
-  0x3f43e200, 0x3f24d225, 0x3f4422ab, 0x3f24852c, 0x3f446337, 0x3f24381a, 0x3f44a3a5, 0x3f23eaee,
-  0x3f44e3f5, 0x3f239da9, 0x3f452426, 0x3f23504b, 0x3f456439, 0x3f2302d3, 0x3f45a42d, 0x3f22b543,
-  0x3f45e403, 0x3f226799, 0x3f4623bb, 0x3f2219d7, 0x3f466354, 0x3f21cbfb, 0x3f46a2ce, 0x3f217e06,
-  0x3f46e22a, 0x3f212ff9, 0x3f472167, 0x3f20e1d2, 0x3f476085, 0x3f209393, 0x3f479f84, 0x3f20453b,
-  0x3f47de65, 0x3f1ff6cb, 0x3f481d27, 0x3f1fa841, 0x3f485bca, 0x3f1f599f, 0x3f489a4e, 0x3f1f0ae5,
-  0x3f48d8b3, 0x3f1ebc12, 0x3f4916fa, 0x3f1e6d26, 0x3f495521, 0x3f1e1e22, 0x3f499329, 0x3f1dcf06,
-  0x3f49d112, 0x3f1d7fd1, 0x3f4a0edc, 0x3f1d3084, 0x3f4a4c87, 0x3f1ce11f, 0x3f4a8a13, 0x3f1c91a2,
-  0x3f4ac77f, 0x3f1c420c, 0x3f4b04cc, 0x3f1bf25f, 0x3f4b41fa, 0x3f1ba299, 0x3f4b7f09, 0x3f1b52bb,
-  0x3f4bbbf8, 0x3f1b02c6, 0x3f4bf8c7, 0x3f1ab2b8, 0x3f4c3578, 0x3f1a6293, 0x3f4c7208, 0x3f1a1255,
-  0x3f4cae79, 0x3f19c200, 0x3f4ceacb, 0x3f197194, 0x3f4d26fd, 0x3f19210f, 0x3f4d6310, 0x3f18d073,
-  0x3f4d9f02, 0x3f187fc0, 0x3f4ddad5, 0x3f182ef5, 0x3f4e1689, 0x3f17de12, 0x3f4e521c, 0x3f178d18,
-  0x3f4e8d90, 0x3f173c07, 0x3f4ec8e4, 0x3f16eadf, 0x3f4f0417, 0x3f16999f, 0x3f4f3f2b, 0x3f164847,
-  0x3f4f7a1f, 0x3f15f6d9, 0x3f4fb4f4, 0x3f15a554, 0x3f4fefa8, 0x3f1553b7, 0x3f502a3b, 0x3f150204,
-  0x3f5064af, 0x3f14b039, 0x3f509f03, 0x3f145e58, 0x3f50d937, 0x3f140c5f, 0x3f51134a, 0x3f13ba50,
-  0x3f514d3d, 0x3f13682a, 0x3f518710, 0x3f1315ee, 0x3f51c0c2, 0x3f12c39a, 0x3f51fa54, 0x3f127130,
-  0x3f5233c6, 0x3f121eb0, 0x3f526d18, 0x3f11cc19, 0x3f52a649, 0x3f11796b, 0x3f52df59, 0x3f1126a7,
-  0x3f531849, 0x3f10d3cd, 0x3f535118, 0x3f1080dc, 0x3f5389c7, 0x3f102dd5, 0x3f53c255, 0x3f0fdab8,
-  0x3f53fac3, 0x3f0f8784, 0x3f54330f, 0x3f0f343b, 0x3f546b3b, 0x3f0ee0db, 0x3f54a347, 0x3f0e8d65,
-  0x3f54db31, 0x3f0e39da, 0x3f5512fb, 0x3f0de638, 0x3f554aa4, 0x3f0d9281, 0x3f55822c, 0x3f0d3eb3,
-  0x3f55b993, 0x3f0cead0, 0x3f55f0d9, 0x3f0c96d7, 0x3f5627fe, 0x3f0c42c9, 0x3f565f02, 0x3f0beea5,
-  0x3f5695e5, 0x3f0b9a6b, 0x3f56cca7, 0x3f0b461c, 0x3f570348, 0x3f0af1b7, 0x3f5739c7, 0x3f0a9d3d,
-  0x3f577026, 0x3f0a48ad, 0x3f57a663, 0x3f09f409, 0x3f57dc7f, 0x3f099f4e, 0x3f581279, 0x3f094a7f,
-  0x3f584853, 0x3f08f59b, 0x3f587e0b, 0x3f08a0a1, 0x3f58b3a1, 0x3f084b92, 0x3f58e917, 0x3f07f66f,
-  0x3f591e6a, 0x3f07a136, 0x3f59539c, 0x3f074be8, 0x3f5988ad, 0x3f06f686, 0x3f59bd9c, 0x3f06a10e,
-  0x3f59f26a, 0x3f064b82, 0x3f5a2716, 0x3f05f5e2, 0x3f5a5ba0, 0x3f05a02c, 0x3f5a9009, 0x3f054a62,
-  0x3f5ac450, 0x3f04f484, 0x3f5af875, 0x3f049e91, 0x3f5b2c79, 0x3f044889, 0x3f5b605a, 0x3f03f26d,
-  0x3f5b941a, 0x3f039c3d, 0x3f5bc7b8, 0x3f0345f8, 0x3f5bfb34, 0x3f02ef9f, 0x3f5c2e8e, 0x3f029932,
-  0x3f5c61c7, 0x3f0242b1, 0x3f5c94dd, 0x3f01ec1c, 0x3f5cc7d1, 0x3f019573, 0x3f5cfaa3, 0x3f013eb5,
-  0x3f5d2d53, 0x3f00e7e4, 0x3f5d5fe1, 0x3f0090ff, 0x3f5d924d, 0x3f003a06, 0x3f5dc497, 0x3effc5f3,
-  0x3f5df6be, 0x3eff17b2, 0x3f5e28c3, 0x3efe694a, 0x3f5e5aa6, 0x3efdbabb, 0x3f5e8c67, 0x3efd0c04,
-  0x3f5ebe05, 0x3efc5d27, 0x3f5eef81, 0x3efbae22, 0x3f5f20db, 0x3efafef7, 0x3f5f5212, 0x3efa4fa5,
-  0x3f5f8327, 0x3ef9a02d, 0x3f5fb419, 0x3ef8f08e, 0x3f5fe4e9, 0x3ef840c8, 0x3f601596, 0x3ef790dc,
-  0x3f604621, 0x3ef6e0cb, 0x3f607689, 0x3ef63093, 0x3f60a6cf, 0x3ef58035, 0x3f60d6f2, 0x3ef4cfb1,
-  0x3f6106f2, 0x3ef41f07, 0x3f6136d0, 0x3ef36e38, 0x3f61668a, 0x3ef2bd43, 0x3f619622, 0x3ef20c29,
-  0x3f61c598, 0x3ef15aea, 0x3f61f4ea, 0x3ef0a985, 0x3f62241a, 0x3eeff7fb, 0x3f625326, 0x3eef464c,
-  0x3f628210, 0x3eee9479, 0x3f62b0d7, 0x3eede280, 0x3f62df7b, 0x3eed3063, 0x3f630dfc, 0x3eec7e21,
-  0x3f633c5a, 0x3eebcbbb, 0x3f636a95, 0x3eeb1930, 0x3f6398ac, 0x3eea6681, 0x3f63c6a1, 0x3ee9b3ae,
-  0x3f63f473, 0x3ee900b7, 0x3f642221, 0x3ee84d9c, 0x3f644fac, 0x3ee79a5d, 0x3f647d14, 0x3ee6e6fb,
-  0x3f64aa59, 0x3ee63375, 0x3f64d77b, 0x3ee57fcb, 0x3f650479, 0x3ee4cbfe, 0x3f653154, 0x3ee4180e,
-  0x3f655e0b, 0x3ee363fa, 0x3f658aa0, 0x3ee2afc4, 0x3f65b710, 0x3ee1fb6a, 0x3f65e35e, 0x3ee146ee,
-  0x3f660f88, 0x3ee0924f, 0x3f663b8e, 0x3edfdd8d, 0x3f666771, 0x3edf28a9, 0x3f669330, 0x3ede73a2,
-  0x3f66becc, 0x3eddbe79, 0x3f66ea45, 0x3edd092e, 0x3f671599, 0x3edc53c1, 0x3f6740ca, 0x3edb9e31,
-  0x3f676bd8, 0x3edae880, 0x3f6796c1, 0x3eda32ad, 0x3f67c187, 0x3ed97cb9, 0x3f67ec2a, 0x3ed8c6a3,
-  0x3f6816a8, 0x3ed8106b, 0x3f684103, 0x3ed75a13, 0x3f686b39, 0x3ed6a399, 0x3f68954c, 0x3ed5ecfd,
-  0x3f68bf3c, 0x3ed53641, 0x3f68e907, 0x3ed47f64, 0x3f6912ae, 0x3ed3c867, 0x3f693c32, 0x3ed31148,
-  0x3f696591, 0x3ed25a09, 0x3f698ecc, 0x3ed1a2aa, 0x3f69b7e4, 0x3ed0eb2a, 0x3f69e0d7, 0x3ed0338a,
-  0x3f6a09a7, 0x3ecf7bca, 0x3f6a3252, 0x3ecec3ea, 0x3f6a5ad9, 0x3ece0bea, 0x3f6a833c, 0x3ecd53ca,
-  0x3f6aab7b, 0x3ecc9b8b, 0x3f6ad395, 0x3ecbe32c, 0x3f6afb8c, 0x3ecb2aae, 0x3f6b235e, 0x3eca7210,
-  0x3f6b4b0c, 0x3ec9b953, 0x3f6b7295, 0x3ec90077, 0x3f6b99fb, 0x3ec8477c, 0x3f6bc13b, 0x3ec78e62,
-  0x3f6be858, 0x3ec6d529, 0x3f6c0f50, 0x3ec61bd2, 0x3f6c3624, 0x3ec5625c, 0x3f6c5cd4, 0x3ec4a8c8,
-  0x3f6c835e, 0x3ec3ef15, 0x3f6ca9c5, 0x3ec33544, 0x3f6cd007, 0x3ec27b55, 0x3f6cf624, 0x3ec1c148,
-  0x3f6d1c1d, 0x3ec1071e, 0x3f6d41f2, 0x3ec04cd5, 0x3f6d67a1, 0x3ebf926f, 0x3f6d8d2d, 0x3ebed7eb,
-  0x3f6db293, 0x3ebe1d4a, 0x3f6dd7d5, 0x3ebd628b, 0x3f6dfcf2, 0x3ebca7af, 0x3f6e21eb, 0x3ebbecb6,
-  0x3f6e46be, 0x3ebb31a0, 0x3f6e6b6d, 0x3eba766e, 0x3f6e8ff8, 0x3eb9bb1e, 0x3f6eb45d, 0x3eb8ffb2,
-  0x3f6ed89e, 0x3eb8442a, 0x3f6efcba, 0x3eb78884, 0x3f6f20b0, 0x3eb6ccc3, 0x3f6f4483, 0x3eb610e6,
-  0x3f6f6830, 0x3eb554ec, 0x3f6f8bb8, 0x3eb498d6, 0x3f6faf1b, 0x3eb3dca5, 0x3f6fd25a, 0x3eb32058,
-  0x3f6ff573, 0x3eb263ef, 0x3f701867, 0x3eb1a76b, 0x3f703b37, 0x3eb0eacb, 0x3f705de1, 0x3eb02e10,
-  0x3f708066, 0x3eaf713a, 0x3f70a2c6, 0x3eaeb449, 0x3f70c502, 0x3eadf73c, 0x3f70e717, 0x3ead3a15,
-  0x3f710908, 0x3eac7cd4, 0x3f712ad4, 0x3eabbf77, 0x3f714c7a, 0x3eab0201, 0x3f716dfb, 0x3eaa446f,
-  0x3f718f57, 0x3ea986c4, 0x3f71b08e, 0x3ea8c8fe, 0x3f71d19f, 0x3ea80b1f, 0x3f71f28c, 0x3ea74d25,
-  0x3f721352, 0x3ea68f12, 0x3f7233f4, 0x3ea5d0e5, 0x3f725470, 0x3ea5129f, 0x3f7274c7, 0x3ea4543f,
-  0x3f7294f8, 0x3ea395c5, 0x3f72b504, 0x3ea2d733, 0x3f72d4eb, 0x3ea21887, 0x3f72f4ac, 0x3ea159c2,
-  0x3f731447, 0x3ea09ae5, 0x3f7333be, 0x3e9fdbee, 0x3f73530e, 0x3e9f1cdf, 0x3f737239, 0x3e9e5db8,
-  0x3f73913f, 0x3e9d9e78, 0x3f73b01f, 0x3e9cdf20, 0x3f73ced9, 0x3e9c1faf, 0x3f73ed6e, 0x3e9b6027,
-  0x3f740bdd, 0x3e9aa086, 0x3f742a27, 0x3e99e0ce, 0x3f74484b, 0x3e9920fe, 0x3f746649, 0x3e986116,
-  0x3f748422, 0x3e97a117, 0x3f74a1d5, 0x3e96e100, 0x3f74bf62, 0x3e9620d2, 0x3f74dcc9, 0x3e95608d,
-  0x3f74fa0b, 0x3e94a031, 0x3f751727, 0x3e93dfbf, 0x3f75341d, 0x3e931f35, 0x3f7550ed, 0x3e925e94,
-  0x3f756d97, 0x3e919ddd, 0x3f758a1c, 0x3e90dd10, 0x3f75a67b, 0x3e901c2c, 0x3f75c2b3, 0x3e8f5b32,
-  0x3f75dec6, 0x3e8e9a22, 0x3f75fab3, 0x3e8dd8fc, 0x3f76167a, 0x3e8d17c0, 0x3f76321b, 0x3e8c566e,
-  0x3f764d97, 0x3e8b9507, 0x3f7668ec, 0x3e8ad38a, 0x3f76841b, 0x3e8a11f8, 0x3f769f24, 0x3e895050,
-  0x3f76ba07, 0x3e888e93, 0x3f76d4c4, 0x3e87ccc1, 0x3f76ef5b, 0x3e870ada, 0x3f7709cc, 0x3e8648df,
-  0x3f772417, 0x3e8586ce, 0x3f773e3c, 0x3e84c4aa, 0x3f77583a, 0x3e840270, 0x3f777213, 0x3e834022,
-  0x3f778bc5, 0x3e827dc0, 0x3f77a551, 0x3e81bb4a, 0x3f77beb7, 0x3e80f8c0, 0x3f77d7f7, 0x3e803622,
-  0x3f77f110, 0x3e7ee6e1, 0x3f780a04, 0x3e7d6156, 0x3f7822d1, 0x3e7bdba4, 0x3f783b77, 0x3e7a55cb,
-  0x3f7853f8, 0x3e78cfcc, 0x3f786c52, 0x3e7749a6, 0x3f788486, 0x3e75c35a, 0x3f789c93, 0x3e743ce8,
-  0x3f78b47b, 0x3e72b651, 0x3f78cc3b, 0x3e712f94, 0x3f78e3d6, 0x3e6fa8b2, 0x3f78fb4a, 0x3e6e21ab,
-  0x3f791298, 0x3e6c9a7f, 0x3f7929bf, 0x3e6b132f, 0x3f7940c0, 0x3e698bba, 0x3f79579a, 0x3e680422,
-  0x3f796e4e, 0x3e667c66, 0x3f7984dc, 0x3e64f486, 0x3f799b43, 0x3e636c83, 0x3f79b183, 0x3e61e45c,
-  0x3f79c79d, 0x3e605c13, 0x3f79dd91, 0x3e5ed3a8, 0x3f79f35e, 0x3e5d4b1a, 0x3f7a0904, 0x3e5bc26a,
-  0x3f7a1e84, 0x3e5a3997, 0x3f7a33dd, 0x3e58b0a4, 0x3f7a4910, 0x3e57278f, 0x3f7a5e1c, 0x3e559e58,
-  0x3f7a7302, 0x3e541501, 0x3f7a87c1, 0x3e528b89, 0x3f7a9c59, 0x3e5101f1, 0x3f7ab0cb, 0x3e4f7838,
-  0x3f7ac516, 0x3e4dee60, 0x3f7ad93a, 0x3e4c6467, 0x3f7aed37, 0x3e4ada4f, 0x3f7b010e, 0x3e495018,
-  0x3f7b14be, 0x3e47c5c2, 0x3f7b2848, 0x3e463b4d, 0x3f7b3bab, 0x3e44b0b9, 0x3f7b4ee7, 0x3e432607,
-  0x3f7b61fc, 0x3e419b37, 0x3f7b74ea, 0x3e401049, 0x3f7b87b2, 0x3e3e853e, 0x3f7b9a53, 0x3e3cfa15,
-  0x3f7baccd, 0x3e3b6ecf, 0x3f7bbf20, 0x3e39e36c, 0x3f7bd14d, 0x3e3857ec, 0x3f7be353, 0x3e36cc50,
-  0x3f7bf531, 0x3e354098, 0x3f7c06e9, 0x3e33b4c4, 0x3f7c187a, 0x3e3228d4, 0x3f7c29e5, 0x3e309cc9,
-  0x3f7c3b28, 0x3e2f10a2, 0x3f7c4c44, 0x3e2d8461, 0x3f7c5d3a, 0x3e2bf804, 0x3f7c6e08, 0x3e2a6b8d,
-  0x3f7c7eb0, 0x3e28defc, 0x3f7c8f31, 0x3e275251, 0x3f7c9f8a, 0x3e25c58c, 0x3f7cafbd, 0x3e2438ad,
-  0x3f7cbfc9, 0x3e22abb6, 0x3f7ccfae, 0x3e211ea5, 0x3f7cdf6c, 0x3e1f917b, 0x3f7cef03, 0x3e1e0438,
-  0x3f7cfe73, 0x3e1c76de, 0x3f7d0dbc, 0x3e1ae96b, 0x3f7d1cdd, 0x3e195be0, 0x3f7d2bd8, 0x3e17ce3d,
-  0x3f7d3aac, 0x3e164083, 0x3f7d4959, 0x3e14b2b2, 0x3f7d57de, 0x3e1324ca, 0x3f7d663d, 0x3e1196cc,
-  0x3f7d7474, 0x3e1008b7, 0x3f7d8285, 0x3e0e7a8b, 0x3f7d906e, 0x3e0cec4a, 0x3f7d9e30, 0x3e0b5df3,
-  0x3f7dabcc, 0x3e09cf86, 0x3f7db940, 0x3e084105, 0x3f7dc68c, 0x3e06b26e, 0x3f7dd3b2, 0x3e0523c2,
-  0x3f7de0b1, 0x3e039502, 0x3f7ded88, 0x3e02062e, 0x3f7dfa38, 0x3e007745, 0x3f7e06c2, 0x3dfdd092,
-  0x3f7e1324, 0x3dfab273, 0x3f7e1f5e, 0x3df7942c, 0x3f7e2b72, 0x3df475c0, 0x3f7e375e, 0x3df1572e,
-  0x3f7e4323, 0x3dee3876, 0x3f7e4ec1, 0x3deb199a, 0x3f7e5a38, 0x3de7fa9a, 0x3f7e6588, 0x3de4db76,
-  0x3f7e70b0, 0x3de1bc2e, 0x3f7e7bb1, 0x3dde9cc4, 0x3f7e868b, 0x3ddb7d37, 0x3f7e913d, 0x3dd85d89,
-  0x3f7e9bc9, 0x3dd53db9, 0x3f7ea62d, 0x3dd21dc8, 0x3f7eb069, 0x3dcefdb7, 0x3f7eba7f, 0x3dcbdd86,
-  0x3f7ec46d, 0x3dc8bd36, 0x3f7ece34, 0x3dc59cc6, 0x3f7ed7d4, 0x3dc27c39, 0x3f7ee14c, 0x3dbf5b8d,
-  0x3f7eea9d, 0x3dbc3ac3, 0x3f7ef3c7, 0x3db919dd, 0x3f7efcc9, 0x3db5f8da, 0x3f7f05a4, 0x3db2d7bb,
-  0x3f7f0e58, 0x3dafb680, 0x3f7f16e4, 0x3dac952b, 0x3f7f1f49, 0x3da973ba, 0x3f7f2787, 0x3da65230,
-  0x3f7f2f9d, 0x3da3308c, 0x3f7f378d, 0x3da00ecf, 0x3f7f3f54, 0x3d9cecf9, 0x3f7f46f4, 0x3d99cb0a,
-  0x3f7f4e6d, 0x3d96a905, 0x3f7f55bf, 0x3d9386e7, 0x3f7f5ce9, 0x3d9064b4, 0x3f7f63ec, 0x3d8d426a,
-  0x3f7f6ac7, 0x3d8a200a, 0x3f7f717b, 0x3d86fd94, 0x3f7f7808, 0x3d83db0a, 0x3f7f7e6d, 0x3d80b86c,
-  0x3f7f84ab, 0x3d7b2b74, 0x3f7f8ac2, 0x3d74e5e9, 0x3f7f90b1, 0x3d6ea038, 0x3f7f9678, 0x3d685a62,
-  0x3f7f9c18, 0x3d621468, 0x3f7fa191, 0x3d5bce4c, 0x3f7fa6e3, 0x3d55880e, 0x3f7fac0d, 0x3d4f41af,
-  0x3f7fb10f, 0x3d48fb2f, 0x3f7fb5ea, 0x3d42b491, 0x3f7fba9e, 0x3d3c6dd5, 0x3f7fbf2a, 0x3d3626fc,
-  0x3f7fc38f, 0x3d2fe007, 0x3f7fc7cc, 0x3d2998f6, 0x3f7fcbe2, 0x3d2351cc, 0x3f7fcfd1, 0x3d1d0a88,
-  0x3f7fd398, 0x3d16c32c, 0x3f7fd737, 0x3d107bb8, 0x3f7fdaaf, 0x3d0a342f, 0x3f7fde00, 0x3d03ec90,
-  0x3f7fe129, 0x3cfb49b9, 0x3f7fe42b, 0x3ceeba2d, 0x3f7fe705, 0x3ce22a7b, 0x3f7fe9b8, 0x3cd59aa6,
-  0x3f7fec43, 0x3cc90ab0, 0x3f7feea7, 0x3cbc7a9b, 0x3f7ff0e3, 0x3cafea69, 0x3f7ff2f8, 0x3ca35a1c,
-  0x3f7ff4e6, 0x3c96c9b6, 0x3f7ff6ac, 0x3c8a3938, 0x3f7ff84a, 0x3c7b514b, 0x3f7ff9c1, 0x3c623000,
-  0x3f7ffb11, 0x3c490e90, 0x3f7ffc39, 0x3c2fed02, 0x3f7ffd39, 0x3c16cb59, 0x3f7ffe13, 0x3bfb5330,
-  0x3f7ffec4, 0x3bc90f89, 0x3f7fff4e, 0x3b96cbc1, 0x3f7fffb1, 0x3b490fc7, 0x3f7fffec, 0x3ac90fd4,
-  0x3f800000, 0x00000000, 0x3f7fffec, 0xbac90fd4, 0x3f7fffb1, 0xbb490fc7, 0x3f7fff4e, 0xbb96cbc1,
-  0x3f7ffec4, 0xbbc90f89, 0x3f7ffe13, 0xbbfb5330, 0x3f7ffd39, 0xbc16cb59, 0x3f7ffc39, 0xbc2fed02,
-  0x3f7ffb11, 0xbc490e90, 0x3f7ff9c1, 0xbc623000, 0x3f7ff84a, 0xbc7b514b, 0x3f7ff6ac, 0xbc8a3938,
-  0x3f7ff4e6, 0xbc96c9b6, 0x3f7ff2f8, 0xbca35a1c, 0x3f7ff0e3, 0xbcafea69, 0x3f7feea7, 0xbcbc7a9b,
-  0x3f7fec43, 0xbcc90ab0, 0x3f7fe9b8, 0xbcd59aa6, 0x3f7fe705, 0xbce22a7b, 0x3f7fe42b, 0xbceeba2d,
-  0x3f7fe129, 0xbcfb49b9, 0x3f7fde00, 0xbd03ec90, 0x3f7fdaaf, 0xbd0a342f, 0x3f7fd737, 0xbd107bb8,
-  0x3f7fd398, 0xbd16c32c, 0x3f7fcfd1, 0xbd1d0a88, 0x3f7fcbe2, 0xbd2351cc, 0x3f7fc7cc, 0xbd2998f6,
-  0x3f7fc38f, 0xbd2fe007, 0x3f7fbf2a, 0xbd3626fc, 0x3f7fba9e, 0xbd3c6dd5, 0x3f7fb5ea, 0xbd42b491,
-  0x3f7fb10f, 0xbd48fb2f, 0x3f7fac0d, 0xbd4f41af, 0x3f7fa6e3, 0xbd55880e, 0x3f7fa191, 0xbd5bce4c,
-  0x3f7f9c18, 0xbd621468, 0x3f7f9678, 0xbd685a62, 0x3f7f90b1, 0xbd6ea038, 0x3f7f8ac2, 0xbd74e5e9,
-  0x3f7f84ab, 0xbd7b2b74, 0x3f7f7e6d, 0xbd80b86c, 0x3f7f7808, 0xbd83db0a, 0x3f7f717b, 0xbd86fd94,
-  0x3f7f6ac7, 0xbd8a200a, 0x3f7f63ec, 0xbd8d426a, 0x3f7f5ce9, 0xbd9064b4, 0x3f7f55bf, 0xbd9386e7,
-  0x3f7f4e6d, 0xbd96a905, 0x3f7f46f4, 0xbd99cb0a, 0x3f7f3f54, 0xbd9cecf9, 0x3f7f378d, 0xbda00ecf,
-  0x3f7f2f9d, 0xbda3308c, 0x3f7f2787, 0xbda65230, 0x3f7f1f49, 0xbda973ba, 0x3f7f16e4, 0xbdac952b,
-  0x3f7f0e58, 0xbdafb680, 0x3f7f05a4, 0xbdb2d7bb, 0x3f7efcc9, 0xbdb5f8da, 0x3f7ef3c7, 0xbdb919dd,
-  0x3f7eea9d, 0xbdbc3ac3, 0x3f7ee14c, 0xbdbf5b8d, 0x3f7ed7d4, 0xbdc27c39, 0x3f7ece34, 0xbdc59cc6,
-  0x3f7ec46d, 0xbdc8bd36, 0x3f7eba7f, 0xbdcbdd86, 0x3f7eb069, 0xbdcefdb7, 0x3f7ea62d, 0xbdd21dc8,
-  0x3f7e9bc9, 0xbdd53db9, 0x3f7e913d, 0xbdd85d89, 0x3f7e868b, 0xbddb7d37, 0x3f7e7bb1, 0xbdde9cc4,
-  0x3f7e70b0, 0xbde1bc2e, 0x3f7e6588, 0xbde4db76, 0x3f7e5a38, 0xbde7fa9a, 0x3f7e4ec1, 0xbdeb199a,
-  0x3f7e4323, 0xbdee3876, 0x3f7e375e, 0xbdf1572e, 0x3f7e2b72, 0xbdf475c0, 0x3f7e1f5e, 0xbdf7942c,
-  0x3f7e1324, 0xbdfab273, 0x3f7e06c2, 0xbdfdd092, 0x3f7dfa38, 0xbe007745, 0x3f7ded88, 0xbe02062e,
-  0x3f7de0b1, 0xbe039502, 0x3f7dd3b2, 0xbe0523c2, 0x3f7dc68c, 0xbe06b26e, 0x3f7db940, 0xbe084105,
-  0x3f7dabcc, 0xbe09cf86, 0x3f7d9e30, 0xbe0b5df3, 0x3f7d906e, 0xbe0cec4a, 0x3f7d8285, 0xbe0e7a8b,
-  0x3f7d7474, 0xbe1008b7, 0x3f7d663d, 0xbe1196cc, 0x3f7d57de, 0xbe1324ca, 0x3f7d4959, 0xbe14b2b2,
-  0x3f7d3aac, 0xbe164083, 0x3f7d2bd8, 0xbe17ce3d, 0x3f7d1cdd, 0xbe195be0, 0x3f7d0dbc, 0xbe1ae96b,
-  0x3f7cfe73, 0xbe1c76de, 0x3f7cef03, 0xbe1e0438, 0x3f7cdf6c, 0xbe1f917b, 0x3f7ccfae, 0xbe211ea5,
-  0x3f7cbfc9, 0xbe22abb6, 0x3f7cafbd, 0xbe2438ad, 0x3f7c9f8a, 0xbe25c58c, 0x3f7c8f31, 0xbe275251,
-  0x3f7c7eb0, 0xbe28defc, 0x3f7c6e08, 0xbe2a6b8d, 0x3f7c5d3a, 0xbe2bf804, 0x3f7c4c44, 0xbe2d8461,
-  0x3f7c3b28, 0xbe2f10a2, 0x3f7c29e5, 0xbe309cc9, 0x3f7c187a, 0xbe3228d4, 0x3f7c06e9, 0xbe33b4c4,
-  0x3f7bf531, 0xbe354098, 0x3f7be353, 0xbe36cc50, 0x3f7bd14d, 0xbe3857ec, 0x3f7bbf20, 0xbe39e36c,
-  0x3f7baccd, 0xbe3b6ecf, 0x3f7b9a53, 0xbe3cfa15, 0x3f7b87b2, 0xbe3e853e, 0x3f7b74ea, 0xbe401049,
-  0x3f7b61fc, 0xbe419b37, 0x3f7b4ee7, 0xbe432607, 0x3f7b3bab, 0xbe44b0b9, 0x3f7b2848, 0xbe463b4d,
-  0x3f7b14be, 0xbe47c5c2, 0x3f7b010e, 0xbe495018, 0x3f7aed37, 0xbe4ada4f, 0x3f7ad93a, 0xbe4c6467,
-  0x3f7ac516, 0xbe4dee60, 0x3f7ab0cb, 0xbe4f7838, 0x3f7a9c59, 0xbe5101f1, 0x3f7a87c1, 0xbe528b89,
-  0x3f7a7302, 0xbe541501, 0x3f7a5e1c, 0xbe559e58, 0x3f7a4910, 0xbe57278f, 0x3f7a33dd, 0xbe58b0a4,
-  0x3f7a1e84, 0xbe5a3997, 0x3f7a0904, 0xbe5bc26a, 0x3f79f35e, 0xbe5d4b1a, 0x3f79dd91, 0xbe5ed3a8,
-  0x3f79c79d, 0xbe605c13, 0x3f79b183, 0xbe61e45c, 0x3f799b43, 0xbe636c83, 0x3f7984dc, 0xbe64f486,
-  0x3f796e4e, 0xbe667c66, 0x3f79579a, 0xbe680422, 0x3f7940c0, 0xbe698bba, 0x3f7929bf, 0xbe6b132f,
-  0x3f791298, 0xbe6c9a7f, 0x3f78fb4a, 0xbe6e21ab, 0x3f78e3d6, 0xbe6fa8b2, 0x3f78cc3b, 0xbe712f94,
-  0x3f78b47b, 0xbe72b651, 0x3f789c93, 0xbe743ce8, 0x3f788486, 0xbe75c35a, 0x3f786c52, 0xbe7749a6,
-  0x3f7853f8, 0xbe78cfcc, 0x3f783b77, 0xbe7a55cb, 0x3f7822d1, 0xbe7bdba4, 0x3f780a04, 0xbe7d6156,
-  0x3f77f110, 0xbe7ee6e1, 0x3f77d7f7, 0xbe803622, 0x3f77beb7, 0xbe80f8c0, 0x3f77a551, 0xbe81bb4a,
-  0x3f778bc5, 0xbe827dc0, 0x3f777213, 0xbe834022, 0x3f77583a, 0xbe840270, 0x3f773e3c, 0xbe84c4aa,
-  0x3f772417, 0xbe8586ce, 0x3f7709cc, 0xbe8648df, 0x3f76ef5b, 0xbe870ada, 0x3f76d4c4, 0xbe87ccc1,
-  0x3f76ba07, 0xbe888e93, 0x3f769f24, 0xbe895050, 0x3f76841b, 0xbe8a11f8, 0x3f7668ec, 0xbe8ad38a,
-  0x3f764d97, 0xbe8b9507, 0x3f76321b, 0xbe8c566e, 0x3f76167a, 0xbe8d17c0, 0x3f75fab3, 0xbe8dd8fc,
-  0x3f75dec6, 0xbe8e9a22, 0x3f75c2b3, 0xbe8f5b32, 0x3f75a67b, 0xbe901c2c, 0x3f758a1c, 0xbe90dd10,
-  0x3f756d97, 0xbe919ddd, 0x3f7550ed, 0xbe925e94, 0x3f75341d, 0xbe931f35, 0x3f751727, 0xbe93dfbf,
-  0x3f74fa0b, 0xbe94a031, 0x3f74dcc9, 0xbe95608d, 0x3f74bf62, 0xbe9620d2, 0x3f74a1d5, 0xbe96e100,
-  0x3f748422, 0xbe97a117, 0x3f746649, 0xbe986116, 0x3f74484b, 0xbe9920fe, 0x3f742a27, 0xbe99e0ce,
-  0x3f740bdd, 0xbe9aa086, 0x3f73ed6e, 0xbe9b6027, 0x3f73ced9, 0xbe9c1faf, 0x3f73b01f, 0xbe9cdf20,
-  0x3f73913f, 0xbe9d9e78, 0x3f737239, 0xbe9e5db8, 0x3f73530e, 0xbe9f1cdf, 0x3f7333be, 0xbe9fdbee,
-  0x3f731447, 0xbea09ae5, 0x3f72f4ac, 0xbea159c2, 0x3f72d4eb, 0xbea21887, 0x3f72b504, 0xbea2d733,
-  0x3f7294f8, 0xbea395c5, 0x3f7274c7, 0xbea4543f, 0x3f725470, 0xbea5129f, 0x3f7233f4, 0xbea5d0e5,
-  0x3f721352, 0xbea68f12, 0x3f71f28c, 0xbea74d25, 0x3f71d19f, 0xbea80b1f, 0x3f71b08e, 0xbea8c8fe,
-  0x3f718f57, 0xbea986c4, 0x3f716dfb, 0xbeaa446f, 0x3f714c7a, 0xbeab0201, 0x3f712ad4, 0xbeabbf77,
-  0x3f710908, 0xbeac7cd4, 0x3f70e717, 0xbead3a15, 0x3f70c502, 0xbeadf73c, 0x3f70a2c6, 0xbeaeb449,
-  0x3f708066, 0xbeaf713a, 0x3f705de1, 0xbeb02e10, 0x3f703b37, 0xbeb0eacb, 0x3f701867, 0xbeb1a76b,
-  0x3f6ff573, 0xbeb263ef, 0x3f6fd25a, 0xbeb32058, 0x3f6faf1b, 0xbeb3dca5, 0x3f6f8bb8, 0xbeb498d6,
-  0x3f6f6830, 0xbeb554ec, 0x3f6f4483, 0xbeb610e6, 0x3f6f20b0, 0xbeb6ccc3, 0x3f6efcba, 0xbeb78884,
-  0x3f6ed89e, 0xbeb8442a, 0x3f6eb45d, 0xbeb8ffb2, 0x3f6e8ff8, 0xbeb9bb1e, 0x3f6e6b6d, 0xbeba766e,
-  0x3f6e46be, 0xbebb31a0, 0x3f6e21eb, 0xbebbecb6, 0x3f6dfcf2, 0xbebca7af, 0x3f6dd7d5, 0xbebd628b,
-  0x3f6db293, 0xbebe1d4a, 0x3f6d8d2d, 0xbebed7eb, 0x3f6d67a1, 0xbebf926f, 0x3f6d41f2, 0xbec04cd5,
-  0x3f6d1c1d, 0xbec1071e, 0x3f6cf624, 0xbec1c148, 0x3f6cd007, 0xbec27b55, 0x3f6ca9c5, 0xbec33544,
-  0x3f6c835e, 0xbec3ef15, 0x3f6c5cd4, 0xbec4a8c8, 0x3f6c3624, 0xbec5625c, 0x3f6c0f50, 0xbec61bd2,
-  0x3f6be858, 0xbec6d529, 0x3f6bc13b, 0xbec78e62, 0x3f6b99fb, 0xbec8477c, 0x3f6b7295, 0xbec90077,
-  0x3f6b4b0c, 0xbec9b953, 0x3f6b235e, 0xbeca7210, 0x3f6afb8c, 0xbecb2aae, 0x3f6ad395, 0xbecbe32c,
-  0x3f6aab7b, 0xbecc9b8b, 0x3f6a833c, 0xbecd53ca, 0x3f6a5ad9, 0xbece0bea, 0x3f6a3252, 0xbecec3ea,
-  0x3f6a09a7, 0xbecf7bca, 0x3f69e0d7, 0xbed0338a, 0x3f69b7e4, 0xbed0eb2a, 0x3f698ecc, 0xbed1a2aa,
-  0x3f696591, 0xbed25a09, 0x3f693c32, 0xbed31148, 0x3f6912ae, 0xbed3c867, 0x3f68e907, 0xbed47f64,
-  0x3f68bf3c, 0xbed53641, 0x3f68954c, 0xbed5ecfd, 0x3f686b39, 0xbed6a399, 0x3f684103, 0xbed75a13,
-  0x3f6816a8, 0xbed8106b, 0x3f67ec2a, 0xbed8c6a3, 0x3f67c187, 0xbed97cb9, 0x3f6796c1, 0xbeda32ad,
-  0x3f676bd8, 0xbedae880, 0x3f6740ca, 0xbedb9e31, 0x3f671599, 0xbedc53c1, 0x3f66ea45, 0xbedd092e,
-  0x3f66becc, 0xbeddbe79, 0x3f669330, 0xbede73a2, 0x3f666771, 0xbedf28a9, 0x3f663b8e, 0xbedfdd8d,
-  0x3f660f88, 0xbee0924f, 0x3f65e35e, 0xbee146ee, 0x3f65b710, 0xbee1fb6a, 0x3f658aa0, 0xbee2afc4,
-  0x3f655e0b, 0xbee363fa, 0x3f653154, 0xbee4180e, 0x3f650479, 0xbee4cbfe, 0x3f64d77b, 0xbee57fcb,
-  0x3f64aa59, 0xbee63375, 0x3f647d14, 0xbee6e6fb, 0x3f644fac, 0xbee79a5d, 0x3f642221, 0xbee84d9c,
-  0x3f63f473, 0xbee900b7, 0x3f63c6a1, 0xbee9b3ae, 0x3f6398ac, 0xbeea6681, 0x3f636a95, 0xbeeb1930,
-  0x3f633c5a, 0xbeebcbbb, 0x3f630dfc, 0xbeec7e21, 0x3f62df7b, 0xbeed3063, 0x3f62b0d7, 0xbeede280,
-  0x3f628210, 0xbeee9479, 0x3f625326, 0xbeef464c, 0x3f62241a, 0xbeeff7fb, 0x3f61f4ea, 0xbef0a985,
-  0x3f61c598, 0xbef15aea, 0x3f619622, 0xbef20c29, 0x3f61668a, 0xbef2bd43, 0x3f6136d0, 0xbef36e38,
-  0x3f6106f2, 0xbef41f07, 0x3f60d6f2, 0xbef4cfb1, 0x3f60a6cf, 0xbef58035, 0x3f607689, 0xbef63093,
-  0x3f604621, 0xbef6e0cb, 0x3f601596, 0xbef790dc, 0x3f5fe4e9, 0xbef840c8, 0x3f5fb419, 0xbef8f08e,
-  0x3f5f8327, 0xbef9a02d, 0x3f5f5212, 0xbefa4fa5, 0x3f5f20db, 0xbefafef7, 0x3f5eef81, 0xbefbae22,
-  0x3f5ebe05, 0xbefc5d27, 0x3f5e8c67, 0xbefd0c04, 0x3f5e5aa6, 0xbefdbabb, 0x3f5e28c3, 0xbefe694a,
-  0x3f5df6be, 0xbeff17b2, 0x3f5dc497, 0xbeffc5f3, 0x3f5d924d, 0xbf003a06, 0x3f5d5fe1, 0xbf0090ff,
-  0x3f5d2d53, 0xbf00e7e4, 0x3f5cfaa3, 0xbf013eb5, 0x3f5cc7d1, 0xbf019573, 0x3f5c94dd, 0xbf01ec1c,
-  0x3f5c61c7, 0xbf0242b1, 0x3f5c2e8e, 0xbf029932, 0x3f5bfb34, 0xbf02ef9f, 0x3f5bc7b8, 0xbf0345f8,
-  0x3f5b941a, 0xbf039c3d, 0x3f5b605a, 0xbf03f26d, 0x3f5b2c79, 0xbf044889, 0x3f5af875, 0xbf049e91,
-  0x3f5ac450, 0xbf04f484, 0x3f5a9009, 0xbf054a62, 0x3f5a5ba0, 0xbf05a02c, 0x3f5a2716, 0xbf05f5e2,
-  0x3f59f26a, 0xbf064b82, 0x3f59bd9c, 0xbf06a10e, 0x3f5988ad, 0xbf06f686, 0x3f59539c, 0xbf074be8,
-  0x3f591e6a, 0xbf07a136, 0x3f58e917, 0xbf07f66f, 0x3f58b3a1, 0xbf084b92, 0x3f587e0b, 0xbf08a0a1,
-  0x3f584853, 0xbf08f59b, 0x3f581279, 0xbf094a7f, 0x3f57dc7f, 0xbf099f4e, 0x3f57a663, 0xbf09f409,
-  0x3f577026, 0xbf0a48ad, 0x3f5739c7, 0xbf0a9d3d, 0x3f570348, 0xbf0af1b7, 0x3f56cca7, 0xbf0b461c,
-  0x3f5695e5, 0xbf0b9a6b, 0x3f565f02, 0xbf0beea5, 0x3f5627fe, 0xbf0c42c9, 0x3f55f0d9, 0xbf0c96d7,
-  0x3f55b993, 0xbf0cead0, 0x3f55822c, 0xbf0d3eb3, 0x3f554aa4, 0xbf0d9281, 0x3f5512fb, 0xbf0de638,
-  0x3f54db31, 0xbf0e39da, 0x3f54a347, 0xbf0e8d65, 0x3f546b3b, 0xbf0ee0db, 0x3f54330f, 0xbf0f343b,
-  0x3f53fac3, 0xbf0f8784, 0x3f53c255, 0xbf0fdab8, 0x3f5389c7, 0xbf102dd5, 0x3f535118, 0xbf1080dc,
-  0x3f531849, 0xbf10d3cd, 0x3f52df59, 0xbf1126a7, 0x3f52a649, 0xbf11796b, 0x3f526d18, 0xbf11cc19,
-  0x3f5233c6, 0xbf121eb0, 0x3f51fa54, 0xbf127130, 0x3f51c0c2, 0xbf12c39a, 0x3f518710, 0xbf1315ee,
-  0x3f514d3d, 0xbf13682a, 0x3f51134a, 0xbf13ba50, 0x3f50d937, 0xbf140c5f, 0x3f509f03, 0xbf145e58,
-  0x3f5064af, 0xbf14b039, 0x3f502a3b, 0xbf150204, 0x3f4fefa8, 0xbf1553b7, 0x3f4fb4f4, 0xbf15a554,
-  0x3f4f7a1f, 0xbf15f6d9, 0x3f4f3f2b, 0xbf164847, 0x3f4f0417, 0xbf16999f, 0x3f4ec8e4, 0xbf16eadf,
-  0x3f4e8d90, 0xbf173c07, 0x3f4e521c, 0xbf178d18, 0x3f4e1689, 0xbf17de12, 0x3f4ddad5, 0xbf182ef5,
-  0x3f4d9f02, 0xbf187fc0, 0x3f4d6310, 0xbf18d073, 0x3f4d26fd, 0xbf19210f, 0x3f4ceacb, 0xbf197194,
-  0x3f4cae79, 0xbf19c200, 0x3f4c7208, 0xbf1a1255, 0x3f4c3578, 0xbf1a6293, 0x3f4bf8c7, 0xbf1ab2b8,
-  0x3f4bbbf8, 0xbf1b02c6, 0x3f4b7f09, 0xbf1b52bb, 0x3f4b41fa, 0xbf1ba299, 0x3f4b04cc, 0xbf1bf25f,
-  0x3f4ac77f, 0xbf1c420c, 0x3f4a8a13, 0xbf1c91a2, 0x3f4a4c87, 0xbf1ce11f, 0x3f4a0edc, 0xbf1d3084,
-  0x3f49d112, 0xbf1d7fd1, 0x3f499329, 0xbf1dcf06, 0x3f495521, 0xbf1e1e22, 0x3f4916fa, 0xbf1e6d26,
-  0x3f48d8b3, 0xbf1ebc12, 0x3f489a4e, 0xbf1f0ae5, 0x3f485bca, 0xbf1f599f, 0x3f481d27, 0xbf1fa841,
-  0x3f47de65, 0xbf1ff6cb, 0x3f479f84, 0xbf20453b, 0x3f476085, 0xbf209393, 0x3f472167, 0xbf20e1d2,
-  0x3f46e22a, 0xbf212ff9, 0x3f46a2ce, 0xbf217e06, 0x3f466354, 0xbf21cbfb, 0x3f4623bb, 0xbf2219d7,
-  0x3f45e403, 0xbf226799, 0x3f45a42d, 0xbf22b543, 0x3f456439, 0xbf2302d3, 0x3f452426, 0xbf23504b,
-  0x3f44e3f5, 0xbf239da9, 0x3f44a3a5, 0xbf23eaee, 0x3f446337, 0xbf24381a, 0x3f4422ab, 0xbf24852c,
-  0x3f43e200, 0xbf24d225, 0x3f43a138, 0xbf251f04, 0x3f436051, 0xbf256bcb, 0x3f431f4c, 0xbf25b877,
-  0x3f42de29, 0xbf26050a, 0x3f429ce8, 0xbf265184, 0x3f425b89, 0xbf269de3, 0x3f421a0b, 0xbf26ea2a,
-  0x3f41d870, 0xbf273656, 0x3f4196b7, 0xbf278268, 0x3f4154e1, 0xbf27ce61, 0x3f4112ec, 0xbf281a40,
-  0x3f40d0da, 0xbf286605, 0x3f408ea9, 0xbf28b1b0, 0x3f404c5c, 0xbf28fd41, 0x3f4009f0, 0xbf2948b8,
-  0x3f3fc767, 0xbf299415, 0x3f3f84c0, 0xbf29df57, 0x3f3f41fc, 0xbf2a2a80, 0x3f3eff1b, 0xbf2a758e,
-  0x3f3ebc1b, 0xbf2ac082, 0x3f3e78ff, 0xbf2b0b5b, 0x3f3e35c5, 0xbf2b561b, 0x3f3df26e, 0xbf2ba0bf,
-  0x3f3daef9, 0xbf2beb4a, 0x3f3d6b67, 0xbf2c35b9, 0x3f3d27b8, 0xbf2c800f, 0x3f3ce3ec, 0xbf2cca49,
-  0x3f3ca003, 0xbf2d1469, 0x3f3c5bfc, 0xbf2d5e6f, 0x3f3c17d9, 0xbf2da859, 0x3f3bd398, 0xbf2df229,
-  0x3f3b8f3b, 0xbf2e3bde, 0x3f3b4ac1, 0xbf2e8578, 0x3f3b0629, 0xbf2ecef7, 0x3f3ac175, 0xbf2f185b,
-  0x3f3a7ca4, 0xbf2f61a5, 0x3f3a37b7, 0xbf2faad3, 0x3f39f2ac, 0xbf2ff3e6, 0x3f39ad85, 0xbf303cde,
-  0x3f396842, 0xbf3085bb, 0x3f3922e1, 0xbf30ce7c, 0x3f38dd65, 0xbf311722, 0x3f3897cb, 0xbf315fad,
-  0x3f385216, 0xbf31a81d, 0x3f380c43, 0xbf31f071, 0x3f37c655, 0xbf3238aa, 0x3f37804a, 0xbf3280c7,
-  0x3f373a23, 0xbf32c8c9, 0x3f36f3df, 0xbf3310af, 0x3f36ad7f, 0xbf33587a, 0x3f366704, 0xbf33a029,
-  0x3f36206c, 0xbf33e7bc, 0x3f35d9b8, 0xbf342f34, 0x3f3592e7, 0xbf34768f, 0x3f354bfb, 0xbf34bdcf,
-  0x3f3504f3, 0xbf3504f3, 0x3f34bdcf, 0xbf354bfb, 0x3f34768f, 0xbf3592e7, 0x3f342f34, 0xbf35d9b8,
-  0x3f33e7bc, 0xbf36206c, 0x3f33a029, 0xbf366704, 0x3f33587a, 0xbf36ad7f, 0x3f3310af, 0xbf36f3df,
-  0x3f32c8c9, 0xbf373a23, 0x3f3280c7, 0xbf37804a, 0x3f3238aa, 0xbf37c655, 0x3f31f071, 0xbf380c43,
-  0x3f31a81d, 0xbf385216, 0x3f315fad, 0xbf3897cb, 0x3f311722, 0xbf38dd65, 0x3f30ce7c, 0xbf3922e1,
-  0x3f3085bb, 0xbf396842, 0x3f303cde, 0xbf39ad85, 0x3f2ff3e6, 0xbf39f2ac, 0x3f2faad3, 0xbf3a37b7,
-  0x3f2f61a5, 0xbf3a7ca4, 0x3f2f185b, 0xbf3ac175, 0x3f2ecef7, 0xbf3b0629, 0x3f2e8578, 0xbf3b4ac1,
-  0x3f2e3bde, 0xbf3b8f3b, 0x3f2df229, 0xbf3bd398, 0x3f2da859, 0xbf3c17d9, 0x3f2d5e6f, 0xbf3c5bfc,
-  0x3f2d1469, 0xbf3ca003, 0x3f2cca49, 0xbf3ce3ec, 0x3f2c800f, 0xbf3d27b8, 0x3f2c35b9, 0xbf3d6b67,
-  0x3f2beb4a, 0xbf3daef9, 0x3f2ba0bf, 0xbf3df26e, 0x3f2b561b, 0xbf3e35c5, 0x3f2b0b5b, 0xbf3e78ff,
-  0x3f2ac082, 0xbf3ebc1b, 0x3f2a758e, 0xbf3eff1b, 0x3f2a2a80, 0xbf3f41fc, 0x3f29df57, 0xbf3f84c0,
-  0x3f299415, 0xbf3fc767, 0x3f2948b8, 0xbf4009f0, 0x3f28fd41, 0xbf404c5c, 0x3f28b1b0, 0xbf408ea9,
-  0x3f286605, 0xbf40d0da, 0x3f281a40, 0xbf4112ec, 0x3f27ce61, 0xbf4154e1, 0x3f278268, 0xbf4196b7,
-  0x3f273656, 0xbf41d870, 0x3f26ea2a, 0xbf421a0b, 0x3f269de3, 0xbf425b89, 0x3f265184, 0xbf429ce8,
-  0x3f26050a, 0xbf42de29, 0x3f25b877, 0xbf431f4c, 0x3f256bcb, 0xbf436051, 0x3f251f04, 0xbf43a138,
-  0x3f24d225, 0xbf43e200, 0x3f24852c, 0xbf4422ab, 0x3f24381a, 0xbf446337, 0x3f23eaee, 0xbf44a3a5,
-  0x3f239da9, 0xbf44e3f5, 0x3f23504b, 0xbf452426, 0x3f2302d3, 0xbf456439, 0x3f22b543, 0xbf45a42d,
-  0x3f226799, 0xbf45e403, 0x3f2219d7, 0xbf4623bb, 0x3f21cbfb, 0xbf466354, 0x3f217e06, 0xbf46a2ce,
-  0x3f212ff9, 0xbf46e22a, 0x3f20e1d2, 0xbf472167, 0x3f209393, 0xbf476085, 0x3f20453b, 0xbf479f84,
-  0x3f1ff6cb, 0xbf47de65, 0x3f1fa841, 0xbf481d27, 0x3f1f599f, 0xbf485bca, 0x3f1f0ae5, 0xbf489a4e,
-  0x3f1ebc12, 0xbf48d8b3, 0x3f1e6d26, 0xbf4916fa, 0x3f1e1e22, 0xbf495521, 0x3f1dcf06, 0xbf499329,
-  0x3f1d7fd1, 0xbf49d112, 0x3f1d3084, 0xbf4a0edc, 0x3f1ce11f, 0xbf4a4c87, 0x3f1c91a2, 0xbf4a8a13,
-  0x3f1c420c, 0xbf4ac77f, 0x3f1bf25f, 0xbf4b04cc, 0x3f1ba299, 0xbf4b41fa, 0x3f1b52bb, 0xbf4b7f09,
-  0x3f1b02c6, 0xbf4bbbf8, 0x3f1ab2b8, 0xbf4bf8c7, 0x3f1a6293, 0xbf4c3578, 0x3f1a1255, 0xbf4c7208,
-  0x3f19c200, 0xbf4cae79, 0x3f197194, 0xbf4ceacb, 0x3f19210f, 0xbf4d26fd, 0x3f18d073, 0xbf4d6310,
-  0x3f187fc0, 0xbf4d9f02, 0x3f182ef5, 0xbf4ddad5, 0x3f17de12, 0xbf4e1689, 0x3f178d18, 0xbf4e521c,
-  0x3f173c07, 0xbf4e8d90, 0x3f16eadf, 0xbf4ec8e4, 0x3f16999f, 0xbf4f0417, 0x3f164847, 0xbf4f3f2b,
-  0x3f15f6d9, 0xbf4f7a1f, 0x3f15a554, 0xbf4fb4f4, 0x3f1553b7, 0xbf4fefa8, 0x3f150204, 0xbf502a3b,
-  0x3f14b039, 0xbf5064af, 0x3f145e58, 0xbf509f03, 0x3f140c5f, 0xbf50d937, 0x3f13ba50, 0xbf51134a,
-  0x3f13682a, 0xbf514d3d, 0x3f1315ee, 0xbf518710, 0x3f12c39a, 0xbf51c0c2, 0x3f127130, 0xbf51fa54,
-  0x3f121eb0, 0xbf5233c6, 0x3f11cc19, 0xbf526d18, 0x3f11796b, 0xbf52a649, 0x3f1126a7, 0xbf52df59,
-  0x3f10d3cd, 0xbf531849, 0x3f1080dc, 0xbf535118, 0x3f102dd5, 0xbf5389c7, 0x3f0fdab8, 0xbf53c255,
-  0x3f0f8784, 0xbf53fac3, 0x3f0f343b, 0xbf54330f, 0x3f0ee0db, 0xbf546b3b, 0x3f0e8d65, 0xbf54a347,
-  0x3f0e39da, 0xbf54db31, 0x3f0de638, 0xbf5512fb, 0x3f0d9281, 0xbf554aa4, 0x3f0d3eb3, 0xbf55822c,
-  0x3f0cead0, 0xbf55b993, 0x3f0c96d7, 0xbf55f0d9, 0x3f0c42c9, 0xbf5627fe, 0x3f0beea5, 0xbf565f02,
-  0x3f0b9a6b, 0xbf5695e5, 0x3f0b461c, 0xbf56cca7, 0x3f0af1b7, 0xbf570348, 0x3f0a9d3d, 0xbf5739c7,
-  0x3f0a48ad, 0xbf577026, 0x3f09f409, 0xbf57a663, 0x3f099f4e, 0xbf57dc7f, 0x3f094a7f, 0xbf581279,
-  0x3f08f59b, 0xbf584853, 0x3f08a0a1, 0xbf587e0b, 0x3f084b92, 0xbf58b3a1, 0x3f07f66f, 0xbf58e917,
-  0x3f07a136, 0xbf591e6a, 0x3f074be8, 0xbf59539c, 0x3f06f686, 0xbf5988ad, 0x3f06a10e, 0xbf59bd9c,
-  0x3f064b82, 0xbf59f26a, 0x3f05f5e2, 0xbf5a2716, 0x3f05a02c, 0xbf5a5ba0, 0x3f054a62, 0xbf5a9009,
-  0x3f04f484, 0xbf5ac450, 0x3f049e91, 0xbf5af875, 0x3f044889, 0xbf5b2c79, 0x3f03f26d, 0xbf5b605a,
-  0x3f039c3d, 0xbf5b941a, 0x3f0345f8, 0xbf5bc7b8, 0x3f02ef9f, 0xbf5bfb34, 0x3f029932, 0xbf5c2e8e,
-  0x3f0242b1, 0xbf5c61c7, 0x3f01ec1c, 0xbf5c94dd, 0x3f019573, 0xbf5cc7d1, 0x3f013eb5, 0xbf5cfaa3,
-  0x3f00e7e4, 0xbf5d2d53, 0x3f0090ff, 0xbf5d5fe1, 0x3f003a06, 0xbf5d924d, 0x3effc5f3, 0xbf5dc497,
-  0x3eff17b2, 0xbf5df6be, 0x3efe694a, 0xbf5e28c3, 0x3efdbabb, 0xbf5e5aa6, 0x3efd0c04, 0xbf5e8c67,
-  0x3efc5d27, 0xbf5ebe05, 0x3efbae22, 0xbf5eef81, 0x3efafef7, 0xbf5f20db, 0x3efa4fa5, 0xbf5f5212,
-  0x3ef9a02d, 0xbf5f8327, 0x3ef8f08e, 0xbf5fb419, 0x3ef840c8, 0xbf5fe4e9, 0x3ef790dc, 0xbf601596,
-  0x3ef6e0cb, 0xbf604621, 0x3ef63093, 0xbf607689, 0x3ef58035, 0xbf60a6cf, 0x3ef4cfb1, 0xbf60d6f2,
-  0x3ef41f07, 0xbf6106f2, 0x3ef36e38, 0xbf6136d0, 0x3ef2bd43, 0xbf61668a, 0x3ef20c29, 0xbf619622,
-  0x3ef15aea, 0xbf61c598, 0x3ef0a985, 0xbf61f4ea, 0x3eeff7fb, 0xbf62241a, 0x3eef464c, 0xbf625326,
-  0x3eee9479, 0xbf628210, 0x3eede280, 0xbf62b0d7, 0x3eed3063, 0xbf62df7b, 0x3eec7e21, 0xbf630dfc,
-  0x3eebcbbb, 0xbf633c5a, 0x3eeb1930, 0xbf636a95, 0x3eea6681, 0xbf6398ac, 0x3ee9b3ae, 0xbf63c6a1,
-  0x3ee900b7, 0xbf63f473, 0x3ee84d9c, 0xbf642221, 0x3ee79a5d, 0xbf644fac, 0x3ee6e6fb, 0xbf647d14,
-  0x3ee63375, 0xbf64aa59, 0x3ee57fcb, 0xbf64d77b, 0x3ee4cbfe, 0xbf650479, 0x3ee4180e, 0xbf653154,
-  0x3ee363fa, 0xbf655e0b, 0x3ee2afc4, 0xbf658aa0, 0x3ee1fb6a, 0xbf65b710, 0x3ee146ee, 0xbf65e35e,
-  0x3ee0924f, 0xbf660f88, 0x3edfdd8d, 0xbf663b8e, 0x3edf28a9, 0xbf666771, 0x3ede73a2, 0xbf669330,
-  0x3eddbe79, 0xbf66becc, 0x3edd092e, 0xbf66ea45, 0x3edc53c1, 0xbf671599, 0x3edb9e31, 0xbf6740ca,
-  0x3edae880, 0xbf676bd8, 0x3eda32ad, 0xbf6796c1, 0x3ed97cb9, 0xbf67c187, 0x3ed8c6a3, 0xbf67ec2a,
-  0x3ed8106b, 0xbf6816a8, 0x3ed75a13, 0xbf684103, 0x3ed6a399, 0xbf686b39, 0x3ed5ecfd, 0xbf68954c,
-  0x3ed53641, 0xbf68bf3c, 0x3ed47f64, 0xbf68e907, 0x3ed3c867, 0xbf6912ae, 0x3ed31148, 0xbf693c32,
-  0x3ed25a09, 0xbf696591, 0x3ed1a2aa, 0xbf698ecc, 0x3ed0eb2a, 0xbf69b7e4, 0x3ed0338a, 0xbf69e0d7,
-  0x3ecf7bca, 0xbf6a09a7, 0x3ecec3ea, 0xbf6a3252, 0x3ece0bea, 0xbf6a5ad9, 0x3ecd53ca, 0xbf6a833c,
-  0x3ecc9b8b, 0xbf6aab7b, 0x3ecbe32c, 0xbf6ad395, 0x3ecb2aae, 0xbf6afb8c, 0x3eca7210, 0xbf6b235e,
-  0x3ec9b953, 0xbf6b4b0c, 0x3ec90077, 0xbf6b7295, 0x3ec8477c, 0xbf6b99fb, 0x3ec78e62, 0xbf6bc13b,
-  0x3ec6d529, 0xbf6be858, 0x3ec61bd2, 0xbf6c0f50, 0x3ec5625c, 0xbf6c3624, 0x3ec4a8c8, 0xbf6c5cd4,
-  0x3ec3ef15, 0xbf6c835e, 0x3ec33544, 0xbf6ca9c5, 0x3ec27b55, 0xbf6cd007, 0x3ec1c148, 0xbf6cf624,
-  0x3ec1071e, 0xbf6d1c1d, 0x3ec04cd5, 0xbf6d41f2, 0x3ebf926f, 0xbf6d67a1, 0x3ebed7eb, 0xbf6d8d2d,
-  0x3ebe1d4a, 0xbf6db293, 0x3ebd628b, 0xbf6dd7d5, 0x3ebca7af, 0xbf6dfcf2, 0x3ebbecb6, 0xbf6e21eb,
-  0x3ebb31a0, 0xbf6e46be, 0x3eba766e, 0xbf6e6b6d, 0x3eb9bb1e, 0xbf6e8ff8, 0x3eb8ffb2, 0xbf6eb45d,
-  0x3eb8442a, 0xbf6ed89e, 0x3eb78884, 0xbf6efcba, 0x3eb6ccc3, 0xbf6f20b0, 0x3eb610e6, 0xbf6f4483,
-  0x3eb554ec, 0xbf6f6830, 0x3eb498d6, 0xbf6f8bb8, 0x3eb3dca5, 0xbf6faf1b, 0x3eb32058, 0xbf6fd25a,
-  0x3eb263ef, 0xbf6ff573, 0x3eb1a76b, 0xbf701867, 0x3eb0eacb, 0xbf703b37, 0x3eb02e10, 0xbf705de1,
-  0x3eaf713a, 0xbf708066, 0x3eaeb449, 0xbf70a2c6, 0x3eadf73c, 0xbf70c502, 0x3ead3a15, 0xbf70e717,
-  0x3eac7cd4, 0xbf710908, 0x3eabbf77, 0xbf712ad4, 0x3eab0201, 0xbf714c7a, 0x3eaa446f, 0xbf716dfb,
-  0x3ea986c4, 0xbf718f57, 0x3ea8c8fe, 0xbf71b08e, 0x3ea80b1f, 0xbf71d19f, 0x3ea74d25, 0xbf71f28c,
-  0x3ea68f12, 0xbf721352, 0x3ea5d0e5, 0xbf7233f4, 0x3ea5129f, 0xbf725470, 0x3ea4543f, 0xbf7274c7,
-  0x3ea395c5, 0xbf7294f8, 0x3ea2d733, 0xbf72b504, 0x3ea21887, 0xbf72d4eb, 0x3ea159c2, 0xbf72f4ac,
-  0x3ea09ae5, 0xbf731447, 0x3e9fdbee, 0xbf7333be, 0x3e9f1cdf, 0xbf73530e, 0x3e9e5db8, 0xbf737239,
-  0x3e9d9e78, 0xbf73913f, 0x3e9cdf20, 0xbf73b01f, 0x3e9c1faf, 0xbf73ced9, 0x3e9b6027, 0xbf73ed6e,
-  0x3e9aa086, 0xbf740bdd, 0x3e99e0ce, 0xbf742a27, 0x3e9920fe, 0xbf74484b, 0x3e986116, 0xbf746649,
-  0x3e97a117, 0xbf748422, 0x3e96e100, 0xbf74a1d5, 0x3e9620d2, 0xbf74bf62, 0x3e95608d, 0xbf74dcc9,
-  0x3e94a031, 0xbf74fa0b, 0x3e93dfbf, 0xbf751727, 0x3e931f35, 0xbf75341d, 0x3e925e94, 0xbf7550ed,
-  0x3e919ddd, 0xbf756d97, 0x3e90dd10, 0xbf758a1c, 0x3e901c2c, 0xbf75a67b, 0x3e8f5b32, 0xbf75c2b3,
-  0x3e8e9a22, 0xbf75dec6, 0x3e8dd8fc, 0xbf75fab3, 0x3e8d17c0, 0xbf76167a, 0x3e8c566e, 0xbf76321b,
-  0x3e8b9507, 0xbf764d97, 0x3e8ad38a, 0xbf7668ec, 0x3e8a11f8, 0xbf76841b, 0x3e895050, 0xbf769f24,
-  0x3e888e93, 0xbf76ba07, 0x3e87ccc1, 0xbf76d4c4, 0x3e870ada, 0xbf76ef5b, 0x3e8648df, 0xbf7709cc,
-  0x3e8586ce, 0xbf772417, 0x3e84c4aa, 0xbf773e3c, 0x3e840270, 0xbf77583a, 0x3e834022, 0xbf777213,
-  0x3e827dc0, 0xbf778bc5, 0x3e81bb4a, 0xbf77a551, 0x3e80f8c0, 0xbf77beb7, 0x3e803622, 0xbf77d7f7,
-  0x3e7ee6e1, 0xbf77f110, 0x3e7d6156, 0xbf780a04, 0x3e7bdba4, 0xbf7822d1, 0x3e7a55cb, 0xbf783b77,
-  0x3e78cfcc, 0xbf7853f8, 0x3e7749a6, 0xbf786c52, 0x3e75c35a, 0xbf788486, 0x3e743ce8, 0xbf789c93,
-  0x3e72b651, 0xbf78b47b, 0x3e712f94, 0xbf78cc3b, 0x3e6fa8b2, 0xbf78e3d6, 0x3e6e21ab, 0xbf78fb4a,
-  0x3e6c9a7f, 0xbf791298, 0x3e6b132f, 0xbf7929bf, 0x3e698bba, 0xbf7940c0, 0x3e680422, 0xbf79579a,
-  0x3e667c66, 0xbf796e4e, 0x3e64f486, 0xbf7984dc, 0x3e636c83, 0xbf799b43, 0x3e61e45c, 0xbf79b183,
-  0x3e605c13, 0xbf79c79d, 0x3e5ed3a8, 0xbf79dd91, 0x3e5d4b1a, 0xbf79f35e, 0x3e5bc26a, 0xbf7a0904,
-  0x3e5a3997, 0xbf7a1e84, 0x3e58b0a4, 0xbf7a33dd, 0x3e57278f, 0xbf7a4910, 0x3e559e58, 0xbf7a5e1c,
-  0x3e541501, 0xbf7a7302, 0x3e528b89, 0xbf7a87c1, 0x3e5101f1, 0xbf7a9c59, 0x3e4f7838, 0xbf7ab0cb,
-  0x3e4dee60, 0xbf7ac516, 0x3e4c6467, 0xbf7ad93a, 0x3e4ada4f, 0xbf7aed37, 0x3e495018, 0xbf7b010e,
-  0x3e47c5c2, 0xbf7b14be, 0x3e463b4d, 0xbf7b2848, 0x3e44b0b9, 0xbf7b3bab, 0x3e432607, 0xbf7b4ee7,
-  0x3e419b37, 0xbf7b61fc, 0x3e401049, 0xbf7b74ea, 0x3e3e853e, 0xbf7b87b2, 0x3e3cfa15, 0xbf7b9a53,
-  0x3e3b6ecf, 0xbf7baccd, 0x3e39e36c, 0xbf7bbf20, 0x3e3857ec, 0xbf7bd14d, 0x3e36cc50, 0xbf7be353,
-  0x3e354098, 0xbf7bf531, 0x3e33b4c4, 0xbf7c06e9, 0x3e3228d4, 0xbf7c187a, 0x3e309cc9, 0xbf7c29e5,
-  0x3e2f10a2, 0xbf7c3b28, 0x3e2d8461, 0xbf7c4c44, 0x3e2bf804, 0xbf7c5d3a, 0x3e2a6b8d, 0xbf7c6e08,
-  0x3e28defc, 0xbf7c7eb0, 0x3e275251, 0xbf7c8f31, 0x3e25c58c, 0xbf7c9f8a, 0x3e2438ad, 0xbf7cafbd,
-  0x3e22abb6, 0xbf7cbfc9, 0x3e211ea5, 0xbf7ccfae, 0x3e1f917b, 0xbf7cdf6c, 0x3e1e0438, 0xbf7cef03,
-  0x3e1c76de, 0xbf7cfe73, 0x3e1ae96b, 0xbf7d0dbc, 0x3e195be0, 0xbf7d1cdd, 0x3e17ce3d, 0xbf7d2bd8,
-  0x3e164083, 0xbf7d3aac, 0x3e14b2b2, 0xbf7d4959, 0x3e1324ca, 0xbf7d57de, 0x3e1196cc, 0xbf7d663d,
-  0x3e1008b7, 0xbf7d7474, 0x3e0e7a8b, 0xbf7d8285, 0x3e0cec4a, 0xbf7d906e, 0x3e0b5df3, 0xbf7d9e30,
-  0x3e09cf86, 0xbf7dabcc, 0x3e084105, 0xbf7db940, 0x3e06b26e, 0xbf7dc68c, 0x3e0523c2, 0xbf7dd3b2,
-  0x3e039502, 0xbf7de0b1, 0x3e02062e, 0xbf7ded88, 0x3e007745, 0xbf7dfa38, 0x3dfdd092, 0xbf7e06c2,
-  0x3dfab273, 0xbf7e1324, 0x3df7942c, 0xbf7e1f5e, 0x3df475c0, 0xbf7e2b72, 0x3df1572e, 0xbf7e375e,
-  0x3dee3876, 0xbf7e4323, 0x3deb199a, 0xbf7e4ec1, 0x3de7fa9a, 0xbf7e5a38, 0x3de4db76, 0xbf7e6588,
-  0x3de1bc2e, 0xbf7e70b0, 0x3dde9cc4, 0xbf7e7bb1, 0x3ddb7d37, 0xbf7e868b, 0x3dd85d89, 0xbf7e913d,
-  0x3dd53db9, 0xbf7e9bc9, 0x3dd21dc8, 0xbf7ea62d, 0x3dcefdb7, 0xbf7eb069, 0x3dcbdd86, 0xbf7eba7f,
-  0x3dc8bd36, 0xbf7ec46d, 0x3dc59cc6, 0xbf7ece34, 0x3dc27c39, 0xbf7ed7d4, 0x3dbf5b8d, 0xbf7ee14c,
-  0x3dbc3ac3, 0xbf7eea9d, 0x3db919dd, 0xbf7ef3c7, 0x3db5f8da, 0xbf7efcc9, 0x3db2d7bb, 0xbf7f05a4,
-  0x3dafb680, 0xbf7f0e58, 0x3dac952b, 0xbf7f16e4, 0x3da973ba, 0xbf7f1f49, 0x3da65230, 0xbf7f2787,
-  0x3da3308c, 0xbf7f2f9d, 0x3da00ecf, 0xbf7f378d, 0x3d9cecf9, 0xbf7f3f54, 0x3d99cb0a, 0xbf7f46f4,
-  0x3d96a905, 0xbf7f4e6d, 0x3d9386e7, 0xbf7f55bf, 0x3d9064b4, 0xbf7f5ce9, 0x3d8d426a, 0xbf7f63ec,
-  0x3d8a200a, 0xbf7f6ac7, 0x3d86fd94, 0xbf7f717b, 0x3d83db0a, 0xbf7f7808, 0x3d80b86c, 0xbf7f7e6d,
-  0x3d7b2b74, 0xbf7f84ab, 0x3d74e5e9, 0xbf7f8ac2, 0x3d6ea038, 0xbf7f90b1, 0x3d685a62, 0xbf7f9678,
-  0x3d621468, 0xbf7f9c18, 0x3d5bce4c, 0xbf7fa191, 0x3d55880e, 0xbf7fa6e3, 0x3d4f41af, 0xbf7fac0d,
-  0x3d48fb2f, 0xbf7fb10f, 0x3d42b491, 0xbf7fb5ea, 0x3d3c6dd5, 0xbf7fba9e, 0x3d3626fc, 0xbf7fbf2a,
-  0x3d2fe007, 0xbf7fc38f, 0x3d2998f6, 0xbf7fc7cc, 0x3d2351cc, 0xbf7fcbe2, 0x3d1d0a88, 0xbf7fcfd1,
-  0x3d16c32c, 0xbf7fd398, 0x3d107bb8, 0xbf7fd737, 0x3d0a342f, 0xbf7fdaaf, 0x3d03ec90, 0xbf7fde00,
-  0x3cfb49b9, 0xbf7fe129, 0x3ceeba2d, 0xbf7fe42b, 0x3ce22a7b, 0xbf7fe705, 0x3cd59aa6, 0xbf7fe9b8,
-  0x3cc90ab0, 0xbf7fec43, 0x3cbc7a9b, 0xbf7feea7, 0x3cafea69, 0xbf7ff0e3, 0x3ca35a1c, 0xbf7ff2f8,
-  0x3c96c9b6, 0xbf7ff4e6, 0x3c8a3938, 0xbf7ff6ac, 0x3c7b514b, 0xbf7ff84a, 0x3c623000, 0xbf7ff9c1,
-  0x3c490e90, 0xbf7ffb11, 0x3c2fed02, 0xbf7ffc39, 0x3c16cb59, 0xbf7ffd39, 0x3bfb5330, 0xbf7ffe13,
-  0x3bc90f89, 0xbf7ffec4, 0x3b96cbc1, 0xbf7fff4e, 0x3b490fc7, 0xbf7fffb1, 0x3ac90fd4, 0xbf7fffec,
+const uint32_t rtaTwiddleCoefRfft1024Bits[1024] PROGMEM = {
+  0x00000000, 0x3f800000, 0x3bc90f88, 0x3f7ffec4, 0x3c490e90, 0x3f7ffb11, 0x3c96c9b6, 0x3f7ff4e6,
+  0x3cc90ab0, 0x3f7fec43, 0x3cfb49ba, 0x3f7fe129, 0x3d16c32c, 0x3f7fd397, 0x3d2fe007, 0x3f7fc38f,
+  0x3d48fb30, 0x3f7fb10f, 0x3d621469, 0x3f7f9c18, 0x3d7b2b74, 0x3f7f84ab, 0x3d8a200a, 0x3f7f6ac7,
+  0x3d96a905, 0x3f7f4e6d, 0x3da3308c, 0x3f7f2f9d, 0x3dafb680, 0x3f7f0e58, 0x3dbc3ac3, 0x3f7eea9d,
+  0x3dc8bd36, 0x3f7ec46d, 0x3dd53db9, 0x3f7e9bc9, 0x3de1bc2e, 0x3f7e70b0, 0x3dee3876, 0x3f7e4323,
+  0x3dfab273, 0x3f7e1324, 0x3e039502, 0x3f7de0b1, 0x3e09cf86, 0x3f7dabcc, 0x3e1008b7, 0x3f7d7474,
+  0x3e164083, 0x3f7d3aac, 0x3e1c76de, 0x3f7cfe73, 0x3e22abb6, 0x3f7cbfc9, 0x3e28defc, 0x3f7c7eb0,
+  0x3e2f10a2, 0x3f7c3b28, 0x3e354098, 0x3f7bf531, 0x3e3b6ecf, 0x3f7baccd, 0x3e419b37, 0x3f7b61fc,
+  0x3e47c5c2, 0x3f7b14be, 0x3e4dee60, 0x3f7ac516, 0x3e541501, 0x3f7a7302, 0x3e5a3997, 0x3f7a1e84,
+  0x3e605c13, 0x3f79c79d, 0x3e667c66, 0x3f796e4e, 0x3e6c9a7f, 0x3f791298, 0x3e72b651, 0x3f78b47b,
+  0x3e78cfcc, 0x3f7853f8, 0x3e7ee6e1, 0x3f77f110, 0x3e827dc0, 0x3f778bc5, 0x3e8586ce, 0x3f772417,
+  0x3e888e93, 0x3f76ba07, 0x3e8b9507, 0x3f764d97, 0x3e8e9a22, 0x3f75dec6, 0x3e919ddd, 0x3f756d97,
+  0x3e94a031, 0x3f74fa0b, 0x3e97a117, 0x3f748422, 0x3e9aa086, 0x3f740bdd, 0x3e9d9e78, 0x3f73913f,
+  0x3ea09ae5, 0x3f731447, 0x3ea395c5, 0x3f7294f8, 0x3ea68f12, 0x3f721352, 0x3ea986c4, 0x3f718f57,
+  0x3eac7cd4, 0x3f710908, 0x3eaf713a, 0x3f708066, 0x3eb263ef, 0x3f6ff573, 0x3eb554ec, 0x3f6f6830,
+  0x3eb8442a, 0x3f6ed89e, 0x3ebb31a0, 0x3f6e46be, 0x3ebe1d4a, 0x3f6db293, 0x3ec1071e, 0x3f6d1c1d,
+  0x3ec3ef15, 0x3f6c835e, 0x3ec6d529, 0x3f6be858, 0x3ec9b953, 0x3f6b4b0c, 0x3ecc9b8b, 0x3f6aab7b,
+  0x3ecf7bca, 0x3f6a09a7, 0x3ed25a09, 0x3f696591, 0x3ed53641, 0x3f68bf3c, 0x3ed8106b, 0x3f6816a8,
+  0x3edae880, 0x3f676bd8, 0x3eddbe79, 0x3f66becc, 0x3ee0924f, 0x3f660f88, 0x3ee363fa, 0x3f655e0b,
+  0x3ee63375, 0x3f64aa59, 0x3ee900b7, 0x3f63f473, 0x3eebcbbb, 0x3f633c5a, 0x3eee9479, 0x3f628210,
+  0x3ef15aea, 0x3f61c598, 0x3ef41f07, 0x3f6106f2, 0x3ef6e0cb, 0x3f604621, 0x3ef9a02d, 0x3f5f8327,
+  0x3efc5d27, 0x3f5ebe05, 0x3eff17b2, 0x3f5df6be, 0x3f00e7e4, 0x3f5d2d53, 0x3f0242b1, 0x3f5c61c7,
+  0x3f039c3d, 0x3f5b941a, 0x3f04f484, 0x3f5ac450, 0x3f064b82, 0x3f59f26a, 0x3f07a136, 0x3f591e6a,
+  0x3f08f59b, 0x3f584853, 0x3f0a48ad, 0x3f577026, 0x3f0b9a6b, 0x3f5695e5, 0x3f0cead0, 0x3f55b993,
+  0x3f0e39da, 0x3f54db31, 0x3f0f8784, 0x3f53fac3, 0x3f10d3cd, 0x3f531849, 0x3f121eb0, 0x3f5233c6,
+  0x3f13682a, 0x3f514d3d, 0x3f14b039, 0x3f5064af, 0x3f15f6d9, 0x3f4f7a1f, 0x3f173c07, 0x3f4e8d90,
+  0x3f187fc0, 0x3f4d9f02, 0x3f19c200, 0x3f4cae79, 0x3f1b02c6, 0x3f4bbbf8, 0x3f1c420c, 0x3f4ac77f,
+  0x3f1d7fd1, 0x3f49d112, 0x3f1ebc12, 0x3f48d8b3, 0x3f1ff6cb, 0x3f47de65, 0x3f212ff9, 0x3f46e22a,
+  0x3f226799, 0x3f45e403, 0x3f239da9, 0x3f44e3f5, 0x3f24d225, 0x3f43e200, 0x3f26050a, 0x3f42de29,
+  0x3f273656, 0x3f41d870, 0x3f286605, 0x3f40d0da, 0x3f299415, 0x3f3fc767, 0x3f2ac082, 0x3f3ebc1b,
+  0x3f2beb4a, 0x3f3daef9, 0x3f2d1469, 0x3f3ca003, 0x3f2e3bde, 0x3f3b8f3b, 0x3f2f61a5, 0x3f3a7ca4,
+  0x3f3085bb, 0x3f396842, 0x3f31a81d, 0x3f385216, 0x3f32c8c9, 0x3f373a23, 0x3f33e7bc, 0x3f36206c,
+  0x3f3504f3, 0x3f3504f3, 0x3f36206c, 0x3f33e7bc, 0x3f373a23, 0x3f32c8c9, 0x3f385216, 0x3f31a81d,
+  0x3f396842, 0x3f3085bb, 0x3f3a7ca4, 0x3f2f61a5, 0x3f3b8f3b, 0x3f2e3bde, 0x3f3ca003, 0x3f2d1469,
+  0x3f3daef9, 0x3f2beb4a, 0x3f3ebc1b, 0x3f2ac082, 0x3f3fc767, 0x3f299415, 0x3f40d0da, 0x3f286605,
+  0x3f41d870, 0x3f273656, 0x3f42de29, 0x3f26050a, 0x3f43e200, 0x3f24d225, 0x3f44e3f5, 0x3f239da9,
+  0x3f45e403, 0x3f226799, 0x3f46e22a, 0x3f212ff9, 0x3f47de65, 0x3f1ff6cb, 0x3f48d8b3, 0x3f1ebc12,
+  0x3f49d112, 0x3f1d7fd1, 0x3f4ac77f, 0x3f1c420c, 0x3f4bbbf8, 0x3f1b02c6, 0x3f4cae79, 0x3f19c200,
+  0x3f4d9f02, 0x3f187fc0, 0x3f4e8d90, 0x3f173c07, 0x3f4f7a1f, 0x3f15f6d9, 0x3f5064af, 0x3f14b039,
+  0x3f514d3d, 0x3f13682a, 0x3f5233c6, 0x3f121eb0, 0x3f531849, 0x3f10d3cd, 0x3f53fac3, 0x3f0f8784,
+  0x3f54db31, 0x3f0e39da, 0x3f55b993, 0x3f0cead0, 0x3f5695e5, 0x3f0b9a6b, 0x3f577026, 0x3f0a48ad,
+  0x3f584853, 0x3f08f59b, 0x3f591e6a, 0x3f07a136, 0x3f59f26a, 0x3f064b82, 0x3f5ac450, 0x3f04f484,
+  0x3f5b941a, 0x3f039c3d, 0x3f5c61c7, 0x3f0242b1, 0x3f5d2d53, 0x3f00e7e4, 0x3f5df6be, 0x3eff17b2,
+  0x3f5ebe05, 0x3efc5d27, 0x3f5f8327, 0x3ef9a02d, 0x3f604621, 0x3ef6e0cb, 0x3f6106f2, 0x3ef41f07,
+  0x3f61c598, 0x3ef15aea, 0x3f628210, 0x3eee9479, 0x3f633c5a, 0x3eebcbbb, 0x3f63f473, 0x3ee900b7,
+  0x3f64aa59, 0x3ee63375, 0x3f655e0b, 0x3ee363fa, 0x3f660f88, 0x3ee0924f, 0x3f66becc, 0x3eddbe79,
+  0x3f676bd8, 0x3edae880, 0x3f6816a8, 0x3ed8106b, 0x3f68bf3c, 0x3ed53641, 0x3f696591, 0x3ed25a09,
+  0x3f6a09a7, 0x3ecf7bca, 0x3f6aab7b, 0x3ecc9b8b, 0x3f6b4b0c, 0x3ec9b953, 0x3f6be858, 0x3ec6d529,
+  0x3f6c835e, 0x3ec3ef15, 0x3f6d1c1d, 0x3ec1071e, 0x3f6db293, 0x3ebe1d4a, 0x3f6e46be, 0x3ebb31a0,
+  0x3f6ed89e, 0x3eb8442a, 0x3f6f6830, 0x3eb554ec, 0x3f6ff573, 0x3eb263ef, 0x3f708066, 0x3eaf713a,
+  0x3f710908, 0x3eac7cd4, 0x3f718f57, 0x3ea986c4, 0x3f721352, 0x3ea68f12, 0x3f7294f8, 0x3ea395c5,
+  0x3f731447, 0x3ea09ae5, 0x3f73913f, 0x3e9d9e78, 0x3f740bdd, 0x3e9aa086, 0x3f748422, 0x3e97a117,
+  0x3f74fa0b, 0x3e94a031, 0x3f756d97, 0x3e919ddd, 0x3f75dec6, 0x3e8e9a22, 0x3f764d97, 0x3e8b9507,
+  0x3f76ba07, 0x3e888e93, 0x3f772417, 0x3e8586ce, 0x3f778bc5, 0x3e827dc0, 0x3f77f110, 0x3e7ee6e1,
+  0x3f7853f8, 0x3e78cfcc, 0x3f78b47b, 0x3e72b651, 0x3f791298, 0x3e6c9a7f, 0x3f796e4e, 0x3e667c66,
+  0x3f79c79d, 0x3e605c13, 0x3f7a1e84, 0x3e5a3997, 0x3f7a7302, 0x3e541501, 0x3f7ac516, 0x3e4dee60,
+  0x3f7b14be, 0x3e47c5c2, 0x3f7b61fc, 0x3e419b37, 0x3f7baccd, 0x3e3b6ecf, 0x3f7bf531, 0x3e354098,
+  0x3f7c3b28, 0x3e2f10a2, 0x3f7c7eb0, 0x3e28defc, 0x3f7cbfc9, 0x3e22abb6, 0x3f7cfe73, 0x3e1c76de,
+  0x3f7d3aac, 0x3e164083, 0x3f7d7474, 0x3e1008b7, 0x3f7dabcc, 0x3e09cf86, 0x3f7de0b1, 0x3e039502,
+  0x3f7e1324, 0x3dfab273, 0x3f7e4323, 0x3dee3876, 0x3f7e70b0, 0x3de1bc2e, 0x3f7e9bc9, 0x3dd53db9,
+  0x3f7ec46d, 0x3dc8bd36, 0x3f7eea9d, 0x3dbc3ac3, 0x3f7f0e58, 0x3dafb680, 0x3f7f2f9d, 0x3da3308c,
+  0x3f7f4e6d, 0x3d96a905, 0x3f7f6ac7, 0x3d8a200a, 0x3f7f84ab, 0x3d7b2b74, 0x3f7f9c18, 0x3d621469,
+  0x3f7fb10f, 0x3d48fb30, 0x3f7fc38f, 0x3d2fe007, 0x3f7fd397, 0x3d16c32c, 0x3f7fe129, 0x3cfb49ba,
+  0x3f7fec43, 0x3cc90ab0, 0x3f7ff4e6, 0x3c96c9b6, 0x3f7ffb11, 0x3c490e90, 0x3f7ffec4, 0x3bc90f88,
+  0x3f800000, 0x248d3132, 0x3f7ffec4, 0xbbc90f88, 0x3f7ffb11, 0xbc490e90, 0x3f7ff4e6, 0xbc96c9b6,
+  0x3f7fec43, 0xbcc90ab0, 0x3f7fe129, 0xbcfb49ba, 0x3f7fd397, 0xbd16c32c, 0x3f7fc38f, 0xbd2fe007,
+  0x3f7fb10f, 0xbd48fb30, 0x3f7f9c18, 0xbd621469, 0x3f7f84ab, 0xbd7b2b74, 0x3f7f6ac7, 0xbd8a200a,
+  0x3f7f4e6d, 0xbd96a905, 0x3f7f2f9d, 0xbda3308c, 0x3f7f0e58, 0xbdafb680, 0x3f7eea9d, 0xbdbc3ac3,
+  0x3f7ec46d, 0xbdc8bd36, 0x3f7e9bc9, 0xbdd53db9, 0x3f7e70b0, 0xbde1bc2e, 0x3f7e4323, 0xbdee3876,
+  0x3f7e1324, 0xbdfab273, 0x3f7de0b1, 0xbe039502, 0x3f7dabcc, 0xbe09cf86, 0x3f7d7474, 0xbe1008b7,
+  0x3f7d3aac, 0xbe164083, 0x3f7cfe73, 0xbe1c76de, 0x3f7cbfc9, 0xbe22abb6, 0x3f7c7eb0, 0xbe28defc,
+  0x3f7c3b28, 0xbe2f10a2, 0x3f7bf531, 0xbe354098, 0x3f7baccd, 0xbe3b6ecf, 0x3f7b61fc, 0xbe419b37,
+  0x3f7b14be, 0xbe47c5c2, 0x3f7ac516, 0xbe4dee60, 0x3f7a7302, 0xbe541501, 0x3f7a1e84, 0xbe5a3997,
+  0x3f79c79d, 0xbe605c13, 0x3f796e4e, 0xbe667c66, 0x3f791298, 0xbe6c9a7f, 0x3f78b47b, 0xbe72b651,
+  0x3f7853f8, 0xbe78cfcc, 0x3f77f110, 0xbe7ee6e1, 0x3f778bc5, 0xbe827dc0, 0x3f772417, 0xbe8586ce,
+  0x3f76ba07, 0xbe888e93, 0x3f764d97, 0xbe8b9507, 0x3f75dec6, 0xbe8e9a22, 0x3f756d97, 0xbe919ddd,
+  0x3f74fa0b, 0xbe94a031, 0x3f748422, 0xbe97a117, 0x3f740bdd, 0xbe9aa086, 0x3f73913f, 0xbe9d9e78,
+  0x3f731447, 0xbea09ae5, 0x3f7294f8, 0xbea395c5, 0x3f721352, 0xbea68f12, 0x3f718f57, 0xbea986c4,
+  0x3f710908, 0xbeac7cd4, 0x3f708066, 0xbeaf713a, 0x3f6ff573, 0xbeb263ef, 0x3f6f6830, 0xbeb554ec,
+  0x3f6ed89e, 0xbeb8442a, 0x3f6e46be, 0xbebb31a0, 0x3f6db293, 0xbebe1d4a, 0x3f6d1c1d, 0xbec1071e,
+  0x3f6c835e, 0xbec3ef15, 0x3f6be858, 0xbec6d529, 0x3f6b4b0c, 0xbec9b953, 0x3f6aab7b, 0xbecc9b8b,
+  0x3f6a09a7, 0xbecf7bca, 0x3f696591, 0xbed25a09, 0x3f68bf3c, 0xbed53641, 0x3f6816a8, 0xbed8106b,
+  0x3f676bd8, 0xbedae880, 0x3f66becc, 0xbeddbe79, 0x3f660f88, 0xbee0924f, 0x3f655e0b, 0xbee363fa,
+  0x3f64aa59, 0xbee63375, 0x3f63f473, 0xbee900b7, 0x3f633c5a, 0xbeebcbbb, 0x3f628210, 0xbeee9479,
+  0x3f61c598, 0xbef15aea, 0x3f6106f2, 0xbef41f07, 0x3f604621, 0xbef6e0cb, 0x3f5f8327, 0xbef9a02d,
+  0x3f5ebe05, 0xbefc5d27, 0x3f5df6be, 0xbeff17b2, 0x3f5d2d53, 0xbf00e7e4, 0x3f5c61c7, 0xbf0242b1,
+  0x3f5b941a, 0xbf039c3d, 0x3f5ac450, 0xbf04f484, 0x3f59f26a, 0xbf064b82, 0x3f591e6a, 0xbf07a136,
+  0x3f584853, 0xbf08f59b, 0x3f577026, 0xbf0a48ad, 0x3f5695e5, 0xbf0b9a6b, 0x3f55b993, 0xbf0cead0,
+  0x3f54db31, 0xbf0e39da, 0x3f53fac3, 0xbf0f8784, 0x3f531849, 0xbf10d3cd, 0x3f5233c6, 0xbf121eb0,
+  0x3f514d3d, 0xbf13682a, 0x3f5064af, 0xbf14b039, 0x3f4f7a1f, 0xbf15f6d9, 0x3f4e8d90, 0xbf173c07,
+  0x3f4d9f02, 0xbf187fc0, 0x3f4cae79, 0xbf19c200, 0x3f4bbbf8, 0xbf1b02c6, 0x3f4ac77f, 0xbf1c420c,
+  0x3f49d112, 0xbf1d7fd1, 0x3f48d8b3, 0xbf1ebc12, 0x3f47de65, 0xbf1ff6cb, 0x3f46e22a, 0xbf212ff9,
+  0x3f45e403, 0xbf226799, 0x3f44e3f5, 0xbf239da9, 0x3f43e200, 0xbf24d225, 0x3f42de29, 0xbf26050a,
+  0x3f41d870, 0xbf273656, 0x3f40d0da, 0xbf286605, 0x3f3fc767, 0xbf299415, 0x3f3ebc1b, 0xbf2ac082,
+  0x3f3daef9, 0xbf2beb4a, 0x3f3ca003, 0xbf2d1469, 0x3f3b8f3b, 0xbf2e3bde, 0x3f3a7ca4, 0xbf2f61a5,
+  0x3f396842, 0xbf3085bb, 0x3f385216, 0xbf31a81d, 0x3f373a23, 0xbf32c8c9, 0x3f36206c, 0xbf33e7bc,
+  0x3f3504f3, 0xbf3504f3, 0x3f33e7bc, 0xbf36206c, 0x3f32c8c9, 0xbf373a23, 0x3f31a81d, 0xbf385216,
+  0x3f3085bb, 0xbf396842, 0x3f2f61a5, 0xbf3a7ca4, 0x3f2e3bde, 0xbf3b8f3b, 0x3f2d1469, 0xbf3ca003,
+  0x3f2beb4a, 0xbf3daef9, 0x3f2ac082, 0xbf3ebc1b, 0x3f299415, 0xbf3fc767, 0x3f286605, 0xbf40d0da,
+  0x3f273656, 0xbf41d870, 0x3f26050a, 0xbf42de29, 0x3f24d225, 0xbf43e200, 0x3f239da9, 0xbf44e3f5,
+  0x3f226799, 0xbf45e403, 0x3f212ff9, 0xbf46e22a, 0x3f1ff6cb, 0xbf47de65, 0x3f1ebc12, 0xbf48d8b3,
+  0x3f1d7fd1, 0xbf49d112, 0x3f1c420c, 0xbf4ac77f, 0x3f1b02c6, 0xbf4bbbf8, 0x3f19c200, 0xbf4cae79,
+  0x3f187fc0, 0xbf4d9f02, 0x3f173c07, 0xbf4e8d90, 0x3f15f6d9, 0xbf4f7a1f, 0x3f14b039, 0xbf5064af,
+  0x3f13682a, 0xbf514d3d, 0x3f121eb0, 0xbf5233c6, 0x3f10d3cd, 0xbf531849, 0x3f0f8784, 0xbf53fac3,
+  0x3f0e39da, 0xbf54db31, 0x3f0cead0, 0xbf55b993, 0x3f0b9a6b, 0xbf5695e5, 0x3f0a48ad, 0xbf577026,
+  0x3f08f59b, 0xbf584853, 0x3f07a136, 0xbf591e6a, 0x3f064b82, 0xbf59f26a, 0x3f04f484, 0xbf5ac450,
+  0x3f039c3d, 0xbf5b941a, 0x3f0242b1, 0xbf5c61c7, 0x3f00e7e4, 0xbf5d2d53, 0x3eff17b2, 0xbf5df6be,
+  0x3efc5d27, 0xbf5ebe05, 0x3ef9a02d, 0xbf5f8327, 0x3ef6e0cb, 0xbf604621, 0x3ef41f07, 0xbf6106f2,
+  0x3ef15aea, 0xbf61c598, 0x3eee9479, 0xbf628210, 0x3eebcbbb, 0xbf633c5a, 0x3ee900b7, 0xbf63f473,
+  0x3ee63375, 0xbf64aa59, 0x3ee363fa, 0xbf655e0b, 0x3ee0924f, 0xbf660f88, 0x3eddbe79, 0xbf66becc,
+  0x3edae880, 0xbf676bd8, 0x3ed8106b, 0xbf6816a8, 0x3ed53641, 0xbf68bf3c, 0x3ed25a09, 0xbf696591,
+  0x3ecf7bca, 0xbf6a09a7, 0x3ecc9b8b, 0xbf6aab7b, 0x3ec9b953, 0xbf6b4b0c, 0x3ec6d529, 0xbf6be858,
+  0x3ec3ef15, 0xbf6c835e, 0x3ec1071e, 0xbf6d1c1d, 0x3ebe1d4a, 0xbf6db293, 0x3ebb31a0, 0xbf6e46be,
+  0x3eb8442a, 0xbf6ed89e, 0x3eb554ec, 0xbf6f6830, 0x3eb263ef, 0xbf6ff573, 0x3eaf713a, 0xbf708066,
+  0x3eac7cd4, 0xbf710908, 0x3ea986c4, 0xbf718f57, 0x3ea68f12, 0xbf721352, 0x3ea395c5, 0xbf7294f8,
+  0x3ea09ae5, 0xbf731447, 0x3e9d9e78, 0xbf73913f, 0x3e9aa086, 0xbf740bdd, 0x3e97a117, 0xbf748422,
+  0x3e94a031, 0xbf74fa0b, 0x3e919ddd, 0xbf756d97, 0x3e8e9a22, 0xbf75dec6, 0x3e8b9507, 0xbf764d97,
+  0x3e888e93, 0xbf76ba07, 0x3e8586ce, 0xbf772417, 0x3e827dc0, 0xbf778bc5, 0x3e7ee6e1, 0xbf77f110,
+  0x3e78cfcc, 0xbf7853f8, 0x3e72b651, 0xbf78b47b, 0x3e6c9a7f, 0xbf791298, 0x3e667c66, 0xbf796e4e,
+  0x3e605c13, 0xbf79c79d, 0x3e5a3997, 0xbf7a1e84, 0x3e541501, 0xbf7a7302, 0x3e4dee60, 0xbf7ac516,
+  0x3e47c5c2, 0xbf7b14be, 0x3e419b37, 0xbf7b61fc, 0x3e3b6ecf, 0xbf7baccd, 0x3e354098, 0xbf7bf531,
+  0x3e2f10a2, 0xbf7c3b28, 0x3e28defc, 0xbf7c7eb0, 0x3e22abb6, 0xbf7cbfc9, 0x3e1c76de, 0xbf7cfe73,
+  0x3e164083, 0xbf7d3aac, 0x3e1008b7, 0xbf7d7474, 0x3e09cf86, 0xbf7dabcc, 0x3e039502, 0xbf7de0b1,
+  0x3dfab273, 0xbf7e1324, 0x3dee3876, 0xbf7e4323, 0x3de1bc2e, 0xbf7e70b0, 0x3dd53db9, 0xbf7e9bc9,
+  0x3dc8bd36, 0xbf7ec46d, 0x3dbc3ac3, 0xbf7eea9d, 0x3dafb680, 0xbf7f0e58, 0x3da3308c, 0xbf7f2f9d,
+  0x3d96a905, 0xbf7f4e6d, 0x3d8a200a, 0xbf7f6ac7, 0x3d7b2b74, 0xbf7f84ab, 0x3d621469, 0xbf7f9c18,
+  0x3d48fb30, 0xbf7fb10f, 0x3d2fe007, 0xbf7fc38f, 0x3d16c32c, 0xbf7fd397, 0x3cfb49ba, 0xbf7fe129,
+  0x3cc90ab0, 0xbf7fec43, 0x3c96c9b6, 0xbf7ff4e6, 0x3c490e90, 0xbf7ffb11, 0x3bc90f88, 0xbf7ffec4,
+};
+
+const uint16_t rtaBitRevIndexTable256[440] PROGMEM = {
+  0x0008, 0x0200, 0x0010, 0x0400, 0x0018, 0x0600, 0x0020, 0x0040, 0x0028, 0x0240, 0x0030, 0x0440, 0x0038, 0x0640, 0x0040, 0x0080,
+  0x0048, 0x0280, 0x0050, 0x0480, 0x0058, 0x0680, 0x0060, 0x00c0, 0x0068, 0x02c0, 0x0070, 0x04c0, 0x0078, 0x06c0, 0x0080, 0x0100,
+  0x0088, 0x0300, 0x0090, 0x0500, 0x0098, 0x0700, 0x00a0, 0x0140, 0x00a8, 0x0340, 0x00b0, 0x0540, 0x00b8, 0x0740, 0x00c0, 0x0180,
+  0x00c8, 0x0380, 0x00d0, 0x0580, 0x00d8, 0x0780, 0x00e0, 0x01c0, 0x00e8, 0x03c0, 0x00f0, 0x05c0, 0x00f8, 0x07c0, 0x0100, 0x0200,
+  0x0108, 0x0208, 0x0110, 0x0408, 0x0118, 0x0608, 0x0120, 0x0280, 0x0128, 0x0248, 0x0130, 0x0448, 0x0138, 0x0648, 0x0140, 0x0300,
+  0x0148, 0x0288, 0x0150, 0x0488, 0x0158, 0x0688, 0x0160, 0x0380, 0x0168, 0x02c8, 0x0170, 0x04c8, 0x0178, 0x06c8, 0x0180, 0x0208,
+  0x0188, 0x0308, 0x0190, 0x0508, 0x0198, 0x0708, 0x01a0, 0x0288, 0x01a8, 0x0348, 0x01b0, 0x0548, 0x01b8, 0x0748, 0x01c0, 0x0308,
+  0x01c8, 0x0388, 0x01d0, 0x0588, 0x01d8, 0x0788, 0x01e0, 0x0388, 0x01e8, 0x03c8, 0x01f0, 0x05c8, 0x01f8, 0x07c8, 0x0200, 0x0400,
+  0x0208, 0x0210, 0x0210, 0x0410, 0x0218, 0x0610, 0x0220, 0x0480, 0x0228, 0x0250, 0x0230, 0x0450, 0x0238, 0x0650, 0x0240, 0x0500,
+  0x0248, 0x0290, 0x0250, 0x0490, 0x0258, 0x0690, 0x0260, 0x0580, 0x0268, 0x02d0, 0x0270, 0x04d0, 0x0278, 0x06d0, 0x0280, 0x0408,
+  0x0288, 0x0310, 0x0290, 0x0510, 0x0298, 0x0710, 0x02a0, 0x0488, 0x02a8, 0x0350, 0x02b0, 0x0550, 0x02b8, 0x0750, 0x02c0, 0x0508,
+  0x02c8, 0x0390, 0x02d0, 0x0590, 0x02d8, 0x0790, 0x02e0, 0x0588, 0x02e8, 0x03d0, 0x02f0, 0x05d0, 0x02f8, 0x07d0, 0x0300, 0x0600,
+  0x0308, 0x0610, 0x0310, 0x0418, 0x0318, 0x0618, 0x0320, 0x0680, 0x0328, 0x0690, 0x0330, 0x0458, 0x0338, 0x0658, 0x0340, 0x0700,
+  0x0348, 0x0710, 0x0350, 0x0498, 0x0358, 0x0698, 0x0360, 0x0780, 0x0368, 0x0790, 0x0370, 0x04d8, 0x0378, 0x06d8, 0x0380, 0x0608,
+  0x0388, 0x0618, 0x0390, 0x0518, 0x0398, 0x0718, 0x03a0, 0x0688, 0x03a8, 0x0698, 0x03b0, 0x0558, 0x03b8, 0x0758, 0x03c0, 0x0708,
+  0x03c8, 0x0718, 0x03d0, 0x0598, 0x03d8, 0x0798, 0x03e0, 0x0788, 0x03e8, 0x0798, 0x03f0, 0x05d8, 0x03f8, 0x07d8, 0x0408, 0x0480,
+  0x0410, 0x0420, 0x0418, 0x0620, 0x0428, 0x0580, 0x0430, 0x0460, 0x0438, 0x0660, 0x0440, 0x0600, 0x0448, 0x0488, 0x0450, 0x04a0,
+  0x0458, 0x06a0, 0x0460, 0x0610, 0x0468, 0x0588, 0x0470, 0x04e0, 0x0478, 0x06e0, 0x0488, 0x0680, 0x0490, 0x0520, 0x0498, 0x0720,
+  0x04a0, 0x0608, 0x04a8, 0x0780, 0x04b0, 0x0560, 0x04b8, 0x0760, 0x04c0, 0x0620, 0x04c8, 0x0688, 0x04d0, 0x05a0, 0x04d8, 0x07a0,
+  0x04e0, 0x0618, 0x04e8, 0x0788, 0x04f0, 0x05e0, 0x04f8, 0x07e0, 0x0508, 0x0520, 0x0510, 0x0580, 0x0518, 0x0628, 0x0528, 0x0590,
+  0x0530, 0x0588, 0x0538, 0x0668, 0x0540, 0x0700, 0x0548, 0x0720, 0x0550, 0x0780, 0x0558, 0x06a8, 0x0560, 0x0708, 0x0568, 0x0598,
+  0x0570, 0x0788, 0x0578, 0x06e8, 0x0588, 0x0690, 0x0598, 0x0728, 0x05a0, 0x0628, 0x05a8, 0x0790, 0x05b0, 0x0728, 0x05b8, 0x0768,
+  0x05c0, 0x0710, 0x05c8, 0x0698, 0x05d0, 0x0790, 0x05d8, 0x07a8, 0x05e0, 0x0718, 0x05e8, 0x0798, 0x05f0, 0x0798, 0x05f8, 0x07e8,
+  0x0618, 0x0630, 0x0638, 0x0670, 0x0640, 0x0700, 0x0648, 0x0780, 0x0650, 0x0708, 0x0658, 0x06b0, 0x0660, 0x0710, 0x0668, 0x0790,
+  0x0670, 0x0718, 0x0678, 0x06f0, 0x0688, 0x06a0, 0x0698, 0x0730, 0x06a8, 0x07a0, 0x06b0, 0x0788, 0x06b8, 0x0770, 0x06c0, 0x0720,
+  0x06c8, 0x07a0, 0x06d0, 0x0728, 0x06d8, 0x07b0, 0x06e0, 0x0730, 0x06e8, 0x07a8, 0x06f0, 0x0798, 0x06f8, 0x07f0, 0x0738, 0x0798,
+  0x0748, 0x0750, 0x0750, 0x0760, 0x0758, 0x0770, 0x0760, 0x07c0, 0x0768, 0x07d0, 0x0770, 0x07e0, 0x0778, 0x07f0, 0x07a8, 0x07b0,
+  0x07b8, 0x07f0, 0x07c8, 0x07e0, 0x07d8, 0x07f0, 0x07e8, 0x07f0,
+};
+
+const uint32_t rtaTwiddleCoef256Bits[512] PROGMEM = {
+  0x3f800000, 0x00000000, 0x3f7fec43, 0x3cc90ab0, 0x3f7fb10f, 0x3d48fb30, 0x3f7f4e6d, 0x3d96a905,
+  0x3f7ec46d, 0x3dc8bd36, 0x3f7e1324, 0x3dfab273, 0x3f7d3aac, 0x3e164083, 0x3f7c3b28, 0x3e2f10a2,
+  0x3f7b14be, 0x3e47c5c2, 0x3f79c79d, 0x3e605c13, 0x3f7853f8, 0x3e78cfcc, 0x3f76ba07, 0x3e888e93,
+  0x3f74fa0b, 0x3e94a031, 0x3f731447, 0x3ea09ae5, 0x3f710908, 0x3eac7cd4, 0x3f6ed89e, 0x3eb8442a,
+  0x3f6c835e, 0x3ec3ef15, 0x3f6a09a7, 0x3ecf7bca, 0x3f676bd8, 0x3edae880, 0x3f64aa59, 0x3ee63375,
+  0x3f61c598, 0x3ef15aea, 0x3f5ebe05, 0x3efc5d27, 0x3f5b941a, 0x3f039c3d, 0x3f584853, 0x3f08f59b,
+  0x3f54db31, 0x3f0e39da, 0x3f514d3d, 0x3f13682a, 0x3f4d9f02, 0x3f187fc0, 0x3f49d112, 0x3f1d7fd1,
+  0x3f45e403, 0x3f226799, 0x3f41d870, 0x3f273656, 0x3f3daef9, 0x3f2beb4a, 0x3f396842, 0x3f3085bb,
+  0x3f3504f3, 0x3f3504f3, 0x3f3085bb, 0x3f396842, 0x3f2beb4a, 0x3f3daef9, 0x3f273656, 0x3f41d870,
+  0x3f226799, 0x3f45e403, 0x3f1d7fd1, 0x3f49d112, 0x3f187fc0, 0x3f4d9f02, 0x3f13682a, 0x3f514d3d,
+  0x3f0e39da, 0x3f54db31, 0x3f08f59b, 0x3f584853, 0x3f039c3d, 0x3f5b941a, 0x3efc5d27, 0x3f5ebe05,
+  0x3ef15aea, 0x3f61c598, 0x3ee63375, 0x3f64aa59, 0x3edae880, 0x3f676bd8, 0x3ecf7bca, 0x3f6a09a7,
+  0x3ec3ef15, 0x3f6c835e, 0x3eb8442a, 0x3f6ed89e, 0x3eac7cd4, 0x3f710908, 0x3ea09ae5, 0x3f731447,
+  0x3e94a031, 0x3f74fa0b, 0x3e888e93, 0x3f76ba07, 0x3e78cfcc, 0x3f7853f8, 0x3e605c13, 0x3f79c79d,
+  0x3e47c5c2, 0x3f7b14be, 0x3e2f10a2, 0x3f7c3b28, 0x3e164083, 0x3f7d3aac, 0x3dfab273, 0x3f7e1324,
+  0x3dc8bd36, 0x3f7ec46d, 0x3d96a905, 0x3f7f4e6d, 0x3d48fb30, 0x3f7fb10f, 0x3cc90ab0, 0x3f7fec43,
+  0x248d3132, 0x3f800000, 0xbcc90ab0, 0x3f7fec43, 0xbd48fb30, 0x3f7fb10f, 0xbd96a905, 0x3f7f4e6d,
+  0xbdc8bd36, 0x3f7ec46d, 0xbdfab273, 0x3f7e1324, 0xbe164083, 0x3f7d3aac, 0xbe2f10a2, 0x3f7c3b28,
+  0xbe47c5c2, 0x3f7b14be, 0xbe605c13, 0x3f79c79d, 0xbe78cfcc, 0x3f7853f8, 0xbe888e93, 0x3f76ba07,
+  0xbe94a031, 0x3f74fa0b, 0xbea09ae5, 0x3f731447, 0xbeac7cd4, 0x3f710908, 0xbeb8442a, 0x3f6ed89e,
+  0xbec3ef15, 0x3f6c835e, 0xbecf7bca, 0x3f6a09a7, 0xbedae880, 0x3f676bd8, 0xbee63375, 0x3f64aa59,
+  0xbef15aea, 0x3f61c598, 0xbefc5d27, 0x3f5ebe05, 0xbf039c3d, 0x3f5b941a, 0xbf08f59b, 0x3f584853,
+  0xbf0e39da, 0x3f54db31, 0xbf13682a, 0x3f514d3d, 0xbf187fc0, 0x3f4d9f02, 0xbf1d7fd1, 0x3f49d112,
+  0xbf226799, 0x3f45e403, 0xbf273656, 0x3f41d870, 0xbf2beb4a, 0x3f3daef9, 0xbf3085bb, 0x3f396842,
+  0xbf3504f3, 0x3f3504f3, 0xbf396842, 0x3f3085bb, 0xbf3daef9, 0x3f2beb4a, 0xbf41d870, 0x3f273656,
+  0xbf45e403, 0x3f226799, 0xbf49d112, 0x3f1d7fd1, 0xbf4d9f02, 0x3f187fc0, 0xbf514d3d, 0x3f13682a,
+  0xbf54db31, 0x3f0e39da, 0xbf584853, 0x3f08f59b, 0xbf5b941a, 0x3f039c3d, 0xbf5ebe05, 0x3efc5d27,
+  0xbf61c598, 0x3ef15aea, 0xbf64aa59, 0x3ee63375, 0xbf676bd8, 0x3edae880, 0xbf6a09a7, 0x3ecf7bca,
+  0xbf6c835e, 0x3ec3ef15, 0xbf6ed89e, 0x3eb8442a, 0xbf710908, 0x3eac7cd4, 0xbf731447, 0x3ea09ae5,
+  0xbf74fa0b, 0x3e94a031, 0xbf76ba07, 0x3e888e93, 0xbf7853f8, 0x3e78cfcc, 0xbf79c79d, 0x3e605c13,
+  0xbf7b14be, 0x3e47c5c2, 0xbf7c3b28, 0x3e2f10a2, 0xbf7d3aac, 0x3e164083, 0xbf7e1324, 0x3dfab273,
+  0xbf7ec46d, 0x3dc8bd36, 0xbf7f4e6d, 0x3d96a905, 0xbf7fb10f, 0x3d48fb30, 0xbf7fec43, 0x3cc90ab0,
+  0xbf800000, 0x250d3132, 0xbf7fec43, 0xbcc90ab0, 0xbf7fb10f, 0xbd48fb30, 0xbf7f4e6d, 0xbd96a905,
+  0xbf7ec46d, 0xbdc8bd36, 0xbf7e1324, 0xbdfab273, 0xbf7d3aac, 0xbe164083, 0xbf7c3b28, 0xbe2f10a2,
+  0xbf7b14be, 0xbe47c5c2, 0xbf79c79d, 0xbe605c13, 0xbf7853f8, 0xbe78cfcc, 0xbf76ba07, 0xbe888e93,
+  0xbf74fa0b, 0xbe94a031, 0xbf731447, 0xbea09ae5, 0xbf710908, 0xbeac7cd4, 0xbf6ed89e, 0xbeb8442a,
+  0xbf6c835e, 0xbec3ef15, 0xbf6a09a7, 0xbecf7bca, 0xbf676bd8, 0xbedae880, 0xbf64aa59, 0xbee63375,
+  0xbf61c598, 0xbef15aea, 0xbf5ebe05, 0xbefc5d27, 0xbf5b941a, 0xbf039c3d, 0xbf584853, 0xbf08f59b,
+  0xbf54db31, 0xbf0e39da, 0xbf514d3d, 0xbf13682a, 0xbf4d9f02, 0xbf187fc0, 0xbf49d112, 0xbf1d7fd1,
+  0xbf45e403, 0xbf226799, 0xbf41d870, 0xbf273656, 0xbf3daef9, 0xbf2beb4a, 0xbf396842, 0xbf3085bb,
+  0xbf3504f3, 0xbf3504f3, 0xbf3085bb, 0xbf396842, 0xbf2beb4a, 0xbf3daef9, 0xbf273656, 0xbf41d870,
+  0xbf226799, 0xbf45e403, 0xbf1d7fd1, 0xbf49d112, 0xbf187fc0, 0xbf4d9f02, 0xbf13682a, 0xbf514d3d,
+  0xbf0e39da, 0xbf54db31, 0xbf08f59b, 0xbf584853, 0xbf039c3d, 0xbf5b941a, 0xbefc5d27, 0xbf5ebe05,
+  0xbef15aea, 0xbf61c598, 0xbee63375, 0xbf64aa59, 0xbedae880, 0xbf676bd8, 0xbecf7bca, 0xbf6a09a7,
+  0xbec3ef15, 0xbf6c835e, 0xbeb8442a, 0xbf6ed89e, 0xbeac7cd4, 0xbf710908, 0xbea09ae5, 0xbf731447,
+  0xbe94a031, 0xbf74fa0b, 0xbe888e93, 0xbf76ba07, 0xbe78cfcc, 0xbf7853f8, 0xbe605c13, 0xbf79c79d,
+  0xbe47c5c2, 0xbf7b14be, 0xbe2f10a2, 0xbf7c3b28, 0xbe164083, 0xbf7d3aac, 0xbdfab273, 0xbf7e1324,
+  0xbdc8bd36, 0xbf7ec46d, 0xbd96a905, 0xbf7f4e6d, 0xbd48fb30, 0xbf7fb10f, 0xbcc90ab0, 0xbf7fec43,
+  0xa553c9ca, 0xbf800000, 0x3cc90ab0, 0xbf7fec43, 0x3d48fb30, 0xbf7fb10f, 0x3d96a905, 0xbf7f4e6d,
+  0x3dc8bd36, 0xbf7ec46d, 0x3dfab273, 0xbf7e1324, 0x3e164083, 0xbf7d3aac, 0x3e2f10a2, 0xbf7c3b28,
+  0x3e47c5c2, 0xbf7b14be, 0x3e605c13, 0xbf79c79d, 0x3e78cfcc, 0xbf7853f8, 0x3e888e93, 0xbf76ba07,
+  0x3e94a031, 0xbf74fa0b, 0x3ea09ae5, 0xbf731447, 0x3eac7cd4, 0xbf710908, 0x3eb8442a, 0xbf6ed89e,
+  0x3ec3ef15, 0xbf6c835e, 0x3ecf7bca, 0xbf6a09a7, 0x3edae880, 0xbf676bd8, 0x3ee63375, 0xbf64aa59,
+  0x3ef15aea, 0xbf61c598, 0x3efc5d27, 0xbf5ebe05, 0x3f039c3d, 0xbf5b941a, 0x3f08f59b, 0xbf584853,
+  0x3f0e39da, 0xbf54db31, 0x3f13682a, 0xbf514d3d, 0x3f187fc0, 0xbf4d9f02, 0x3f1d7fd1, 0xbf49d112,
+  0x3f226799, 0xbf45e403, 0x3f273656, 0xbf41d870, 0x3f2beb4a, 0xbf3daef9, 0x3f3085bb, 0xbf396842,
+  0x3f3504f3, 0xbf3504f3, 0x3f396842, 0xbf3085bb, 0x3f3daef9, 0xbf2beb4a, 0x3f41d870, 0xbf273656,
+  0x3f45e403, 0xbf226799, 0x3f49d112, 0xbf1d7fd1, 0x3f4d9f02, 0xbf187fc0, 0x3f514d3d, 0xbf13682a,
+  0x3f54db31, 0xbf0e39da, 0x3f584853, 0xbf08f59b, 0x3f5b941a, 0xbf039c3d, 0x3f5ebe05, 0xbefc5d27,
+  0x3f61c598, 0xbef15aea, 0x3f64aa59, 0xbee63375, 0x3f676bd8, 0xbedae880, 0x3f6a09a7, 0xbecf7bca,
+  0x3f6c835e, 0xbec3ef15, 0x3f6ed89e, 0xbeb8442a, 0x3f710908, 0xbeac7cd4, 0x3f731447, 0xbea09ae5,
+  0x3f74fa0b, 0xbe94a031, 0x3f76ba07, 0xbe888e93, 0x3f7853f8, 0xbe78cfcc, 0x3f79c79d, 0xbe605c13,
+  0x3f7b14be, 0xbe47c5c2, 0x3f7c3b28, 0xbe2f10a2, 0x3f7d3aac, 0xbe164083, 0x3f7e1324, 0xbdfab273,
+  0x3f7ec46d, 0xbdc8bd36, 0x3f7f4e6d, 0xbd96a905, 0x3f7fb10f, 0xbd48fb30, 0x3f7fec43, 0xbcc90ab0,
+};
+
+const uint32_t rtaTwiddleCoefRfft512Bits[512] PROGMEM = {
+  0x00000000, 0x3f800000, 0x3c490e90, 0x3f7ffb11, 0x3cc90ab0, 0x3f7fec43, 0x3d16c32c, 0x3f7fd397,
+  0x3d48fb30, 0x3f7fb10f, 0x3d7b2b74, 0x3f7f84ab, 0x3d96a905, 0x3f7f4e6d, 0x3dafb680, 0x3f7f0e58,
+  0x3dc8bd36, 0x3f7ec46d, 0x3de1bc2e, 0x3f7e70b0, 0x3dfab273, 0x3f7e1324, 0x3e09cf86, 0x3f7dabcc,
+  0x3e164083, 0x3f7d3aac, 0x3e22abb6, 0x3f7cbfc9, 0x3e2f10a2, 0x3f7c3b28, 0x3e3b6ecf, 0x3f7baccd,
+  0x3e47c5c2, 0x3f7b14be, 0x3e541501, 0x3f7a7302, 0x3e605c13, 0x3f79c79d, 0x3e6c9a7f, 0x3f791298,
+  0x3e78cfcc, 0x3f7853f8, 0x3e827dc0, 0x3f778bc5, 0x3e888e93, 0x3f76ba07, 0x3e8e9a22, 0x3f75dec6,
+  0x3e94a031, 0x3f74fa0b, 0x3e9aa086, 0x3f740bdd, 0x3ea09ae5, 0x3f731447, 0x3ea68f12, 0x3f721352,
+  0x3eac7cd4, 0x3f710908, 0x3eb263ef, 0x3f6ff573, 0x3eb8442a, 0x3f6ed89e, 0x3ebe1d4a, 0x3f6db293,
+  0x3ec3ef15, 0x3f6c835e, 0x3ec9b953, 0x3f6b4b0c, 0x3ecf7bca, 0x3f6a09a7, 0x3ed53641, 0x3f68bf3c,
+  0x3edae880, 0x3f676bd8, 0x3ee0924f, 0x3f660f88, 0x3ee63375, 0x3f64aa59, 0x3eebcbbb, 0x3f633c5a,
+  0x3ef15aea, 0x3f61c598, 0x3ef6e0cb, 0x3f604621, 0x3efc5d27, 0x3f5ebe05, 0x3f00e7e4, 0x3f5d2d53,
+  0x3f039c3d, 0x3f5b941a, 0x3f064b82, 0x3f59f26a, 0x3f08f59b, 0x3f584853, 0x3f0b9a6b, 0x3f5695e5,
+  0x3f0e39da, 0x3f54db31, 0x3f10d3cd, 0x3f531849, 0x3f13682a, 0x3f514d3d, 0x3f15f6d9, 0x3f4f7a1f,
+  0x3f187fc0, 0x3f4d9f02, 0x3f1b02c6, 0x3f4bbbf8, 0x3f1d7fd1, 0x3f49d112, 0x3f1ff6cb, 0x3f47de65,
+  0x3f226799, 0x3f45e403, 0x3f24d225, 0x3f43e200, 0x3f273656, 0x3f41d870, 0x3f299415, 0x3f3fc767,
+  0x3f2beb4a, 0x3f3daef9, 0x3f2e3bde, 0x3f3b8f3b, 0x3f3085bb, 0x3f396842, 0x3f32c8c9, 0x3f373a23,
+  0x3f3504f3, 0x3f3504f3, 0x3f373a23, 0x3f32c8c9, 0x3f396842, 0x3f3085bb, 0x3f3b8f3b, 0x3f2e3bde,
+  0x3f3daef9, 0x3f2beb4a, 0x3f3fc767, 0x3f299415, 0x3f41d870, 0x3f273656, 0x3f43e200, 0x3f24d225,
+  0x3f45e403, 0x3f226799, 0x3f47de65, 0x3f1ff6cb, 0x3f49d112, 0x3f1d7fd1, 0x3f4bbbf8, 0x3f1b02c6,
+  0x3f4d9f02, 0x3f187fc0, 0x3f4f7a1f, 0x3f15f6d9, 0x3f514d3d, 0x3f13682a, 0x3f531849, 0x3f10d3cd,
+  0x3f54db31, 0x3f0e39da, 0x3f5695e5, 0x3f0b9a6b, 0x3f584853, 0x3f08f59b, 0x3f59f26a, 0x3f064b82,
+  0x3f5b941a, 0x3f039c3d, 0x3f5d2d53, 0x3f00e7e4, 0x3f5ebe05, 0x3efc5d27, 0x3f604621, 0x3ef6e0cb,
+  0x3f61c598, 0x3ef15aea, 0x3f633c5a, 0x3eebcbbb, 0x3f64aa59, 0x3ee63375, 0x3f660f88, 0x3ee0924f,
+  0x3f676bd8, 0x3edae880, 0x3f68bf3c, 0x3ed53641, 0x3f6a09a7, 0x3ecf7bca, 0x3f6b4b0c, 0x3ec9b953,
+  0x3f6c835e, 0x3ec3ef15, 0x3f6db293, 0x3ebe1d4a, 0x3f6ed89e, 0x3eb8442a, 0x3f6ff573, 0x3eb263ef,
+  0x3f710908, 0x3eac7cd4, 0x3f721352, 0x3ea68f12, 0x3f731447, 0x3ea09ae5, 0x3f740bdd, 0x3e9aa086,
+  0x3f74fa0b, 0x3e94a031, 0x3f75dec6, 0x3e8e9a22, 0x3f76ba07, 0x3e888e93, 0x3f778bc5, 0x3e827dc0,
+  0x3f7853f8, 0x3e78cfcc, 0x3f791298, 0x3e6c9a7f, 0x3f79c79d, 0x3e605c13, 0x3f7a7302, 0x3e541501,
+  0x3f7b14be, 0x3e47c5c2, 0x3f7baccd, 0x3e3b6ecf, 0x3f7c3b28, 0x3e2f10a2, 0x3f7cbfc9, 0x3e22abb6,
+  0x3f7d3aac, 0x3e164083, 0x3f7dabcc, 0x3e09cf86, 0x3f7e1324, 0x3dfab273, 0x3f7e70b0, 0x3de1bc2e,
+  0x3f7ec46d, 0x3dc8bd36, 0x3f7f0e58, 0x3dafb680, 0x3f7f4e6d, 0x3d96a905, 0x3f7f84ab, 0x3d7b2b74,
+  0x3f7fb10f, 0x3d48fb30, 0x3f7fd397, 0x3d16c32c, 0x3f7fec43, 0x3cc90ab0, 0x3f7ffb11, 0x3c490e90,
+  0x3f800000, 0x248d3132, 0x3f7ffb11, 0xbc490e90, 0x3f7fec43, 0xbcc90ab0, 0x3f7fd397, 0xbd16c32c,
+  0x3f7fb10f, 0xbd48fb30, 0x3f7f84ab, 0xbd7b2b74, 0x3f7f4e6d, 0xbd96a905, 0x3f7f0e58, 0xbdafb680,
+  0x3f7ec46d, 0xbdc8bd36, 0x3f7e70b0, 0xbde1bc2e, 0x3f7e1324, 0xbdfab273, 0x3f7dabcc, 0xbe09cf86,
+  0x3f7d3aac, 0xbe164083, 0x3f7cbfc9, 0xbe22abb6, 0x3f7c3b28, 0xbe2f10a2, 0x3f7baccd, 0xbe3b6ecf,
+  0x3f7b14be, 0xbe47c5c2, 0x3f7a7302, 0xbe541501, 0x3f79c79d, 0xbe605c13, 0x3f791298, 0xbe6c9a7f,
+  0x3f7853f8, 0xbe78cfcc, 0x3f778bc5, 0xbe827dc0, 0x3f76ba07, 0xbe888e93, 0x3f75dec6, 0xbe8e9a22,
+  0x3f74fa0b, 0xbe94a031, 0x3f740bdd, 0xbe9aa086, 0x3f731447, 0xbea09ae5, 0x3f721352, 0xbea68f12,
+  0x3f710908, 0xbeac7cd4, 0x3f6ff573, 0xbeb263ef, 0x3f6ed89e, 0xbeb8442a, 0x3f6db293, 0xbebe1d4a,
+  0x3f6c835e, 0xbec3ef15, 0x3f6b4b0c, 0xbec9b953, 0x3f6a09a7, 0xbecf7bca, 0x3f68bf3c, 0xbed53641,
+  0x3f676bd8, 0xbedae880, 0x3f660f88, 0xbee0924f, 0x3f64aa59, 0xbee63375, 0x3f633c5a, 0xbeebcbbb,
+  0x3f61c598, 0xbef15aea, 0x3f604621, 0xbef6e0cb, 0x3f5ebe05, 0xbefc5d27, 0x3f5d2d53, 0xbf00e7e4,
+  0x3f5b941a, 0xbf039c3d, 0x3f59f26a, 0xbf064b82, 0x3f584853, 0xbf08f59b, 0x3f5695e5, 0xbf0b9a6b,
+  0x3f54db31, 0xbf0e39da, 0x3f531849, 0xbf10d3cd, 0x3f514d3d, 0xbf13682a, 0x3f4f7a1f, 0xbf15f6d9,
+  0x3f4d9f02, 0xbf187fc0, 0x3f4bbbf8, 0xbf1b02c6, 0x3f49d112, 0xbf1d7fd1, 0x3f47de65, 0xbf1ff6cb,
+  0x3f45e403, 0xbf226799, 0x3f43e200, 0xbf24d225, 0x3f41d870, 0xbf273656, 0x3f3fc767, 0xbf299415,
+  0x3f3daef9, 0xbf2beb4a, 0x3f3b8f3b, 0xbf2e3bde, 0x3f396842, 0xbf3085bb, 0x3f373a23, 0xbf32c8c9,
+  0x3f3504f3, 0xbf3504f3, 0x3f32c8c9, 0xbf373a23, 0x3f3085bb, 0xbf396842, 0x3f2e3bde, 0xbf3b8f3b,
+  0x3f2beb4a, 0xbf3daef9, 0x3f299415, 0xbf3fc767, 0x3f273656, 0xbf41d870, 0x3f24d225, 0xbf43e200,
+  0x3f226799, 0xbf45e403, 0x3f1ff6cb, 0xbf47de65, 0x3f1d7fd1, 0xbf49d112, 0x3f1b02c6, 0xbf4bbbf8,
+  0x3f187fc0, 0xbf4d9f02, 0x3f15f6d9, 0xbf4f7a1f, 0x3f13682a, 0xbf514d3d, 0x3f10d3cd, 0xbf531849,
+  0x3f0e39da, 0xbf54db31, 0x3f0b9a6b, 0xbf5695e5, 0x3f08f59b, 0xbf584853, 0x3f064b82, 0xbf59f26a,
+  0x3f039c3d, 0xbf5b941a, 0x3f00e7e4, 0xbf5d2d53, 0x3efc5d27, 0xbf5ebe05, 0x3ef6e0cb, 0xbf604621,
+  0x3ef15aea, 0xbf61c598, 0x3eebcbbb, 0xbf633c5a, 0x3ee63375, 0xbf64aa59, 0x3ee0924f, 0xbf660f88,
+  0x3edae880, 0xbf676bd8, 0x3ed53641, 0xbf68bf3c, 0x3ecf7bca, 0xbf6a09a7, 0x3ec9b953, 0xbf6b4b0c,
+  0x3ec3ef15, 0xbf6c835e, 0x3ebe1d4a, 0xbf6db293, 0x3eb8442a, 0xbf6ed89e, 0x3eb263ef, 0xbf6ff573,
+  0x3eac7cd4, 0xbf710908, 0x3ea68f12, 0xbf721352, 0x3ea09ae5, 0xbf731447, 0x3e9aa086, 0xbf740bdd,
+  0x3e94a031, 0xbf74fa0b, 0x3e8e9a22, 0xbf75dec6, 0x3e888e93, 0xbf76ba07, 0x3e827dc0, 0xbf778bc5,
+  0x3e78cfcc, 0xbf7853f8, 0x3e6c9a7f, 0xbf791298, 0x3e605c13, 0xbf79c79d, 0x3e541501, 0xbf7a7302,
+  0x3e47c5c2, 0xbf7b14be, 0x3e3b6ecf, 0xbf7baccd, 0x3e2f10a2, 0xbf7c3b28, 0x3e22abb6, 0xbf7cbfc9,
+  0x3e164083, 0xbf7d3aac, 0x3e09cf86, 0xbf7dabcc, 0x3dfab273, 0xbf7e1324, 0x3de1bc2e, 0xbf7e70b0,
+  0x3dc8bd36, 0xbf7ec46d, 0x3dafb680, 0xbf7f0e58, 0x3d96a905, 0xbf7f4e6d, 0x3d7b2b74, 0xbf7f84ab,
+  0x3d48fb30, 0xbf7fb10f, 0x3d16c32c, 0xbf7fd397, 0x3cc90ab0, 0xbf7fec43, 0x3c490e90, 0xbf7ffb11,
 };
@@ -0,0 +1,245 @@
+#include "RtaMultiRes.h"
+#include "RtaFftTables.h"
+
+#include <math.h>
+#include <string.h>
+
+// Odd-offset taps (+/-1, +/-3, ... +/-15) of the half-band lowpass; the
+// even offsets are zero and the center tap is 0.5.
+static const float HALF_BAND_COEFS[8] = {
+  3.130559118e-01f, -9.122783426e-02f, 4.153808252e-02f, -1.922827575e-02f,
+  8.020590062e-03f, -2.734532125e-03f, 6.422753305e-04f, -4.963152495e-05f,
+};
+
+void RtaHalfBand::reset() {
+  memset(hist, 0, sizeof(hist));
+}
+
+void RtaHalfBand::process(const float* in, int n, float* out) {
+  const int center = (TAPS - 1) / 2;
+  float line[TAPS - 1 + MAX_BLOCK];
+  memcpy(line, hist, sizeof(hist));
+  memcpy(line + TAPS - 1, in, n * sizeof(float));
+  for (int i = 0; i < n / 2; i++) {
+    const float* x = line + 2 * i + center;
+    float acc = 0.5f * x[0];
+    for (int k = 0; k < 8; k++) {
+      acc += HALF_BAND_COEFS[k] * (x[-(2 * k + 1)] + x[2 * k + 1]);
+    }
+    out[i] = acc;
+  }
+  memcpy(hist, line + n, sizeof(hist));
+}
+
+int rtaStageFor(float fs, int fftSize, float lo, float hi) {
+  for (int s = 0; s < RTA_STAGES - 1; s++) {
+    const float rate = fs / (float)(1 << (2 * s));
+    // Past stage 0 only the decimators' alias-free 0.3 fs is usable
+    const bool inRange = (s == 0) || hi <= 0.3f * rate;
+    if (inRange && rate / (float)fftSize * RTA_MIN_BINS_PER_BAND <= hi - lo) return s;
+  }
+  return RTA_STAGES - 1;
+}
+
+// Edge bins contribute proportionally to their overlap with the band, so
+// bands narrower than one bin (the lowest few, even on the /16 stage) still
+// get a sensible share instead of double-counting or reading zero.
+bool rtaBuildBandTable(float fs, int fftSize, const float* lo, const float* hi, int count,
+                       RtaBandSpan* spans, int maxBands, float* weights, int maxWeights,
+                       int& numBands, int& numWeights) {
+  const int numBins = fftSize / 2;
+  numBands = 0;
+  numWeights = 0;
+  if (count > maxBands) count = maxBands;
+  for (int b = 0; b < count; b++) {
+    const int s = rtaStageFor(fs, fftSize, lo[b], hi[b]);
+    const float binWidth = fs / (float)(1 << (2 * s)) / (float)fftSize;
+    int first = (int)roundf(lo[b] / binWidth);
+    int last = (int)roundf(hi[b] / binWidth);
+    if (first < 1) first = 1; // skip the DC bin
+    if (last > numBins - 1) last = numBins - 1;
+    RtaBandSpan& span = spans[b];
+    span.stage = (uint8_t)s;
+    span.firstBin = 0;
+    span.bins = 0;
+    span.offset = (uint16_t)numWeights;
+    for (int i = first; i <= last; i++) {
+      float overlap = fminf(hi[b], (i + 0.5f) * binWidth) - fmaxf(lo[b], (i - 0.5f) * binWidth);
+      if (overlap <= 0.0f) {
+        if (span.bins == 0) continue; // leading edge bin outside the band
+        break;
+      }
+      if (numWeights >= maxWeights) return false;
+      if (span.bins == 0) span.firstBin = (uint16_t)i;
+      weights[numWeights++] = overlap / binWidth;
+      span.bins++;
+    }
+    numBands = b + 1;
+  }
+  return numBands == count;
+}
+
+RtaMultiRes::RtaMultiRes(float sampleRate, float* arena) : fs(sampleRate) {
+  float* p = arena;
+  for (int s = 0; s < RTA_STAGES; s++) { ring[s] = p; p += FFT_SIZE; }
+  window = p;   p += FFT_SIZE;
+  work = p;     p += FFT_SIZE;
+  spectrum = p; p += FFT_SIZE;
+  for (int s = 0; s < RTA_STAGES; s++) { accum[s] = p; p += NUM_BINS; }
+  weights = p;  p += RTA_MAX_BAND_WEIGHTS;
+  levels = p;
+
+  // Hanning window with the FFT normalization folded in (the int16 -> float
+  // conversion happens in push, ahead of the decimators). |X| of an
+  // amplitude-A sine after a Hanning window is A * N/4 (coherent gain 0.5),
+  // so 4/N normalizes a full-scale sine to power 1.0 in its bin.
+  const float scale = 4.0f / (float)FFT_SIZE;
+  for (int i = 0; i < FFT_SIZE; i++) {
+    window[i] = (0.5f - 0.5f * cosf(2.0f * (float)M_PI * i / (FFT_SIZE - 1))) * scale;
+  }
+
+  // Build the FFT instance by hand instead of calling arm_rfft_fast_init_f32:
+  // its size switch links the twiddle tables for every FFT length (see the
+  // same trick in FirEngine). The tables themselves are our own PROGMEM
+  // copies (RtaFftTables), kept out of RAM1.
+  rfft.Sint.fftLen = FFT_SIZE / 2;
+  rfft.Sint.pTwiddle = (const float32_t*)rtaTwiddleCoef512Bits;
+  rfft.Sint.pBitRevTable = rtaBitRevIndexTable512;
+  rfft.Sint.bitRevLength = 448; // ARMBITREVINDEXTABLE_512_TABLE_LENGTH
+  rfft.fftLenRFFT = FFT_SIZE;
+  rfft.pTwiddleRFFT = (float32_t*)rtaTwiddleCoefRfft1024Bits;
+
+  reset();
+}
+
+void RtaMultiRes::reset() {
+  for (int s = 0; s < RTA_STAGES; s++) {
+    memset(ring[s], 0, FFT_SIZE * sizeof(float));
+    memset(accum[s], 0, NUM_BINS * sizeof(float));
+    head[s] = 0;
+    fill[s] = 0;
+    pending[s] = 0;
+    segments[s] = 0;
+    seen[s] = false;
+  }
+  memset(levels, 0, RTA_MAX_BANDS * sizeof(float));
+  for (RtaHalfBand& d : decim) d.reset();
+}
+
+void RtaMultiRes::write(int stage, const float* x, int n) {
+  float* r = ring[stage];
+  int h = head[stage];
+  for (int i = 0; i < n; i++) {
+    r[h] = x[i];
+    h = (h + 1) & (FFT_SIZE - 1);
+  }
+  head[stage] = h;
+  int f = fill[stage] + n;
+  fill[stage] = (f > FFT_SIZE) ? FFT_SIZE : f;
+  // Past a full window the oldest unseen samples are already overwritten;
+  // the next segment just takes the latest window
+  int q = pending[stage] + n;
+  pending[stage] = (q > FFT_SIZE) ? FFT_SIZE : q;
+}
+
+void RtaMultiRes::push(const int16_t* samples, int n) {
+  if (n > RtaHalfBand::MAX_BLOCK) n = RtaHalfBand::MAX_BLOCK;
+  n &= ~15;
+  float a[RtaHalfBand::MAX_BLOCK];
+  for (int i = 0; i < n; i++) a[i] = samples[i] * (1.0f / 32768.0f);
+  decimate(a, n);
+}
+
+void RtaMultiRes::push(const float* samples, int n) {
+  if (n > RtaHalfBand::MAX_BLOCK) n = RtaHalfBand::MAX_BLOCK;
+  n &= ~15;
+  float a[RtaHalfBand::MAX_BLOCK];
+  memcpy(a, samples, n * sizeof(float));
+  decimate(a, n);
+}
+
+void RtaMultiRes::decimate(float* a, int n) {
+  float b[RtaHalfBand::MAX_BLOCK / 2];
+  write(0, a, n);
+  // Each /4 step is two half-band passes, ping-ponging between a and b
+  for (int s = 1; s < RTA_STAGES; s++) {
+    decim[2 * s - 2].process(a, n, b);
+    decim[2 * s - 1].process(b, n / 2, a);
+    n /= 4;
+    write(s, a, n);
+  }
+}
+
+int RtaMultiRes::segmentDue() const {
+  for (int s = 0; s < RTA_STAGES; s++) {
+    if (fill[s] == FFT_SIZE && pending[s] >= HOP) return s;
+  }
+  return -1;
+}
+
+void RtaMultiRes::snapshot(int stage) {
+  const float* r = ring[stage];
+  const int h = head[stage]; // oldest sample
+  for (int i = 0; i < FFT_SIZE; i++) {
+    work[i] = r[(h + i) & (FFT_SIZE - 1)] * window[i];
+  }
+  pending[stage] = 0;
+}
+
+void RtaMultiRes::transform(int stage) {
+  // arm_rfft_fast_f32 clobbers its input; `work` is scratch
+  arm_rfft_fast_f32(&rfft, work, spectrum, 0);
+
+  // Packed layout: spectrum[0] = DC, spectrum[1] = Nyquist, then re/im pairs
+  float* acc = accum[stage];
+  acc[0] += spectrum[0] * spectrum[0];
+  for (int i = 1; i < NUM_BINS; i++) {
+    const float re = spectrum[2 * i];
+    const float im = spectrum[2 * i + 1];
+    acc[i] += re * re + im * im;
+  }
+  segments[stage]++;
+  seen[stage] = true;
+}
+
+bool RtaMultiRes::ready() const {
+  for (int s = 0; s < RTA_STAGES; s++) {
+    if (!seen[s]) return false;
+  }
+  return true;
+}
+
+void RtaMultiRes::publish() {
+  float scale[RTA_STAGES];
+  for (int s = 0; s < RTA_STAGES; s++) {
+    scale[s] = segments[s] ? 1.0f / (float)segments[s] : 0.0f;
+  }
+  for (int b = 0; b < numBands; b++) {
+    const RtaBandSpan& span = spans[b];
+    if (scale[span.stage] == 0.0f) continue; // nothing new: keep the level
+    const float* acc = accum[span.stage] + span.firstBin;
+    const float* w = weights + span.offset;
+    float sum = 0.0f;
+    for (int i = 0; i < span.bins; i++) sum += acc[i] * w[i];
+    levels[b] = sum * scale[span.stage];
+  }
+  for (int s = 0; s < RTA_STAGES; s++) {
+    if (segments[s] == 0) continue;
+    memset(accum[s], 0, NUM_BINS * sizeof(float));
+    segments[s] = 0;
+  }
+}
+
+void RtaMultiRes::analyze() {
+  int s;
+  while ((s = segmentDue()) >= 0) {
+    snapshot(s);
+    transform(s);
+  }
+  publish();
+}
+
+bool RtaMultiRes::setBands(const float* lo, const float* hi, int count) {
+  return rtaBuildBandTable(fs, FFT_SIZE, lo, hi, count, spans, RTA_MAX_BANDS,
+                           weights, RTA_MAX_BAND_WEIGHTS, numBands, numWeights);
+}
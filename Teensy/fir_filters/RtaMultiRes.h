@@ -0,0 +1,186 @@
+#ifndef RTA_MULTI_RES_H
+#define RTA_MULTI_RES_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <arm_math.h>
+
+// Multi-resolution spectrum core for the RTA, shared by RtaAnalyzer (the
+// AudioStream tap on the Teensy) and the host-native test suite - no
+// Arduino/Audio dependencies.
+//
+// A single 4096-point FFT at 44.1kHz has 10.77Hz bins everywhere: still
+// wider than a 1/12-octave band below ~190Hz, and hundreds of times finer
+// than needed at the top. Here the input instead runs down a cascade of
+// half-band decimators, and three 1024-point FFTs watch the full-rate
+// signal, the /4 signal and the /16 signal:
+//
+//   stage  rate      bin      window   resolves bands from
+//   0      44.1kHz   43.1Hz   23ms     ~1.5kHz (up to 22kHz)
+//   1      11.0kHz   10.8Hz   93ms     ~370Hz  (up to 3.3kHz)
+//   2      2.76kHz   2.69Hz   371ms    everything below
+//
+// Each band is summed from the fastest stage that still puts at least
+// RTA_MIN_BINS_PER_BAND bins across it, so bass gets 4x the old resolution
+// while the treble bands get short, responsive windows. Three 1024-point
+// transforms cost less than one 4096-point one, and the working set is
+// about half the old analyzer's.
+//
+// Capture is gap-free Welch averaging. Each stage keeps a ring of its
+// latest FFT_SIZE samples and counts the samples written since its last
+// segment; every HOP (half a window) new samples make a segment due, and
+// each segment's power is added to the stage's accumulator. publish()
+// averages whatever accumulated since the previous frame into the band
+// levels. At 10 frames/s stage 0 averages ~8.6 half-overlapped segments a
+// frame instead of one 23ms snapshot, so no audio between frames goes
+// unseen and the treble bands stop flickering. The FFTs are spread over
+// the loop passes between frames (one segment per RtaAnalyzer::service
+// call), which leaves the frame itself only the band sums.
+//
+// The band-to-bin weights are built once by setBands() into a sparse
+// table (per band: stage, first bin, bin count, offset into one shared
+// weight array), so a frame is a multiply-add per table entry - no edge
+// rounding or overlap arithmetic per band per frame.
+
+#define RTA_STAGES 3
+// Bins a band needs before a faster (coarser) stage may serve it
+#define RTA_MIN_BINS_PER_BAND 2.0f
+#define RTA_MAX_BANDS 128
+// Sparse weight entries across all bands; the 121-band 20Hz-20kHz set
+// needs ~800 (mostly the wide treble bands on stage 0)
+#define RTA_MAX_BAND_WEIGHTS 1024
+
+// Half-band decimator: 31-tap Kaiser-windowed (beta 8) lowpass, flat to
+// 0.15 fs (+/-0.001dB) and down >80dB from 0.35 fs. Only the 8 odd-offset
+// coefficients and the 0.5 center tap are nonzero, so each output costs
+// 8 multiply-adds. Outputs below 0.3 of the new rate are alias-free.
+class RtaHalfBand {
+public:
+  static const int TAPS = 31;
+  static const int MAX_BLOCK = 128; // AUDIO_BLOCK_SAMPLES
+
+  RtaHalfBand() { reset(); }
+  void reset();
+  // Decimate n (even, <= MAX_BLOCK) samples into n/2 outputs
+  void process(const float* in, int n, float* out);
+
+private:
+  // Only the last TAPS-1 inputs persist between blocks; process() lines
+  // them up with the new block on the stack. RtaBank keeps 36 of these.
+  float hist[TAPS - 1];
+};
+
+// One band's slice of a sparse band-to-bin weight table
+struct RtaBandSpan {
+  uint8_t stage;
+  uint16_t firstBin;
+  uint16_t bins;
+  uint16_t offset; // into the shared weight array
+};
+
+// The band plan shared by RtaMultiRes and RtaBank, for RTA_STAGES stages of
+// fftSize-point FFTs over a /4-per-stage decimation cascade at rate fs.
+// rtaStageFor picks the stage that serves [lo, hi); rtaBuildBandTable fills
+// spans/weights for bands [lo[b], hi[b]) and returns false - keeping only
+// the bands that fit - past maxBands or maxWeights.
+int rtaStageFor(float fs, int fftSize, float lo, float hi);
+bool rtaBuildBandTable(float fs, int fftSize, const float* lo, const float* hi, int count,
+                       RtaBandSpan* spans, int maxBands, float* weights, int maxWeights,
+                       int& numBands, int& numWeights);
+
+class RtaMultiRes {
+public:
+  static const int FFT_SIZE = 1024;
+  static const int NUM_BINS = FFT_SIZE / 2; // 512
+  static const int HOP = FFT_SIZE / 2;      // 50% overlap
+  // Floats of caller-provided working memory (rings, window, FFT scratch,
+  // Welch accumulators, band weights and levels): 8832 floats, ~35KB.
+  static const size_t ARENA_FLOATS =
+      (size_t)RTA_STAGES * FFT_SIZE    // rings
+      + 3 * (size_t)FFT_SIZE           // window, work, spectrum
+      + (size_t)RTA_STAGES * NUM_BINS  // Welch accumulators
+      + RTA_MAX_BAND_WEIGHTS
+      + RTA_MAX_BANDS;                 // published band levels
+
+  // arena must hold ARENA_FLOATS and outlive the instance
+  RtaMultiRes(float sampleRate, float* arena);
+
+  // Build the sparse band table for bands [lo[b], hi[b]) Hz. Loop context,
+  // once (setup). Returns false - keeping only the bands that fit - if the
+  // set exceeds RTA_MAX_BANDS or RTA_MAX_BAND_WEIGHTS.
+  bool setBands(const float* lo, const float* hi, int count);
+  int bandCount() const { return numBands; }
+  int bandWeightCount() const { return numWeights; }
+
+  // Forget all history (decimator state, rings, accumulators, levels). Not
+  // safe against a concurrent push(); the caller serializes (see
+  // RtaAnalyzer::reset).
+  void reset();
+
+  // Feed n full-rate samples (int16 full scale). n must be a multiple of
+  // 16 and <= RtaHalfBand::MAX_BLOCK so every decimation stage sees an even
+  // count; the audio library's 128-sample blocks qualify.
+  void push(const int16_t* samples, int n);
+  // The same from float blocks (full scale 1.0), which may run past 1.0
+  void push(const float* samples, int n);
+
+  // The stage with a segment due (ring full, >= HOP new samples), or -1.
+  // snapshot() copies that stage's latest FFT_SIZE samples (oldest first,
+  // windowed) into the work buffer and restarts its hop count - it is the
+  // only part that reads what push() writes. transform() then runs the FFT
+  // on that copy and adds its power to the stage's accumulator.
+  int segmentDue() const;
+  void snapshot(int stage);
+  void transform(int stage);
+
+  // True once every stage has contributed a segment since the last reset
+  // (~371ms, the slowest ring's fill time)
+  bool ready() const;
+
+  // Average each stage's accumulated segments into the band levels and
+  // restart the accumulators. A stage with no new segment since the last
+  // publish (the /16 stage hops every ~186ms) keeps its bands' levels.
+  void publish();
+
+  // Every due segment, then publish() - for callers with no concurrent push()
+  void analyze();
+
+  // Published power of band b. A full-scale sine reads ~1.0 in its band on
+  // every stage (the decimators have unity passband gain).
+  float bandPower(int band) const {
+    return (band >= 0 && band < numBands) ? levels[band] : 0.0f;
+  }
+
+  // Which stage serves the band [lo, hi)
+  int stageFor(float lo, float hi) const { return rtaStageFor(fs, FFT_SIZE, lo, hi); }
+
+  float sampleRate(int stage) const { return fs / (float)(1 << (2 * stage)); }
+  float binWidthHz(int stage) const { return sampleRate(stage) / (float)FFT_SIZE; }
+
+private:
+  float fs;
+  float* ring[RTA_STAGES];
+  float* window;   // Hanning, with the FFT scaling folded in
+  float* work;     // windowed snapshot (clobbered by the FFT)
+  float* spectrum; // packed complex FFT output
+  float* accum[RTA_STAGES];
+  float* weights;
+  float* levels;
+  RtaBandSpan spans[RTA_MAX_BANDS];
+  int numBands = 0;
+  int numWeights = 0;
+  volatile int head[RTA_STAGES];    // next write position in each ring
+  volatile int fill[RTA_STAGES];    // samples written, saturating at FFT_SIZE
+  volatile int pending[RTA_STAGES]; // written since the last snapshot, saturating
+  int segments[RTA_STAGES];         // accumulated since the last publish
+  bool seen[RTA_STAGES];            // any segment since reset
+  RtaHalfBand decim[2 * (RTA_STAGES - 1)]; // two half-bands per /4 step
+  arm_rfft_fast_instance_f32 rfft;
+
+  void write(int stage, const float* x, int n);
+  // push() once the samples are float in a: writes stage 0 and decimates
+  // (a is the cascade's scratch)
+  void decimate(float* a, int n);
+};
+
+#endif // RTA_MULTI_RES_H
@@ -9,26 +9,27 @@ static const unsigned long HEADER_PATCH_INTERVAL_MS = 5000;
 // blocks while loop() was stalled.
 static const int OVERRUN_WATERMARK = 45;
 
-// Next unused "rec-NNN.wav" in RECORDINGS_DIR. Three digits, so the picker
-// sorts naturally; 999 recordings of anything is a full card anyway.
-bool SdRecorder::allocateName() {
+// Next unused "<prefix>NNN.wav" in dir. Three digits, so the picker sorts
+// naturally; 999 files of anything is a full card anyway.
+bool nextNumberedWavName(const char* dir, const char* prefix, char* name, size_t len) {
+    const size_t prefixLen = strlen(prefix);
     int highest = 0;
-    File dir = SD.open(RECORDINGS_DIR);
-    if (dir && dir.isDirectory()) {
-        File entry = dir.openNextFile();
+    File d = SD.open(dir);
+    if (d && d.isDirectory()) {
+        File entry = d.openNextFile();
         while (entry) {
             const char* n = entry.name();
-            if (!entry.isDirectory() && strncmp(n, "rec-", 4) == 0) {
-                int num = atoi(n + 4);
+            if (!entry.isDirectory() && strncmp(n, prefix, prefixLen) == 0) {
+                int num = atoi(n + prefixLen);
                 if (num > highest) highest = num;
             }
             entry.close();
-            entry = dir.openNextFile();
+            entry = d.openNextFile();
         }
     }
-    if (dir) dir.close();
+    if (d) d.close();
     if (highest >= 999) return false;
-    snprintf(name, sizeof(name), "rec-%03d.wav", highest + 1);
+    snprintf(name, len, "%s%03d.wav", prefix, highest + 1);
     return true;
 }
 
@@ -38,7 +39,7 @@ const char* SdRecorder::start() {
     if (!SD.exists(RECORDINGS_DIR) && !SD.mkdir(RECORDINGS_DIR)) {
         return "mkdir";
     }
-    if (!allocateName()) {
+    if (!nextNumberedWavName(RECORDINGS_DIR, "rec-", name, sizeof(name))) {
         name[0] = '\0';
         return "full";
     }
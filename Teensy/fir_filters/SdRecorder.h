@@ -23,6 +23,10 @@
 
 #define RECORDINGS_DIR "/recordings"
 
+// Next unused "<prefix>NNN.wav" in dir (rec-NNN.wav here, ir-NNN.wav for
+// IrMeasurement) into name; false once NNN would pass 999.
+bool nextNumberedWavName(const char* dir, const char* prefix, char* name, size_t len);
+
 class SdRecorder {
 public:
     SdRecorder(AudioRecordQueue& left, AudioRecordQueue& right)
@@ -50,7 +54,6 @@ public:
     bool consumeOverrunWarning();
 
 private:
-    bool allocateName();
     void patchHeader();
     bool drainOnePair();
 
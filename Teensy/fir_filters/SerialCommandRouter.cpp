@@ -51,14 +51,40 @@ void SerialCommandRouter::loop() {
 void SerialCommandRouter::processCommand(const String& rawCommand, OutputStream& out) {
     String cmd_str;
     String argsString;
+    String line = rawCommand;
+
+    // "@<sample> <command> ...": a due time on the audio sample clock.
+    // A malformed stamp drops the line rather than running it at the wrong
+    // time.
+    stamped = false;
+    if (line.charAt(0) == '@') {
+        int end = line.indexOf(' ');
+        bool ok = end > 1;
+        uint32_t sample = 0;
+        for (int i = 1; ok && i < end; i++) {
+            char c = line.charAt(i);
+            uint32_t next = sample * 10 + (uint32_t)(c - '0');
+            ok = c >= '0' && c <= '9' && next / 10 == sample;
+            sample = next;
+        }
+        if (!ok) {
+            Serial.print("Bad command stamp - dropped: ");
+            Serial.println(rawCommand);
+            return;
+        }
+        line = line.substring(end + 1);
+        line.trim();
+        stamped = true;
+        stampSample = sample;
+    }
 
-    int firstDelim = rawCommand.indexOf(' ');
+    int firstDelim = line.indexOf(' ');
     if (firstDelim == -1) {
-        cmd_str = rawCommand;
+        cmd_str = line;
         argsString = "";
     } else {
-        cmd_str = rawCommand.substring(0, firstDelim);
-        argsString = rawCommand.substring(firstDelim + 1);
+        cmd_str = line.substring(0, firstDelim);
+        argsString = line.substring(firstDelim + 1);
     }
 
     cmd_str.trim();
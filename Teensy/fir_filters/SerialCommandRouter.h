@@ -10,7 +10,10 @@
 // reply directly to the port through the provided OutputStream.
 //
 // Wire protocol (all lines newline-terminated):
-//   ESP -> Teensy:  "<command> <arg1> <arg2> ...\n"
+//   ESP -> Teensy:  "<command> <arg1> <arg2> ...\n", optionally stamped
+//                   "@<sample> <command> ..." - handlers that can act at a
+//                   given audio sample read it back with stamp(); the rest
+//                   run the command as if it were unstamped.
 //   Teensy -> ESP:  free-form reply lines written by handlers, e.g.
 //                   "PONG <uptime>", or "FILES" ... "EOT" for the file list.
 //                   "EVENT <name>" lines announce unsolicited events (sendEvent).
@@ -61,6 +64,13 @@ public:
     // mid-burst" from "the link has gone quiet" without inspecting the port.
     uint32_t dispatched() const { return dispatchCount; }
 
+    // The "@<sample>" stamp on the command being dispatched, if it had one.
+    // Only meaningful inside a handler.
+    bool stamp(uint32_t& sample) const {
+        sample = stampSample;
+        return stamped;
+    }
+
     // Split a space-separated argument string; runs of spaces count as one
     // delimiter. Returns a new[]'d array (caller deletes) and sets count,
     // or nullptr with count 0. (Exposed for testing.)
@@ -81,6 +91,8 @@ private:
     Command commands[MAX_COMMANDS];
     int commandCount;
     uint32_t dispatchCount = 0;
+    bool stamped = false;
+    uint32_t stampSample = 0;
 
     char lineBuffer[LINE_BUFFER_SIZE];
     size_t lineLength;
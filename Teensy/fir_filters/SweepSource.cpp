@@ -0,0 +1,43 @@
+#include "SweepSource.h"
+
+SweepSource::SweepSource()
+  : AudioStream(0, nullptr),
+    sweep_(IR_SAMPLE_RATE, IR_SWEEP_F0_HZ, IR_SWEEP_F1_HZ, IR_SWEEP_SAMPLES,
+           IR_FADE_IN_SAMPLES, IR_FADE_OUT_SAMPLES) {}
+
+void SweepSource::start(float amplitude) {
+  amp_ = amplitude;
+  sweep_.seek(0);
+  sampleCount_ = 0;
+  finished_ = false;
+  running_ = true;
+}
+
+void SweepSource::stop() {
+  running_ = false;
+  finished_ = false;
+}
+
+void SweepSource::update(void) {
+  if (!running_) return; // no transmit: downstream mixer sees silence
+
+  audio_block_t* block = allocate();
+  if (block) {
+    // The phase stays in double (the M7 has a double-precision FPU): the
+    // deconvolver regenerates this exact waveform for its inverse filter
+    for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) {
+      block->data[i] = (int16_t)(amp_ * sweep_.next() * 32767.0f);
+    }
+    transmit(block);
+    release(block);
+  } else {
+    // Pool exhausted: keep the clock honest (the capture will show the
+    // gap as a dropout in the result, not as a timing shift)
+    for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) sweep_.next();
+  }
+  sampleCount_ += AUDIO_BLOCK_SAMPLES;
+  if (sampleCount_ >= IR_SWEEP_SAMPLES) {
+    running_ = false;
+    finished_ = true;
+  }
+}
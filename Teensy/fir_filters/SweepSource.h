@@ -0,0 +1,41 @@
+#ifndef SWEEP_SOURCE_H
+#define SWEEP_SOURCE_H
+
+#include <Arduino.h>
+#include <AudioStream.h>
+#include "IrDeconvolver.h"   // ExpSweep
+#include "teensy_protocol.h" // IR_* sweep contract
+
+// Log sweep player for the impulse response measurement: one IR_* sweep
+// (ExpSweep - the same waveform IrDeconvolver inverts), then silence. Like
+// ProbeSource it owns only the waveform and its sample clock; which output
+// it leaves through is the sketch's business (outputOverride), and the
+// capture that has to line up with it is started by IrMeasurement in the
+// same AudioNoInterrupts() section as start().
+class SweepSource : public AudioStream {
+public:
+  SweepSource();
+
+  // Callers wrap start()/stop() in AudioNoInterrupts()/AudioInterrupts() so
+  // the first sweep block and the capture's first block share an update.
+  void start(float amplitude);
+  void stop();
+
+  bool isRunning() const { return running_; }
+  bool isFinished() const { return finished_; }
+  uint32_t samplesElapsed() const { return sampleCount_; }
+
+  virtual void update(void) override;
+
+private:
+  // Read from loop(), written by update()/start()/stop()
+  volatile bool running_ = false;
+  volatile bool finished_ = false;
+  volatile uint32_t sampleCount_ = 0;
+
+  // update()-context only
+  ExpSweep sweep_;
+  float amp_ = 0.0f;
+};
+
+#endif // SWEEP_SOURCE_H
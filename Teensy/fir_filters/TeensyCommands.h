@@ -23,9 +23,11 @@
   X(setInputEq, handleSetInputEq) \
   X(resetInputEq, handleResetInputEq) \
   X(setInputEqEnabled, handleSetInputEqEnabled) \
+  X(setInputEqSpl, handleSetInputEqSpl) \
   X(setFir, handleSetFIR) \
   X(setFirEnabled, handleSetFIREnabled) \
   X(loadFirFiles, handleLoadFirFiles) \
+  X(setOutputFirCompiled, handleSetOutputFirCompiled) \
   X(getFiles, handleGetFiles) \
   X(setDelaysEnabled, handleSetDelaysEnabled) \
   X(setSpeakerGains, handleSetSpeakerGains) \
@@ -35,6 +37,7 @@
   X(stopTone, handleStopTone) \
   X(setNoise, handleSetNoise) \
   X(setRta, handleSetRta) \
+  X(setRtaBank, handleSetRtaBank) \
   X(setVu, handleSetVu) \
   X(setPlaybackGain, handleSetPlaybackGain) \
   X(setCompEnabled, handleSetCompEnabled) \
@@ -47,6 +50,8 @@
   X(setGrm, handleSetGrm) \
   X(startDelayProbe, handleStartDelayProbe) \
   X(stopDelayProbe, handleStopDelayProbe) \
+  X(startIrMeasure, handleStartIrMeasure) \
+  X(stopIrMeasure, handleStopIrMeasure) \
   X(soloOutput, handleSoloOutput) \
   X(startRecording, handleStartRecording) \
   X(stopRecording, handleStopRecording) \
@@ -54,6 +59,8 @@
   X(playRecording, handlePlayRecording) \
   X(stopPlayback, handleStopPlayback) \
   X(deleteRecording, handleDeleteRecording) \
+  X(setLevelLog, handleSetLevelLog) \
+  X(getLevelLog, handleGetLevelLog) \
   X(setMute, handleSetMute) \
   X(setMutePercent, handleSetMutePercent) \
   X(ping, handlePing)
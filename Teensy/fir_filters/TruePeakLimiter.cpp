@@ -0,0 +1,164 @@
+#include "TruePeakLimiter.h"
+
+#include <math.h>
+#include <string.h>
+
+static inline int16_t saturate16(float v) {
+  if (v > 32767.0f) return 32767;
+  if (v < -32768.0f) return -32768;
+  return (int16_t)v;
+}
+
+void TruePeakLimiter::begin(float sampleRate) {
+  ceiling = FULL_SCALE * powf(10.0f, CEILING_DB / 20.0f);
+  releaseCoeff = 1.0f - expf(-1000.0f / (RELEASE_MS * sampleRate));
+  // Phase p interpolates the point p/OVERSAMPLE of the way from x[3] to
+  // x[4]: a Blackman-windowed sinc spanning the eight taps, normalized to
+  // unity DC gain
+  const float PI_F = 3.14159265f;
+  const float halfSpan = TAPS / 2.0f;
+  boundGain = 1.0f;
+  for (int p = 0; p < OVERSAMPLE - 1; p++) {
+    const float frac = (float)(p + 1) / OVERSAMPLE;
+    float sum = 0.0f;
+    for (int i = 0; i < TAPS; i++) {
+      const float d = frac - (float)(i - (TAPS / 2 - 1));
+      const float sinc = sinf(PI_F * d) / (PI_F * d);
+      const float w = 0.42f + 0.5f * cosf(PI_F * d / halfSpan) + 0.08f * cosf(2.0f * PI_F * d / halfSpan);
+      phase[p][i] = sinc * w;
+      sum += phase[p][i];
+    }
+    float absSum = 0.0f;
+    for (int i = 0; i < TAPS; i++) {
+      phase[p][i] /= sum;
+      absSum += fabsf(phase[p][i]);
+    }
+    if (absSum > boundGain) boundGain = absSum;
+  }
+  reset();
+}
+
+void TruePeakLimiter::reset() {
+  memset(work, 0, sizeof(work));
+  memset(line, 0, sizeof(line));
+  for (int i = 0; i < LOOKAHEAD; i++) avgRing[i] = GAIN_ONE;
+  avgSum = LOOKAHEAD * GAIN_ONE;
+  pos = 0;
+  qHead = 0;
+  qCount = 0;
+  slot = 0;
+  prevBlockPeak = 0.0f;
+  envelope = 1.0f;
+  minGain = 1.0f;
+  quiet = LATENCY + TAPS;
+}
+
+float TruePeakLimiter::slotPeak(const float* x) const {
+  float peak = fabsf(x[TAPS / 2 - 1]);
+  for (int p = 0; p < OVERSAMPLE - 1; p++) {
+    float s = 0.0f;
+    for (int i = 0; i < TAPS; i++) s += phase[p][i] * x[i];
+    s = fabsf(s);
+    if (s > peak) peak = s;
+  }
+  return peak;
+}
+
+// Append a slot over the ceiling, dropping the smaller peaks before it: they
+// leave the window sooner and can never be its maximum again
+void TruePeakLimiter::pushPeak(uint32_t s, float peak) {
+  while (qCount > 0) {
+    const int back = (qHead + qCount - 1) % LOOKAHEAD;
+    if (qPeak[back] > peak) break;
+    qCount--;
+  }
+  const int at = (qHead + qCount) % LOOKAHEAD;
+  qSlot[at] = s;
+  qPeak[at] = peak;
+  qCount++;
+}
+
+float TruePeakLimiter::takeMinGain() {
+  const float g = minGain;
+  minGain = 1.0f;
+  return g;
+}
+
+void TruePeakLimiter::process(const float* in, int16_t* out, int n) {
+  if (in == nullptr && idle()) {
+    // Silence through silence: only the slot clock moves (the queue has
+    // expired and the average is back at unity)
+    if (out != nullptr) memset(out, 0, n * sizeof(int16_t));
+    slot += (uint32_t)n;
+    return;
+  }
+  while (n > 0) {
+    const int chunk = n < MAX_BLOCK ? n : MAX_BLOCK;
+    run(in, out, chunk);
+    if (in != nullptr) in += chunk;
+    if (out != nullptr) out += chunk;
+    n -= chunk;
+  }
+}
+
+void TruePeakLimiter::run(const float* in, int16_t* out, int n) {
+  float* x = work + (TAPS - 1);
+  float blockPeak = 0.0f;
+  if (in != nullptr) {
+    for (int i = 0; i < n; i++) {
+      x[i] = in[i];
+      const float a = fabsf(in[i]);
+      if (a > blockPeak) blockPeak = a;
+    }
+  } else {
+    memset(x, 0, n * sizeof(float));
+  }
+  if (blockPeak == 0.0f) {
+    quiet = quiet + n > LATENCY + TAPS ? LATENCY + TAPS : quiet + n;
+  } else {
+    quiet = 0;
+  }
+
+  // No slot here can interpolate past the ceiling when neither this block
+  // nor the tail of the last one (the first slots' look-back) comes within
+  // the interpolator's largest gain of it
+  const float near = blockPeak > prevBlockPeak ? blockPeak : prevBlockPeak;
+  const bool detect = near * boundGain > ceiling;
+  const float avgScale = 1.0f / (float)(LOOKAHEAD * GAIN_ONE);
+
+  for (int j = 0; j < n; j++, slot++) {
+    if (detect) {
+      const float peak = slotPeak(work + j);
+      if (peak > ceiling) pushPeak(slot, peak);
+    }
+    while (qCount > 0 && (int32_t)(slot - qSlot[qHead]) >= LOOKAHEAD) {
+      qHead = qHead + 1 == LOOKAHEAD ? 0 : qHead + 1;
+      qCount--;
+    }
+
+    // Instant attack to the window's need, one-pole release away from it
+    const float target = qCount > 0 ? ceiling / qPeak[qHead] : 1.0f;
+    if (target < envelope) {
+      envelope = target;
+    } else if (envelope != target) {
+      envelope += (target - envelope) * releaseCoeff;
+      // Snap the last -80dB: float steps this small stall short of target
+      if (target - envelope < 1e-4f) envelope = target;
+    }
+
+    const uint32_t q = (uint32_t)(envelope * GAIN_ONE);
+    avgSum += q - avgRing[pos];
+    avgRing[pos] = q;
+    line[pos] = work[j + TAPS / 2 - 1];
+    pos = pos + 1 == LOOKAHEAD ? 0 : pos + 1;
+
+    // The slot LOOKAHEAD - 1 back leaves, scaled by the average over every
+    // slot whose window held it
+    const float g = (float)avgSum * avgScale;
+    if (g < minGain) minGain = g;
+    if (out != nullptr) out[j] = saturate16(line[pos] * g);
+  }
+
+  memmove(work, work + n, (TAPS - 1) * sizeof(float));
+  prevBlockPeak = blockPeak;
+}
@@ -0,0 +1,100 @@
+#ifndef TRUE_PEAK_LIMITER_H
+#define TRUE_PEAK_LIMITER_H
+
+// Brickwall lookahead limiter with true-peak detection, one per output,
+// shared by OutputGainStage (on the Teensy) and the host-native test suite -
+// no Arduino/Audio dependencies.
+//
+// It sits after the output gain, where a +10dB output gain on a hot mix
+// would otherwise saturate silently on the way to the DAC, and holds every
+// output under CEILING_DB true peak:
+//
+//  - True peak: each sample's slot also gets three points between it and
+//    the next, interpolated at 4x (8-tap windowed-sinc phases), so overs the
+//    DAC's reconstruction filter would make between samples count too.
+//    Blocks quiet enough that no interpolated point can reach the ceiling
+//    skip the interpolation entirely.
+//  - Lookahead: a peak's required gain is held for LOOKAHEAD slots with an
+//    O(1) (amortized) sliding-window maximum - a monotonic queue that only
+//    ever holds slots over the ceiling - then released with a one-pole
+//    RELEASE_MS recovery and smoothed by a LOOKAHEAD-long moving average.
+//    Every gain averaged over a peak's window is at or below what the peak
+//    needs, so the audio, delayed by LATENCY, arrives at the peak already
+//    turned down far enough: no overshoot, and no step in the gain.
+//
+// The moving average runs on integer gains, so it can't drift.
+
+#include <stdint.h>
+
+class TruePeakLimiter {
+public:
+  static const int TAPS = 8;          // per interpolated phase
+  static const int OVERSAMPLE = 4;
+  static const int LOOKAHEAD = 96;    // 2.2ms at 44.1kHz
+  // Input to output delay in samples: the interpolator's look-forward plus
+  // the lookahead window
+  static const int LATENCY = TAPS / 2 + LOOKAHEAD - 1;
+  static const int MAX_BLOCK = 128;   // per process() pass; longer runs are split
+  static constexpr float CEILING_DB = -1.0f; // dBTP
+  static constexpr float RELEASE_MS = 50.0f;
+  static constexpr float FULL_SCALE = 32767.0f;
+
+  // Build the interpolator and release for a sample rate; starts reset()
+  void begin(float sampleRate);
+
+  // Back to silence at unity gain
+  void reset();
+
+  // Limit n samples at int16 scale (a gain stage's output, which may exceed
+  // full scale) into out, saturated. in == nullptr is silence; out ==
+  // nullptr still runs the samples through (keeps the delay on time). Once
+  // idle() holds, silence in means silence out and can be skipped.
+  void process(const float* in, int16_t* out, int n);
+
+  // Nothing in the delay line and the gain fully recovered
+  bool idle() const { return quiet >= LATENCY + TAPS && avgSum == LOOKAHEAD * GAIN_ONE; }
+
+  // Lowest gain applied since the previous call (1 = no reduction)
+  float takeMinGain();
+
+  // The true-peak estimate of one slot: the sample x[3] and the three
+  // points between it and x[4], from x[0..7] (exposed for the tests)
+  float slotPeak(const float* x) const;
+
+private:
+  // Moving-average gain resolution: LOOKAHEAD unity gains sum to under 2^24,
+  // so the running sum is exact in both uint32 and float
+  static const uint32_t GAIN_ONE = 1u << 16;
+
+  void run(const float* in, int16_t* out, int n);
+  void pushPeak(uint32_t slot, float peak);
+
+  float ceiling = 0.0f;
+  float releaseCoeff = 1.0f;
+  float phase[OVERSAMPLE - 1][TAPS] = {};
+  float boundGain = 1.0f; // largest phase's sum of |coefficients|
+
+  // Last TAPS - 1 inputs, ahead of the block being processed
+  float work[TAPS - 1 + MAX_BLOCK];
+  float prevBlockPeak = 0.0f;
+
+  // Audio delay line and the moving average's ring, both LOOKAHEAD long and
+  // indexed by pos
+  float line[LOOKAHEAD];
+  uint32_t avgRing[LOOKAHEAD];
+  uint32_t avgSum = 0;
+  int pos = 0;
+
+  // Sliding-window maximum: slots over the ceiling, peaks decreasing
+  uint32_t qSlot[LOOKAHEAD];
+  float qPeak[LOOKAHEAD];
+  int qHead = 0;
+  int qCount = 0;
+  uint32_t slot = 0;
+
+  float envelope = 1.0f;
+  float minGain = 1.0f;
+  int quiet = 0; // consecutive silent input samples (saturates)
+};
+
+#endif // TRUE_PEAK_LIMITER_H
@@ -0,0 +1,111 @@
+#ifndef USB_LATENCY_TARGET_H
+#define USB_LATENCY_TARGET_H
+
+#include <stdint.h>
+
+// Hardware-free ring-fill target for AsyncAudioInputUSB, learned from how
+// the host actually delivers. A fixed cushion has to be sized for the worst
+// host; a steady one (a packet every 1ms USB frame) needs little more than
+// one output block, which matters when the USB source is a TV and the
+// speakers have to stay in lip-sync with the picture.
+//
+// What the cushion must cover is the longest wait for the next packet
+// (plus the output block drained in one go and a margin for the resampler's
+// lookahead and the servo's ripple). The worst packet gap is tracked as an
+// envelope: it jumps up at once to any longer gap, and a run of starved
+// blocks the stream recovers from (the cushion ran dry after all) pushes it
+// up by STARVE_BUMP_US on top - once the next full block shows the host is
+// still there, since a host that stopped outright starves the consumer too
+// until the stop is detected, and that says nothing about jitter. It
+// only falls back toward what the host has been doing lately once a
+// second, over DECAY_WINDOWS seconds, so one good minute doesn't undo an
+// occasional stall.
+//
+// The servo target then follows the envelope at a limited rate - fill is
+// moved by the resampler running slightly fast or slow, never by dropping
+// or padding samples, so changing it mid-stream is inaudible: GROW_MS_PER_S
+// is a 0.1% step offset, SHRINK_MS_PER_S 0.01%, both far inside the
+// resampler's 1% adaption. At a stream (re)start the ring is trimmed anyway,
+// so streamStarted() takes the learned target in one go. The statistics
+// outlive a stopped stream: the next one comes from the same host.
+class UsbLatencyTarget {
+public:
+    static constexpr float MIN_MS = 4.0f;     // one block + lookahead + margin
+    static constexpr float MAX_MS = 20.0f;    // well inside the ring and its resync ceiling
+    static constexpr float START_MS = 8.0f;   // until the first stream says otherwise
+    static constexpr float MARGIN_MS = 1.5f;  // resampler lookahead + servo ripple
+    static constexpr float GROW_MS_PER_S = 1.0f;
+    static constexpr float SHRINK_MS_PER_S = 0.1f;
+    static const uint32_t STARVE_BUMP_US = 2000;
+    static const uint32_t DECAY_WINDOWS = 30; // 1s windows
+
+    // blockMs: the consumer's update period (one output block)
+    explicit UsbLatencyTarget(float blockMs)
+        : blockMs(blockMs),
+          envelopeUs((START_MS - blockMs - MARGIN_MS) * 1000.0f),
+          targetMs_(START_MS) {}
+
+    // Once per consumer update while streaming: the longest packet gap since
+    // the previous call and whether this block came up short.
+    void update(uint32_t gapUs, bool starved) {
+        if (gapUs > windowMaxUs) windowMaxUs = gapUs;
+        if ((float)gapUs > envelopeUs) envelopeUs = (float)gapUs;
+        if (starved) {
+            starving = true;
+        } else if (starving) {
+            starving = false;
+            envelopeUs += (float)STARVE_BUMP_US;
+        }
+        // Past what MAX_MS can cover more gap only slows the way back down
+        const float capUs = (MAX_MS - blockMs - MARGIN_MS) * 1000.0f;
+        if (envelopeUs > capUs) envelopeUs = capUs;
+        windowMs += blockMs;
+        if (windowMs >= 1000.0f) {
+            windowMs -= 1000.0f;
+            if ((float)windowMaxUs < envelopeUs) {
+                envelopeUs += ((float)windowMaxUs - envelopeUs) / (float)DECAY_WINDOWS;
+            }
+            windowMaxUs = 0;
+        }
+        const float wanted = wantedMs();
+        if (targetMs_ < wanted) {
+            targetMs_ += GROW_MS_PER_S * blockMs * 0.001f;
+            if (targetMs_ > wanted) targetMs_ = wanted;
+        } else if (targetMs_ > wanted) {
+            targetMs_ -= SHRINK_MS_PER_S * blockMs * 0.001f;
+            if (targetMs_ < wanted) targetMs_ = wanted;
+        }
+    }
+
+    // Stream (re)start: the consumer trims the ring to the target anyway, so
+    // jump straight to what the statistics ask for.
+    void streamStarted() {
+        targetMs_ = wantedMs();
+        starving = false;
+        windowMs = 0.0f;
+        windowMaxUs = 0;
+    }
+
+    // The fill the servo should hold now
+    float targetMs() const { return targetMs_; }
+
+    // Where the target is heading: the gap envelope plus a block and margin
+    float wantedMs() const {
+        const float ms = blockMs + envelopeUs * 0.001f + MARGIN_MS;
+        if (ms < MIN_MS) return MIN_MS;
+        if (ms > MAX_MS) return MAX_MS;
+        return ms;
+    }
+
+    uint32_t gapEnvelopeUs() const { return (uint32_t)envelopeUs; }
+
+private:
+    const float blockMs;
+    float envelopeUs;          // worst packet gap, decaying
+    float targetMs_;
+    float windowMs = 0.0f;     // time into the current 1s window
+    uint32_t windowMaxUs = 0;  // longest gap in it
+    bool starving = false;     // the last block came up short
+};
+
+#endif // USB_LATENCY_TARGET_H
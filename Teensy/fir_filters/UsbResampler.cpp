@@ -29,6 +29,7 @@
 
 #include "UsbResampler.h"
 
+#include <arm_math.h>
 #include <math.h>
 
 UsbResampler::UsbResampler(float attenuation, int32_t minHalfFilterLength, int32_t maxHalfFilterLength, StepAdaptionParameters settings): _targetAttenuation(attenuation)
@@ -139,6 +140,45 @@ double UsbResampler::getAttenuation() const {
 int32_t UsbResampler::getHalfFilterLength() const{
 	return  _halfFilterLength;
 }
+void UsbResampler::setFastKernel(bool enabled){
+    _fastKernelEnabled=enabled;
+}
+bool UsbResampler::fastKernel() const{
+    return _fast;
+}
+
+// Vybes: transposes filter[r + k*OS] (k < H, r < OS) to filter[r*H + k] in
+// place, then appends row OS (row 0 one tap on, plus the table's last
+// entry) so every phase 0..OS has its row. The transpose follows each
+// permutation cycle once, marking visited entries in tempRes, which
+// setFilter() is done with.
+void UsbResampler::setPolyphaseRows(){
+    const int32_t H=USB_RESAMPLER_FAST_HALF_FILTER_LENGTH;
+    const int32_t OS=_overSamplingFactor;
+    const int32_t n=H*OS;
+    const float last=filter[n];
+    uint8_t* visited=(uint8_t*)tempRes;
+    memset(visited, 0, (n+7)/8);
+    for (int32_t start=1; start<n-1; start++){
+        if (visited[start>>3] & (1<<(start&7))){
+            continue;
+        }
+        float carried=filter[start];
+        int32_t i=start;
+        do {
+            const int32_t dest=(i%OS)*H+i/OS;
+            const float displaced=filter[dest];
+            filter[dest]=carried;
+            carried=displaced;
+            visited[dest>>3]|=(uint8_t)(1<<(dest&7));
+            i=dest;
+        } while (i!=start);
+    }
+    for (int32_t k=0; k<H-1; k++){
+        filter[n+k]=filter[k+1];
+    }
+    filter[n+H-1]=last;
+}
 void UsbResampler::reset(){
     _initialized=false;
 }
@@ -161,6 +201,7 @@ void UsbResampler::configure(float fs, float newFs){
     for (uint8_t i =0; i< USB_RESAMPLER_MAX_NO_CHANNELS; i++){
         memset(_buffer[i], 0, sizeof(float)*_maxHalfFilterLength*2);
     }
+    memset(_seam, 0, sizeof(_seam));
 
     double kaiserBeta, cutOffFrequ;
     _overSamplingFactor=1024;
@@ -228,6 +269,11 @@ void UsbResampler::configure(float fs, float newFs){
     Serial.println(_step, 12);
 #endif
     setFilter(_halfFilterLength, _overSamplingFactor, cutOffFrequ, kaiserBeta);
+    _fast=_fastKernelEnabled && _halfFilterLength==USB_RESAMPLER_FAST_HALF_FILTER_LENGTH
+        && (_overSamplingFactor+1)*USB_RESAMPLER_FAST_HALF_FILTER_LENGTH <= USB_RESAMPLER_MAX_FILTER_SAMPLES;
+    if (_fast){
+        setPolyphaseRows();
+    }
     _filterLength=_halfFilterLength*2;
     for (uint8_t i =0; i< USB_RESAMPLER_MAX_NO_CHANNELS; i++){
         _endOfBuffer[i]=&_buffer[i][_filterLength];
@@ -240,6 +286,10 @@ bool UsbResampler::initialized() const {
 }
 
 void UsbResampler::resample(float* input0, float* input1, uint16_t inputLength, uint16_t& processedLength, float* output0, float* output1,uint16_t outputLength, uint16_t& outputCount) {
+    if (_fast){
+        resampleFast(input0, input1, inputLength, processedLength, output0, output1, outputLength, outputCount);
+        return;
+    }
     outputCount=0;
     int32_t successorIndex=(int32_t)(ceil(_cPos));  //negative number -> currently the _buffer0 of the last iteration is used
     float* ip0, *ip1, *fPtr;
@@ -321,7 +371,16 @@ void UsbResampler::resample(float* input0, float* input1, uint16_t inputLength,
     else{
         processedLength=min(inputLength, (int16_t)floor(_cPos + _halfFilterLength));
     }
-    //fill _buffer
+    keepHistory(input0, input1, processedLength);
+    _cPos-=processedLength;
+    if (_cPos < -_halfFilterLength){
+        _cPos=-_halfFilterLength;
+    }
+}
+
+//fill _buffer
+void UsbResampler::keepHistory(float* input0, float* input1, uint16_t processedLength) {
+    float* ip0, *ip1;
     const int32_t indexData=processedLength-_filterLength;
     if (indexData>=0){
         ip0=input0+indexData;
@@ -344,6 +403,113 @@ void UsbResampler::resample(float* input0, float* input1, uint16_t inputLength,
             *b1++ = *ip1++;
         } 
     }
+}
+
+// Vybes: the stereo kernel at H=20 over the polyphase rows. Same positions,
+// weights and tap span as resample() above: for the phase c=ceil(distScaled)
+// the right half blends rows c-1 and c, the left half rows OS-c and OS-c+1
+// read backwards (the filter is symmetric). An output exactly on a sample
+// (c==0) is taken as phase OS with the window one sample on - the same
+// coefficients, with the zero at -H swapped for the one at +H.
+void UsbResampler::resampleFast(float* input0, float* input1, uint16_t inputLength, uint16_t& processedLength, float* output0, float* output1,uint16_t outputLength, uint16_t& outputCount) {
+    const int32_t H=USB_RESAMPLER_FAST_HALF_FILTER_LENGTH;
+    const int32_t L=2*H;
+    const int32_t OS=_overSamplingFactor;
+    const float overSampling=(float)OS;
+    const uint16_t head=inputLength < L ? inputLength : L;
+    memcpy(&_seam[0][L], input0, head*sizeof(float));
+    memcpy(&_seam[1][L], input1, head*sizeof(float));
+
+    float coeffs[L];
+    outputCount=0;
+    int32_t successorIndex=(int32_t)(ceil(_cPos));
+    while (floor(_cPos + H) < inputLength && outputCount < outputLength){
+        const float dist=successorIndex-_cPos;
+        const float distScaled=dist*overSampling;
+        int32_t phase=(int32_t)(ceilf(distScaled));
+        const float w0=phase-distScaled;
+        const float w1=1.f-w0;
+        int32_t indexData=successorIndex-H;
+        if (phase==0){
+            phase=OS;
+            indexData++;
+        }
+        const float* left=filter+(OS-phase)*H;
+        const float* right=filter+(phase-1)*H;
+        for (int32_t k=0; k<H; k++){
+            coeffs[H-1-k]=left[k]*w1 + left[H+k]*w0;
+            coeffs[H+k]=right[k]*w0 + right[H+k]*w1;
+        }
+        const float* x0=indexData>=0 ? input0+indexData : &_seam[0][L+indexData];
+        const float* x1=indexData>=0 ? input1+indexData : &_seam[1][L+indexData];
+        arm_dot_prod_f32(x0, coeffs, L, output0++);
+        arm_dot_prod_f32(x1, coeffs, L, output1++);
+
+        outputCount++;
+
+        _cPos+=_stepAdapted;
+        while (_cPos >successorIndex){
+            successorIndex++;
+        }
+    }
+    if(outputCount < outputLength){
+        processedLength=inputLength;
+    }
+    else{
+        processedLength=min(inputLength, (int16_t)floor(_cPos + H));
+    }
+    keepSeam(input0, input1, processedLength);
+    _cPos-=processedLength;
+    if (_cPos < -H){
+        _cPos=-H;
+    }
+}
+
+// The next call's history: the L samples up to processedLength, out of
+// this input or, on a short call, still partly out of the seam (whose head
+// the caller has already filled from this input)
+void UsbResampler::keepSeam(float* input0, float* input1, uint16_t processedLength) {
+    const int32_t L=2*USB_RESAMPLER_FAST_HALF_FILTER_LENGTH;
+    if (processedLength>=L){
+        memcpy(_seam[0], input0+processedLength-L, L*sizeof(float));
+        memcpy(_seam[1], input1+processedLength-L, L*sizeof(float));
+    }
+    else {
+        memmove(_seam[0], &_seam[0][processedLength], L*sizeof(float));
+        memmove(_seam[1], &_seam[1][processedLength], L*sizeof(float));
+    }
+}
+
+// The output loop of both kernels with the arithmetic taken out: only the
+// read position moves, then the history is kept as either kernel keeps it
+void UsbResampler::skip(float* input0, float* input1, uint16_t inputLength, uint16_t& processedLength, uint16_t outputLength, uint16_t& outputCount) {
+    if (_fast){
+        const int32_t L=2*USB_RESAMPLER_FAST_HALF_FILTER_LENGTH;
+        const uint16_t head=inputLength < L ? inputLength : L;
+        memcpy(&_seam[0][L], input0, head*sizeof(float));
+        memcpy(&_seam[1][L], input1, head*sizeof(float));
+    }
+    outputCount=0;
+    int32_t successorIndex=(int32_t)(ceil(_cPos));
+    while (floor(_cPos + _halfFilterLength) < inputLength && outputCount < outputLength){
+        outputCount++;
+        _cPos+=_stepAdapted;
+        while (_cPos >successorIndex){
+            successorIndex++;
+        }
+    }
+    if(outputCount < outputLength){
+        processedLength=inputLength;
+    }
+    else{
+        processedLength=min(inputLength, (int16_t)floor(_cPos + _halfFilterLength));
+    }
+    if (_fast){
+        keepSeam(input0, input1, processedLength);
+    }
+    else {
+        keepHistory(input0, input1, processedLength);
+    }
     _cPos-=processedLength;
     if (_cPos < -_halfFilterLength){
         _cPos=-_halfFilterLength;
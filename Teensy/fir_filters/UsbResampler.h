@@ -31,10 +31,23 @@
 // renamed to avoid colliding with the original, which Audio.h still pulls in
 // for AsyncAudioInputSPDIF3). Only functional change: the oversampled filter
 // table is shrunk from 40961 to 10242 entries, cutting the instance from
-// ~194KB to ~71KB of heap. configure() adapts by lowering the oversampling
-// factor (1024 -> 512 for the 1:1-ratio USB case); linear interpolation
+// ~194KB to ~71KB. configure() adapts by lowering the oversampling
+// factor (1024 -> 512 for the 1:1-ratio case); linear interpolation
 // between 512x-oversampled phases keeps images below ~-108dB, under the
-// 16-bit output floor. Upstream source: libraries/Audio/Resampler.{h,cpp}.
+// 16-bit output floor. Both async inputs use it: AsyncAudioInputUSB on the
+// heap, AsyncAudioInputSPDIF (the vendored AsyncAudioInputSPDIF3) in RAM1.
+// Upstream source: libraries/Audio/Resampler.{h,cpp}.
+//
+// Vybes: the stereo resample() also has a fast kernel for a half filter
+// length of 20, the default minimum that every 1:1/upsampling configuration
+// (USB, 44.1kHz SPDIF) uses. configure() re-lays the table in place as one
+// row of 20 taps per oversampled phase (513 at 512x), so each
+// output blends its two neighbouring rows into one coefficient row and runs
+// one contiguous CMSIS dot product per channel, instead of four strided
+// multiply-adds per tap with a history wrap check on every one. The history
+// sits in front of the head of the current input (_seam), so a window that
+// straddles the two is still one run of samples. Output matches the
+// upstream kernel to float rounding; setFastKernel(false) keeps upstream's.
 
 #ifndef usb_resampler_h_
 #define usb_resampler_h_
@@ -66,10 +79,15 @@
 #endif
 #endif // VYBES_NATIVE
 
-#define USB_RESAMPLER_MAX_FILTER_SAMPLES 10242 //=512*20 + 2: fits oversampling 512 at the min half filter length of 20
+#define USB_RESAMPLER_MAX_FILTER_SAMPLES 10260 //=513*20: oversampling 512 at the min half filter length of 20, as the fast kernel's 513 rows
+#define USB_RESAMPLER_FAST_HALF_FILTER_LENGTH 20
 #define USB_RESAMPLER_NO_EXACT_KAISER_SAMPLES 1025
 #define USB_RESAMPLER_MAX_HALF_FILTER_LENGTH 80
 #define USB_RESAMPLER_MAX_NO_CHANNELS 8
+//Vybes: the default for setFastKernel(). Build with -D USB_RESAMPLER_FAST_KERNEL=0 to run both inputs on the upstream kernel and compare the 20s summary's input CPU on hardware
+#ifndef USB_RESAMPLER_FAST_KERNEL
+#define USB_RESAMPLER_FAST_KERNEL 1
+#endif
 class UsbResampler {
     public:
 
@@ -95,6 +113,9 @@ class UsbResampler {
         ///@param outputLength length of each output array
         ///@param outputCount number of samples of each output array, that were filled with data
         void resample(float* input0, float* input1, uint16_t inputLength, uint16_t& processedLength, float* output0, float* output1,uint16_t outputLength, uint16_t& outputCount);
+        ///Vybes: advance exactly as the stereo resample() would - same processedLength and outputCount, same history kept - without computing any output.
+        ///Only for input the caller knows is silent, history included, where every output would be zero
+        void skip(float* input0, float* input1, uint16_t inputLength, uint16_t& processedLength, uint16_t outputLength, uint16_t& outputCount);
         bool addToSampleDiff(double diff);
         double getXPos() const;
         double getStep() const;
@@ -103,8 +124,12 @@ class UsbResampler {
         bool initialized() const;
 		double getAttenuation() const;
 		int32_t getHalfFilterLength() const;
+        ///@param enabled use the fast stereo kernel when the configured half filter length allows it. Takes effect at the next configure()
+        void setFastKernel(bool enabled);
+        bool fastKernel() const;
         
-        //resampling NOCHANNELS channels. Performance is increased a lot if the number of channels is known at compile time -> the number of channels is a template argument
+        //resampling NOCHANNELS channels. Vybes: reads the upstream table layout, so only valid while fastKernel() is false.
+        //Performance is increased a lot if the number of channels is known at compile time -> the number of channels is a template argument
         template <uint8_t NOCHANNELS>
         inline void resample(float** inputs, uint16_t inputLength, uint16_t& processedLength, float** outputs, uint16_t outputLength, uint16_t& outputCount){
             outputCount=0;
@@ -232,12 +257,20 @@ class UsbResampler {
         void getKaiserExact(double beta);
         void setKaiserWindow(double beta, int32_t noSamples);
         void setFilter(int32_t halfFiltLength,int32_t overSampling, double cutOffFrequ, double kaiserBeta);
+        void setPolyphaseRows();
+        void resampleFast(float* input0, float* input1, uint16_t inputLength, uint16_t& processedLength, float* output0, float* output1,uint16_t outputLength, uint16_t& outputCount);
+        void keepHistory(float* input0, float* input1, uint16_t processedLength);
+        void keepSeam(float* input0, float* input1, uint16_t processedLength);
         float filter[USB_RESAMPLER_MAX_FILTER_SAMPLES];
         double kaiserWindowSamples[USB_RESAMPLER_NO_EXACT_KAISER_SAMPLES];
         double tempRes[USB_RESAMPLER_NO_EXACT_KAISER_SAMPLES-1];
         double kaiserWindowXsq[USB_RESAMPLER_NO_EXACT_KAISER_SAMPLES-1];
         float _buffer[USB_RESAMPLER_MAX_NO_CHANNELS][USB_RESAMPLER_MAX_HALF_FILTER_LENGTH*2];
         float* _endOfBuffer[USB_RESAMPLER_MAX_NO_CHANNELS];
+        // fast kernel: the last 2*H input samples, then the first 2*H of the current input
+        float _seam[2][USB_RESAMPLER_FAST_HALF_FILTER_LENGTH*4];
+        bool _fastKernelEnabled=USB_RESAMPLER_FAST_KERNEL;
+        bool _fast=false;   //filter holds polyphase rows and resample() runs resampleFast()
 
 		int32_t _minHalfFilterLength;
 		int32_t _maxHalfFilterLength;
@@ -33,6 +33,7 @@ public:
         const uint32_t gap = nowMicros - lastRxMicros;
         if (active) {
             if (gap > maxGapUs) maxGapUs = gap;
+            if (gap > jitterGapUs) jitterGapUs = gap;
         } else if (pktCount) {
             // First packet after the consumer declared the stream stopped.
             // This is the ONLY place the true host silence across a stop can
@@ -120,6 +121,16 @@ public:
 
     void consume(uint32_t frames) { rpos += frames; }
 
+    // Whether the next `frames` readable frames (across the wrap) are all
+    // exact zeros on both channels - the idle consumer's skip test
+    bool silent(uint32_t frames) const {
+        for (uint32_t i = 0; i < frames; i++) {
+            const uint32_t at = (rpos + i) & MASK;
+            if (bufL[at] != 0.0f || bufR[at] != 0.0f) return false;
+        }
+        return true;
+    }
+
     // --- stats ---
 
     bool streaming() const { return active; }
@@ -132,6 +143,14 @@ public:
     // stop our own consumer invented.
     uint32_t takeMaxGapUs() { const uint32_t g = maxGapUs; maxGapUs = 0; return g; }
 
+    // The same peak read-and-reset on its own, for the consumer's latency
+    // adaption (so it and the telemetry don't steal each other's peaks).
+    uint32_t takeJitterGapUs() { const uint32_t g = jitterGapUs; jitterGapUs = 0; return g; }
+
+    // Consumer side: the fill the prefill gate waits for at the next stream
+    // (re)start, following the consumer's target latency.
+    void setPrefill(uint32_t samples) { prefill = samples < CAPACITY ? samples : CAPACITY; }
+
     uint32_t packets() const { return pktCount; }
     uint32_t falseStops() const { return falseStopCount; }
     int32_t lastFalseDelta() const { return lastFalseDeltaUs; }
@@ -150,12 +169,13 @@ private:
     volatile uint32_t dropCount;
     uint32_t stopCount; // consumer-only
     volatile uint32_t maxGapUs = 0;      // diagnostics, producer-written
+    volatile uint32_t jitterGapUs = 0;   // the same, for the latency adaption
     volatile uint32_t pktCount = 0;
     volatile uint32_t resumeGapUs = 0;
     volatile uint32_t resumeSeq = 0;
     uint32_t falseStopCount = 0; // consumer-only
     int32_t lastFalseDeltaUs = 0;
-    const uint32_t prefill;
+    uint32_t prefill; // consumer-only
     const uint32_t stopGap;
 };
 
@@ -1,8 +1,9 @@
 #ifndef WAV_FORMAT_H
 #define WAV_FORMAT_H
 
-// Canonical 44-byte PCM WAV header: build, patch and field helpers for the
-// SD recorder (SdRecorder) and player (SdWavPlayer). Pure C++ with no
+// Canonical 44-byte WAV header: build, patch and field helpers for the SD
+// recorder (SdRecorder), player (SdWavPlayer) and IR measurement
+// (IrMeasurement). Pure C++ with no
 // Arduino dependencies so the host-native test suite can cover it - the
 // header a crashed recording leaves behind is only as good as this code.
 
@@ -40,18 +41,25 @@ static inline uint32_t readU32(const uint8_t* p) {
            ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
 }
 
-// Fill out[HEADER_BYTES] with a canonical PCM header (fmt chunk directly
-// followed by the data chunk - the layout every player accepts).
+// fmt chunk format tags
+static const uint16_t FORMAT_PCM = 1;
+static const uint16_t FORMAT_IEEE_FLOAT = 3;
+
+// Fill out[HEADER_BYTES] with a canonical header (fmt chunk directly
+// followed by the data chunk - the layout every player accepts). The
+// recorder writes 16-bit PCM; the IR measurement writes 32-bit float
+// (FORMAT_IEEE_FLOAT), which the FIR loader and design tools read as-is.
 static inline void buildHeader(uint8_t* out, uint32_t dataBytes,
                                uint32_t sampleRate, uint16_t channels,
-                               uint16_t bitsPerSample) {
+                               uint16_t bitsPerSample,
+                               uint16_t format = FORMAT_PCM) {
     const uint16_t blockAlign = (uint16_t)(channels * (bitsPerSample / 8));
     memcpy(out, "RIFF", 4);
     writeU32(out + 4, 36 + dataBytes);
     memcpy(out + 8, "WAVE", 4);
     memcpy(out + 12, "fmt ", 4);
     writeU32(out + 16, 16);            // fmt chunk size
-    writeU16(out + 20, 1);             // PCM
+    writeU16(out + 20, format);
     writeU16(out + 22, channels);
     writeU32(out + 24, sampleRate);
     writeU32(out + 28, sampleRate * blockAlign);
@@ -4,7 +4,10 @@
 #include <SerialFlash.h>
 #include <malloc.h>
 #include "FIRLoader.h"
+#include "FirCompiler.h"
+#include "FirLatency.h"
 #include "PEQProcessor.h"
+#include "LoudnessEq.h"
 #include "CrossoverFilter.h"
 #include "MultibandCompressor.h"
 #include "SerialCommandRouter.h"
@@ -12,17 +15,25 @@
 #include "OutputStream.h"
 #include "AudioFilterFIRFloat.h"
 #include "IntervalTimer.h"
-#include "RtaFFT4096.h"
+#include "RtaAnalyzer.h"
+#include "RtaBankAnalyzer.h"
 #include "ProbeSource.h"
+#include "SweepSource.h"
+#include "IrMeasurement.h"
+#include "ProbeCapture.h"
+#include "LevelLogger.h"
 #include "AsyncAudioInputUSB.h"
+#include "AsyncAudioInputSPDIF.h"
 #include "SdRecorder.h"
 #include "SdWavPlayer.h"
 #include "WavFormat.h"
 #include "PeakMeter.h"
+#include "OutputGainStage.h"
+#include "InputGate.h"
 
 // The .ino prototype generator injects generated prototypes for the sketch's
 // functions partway down the globals below - above where OutputState is
-// defined. outputTargetGain() takes an OutputState&, and a reference only
+// defined. outputOverride() takes an OutputState&, and a reference only
 // needs the type declared, so declare it here (before the insertion point) or
 // that generated prototype fails to compile.
 struct OutputState;
@@ -64,17 +75,30 @@ SerialCommandRouter router(Serial1);
 // FIR taps shared across all outputs (FIR_TAP_POOL on the ESP). Loads that
 // would push the total over the pool are rejected with an error the ESP can
 // relay. Fast convolution costs 16 bytes/tap (2 x partitions x 256 floats),
-// so a full pool is ~192KB - reserved once, statically, as firArena rather
+// so a full pool is ~240KB - reserved once, statically, as firArena rather
 // than fought for on the heap at every load. The pool is what that fixed
 // block holds, not a guess at what the heap can spare. It is also why
 // loadFirFiles streams coefficients into the engine instead of reading the
 // file into an array first: a whole-file copy would need another 4 bytes/tap
-// of heap on top, and an exact-fit set (3072+3072+6144) has none to give.
+// of heap on top, and an exact-fit set (3072+4096+8192) has none to give.
 // The direct engine runs out of CPU long before it runs out of pool.
-#define FIR_TAP_POOL 12288
+#define FIR_TAP_POOL 15360
+
+// Compiled outputs (setOutputFirCompiled): the crossover + PEQ ring-out is
+// kept until it holds this little of the cascade's energy, up to
+// FIR_COMPILE_TAIL_TAPS (teensy_protocol.h). Edits to a compiled output
+// recompile it once they have stopped for FIR_RECOMPILE_IDLE_MS.
+#define FIR_COMPILE_FLOOR_DB -60.0f
+#define FIR_RECOMPILE_IDLE_MS 1000
 
 // Audio block pool size (see the AudioMemory call in setup for the budget).
-#define AUDIO_POOL_BLOCKS (FIR_USE_FAST_CONVOLUTION ? 480 : 240)
+#define AUDIO_POOL_BLOCKS (FIR_USE_FAST_CONVOLUTION ? 560 : 240)
+
+// Float32 block pool for the float links (AudioStreamF32.h; storage next to
+// firArena). The peak is the eight crossover -> PEQ blocks in flight at
+// once (every crossover updates before the first PEQ), plus a soloed RTA
+// tap's copy and the FIR's and compressor's outputs.
+#define F32_POOL_BLOCKS 16
 
 // RAM2 heap and audio-block-pool stats, printed where the budget matters.
 // "unclaimed" is heap sbrk has never handed out; "reclaimable" is what
@@ -86,16 +110,21 @@ extern unsigned long _heap_end;
 extern char* __brkval;
 static void printMemoryStats(const char* tag) {
   struct mallinfo mi = mallinfo();
-  Serial.printf("MEM %s: heap unclaimed %lu + reclaimable %lu bytes, audio blocks %d used (max %d of %d)\n",
+  const F32BlockPool& f32 = AudioStreamF32::poolF32();
+  Serial.printf("MEM %s: heap unclaimed %lu + reclaimable %lu bytes, audio blocks %d used (max %d of %d), "
+                "float blocks %u used (max %u of %u, %lu failed)\n",
                 tag, (unsigned long)((char*)&_heap_end - __brkval),
                 (unsigned long)mi.fordblks,
-                AudioMemoryUsage(), AudioMemoryUsageMax(), AUDIO_POOL_BLOCKS);
+                AudioMemoryUsage(), AudioMemoryUsageMax(), AUDIO_POOL_BLOCKS,
+                (unsigned)f32.used(), (unsigned)f32.usedMax(), (unsigned)f32.capacity(),
+                (unsigned long)f32.allocFails());
 }
 
 // Audio generators
 AudioSynthWaveform       Tone_generator;
 AudioSynthNoisePink      pink1;
 ProbeSource              probeSource; // auto delay alignment chirps
+SweepSource              sweepSource; // impulse response log sweep
 
 // USB input engine: 1 = AsyncAudioInputUSB (ring buffer + resampler, immune
 // to host clock drift and packet burst jitter; needs the core_fork packet
@@ -103,14 +132,46 @@ ProbeSource              probeSource; // auto delay alignment chirps
 // receive queue. Both are stereo with identical patchcords.
 #define USB_INPUT_ASYNC 1
 
+// Idle input skipping: 1 = an input with nothing to play (SPDIF unlocked,
+// USB stream stopped, or exact digital silence for
+// InputActivity::SILENT_BLOCKS) stops sending blocks, so its mixer channel
+// costs nothing and the async inputs stop resampling; the first non-zero
+// sample brings it back. Suspended while recording (a bus with no blocks
+// records no time). The 20s console summary shows the per-object CPU.
+// 0 = every input sends every block, as before.
+#define INPUT_IDLE_SKIP 1
+
 //Audio Inputs (Bluetooth, SPDIF, USB, analog)
 AudioInputI2S            Bluetooth_in;
-AsyncAudioInputSPDIF3    Optical_in;
+AsyncAudioInputSPDIF     Optical_in; // AsyncAudioInputSPDIF3 on the slim resampler
 #if USB_INPUT_ASYNC
 AsyncAudioInputUSB       USB_in;
 #else
 AudioInputUSB            USB_in;
 #endif
+// Idle skipping for the stock I2S inputs, between them and their mixers
+InputGate                btGate;
+InputGate                analogGate;
+
+// The buses stop once every input is idle, and a FIR with no input stops
+// mid ring-out - so the last audio has to be out of the longest one first.
+// A lost source is held open on zeros for the same time.
+static_assert(InputActivity::SILENT_BLOCKS * AUDIO_BLOCK_SAMPLES >= FIR_TAP_POOL,
+              "inputs must stay awake until the longest FIR has rung out");
+// Peak readings have two consumers - the 20s console print and the STATS
+// line the ESP's ping asks for - and the sources only offer read-and-reset
+// (AudioProcessorUsageMaxReset, takeMaxGapUs). foldTelemetryPeaks drains the
+// sources into a peak per consumer, so each reports the worst since its own
+// last report instead of stealing the other's.
+struct TelemetryPeaks {
+  float cpuMax = 0.0f;
+  uint32_t maxGapUs = 0;
+};
+static TelemetryPeaks consolePeaks;
+static TelemetryPeaks statsPeaks;
+
+static void foldTelemetryPeaks();
+
 // Stereo ADC (e.g. PCM1808) on I2S2: data pin 5, BCLK pin 4, LRCLK pin 3,
 // MCLK pin 33. The Teensy is clock master; the ADC runs as a slave.
 AudioInputI2S2           Analog_in;
@@ -138,15 +199,20 @@ MultibandCompressor inputComp;
 
 // Per-output processing chain, one entry per output channel 0-7:
 // source mixer (in 0 = L bus, in 1 = R bus) -> HP/LP crossover -> PEQ ->
-// FIR -> delay -> amp (gain * volume, invert via negative gain, mute via 0).
+// FIR -> delay -> gain stage (gain * volume, invert via negative gain, mute
+// via 0; one OutputGainStage for all eight, so changes stamped alike land
+// on every output at the same sample - see OutputGainStage.h).
 // Bypass lives inside the objects (crossover/PEQ/FIR pass through when idle,
-// delay time 0 is a passthrough) - no patchcord swapping.
+// delay time 0 is a passthrough) - no patchcord swapping. Crossover, PEQ
+// and FIR pass float32 between them (floatCords, AudioStreamF32.h), so the
+// chain rounds to int16 once, at the FIR's output, instead of at every hop.
 AudioMixer4              sourceMixer[NUM_OUTPUTS];
 CrossoverFilter          xover[NUM_OUTPUTS];
 PEQProcessor             outputPeq[NUM_OUTPUTS];
 AudioFilterFIRFloat      firFilter[NUM_OUTPUTS];
 AudioEffectDelay         outputDelay[NUM_OUTPUTS];
-AudioAmplifier           outputAmp[NUM_OUTPUTS];
+OutputGainStage          outputGain;
+static_assert(NUM_OUTPUTS == OutputGainStage::CHANNELS, "one gain stage channel per output");
 
 // Outputs
 // Analog output is octal I2S: four data lines (pins 7, 32, 6, 9) sharing the
@@ -156,7 +222,8 @@ AudioAmplifier           outputAmp[NUM_OUTPUTS];
 AudioOutputSPDIF3        L_R_Spdif_Out;
 AudioOutputI2SOct        Analog_Out;
 
-// RTA spectrum tap: a 4096-point FFT whose 1/12-octave band levels stream to
+// RTA spectrum tap: a multi-resolution analyzer (three 1024-point FFTs over
+// a decimation cascade, see RtaMultiRes.h) whose 1/12-octave band levels stream to
 // the web UI over the ESP link. Its input is switched by updateRtaSource():
 // the L+R source mix (pre-DSP) for the input scope, or a single soloed
 // output's post-crossover signal so the "source" trace is band-limited
@@ -165,7 +232,13 @@ AudioOutputI2SOct        Analog_Out;
 // trying to correct bands the driver can't reproduce). The FFT input is
 // disconnected while idle so it costs no CPU (see rtaLoop).
 AudioMixer4              RTA_mixer;
-RtaFFT4096               RTA_fft;
+RtaAnalyzer              RTA_fft;
+
+// Per-output spectra: all eight outputs (post-chain, after outputGain) plus
+// the L+R mix analyzed at once, so a multi-way system's drivers show side
+// by side without soloing. Inputs are wired only while the UI streams them
+// (see setRtaBankEnabled); frames go out round-robin (rtaBankLoop).
+RtaBankAnalyzer          RTA_bank;
 
 // SD recorder taps (the full mixed stereo input, pre input-EQ, so recordings
 // are independent of preset EQ and master volume) and the SD WAV player,
@@ -177,6 +250,11 @@ AudioRecordQueue         recordQueueL;
 AudioRecordQueue         recordQueueR;
 SdWavPlayer              sdPlayer;
 
+// Measurement mic capture (IR sweep, on-device delay probe): the analog
+// input's left channel, tapped straight off the ADC (ahead of the aux mixer,
+// which the measurements mute so the mic isn't played back into the room)
+AudioRecordQueue         micCaptureQueue;
+
 // Stereo peak/clip meter on the input bus (drives the web UI's level bars
 // via "VU" frames; see vuLoop)
 PeakMeter                inputMeter;
@@ -187,54 +265,68 @@ PeakMeter                inputMeter;
 AudioConnection          patchCord_GenToneToMixer(Tone_generator, 0, Generator_mixer, 0);
 AudioConnection          patchCord_PinkToMixer(pink1, 0, Generator_mixer, 1);
 AudioConnection          patchCord_ProbeToGenMixer(probeSource, 0, Generator_mixer, 2);
+AudioConnection          patchCord_SweepToGenMixer(sweepSource, 0, Generator_mixer, 3);
 AudioConnection          patchCord_GenMixerToLeftAux(Generator_mixer, 0, Left_Aux_mixer, 0);
 AudioConnection          patchCord_GenMixerToRightAux(Generator_mixer, 0, Right_Aux_mixer, 0);
 
 // External input connections
 AudioConnection          patchCord_OpticalLToLeftMixer(Optical_in, 0, Left_mixer, 0);
 AudioConnection          patchCord_OpticalRToRightMixer(Optical_in, 1, Right_mixer, 0);
-AudioConnection          patchCord_BluetoothLToLeftMixer(Bluetooth_in, 0, Left_mixer, 1);
-AudioConnection          patchCord_BluetoothRToRightMixer(Bluetooth_in, 1, Right_mixer, 1);
+AudioConnection          patchCord_BluetoothLToGate(Bluetooth_in, 0, btGate, 0);
+AudioConnection          patchCord_BluetoothRToGate(Bluetooth_in, 1, btGate, 1);
+AudioConnection          patchCord_BluetoothLToLeftMixer(btGate, 0, Left_mixer, 1);
+AudioConnection          patchCord_BluetoothRToRightMixer(btGate, 1, Right_mixer, 1);
 AudioConnection          patchCord_USBLToLeftMixer(USB_in, 0, Left_mixer, 2);
 AudioConnection          patchCord_USBRToRightMixer(USB_in, 1, Right_mixer, 2);
-AudioConnection          patchCord_AnalogLToLeftAux(Analog_in, 0, Left_Aux_mixer, 1);
-AudioConnection          patchCord_AnalogRToRightAux(Analog_in, 1, Right_Aux_mixer, 1);
+AudioConnection          patchCord_AnalogLToGate(Analog_in, 0, analogGate, 0);
+AudioConnection          patchCord_AnalogRToGate(Analog_in, 1, analogGate, 1);
+AudioConnection          patchCord_AnalogLToLeftAux(analogGate, 0, Left_Aux_mixer, 1);
+AudioConnection          patchCord_AnalogRToRightAux(analogGate, 1, Right_Aux_mixer, 1);
 AudioConnection          patchCord_LeftAuxToLeftMixer(Left_Aux_mixer, 0, Left_mixer, 3);
 AudioConnection          patchCord_RightAuxToRightMixer(Right_Aux_mixer, 0, Right_mixer, 3);
 
 // RTA tap connections (the FFT link starts disconnected; see setup).
 // updateRtaSource() feeds RTA_fft from exactly one of these at a time:
 // patchCord_RTAMixerToFFT for the input scope, patchCord_SoloToFFT (rebound
-// to the soloed output's crossover) while an output is soloed.
+// to the soloed output's crossover, a float link like the chain it taps)
+// while an output is soloed.
 AudioConnection          patchCord_LeftMixerToRTA(Left_mixer, 0, RTA_mixer, 0);
 AudioConnection          patchCord_RightMixerToRTA(Right_mixer, 0, RTA_mixer, 1);
 AudioConnection          patchCord_RTAMixerToFFT(RTA_mixer, 0, RTA_fft, 0);
-AudioConnection          patchCord_SoloToFFT; // bound to xover[solo] on demand
+AudioConnectionF32       patchCord_SoloToFFT; // bound to xover[solo] on demand
+AudioConnection          bankCords[RTA_BANK_CHANNELS]; // bound while RTA_bank streams
 
 // Recorder tap and player injection points
 AudioConnection          patchCord_LeftMixerToRec(Left_mixer, 0, recordQueueL, 0);
 AudioConnection          patchCord_RightMixerToRec(Right_mixer, 0, recordQueueR, 0);
 AudioConnection          patchCord_PlayerToLeftAux(sdPlayer, 0, Left_Aux_mixer, 2);
 AudioConnection          patchCord_PlayerToRightAux(sdPlayer, 1, Right_Aux_mixer, 2);
+AudioConnection          patchCord_AnalogLToMicCapture(Analog_in, 0, micCaptureQueue, 0);
 
 // Input bus meter taps
 AudioConnection          patchCord_LeftMixerToMeter(Left_mixer, 0, inputMeter, 0);
 AudioConnection          patchCord_RightMixerToMeter(Right_mixer, 0, inputMeter, 1);
 
 SdRecorder               sdRecorder(recordQueueL, recordQueueR);
+IrMeasurement            irMeasure(sweepSource, micCaptureQueue);
+ProbeCapture             probeCapture(micCaptureQueue);
+LevelLogger              levelLogger;
 
 // Input EQ patchcords
 AudioConnection patchCord_LeftMixerToPreEQ(Left_mixer, 0, Left_Pre_EQ_amp, 0);
 AudioConnection patchCord_RightMixerToPreEQ(Right_mixer, 0, Right_Pre_EQ_amp, 0);
 AudioConnection patchCord_LeftPreEQToPEQ(Left_Pre_EQ_amp, 0, peqLeft, 0);
 AudioConnection patchCord_RightPreEQToPEQ(Right_Pre_EQ_amp, 0, peqRight, 0);
-AudioConnection patchCord_LeftPeqToComp(peqLeft, 0, inputComp, 0);
-AudioConnection patchCord_RightPeqToComp(peqRight, 0, inputComp, 1);
+// The EQ hands the compressor float blocks (AudioStreamF32): a boost is
+// only rounded to int16 after the compressor, ahead of the source mixers
+AudioConnectionF32 patchCord_LeftPeqToComp(peqLeft, 0, inputComp, 0);
+AudioConnectionF32 patchCord_RightPeqToComp(peqRight, 0, inputComp, 1);
 
 // Per-output connections, wired in setup() so they can be built in a loop
 // (Teensyduino 1.54+ supports unconnected AudioConnection + connect()).
 AudioConnection busCords[NUM_OUTPUTS][2];   // L/R bus -> source mixer
-AudioConnection chainCords[NUM_OUTPUTS][5]; // mixer->xover->peq->fir->delay->amp
+AudioConnection chainCords[NUM_OUTPUTS][3]; // mixer->xover, fir->delay->amp
+AudioConnectionF32 floatCords[NUM_OUTPUTS][2]; // xover->peq->fir, float32
 AudioConnection outCords[NUM_OUTPUTS];      // amp -> octal I2S
 AudioConnection spdifCords[2];              // outputs 0/1 -> SPDIF
 
@@ -242,6 +334,11 @@ const int CURRENT_VERSION = 4;
 bool sdCardInitialized = false;
 bool firFilesPending = false;
 
+// A compiled output's crossover or PEQ changed since its FIR was built; the
+// reload waits for the edits to stop (FIR_RECOMPILE_IDLE_MS past the last).
+bool firRecompilePending = false;
+unsigned long firRecompileEditAt = 0;
+
 // Set by the recorder/player command handlers so recorderStatusLoop() sends
 // a fresh "REC STATE" line on its next pass instead of waiting for the 1Hz
 // change poll.
@@ -294,11 +391,44 @@ static inline bool audioHeld() {
 #define RTA_K_LO 52 // 10^(52/40) = 20Hz
 #define RTA_FRAME_INTERVAL_MS 100
 #define RTA_KEEPALIVE_TIMEOUT_MS 7000
-static float RTA_BAND_CENTERS[RTA_NUM_BANDS]; // filled in setup()
 bool rtaEnabled = false;
 unsigned long rtaLastKeepaliveAt = 0;
 unsigned long rtaLastFrameAt = 0;
 
+// Band edges are a twelfth of an octave apart: center * 10^(+/-1/80)
+static void rtaBandEdges(float* lo, float* hi) {
+  for (int b = 0; b < RTA_NUM_BANDS; b++) {
+    float center = powf(10.0f, (float)(RTA_K_LO + b) / RTA_BANDS_PER_DECADE);
+    lo[b] = center * 0.971628f;
+    hi[b] = center * 1.029200f;
+  }
+}
+
+// Per-output spectra ("setRtaBank 1" keepalives, same scheme). One channel's
+// frame goes out per interval, round-robin, so each of the nine channels
+// refreshes ~2.2 times a second for ~5KB/s of link traffic.
+#define RTA_BANK_FRAME_INTERVAL_MS 50
+bool rtaBankEnabled = false;
+unsigned long rtaBankLastKeepaliveAt = 0;
+unsigned long rtaBankLastFrameAt = 0;
+int rtaBankNextChannel = 0;
+
+// --- Level log state ---
+// While the logger runs (setLevelLog, see teensy_protocol.h) the RTA stays
+// fed whether or not anyone streams it, and every published spectrum, input
+// meter reading and gain-reduction sample folds into levelLogAcc; once a
+// second levelLogLoop() closes the record and hands it to levelLogger.
+// Gain reduction is an instantaneous value, so it is sampled at the VU
+// frame rate rather than once a second.
+#define LEVEL_LOG_GR_SAMPLE_MS 50
+LevelLog::Accumulator levelLogAcc;
+unsigned long levelLogTickAt = 0;
+unsigned long levelLogGrAt = 0;
+bool levelLogGap = false;            // the next record follows missing seconds
+// What the log has cost since the previous STATS line (see chargeLevelLog)
+uint32_t levelLogUs = 0;
+uint32_t levelLogMaxUs = 0;
+
 // Per-output channel state. Defaults are silent (source gains 0) - the ESP
 // pushes the full DSP state after the "boot" event, so nothing plays from
 // stale defaults.
@@ -319,9 +449,10 @@ struct OutputState {
   bool eqEnabled = true;     // PEQ bypass (bands are kept; see setOutputEqEnabled)
 
   char firFile[MAX_FILENAME_LEN] = "";
-  uint16_t firTaps = 0;      // taps currently loaded (0 = none)
-
-  float currentGain = 0.0f;  // smoothed amp gain actually applied
+  uint16_t firTaps = 0;      // the file's taps currently loaded (0 = none)
+  float firLatency = 0.0f;   // the file's main arrival in samples, measured at load
+  bool firCompiled = false;  // fold xover + PEQ into the FIR at the next load
+  bool firCompiledLoaded = false; // the loaded FIR has them folded in
 };
 
 //Define a structure for holding state
@@ -337,8 +468,7 @@ struct State {
   float gainPlayer = 1.0; // SD playback (aux input 2); setPlaybackGain
 
   // Master Volume
-  float volume = 0.5; // User-set volume
-  float targetVolume = 0.5; // Target volume for smoothing
+  float volume = 0.5; // User-set volume (after the volume curve)
   bool muted = false;
   float mutePercent = 100.0; // Mute volume reduction percentage
 
@@ -349,17 +479,24 @@ struct State {
 
   OutputState outputs[NUM_OUTPUTS];
 
-  // Shared input EQ bands (left and right run the same curve)
-  PEQBand inputEqBands[MAX_PEQ_BANDS];
+  // Shared input EQ: every SPL set, and the curve between them for the
+  // current volume (left and right run the same curve)
+  LoudnessEq inputEq;
 };
 
 State state;
 
+// The input EQ curve both PEQ processors are loaded with (or morphing to),
+// with its coefficients. inputEqLoop() retunes it as the volume moves;
+// inputEqMaxUs is its slowest retune since the previous STATS line.
+LoudnessEq::Coeffs inputEqCoeffs;
+uint32_t inputEqMaxUs = 0;
+
 // --- Auto delay alignment probe state ---
 // The chirp schedule lives in probeSource (sample-clocked, ISR context);
 // everything here is loop()-context only: probeLoop() switches which output
-// is soloed between chirps, and outputTargetGain() consults probeSolo. The
-// solo rides the existing amp ramp, so switching is click-free. probeGain is
+// is soloed between chirps, and outputOverride() consults probeSolo. The
+// solo rides the gain stage's ramp, so switching is click-free. probeGain is
 // applied instead of the normal gain/mute/volume product so a muted device
 // or zero volume can't silence the measurement (invert is kept - the UI
 // correlates on magnitude).
@@ -370,11 +507,18 @@ int8_t probeOrder[2 * NUM_OUTPUTS];  // masked outputs ascending, then reversed
 int    probeChirps = 0;
 int    probeLastSlot = -1;
 
+// --- Impulse response measurement state ---
+// The run itself (sweep, capture, deconvolution) lives in irMeasure; this is
+// the output side, consulted by outputOverride() while irMeasure is
+// sounding. Same fixed-level solo as the probe.
+int   irSolo = -1;
+float irGain = 0.0f;
+
 // --- Output solo (per-output EQ measurement) ---
 // Keepalive-driven like the RTA: the ESP refreshes "soloOutput <ch>" every
 // couple of seconds while the analyzer measures one output, so a dropped
-// connection can't leave the system stuck on one speaker. Rides the amp
-// ramp via outputTargetGain (click-free) and changes nothing in the preset
+// connection can't leave the system stuck on one speaker. Rides the gain
+// stage's ramp via outputOverride (click-free) and changes nothing in the preset
 // state; the soloed output keeps its normal gain/volume/mute product.
 #define OUTPUT_SOLO_KEEPALIVE_TIMEOUT_MS 7000
 int outputSolo = -1;
@@ -384,12 +528,14 @@ unsigned long outputSoloLastKeepaliveAt = 0;
 // The per-output chains have no per-channel compensation stage (a per-output
 // pad would skew the balance between drivers and wreck crossover summing),
 // so one shared pad - the largest active output-EQ boost across all
-// channels - is folded into every source mixer's gains. Recomputed once
-// per loop() pass when
-// marked dirty, so a burst of EQ edits (the boot sync) costs one 8-channel
-// curve sweep, not eighty.
+// channels - is folded into every source mixer's gains. Each output's
+// boost is cached and only the channels marked stale are searched again,
+// once per loop() pass, so a drag on one output's EQ costs one curve
+// search per pass and a burst of edits (the boot sync) one per channel.
 float outputPadLin = 1.0f;
-bool outputPadDirty = false;
+float outputBoostDb[NUM_OUTPUTS] = {};
+uint8_t outputBoostStale = 0; // one bit per output
+static_assert(NUM_OUTPUTS <= 8, "outputBoostStale holds one bit per output");
 
 void setup() {
   Serial.begin(9600);
@@ -414,12 +560,13 @@ void setup() {
   }
 
   // Audio connections require memory to work. The delay lines dominate: in
-  // the worst case (the whole 12288-tap FIR pool on one output) the other
-  // seven outputs each carry ~139ms of group-delay compensation plus the
-  // 20ms user cap, ~440 blocks total. Sizing flagged for a hardware
+  // the worst case (the whole 15360-tap FIR pool on one output) the other
+  // seven outputs each carry ~174ms of group-delay compensation plus the
+  // 20ms user cap, ~525 blocks total. Sizing flagged for a hardware
   // benchmark in docs/FIRMWARE_V1_HANDOVER.md.
   Serial.println("Allocating audio memory");
   AudioMemory(AUDIO_POOL_BLOCKS);
+  beginFloatPool();
   Serial.println("=== Audio Memory Debug ===");
   Serial.print("AudioMemoryUsage(): ");
   Serial.println(AudioMemoryUsage());
@@ -437,11 +584,11 @@ void setup() {
     busCords[ch][0].connect(inputComp, 0, sourceMixer[ch], 0);
     busCords[ch][1].connect(inputComp, 1, sourceMixer[ch], 1);
     chainCords[ch][0].connect(sourceMixer[ch], 0, xover[ch], 0);
-    chainCords[ch][1].connect(xover[ch], 0, outputPeq[ch], 0);
-    chainCords[ch][2].connect(outputPeq[ch], 0, firFilter[ch], 0);
-    chainCords[ch][3].connect(firFilter[ch], 0, outputDelay[ch], 0);
-    chainCords[ch][4].connect(outputDelay[ch], 0, outputAmp[ch], 0);
-    outCords[ch].connect(outputAmp[ch], 0, Analog_Out, ch);
+    floatCords[ch][0].connect(xover[ch], 0, outputPeq[ch], 0);
+    floatCords[ch][1].connect(outputPeq[ch], 0, firFilter[ch], 0);
+    chainCords[ch][1].connect(firFilter[ch], 0, outputDelay[ch], 0);
+    chainCords[ch][2].connect(outputDelay[ch], 0, outputGain, ch);
+    outCords[ch].connect(outputGain, ch, Analog_Out, ch);
 
     // AudioMixer4 defaults every input to gain 1.0 - zero all four
     // (2 and 3 are unused) so channels start silent until the ESP syncs
@@ -453,14 +600,14 @@ void setup() {
     outputPeq[ch].begin(AUDIO_SAMPLE_RATE);
     firFilter[ch].setFastConvolution(FIR_USE_FAST_CONVOLUTION);
     outputDelay[ch].delay(0, 0.0f); // activate tap 0 (passthrough until set)
-    outputAmp[ch].gain(0.0f);       // ramps up once the ESP syncs
   }
-  spdifCords[0].connect(outputAmp[0], 0, L_R_Spdif_Out, 0);
-  spdifCords[1].connect(outputAmp[1], 0, L_R_Spdif_Out, 1);
+  // outputGain starts every output held at 0; it ramps up once the ESP syncs
+  spdifCords[0].connect(outputGain, 0, L_R_Spdif_Out, 0);
+  spdifCords[1].connect(outputGain, 1, L_R_Spdif_Out, 1);
 
-  // Signal generators start silent. The generator mixer's probe input (2)
-  // must be zeroed explicitly - AudioMixer4 defaults every input to 1.0 and
-  // the probe path only opens while a delay probe runs.
+  // Signal generators start silent. The generator mixer's probe (2) and
+  // sweep (3) inputs must be zeroed explicitly - AudioMixer4 defaults every
+  // input to 1.0 and those paths only open while a measurement runs.
   Tone_generator.begin(0.0, 1000, WAVEFORM_SINE);
   pink1.amplitude(0.0);
   Generator_mixer.gain(0, 1.0f);
@@ -480,8 +627,17 @@ void setup() {
   // RTA tap: equal L+R mix, idle until the UI asks for it
   RTA_mixer.gain(0, 0.5);
   RTA_mixer.gain(1, 0.5);
-  for (int b = 0; b < RTA_NUM_BANDS; b++) {
-    RTA_BAND_CENTERS[b] = powf(10.0f, (float)(RTA_K_LO + b) / RTA_BANDS_PER_DECADE);
+  {
+    // The analyzers turn the band edges into their band-to-bin weight
+    // tables once, here (the bank again after lending its arena out).
+    float lo[RTA_NUM_BANDS], hi[RTA_NUM_BANDS];
+    rtaBandEdges(lo, hi);
+    if (!RTA_fft.setBands(lo, hi, RTA_NUM_BANDS)) {
+      Serial.println("RTA: band table overflow, upper bands read silent");
+    }
+    if (!RTA_bank.setBands(lo, hi, RTA_NUM_BANDS)) {
+      Serial.println("RTAB: band table overflow, upper bands read silent");
+    }
   }
   patchCord_RTAMixerToFFT.disconnect();
 
@@ -492,7 +648,6 @@ void setup() {
   applyInputEqFilters(0);
   setFIREnabled(state.firEnabled);
   applyDelays();
-  updateTargetVolume();
 
   Serial.println("=== End of Setup Memory Usage ===");
   Serial.print("AudioMemoryUsage(): ");
@@ -562,20 +717,24 @@ void loop() {
 
   if (millis() - lastPrint > 20000) {
     lastPrint = millis();
+    foldTelemetryPeaks();
     Serial.print("Audio Processor Usage: ");
     Serial.print(AudioProcessorUsage());
     Serial.print("% (Max: ");
-    Serial.print(AudioProcessorUsageMax());
+    Serial.print(consolePeaks.cpuMax);
     Serial.println("%)");
-    AudioProcessorUsageMaxReset();
     printMemoryStats("periodic");
+    printInputCpu();
+    printFloatGraphStats();
 
 #if USB_INPUT_ASYNC
     Serial.print("USB in (async): ");
     Serial.print(USB_in.streaming() ? "streaming" : "idle");
     Serial.print(", buffered ");
     Serial.print(USB_in.bufferedMs(), 1);
-    Serial.print(" ms, step ");
+    Serial.print(" ms (target ");
+    Serial.print(USB_in.targetMs(), 1);
+    Serial.print("), step ");
     Serial.print(USB_in.stepPpm(), 1);
     Serial.print(" ppm, drops ");
     Serial.print(USB_in.drops());
@@ -595,7 +754,7 @@ void loop() {
     Serial.print(", falsestops ");
     Serial.print(USB_in.falseStops());
     Serial.print(", maxgap ");
-    Serial.print(USB_in.takeMaxGapUs());
+    Serial.print(consolePeaks.maxGapUs);
     Serial.println(" us");
 #else
     static uint32_t lastUnderruns = 0, lastOverruns = 0;
@@ -620,14 +779,28 @@ void loop() {
     lastUnderruns = underruns;
     lastOverruns = overruns;
 #endif
+    consolePeaks = TelemetryPeaks();
+  }
+
+  // A recompile is a full FIR load (held silent, like any other), so it waits
+  // out a running recording and any sync in progress - the sync's own
+  // loadFirFiles will pick the edits up.
+  if (firRecompilePending && !firFilesPending && !audioHeld() && !sdRecorder.isActive() &&
+      millis() - firRecompileEditAt >= FIR_RECOMPILE_IDLE_MS) {
+    Serial.println("Recompiling FIR filters after crossover/PEQ edits");
+    firFilesPending = true;
+    firLoadHold = true;
   }
 
   if (firFilesPending) {
     // A FIR load blocks loop() on SD reads and changes channel latencies -
     // either would corrupt a running measurement, so abort the probe first.
-    if (probeActive) {
+    if (probeActive || probeCapture.isActive()) {
       probeCleanup("PROBE ERR aborted firLoad\n");
     }
+    if (irMeasure.isActive()) {
+      irCleanup("IR ERR aborted\n");
+    }
     loadFirFiles();
     firFilesPending = false;
     firLoadHold = false;
@@ -657,16 +830,61 @@ void loop() {
     Serial.println(AudioMemoryUsage());
   }
   router.loop();
-  updateAudioVolume(); // Call this frequently to smooth gain changes
+  updateOutputOverrides();
+  inputEqLoop();
   rtaLoop();
+  rtaBankLoop();
   grmLoop();
   vuLoop();
+  levelLogLoop();
   probeLoop();
+  irLoop();
   outputSoloLoop();
   outputPadLoop();
   sdRecorder.service();
   sdPlayer.service();
   recorderStatusLoop();
+  inputIdleLoop();
+}
+
+// Idle skipping follows INPUT_IDLE_SKIP, except while recording: the record
+// queues take whatever the buses carry, and a bus with no blocks would cut
+// the silence out of the file. Plain flag writes, cheap every pass.
+void inputIdleLoop() {
+  const bool enabled = INPUT_IDLE_SKIP && !sdRecorder.isActive();
+  Optical_in.setIdleEnabled(enabled);
+#if USB_INPUT_ASYNC
+  USB_in.setIdleEnabled(enabled);
+#endif
+  btGate.setIdleEnabled(enabled);
+  analogGate.setIdleEnabled(enabled);
+}
+
+// One console line per input stage: CPU now and the peak since the last
+// summary (AudioStream's per-object counters, in percent), "idle" while the
+// input sends nothing. The input mixers show what the idle channels save
+// downstream of the inputs themselves.
+static void printInputCpuItem(const char* name, AudioStream& stage, bool idle) {
+  Serial.printf(" %s %.2f (%.2f)%s", name, stage.processorUsage(), stage.processorUsageMax(),
+                idle ? " idle" : "");
+  stage.processorUsageMaxReset();
+}
+
+void printInputCpu() {
+  Serial.print("Input CPU % (max):");
+  printInputCpuItem("optical", Optical_in, Optical_in.idle());
+#if USB_INPUT_ASYNC
+  printInputCpuItem("usb", USB_in, USB_in.idle());
+#else
+  printInputCpuItem("usb", USB_in, false);
+#endif
+  printInputCpuItem("bt", btGate, btGate.idle());
+  printInputCpuItem("analog", analogGate, analogGate.idle());
+  printInputCpuItem("mixL", Left_mixer, false);
+  printInputCpuItem("mixR", Right_mixer, false);
+  printInputCpuItem("auxL", Left_Aux_mixer, false);
+  printInputCpuItem("auxR", Right_Aux_mixer, false);
+  Serial.println();
 }
 
 // Clear a stale output solo once the ESP's keepalives stop arriving.
@@ -683,15 +901,17 @@ void outputSoloLoop() {
 // RTA_fft at a time (its input port holds one connection), so both candidate
 // cords are torn down first. Call this whenever rtaEnabled or outputSolo
 // changes - not on every solo keepalive, since re-binding the cord restarts
-// the FFT's accumulation window.
+// the analyzer's history (the /16 stage needs ~371ms to refill).
 void updateRtaSource() {
   patchCord_RTAMixerToFFT.disconnect();
   patchCord_SoloToFFT.disconnect();
-  if (!rtaEnabled) return; // idle: leave the FFT unfed
+  RTA_fft.reset(); // no frame mixes the previous source into the slow stages
+  if (!rtaEnabled && !levelLogger.isActive()) return; // idle: leave the FFT unfed
   if (outputSolo >= 0 && outputSolo < NUM_OUTPUTS) {
     // Post-crossover, pre-PEQ - the same "pre-EQ source" semantics the input
     // scope has (it taps the source mix ahead of the input EQ), so measuring
     // with the output EQ bypassed yields the raw driver+room response.
+    // A compiled output's crossover is bypassed, so its solo is pre-crossover.
     patchCord_SoloToFFT.connect(xover[outputSolo], 0, RTA_fft, 0);
   } else {
     patchCord_RTAMixerToFFT.connect();
@@ -703,62 +923,124 @@ void setRtaEnabled(bool enabled) {
   if (enabled == rtaEnabled) return;
   rtaEnabled = enabled;
   Serial.println(enabled ? "RTA started" : "RTA stopped");
-  updateRtaSource();
+  // The level log keeps the FFT fed either way; re-binding would only
+  // restart its history
+  if (!levelLogger.isActive()) updateRtaSource();
 }
 
-// Sum FFT power over [lo,hi) Hz. Edge bins contribute proportionally to
-// their overlap with the band, so bands narrower than one ~10.8Hz bin still
-// get a sensible share instead of double-counting or reading zero.
-static float rtaBandPower(float lo, float hi) {
-  const float binWidth = RtaFFT4096::binWidthHz();
-  int first = (int)roundf(lo / binWidth);
-  int last = (int)roundf(hi / binWidth);
-  if (first < 1) first = 1; // skip the DC bin
-  if (last > RtaFFT4096::NUM_BINS - 1) last = RtaFFT4096::NUM_BINS - 1;
-  float power = 0.0f;
-  for (int i = first; i <= last; i++) {
-    float overlap = min(hi, (i + 0.5f) * binWidth) - max(lo, (i - 0.5f) * binWidth);
-    if (overlap <= 0.0f) continue;
-    power += RTA_fft.readPower(i) * (overlap / binWidth);
-  }
-  return power;
+// One band's frame byte as two hex digits: (dB + 100) * 2, clamped
+static void rtaEncodeBand(char* out, float power) {
+  static const char HEX_DIGITS[] = "0123456789abcdef";
+  float dB = (power > 1e-10f) ? 10.0f * log10f(power) : -100.0f;
+  int v = (int)roundf((dB + 100.0f) * 2.0f);
+  if (v < 0) v = 0;
+  if (v > 255) v = 255;
+  out[0] = HEX_DIGITS[v >> 4];
+  out[1] = HEX_DIGITS[v & 0x0F];
 }
 
 // While enabled, send "RTA <242 hex chars>\n" frames at ~10Hz: one byte per
 // band, value = (dB + 100) * 2, i.e. -100dB..+27.5dB in 0.5dB steps. A frame
 // is 247 bytes - the ESP's RX line buffer (RX_LINE_MAX in teensy_comm.cpp)
 // and the Serial1 TX buffer (espTxBuffer in setup) are both sized for it.
+// The level log publishes on the same cadence whether or not frames go out.
 void rtaLoop() {
-  if (!rtaEnabled) return;
-  if (millis() - rtaLastKeepaliveAt > RTA_KEEPALIVE_TIMEOUT_MS) {
+  if (rtaEnabled && millis() - rtaLastKeepaliveAt > RTA_KEEPALIVE_TIMEOUT_MS) {
     setRtaEnabled(false);
-    return;
   }
+  if (!rtaEnabled && !levelLogger.isActive()) return;
+  // Running for the log alone, the whole analysis is the log's cost
+  elapsedMicros spent;
+  rtaAnalyze();
+  if (!rtaEnabled) chargeLevelLog(spent);
+}
+
+void rtaAnalyze() {
+  // Between frames, analyze segments as they fall due - one per pass, so
+  // no single loop() iteration pays for more than one FFT
+  RTA_fft.service();
   if (millis() - rtaLastFrameAt < RTA_FRAME_INTERVAL_MS) return;
   if (!RTA_fft.available()) return;
-  RTA_fft.analyze();
 
-  static const char HEX_DIGITS[] = "0123456789abcdef";
   char frame[4 + RTA_NUM_BANDS * 2 + 1];
+  // Never block on the UART; skip the frame if the TX buffer is busy. Checked
+  // before publishing so a skipped frame's segments roll into the next one.
+  if (rtaEnabled && (size_t)Serial1.availableForWrite() < sizeof(frame)) return;
+  RTA_fft.publish();
+  rtaLastFrameAt = millis();
+
+  if (levelLogger.isActive()) {
+    elapsedMicros spent;
+    float power[RTA_NUM_BANDS];
+    for (int b = 0; b < RTA_NUM_BANDS; b++) power[b] = RTA_fft.bandPower(b);
+    levelLogAcc.addSpectrum(power, RTA_NUM_BANDS, RTA_K_LO,
+                            outputSolo >= 0 && outputSolo < NUM_OUTPUTS);
+    if (rtaEnabled) chargeLevelLog(spent); // otherwise rtaLoop charges it all
+  }
+  if (!rtaEnabled) return;
+
   memcpy(frame, "RTA ", 4);
   size_t pos = 4;
-  // Band edges are a twelfth of an octave apart: center * 10^(+/-1/80)
   for (int b = 0; b < RTA_NUM_BANDS; b++) {
-    float power = rtaBandPower(RTA_BAND_CENTERS[b] * 0.971628f,
-                               RTA_BAND_CENTERS[b] * 1.029200f);
-    float dB = (power > 1e-10f) ? 10.0f * log10f(power) : -100.0f;
-    int v = (int)roundf((dB + 100.0f) * 2.0f);
-    if (v < 0) v = 0;
-    if (v > 255) v = 255;
-    frame[pos++] = HEX_DIGITS[v >> 4];
-    frame[pos++] = HEX_DIGITS[v & 0x0F];
+    rtaEncodeBand(frame + pos, RTA_fft.bandPower(b));
+    pos += 2;
   }
   frame[pos++] = '\n';
+  Serial1.write((const uint8_t*)frame, pos);
+}
 
-  // Never block on the UART; skip the frame if the TX buffer is busy
-  if ((size_t)Serial1.availableForWrite() < pos) return;
+// Wire the bank's nine inputs while streaming, and only then: unbound, the
+// outputs spend nothing on it.
+void setRtaBankEnabled(bool enabled) {
+  rtaBankLastKeepaliveAt = millis();
+  if (enabled == rtaBankEnabled) return;
+  rtaBankEnabled = enabled;
+  if (enabled) {
+    for (int o = 0; o < NUM_OUTPUTS; o++) {
+      bankCords[o].connect(outputGain, o, RTA_bank, o);
+    }
+    bankCords[RTA_BANK_INPUT_MIX].connect(RTA_mixer, 0, RTA_bank, RTA_BANK_INPUT_MIX);
+    RTA_bank.start();
+    rtaBankNextChannel = 0;
+  } else {
+    RTA_bank.stop();
+    for (int ch = 0; ch < RTA_BANK_CHANNELS; ch++) bankCords[ch].disconnect();
+  }
+  Serial.println(enabled ? "RTAB started" : "RTAB stopped");
+}
+
+// While enabled, send "RTAB <ch> <242 hex chars>\n" frames: ch is the
+// output (0-7) or 8 for the L+R input mix, the bands are encoded as in the
+// RTA frame. 250 bytes, within the same RX/TX buffer sizing. FFTs are paced
+// by RTA_bank.service() itself (RTA_BANK_MIN_FFT_INTERVAL_US).
+void rtaBankLoop() {
+  if (!rtaBankEnabled) return;
+  if (millis() - rtaBankLastKeepaliveAt > RTA_KEEPALIVE_TIMEOUT_MS) {
+    setRtaBankEnabled(false);
+    return;
+  }
+  RTA_bank.service();
+  if (millis() - rtaBankLastFrameAt < RTA_BANK_FRAME_INTERVAL_MS) return;
+  const int ch = rtaBankNextChannel;
+  if (!RTA_bank.available(ch)) return; // its slow stage is still filling
+
+  char frame[7 + RTA_NUM_BANDS * 2 + 1];
+  if ((size_t)Serial1.availableForWrite() < sizeof(frame)) return;
+  float power[RTA_MAX_BANDS];
+  RTA_bank.publish(ch, power);
+
+  memcpy(frame, "RTAB ", 5);
+  frame[5] = (char)('0' + ch);
+  frame[6] = ' ';
+  size_t pos = 7;
+  for (int b = 0; b < RTA_NUM_BANDS; b++) {
+    rtaEncodeBand(frame + pos, power[b]);
+    pos += 2;
+  }
+  frame[pos++] = '\n';
   Serial1.write((const uint8_t*)frame, pos);
-  rtaLastFrameAt = millis();
+  rtaBankLastFrameAt = millis();
+  rtaBankNextChannel = (ch + 1) % RTA_BANK_CHANNELS;
 }
 
 // --- GRM (compressor gain-reduction meter) streaming ---
@@ -770,8 +1052,19 @@ bool grmEnabled = false;
 unsigned long grmLastKeepaliveAt = 0;
 unsigned long grmLastFrameAt = 0;
 
-// While enabled, send "GRM <6 hex chars>\n" frames at ~10Hz: one byte per
-// band, value = dB of reduction * 8 (0..31.9dB in 0.125dB steps).
+// While enabled, send "GRM <22 hex chars>\n" frames at ~10Hz: one byte per
+// compressor band, then one per output limiter (its deepest reduction since
+// the previous frame), value = dB of reduction * 8 (0..31.9dB in 0.125dB
+// steps).
+static void appendGrByte(char* frame, size_t& pos, float db) {
+  static const char HEX_DIGITS[] = "0123456789abcdef";
+  int v = (int)roundf(db * 8.0f);
+  if (v < 0) v = 0;
+  if (v > 255) v = 255;
+  frame[pos++] = HEX_DIGITS[v >> 4];
+  frame[pos++] = HEX_DIGITS[v & 0x0F];
+}
+
 void grmLoop() {
   if (!grmEnabled) return;
   if (millis() - grmLastKeepaliveAt > GRM_KEEPALIVE_TIMEOUT_MS) {
@@ -780,20 +1073,18 @@ void grmLoop() {
   }
   if (millis() - grmLastFrameAt < GRM_FRAME_INTERVAL_MS) return;
 
-  static const char HEX_DIGITS[] = "0123456789abcdef";
-  char frame[4 + COMP_NUM_BANDS * 2 + 2];
+  char frame[4 + (COMP_NUM_BANDS + NUM_OUTPUTS) * 2 + 2];
+  if ((size_t)Serial1.availableForWrite() < sizeof(frame)) return;
   memcpy(frame, "GRM ", 4);
   size_t pos = 4;
   for (int b = 0; b < COMP_NUM_BANDS; b++) {
-    int v = (int)roundf(inputComp.gainReductionDb(b) * 8.0f);
-    if (v < 0) v = 0;
-    if (v > 255) v = 255;
-    frame[pos++] = HEX_DIGITS[v >> 4];
-    frame[pos++] = HEX_DIGITS[v & 0x0F];
+    appendGrByte(frame, pos, inputComp.gainReductionDb(b));
+  }
+  for (int ch = 0; ch < NUM_OUTPUTS; ch++) {
+    appendGrByte(frame, pos, outputGain.takeLimiterReductionDb(ch));
   }
   frame[pos++] = '\n';
 
-  if ((size_t)Serial1.availableForWrite() < pos) return;
   Serial1.write((const uint8_t*)frame, pos);
   grmLastFrameAt = millis();
 }
@@ -827,7 +1118,7 @@ void vuLoop() {
   }
   if (millis() - vuLastFrameAt < VU_FRAME_INTERVAL_MS) return;
 
-  PeakMeter::Reading r = inputMeter.read();
+  PeakMeter::Reading r = takeInputPeaks();
   char frame[16];
   int len = snprintf(frame, sizeof(frame), "VU %02x%02x%x\n",
                      vuByte(r.peak[0]), vuByte(r.peak[1]),
@@ -839,83 +1130,210 @@ void vuLoop() {
   vuLastFrameAt = millis();
 }
 
-// Move 'current' toward 'target' with an exponential ramp whose speed is
-// independent of how fast loop() runs. Returns true if the value changed.
-static bool slewToward(float& current, float target, float alpha) {
-  const float MIN_CHANGE = 0.001f;
-  if (fabsf(target - current) > MIN_CHANGE) {
-    current += (target - current) * alpha;
-    return true;
+// --- Level log (long-term levels on the SD card) ---
+// Protocol: setLevelLog / getLevelLog in teensy_protocol.h; the record
+// format and decimation are LevelLog.h, the card side LevelLogger.
+
+// The input meter resets on every read and both the VU stream and the log
+// want every peak, so all reads come through here and each one also folds
+// into the log's current second.
+static PeakMeter::Reading takeInputPeaks() {
+  PeakMeter::Reading r = inputMeter.read();
+  if (levelLogger.isActive()) {
+    levelLogAcc.addPeaks(r.peak[0], r.peak[1], r.clip[0], r.clip[1]);
   }
-  if (current != target) {
-    current = target;
-    return true;
+  return r;
+}
+
+// Book loop() time against the log, for the STATS line
+static void chargeLevelLog(uint32_t us) {
+  levelLogUs += us;
+  if (us > levelLogMaxUs) levelLogMaxUs = us;
+}
+
+void sendLevelLogState() {
+  Serial1.printf("LOG STATE %d %lu %lu\n", levelLogger.isActive() ? 1 : 0,
+                 (unsigned long)levelLogger.first(), (unsigned long)levelLogger.next());
+}
+
+void setLevelLogEnabled(bool enabled) {
+  // The ESP re-sends the setting with every sync: only edges do anything
+  if (enabled == levelLogger.isActive()) return;
+  if (enabled) {
+    if (!sdReady()) {
+      Serial1.print("LOG ERR nosd\n");
+      return;
+    }
+    const char* err = levelLogger.start();
+    if (err != nullptr) {
+      Serial1.printf("LOG ERR %s\n", err);
+      return;
+    }
+    // Start the first second clean: drop whatever the meters held since
+    // boot (the VU stream loses at most one frame's peak)
+    inputMeter.read();
+    levelLogAcc.reset();
+    levelLogTickAt = levelLogGrAt = millis();
+    levelLogGap = true;
+  } else {
+    levelLogger.stop();
+  }
+  if (!rtaEnabled) updateRtaSource(); // the FFT is fed for the log alone
+  Serial.println(enabled ? "Level log started" : "Level log stopped");
+  sendLevelLogState();
+}
+
+// Send the reply to a getLevelLog as the UART has room: one point per pass,
+// each costing at most LevelLogger's per-call read budget
+static void levelLogQueryLoop() {
+  char line[20 + LevelLog::POINT_HEX_CHARS + 2]; // "LOG PT <seq> <hex>\n"
+  if ((size_t)Serial1.availableForWrite() < sizeof(line)) return;
+  LevelLog::Record point;
+  if (levelLogger.queryPoint(point)) {
+    int len = snprintf(line, sizeof(line), "LOG PT %lu ", (unsigned long)point.seq);
+    LevelLog::pointHex(point, line + len);
+    len += LevelLog::POINT_HEX_CHARS;
+    line[len++] = '\n';
+    Serial1.write((const uint8_t*)line, len);
+  }
+}
+
+// Close a record every LEVEL_LOG_INTERVAL_MS and stream query replies.
+// Everything here is charged to the log's cost.
+void levelLogLoop() {
+  const char* err = levelLogger.consumeError();
+  if (err != nullptr) {
+    // A write failure has already stopped the logger; put the FFT back the
+    // way the RTA alone wants it
+    Serial1.printf("LOG ERR %s\n", err);
+    if (!levelLogger.isActive()) {
+      if (!rtaEnabled) updateRtaSource();
+      sendLevelLogState();
+    }
+  }
+  uint32_t points;
+  if (levelLogger.consumeQueryEnd(points)) {
+    Serial1.printf("LOG END %lu\n", (unsigned long)points);
+  }
+  if (!levelLogger.isActive() && !levelLogger.queryActive()) return;
+
+  elapsedMicros spent;
+  if (levelLogger.isActive()) {
+    if (millis() - levelLogGrAt >= LEVEL_LOG_GR_SAMPLE_MS) {
+      levelLogGrAt = millis();
+      float gr[COMP_NUM_BANDS];
+      for (int b = 0; b < COMP_NUM_BANDS; b++) gr[b] = inputComp.gainReductionDb(b);
+      levelLogAcc.addGainReduction(gr, inputComp.isEnabled());
+    }
+    if (millis() - levelLogTickAt >= LEVEL_LOG_INTERVAL_MS) {
+      levelLogTickAt += LEVEL_LOG_INTERVAL_MS;
+      // loop() stalled past a whole interval (a FIR load, say): this record
+      // covers all of it and the next is marked as following a gap, rather
+      // than back-filling seconds nothing was measured in
+      const bool stalled = millis() - levelLogTickAt >= LEVEL_LOG_INTERVAL_MS;
+      if (stalled) levelLogTickAt = millis();
+      takeInputPeaks();
+      LevelLog::Record r;
+      levelLogAcc.take(r);
+      r.uptime = millis() / 1000;
+      if (levelLogGap) r.flags |= LevelLog::FLAG_GAP;
+      levelLogGap = stalled;
+      // A sector write: hold off sdReady()'s media probe past it
+      if (levelLogger.append(r)) sdLastStreamActivityMs = millis();
+    }
+  }
+  if (levelLogger.queryActive()) levelLogQueryLoop();
+  chargeLevelLog(spent);
+}
+
+// "setLevelLog <0|1>"
+void handleSetLevelLog(const String& command, String* args, int argCount, OutputStream& stream) {
+  if (argCount == 1) {
+    setLevelLogEnabled(args[0].toInt() == 1);
+  }
+}
+
+// "getLevelLog <from> <count> [step]": LOG STATE, then LOG RANGE and the
+// points as levelLogLoop() gets them out, then LOG END
+void handleGetLevelLog(const String& command, String* args, int argCount, OutputStream& stream) {
+  if (argCount < 2 || argCount > 3) return;
+  if (levelLogger.queryActive()) {
+    Serial1.print("LOG ERR busy\n");
+    return;
   }
-  return false;
+  if (!sdReady()) {
+    Serial1.print("LOG ERR nosd\n");
+    return;
+  }
+  const long count = args[1].toInt();
+  const long step = argCount == 3 ? args[2].toInt() : 1;
+  const char* err = levelLogger.beginQuery((int32_t)args[0].toInt(), count > 0 ? (uint32_t)count : 0,
+                                           step > 0 ? (uint32_t)step : 1);
+  sendLevelLogState();
+  if (err != nullptr) {
+    Serial1.printf("LOG ERR %s\n", err);
+    return;
+  }
+  const LevelLog::Range& r = levelLogger.range();
+  Serial1.printf("LOG RANGE %lu %lu %lu\n", (unsigned long)r.from, (unsigned long)r.count,
+                 (unsigned long)r.step);
 }
 
-// The gain an output's amp should settle at: output gain (dB) * master
-// volume, negated for invert, zero when muted. Smoothing rides the whole
-// product, so volume, gain, mute and invert changes are all click-free.
-// While a delay probe runs, the soloed output gets the fixed probe level
-// instead (see the probe state block above) and every other output is
-// silenced; normal targets return through the same ramp when it ends.
-static float outputTargetGain(int ch, const OutputState& o) {
+// Whether an output's parameters are overridden, and by what gain. While a
+// delay probe or IR sweep runs, the soloed output gets the fixed measurement
+// level instead (see the probe and IR state blocks above) and every other
+// output is silenced; a solo silences the rest. The gain stage's ramp rides
+// every transition, and normal targets return through it when they end.
+static bool outputOverride(int ch, const OutputState& o, float& gain) {
+  gain = 0.0f;
   // A config sync applies hundreds of commands one at a time, so until it
   // finishes every unsent value is still a boot default - master volume
   // 50%, output gain 0dB, input gains 1.0, crossovers bypassed. Opening an
   // output before its own commands land plays that default state, which is
   // both louder than intended and full-range. Hold every output at zero
-  // until the whole picture is in place; updateAudioVolume's ramp makes the
-  // release click-free.
-  if (audioHeld()) return 0.0f;
+  // until the whole picture is in place; the ramp makes the release
+  // click-free.
+  if (audioHeld()) return true;
   if (probeActive) {
-    if (ch != probeSolo) return 0.0f;
-    return o.invert ? -probeGain : probeGain;
+    if (ch == probeSolo) gain = o.invert ? -probeGain : probeGain;
+    return true;
+  }
+  if (irMeasure.isSounding()) {
+    if (ch == irSolo) gain = o.invert ? -irGain : irGain;
+    return true;
   }
   // Per-output EQ measurement: everything but the soloed output is silenced;
   // the soloed one keeps its normal product so the mic measures reality.
-  if (outputSolo >= 0 && ch != outputSolo) return 0.0f;
-  if (o.mute) return 0.0f;
-  float gain = powf(10.0f, o.gainDb / 20.0f) * state.targetVolume;
-  return o.invert ? -gain : gain;
-}
-
-// Function to smoothly update the per-output amp gains
-void updateAudioVolume() {
-  // Time constant of the ramp: ~63% of the way in RAMP_TAU_MS, settled in
-  // roughly 3x that. Time-based so SD reads etc. don't change the ramp speed.
-  const float RAMP_TAU_MS = 60.0f;
-
-  static unsigned long lastUpdate = 0;
-  unsigned long now = millis();
-  float dt = (float)(now - lastUpdate);
-  lastUpdate = now;
-  if (dt <= 0) return;
-  float alpha = dt / RAMP_TAU_MS;
-  if (alpha > 1.0f) alpha = 1.0f;
+  return outputSolo >= 0 && ch != outputSolo;
+}
 
+// Publish the overrides to the gain stage, once per loop() pass. Parameter
+// changes don't pass through here: they are scheduled as they arrive.
+void updateOutputOverrides() {
   for (int ch = 0; ch < NUM_OUTPUTS; ch++) {
-    OutputState& o = state.outputs[ch];
-    if (slewToward(o.currentGain, outputTargetGain(ch, o), alpha)) {
-      outputAmp[ch].gain(o.currentGain);
-    }
+    float gain;
+    const bool active = outputOverride(ch, state.outputs[ch], gain);
+    outputGain.setOverride(ch, active, gain);
   }
 }
 
-void updateTargetVolume() {
-  if (state.muted) {
-    float reduction = state.mutePercent / 100.0;
-    state.targetVolume = state.volume * (1.0 - reduction);
-  } else {
-    state.targetVolume = state.volume;
+// Hand a gain parameter change to the gain stage, due at the sample the
+// command was stamped with, or at the next block when it wasn't
+static void scheduleGain(GainSchedule::Param param, int ch, float value) {
+  GainSchedule::Change c;
+  if (!router.stamp(c.due)) c.due = outputGain.clock();
+  c.param = param;
+  c.ch = (uint8_t)ch;
+  c.value = value;
+  if (!outputGain.schedule(c)) {
+    Serial.println("Gain queue full - change applied at once");
   }
 }
 
 void setMute(bool mute) {
   if (mute == state.muted) return; // No change
   state.muted = mute;
-  updateTargetVolume();
+  scheduleGain(GainSchedule::Param::Muted, 0, mute ? 1.0f : 0.0f);
   Serial.println(state.muted ? "Muting audio" : "Unmuting audio");
 }
 
@@ -923,7 +1341,7 @@ void setMutePercent(float percent) {
   if (percent < 0) percent = 0;
   if (percent > 100) percent = 100;
   state.mutePercent = percent;
-  updateTargetVolume(); // Recalculate target volume if muted
+  scheduleGain(GainSchedule::Param::MutePercent, 0, percent);
   Serial.println("Set mute percent: " + String(percent));
 }
 
@@ -934,8 +1352,8 @@ void setVolume(float volume) {
 
   Serial.println("Set volume: " + String(volume) + " (log: " + String(logVolume) + ")");
   state.volume = logVolume;
-  updateTargetVolume();
-  // Do NOT apply gain directly here. It will be smoothed in updateAudioVolume().
+  // Ramped per sample by the gain stage from its due sample on
+  scheduleGain(GainSchedule::Param::Volume, 0, logVolume);
 }
 
 void setInputGains(float bluetoothGain, float opticalGain, float usbGain, float generatorGain, float analogGain) {
@@ -990,32 +1408,79 @@ void setNoise(float volumePercent) {
   pink1.amplitude(volumePercent / 100.0f);
 }
 
+// --- Measurement input isolation (delay probe, IR sweep) ---
+// Silence the external inputs and the tone/noise generators for the
+// duration (direct mixer writes; state is untouched and restored by
+// restoreMeasurementInputs), and open the measurement source's generator
+// mixer input at unity regardless of the user's generator input gain.
+void isolateMeasurementInput(int generatorInput) {
+  Left_mixer.gain(0, 0.0f);
+  Right_mixer.gain(0, 0.0f);
+  Left_mixer.gain(1, 0.0f);
+  Right_mixer.gain(1, 0.0f);
+  Left_mixer.gain(2, 0.0f);
+  Right_mixer.gain(2, 0.0f);
+  Left_Aux_mixer.gain(1, 0.0f);
+  Right_Aux_mixer.gain(1, 0.0f);
+  for (int in = 0; in < 4; in++) {
+    Generator_mixer.gain(in, in == generatorInput ? 1.0f : 0.0f);
+  }
+  Left_Aux_mixer.gain(0, 1.0f);
+  Right_Aux_mixer.gain(0, 1.0f);
+}
+
+// Reopen the tone/noise paths, close both measurement paths, and restore
+// every input-mixer gain from state (setInputGains also restores the
+// generator aux gain isolation forced to 1.0). Idempotent.
+void restoreMeasurementInputs() {
+  Generator_mixer.gain(0, 1.0f);
+  Generator_mixer.gain(1, 1.0f);
+  Generator_mixer.gain(2, 0.0f);
+  Generator_mixer.gain(3, 0.0f);
+  setInputGains(state.gainBluetooth, state.gainOptical, state.gainUSB,
+                state.gainGenerator, state.gainAnalog);
+}
+
+// Take back the per-output analyzer's arena from a measurement that
+// borrowed it (IR deconvolution, mic probe correlation) and re-plan its
+// bands, which lived there. Idempotent.
+void reclaimBankArena() {
+  if (!RTA_bank.arenaLent()) return;
+  RTA_bank.reclaimArena();
+  float lo[RTA_NUM_BANDS], hi[RTA_NUM_BANDS];
+  rtaBandEdges(lo, hi);
+  RTA_bank.setBands(lo, hi, RTA_NUM_BANDS);
+}
+
 // --- Auto delay alignment probe ---
 // Protocol and chirp contract: teensy_protocol.h. PROBE lines go straight
 // to the ESP link (Serial1), which relays them to the web UI as probeEvent
 // websocket messages.
 
-// Restore everything the probe touched and report why it ended. Idempotent;
+// End the chirp sequence and hand the inputs and outputs back. Idempotent;
 // the amp targets revert through the normal ramp, so ending is click-free.
-void probeCleanup(const char* message) {
+void probeEndSequence() {
   AudioNoInterrupts();
   probeSource.stop();
   AudioInterrupts();
   probeActive = false;
   probeSolo = -1;
   probeLastSlot = -1;
-  // Reopen the tone/noise paths, close the probe path, and restore every
-  // input-mixer gain from state (setInputGains also restores the generator
-  // aux gain the probe forced to 1.0).
-  Generator_mixer.gain(0, 1.0f);
-  Generator_mixer.gain(1, 1.0f);
-  Generator_mixer.gain(2, 0.0f);
-  setInputGains(state.gainBluetooth, state.gainOptical, state.gainUSB,
-                state.gainGenerator, state.gainAnalog);
+  restoreMeasurementInputs();
+}
+
+// Restore everything the probe touched - including a mic capture or its
+// analysis, and the bank's arena - and report why it ended. Idempotent.
+void probeCleanup(const char* message) {
+  probeEndSequence();
+  probeCapture.abort();
+  reclaimBankArena();
   if (message) Serial1.print(message);
 }
 
-void startDelayProbe(int mask, float levelPercent) {
+// mic: record the measurement mic and measure the arrivals here (PROBE
+// RESULT lines) rather than leaving it to the web UI's phone recording
+void startDelayProbe(int mask, float levelPercent, bool mic) {
   // Masked outputs ascending, then the same list reversed: the UI averages
   // each output's two arrivals to cancel linear phone-clock drift.
   int forward[NUM_OUTPUTS];
@@ -1027,7 +1492,15 @@ void startDelayProbe(int mask, float levelPercent) {
     Serial1.print("PROBE ERR emptyMask\n");
     return;
   }
-  if (probeActive) probeCleanup(nullptr); // implicit clean restart
+  // As startIrMeasure: the capture would compete with a recording for the
+  // card and for the record queues' ~150ms of buffering
+  if (mic && sdRecorder.isActive()) {
+    Serial1.print("PROBE ERR busy\n");
+    return;
+  }
+  if (probeActive || probeCapture.isActive()) probeCleanup(nullptr); // implicit clean restart
+  // One measurement at a time: both solo outputs and own the generator bus
+  if (irMeasure.isActive()) irCleanup("IR ERR aborted\n");
 
   // The probe needs silence between chirps; SD playback rides the aux
   // mixer's input 2, which the probe's input muting leaves open.
@@ -1036,37 +1509,43 @@ void startDelayProbe(int mask, float levelPercent) {
     recStateDirty = true;
   }
 
+  probeGain = constrain(levelPercent, 0.0f, 100.0f) / 100.0f;
+  if (mic) {
+    if (!sdReady()) {
+      Serial1.print("PROBE ERR nosd\n");
+      return;
+    }
+    // The correlation borrows the per-output analyzer's arena, as the IR
+    // measurement does
+    if (rtaBankEnabled) setRtaBankEnabled(false);
+    size_t floats = 0;
+    float* arena = RTA_bank.lendArena(floats);
+    // Responses read as the path at unity drive; a 0% probe only measures
+    // silence, so its scale is moot
+    const float drive = 0.5f * (probeGain > 0.01f ? probeGain : 0.01f);
+    const char* err = probeCapture.start(arena, 2 * count, 1.0f / drive);
+    if (err != nullptr) {
+      reclaimBankArena();
+      Serial1.printf("PROBE ERR %s\n", err);
+      return;
+    }
+  }
+
   probeChirps = 2 * count;
   for (int i = 0; i < count; i++) {
     probeOrder[i] = (int8_t)forward[i];
     probeOrder[probeChirps - 1 - i] = (int8_t)forward[i];
   }
 
-  // Silence the external inputs and the tone/noise generators for the
-  // duration (direct mixer writes; state is untouched and restored by
-  // probeCleanup), and open the probe path at unity regardless of the
-  // user's generator input gain.
-  Left_mixer.gain(0, 0.0f);
-  Right_mixer.gain(0, 0.0f);
-  Left_mixer.gain(1, 0.0f);
-  Right_mixer.gain(1, 0.0f);
-  Left_mixer.gain(2, 0.0f);
-  Right_mixer.gain(2, 0.0f);
-  Left_Aux_mixer.gain(1, 0.0f);
-  Right_Aux_mixer.gain(1, 0.0f);
-  Generator_mixer.gain(0, 0.0f);
-  Generator_mixer.gain(1, 0.0f);
-  Generator_mixer.gain(2, 1.0f);
-  Left_Aux_mixer.gain(0, 1.0f);
-  Right_Aux_mixer.gain(0, 1.0f);
+  isolateMeasurementInput(2);
 
-  probeGain = constrain(levelPercent, 0.0f, 100.0f) / 100.0f;
   probeSolo = probeOrder[0];
   probeLastSlot = 0;
   probeActive = true;
 
   AudioNoInterrupts();
   probeSource.start((uint8_t)probeChirps, 0.5f); // -6dBFS headroom pre-amp
+  probeCapture.beginCapture(); // no-op without mic: same update as the chirps
   AudioInterrupts();
 
   // An output routed with zero source gains can't emit the chirp - the UI
@@ -1089,9 +1568,12 @@ void startDelayProbe(int mask, float levelPercent) {
 // here is deliberately non-critical; only the chirps themselves are
 // sample-exact, and they live in ProbeSource.
 void probeLoop() {
+  probeCaptureLoop();
   if (!probeActive) return;
   if (probeSource.isFinished()) {
-    probeCleanup("PROBE DONE\n");
+    // A mic capture carries on: its last blocks, then the analysis
+    probeEndSequence();
+    Serial1.print("PROBE DONE\n");
     return;
   }
   uint32_t s = probeSource.samplesElapsed();
@@ -1107,27 +1589,170 @@ void probeLoop() {
   }
 }
 
+// Advance the mic capture/analysis and turn its events into PROBE lines.
+// An error ends the whole probe, sequence included if it is still playing.
+void probeCaptureLoop() {
+  if (!probeCapture.isActive() && !RTA_bank.arenaLent()) return;
+  probeCapture.service();
+  const char* err = probeCapture.consumeError();
+  if (err != nullptr) {
+    char line[32];
+    snprintf(line, sizeof(line), "PROBE ERR %s\n", err);
+    probeCleanup(line);
+    return;
+  }
+  int slot;
+  double lag;
+  float peakDb, confidence;
+  if (probeCapture.consumeResult(slot, lag, peakDb, confidence)) {
+    Serial1.printf("PROBE RESULT %d %d %.3f %.1f %.1f\n", slot, probeOrder[slot], lag,
+                   peakDb, confidence);
+  }
+  if (probeCapture.consumeAnalyzed()) {
+    reclaimBankArena();
+    Serial1.print("PROBE ANALYZED\n");
+  }
+}
+
+// --- Impulse response measurement ---
+// Protocol and sweep contract: teensy_protocol.h. IR lines go to the ESP
+// link, which relays them to the web UI as irEvent websocket messages.
+
+// Restore everything the measurement touched - inputs, solo, the bank's
+// arena - and report why it ended. Idempotent.
+void irCleanup(const char* message) {
+  irMeasure.abort();
+  irSolo = -1;
+  restoreMeasurementInputs();
+  reclaimBankArena();
+  if (message) Serial1.print(message);
+}
+
+void startIrMeasure(int ch, float levelPercent) {
+  if (ch < 0 || ch >= NUM_OUTPUTS) {
+    Serial1.print("IR ERR badch\n");
+    return;
+  }
+  // The capture streams to the card for ~3.6s; a recording would be
+  // competing for it and for the ~150ms the record queues can buffer
+  if (sdRecorder.isActive()) {
+    Serial1.print("IR ERR busy\n");
+    return;
+  }
+  if (irMeasure.isActive()) irCleanup(nullptr); // implicit clean restart
+  if (probeActive || probeCapture.isActive()) probeCleanup("PROBE ERR aborted irMeasure\n");
+  // Playback would ride into the capture (aux input 2 stays open) and holds
+  // the card; stopped first so sdReady()'s media probe never lands on it
+  if (sdPlayer.isActive()) {
+    sdPlayer.stop();
+    recStateDirty = true;
+  }
+  if (!sdReady()) {
+    Serial1.print("IR ERR nosd\n");
+    return;
+  }
+
+  // The deconvolution borrows the per-output analyzer's arena; its stream
+  // pauses until the run ends (handleSetRtaBank ignores keepalives meanwhile)
+  if (rtaBankEnabled) setRtaBankEnabled(false);
+  size_t floats = 0;
+  float* arena = RTA_bank.lendArena(floats);
+  static_assert(RtaBank::ARENA_FLOATS >= IrDeconvolver::ARENA_FLOATS,
+                "IR deconvolution scratch must fit the bank's arena");
+
+  // A level of 0 would divide the result by zero; 1% is -40dB, plenty low
+  irGain = constrain(levelPercent, 1.0f, 100.0f) / 100.0f;
+  const float sweepAmplitude = 0.5f; // -6dBFS headroom pre-amp, as the probe
+  const char* err = irMeasure.start(arena, sweepAmplitude, 1.0f / (sweepAmplitude * irGain));
+  if (err != nullptr) {
+    irCleanup(nullptr);
+    Serial1.printf("IR ERR %s\n", err);
+    return;
+  }
+  irSolo = ch;
+  isolateMeasurementInput(3);
+
+  // As the probe: an unrouted output measures silence, not a failure
+  const OutputState& o = state.outputs[ch];
+  if (o.sourceLeft == 0.0f && o.sourceRight == 0.0f) {
+    Serial1.printf("IR WARN unrouted %d\n", ch);
+  }
+  Serial1.printf("IR START %d %lu %lu\n", ch, (unsigned long)IR_SWEEP_SAMPLES,
+                 (unsigned long)IR_CAPTURE_SAMPLES);
+}
+
+// Advance the run and turn its events into IR lines. The inputs and solo
+// come back as soon as the capture is on the card; the deconvolution that
+// follows is silent.
+void irLoop() {
+  if (!irMeasure.isActive() && !RTA_bank.arenaLent()) return;
+  irMeasure.service();
+  if (irMeasure.consumeCaptured()) {
+    irSolo = -1;
+    restoreMeasurementInputs();
+    Serial1.print("IR CAPTURED\n");
+  }
+  int percent;
+  while ((percent = irMeasure.consumeProgress()) >= 0) {
+    Serial1.printf("IR PROGRESS %d\n", percent);
+  }
+  const char* err = irMeasure.consumeError();
+  if (err != nullptr) {
+    irCleanup(nullptr);
+    Serial1.printf("IR ERR %s\n", err);
+    return;
+  }
+  if (irMeasure.consumeDone()) {
+    char line[64];
+    snprintf(line, sizeof(line), "IR DONE %s %lu %.1f\n", irMeasure.fileName(),
+             (unsigned long)irMeasure.peakIndex(), irMeasure.peakDb());
+    irCleanup(line);
+  }
+}
+
 // --- Shared input EQ ---
 
-// Attenuate the pre-EQ amps to compensate for the maximum boost of the
-// current EQ curve, so boosted bands can't clip. Unity while the EQ is
-// bypassed ("Pure Direct" - no wasted headroom).
+// Attenuate the pre-EQ amps to compensate for the maximum boost of the EQ
+// curve at any volume, so boosted bands can't clip and the pad never steps
+// as the loudness curve follows the volume. Unity while the EQ is bypassed
+// ("Pure Direct" - no wasted headroom).
 void applyPreEQGainCompensation() {
   float padDb = 0.0f;
   if (state.inputEqEnabled) {
-    padDb = peqLeft.calculateMaxEqBoost(state.inputEqBands, MAX_PEQ_BANDS);
+    padDb = state.inputEq.maxBoostDb();
   }
   peqLeft.applyPreEQGain(padDb, Left_Pre_EQ_amp, Right_Pre_EQ_amp);
 }
 
-// Apply all bands in state.inputEqBands to both PEQ processors. Disabled
-// bands are passed through too - the processors bypass them individually.
+// Morph both PEQ processors to the curve for the current volume after an
+// edit to the sets. Disabled bands are passed through too - the processors
+// bypass them individually.
 void applyInputEqFilters(unsigned long animationDurationMs) {
-  peqLeft.animateToBands(state.inputEqBands, MAX_PEQ_BANDS, animationDurationMs);
-  peqRight.animateToBands(state.inputEqBands, MAX_PEQ_BANDS, animationDurationMs);
+  state.inputEq.track(state.volume);
+  state.inputEq.computeCoeffs(AUDIO_SAMPLE_RATE, inputEqCoeffs);
+  peqLeft.animateToBands(inputEqCoeffs.bands, MAX_PEQ_BANDS, animationDurationMs);
+  peqRight.animateToBands(inputEqCoeffs.bands, MAX_PEQ_BANDS, animationDurationMs);
   applyPreEQGainCompensation();
 }
 
+// Retune the input EQ when a volume change moves it along the loudness
+// curve. The coefficients are computed here, in loop() context, and both
+// processors take them in one AudioNoInterrupts copy; a step that lands
+// during an edit's morph waits for it to finish.
+void inputEqLoop() {
+  if (peqLeft.isAnimating() || peqRight.isAnimating()) return;
+  if (!state.inputEq.track(state.volume)) return;
+  const uint32_t start = micros();
+  if (state.inputEq.computeCoeffs(AUDIO_SAMPLE_RATE, inputEqCoeffs) > 0) {
+    AudioNoInterrupts();
+    peqLeft.loadCoeffs(inputEqCoeffs.bands, inputEqCoeffs.svf, inputEqCoeffs.active);
+    peqRight.loadCoeffs(inputEqCoeffs.bands, inputEqCoeffs.svf, inputEqCoeffs.active);
+    AudioInterrupts();
+  }
+  const uint32_t us = micros() - start;
+  if (us > inputEqMaxUs) inputEqMaxUs = us;
+}
+
 void setInputEqEnabled(bool enabled) {
   Serial.println(String("Set input EQ enabled: ") + (enabled ? "yes" : "no"));
   state.inputEqEnabled = enabled;
@@ -1143,14 +1768,8 @@ void setInputEqEnabled(bool enabled) {
   }
 }
 
-void resetInputEqBands(int fromIndex) {
-  if (fromIndex < 0) fromIndex = 0;
-  for (int i = fromIndex; i < MAX_PEQ_BANDS; i++) {
-    state.inputEqBands[i].enabled = false;
-    state.inputEqBands[i].frequency = 1000.0f;
-    state.inputEqBands[i].gain = 0.0f;
-    state.inputEqBands[i].q = 1.0f;
-  }
+void resetInputEqBands(int set, int fromIndex) {
+  state.inputEq.resetBands(set, fromIndex);
   applyInputEqFilters(EQ_MORPH_MS);
 }
 
@@ -1166,12 +1785,15 @@ void applySourceMixerGains(int ch) {
 // Recompute the shared output pad (see the declaration for the rationale)
 // and push it into every source mixer when it changed.
 void refreshOutputPad() {
-  outputPadDirty = false;
+  for (int ch = 0; ch < NUM_OUTPUTS; ch++) {
+    if (!(outputBoostStale & (1u << ch))) continue;
+    const OutputState& o = state.outputs[ch];
+    outputBoostDb[ch] = o.eqEnabled ? outputPeq[ch].calculateMaxEqBoost(o.peq, MAX_OUTPUT_PEQ) : 0.0f;
+  }
+  outputBoostStale = 0;
   float padDb = 0.0f;
   for (int ch = 0; ch < NUM_OUTPUTS; ch++) {
-    if (!state.outputs[ch].eqEnabled) continue;
-    float boost = outputPeq[ch].calculateMaxEqBoost(state.outputs[ch].peq, MAX_OUTPUT_PEQ);
-    if (boost > padDb) padDb = boost;
+    if (outputBoostDb[ch] > padDb) padDb = outputBoostDb[ch];
   }
   float padLin = (padDb > 0.0f) ? 1.0f / powf(10.0f, padDb / 20.0f) : 1.0f;
   if (padLin == outputPadLin) return;
@@ -1183,7 +1805,27 @@ void refreshOutputPad() {
 }
 
 void outputPadLoop() {
-  if (outputPadDirty) refreshOutputPad();
+  if (outputBoostStale) refreshOutputPad();
+}
+
+// Which of an output's IIR stages run live. A compiled FIR already holds the
+// crossover and PEQ, so while it is the filter playing (loaded and FIRs on)
+// both are bypassed; otherwise the crossover runs and the PEQ follows its
+// own enable.
+void applyOutputBypass(int ch) {
+  const OutputState& o = state.outputs[ch];
+  const bool compiled = state.firEnabled && o.firCompiledLoaded;
+  xover[ch].setBypass(compiled);
+  outputPeq[ch].setBypass(compiled || !o.eqEnabled);
+}
+
+// A compiled output's FIR is stale once its crossover or PEQ moves: queue a
+// recompile for when the edits stop. The live stages stay bypassed until
+// then - running them on top of the old compiled filter would apply both.
+void noteCompiledEdit(int ch) {
+  if (!state.outputs[ch].firCompiledLoaded) return;
+  firRecompilePending = true;
+  firRecompileEditAt = millis();
 }
 
 // Morph the output's PEQ to the bands in state. animateToBands disables
@@ -1191,7 +1833,8 @@ void outputPadLoop() {
 // outputs (see refreshOutputPad) so relative driver levels stay intact.
 void applyOutputEq(int ch) {
   outputPeq[ch].animateToBands(state.outputs[ch].peq, MAX_OUTPUT_PEQ, EQ_MORPH_MS);
-  outputPadDirty = true;
+  outputBoostStale |= 1u << ch;
+  noteCompiledEdit(ch);
 }
 
 void setFIREnabled(bool enabled) {
@@ -1200,6 +1843,8 @@ void setFIREnabled(bool enabled) {
 
   for (int ch = 0; ch < NUM_OUTPUTS; ch++) {
     firFilter[ch].setEnabled(enabled);
+    // A compiled output needs its IIR stages back while its FIR is off
+    applyOutputBypass(ch);
   }
 
   // FIR latency compensation only applies while the filters are active
@@ -1212,35 +1857,36 @@ void setDelaysEnabled(bool enabled) {
   applyDelays();
 }
 
-// Group delay of a linear-phase FIR filter in microseconds: (N-1)/2 samples.
-// Both FIR engines produce block-aligned output, so no engine-specific
-// processing latency needs to be added here.
-// (For minimum-phase FIR files this over-compensates; see docs/WIRING.md.)
-static float firGroupDelayUs(uint16_t taps) {
-  if (taps == 0) return 0.0f;
-  return ((taps - 1) / 2.0f) * (1000000.0f / AUDIO_SAMPLE_RATE_EXACT);
-}
-
-// Apply user delays plus automatic FIR latency alignment: every output is
-// padded so all eight share the latency of the slowest FIR filter. The
-// alignment stays active when user delays are toggled off - it corrects an
-// artifact of the FIR filters, it isn't a user delay.
+// Processing latency of one output in microseconds: its FIR's measured
+// latency (while the filters are active) plus its output limiter's
+// lookahead. The FIR figure is where the loaded file's impulse response
+// peaks (FirLatencyProbe) - (N-1)/2 for a linear-phase file, next to
+// nothing for a minimum-phase one - rather than the (N-1)/2 every file used
+// to be charged. Both FIR engines produce block-aligned output, so no
+// engine-specific processing latency needs to be added here.
+static float outputLatencyUs(int ch) {
+  const float fir = state.firEnabled ? state.outputs[ch].firLatency * (1000000.0f / AUDIO_SAMPLE_RATE_EXACT)
+                                     : 0.0f;
+  return fir + TruePeakLimiter::LATENCY * (1000000.0f / AUDIO_SAMPLE_RATE_EXACT);
+}
+
+// Apply user delays plus automatic latency alignment: every output is
+// padded so all eight share the latency of the slowest chain (the FIR group
+// delays; every output limiter adds the same lookahead, so that part never
+// needs padding). The alignment stays active when user delays are toggled
+// off - it corrects an artifact of the processing, it isn't a user delay.
 void applyDelays() {
   float maxLat = 0.0f;
-  if (state.firEnabled) {
-    for (int ch = 0; ch < NUM_OUTPUTS; ch++) {
-      float lat = firGroupDelayUs(state.outputs[ch].firTaps);
-      if (lat > maxLat) maxLat = lat;
-    }
+  for (int ch = 0; ch < NUM_OUTPUTS; ch++) {
+    float lat = outputLatencyUs(ch);
+    if (lat > maxLat) maxLat = lat;
   }
   for (int ch = 0; ch < NUM_OUTPUTS; ch++) {
-    float comp = state.firEnabled ? maxLat - firGroupDelayUs(state.outputs[ch].firTaps) : 0.0f;
+    float comp = maxLat - outputLatencyUs(ch);
     float user = state.delaysEnabled ? (float)state.outputs[ch].delayUs : 0.0f;
     outputDelay[ch].delay(0, (user + comp) / 1000.0f); // milliseconds
   }
-  if (maxLat > 0.0f) {
-    Serial.printf("FIR latency alignment: %.0f us\n", maxLat);
-  }
+  Serial.printf("Output latency alignment: %.0f us\n", maxLat);
 }
 
 // sdCardInitialized only records what happened at boot. The card can be
@@ -1249,7 +1895,8 @@ void applyDelays() {
 // nothing anywhere saying the card was gone. Re-check the media on each use
 // and re-mount when it comes back.
 //
-// EXCEPT while the recorder or player is streaming: SD.mediaPresent() probes
+// EXCEPT while the recorder, player, an IR measurement or a level-log read
+// is streaming: SD.mediaPresent() probes
 // the card with CMD13, SdFat's SDIO driver keeps a multi-block write open
 // between the recorder's sector writes, and a CMD13 issued mid-transfer
 // can't complete - status() returns 0, which mediaPresent() reads as "card
@@ -1261,7 +1908,8 @@ void applyDelays() {
 // failed write.
 #define SD_PROBE_HOLDOFF_MS 500
 static bool sdReady() {
-  if (sdRecorder.isActive() || sdPlayer.isActive() ||
+  if (sdRecorder.isActive() || sdPlayer.isActive() || irMeasure.isActive() ||
+      probeCapture.isActive() || levelLogger.queryActive() ||
       (sdLastStreamActivityMs != 0 &&
        millis() - sdLastStreamActivityMs < SD_PROBE_HOLDOFF_MS)) {
     return sdCardInitialized;
@@ -1310,7 +1958,7 @@ static void reportFirError(int ch, const char* code, const char* file) {
 // no per-channel rounding waste can exceed what was charged. Sizing for the
 // raw tap count plus one partial partition per channel instead cost 14KB
 // more, and that 14KB was the RAM2 headroom whose loss made the RTA's boot
-// allocation fail (see RtaFFT4096.cpp). The direct engine needs far less
+// allocation fail (see RtaAnalyzer.cpp). The direct engine needs far less
 // per channel, so sizing for fast convolution covers both.
 static_assert(FIR_POOL_CHARGE_QUANTUM == FirEngine::BLOCK_SAMPLES,
               "pool charging quantum must match the engine partition size");
@@ -1318,6 +1966,45 @@ static constexpr size_t FIR_ARENA_FLOATS =
     (((size_t)FIR_TAP_POOL + FirEngine::BLOCK_SAMPLES - 1) / FirEngine::BLOCK_SAMPLES) *
     FirEngine::FFT_SIZE * 2;
 DMAMEM static float firArena[FIR_ARENA_FLOATS];
+// The other fixed RAM2 reservation it has to coexist with is the audio block
+// pool (AudioMemory, 560 blocks). The RTA's rtaArena (~35KB, RtaAnalyzer.cpp)
+// and the per-output bank's rtaBankArena (~45KB, RtaBankAnalyzer.cpp) used to
+// be here too; they moved to RAM1 when the SPDIF input's resampler shrank
+// from ~194KB to ~71KB (AsyncAudioInputSPDIF), and that ~80KB paid for the
+// pool growing from 12288 taps (+48KB) and the delay blocks it needs (+80
+// blocks, ~21KB). The bank was cut to 512-point FFTs, int16 rings and band
+// accumulators to fit nine channels in its arena, and the IR measurement's
+// deconvolution and the mic probe's correlation borrow it rather than
+// adding reservations of their own; anything new here comes out of the same
+// heap headroom the USB resampler allocates from, so check the linker's
+// "free for malloc/new" before growing any of them.
+//
+// One more fixed reservation sits beside them: the float32 block pool
+// (F32_POOL_BLOCKS x 520 bytes, ~8KB) the float links between the input
+// EQ, compressor, crossovers, PEQs and FIRs draw from. Its peak use is in
+// the console's "Float32 graph" line; grow it only if that reaches the top.
+DMAMEM static audio_block_f32_t f32PoolBlocks[F32_POOL_BLOCKS];
+
+void beginFloatPool() {
+  AudioStreamF32::initializeF32(f32PoolBlocks, F32_POOL_BLOCKS);
+}
+
+// Console line on the float graph: q15<->float conversions per audio block
+// against what the same graph would cost on int16 links (each float hop
+// saves the float->q15->float round trip), since the last summary.
+void printFloatGraphStats() {
+  static uint32_t lastAt = 0;
+  const uint32_t now = millis();
+  const float blocks = (now - lastAt) * (AUDIO_SAMPLE_RATE_EXACT / AUDIO_BLOCK_SAMPLES / 1000.0f);
+  lastAt = now;
+  const uint32_t conversions = AudioStreamF32::takeConversions();
+  const uint32_t hops = AudioStreamF32::takeFloatHops();
+  if (blocks < 1.0f) return;
+  Serial.printf("Float32 graph: %.1f conversions/block (int16 links: %.1f), float blocks max %u of %u\n",
+                conversions / blocks, (conversions + 2.0f * hops) / blocks,
+                (unsigned)AudioStreamF32::poolF32().usedMax(), (unsigned)F32_POOL_BLOCKS);
+  AudioStreamF32::resetPoolF32Max();
+}
 
 // Clears every filter, so the slices of firArena they hold go unreferenced
 // before the next load re-carves it.
@@ -1325,14 +2012,36 @@ static void releaseFirBuffers() {
   for (int ch = 0; ch < NUM_OUTPUTS; ch++) {
     firFilter[ch].loadCoefficients(nullptr, 0);
     state.outputs[ch].firTaps = 0;
+    state.outputs[ch].firLatency = 0.0f;
+    state.outputs[ch].firCompiledLoaded = false;
+    applyOutputBypass(ch);
+  }
+}
+
+// The IIR cascade a compiled output folds into its FIR: what its
+// CrossoverFilter and PEQProcessor would run, built from the same state.
+static FirCompiler firCompiler;
+
+static void buildFirCascade(int ch) {
+  const OutputState& o = state.outputs[ch];
+  firCompiler.clear();
+  firCompiler.addHighpass(xoverComputeBranch(o.hpFreq, o.hpType, AUDIO_SAMPLE_RATE));
+  firCompiler.addLowpass(xoverComputeBranch(o.lpFreq, o.lpType, AUDIO_SAMPLE_RATE));
+  if (!o.eqEnabled) return;
+  for (int i = 0; i < MAX_OUTPUT_PEQ; i++) {
+    const PEQBand& b = o.peq[i];
+    if (!b.enabled || b.gain == 0.0f) continue;
+    firCompiler.addBell(peqComputeBellSvf(b.frequency, b.gain, b.q, AUDIO_SAMPLE_RATE));
   }
 }
 
 // Streams one output's file into the buffers already reserved for it. The
 // engine pulls one 128-tap partition at a time, so coefficients never exist
 // outside its buffers as more than 512 bytes of its own stack scratch, never
-// a copy of the filter. 'taps' is the count the sizing pass accepted.
-static bool fillFirChannel(int ch, uint16_t taps) {
+// a copy of the filter. 'fileTaps' is the count the sizing pass accepted;
+// a compiled output reserved 'taps' for the file plus its cascade's tail and
+// streams the file through the cascade on the way in.
+static bool fillFirChannel(int ch, uint16_t fileTaps, uint16_t taps) {
   OutputState& o = state.outputs[ch];
 
   File file = SD.open(o.firFile);
@@ -1346,14 +2055,26 @@ static bool fillFirChannel(int ch, uint16_t taps) {
 
   // prepare() is where an encoding the reader can't convert is caught; the
   // sizing pass only needed the chunk headers.
-  if (stream.begin(source, o.firFile) != (long)taps || !stream.prepare()) {
+  if (stream.begin(source, o.firFile) != (long)fileTaps || !stream.prepare()) {
     file.close();
     Serial1.printf("ERROR FIR load failed: %s (output %d)\n", o.firFile, ch);
     reportFirError(ch, "missing", o.firFile);
     return false;
   }
 
-  bool loaded = firFilter[ch].fillReserved(stream);
+  // The latency is the file's own, measured on the way in - a compiled
+  // output's crossover delays it no more than the live one did
+  FirLatencyProbe probe(stream);
+  bool loaded;
+  float truncDb = FirCompiler::TRUNCATION_NONE_DB;
+  if (o.firCompiled) {
+    buildFirCascade(ch);
+    FirCompiler::Feed feed(firCompiler, probe, fileTaps, taps);
+    loaded = firFilter[ch].fillReserved(feed);
+    if (loaded) truncDb = feed.truncationDb();
+  } else {
+    loaded = firFilter[ch].fillReserved(probe);
+  }
   file.close();
   if (!loaded) {
     Serial1.printf("ERROR FIR load failed: unreadable file %s (output %d)\n", o.firFile, ch);
@@ -1361,7 +2082,13 @@ static bool fillFirChannel(int ch, uint16_t taps) {
     return false;
   }
 
-  o.firTaps = taps;
+  o.firTaps = fileTaps;
+  o.firLatency = probe.latencySamples();
+  if (o.firCompiled) {
+    o.firCompiledLoaded = true;
+    applyOutputBypass(ch);
+    Serial1.printf("FIRC %d %u %.1f\n", ch, (unsigned)(taps - fileTaps), truncDb);
+  }
   return true;
 }
 
@@ -1389,10 +2116,13 @@ void loadFirFiles() {
   // so the slicing cannot fail either way).
   printMemoryStats("before FIR loads");
   releaseFirBuffers();
+  // Whatever a recompile was waiting for is in this load
+  firRecompilePending = false;
 
   // Pass 1: size every file (header reads only - no coefficients yet) and
   // spend the pool in channel order, so which outputs get rejected when a
   // set over-subscribes stays independent of the load order chosen below.
+  long fileTapsOf[NUM_OUTPUTS] = {0};
   long wantTaps[NUM_OUTPUTS] = {0};
   uint32_t poolUsed = 0;
   for (int ch = 0; ch < NUM_OUTPUTS; ch++) {
@@ -1422,21 +2152,29 @@ void loadFirFiles() {
       reportFirError(ch, "missing", o.firFile);
       continue;
     }
+    // A compiled output loads its file followed by the cascade's ring-out,
+    // sized here to the decay rather than always the full cap
+    long loadTaps = fileTaps;
+    if (o.firCompiled) {
+      buildFirCascade(ch);
+      loadTaps += firCompiler.tailTaps(FIR_COMPILE_TAIL_TAPS, FIR_COMPILE_FLOOR_DB);
+    }
     // Charged in whole partitions - what the arena actually spends (and how
     // the ESP accounts the pool; see FIR_POOL_CHARGE_QUANTUM). A file that
     // doesn't fit the remaining pool is rejected outright rather than
     // truncated - a shortened impulse response is a different filter, not a
     // smaller one.
-    uint32_t charged = ((uint32_t)fileTaps + FIR_POOL_CHARGE_QUANTUM - 1) /
+    uint32_t charged = ((uint32_t)loadTaps + FIR_POOL_CHARGE_QUANTUM - 1) /
                        FIR_POOL_CHARGE_QUANTUM * FIR_POOL_CHARGE_QUANTUM;
     if (charged > remaining) {
       Serial1.printf("ERROR FIR pool exceeded: %s needs %lu taps (%ld padded to whole partitions), %lu of %u left (output %d)\n",
-                     o.firFile, (unsigned long)charged, fileTaps,
+                     o.firFile, (unsigned long)charged, loadTaps,
                      (unsigned long)remaining, FIR_TAP_POOL, ch);
       reportFirError(ch, "toobig", o.firFile);
       continue;
     }
-    wantTaps[ch] = fileTaps;
+    fileTapsOf[ch] = fileTaps;
+    wantTaps[ch] = loadTaps;
     poolUsed += charged;
   }
 
@@ -1470,11 +2208,11 @@ void loadFirFiles() {
   poolUsed = 0;
   for (int ch = 0; ch < NUM_OUTPUTS; ch++) {
     if (reservedTaps[ch] == 0) continue;
-    if (fillFirChannel(ch, reservedTaps[ch])) {
+    if (fillFirChannel(ch, (uint16_t)fileTapsOf[ch], reservedTaps[ch])) {
       poolUsed += reservedTaps[ch];
-      Serial.printf("Output %d FIR loaded: %s (%u taps, pool %lu/%u)\n",
-                    ch, state.outputs[ch].firFile, reservedTaps[ch], (unsigned long)poolUsed,
-                    FIR_TAP_POOL);
+      Serial.printf("Output %d FIR loaded: %s (%u taps, latency %.1f samples, pool %lu/%u)\n",
+                    ch, state.outputs[ch].firFile, reservedTaps[ch], state.outputs[ch].firLatency,
+                    (unsigned long)poolUsed, FIR_TAP_POOL);
     }
   }
 
@@ -1503,19 +2241,22 @@ void handleSetOutputGain(const String& command, String* args, int argCount, Outp
   int ch;
   if (argCount != 2 || !parseChannel(args[0], ch)) return;
   state.outputs[ch].gainDb = constrain(args[1].toFloat(), -40.0f, 10.0f);
-  // Applied by updateAudioVolume() so the change ramps click-free
+  // The gain stage ramps it in from its due sample, click-free
+  scheduleGain(GainSchedule::Param::OutputGain, ch, state.outputs[ch].gainDb);
 }
 
 void handleSetOutputMute(const String& command, String* args, int argCount, OutputStream& stream) {
   int ch;
   if (argCount != 2 || !parseChannel(args[0], ch)) return;
   state.outputs[ch].mute = args[1].toInt() == 1;
+  scheduleGain(GainSchedule::Param::OutputMute, ch, state.outputs[ch].mute ? 1.0f : 0.0f);
 }
 
 void handleSetOutputInvert(const String& command, String* args, int argCount, OutputStream& stream) {
   int ch;
   if (argCount != 2 || !parseChannel(args[0], ch)) return;
   state.outputs[ch].invert = args[1].toInt() == 1;
+  scheduleGain(GainSchedule::Param::OutputInvert, ch, state.outputs[ch].invert ? 1.0f : 0.0f);
 }
 
 void handleSetOutputSource(const String& command, String* args, int argCount, OutputStream& stream) {
@@ -1557,6 +2298,7 @@ static void handleOutputFilter(String* args, int argCount, bool isHighpass) {
     o.lpType = type;
     xover[ch].setLowpass(freq, type);
   }
+  noteCompiledEdit(ch);
 }
 
 void handleSetOutputHp(const String& command, String* args, int argCount, OutputStream& stream) {
@@ -1595,8 +2337,9 @@ void handleSetOutputEqEnabled(const String& command, String* args, int argCount,
   if (argCount != 2 || !parseChannel(args[0], ch)) return;
   bool enabled = args[1].toInt() == 1;
   state.outputs[ch].eqEnabled = enabled;
-  outputPeq[ch].setBypass(!enabled);
-  outputPadDirty = true;
+  applyOutputBypass(ch);
+  outputBoostStale |= 1u << ch;
+  noteCompiledEdit(ch);
 }
 
 void handleResetOutputEq(const String& command, String* args, int argCount, OutputStream& stream) {
@@ -1610,19 +2353,19 @@ void handleResetOutputEq(const String& command, String* args, int argCount, Outp
   applyOutputEq(ch);
 }
 
+// "setInputEq <set> <band> <freq> <q> <gain>", or without <set> for set 0
 void handleSetInputEq(const String& command, String* args, int argCount, OutputStream& stream) {
-  if (argCount == 4) {
-    int index = args[0].toInt();
-    float frequency = args[1].toFloat();
-    float q = args[2].toFloat();
-    float gain = args[3].toFloat();
-
-    if (index >= 0 && index < MAX_PEQ_BANDS) {
+  if (argCount == 4 || argCount == 5) {
+    const int at = argCount - 4;
+    int set = at == 1 ? args[0].toInt() : 0;
+    int index = args[at].toInt();
+    float frequency = args[at + 1].toFloat();
+    float q = args[at + 2].toFloat();
+    float gain = args[at + 3].toFloat();
+
+    if (index >= 0 && index < MAX_PEQ_BANDS && set >= 0 && set < LoudnessEq::SETS) {
       // A frequency of 0 (i.e. "setInputEq n 0 0 0") disables the band
-      state.inputEqBands[index].enabled = frequency > 0.0f;
-      state.inputEqBands[index].frequency = frequency;
-      state.inputEqBands[index].q = q;
-      state.inputEqBands[index].gain = gain;
+      state.inputEq.setBand(set, index, {frequency, gain, q, frequency > 0.0f});
 
       // Morph smoothly to the new curve
       applyInputEqFilters(EQ_MORPH_MS);
@@ -1630,12 +2373,27 @@ void handleSetInputEq(const String& command, String* args, int argCount, OutputS
   }
 }
 
+// "resetInputEq <set> <fromBand>", or without <set> for set 0
 void handleResetInputEq(const String& command, String* args, int argCount, OutputStream& stream) {
   if (argCount == 1) {
-    resetInputEqBands(args[0].toInt());
+    resetInputEqBands(0, args[0].toInt());
+  } else if (argCount == 2) {
+    resetInputEqBands(args[0].toInt(), args[1].toInt());
   }
 }
 
+// "setInputEqSpl <refSpl> [<spl0> <spl1> <spl2>]": the level each set is
+// for (-1 = unused slot) and the level full volume plays at
+void handleSetInputEqSpl(const String& command, String* args, int argCount, OutputStream& stream) {
+  if (argCount < 1 || argCount > 1 + LoudnessEq::SETS) return;
+  int spl[LoudnessEq::SETS];
+  for (int i = 0; i < argCount - 1; i++) spl[i] = args[1 + i].toInt();
+  state.inputEq.setLevels(args[0].toFloat(), spl, argCount - 1);
+  Serial.printf("Input EQ: %d SPL set(s), full volume at %.1f dB SPL\n",
+                state.inputEq.activeSets(), state.inputEq.refSpl());
+  applyInputEqFilters(EQ_MORPH_MS);
+}
+
 void handleSetInputEqEnabled(const String& command, String* args, int argCount, OutputStream& stream) {
   if (argCount == 1) {
     setInputEqEnabled(args[0].toInt() == 1);
@@ -1661,6 +2419,14 @@ void handleSetFIREnabled(const String& command, String* args, int argCount, Outp
   }
 }
 
+// "setOutputFirCompiled <ch> <0|1>": fold the output's crossover and PEQ
+// into its FIR. Like setFir, it takes effect at the next loadFirFiles.
+void handleSetOutputFirCompiled(const String& command, String* args, int argCount, OutputStream& stream) {
+  int ch;
+  if (argCount != 2 || !parseChannel(args[0], ch)) return;
+  state.outputs[ch].firCompiled = args[1].toInt() == 1;
+}
+
 void handleLoadFirFiles(const String& command, String* args, int argCount, OutputStream& stream) {
   // The ESP locks preset switches and FIR edits while a recording runs, so
   // this only fires if something bypassed that lock. A FIR load stalls
@@ -1804,19 +2570,33 @@ void handleSetNoise(const String& command, String* args, int argCount, OutputStr
   }
 }
 
-// "startDelayProbe <mask> <level>" - see teensy_protocol.h for the contract
+// "startDelayProbe <mask> <level> [mic]" - see teensy_protocol.h for the contract
 void handleStartDelayProbe(const String& command, String* args, int argCount, OutputStream& stream) {
-  if (argCount == 2) {
-    startDelayProbe(args[0].toInt() & 0xFF, args[1].toFloat());
+  if (argCount == 2 || argCount == 3) {
+    startDelayProbe(args[0].toInt() & 0xFF, args[1].toFloat(),
+                    argCount == 3 && args[2].toInt() == 1);
   }
 }
 
 void handleStopDelayProbe(const String& command, String* args, int argCount, OutputStream& stream) {
-  if (probeActive) {
+  if (probeActive || probeCapture.isActive()) {
     probeCleanup("PROBE STOP\n");
   }
 }
 
+// "startIrMeasure <ch> <level>" - see teensy_protocol.h for the contract
+void handleStartIrMeasure(const String& command, String* args, int argCount, OutputStream& stream) {
+  if (argCount == 2) {
+    startIrMeasure(args[0].toInt(), args[1].toFloat());
+  }
+}
+
+void handleStopIrMeasure(const String& command, String* args, int argCount, OutputStream& stream) {
+  if (irMeasure.isActive()) {
+    irCleanup("IR STOP\n");
+  }
+}
+
 // "setRta 1" enables RTA streaming (and acts as the keepalive while it
 // repeats); "setRta 0" stops it immediately.
 void handleSetRta(const String& command, String* args, int argCount, OutputStream& stream) {
@@ -1825,6 +2605,17 @@ void handleSetRta(const String& command, String* args, int argCount, OutputStrea
   }
 }
 
+// "setRtaBank 1" enables per-output spectra (and is their keepalive);
+// "setRtaBank 0" stops them immediately.
+void handleSetRtaBank(const String& command, String* args, int argCount, OutputStream& stream) {
+  // An IR measurement or mic probe has the bank's arena; the UI's
+  // keepalives resume the stream once it ends
+  if (RTA_bank.arenaLent()) return;
+  if (argCount == 1) {
+    setRtaBankEnabled(args[0].toInt() == 1);
+  }
+}
+
 // "soloOutput <ch>" silences every other output while its keepalives stay
 // fresh; -1 (or any out-of-range channel) clears the solo immediately.
 void handleSoloOutput(const String& command, String* args, int argCount, OutputStream& stream) {
@@ -1914,12 +2705,81 @@ void handleSetPlaybackGain(const String& command, String* args, int argCount, Ou
   }
 }
 
-// Replies with the Teensy's uptime. The ESP polls this and re-syncs the DSP
-// state when uptime goes backwards (i.e. the Teensy rebooted).
+static void foldTelemetryPeaks() {
+  float cpuMax = AudioProcessorUsageMax();
+  AudioProcessorUsageMaxReset();
+  consolePeaks.cpuMax = max(consolePeaks.cpuMax, cpuMax);
+  statsPeaks.cpuMax = max(statsPeaks.cpuMax, cpuMax);
+#if USB_INPUT_ASYNC
+  uint32_t gap = USB_in.takeMaxGapUs();
+  consolePeaks.maxGapUs = max(consolePeaks.maxGapUs, gap);
+  statsPeaks.maxGapUs = max(statsPeaks.maxGapUs, gap);
+#endif
+}
+
+// Clamps a STATS float to the 7 characters STATS_LINE_MAX allows it
+static float statsFloat(float v) {
+  return v > 9999.9f ? 9999.9f : (v < -9999.9f ? -9999.9f : v);
+}
+
+// Runtime telemetry for the ESP, as "key=value" tokens so either side can
+// add or drop fields without breaking the other (teensy_protocol.h lists
+// them). Peaks cover the interval since the previous STATS line.
+static void sendStats(OutputStream& stream) {
+  foldTelemetryPeaks();
+  struct mallinfo mi = mallinfo();
+  // STATS_LINE_MAX covers the worst case of every field below (see
+  // teensy_protocol.h); recount it there before adding one
+  char buffer[STATS_LINE_MAX];
+  int len = snprintf(buffer, sizeof(buffer),
+                     "STATS cpu=%.1f cpumax=%.1f blk=%d blkmax=%d blktot=%d heap=%lu reclaim=%lu",
+                     statsFloat(AudioProcessorUsage()), statsFloat(statsPeaks.cpuMax),
+                     AudioMemoryUsage(), AudioMemoryUsageMax(), AUDIO_POOL_BLOCKS,
+                     (unsigned long)((char*)&_heap_end - __brkval), (unsigned long)mi.fordblks);
+#if USB_INPUT_ASYNC
+  if (len > 0 && len < (int)sizeof(buffer)) {
+    len += snprintf(buffer + len, sizeof(buffer) - len,
+                    " usb=%d buf=%.1f tgt=%.1f ppm=%.1f drops=%lu starves=%lu stops=%lu recov=%lu"
+                    " resyncs=%lu allocf=%lu fstops=%lu maxgap=%lu",
+                    USB_in.streaming() ? 1 : 0, statsFloat(USB_in.bufferedMs()), statsFloat(USB_in.targetMs()),
+                    statsFloat(USB_in.stepPpm()),
+                    (unsigned long)USB_in.drops(), (unsigned long)USB_in.starves(),
+                    (unsigned long)USB_in.stops(), (unsigned long)USB_in.recoveries(),
+                    (unsigned long)USB_in.resyncs(), (unsigned long)USB_in.allocFails(),
+                    (unsigned long)USB_in.falseStops(), (unsigned long)statsPeaks.maxGapUs);
+  }
+#endif
+  if (len > 0 && len < (int)sizeof(buffer)) {
+    len += snprintf(buffer + len, sizeof(buffer) - len, " log=%d logus=%lu logmax=%lu logwr=%lu",
+                    levelLogger.isActive() ? 1 : 0, (unsigned long)levelLogUs,
+                    (unsigned long)levelLogMaxUs, (unsigned long)levelLogger.takeBytesWritten());
+  }
+  if (len > 0 && len < (int)sizeof(buffer)) {
+    // The audio sample clock "@<sample>" stamps are due on
+    len += snprintf(buffer + len, sizeof(buffer) - len, " clk=%lu", (unsigned long)outputGain.clock());
+  }
+  if (len > 0 && len < (int)sizeof(buffer)) {
+    // The slowest input EQ retune; last on the line, counted in STATS_LINE_MAX
+    len += snprintf(buffer + len, sizeof(buffer) - len, " leq=%lu", (unsigned long)inputEqMaxUs);
+  }
+  levelLogUs = 0;
+  levelLogMaxUs = 0;
+  inputEqMaxUs = 0;
+  statsPeaks = TelemetryPeaks();
+  // A cut-short line would hand the ESP a wrong clk=: drop it instead
+  if (len < 0 || len >= (int)sizeof(buffer) - 1) return;
+  buffer[len++] = '\n';
+  stream.write(buffer, len);
+}
+
+// Replies with the Teensy's uptime, then a STATS line. The ESP polls this
+// every 5s and re-syncs the DSP state when uptime goes backwards (i.e. the
+// Teensy rebooted); an ESP that predates STATS just logs the extra line.
 void handlePing(const String& command, String* args, int argCount, OutputStream& stream) {
   char buffer[24];
   int len = snprintf(buffer, sizeof(buffer), "PONG %lu\n", (unsigned long)millis());
   stream.write(buffer, len);
+  sendStats(stream);
 }
 
 // --- SD recorder / player ---
@@ -1974,7 +2834,8 @@ void recorderStatusLoop() {
 
   // Feeds sdReady()'s probe hold-off (runs every loop pass, so the window
   // also covers the card finishing its final writes just after a stop)
-  if (sdRecorder.isActive() || sdPlayer.isActive()) {
+  if (sdRecorder.isActive() || sdPlayer.isActive() || irMeasure.isActive() ||
+      probeCapture.isActive() || levelLogger.queryActive()) {
     sdLastStreamActivityMs = millis();
   }
 
@@ -2038,6 +2899,12 @@ static bool validRecordingName(const String& n) {
 void handleStartRecording(const String& command, String* args, int argCount, OutputStream& stream) {
   // Recording and playback both stream the card; one at a time. Stopped
   // first so sdReady()'s media probe never lands on an open read stream.
+  // An IR measurement or mic probe streams it too, and isn't bumped by a
+  // recording.
+  if (irMeasure.isActive() || probeCapture.isActive()) {
+    Serial1.print("REC ERR busy -\n");
+    return;
+  }
   if (sdPlayer.isActive()) sdPlayer.stop();
   if (!sdReady()) {
     Serial1.print("REC ERR nosd -\n");
@@ -2064,7 +2931,7 @@ void handlePlayRecording(const String& command, String* args, int argCount, Outp
     Serial1.print("REC ERR badname -\n");
     return;
   }
-  if (sdRecorder.isActive()) {
+  if (sdRecorder.isActive() || irMeasure.isActive() || probeCapture.isActive()) {
     Serial1.printf("REC ERR busy %s\n", args[0].c_str());
     return;
   }
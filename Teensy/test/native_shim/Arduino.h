@@ -3,7 +3,8 @@
 
 // Minimal host-side stand-in for the Arduino/Teensy core, providing just
 // what the firmware sources compiled into the native test build need
-// (String, Print, HardwareSerial, Serial). Selected by [env:native]'s
+// (String, Print, HardwareSerial, Serial, the interrupt masks; AudioStream
+// lives in AudioStream.h). Selected by [env:native]'s
 // -Itest/native_shim include flag; the real Teensy build never sees it.
 
 #include <cstdint>
@@ -19,6 +20,15 @@
 #define PI 3.1415926535897932384626433832795
 #endif
 
+// Teensy 4 PROGMEM is plain memory-mapped flash; on the host it's just data
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+// The tests are single-threaded: there is no audio interrupt to mask
+inline void __disable_irq() {}
+inline void __enable_irq() {}
+
 // Serial port stand-in: tests feed the RX side with feedInput() and inspect
 // everything the code under test wrote via the 'output' string.
 class HardwareSerial : public Print {
@@ -0,0 +1,9 @@
+#ifndef NATIVE_SHIM_AUDIO_H
+#define NATIVE_SHIM_AUDIO_H
+
+// Host-side stand-in for the Audio library's umbrella header: only the
+// AudioStream core (see AudioStream.h) - no stock objects.
+
+#include "AudioStream.h"
+
+#endif // NATIVE_SHIM_AUDIO_H
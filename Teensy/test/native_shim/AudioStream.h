@@ -0,0 +1,179 @@
+#ifndef NATIVE_SHIM_AUDIO_STREAM_H
+#define NATIVE_SHIM_AUDIO_STREAM_H
+
+// Host-side stand-in for the Teensy core's AudioStream/AudioConnection,
+// for the native tests of objects built on them (AudioStreamF32). It keeps
+// the parts of the real scheduler those objects rely on: update() runs only
+// on active objects, in construction order; a connection marks both ends
+// active and counts itself in numConnections, and disconnecting the last
+// one clears active again; blocks are reference counted, and a transmit to
+// an occupied input drops the new block. update_all() runs one audio cycle
+// synchronously (on the Teensy it pends the software interrupt that does).
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "Arduino.h"
+
+#define AUDIO_BLOCK_SAMPLES 128
+#define AUDIO_SAMPLE_RATE_EXACT 44117.64706f
+#define AUDIO_SAMPLE_RATE AUDIO_SAMPLE_RATE_EXACT
+
+typedef struct audio_block_struct {
+    uint8_t ref_count;
+    uint8_t reserved1;
+    uint16_t memory_pool_index;
+    int16_t data[AUDIO_BLOCK_SAMPLES];
+} audio_block_t;
+
+class AudioConnection;
+
+class AudioStream {
+public:
+    AudioStream(unsigned char ninput, audio_block_t** iqueue)
+        : num_inputs(ninput), inputQueue(iqueue) {
+        for (unsigned char i = 0; i < ninput; i++) inputQueue[i] = nullptr;
+        AudioStream** p = &first_update;
+        while (*p != nullptr) p = &(*p)->next_update;
+        *p = this;
+    }
+
+    // The core never destroys AudioStreams; tests build them on the stack
+    virtual ~AudioStream() {
+        for (AudioStream** p = &first_update; *p != nullptr; p = &(*p)->next_update) {
+            if (*p == this) {
+                *p = next_update;
+                break;
+            }
+        }
+        for (unsigned char i = 0; i < num_inputs; i++) release(inputQueue[i]);
+    }
+
+    virtual void update() = 0;
+
+    // One audio cycle: every active object's update(), in construction order
+    static void update_all() {
+        for (AudioStream* p = first_update; p != nullptr; p = p->next_update) {
+            if (p->active) p->update();
+        }
+    }
+
+    // Blocks allocated and not yet released
+    static int blocksInUse() { return memory_used; }
+
+protected:
+    bool active = false;
+    unsigned char num_inputs;
+
+    static audio_block_t* allocate() {
+        audio_block_t* block = new audio_block_t();
+        block->ref_count = 1;
+        memory_used++;
+        return block;
+    }
+
+    static void release(audio_block_t* block) {
+        if (block == nullptr) return;
+        if (--block->ref_count > 0) return;
+        delete block;
+        memory_used--;
+    }
+
+    void transmit(audio_block_t* block, unsigned char index = 0);
+
+    audio_block_t* receiveReadOnly(unsigned int index = 0) {
+        if (index >= num_inputs) return nullptr;
+        audio_block_t* in = inputQueue[index];
+        inputQueue[index] = nullptr;
+        return in;
+    }
+
+    audio_block_t* receiveWritable(unsigned int index = 0) {
+        audio_block_t* in = receiveReadOnly(index);
+        if (in != nullptr && in->ref_count > 1) {
+            audio_block_t* copy = allocate();
+            memcpy(copy->data, in->data, sizeof(copy->data));
+            release(in);
+            in = copy;
+        }
+        return in;
+    }
+
+    friend class AudioConnection;
+    uint8_t numConnections = 0;
+
+private:
+    AudioConnection* destination_list = nullptr;
+    audio_block_t** inputQueue;
+    AudioStream* next_update = nullptr;
+    static inline AudioStream* first_update = nullptr;
+    static inline int memory_used = 0;
+};
+
+class AudioConnection {
+public:
+    AudioConnection() {}
+    AudioConnection(AudioStream& source, unsigned char sourceOutput,
+                    AudioStream& destination, unsigned char destinationInput) {
+        connect(source, sourceOutput, destination, destinationInput);
+    }
+    AudioConnection(AudioStream& source, AudioStream& destination)
+        : AudioConnection(source, 0, destination, 0) {}
+    ~AudioConnection() { disconnect(); }
+
+    int connect(AudioStream& source, unsigned char sourceOutput,
+                AudioStream& destination, unsigned char destinationInput) {
+        if (src != nullptr || destinationInput >= destination.num_inputs) return 1;
+        src = &source;
+        dst = &destination;
+        src_index = sourceOutput;
+        dest_index = destinationInput;
+        AudioConnection** p = &src->destination_list;
+        while (*p != nullptr) p = &(*p)->next_dest;
+        *p = this;
+        next_dest = nullptr;
+        src->numConnections++;
+        src->active = true;
+        dst->numConnections++;
+        dst->active = true;
+        return 0;
+    }
+
+    int disconnect() {
+        if (src == nullptr) return 1;
+        for (AudioConnection** p = &src->destination_list; *p != nullptr; p = &(*p)->next_dest) {
+            if (*p == this) {
+                *p = next_dest;
+                break;
+            }
+        }
+        AudioStream::release(dst->inputQueue[dest_index]);
+        dst->inputQueue[dest_index] = nullptr;
+        if (--src->numConnections == 0) src->active = false;
+        if (--dst->numConnections == 0) dst->active = false;
+        src = nullptr;
+        dst = nullptr;
+        return 0;
+    }
+
+private:
+    friend class AudioStream;
+    AudioStream* src = nullptr;
+    AudioStream* dst = nullptr;
+    unsigned char src_index = 0;
+    unsigned char dest_index = 0;
+    AudioConnection* next_dest = nullptr;
+};
+
+inline void AudioStream::transmit(audio_block_t* block, unsigned char index) {
+    for (AudioConnection* c = destination_list; c != nullptr; c = c->next_dest) {
+        if (c->src_index != index) continue;
+        if (c->dst->inputQueue[c->dest_index] == nullptr) {
+            c->dst->inputQueue[c->dest_index] = block;
+            block->ref_count++;
+        }
+    }
+}
+
+#endif // NATIVE_SHIM_AUDIO_STREAM_H
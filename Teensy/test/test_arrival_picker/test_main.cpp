@@ -0,0 +1,217 @@
+// ArrivalPicker tests: the delay probe's on-device analysis end to end on
+// synthetic captures - chirps placed at fractional delays (generated from
+// the sweep's closed form, so the delay is exact) go through IrDeconvolver
+// with the shipped PROBE_* window and must come back at the right lag to a
+// small fraction of a sample, whatever the polarity; a low-passed output
+// must still clear PROBE_MIN_CONFIDENCE and noise alone must not.
+
+#include <unity.h>
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "ArrivalPicker.h"
+#include "IrDeconvolver.h"
+#include "teensy_protocol.h"
+
+// --- In-memory CoeffSource with SD File semantics (as test_ir_deconvolver) ---
+class MemorySource : public CoeffSource {
+public:
+    explicit MemorySource(std::vector<uint8_t> data) : d(std::move(data)) {}
+
+    int read(void* buf, size_t len) override {
+        size_t n = d.size() - pos;
+        if (len < n) n = len;
+        memcpy(buf, d.data() + pos, n);
+        pos += n;
+        return (int)n;
+    }
+    int read() override { return pos < d.size() ? d[pos++] : -1; }
+    bool seek(uint64_t p) override {
+        if (p > d.size()) return false;
+        pos = (size_t)p;
+        return true;
+    }
+    uint64_t position() override { return pos; }
+    int available() override { return (int)(d.size() - pos); }
+    uint64_t size() override { return d.size(); }
+
+private:
+    std::vector<uint8_t> d;
+    size_t pos = 0;
+};
+
+static const uint32_t HEADER = 44;
+static const float AMP = 0.5f; // the firmware's chirp amplitude
+static const int SLOTS = 4;
+static const uint32_t CAPTURE_SAMPLES =
+    PROBE_PRE_ROLL_SAMPLES + (SLOTS - 1) * PROBE_SPACING_SAMPLES + PROBE_CHIRP_SAMPLES + PROBE_TAIL_SAMPLES;
+
+static ExpSweep probeChirp() {
+    return ExpSweep(PROBE_SAMPLE_RATE, PROBE_F0_HZ, PROBE_F1_HZ, PROBE_CHIRP_SAMPLES,
+                    PROBE_FADE_SAMPLES, PROBE_FADE_SAMPLES);
+}
+
+static uint32_t slotStart(int slot) {
+    return PROBE_PRE_ROLL_SAMPLES + (uint32_t)slot * PROBE_SPACING_SAMPLES;
+}
+
+// The chirp at continuous time t: the closed form the recurrence samples
+static double chirpAt(double t) {
+    const double N = PROBE_CHIRP_SAMPLES, F = PROBE_FADE_SAMPLES;
+    if (t < 0.0 || t > N - 1.0) return 0.0;
+    const double L = N / log(PROBE_F1_HZ / PROBE_F0_HZ);
+    const double w0 = 2.0 * M_PI * PROBE_F0_HZ / PROBE_SAMPLE_RATE;
+    const double K = w0 / (exp(1.0 / L) - 1.0);
+    double w = 1.0;
+    if (t < F) w = 0.5 * (1.0 - cos(M_PI * t / F));
+    else if (t > N - 1.0 - F) w = 0.5 * (1.0 - cos(M_PI * (N - 1.0 - t) / F));
+    return w * sin(K * (exp(t / L) - 1.0));
+}
+
+static uint32_t rngState = 1;
+static double rngGauss() { // sum of uniforms, unit variance
+    double s = 0.0;
+    for (int i = 0; i < 12; i++) {
+        rngState ^= rngState << 13;
+        rngState ^= rngState >> 17;
+        rngState ^= rngState << 5;
+        s += (rngState >> 8) / 16777216.0;
+    }
+    return s - 6.0;
+}
+
+// One arrival per slot (delay in samples after the slot's start, gain;
+// gain 0 leaves the slot silent), plus white noise at noiseRms, as int16
+struct Arrival { double delay; double gain; };
+static std::vector<float> arrivals(const std::vector<Arrival>& slots) {
+    std::vector<float> c(CAPTURE_SAMPLES, 0.0f);
+    for (int k = 0; k < (int)slots.size(); k++) {
+        if (slots[k].gain == 0.0) continue;
+        const uint32_t s0 = slotStart(k);
+        const uint32_t first = s0 + (uint32_t)floor(slots[k].delay);
+        for (uint32_t n = first; n < first + PROBE_CHIRP_SAMPLES + 2; n++) {
+            c[n] += (float)(AMP * slots[k].gain * chirpAt((double)n - s0 - slots[k].delay));
+        }
+    }
+    return c;
+}
+
+static std::vector<uint8_t> toWav(const std::vector<float>& c, double noiseRms, uint32_t seed) {
+    rngState = seed;
+    std::vector<uint8_t> bytes(HEADER + 2 * c.size(), 0);
+    for (size_t i = 0; i < c.size(); i++) {
+        const double v = (c[i] + noiseRms * rngGauss()) * 32767.0;
+        const int16_t s = (int16_t)lrint(v > 32767.0 ? 32767.0 : (v < -32768.0 ? -32768.0 : v));
+        memcpy(&bytes[HEADER + 2 * i], &s, 2);
+    }
+    return bytes;
+}
+
+static std::vector<float> arena(IrDeconvolver::ARENA_FLOATS);
+static IrDeconvolver deconv;
+static ArrivalPicker picker;
+
+// The firmware's per-slot loop
+static void analyzeSlot(MemorySource& src, int slot) {
+    deconv.begin(probeChirp(), arena.data(), src, HEADER, CAPTURE_SAMPLES,
+                 PROBE_LAG_PRE_SAMPLES, PROBE_LAG_WINDOW_SAMPLES, 1.0f / AMP, slotStart(slot));
+    picker.begin(PROBE_LAG_PRE_SAMPLES, PROBE_LAG_WINDOW_SAMPLES);
+    while (!deconv.done() && !deconv.failed()) {
+        if (deconv.step()) picker.push(deconv.output(), IrDeconvolver::PART);
+    }
+}
+
+static double db(double v) { return 20.0 * log10(v); }
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void test_parabola_spans_push_boundaries(void) {
+    // A sampled parabola peaking at 100.3 (lag 96.3 with pre 4), pushed in
+    // pieces that split the peak from both its neighbours
+    std::vector<float> h(256);
+    for (int i = 0; i < 256; i++) h[i] = (float)(1.0 - 0.01 * (i - 100.3) * (i - 100.3));
+    for (int i = 0; i < 256; i++) if (h[i] < 0.0f) h[i] = 0.0f;
+    picker.begin(4, 256);
+    picker.push(h.data(), 100);
+    picker.push(h.data() + 100, 1);
+    picker.push(h.data() + 101, 155);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4, 96.3, picker.lag());
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 1.0f, picker.peak());
+}
+
+static void test_fractional_delays_come_back_to_a_fraction_of_a_sample(void) {
+    const std::vector<Arrival> slots = {{1000.0, 1.0}, {1000.25, 0.5}, {1000.5, 0.25}, {1333.75, 1.0}};
+    MemorySource src(toWav(arrivals(slots), 1e-4, 7));
+    double unityDb = 0.0;
+    for (int k = 0; k < SLOTS; k++) {
+        analyzeSlot(src, k);
+        TEST_ASSERT_FALSE(deconv.failed());
+        TEST_ASSERT_FLOAT_WITHIN(0.05, slots[k].delay, picker.lag());
+        // Levels track the path gain (the peak of a 60Hz-8kHz delta is
+        // itself well under 1), far above the noise
+        if (k == 0) unityDb = db(picker.peak());
+        TEST_ASSERT_FLOAT_WITHIN(0.5, db(slots[k].gain), db(picker.peak()) - unityDb);
+        TEST_ASSERT_TRUE(picker.confidence() > 10.0f * PROBE_MIN_CONFIDENCE);
+    }
+}
+
+static void test_inverted_output_picks_the_same_lag(void) {
+    const std::vector<Arrival> slots = {{2000.4, 1.0}, {2000.4, -1.0}};
+    MemorySource src(toWav(arrivals(slots), 1e-4, 11));
+    analyzeSlot(src, 0);
+    const double normal = picker.lag();
+    analyzeSlot(src, 1);
+    TEST_ASSERT_FLOAT_WITHIN(0.01, normal, picker.lag());
+    TEST_ASSERT_FLOAT_WITHIN(0.05, 2000.4, picker.lag());
+}
+
+static void test_negative_lags_are_in_the_window(void) {
+    // A chirp landing early (the schedule's reference is later than the
+    // path, which only happens for a mis-scheduled capture) still shows
+    const std::vector<Arrival> slots = {{0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}};
+    std::vector<float> c = arrivals(slots);
+    const uint32_t early = slotStart(1) - 300;
+    for (uint32_t n = 0; n < PROBE_CHIRP_SAMPLES; n++) c[early + n] += (float)(AMP * chirpAt(n));
+    MemorySource src(toWav(c, 1e-4, 13));
+    analyzeSlot(src, 1);
+    TEST_ASSERT_FLOAT_WITHIN(0.05, -300.0, picker.lag());
+}
+
+static void test_lowpassed_output_clears_the_threshold_and_noise_does_not(void) {
+    // A subwoofer: the arrival through a 2nd-order 120Hz low-pass, in noise
+    // 40dB below the chirp; an unrouted slot next to it is noise alone
+    const std::vector<Arrival> slots = {{1500.0, 1.0}, {0.0, 0.0}};
+    std::vector<float> c = arrivals(slots);
+    const double w = 2.0 * M_PI * 120.0 / PROBE_SAMPLE_RATE;
+    const double alpha = sin(w) / (2.0 * M_SQRT1_2);
+    const double a0 = 1.0 + alpha;
+    const double b0 = (1.0 - cos(w)) / 2.0 / a0, b1 = (1.0 - cos(w)) / a0, b2 = b0;
+    const double a1 = -2.0 * cos(w) / a0, a2 = (1.0 - alpha) / a0;
+    double x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (uint32_t n = slotStart(0); n < slotStart(1); n++) {
+        const double x = c[n];
+        const double y = b0 * x + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2;
+        x2 = x1; x1 = x; y2 = y1; y1 = y;
+        c[n] = (float)y;
+    }
+    MemorySource src(toWav(c, AMP * 0.01, 17));
+    analyzeSlot(src, 0);
+    TEST_ASSERT_TRUE(picker.confidence() >= PROBE_MIN_CONFIDENCE);
+    // The low-pass's group delay puts the peak a couple of ms late
+    TEST_ASSERT_TRUE(picker.lag() > 1500.0 && picker.lag() < 1500.0 + 0.005 * PROBE_SAMPLE_RATE);
+    analyzeSlot(src, 1);
+    TEST_ASSERT_TRUE(picker.confidence() < PROBE_MIN_CONFIDENCE);
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_parabola_spans_push_boundaries);
+    RUN_TEST(test_fractional_delays_come_back_to_a_fraction_of_a_sample);
+    RUN_TEST(test_inverted_output_picks_the_same_lag);
+    RUN_TEST(test_negative_lags_are_in_the_window);
+    RUN_TEST(test_lowpassed_output_clears_the_threshold_and_noise_does_not);
+    return UNITY_END();
+}
@@ -0,0 +1,176 @@
+// AudioStreamF32 tests, on the host AudioStream (test/native_shim): an
+// object reached only by float links is scheduled and gets its block
+// unconverted, past full scale included; it stops being scheduled when its
+// last link goes, but not while an int16 link remains; a float output with
+// no float link reaches an int16 consumer as q15; every block goes back to
+// its pool.
+
+#include <unity.h>
+
+#include "AudioStreamF32.h"
+
+namespace {
+
+audio_block_f32_t poolBlocks[8];
+
+// Sends a ramp that peaks past full scale, as float
+class RampSource : public AudioStreamF32 {
+public:
+    RampSource() : AudioStreamF32(0, nullptr, nullptr) {}
+    void update() override {
+        updates++;
+        audio_block_f32_t* block = allocateF32();
+        if (block == nullptr) return;
+        for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) block->data[i] = 1.5f * i / (AUDIO_BLOCK_SAMPLES - 1);
+        transmitF32(block);
+        releaseF32(block);
+    }
+    int updates = 0;
+};
+
+// Forwards whatever arrives, as the bypassed Vybes objects do
+class Relay : public AudioStreamF32 {
+public:
+    Relay() : AudioStreamF32(1, inputQueueArray, floatQueueArray) {}
+    void update() override {
+        updates++;
+        passThrough(0, 0);
+    }
+    int updates = 0;
+
+private:
+    audio_block_t* inputQueueArray[1];
+    audio_block_f32_t* floatQueueArray[1];
+};
+
+// Keeps the last float block it was handed
+class FloatSink : public AudioStreamF32 {
+public:
+    FloatSink() : AudioStreamF32(1, inputQueueArray, floatQueueArray) {}
+    void update() override {
+        updates++;
+        audio_block_f32_t* block = receiveF32(0);
+        if (block == nullptr) return;
+        memcpy(last, block->data, sizeof(last));
+        received++;
+        releaseF32(block);
+    }
+    int updates = 0;
+    int received = 0;
+    float last[AUDIO_BLOCK_SAMPLES] = {};
+
+private:
+    audio_block_t* inputQueueArray[1];
+    audio_block_f32_t* floatQueueArray[1];
+};
+
+// A stock int16 consumer
+class Int16Sink : public AudioStream {
+public:
+    Int16Sink() : AudioStream(1, inputQueueArray) {}
+    void update() override {
+        audio_block_t* block = receiveReadOnly(0);
+        if (block == nullptr) return;
+        memcpy(last, block->data, sizeof(last));
+        received++;
+        release(block);
+    }
+    int received = 0;
+    int16_t last[AUDIO_BLOCK_SAMPLES] = {};
+
+private:
+    audio_block_t* inputQueueArray[1];
+};
+
+} // namespace
+
+void setUp() {
+    AudioStreamF32::initializeF32(poolBlocks, 8);
+    AudioStreamF32::takeConversions();
+    AudioStreamF32::takeFloatHops();
+}
+
+void tearDown() {}
+
+static void test_float_only_object_is_updated() {
+    RampSource source;
+    Relay relay;
+    FloatSink sink;
+    AudioStream::update_all();
+    TEST_ASSERT_EQUAL_INT(0, relay.updates); // nothing links it yet
+
+    AudioConnectionF32 in(source, 0, relay, 0);
+    AudioConnectionF32 out(relay, 0, sink, 0);
+    AudioStream::update_all();
+    TEST_ASSERT_EQUAL_INT(1, source.updates);
+    TEST_ASSERT_EQUAL_INT(1, relay.updates);
+    TEST_ASSERT_EQUAL_INT(1, sink.received);
+    // Float end to end: the top of the ramp isn't clipped to q15
+    TEST_ASSERT_EQUAL_FLOAT(1.5f, sink.last[AUDIO_BLOCK_SAMPLES - 1]);
+    TEST_ASSERT_EQUAL_UINT32(0, AudioStreamF32::takeConversions());
+    TEST_ASSERT_EQUAL_UINT32(2, AudioStreamF32::takeFloatHops());
+    TEST_ASSERT_EQUAL_UINT16(0, AudioStreamF32::poolF32().used());
+
+    // The last link gone, the scheduler drops it again
+    in.disconnect();
+    out.disconnect();
+    AudioStream::update_all();
+    TEST_ASSERT_EQUAL_INT(1, relay.updates);
+    TEST_ASSERT_EQUAL_INT(1, source.updates);
+}
+
+static void test_int16_link_keeps_it_scheduled() {
+    RampSource source;
+    Relay relay;
+    Int16Sink sink;
+    AudioConnectionF32 in(source, 0, relay, 0);
+    AudioConnection out(relay, 0, sink, 0);
+    AudioStream::update_all();
+    TEST_ASSERT_EQUAL_INT(1, relay.updates);
+    TEST_ASSERT_EQUAL_INT(1, sink.received);
+    // No float link on the relay's output: q15 for the stock consumer,
+    // saturated at full scale
+    TEST_ASSERT_EQUAL_INT16(32767, sink.last[AUDIO_BLOCK_SAMPLES - 1]);
+    TEST_ASSERT_EQUAL_UINT32(1, AudioStreamF32::takeConversions());
+
+    // Dropping the float link leaves the int16 one: still scheduled
+    in.disconnect();
+    AudioStream::update_all();
+    TEST_ASSERT_EQUAL_INT(2, relay.updates);
+    TEST_ASSERT_EQUAL_INT(1, source.updates); // only linked by the float cord
+
+    out.disconnect();
+    AudioStream::update_all();
+    TEST_ASSERT_EQUAL_INT(2, relay.updates);
+    TEST_ASSERT_EQUAL_INT(0, AudioStream::blocksInUse());
+    TEST_ASSERT_EQUAL_UINT16(0, AudioStreamF32::poolF32().used());
+}
+
+static void test_moving_link_follows_its_destination() {
+    // The solo tap: one float cord rebound between sources, the analyzer
+    // on the end linked by nothing else
+    RampSource a;
+    RampSource b;
+    FloatSink sink;
+    AudioConnectionF32 tap;
+    tap.connect(a, 0, sink, 0);
+    AudioStream::update_all();
+    TEST_ASSERT_EQUAL_INT(1, sink.received);
+    tap.connect(b, 0, sink, 0);
+    AudioStream::update_all();
+    TEST_ASSERT_EQUAL_INT(2, sink.received);
+    TEST_ASSERT_EQUAL_INT(1, a.updates); // unlinked by the rebind
+    TEST_ASSERT_EQUAL_INT(1, b.updates);
+    tap.disconnect();
+    AudioStream::update_all();
+    TEST_ASSERT_EQUAL_INT(2, sink.updates);
+    TEST_ASSERT_EQUAL_UINT16(0, AudioStreamF32::poolF32().used());
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_float_only_object_is_updated);
+    RUN_TEST(test_int16_link_keeps_it_scheduled);
+    RUN_TEST(test_moving_link_follows_its_destination);
+    return UNITY_END();
+}
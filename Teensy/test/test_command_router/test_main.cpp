@@ -149,6 +149,44 @@ static void test_unknown_command_not_dispatched(void) {
     TEST_ASSERT_EQUAL_INT(0, dispatchCount);
 }
 
+// --- "@<sample>" stamps ---
+
+static void test_stamped_command_dispatches_with_its_stamp(void) {
+    resetCapture();
+    SerialCommandRouter router(testPort);
+    bool stamped = false;
+    uint32_t sample = 0;
+    router.on("setVolume", [&](const String& c, String* a, int n, OutputStream& o) {
+        captureHandler(c, a, n, o);
+        stamped = router.stamp(sample);
+    });
+    CaptureStream out;
+    router.processCommand(String("@4294967295 setVolume 0.5"), out);
+    TEST_ASSERT_EQUAL_INT(1, dispatchCount);
+    TEST_ASSERT_EQUAL_STRING("setVolume", lastCommand.c_str());
+    TEST_ASSERT_EQUAL_INT(1, (int)lastArgs.size());
+    TEST_ASSERT_EQUAL_STRING("0.5", lastArgs[0].c_str());
+    TEST_ASSERT_TRUE(stamped);
+    TEST_ASSERT_EQUAL_UINT32(4294967295u, sample);
+
+    // The next, unstamped command doesn't inherit it
+    router.processCommand(String("setVolume 0.25"), out);
+    TEST_ASSERT_EQUAL_INT(2, dispatchCount);
+    TEST_ASSERT_FALSE(stamped);
+}
+
+static void test_malformed_stamp_drops_the_command(void) {
+    resetCapture();
+    SerialCommandRouter router(testPort);
+    router.on("setMute", captureHandler);
+    CaptureStream out;
+    router.processCommand(String("@12x4 setMute 1"), out);
+    router.processCommand(String("@ setMute 1"), out);
+    router.processCommand(String("@4294967296 setMute 1"), out); // past u32
+    router.processCommand(String("@1200"), out);
+    TEST_ASSERT_EQUAL_INT(0, dispatchCount);
+}
+
 // --- loop() line framing ---
 
 static void test_loop_dispatches_newline_terminated_lines(void) {
@@ -215,6 +253,8 @@ int main(int, char**) {
     RUN_TEST(test_process_command_repeated_spaces_between_args);
     RUN_TEST(test_process_command_is_case_insensitive);
     RUN_TEST(test_unknown_command_not_dispatched);
+    RUN_TEST(test_stamped_command_dispatches_with_its_stamp);
+    RUN_TEST(test_malformed_stamp_drops_the_command);
     RUN_TEST(test_loop_dispatches_newline_terminated_lines);
     RUN_TEST(test_loop_ignores_carriage_returns);
     RUN_TEST(test_loop_skips_blank_lines);
@@ -0,0 +1,252 @@
+// SnapshotCell (ESP/esp-web-server/snapshot_cell.h), the copy-on-write
+// snapshot the web handlers read current_config through. Covers the
+// semantics the handlers rely on - no rebuild without a write, a held
+// snapshot never changes under its reader, concurrent readers never see a
+// half-copied state - and benchmarks the reason it exists: with two handler
+// tasks (HTTP + HTTPS) serializing config while a writer mutates it, the
+// writer's lock wait should stop scaling with the readers' serialize+send
+// time. The benchmark reports its timings without asserting on them (host
+// wall-clock time varies with load); under that load it still checks that
+// no snapshot read comes back torn.
+
+#include <unity.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "snapshot_cell.h" // the ESP side (via -I../ESP/esp-web-server)
+
+// Stand-in for ConfigSnapshot: every field holds the same counter, so a copy
+// torn by a concurrent write shows up as fields that disagree.
+struct State {
+    static const int kFields = 256;
+    uint32_t fields[kFields];
+    State() { std::fill(fields, fields + kFields, 0u); }
+    bool consistent() const {
+        for (int i = 1; i < kFields; i++) {
+            if (fields[i] != fields[0]) return false;
+        }
+        return true;
+    }
+};
+
+// The live state and its lock - current_config and configMutex
+static State live;
+static std::mutex liveMutex;
+
+static void writeLive(uint32_t value) {
+    std::lock_guard<std::mutex> guard(liveMutex);
+    std::fill(live.fields, live.fields + State::kFields, value);
+}
+
+static void fillFromLive(State& out) {
+    std::lock_guard<std::mutex> guard(liveMutex);
+    out = live;
+}
+
+void setUp(void) { writeLive(0); }
+void tearDown(void) {}
+
+static void test_reads_without_writes_share_one_copy(void) {
+    SnapshotCell<State> cell;
+    auto a = cell.get(fillFromLive);
+    auto b = cell.get(fillFromLive);
+    TEST_ASSERT_NOT_NULL(a.get());
+    TEST_ASSERT_TRUE(a.get() == b.get());
+    TEST_ASSERT_EQUAL_UINT32(1, cell.rebuilds());
+}
+
+static void test_invalidate_rebuilds_once(void) {
+    SnapshotCell<State> cell;
+    auto before = cell.get(fillFromLive);
+    writeLive(7);
+    cell.invalidate();
+    auto after = cell.get(fillFromLive);
+    auto again = cell.get(fillFromLive);
+    TEST_ASSERT_EQUAL_UINT32(7, after->fields[0]);
+    TEST_ASSERT_TRUE(after.get() == again.get());
+    TEST_ASSERT_EQUAL_UINT32(2, cell.rebuilds());
+}
+
+static void test_held_snapshot_is_unchanged_by_later_writes(void) {
+    SnapshotCell<State> cell;
+    writeLive(3);
+    auto held = cell.get(fillFromLive);
+    for (uint32_t v = 4; v < 10; v++) {
+        writeLive(v);
+        cell.invalidate();
+        cell.get(fillFromLive);
+    }
+    TEST_ASSERT_EQUAL_UINT32(3, held->fields[0]);
+    TEST_ASSERT_TRUE(held->consistent());
+    TEST_ASSERT_EQUAL_UINT32(9, cell.get(fillFromLive)->fields[0]);
+}
+
+// A write that lands after the generation is read but before the reader's
+// copy must not leave that copy published as current.
+static void test_write_during_fill_is_not_lost(void) {
+    SnapshotCell<State> cell;
+    writeLive(0);
+    cell.get(fillFromLive);
+    cell.invalidate();
+    auto racing = cell.get([&](State& out) {
+        fillFromLive(out);
+        writeLive(42);      // the write...
+        cell.invalidate();  // ...and its invalidate, mid-rebuild
+    });
+    TEST_ASSERT_EQUAL_UINT32(0, racing->fields[0]);
+    TEST_ASSERT_EQUAL_UINT32(42, cell.get(fillFromLive)->fields[0]);
+}
+
+static void test_concurrent_readers_see_consistent_snapshots(void) {
+    SnapshotCell<State> cell;
+    std::atomic<bool> stop{false};
+    std::atomic<int> torn{0};
+    std::atomic<int> backwards{0};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; r++) {
+        readers.emplace_back([&]() {
+            uint32_t last = 0;
+            while (!stop.load()) {
+                auto snap = cell.get(fillFromLive);
+                if (!snap->consistent()) torn++;
+                // Not strictly monotonic across readers, but one reader
+                // must never be handed an older state than it already saw.
+                if (snap->fields[0] < last) backwards++;
+                last = snap->fields[0];
+            }
+        });
+    }
+    for (uint32_t v = 1; v <= 2000; v++) {
+        writeLive(v);
+        cell.invalidate();
+    }
+    stop = true;
+    for (auto& t : readers) t.join();
+
+    TEST_ASSERT_EQUAL_INT(0, torn.load());
+    TEST_ASSERT_EQUAL_INT(0, backwards.load());
+    TEST_ASSERT_EQUAL_UINT32(2000, cell.get(fillFromLive)->fields[0]);
+}
+
+// --- benchmark ---
+
+using Clock = std::chrono::steady_clock;
+
+static uint32_t micros_since(Clock::time_point start) {
+    return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+}
+
+// What a GET handler does with the config once it has it: serialize and
+// send. 300us is conservative for a preset on the ESP32; the point is only
+// that it dwarfs the copy.
+static void simulateSerializeAndSend(const State& s) {
+    volatile uint32_t sink = 0;
+    auto start = Clock::now();
+    while (micros_since(start) < 300) {
+        for (int i = 0; i < State::kFields; i++) sink += s.fields[i];
+    }
+    (void)sink;
+}
+
+struct BenchResult {
+    uint32_t writerP50, writerP99;
+    uint32_t readerP50, readerP99;
+    uint32_t reads;
+    uint32_t torn;
+};
+
+static uint32_t percentile(std::vector<uint32_t>& v, int pct) {
+    if (v.empty()) return 0;
+    std::sort(v.begin(), v.end());
+    return v[std::min(v.size() - 1, v.size() * pct / 100)];
+}
+
+// Two reader threads (the HTTP and HTTPS httpd tasks) and one writer (the
+// loop task applying UI edits) for a fixed wall time.
+static BenchResult runBench(bool useSnapshot) {
+    SnapshotCell<State> cell;
+    std::atomic<bool> stop{false};
+    std::mutex statsMutex;
+    std::vector<uint32_t> readerUs, writerWaitUs;
+    std::atomic<uint32_t> torn{0};
+
+    auto reader = [&]() {
+        std::vector<uint32_t> mine;
+        while (!stop.load()) {
+            auto start = Clock::now();
+            if (useSnapshot) {
+                auto snap = cell.get(fillFromLive);
+                if (!snap->consistent()) torn++;
+                simulateSerializeAndSend(*snap);
+            } else {
+                std::lock_guard<std::mutex> guard(liveMutex);
+                simulateSerializeAndSend(live);
+            }
+            mine.push_back(micros_since(start));
+        }
+        std::lock_guard<std::mutex> guard(statsMutex);
+        readerUs.insert(readerUs.end(), mine.begin(), mine.end());
+    };
+
+    std::thread httpTask(reader);
+    std::thread httpsTask(reader);
+
+    uint32_t value = 1;
+    auto benchStart = Clock::now();
+    while (micros_since(benchStart) < 250000) {
+        auto start = Clock::now();
+        writeLive(value++);
+        writerWaitUs.push_back(micros_since(start));
+        cell.invalidate();
+        std::this_thread::sleep_for(std::chrono::microseconds(500));
+    }
+    stop = true;
+    httpTask.join();
+    httpsTask.join();
+
+    BenchResult r;
+    r.reads = (uint32_t)readerUs.size();
+    r.torn = torn.load();
+    r.writerP50 = percentile(writerWaitUs, 50);
+    r.writerP99 = percentile(writerWaitUs, 99);
+    r.readerP50 = percentile(readerUs, 50);
+    r.readerP99 = percentile(readerUs, 99);
+    return r;
+}
+
+static void test_benchmark_writer_wait_under_reader_load(void) {
+    BenchResult locked = runBench(false);
+    BenchResult snap = runBench(true);
+
+    char msg[160];
+    snprintf(msg, sizeof(msg), "lock-held reads: writer wait p50=%uus p99=%uus, reader p50=%uus p99=%uus, %u reads",
+             locked.writerP50, locked.writerP99, locked.readerP50, locked.readerP99, locked.reads);
+    TEST_MESSAGE(msg);
+    snprintf(msg, sizeof(msg), "snapshot reads:  writer wait p50=%uus p99=%uus, reader p50=%uus p99=%uus, %u reads",
+             snap.writerP50, snap.writerP99, snap.readerP50, snap.readerP99, snap.reads);
+    TEST_MESSAGE(msg);
+
+    // Holding the lock across a 300us serialize makes the writer wait on the
+    // order of that, and copying under it should come in well below - but
+    // only hardware numbers can say so; here the timings are reported only
+    TEST_ASSERT_TRUE(snap.reads > 0);
+    TEST_ASSERT_EQUAL_UINT32(0, snap.torn);
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_reads_without_writes_share_one_copy);
+    RUN_TEST(test_invalidate_rebuilds_once);
+    RUN_TEST(test_held_snapshot_is_unchanged_by_later_writes);
+    RUN_TEST(test_write_during_fill_is_not_lost);
+    RUN_TEST(test_concurrent_readers_see_consistent_snapshots);
+    RUN_TEST(test_benchmark_writer_wait_under_reader_load);
+    return UNITY_END();
+}
@@ -0,0 +1,77 @@
+// F32BlockPool tests: allocation to exhaustion and the failure count,
+// reference counting (a shared block comes back only on its last release),
+// reuse of returned blocks, and the usage peak.
+
+#include <unity.h>
+
+#include "F32BlockPool.h"
+
+namespace {
+
+const uint16_t COUNT = 4;
+F32BlockPool::Block storage[COUNT];
+
+} // namespace
+
+void setUp() {}
+void tearDown() {}
+
+static void test_allocates_every_block_then_fails() {
+    F32BlockPool pool;
+    pool.begin(storage, COUNT);
+    F32BlockPool::Block* got[COUNT];
+    for (uint16_t i = 0; i < COUNT; i++) {
+        got[i] = pool.allocate();
+        TEST_ASSERT_NOT_NULL(got[i]);
+        TEST_ASSERT_EQUAL_UINT8(1, got[i]->refCount);
+        for (uint16_t j = 0; j < i; j++) TEST_ASSERT_TRUE(got[i] != got[j]);
+    }
+    TEST_ASSERT_EQUAL_UINT16(COUNT, pool.used());
+    TEST_ASSERT_NULL(pool.allocate());
+    TEST_ASSERT_NULL(pool.allocate());
+    TEST_ASSERT_EQUAL_UINT32(2, pool.allocFails());
+    for (uint16_t i = 0; i < COUNT; i++) pool.release(got[i]);
+    TEST_ASSERT_EQUAL_UINT16(0, pool.used());
+}
+
+static void test_shared_block_returns_on_last_release() {
+    F32BlockPool pool;
+    pool.begin(storage, COUNT);
+    F32BlockPool::Block* b = pool.allocate();
+    pool.addRef(b); // handed to a second consumer
+    pool.release(b);
+    TEST_ASSERT_EQUAL_UINT16(1, pool.used());
+    TEST_ASSERT_EQUAL_UINT8(1, b->refCount);
+    pool.release(b);
+    TEST_ASSERT_EQUAL_UINT16(0, pool.used());
+    // A stray extra release of a free block changes nothing
+    pool.release(b);
+    pool.release(nullptr);
+    TEST_ASSERT_EQUAL_UINT16(0, pool.used());
+    // And the block is the next one out
+    TEST_ASSERT_TRUE(pool.allocate() == b);
+}
+
+static void test_usage_peak() {
+    F32BlockPool pool;
+    pool.begin(storage, COUNT);
+    F32BlockPool::Block* a = pool.allocate();
+    F32BlockPool::Block* b = pool.allocate();
+    F32BlockPool::Block* c = pool.allocate();
+    pool.release(a);
+    pool.release(b);
+    TEST_ASSERT_EQUAL_UINT16(1, pool.used());
+    TEST_ASSERT_EQUAL_UINT16(3, pool.usedMax());
+    pool.resetUsedMax();
+    TEST_ASSERT_EQUAL_UINT16(1, pool.usedMax());
+    pool.release(c);
+    TEST_ASSERT_EQUAL_UINT16(COUNT, pool.capacity());
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_allocates_every_block_then_fails);
+    RUN_TEST(test_shared_block_returns_on_last_release);
+    RUN_TEST(test_usage_peak);
+    return UNITY_END();
+}
@@ -0,0 +1,262 @@
+// FirCompiler tests: an empty cascade leaves the file untouched, the feed
+// is the file's taps run through the cascade and left to ring, a compiled
+// FIR matches the FIR followed by the live IIRs to within what the
+// truncation report says, the tail sizing (short for a mid bell, capped for
+// a 20Hz crossover), a short file fails the load, and what a block costs
+// either way (reported only).
+
+#include <unity.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "FirCompiler.h"
+#include "FirEngine.h"
+
+static const float FS = 44100.0f;
+static const int BLOCK = FirEngine::BLOCK_SAMPLES;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// Deterministic PRNG (xorshift32), uniform in [-1, 1)
+static uint32_t rngState = 1;
+static float rngFloat() {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return (float)((rngState >> 8) / 8388607.5 - 1.0);
+}
+
+static std::vector<float> randomVector(size_t n, uint32_t seed) {
+    rngState = seed;
+    std::vector<float> v(n);
+    for (size_t i = 0; i < n; i++) v[i] = rngFloat();
+    return v;
+}
+
+// A decaying random "room correction" FIR
+static std::vector<float> roomFir(size_t n, uint32_t seed) {
+    std::vector<float> h = randomVector(n, seed);
+    for (size_t i = 0; i < n; i++) h[i] *= 0.2f * expf(-6.0f * (float)i / (float)n);
+    h[0] += 1.0f;
+    return h;
+}
+
+class VectorFeed : public CoeffFeed {
+public:
+    VectorFeed(const std::vector<float>& h, size_t limit = SIZE_MAX)
+        : h(h), limit(limit < h.size() ? limit : h.size()) {}
+
+    uint16_t read(float* dst, uint16_t count) override {
+        size_t left = limit - pos;
+        if ((size_t)count > left) count = (uint16_t)left;
+        memcpy(dst, h.data() + pos, (size_t)count * sizeof(float));
+        pos += count;
+        return count;
+    }
+
+private:
+    const std::vector<float>& h;
+    size_t limit;
+    size_t pos = 0;
+};
+
+// Pull a feed to the end in partition-sized bites, as the engine does
+static void drain(CoeffFeed& feed, std::vector<float>& out) {
+    const uint16_t taps = (uint16_t)out.size();
+    for (uint16_t at = 0; at < taps; at += BLOCK) {
+        uint16_t n = taps - at < BLOCK ? taps - at : BLOCK;
+        TEST_ASSERT_EQUAL_UINT16(n, feed.read(out.data() + at, n));
+    }
+}
+
+// A sub crossed at 80Hz (LR4) with a room mode notched and a bass shelf-ish
+// boost, the usual shape of a compiled output
+static void subCascade(FirCompiler& c) {
+    c.clear();
+    c.addHighpass(xoverComputeBranch(25.0f, CROSSOVER_BW2, FS));
+    c.addLowpass(xoverComputeBranch(80.0f, CROSSOVER_LR4, FS));
+    c.addBell(peqComputeBellSvf(42.0f, -6.0f, 4.0f, FS));
+    c.addBell(peqComputeBellSvf(60.0f, 3.0f, 1.0f, FS));
+}
+
+static void test_empty_cascade_is_the_file(void) {
+    FirCompiler c;
+    TEST_ASSERT_TRUE(c.empty());
+    TEST_ASSERT_EQUAL_UINT16(0, c.tailTaps(1024, -60.0f));
+    std::vector<float> h = roomFir(300, 7);
+    VectorFeed inner(h);
+    FirCompiler::Feed feed(c, inner, 300, 300);
+    std::vector<float> out(300);
+    drain(feed, out);
+    for (int i = 0; i < 300; i++) TEST_ASSERT_EQUAL_FLOAT(h[i], out[i]);
+    TEST_ASSERT_EQUAL_FLOAT(FirCompiler::TRUNCATION_NONE_DB, feed.truncationDb());
+}
+
+// The feed's output is exactly step() over the file's taps and then zeros
+static void test_feed_runs_taps_through_cascade(void) {
+    FirCompiler c;
+    subCascade(c);
+    std::vector<float> h = roomFir(500, 11);
+    VectorFeed inner(h);
+    FirCompiler::Feed feed(c, inner, 500, 1024);
+    std::vector<float> out(1024);
+    drain(feed, out);
+
+    FirCompiler ref;
+    subCascade(ref);
+    for (int i = 0; i < 1024; i++) {
+        const float y = ref.step(i < 500 ? h[i] : 0.0f);
+        TEST_ASSERT_EQUAL_FLOAT(y, out[i]);
+    }
+    // Past the end the feed has nothing more to give
+    float spare[4];
+    TEST_ASSERT_EQUAL_UINT16(0, feed.read(spare, 4));
+}
+
+// Audio through the compiled FIR vs through the file's FIR and then the
+// cascade live: the difference is the cut-off tail, so it has to sit about
+// where truncationDb() put it.
+static void assertCompiledMatchesLive(uint16_t tail, float maxTruncDb) {
+    FirCompiler c;
+    subCascade(c);
+    const uint16_t fileTaps = 1000;
+    const uint16_t taps = fileTaps + tail;
+    std::vector<float> h = roomFir(fileTaps, 23);
+    VectorFeed inner(h);
+    FirCompiler::Feed feed(c, inner, fileTaps, taps);
+
+    FirEngine compiled, plain;
+    compiled.setFastConvolution(true);
+    plain.setFastConvolution(true);
+    TEST_ASSERT_TRUE(compiled.loadCoefficients(feed, taps));
+    TEST_ASSERT_TRUE(plain.loadCoefficients(h.data(), fileTaps));
+    const float truncDb = feed.truncationDb();
+
+    FirCompiler live;
+    subCascade(live);
+    const int blocks = 400;
+    std::vector<float> x = randomVector((size_t)blocks * BLOCK, 99);
+    std::vector<float> a(BLOCK), b(BLOCK);
+    double errEnergy = 0.0, sigEnergy = 0.0;
+    for (int k = 0; k < blocks; k++) {
+        compiled.processBlock(&x[(size_t)k * BLOCK], a.data());
+        plain.processBlock(&x[(size_t)k * BLOCK], b.data());
+        for (int i = 0; i < BLOCK; i++) {
+            const float y = live.step(b[i]);
+            // Skip the start-up, where neither has its full history
+            if (k < 40) continue;
+            errEnergy += (double)(a[i] - y) * (a[i] - y);
+            sigEnergy += (double)y * y;
+        }
+    }
+    const float errDb = (float)(10.0 * log10(errEnergy / sigEnergy + 1e-30));
+    char msg[128];
+    snprintf(msg, sizeof(msg), "tail %u: error %.1f dB, reported truncation %.1f dB", tail, errDb, truncDb);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE_MESSAGE(truncDb <= maxTruncDb, msg);
+    // The error is the lost tail's energy against the signal: it can't be
+    // far above what was reported lost
+    TEST_ASSERT_TRUE_MESSAGE(errDb <= truncDb + 10.0f, msg);
+}
+
+static void test_compiled_matches_fir_then_iir(void) {
+    // The 42Hz Q4 notch is what's still ringing at 4096 taps
+    assertCompiledMatchesLive(4096, -40.0f);
+    // A short tail is reported as a worse trade, and is one
+    assertCompiledMatchesLive(256, -10.0f);
+}
+
+static void test_tail_sizing(void) {
+    FirCompiler c;
+    // A 1kHz bell has rung out long before a 20Hz highpass has
+    c.addBell(peqComputeBellSvf(1000.0f, 6.0f, 2.0f, FS));
+    const uint16_t bellTail = c.tailTaps(1024, -60.0f);
+    TEST_ASSERT_TRUE(bellTail > 0);
+    TEST_ASSERT_TRUE(bellTail < 256);
+
+    c.clear();
+    c.addHighpass(xoverComputeBranch(20.0f, CROSSOVER_LR4, FS));
+    TEST_ASSERT_EQUAL_UINT16(1024, c.tailTaps(1024, -60.0f));
+    // A deeper floor never asks for less
+    c.clear();
+    subCascade(c);
+    const uint16_t t40 = c.tailTaps(16384, -40.0f);
+    const uint16_t t80 = c.tailTaps(16384, -80.0f);
+    TEST_ASSERT_TRUE(t40 <= t80);
+    TEST_ASSERT_TRUE(t80 < 16384);
+}
+
+static void test_short_file_fails(void) {
+    FirCompiler c;
+    subCascade(c);
+    std::vector<float> h = roomFir(500, 3);
+    VectorFeed inner(h, 300);
+    FirCompiler::Feed feed(c, inner, 500, 640);
+    FirEngine engine;
+    engine.setFastConvolution(true);
+    TEST_ASSERT_FALSE(engine.loadCoefficients(feed, 640));
+    TEST_ASSERT_EQUAL_UINT16(0, engine.taps());
+}
+
+// --- benchmark ---
+
+// One output's block: the fast convolution plus the crossover and ten PEQ
+// bands it used to run, against the compiled filter's convolution alone
+// (one partition longer for the tail). The IIR side is the per-sample
+// cascade the Teensy runs. Host timing varies with load, so this only
+// reports; the compiled filter's response is checked above.
+static void test_benchmark_block_cost(void) {
+    using Clock = std::chrono::steady_clock;
+    FirCompiler c;
+    c.addHighpass(xoverComputeBranch(60.0f, CROSSOVER_LR4, FS));
+    c.addLowpass(xoverComputeBranch(2500.0f, CROSSOVER_LR4, FS));
+    for (int i = 0; i < 10; i++) c.addBell(peqComputeBellSvf(50.0f * powf(1.6f, (float)i), 2.0f - i * 0.5f, 2.0f, FS));
+
+    const uint16_t fileTaps = 2048;
+    std::vector<float> h = roomFir(fileTaps, 5);
+    VectorFeed inner(h);
+    FirCompiler::Feed feed(c, inner, fileTaps, fileTaps + 1024);
+    FirEngine compiled, plain;
+    compiled.setFastConvolution(true);
+    plain.setFastConvolution(true);
+    TEST_ASSERT_TRUE(compiled.loadCoefficients(feed, fileTaps + 1024));
+    TEST_ASSERT_TRUE(plain.loadCoefficients(h.data(), fileTaps));
+
+    const int blocks = 4000;
+    std::vector<float> x = randomVector(BLOCK, 17), y(BLOCK);
+    volatile float sink = 0.0f;
+    auto start = Clock::now();
+    for (int k = 0; k < blocks; k++) {
+        plain.processBlock(x.data(), y.data());
+        for (int i = 0; i < BLOCK; i++) y[i] = c.step(y[i]);
+        sink = sink + y[0];
+    }
+    const double liveUs = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / blocks;
+    start = Clock::now();
+    for (int k = 0; k < blocks; k++) {
+        compiled.processBlock(x.data(), y.data());
+        sink = sink + y[0];
+    }
+    const double compiledUs = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / blocks;
+
+    char msg[128];
+    snprintf(msg, sizeof(msg), "block, 2048-tap FIR + LR4 HP/LP + 10 PEQ: %.2f us live, %.2f us compiled",
+             liveUs, compiledUs);
+    TEST_MESSAGE(msg);
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_empty_cascade_is_the_file);
+    RUN_TEST(test_feed_runs_taps_through_cascade);
+    RUN_TEST(test_compiled_matches_fir_then_iir);
+    RUN_TEST(test_tail_sizing);
+    RUN_TEST(test_short_file_fails);
+    RUN_TEST(test_benchmark_block_cost);
+    return UNITY_END();
+}
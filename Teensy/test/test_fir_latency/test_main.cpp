@@ -0,0 +1,132 @@
+// FirLatencyProbe tests: linear-phase files land on (N-1)/2 for odd and even
+// lengths, minimum-phase files on their first taps, a mixed-phase file on
+// its direct sound despite pre-ringing, a fractional delay to within a tenth
+// of a sample, polarity and read sizes make no difference, and the
+// coefficients pass through untouched.
+
+#include <unity.h>
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "FirLatency.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+class VectorFeed : public CoeffFeed {
+public:
+    explicit VectorFeed(const std::vector<float>& h) : h(h) {}
+
+    uint16_t read(float* dst, uint16_t count) override {
+        size_t left = h.size() - pos;
+        if ((size_t)count > left) count = (uint16_t)left;
+        memcpy(dst, h.data() + pos, (size_t)count * sizeof(float));
+        pos += count;
+        return count;
+    }
+
+private:
+    const std::vector<float>& h;
+    size_t pos = 0;
+};
+
+// Run h through a probe in bites of 'chunk' taps, as the engine pulls it
+static float measure(const std::vector<float>& h, uint16_t chunk = 128) {
+    VectorFeed inner(h);
+    FirLatencyProbe probe(inner);
+    std::vector<float> buf(chunk);
+    while (probe.read(buf.data(), chunk) == chunk) {
+    }
+    return probe.latencySamples();
+}
+
+// Windowed-sinc lowpass delayed by 'delay' samples (fractional allowed),
+// n taps: linear phase when delay is (n-1)/2
+static std::vector<float> sincAt(size_t n, double delay, double cutoff = 0.2) {
+    std::vector<float> h(n);
+    for (size_t i = 0; i < n; i++) {
+        const double t = (double)i - delay;
+        const double s = fabs(t) < 1e-12 ? 2.0 * cutoff : sin(2.0 * M_PI * cutoff * t) / (M_PI * t);
+        const double w = 0.5 - 0.5 * cos(2.0 * M_PI * ((double)i + 0.5) / (double)n);
+        h[i] = (float)(s * w);
+    }
+    return h;
+}
+
+static void test_linear_phase_is_half_the_length(void) {
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 1024.0f, measure(sincAt(2049, 1024.0)));
+    // Even length: the two centre taps tie and the vertex sits between them
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 1023.5f, measure(sincAt(2048, 1023.5)));
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 4.5f, measure(sincAt(10, 4.5)));
+}
+
+static void test_minimum_phase_adds_nothing(void) {
+    // A decaying resonance, the shape of a minimum-phase room correction
+    std::vector<float> h(4096);
+    for (size_t i = 0; i < h.size(); i++) {
+        h[i] = (float)(exp(-(double)i / 300.0) * cos(2.0 * M_PI * 0.01 * (double)i));
+    }
+    TEST_ASSERT_TRUE(measure(h) < 0.5f);
+    // A pure pass-through file
+    std::vector<float> unit(512, 0.0f);
+    unit[0] = 1.0f;
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, measure(unit));
+}
+
+static void test_mixed_phase_finds_direct_sound(void) {
+    // The main arrival at 300 with a decaying tail, and pre-ringing building
+    // up ahead of it to a third of its level
+    std::vector<float> h(3000, 0.0f);
+    for (size_t i = 300; i < h.size(); i++) {
+        h[i] = (float)(exp(-(double)(i - 300) / 200.0) * cos(0.3 * (double)(i - 300)));
+    }
+    for (size_t i = 0; i < 290; i++) h[i] = 0.3f * (float)sin(0.05 * (double)i) * (float)i / 290.0f;
+    // A hard onset leans the parabola late, but never by a whole sample
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, 300.0f, measure(h));
+}
+
+static void test_fractional_delay(void) {
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, 100.3f, measure(sincAt(1000, 100.3)));
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, 99.8f, measure(sincAt(1000, 99.8)));
+}
+
+static void test_polarity_and_read_size_dont_matter(void) {
+    std::vector<float> h = sincAt(777, 200.0);
+    const float ref = measure(h);
+    for (float& v : h) v = -v;
+    TEST_ASSERT_EQUAL_FLOAT(ref, measure(h));
+    TEST_ASSERT_EQUAL_FLOAT(ref, measure(h, 1));
+    TEST_ASSERT_EQUAL_FLOAT(ref, measure(h, 100));
+    // Peak on the last tap: nothing after it
+    std::vector<float> tail(300, 0.01f);
+    tail.back() = 1.0f;
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, 299.0f, measure(tail));
+}
+
+static void test_passes_coefficients_through(void) {
+    std::vector<float> h = sincAt(300, 50.0);
+    VectorFeed inner(h);
+    FirLatencyProbe probe(inner);
+    std::vector<float> out(400, 9.0f);
+    TEST_ASSERT_EQUAL_UINT16(300, probe.read(out.data(), 400));
+    for (size_t i = 0; i < h.size(); i++) TEST_ASSERT_EQUAL_FLOAT(h[i], out[i]);
+    // Nothing read yet, or an all-zero file, measures zero
+    std::vector<float> zeros(64, 0.0f);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, measure(zeros));
+    VectorFeed empty(zeros);
+    FirLatencyProbe idle(empty);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, idle.latencySamples());
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_linear_phase_is_half_the_length);
+    RUN_TEST(test_minimum_phase_adds_nothing);
+    RUN_TEST(test_mixed_phase_finds_direct_sound);
+    RUN_TEST(test_fractional_delay);
+    RUN_TEST(test_polarity_and_read_size_dont_matter);
+    RUN_TEST(test_passes_coefficients_through);
+    return UNITY_END();
+}
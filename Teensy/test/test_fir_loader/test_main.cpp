@@ -261,7 +261,7 @@ static long countTaps(std::vector<uint8_t> bytes, const char* name) {
 
 static void test_count_taps_plain_float32_wav(void) {
     // 6144 mono float samples behind the minimal 44-byte header: the
-    // exact-fit case (3072+3072+6144 fills the 12288 pool exactly)
+    // exact-fit case (3072+6144+6144 fills the 15360 pool exactly)
     std::vector<uint8_t> data;
     for (int i = 0; i < 6144; i++) putFloat(data, 0.5f);
     TEST_ASSERT_EQUAL_INT32(6144, countTaps(buildWav(data), "fit.wav"));
@@ -0,0 +1,312 @@
+// GainSchedule tests: the parameter product, due-time ordering across the
+// clock wrap, changes landing on their exact sample (together when stamped
+// alike), late/absurd stamps, overrides, and the per-sample ramp.
+
+#include <unity.h>
+
+#include <cmath>
+#include <cstdlib>
+
+#include "GainSchedule.h"
+
+using namespace GainSchedule;
+
+static const float FS = 44100.0f;
+static const int N = 128;
+
+static Change change(uint32_t due, Param param, float value, int ch = 0) {
+    Change c;
+    c.due = due;
+    c.param = param;
+    c.ch = (uint8_t)ch;
+    c.value = value;
+    return c;
+}
+
+// Run one block of a constant input through every channel; out[ch] gets
+// channel ch's samples
+static void runBlock(Scheduler& s, int16_t level, int16_t out[CHANNELS][N]) {
+    int16_t in[N];
+    for (int i = 0; i < N; i++) in[i] = level;
+    s.beginBlock(N);
+    for (int ch = 0; ch < CHANNELS; ch++) s.process(ch, in, out[ch]);
+    s.endBlock();
+}
+
+// A scheduler with every output released, settled at volume 0.5
+static void settle(Scheduler& s) {
+    for (int ch = 0; ch < CHANNELS; ch++) s.setOverride(ch, false, 0.0f);
+    s.schedule(change(s.clock(), Param::Volume, 0.5f));
+    static int16_t out[CHANNELS][N];
+    for (int b = 0; b < 400; b++) runBlock(s, 0, out); // ~1.2s, 20 tau
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// --- Params ---
+
+static void test_target_is_gain_times_volume(void) {
+    Params p;
+    p.apply(change(0, Param::Volume, 0.5f));
+    p.apply(change(0, Param::OutputGain, -6.0206f, 2));
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 0.25f, p.target(2));
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.5f, p.target(0));
+    p.apply(change(0, Param::OutputInvert, 1.0f, 2));
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, -0.25f, p.target(2));
+    p.apply(change(0, Param::OutputMute, 1.0f, 2));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, p.target(2));
+}
+
+static void test_mute_pulls_volume_down_by_its_percent(void) {
+    Params p;
+    p.apply(change(0, Param::Volume, 0.8f));
+    p.apply(change(0, Param::MutePercent, 75.0f));
+    p.apply(change(0, Param::Muted, 1.0f));
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.2f, p.target(0));
+    p.apply(change(0, Param::MutePercent, 250.0f)); // clamped to 100
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, p.target(0));
+    p.apply(change(0, Param::Muted, 0.0f));
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.8f, p.target(0));
+}
+
+static void test_out_of_range_channel_is_ignored(void) {
+    Params p;
+    p.apply(change(0, Param::OutputMute, 1.0f, CHANNELS));
+    for (int ch = 0; ch < CHANNELS; ch++) TEST_ASSERT_FALSE(p.outMute[ch]);
+}
+
+// --- Queue ---
+
+static void test_queue_orders_by_due_and_keeps_arrival_order_on_ties(void) {
+    Queue q;
+    q.push(change(300, Param::Volume, 1.0f));
+    q.push(change(100, Param::Volume, 2.0f));
+    q.push(change(300, Param::Volume, 3.0f));
+    q.push(change(200, Param::Volume, 4.0f));
+    const float expected[] = {2.0f, 4.0f, 1.0f, 3.0f};
+    for (float v : expected) {
+        const Change* c = q.due(1000);
+        TEST_ASSERT_NOT_NULL(c);
+        TEST_ASSERT_EQUAL_FLOAT(v, c->value);
+        q.pop();
+    }
+    TEST_ASSERT_NULL(q.due(1000));
+}
+
+static void test_queue_orders_across_the_clock_wrap(void) {
+    Queue q;
+    q.push(change(10, Param::Volume, 2.0f));          // just after the wrap
+    q.push(change(0xFFFFFFF0u, Param::Volume, 1.0f)); // just before it
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, q.due(20)->value);
+    q.pop();
+    // Only due before the end given
+    TEST_ASSERT_NULL(q.due(10));
+    TEST_ASSERT_EQUAL_FLOAT(2.0f, q.due(11)->value);
+}
+
+static void test_queue_refuses_past_capacity(void) {
+    Queue q;
+    for (int i = 0; i < QUEUE_CAPACITY; i++) TEST_ASSERT_TRUE(q.push(change(i, Param::Volume, 0.0f)));
+    TEST_ASSERT_FALSE(q.push(change(0, Param::Volume, 0.0f)));
+    TEST_ASSERT_EQUAL_INT(QUEUE_CAPACITY, q.size());
+}
+
+// --- Scheduler ---
+
+static void test_outputs_start_silent_until_released(void) {
+    Scheduler s(FS);
+    static int16_t out[CHANNELS][N];
+    runBlock(s, 10000, out);
+    for (int ch = 0; ch < CHANNELS; ch++) TEST_ASSERT_EQUAL_INT16(0, out[ch][N - 1]);
+    float g;
+    TEST_ASSERT_TRUE(s.steady(0, g));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, g);
+}
+
+static void test_clock_counts_samples(void) {
+    Scheduler s(FS);
+    static int16_t out[CHANNELS][N];
+    runBlock(s, 0, out);
+    runBlock(s, 0, out);
+    TEST_ASSERT_EQUAL_UINT32(2 * N, s.clock());
+}
+
+static void test_change_lands_on_its_exact_sample(void) {
+    Scheduler s(FS);
+    settle(s);
+    static int16_t out[CHANNELS][N];
+    runBlock(s, 10000, out);
+    TEST_ASSERT_EQUAL_INT16(5000, out[0][N - 1]);
+
+    s.schedule(change(s.clock() + 50, Param::Volume, 0.0f));
+    runBlock(s, 10000, out);
+    for (int i = 0; i < 50; i++) TEST_ASSERT_EQUAL_INT16(5000, out[0][i]);
+    TEST_ASSERT_TRUE(out[0][50] < 5000);
+    TEST_ASSERT_TRUE(out[0][N - 1] < out[0][50]);
+}
+
+static void test_changes_stamped_alike_land_together(void) {
+    Scheduler s(FS);
+    settle(s);
+    static int16_t out[CHANNELS][N];
+    const uint32_t due = s.clock() + N + 77; // in the next block but one
+    for (int ch = 0; ch < CHANNELS; ch++) s.schedule(change(due, Param::OutputMute, 1.0f, ch));
+    runBlock(s, 10000, out);
+    for (int ch = 0; ch < CHANNELS; ch++) TEST_ASSERT_EQUAL_INT16(5000, out[ch][N - 1]);
+    runBlock(s, 10000, out);
+    for (int ch = 0; ch < CHANNELS; ch++) {
+        TEST_ASSERT_EQUAL_INT16(5000, out[ch][76]);
+        TEST_ASSERT_TRUE(out[ch][77] < 5000);
+        TEST_ASSERT_EQUAL_INT16(out[0][100], out[ch][100]);
+    }
+}
+
+static void test_late_and_absurd_stamps_apply_at_the_next_block(void) {
+    Scheduler s(FS);
+    settle(s);
+    static int16_t out[CHANNELS][N];
+    s.schedule(change(s.clock() - 1000, Param::OutputMute, 1.0f, 0));
+    s.schedule(change(s.clock() + MAX_LEAD_SAMPLES + 1, Param::OutputMute, 1.0f, 1));
+    runBlock(s, 10000, out);
+    TEST_ASSERT_TRUE(out[0][0] < 5000);
+    TEST_ASSERT_TRUE(out[1][0] < 5000);
+    TEST_ASSERT_EQUAL_INT(0, s.pending());
+}
+
+static void test_full_queue_applies_at_once(void) {
+    Scheduler s(FS);
+    settle(s);
+    const uint32_t later = s.clock() + 10000;
+    for (int i = 0; i < QUEUE_CAPACITY; i++) s.schedule(change(later, Param::Volume, 0.5f));
+    TEST_ASSERT_FALSE(s.schedule(change(later, Param::OutputMute, 1.0f, 3)));
+    static int16_t out[CHANNELS][N];
+    runBlock(s, 10000, out);
+    TEST_ASSERT_TRUE(out[3][0] < 5000);
+}
+
+static void test_surplus_due_times_in_one_block_wait_for_the_next(void) {
+    Scheduler s(FS);
+    settle(s);
+    const uint32_t start = s.clock();
+    // MAX_SEGMENTS - 1 distinct offsets fit after offset 0; one more spills
+    for (int i = 1; i <= MAX_SEGMENTS; i++) {
+        s.schedule(change(start + 10 * i, Param::OutputGain, -1.0f * i, i % CHANNELS));
+    }
+    static int16_t out[CHANNELS][N];
+    runBlock(s, 10000, out);
+    TEST_ASSERT_EQUAL_INT(1, s.pending());
+    runBlock(s, 10000, out);
+    TEST_ASSERT_EQUAL_INT(0, s.pending());
+}
+
+static void test_override_holds_an_output_and_releases_through_the_ramp(void) {
+    Scheduler s(FS);
+    settle(s);
+    static int16_t out[CHANNELS][N];
+    s.setOverride(4, true, -0.25f);
+    for (int b = 0; b < 400; b++) runBlock(s, 10000, out);
+    TEST_ASSERT_EQUAL_INT16(-2500, out[4][N - 1]);
+    TEST_ASSERT_EQUAL_INT16(5000, out[3][N - 1]);
+    // Parameter changes still land underneath and show once released
+    s.schedule(change(s.clock(), Param::OutputGain, -6.0206f, 4));
+    s.setOverride(4, false, 0.0f);
+    runBlock(s, 10000, out);
+    TEST_ASSERT_TRUE(out[4][0] > -2500);
+    TEST_ASSERT_TRUE(out[4][N - 1] < 2500);
+    for (int b = 0; b < 400; b++) runBlock(s, 10000, out);
+    TEST_ASSERT_TRUE(abs(out[4][N - 1] - 2500) <= 1);
+}
+
+static void test_ramp_follows_its_time_constant(void) {
+    const float k = rampCoeff(RAMP_TAU_MS, FS);
+    float g = 0.0f;
+    const int tau = (int)lroundf(RAMP_TAU_MS * FS / 1000.0f);
+    rampSamples(nullptr, nullptr, tau, g, 1.0f, k);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 1.0f - expf(-1.0f), g);
+    // And snaps onto the target rather than creeping forever
+    rampSamples(nullptr, nullptr, 20 * tau, g, 1.0f, k);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, g);
+}
+
+static void test_silence_advances_the_ramp_like_sound(void) {
+    const float k = rampCoeff(RAMP_TAU_MS, FS);
+    int16_t in[N], out[N];
+    for (int i = 0; i < N; i++) in[i] = 1000;
+    float a = 0.0f, b = 0.0f;
+    rampSamples(in, out, N, a, 1.0f, k);
+    rampSamples(nullptr, nullptr, N, b, 1.0f, k);
+    TEST_ASSERT_EQUAL_FLOAT(a, b);
+    rampSamples(nullptr, out, N, b, 1.0f, k);
+    TEST_ASSERT_EQUAL_INT16(0, out[N - 1]);
+}
+
+static void test_ramp_saturates(void) {
+    int16_t in[2] = {30000, -30000};
+    int16_t out[2];
+    float g = 2.0f;
+    rampSamples(in, out, 2, g, 2.0f, 0.5f);
+    TEST_ASSERT_EQUAL_INT16(32767, out[0]);
+    TEST_ASSERT_EQUAL_INT16(-32768, out[1]);
+}
+
+static void test_float_ramp_matches_without_saturating(void) {
+    const float k = rampCoeff(RAMP_TAU_MS, FS);
+    int16_t in[N], out[N];
+    float outF[N];
+    for (int i = 0; i < N; i++) in[i] = (int16_t)(i * 200 - 12800);
+    float a = 0.5f, b = 0.5f;
+    rampSamples(in, out, N, a, 3.0f, k);
+    rampSamplesFloat(in, outF, N, b, 3.0f, k);
+    TEST_ASSERT_EQUAL_FLOAT(a, b);
+    for (int i = 0; i < N; i++) TEST_ASSERT_EQUAL_INT16(out[i], (int16_t)outF[i]);
+    // Past full scale the float path keeps what int16 would clip
+    float big[1];
+    float g = 3.0f;
+    const int16_t loud[1] = {30000};
+    rampSamplesFloat(loud, big, 1, g, 3.0f, k);
+    TEST_ASSERT_EQUAL_FLOAT(90000.0f, big[0]);
+}
+
+static void test_steady_only_when_settled_and_unchanged(void) {
+    Scheduler s(FS);
+    settle(s);
+    float g;
+    s.beginBlock(N);
+    TEST_ASSERT_TRUE(s.steady(0, g));
+    TEST_ASSERT_EQUAL_FLOAT(0.5f, g);
+    s.endBlock();
+
+    s.schedule(change(s.clock() + 5, Param::Volume, 0.4f));
+    s.beginBlock(N);
+    TEST_ASSERT_FALSE(s.steady(0, g));
+    for (int ch = 0; ch < CHANNELS; ch++) s.process(ch, nullptr, nullptr);
+    s.endBlock();
+    s.beginBlock(N);
+    TEST_ASSERT_FALSE(s.steady(0, g)); // still ramping
+    s.endBlock();
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_target_is_gain_times_volume);
+    RUN_TEST(test_mute_pulls_volume_down_by_its_percent);
+    RUN_TEST(test_out_of_range_channel_is_ignored);
+    RUN_TEST(test_queue_orders_by_due_and_keeps_arrival_order_on_ties);
+    RUN_TEST(test_queue_orders_across_the_clock_wrap);
+    RUN_TEST(test_queue_refuses_past_capacity);
+    RUN_TEST(test_outputs_start_silent_until_released);
+    RUN_TEST(test_clock_counts_samples);
+    RUN_TEST(test_change_lands_on_its_exact_sample);
+    RUN_TEST(test_changes_stamped_alike_land_together);
+    RUN_TEST(test_late_and_absurd_stamps_apply_at_the_next_block);
+    RUN_TEST(test_full_queue_applies_at_once);
+    RUN_TEST(test_surplus_due_times_in_one_block_wait_for_the_next);
+    RUN_TEST(test_override_holds_an_output_and_releases_through_the_ramp);
+    RUN_TEST(test_ramp_follows_its_time_constant);
+    RUN_TEST(test_silence_advances_the_ramp_like_sound);
+    RUN_TEST(test_ramp_saturates);
+    RUN_TEST(test_float_ramp_matches_without_saturating);
+    RUN_TEST(test_steady_only_when_settled_and_unchanged);
+    return UNITY_END();
+}
@@ -0,0 +1,95 @@
+// InputActivity tests: a source starts idle and wakes on its first block
+// with anything in it; it idles after exactly SILENT_BLOCKS silent blocks,
+// and a lost source (SPDIF unlock, USB stop) holds open for the same run so
+// the FIRs behind it ring out; a wake counts once; the silence checks take
+// exact zeros only.
+
+#include <unity.h>
+
+#include "InputActivity.h"
+
+void setUp() {}
+void tearDown() {}
+
+static void test_starts_idle_and_wakes_on_signal() {
+    InputActivity a;
+    TEST_ASSERT_TRUE(a.idle());
+    // Available but silent: still nothing heard
+    a.update(true, true);
+    TEST_ASSERT_TRUE(a.idle());
+    a.update(true, false);
+    TEST_ASSERT_FALSE(a.idle());
+    TEST_ASSERT_EQUAL_UINT32(1, a.wakeups());
+}
+
+static void test_idles_after_silent_run() {
+    InputActivity a;
+    a.update(true, false);
+    for (int i = 0; i < InputActivity::SILENT_BLOCKS - 1; i++) a.update(true, true);
+    TEST_ASSERT_FALSE(a.idle());
+    a.update(true, true);
+    TEST_ASSERT_TRUE(a.idle());
+    // One block of signal restarts the count
+    a.update(true, false);
+    TEST_ASSERT_FALSE(a.idle());
+    for (int i = 0; i < InputActivity::SILENT_BLOCKS - 1; i++) a.update(true, true);
+    TEST_ASSERT_FALSE(a.idle());
+    TEST_ASSERT_EQUAL_UINT32(2, a.wakeups());
+}
+
+static void test_unlock_holds_for_the_full_run() {
+    InputActivity a;
+    a.update(true, false);
+    // A lost lock mid-song counts as silence, whatever 'silent' says: the
+    // gate stays open for the whole hold, then closes
+    for (int i = 0; i < InputActivity::SILENT_BLOCKS - 1; i++) {
+        a.update(false, false);
+        TEST_ASSERT_FALSE(a.idle());
+    }
+    a.update(false, false);
+    TEST_ASSERT_TRUE(a.idle());
+    // Back with silence stays idle; back with signal wakes
+    a.update(true, true);
+    TEST_ASSERT_TRUE(a.idle());
+    a.update(true, false);
+    TEST_ASSERT_FALSE(a.idle());
+    TEST_ASSERT_EQUAL_UINT32(2, a.wakeups());
+    // Signal while awake isn't another wake
+    a.update(true, false);
+    TEST_ASSERT_EQUAL_UINT32(2, a.wakeups());
+}
+
+static void test_unlock_after_silence_keeps_counting() {
+    InputActivity a;
+    a.update(true, false);
+    // Half the hold in silence, the rest unlocked: one run, not two
+    for (int i = 0; i < InputActivity::SILENT_BLOCKS / 2; i++) a.update(true, true);
+    for (int i = 0; i < InputActivity::SILENT_BLOCKS / 2 - 1; i++) a.update(false, true);
+    TEST_ASSERT_FALSE(a.idle());
+    a.update(false, true);
+    TEST_ASSERT_TRUE(a.idle());
+    TEST_ASSERT_EQUAL_UINT32(1, a.wakeups());
+}
+
+static void test_silence_is_exact_zeros() {
+    int16_t pcm[128] = {};
+    TEST_ASSERT_TRUE(InputActivity::silent(pcm, 128));
+    pcm[127] = -1; // one LSB of dither is signal
+    TEST_ASSERT_FALSE(InputActivity::silent(pcm, 128));
+    TEST_ASSERT_TRUE(InputActivity::silent(pcm, 127));
+    float f[64] = {};
+    f[10] = -0.0f;
+    TEST_ASSERT_TRUE(InputActivity::silent(f, 64));
+    f[63] = 1e-30f;
+    TEST_ASSERT_FALSE(InputActivity::silent(f, 64));
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_starts_idle_and_wakes_on_signal);
+    RUN_TEST(test_idles_after_silent_run);
+    RUN_TEST(test_unlock_holds_for_the_full_run);
+    RUN_TEST(test_unlock_after_silence_keeps_counting);
+    RUN_TEST(test_silence_is_exact_zeros);
+    return UNITY_END();
+}
@@ -0,0 +1,232 @@
+// IrDeconvolver tests: the log sweep's seekable recurrence (and that it is
+// the delay probe's chirp, sample for sample), and the chunked
+// deconvolution of synthetic captures - a delayed, scaled copy of the sweep
+// must come back as a unity-gain delta at the right lag, a reflection as a
+// second arrival at its own level - with the shipped IR_* parameters.
+
+#include <unity.h>
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "IrDeconvolver.h"
+#include "teensy_protocol.h"
+
+// --- In-memory CoeffSource with SD File semantics (as test_fir_loader) ---
+class MemorySource : public CoeffSource {
+public:
+    explicit MemorySource(std::vector<uint8_t> data) : d(std::move(data)) {}
+
+    int read(void* buf, size_t len) override {
+        size_t n = d.size() - pos;
+        if (len < n) n = len;
+        memcpy(buf, d.data() + pos, n);
+        pos += n;
+        return (int)n;
+    }
+    int read() override { return pos < d.size() ? d[pos++] : -1; }
+    bool seek(uint64_t p) override {
+        if (p > d.size()) return false;
+        pos = (size_t)p;
+        return true;
+    }
+    uint64_t position() override { return pos; }
+    int available() override { return (int)(d.size() - pos); }
+    uint64_t size() override { return d.size(); }
+
+private:
+    std::vector<uint8_t> d;
+    size_t pos = 0;
+};
+
+static const uint32_t HEADER = 44; // captures sit behind a WAV header
+static const float AMP = 0.5f;     // the firmware's sweep amplitude
+
+static ExpSweep shippedSweep() {
+    return ExpSweep(IR_SAMPLE_RATE, IR_SWEEP_F0_HZ, IR_SWEEP_F1_HZ, IR_SWEEP_SAMPLES,
+                    IR_FADE_IN_SAMPLES, IR_FADE_OUT_SAMPLES);
+}
+
+// Capture of a path made of (delay, gain) taps, played at AMP, as int16
+struct Tap { uint32_t delay; float gain; };
+static std::vector<uint8_t> capture(const std::vector<Tap>& taps) {
+    ExpSweep sweep = shippedSweep();
+    std::vector<float> x(IR_SWEEP_SAMPLES);
+    sweep.fill(0, IR_SWEEP_SAMPLES, x.data());
+    std::vector<float> c(IR_CAPTURE_SAMPLES, 0.0f);
+    for (const Tap& t : taps) {
+        for (uint32_t n = 0; n < IR_SWEEP_SAMPLES && n + t.delay < IR_CAPTURE_SAMPLES; n++) {
+            c[n + t.delay] += AMP * t.gain * x[n];
+        }
+    }
+    std::vector<uint8_t> bytes(HEADER + 2 * c.size(), 0);
+    for (size_t i = 0; i < c.size(); i++) {
+        const int16_t s = (int16_t)lrintf(c[i] * 32767.0f);
+        memcpy(&bytes[HEADER + 2 * i], &s, 2);
+    }
+    return bytes;
+}
+
+static std::vector<float> arena(IrDeconvolver::ARENA_FLOATS);
+static IrDeconvolver deconv;
+
+// Run to completion, collecting the result; progressOk records whether the
+// reported progress only ever rose within 0-100
+static bool progressOk;
+static std::vector<float> deconvolve(MemorySource& src, uint32_t samples = IR_CAPTURE_SAMPLES) {
+    deconv.begin(shippedSweep(), arena.data(), src, HEADER, samples,
+                 IR_PRE_SAMPLES, IR_LENGTH, 1.0f / AMP);
+    std::vector<float> ir;
+    int lastProgress = -1;
+    progressOk = true;
+    while (!deconv.done() && !deconv.failed()) {
+        if (deconv.step()) {
+            ir.insert(ir.end(), deconv.output(), deconv.output() + IrDeconvolver::PART);
+        }
+        const int p = deconv.progressPercent();
+        if (p < lastProgress || p > 100) progressOk = false;
+        lastProgress = p;
+    }
+    return ir;
+}
+
+// |H(f)| of the result, by direct DFT
+static double gainAt(const std::vector<float>& ir, double hz) {
+    double re = 0.0, im = 0.0;
+    const double w = 2.0 * M_PI * hz / IR_SAMPLE_RATE;
+    for (size_t i = 0; i < ir.size(); i++) {
+        re += ir[i] * cos(w * i);
+        im -= ir[i] * sin(w * i);
+    }
+    return sqrt(re * re + im * im);
+}
+
+static double db(double v) { return 20.0 * log10(v); }
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void test_sweep_seek_matches_a_continuous_run(void) {
+    ExpSweep a = shippedSweep();
+    ExpSweep b = shippedSweep();
+    std::vector<float> run(IR_SWEEP_SAMPLES);
+    a.fill(0, IR_SWEEP_SAMPLES, run.data());
+    // Fades, full-scale body, silence past the end
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, run[0]);
+    float maxAbs = 0.0f;
+    for (float v : run) maxAbs = fmaxf(maxAbs, fabsf(v));
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 1.0f, maxAbs);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, a.next());
+    // Re-seeding anywhere reproduces the same samples (the deconvolver
+    // regenerates inverse partitions from arbitrary offsets)
+    const uint32_t starts[] = {0, 4095, 70001, IR_SWEEP_SAMPLES - 300};
+    for (uint32_t start : starts) {
+        b.seek(start);
+        for (uint32_t i = start; i < start + 256; i++) {
+            TEST_ASSERT_FLOAT_WITHIN(2e-4f, run[i], b.next());
+        }
+    }
+}
+
+static void test_sweep_starts_at_f0_and_ends_at_f1(void) {
+    ExpSweep s = shippedSweep();
+    // Zero crossings per second over a window is twice the frequency
+    auto freqAt = [&](uint32_t start, uint32_t len) {
+        std::vector<float> v(len);
+        s.fill(start, (int)len, v.data());
+        int crossings = 0;
+        for (uint32_t i = 1; i < len; i++) {
+            if ((v[i - 1] < 0.0f) != (v[i] < 0.0f)) crossings++;
+        }
+        return crossings * (double)IR_SAMPLE_RATE / (2.0 * len);
+    };
+    const double L = s.rate();
+    // Center of each window: f0 * e^(n/L)
+    TEST_ASSERT_FLOAT_WITHIN(2.0, IR_SWEEP_F0_HZ * exp(14336.0 / L), freqAt(12288, 4096));
+    TEST_ASSERT_FLOAT_WITHIN(200.0, IR_SWEEP_F1_HZ * exp(-1024.0 / L),
+                             freqAt(IR_SWEEP_SAMPLES - 1280, 512));
+}
+
+static void test_sweep_reproduces_the_delay_probe_chirp(void) {
+    // ProbeSource's definition: left Riemann sum of the phase, f multiplied
+    // by a constant ratio each sample, raised-cosine fades
+    ExpSweep s(PROBE_SAMPLE_RATE, PROBE_F0_HZ, PROBE_F1_HZ, PROBE_CHIRP_SAMPLES,
+               PROBE_FADE_SAMPLES, PROBE_FADE_SAMPLES);
+    const double ratio = exp(log(PROBE_F1_HZ / PROBE_F0_HZ) / (double)PROBE_CHIRP_SAMPLES);
+    double phase = 0.0, freq = PROBE_F0_HZ;
+    for (uint32_t n = 0; n < PROBE_CHIRP_SAMPLES; n++) {
+        float w = 1.0f;
+        if (n < PROBE_FADE_SAMPLES) {
+            w = 0.5f * (1.0f - cosf((float)M_PI * n / PROBE_FADE_SAMPLES));
+        } else if (n > PROBE_CHIRP_SAMPLES - 1 - PROBE_FADE_SAMPLES) {
+            w = 0.5f * (1.0f - cosf((float)M_PI * (PROBE_CHIRP_SAMPLES - 1 - n) / PROBE_FADE_SAMPLES));
+        }
+        const float expected = w * sinf((float)phase);
+        phase += 2.0 * M_PI * freq / (double)PROBE_SAMPLE_RATE;
+        if (phase >= 2.0 * M_PI) phase -= 2.0 * M_PI;
+        freq *= ratio;
+        TEST_ASSERT_FLOAT_WITHIN(1e-4f, expected, s.next());
+    }
+}
+
+static void test_delayed_sweep_deconvolves_to_a_unity_delta(void) {
+    const uint32_t D = 3000; // ~68ms path latency
+    MemorySource src(capture({{D, 1.0f}}));
+    std::vector<float> ir = deconvolve(src);
+    TEST_ASSERT_FALSE(deconv.failed());
+    TEST_ASSERT_TRUE(progressOk);
+    TEST_ASSERT_EQUAL(100, deconv.progressPercent());
+    TEST_ASSERT_EQUAL(IR_LENGTH, ir.size());
+    TEST_ASSERT_EQUAL_UINT32(IR_PRE_SAMPLES + D, deconv.peakIndex());
+    // Flat unity passband, from the bass to the top octave
+    const double probes[] = {40.0, 100.0, 1000.0, 5000.0, 15000.0};
+    for (double hz : probes) {
+        TEST_ASSERT_FLOAT_WITHIN(0.3, 0.0, db(gainAt(ir, hz)));
+    }
+    // Nothing much anywhere but the arrival
+    float stray = 0.0f;
+    for (size_t i = 0; i < ir.size(); i++) {
+        if (i + 64 < IR_PRE_SAMPLES + D || i > IR_PRE_SAMPLES + D + 64) {
+            stray = fmaxf(stray, fabsf(ir[i]));
+        }
+    }
+    TEST_ASSERT_TRUE(db(stray / deconv.peakValue()) < -40.0);
+}
+
+static void test_reflection_shows_at_its_own_lag_and_level(void) {
+    // Direct sound at -6dB plus a reflection 10ms later, 6dB below it
+    const uint32_t D = 200, R = D + 441;
+    MemorySource src(capture({{D, 0.5f}, {R, 0.25f}}));
+    std::vector<float> ir = deconvolve(src);
+    TEST_ASSERT_EQUAL_UINT32(IR_PRE_SAMPLES + D, deconv.peakIndex());
+    TEST_ASSERT_FLOAT_WITHIN(0.5, -6.0, db(gainAt(
+        std::vector<float>(ir.begin(), ir.begin() + IR_PRE_SAMPLES + D + 220), 1000.0)));
+    float second = 0.0f;
+    for (uint32_t i = IR_PRE_SAMPLES + R - 8; i < IR_PRE_SAMPLES + R + 8; i++) {
+        second = fmaxf(second, fabsf(ir[i]));
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.5, -6.0, db(second / deconv.peakValue()));
+}
+
+static void test_short_capture_read_fails_cleanly(void) {
+    // The file ends before the capture it claims: a truncated card write
+    std::vector<uint8_t> bytes = capture({{100, 1.0f}});
+    bytes.resize(HEADER + IR_CAPTURE_SAMPLES); // half the samples
+    MemorySource src(bytes);
+    deconvolve(src);
+    TEST_ASSERT_TRUE(deconv.failed());
+    TEST_ASSERT_FALSE(deconv.done());
+    TEST_ASSERT_FALSE(deconv.step());
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_sweep_seek_matches_a_continuous_run);
+    RUN_TEST(test_sweep_starts_at_f0_and_ends_at_f1);
+    RUN_TEST(test_sweep_reproduces_the_delay_probe_chirp);
+    RUN_TEST(test_delayed_sweep_deconvolves_to_a_unity_delta);
+    RUN_TEST(test_reflection_shows_at_its_own_lag_and_level);
+    RUN_TEST(test_short_capture_read_fails_cleanly);
+    return UNITY_END();
+}
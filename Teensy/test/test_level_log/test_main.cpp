@@ -0,0 +1,291 @@
+// LevelLog: the long-term level log's record format, the per-second
+// decimation the sketch feeds it and the ring bookkeeping LevelLogger
+// resumes from - a log is read back after power cuts, card swaps and
+// wraps, so torn records and a wrapped ring must come back right.
+
+#include <unity.h>
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "LevelLog.h"
+
+using namespace LevelLog;
+
+// --- In-memory CoeffSource with SD File semantics (as test_fir_loader) ---
+class MemorySource : public CoeffSource {
+public:
+    explicit MemorySource(std::vector<uint8_t> data) : d(std::move(data)) {}
+
+    int read(void* buf, size_t len) override {
+        size_t n = d.size() - pos;
+        if (len < n) n = len;
+        memcpy(buf, d.data() + pos, n);
+        pos += n;
+        return (int)n;
+    }
+    int read() override { return pos < d.size() ? d[pos++] : -1; }
+    bool seek(uint64_t p) override {
+        if (p > d.size()) return false;
+        pos = (size_t)p;
+        return true;
+    }
+    uint64_t position() override { return pos; }
+    int available() override { return (int)(d.size() - pos); }
+    uint64_t size() override { return d.size(); }
+
+private:
+    std::vector<uint8_t> d;
+    size_t pos = 0;
+};
+
+// A log file with capacity slots after records [0, written) went in the
+// way LevelLogger appends them
+static std::vector<uint8_t> logFile(uint32_t capacity, uint32_t written) {
+    std::vector<uint8_t> f(HEADER_BYTES);
+    buildHeader(f.data(), capacity);
+    const uint32_t slots = written < capacity ? written : capacity;
+    f.resize(HEADER_BYTES + slots * RECORD_BYTES);
+    for (uint32_t seq = 0; seq < written; seq++) {
+        Record r;
+        r.seq = seq;
+        r.uptime = 1000 + seq;
+        pack(r, &f[slotOffset(seq, capacity)]);
+    }
+    return f;
+}
+
+// The resume point, or UINT32_MAX if the file did not parse as a log
+static uint32_t nextOf(std::vector<uint8_t> file) {
+    MemorySource src(std::move(file));
+    uint32_t capacity = 0, next = 0;
+    return findNext(src, capacity, next) ? next : UINT32_MAX;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void test_record_round_trips_and_torn_slots_fail_the_check(void) {
+    Record r;
+    r.seq = 0x01020304;
+    r.uptime = 86400;
+    r.flags = FLAG_CLIP_R | FLAG_BANDS;
+    r.peak[0] = 200;
+    r.peak[1] = 255;
+    r.gr[2] = 48;
+    for (int j = 0; j < LEVEL_LOG_BANDS; j++) r.band[j] = (uint8_t)(100 + j);
+
+    uint8_t rec[RECORD_BYTES];
+    pack(r, rec);
+    Record back;
+    TEST_ASSERT_TRUE(unpack(rec, back));
+    TEST_ASSERT_EQUAL_UINT32(r.seq, back.seq);
+    TEST_ASSERT_EQUAL_UINT32(r.uptime, back.uptime);
+    TEST_ASSERT_EQUAL_UINT8(r.flags, back.flags);
+    TEST_ASSERT_EQUAL_MEMORY(r.peak, back.peak, 2);
+    TEST_ASSERT_EQUAL_MEMORY(r.gr, back.gr, COMP_NUM_BANDS);
+    TEST_ASSERT_EQUAL_MEMORY(r.band, back.band, LEVEL_LOG_BANDS);
+
+    // Never written (a freshly extended file reads zero) and a flipped bit
+    uint8_t blank[RECORD_BYTES] = {};
+    TEST_ASSERT_FALSE(unpack(blank, back));
+    rec[20] ^= 0x10;
+    TEST_ASSERT_FALSE(unpack(rec, back));
+}
+
+static void test_point_hex_is_the_uptime_through_the_last_band(void) {
+    Record r;
+    r.uptime = 0x0a0b0c0d;
+    r.flags = FLAG_COMP;
+    r.band[LEVEL_LOG_BANDS - 1] = 0xfe;
+    char hex[POINT_HEX_CHARS + 1];
+    pointHex(r, hex);
+    TEST_ASSERT_EQUAL_UINT32(82, (uint32_t)strlen(hex));
+    TEST_ASSERT_EQUAL_MEMORY("0d0c0b0a08", hex, 10);
+    TEST_ASSERT_EQUAL_STRING("fe", hex + POINT_HEX_CHARS - 2);
+}
+
+static void test_header_rejects_other_layouts(void) {
+    uint8_t h[HEADER_BYTES];
+    uint32_t capacity = 0;
+    buildHeader(h, 4096);
+    TEST_ASSERT_TRUE(parseHeader(h, capacity));
+    TEST_ASSERT_EQUAL_UINT32(4096, capacity);
+
+    buildHeader(h, 4096);
+    h[14] = 121; // a log of 1/12-octave bands
+    TEST_ASSERT_FALSE(parseHeader(h, capacity));
+    buildHeader(h, 4100); // slots would straddle sectors
+    TEST_ASSERT_FALSE(parseHeader(h, capacity));
+    buildHeader(h, 4096);
+    memcpy(h, "RIFF", 4);
+    TEST_ASSERT_FALSE(parseHeader(h, capacity));
+}
+
+static void test_spectrum_folds_into_third_octaves(void) {
+    // The RTA's grid: 121 bands from 10^(52/40) = 20Hz. A sine reading 1.0
+    // in the band at 1kHz (k = 120, so b = 68) is 1.0 in the 1kHz third.
+    std::vector<float> p(121, 0.0f);
+    p[68] = 1.0f;
+    Accumulator acc;
+    acc.addSpectrum(p.data(), 121, 52, false);
+    Record r;
+    acc.take(r);
+    TEST_ASSERT_EQUAL_UINT8(FLAG_BANDS, r.flags & FLAG_BANDS);
+    TEST_ASSERT_EQUAL_UINT8(powerByte(1.0f), r.band[17]); // 10^(120/40)
+    TEST_ASSERT_EQUAL_UINT8(0, r.band[16]);
+    TEST_ASSERT_EQUAL_UINT8(0, r.band[18]);
+
+    // A flat spectrum: each third spans four twelfths, the ends half
+    // covered (the first and last thirds lose the half above/below 20Hz
+    // and 20kHz)
+    std::fill(p.begin(), p.end(), 0.01f);
+    acc.addSpectrum(p.data(), 121, 52, false);
+    acc.take(r);
+    TEST_ASSERT_EQUAL_UINT8(powerByte(0.04f), r.band[10]);
+    TEST_ASSERT_EQUAL_UINT8(powerByte(0.025f), r.band[0]);
+    TEST_ASSERT_EQUAL_UINT8(powerByte(0.025f), r.band[LEVEL_LOG_BANDS - 1]);
+}
+
+static void test_second_holds_peaks_and_averages_power(void) {
+    Accumulator acc;
+    std::vector<float> p(121, 0.0f);
+    p[68] = 1.0f;
+    acc.addSpectrum(p.data(), 121, 52, false);
+    p[68] = 0.0f;
+    acc.addSpectrum(p.data(), 121, 52, true); // one frame while soloed
+    acc.addPeaks(0.5f, 0.1f, false, false);
+    acc.addPeaks(0.25f, 1.0f, false, true);
+    const float grA[COMP_NUM_BANDS] = {3.0f, 0.0f, 1.0f};
+    const float grB[COMP_NUM_BANDS] = {1.0f, 6.5f, 0.0f};
+    acc.addGainReduction(grA, true);
+    acc.addGainReduction(grB, true);
+
+    Record r;
+    acc.take(r);
+    TEST_ASSERT_EQUAL_UINT8(FLAG_CLIP_R | FLAG_BANDS | FLAG_COMP | FLAG_SOLO, r.flags);
+    TEST_ASSERT_EQUAL_UINT8(peakByte(0.5f), r.peak[0]);
+    TEST_ASSERT_EQUAL_UINT8(255, r.peak[1]);
+    TEST_ASSERT_EQUAL_UINT8(24, r.gr[0]);
+    TEST_ASSERT_EQUAL_UINT8(52, r.gr[1]);
+    TEST_ASSERT_EQUAL_UINT8(8, r.gr[2]);
+    TEST_ASSERT_EQUAL_UINT8(powerByte(0.5f), r.band[17]); // -3dB: mean power
+
+    // take() starts a clean second: no spectrum means no bands
+    acc.take(r);
+    TEST_ASSERT_EQUAL_UINT8(0, r.flags);
+    TEST_ASSERT_EQUAL_UINT8(0, r.peak[0]);
+    TEST_ASSERT_EQUAL_UINT8(0, r.band[17]);
+}
+
+static void test_bucket_folds_records_into_a_point(void) {
+    Bucket b;
+    TEST_ASSERT_TRUE(b.empty());
+    Record r1, r2, r3;
+    r1.uptime = 500;
+    r1.flags = FLAG_BANDS;
+    r1.band[5] = powerByte(1.0f);
+    r1.peak[0] = 10;
+    r2.uptime = 501;
+    r2.flags = FLAG_BANDS | FLAG_CLIP_L | FLAG_GAP;
+    r2.band[5] = powerByte(0.0f);
+    r2.peak[0] = 240;
+    r2.gr[1] = 40;
+    r3.uptime = 502; // no spectrum: must not drag the mean down
+    b.add(r1);
+    b.add(r2);
+    b.add(r3);
+
+    Record pt;
+    b.take(77, pt);
+    TEST_ASSERT_TRUE(b.empty());
+    TEST_ASSERT_EQUAL_UINT32(77, pt.seq);
+    TEST_ASSERT_EQUAL_UINT32(500, pt.uptime);
+    TEST_ASSERT_EQUAL_UINT8(FLAG_BANDS | FLAG_CLIP_L | FLAG_GAP, pt.flags);
+    TEST_ASSERT_EQUAL_UINT8(240, pt.peak[0]);
+    TEST_ASSERT_EQUAL_UINT8(40, pt.gr[1]);
+    TEST_ASSERT_EQUAL_UINT8(powerByte(0.5f), pt.band[5]);
+}
+
+static void test_next_record_after_appends(void) {
+    TEST_ASSERT_EQUAL_UINT32(0, nextOf(logFile(64, 0)));
+    TEST_ASSERT_EQUAL_UINT32(1, nextOf(logFile(64, 1)));
+    TEST_ASSERT_EQUAL_UINT32(37, nextOf(logFile(64, 37)));
+    TEST_ASSERT_EQUAL_UINT32(64, nextOf(logFile(64, 64)));
+
+    // A power cut mid-write leaves a torn record, or a short file
+    std::vector<uint8_t> f = logFile(64, 37);
+    f[slotOffset(36, 64) + 30] ^= 0xff;
+    TEST_ASSERT_EQUAL_UINT32(36, nextOf(f));
+    f = logFile(64, 37);
+    f.resize(f.size() - 20);
+    TEST_ASSERT_EQUAL_UINT32(36, nextOf(f));
+    f = logFile(64, 1);
+    f[slotOffset(0, 64)] ^= 0x01;
+    TEST_ASSERT_EQUAL_UINT32(0, nextOf(f));
+}
+
+static void test_next_record_after_the_ring_wraps(void) {
+    // Every wrap point, over several laps
+    for (uint32_t written = 65; written <= 64 * 3 + 1; written++) {
+        TEST_ASSERT_EQUAL_UINT32(written, nextOf(logFile(64, written)));
+    }
+    // Torn right after wrapping (slot 0) and mid-lap
+    std::vector<uint8_t> f = logFile(64, 129);
+    f[slotOffset(128, 64) + 9] ^= 0x40;
+    TEST_ASSERT_EQUAL_UINT32(128, nextOf(f));
+    f = logFile(64, 150);
+    f[slotOffset(149, 64) + 9] ^= 0x40;
+    TEST_ASSERT_EQUAL_UINT32(149, nextOf(f));
+
+    // The shipped capacity, wrapped once
+    TEST_ASSERT_EQUAL_UINT32(LEVEL_LOG_CAPACITY + 1000, nextOf(logFile(LEVEL_LOG_CAPACITY, LEVEL_LOG_CAPACITY + 1000)));
+}
+
+static void test_foreign_file_is_not_a_log(void) {
+    std::vector<uint8_t> f = logFile(64, 10);
+    f[0] = 'X';
+    MemorySource src(f);
+    uint32_t capacity, next;
+    TEST_ASSERT_FALSE(findNext(src, capacity, next));
+    MemorySource shortFile(std::vector<uint8_t>(100, 0));
+    TEST_ASSERT_FALSE(findNext(shortFile, capacity, next));
+}
+
+static void test_range_clamps_to_the_log_and_caps_points(void) {
+    // Records 1000..4999 exist
+    Range r = clampRange(-3600, 3600, 1, 1000, 5000);
+    TEST_ASSERT_EQUAL_UINT32(1400, r.from);
+    TEST_ASSERT_EQUAL_UINT32(3600, r.count);
+    TEST_ASSERT_EQUAL_UINT32(12, r.step); // 300 points
+    r = clampRange(0, 2000, 1, 1000, 5000);
+    TEST_ASSERT_EQUAL_UINT32(1000, r.from);
+    TEST_ASSERT_EQUAL_UINT32(1000, r.count);
+    TEST_ASSERT_EQUAL_UINT32(4, r.step);
+    r = clampRange(4900, 1000, 60, 1000, 5000);
+    TEST_ASSERT_EQUAL_UINT32(4900, r.from);
+    TEST_ASSERT_EQUAL_UINT32(100, r.count);
+    TEST_ASSERT_EQUAL_UINT32(60, r.step); // coarser than needed is kept
+    r = clampRange(-10000, 50, 0, 1000, 5000);
+    TEST_ASSERT_EQUAL_UINT32(0, r.count);
+    TEST_ASSERT_EQUAL_UINT32(1, r.step);
+    r = clampRange(9000, 50, 1, 0, 0); // an empty log
+    TEST_ASSERT_EQUAL_UINT32(0, r.from);
+    TEST_ASSERT_EQUAL_UINT32(0, r.count);
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_record_round_trips_and_torn_slots_fail_the_check);
+    RUN_TEST(test_point_hex_is_the_uptime_through_the_last_band);
+    RUN_TEST(test_header_rejects_other_layouts);
+    RUN_TEST(test_spectrum_folds_into_third_octaves);
+    RUN_TEST(test_second_holds_peaks_and_averages_power);
+    RUN_TEST(test_bucket_folds_records_into_a_point);
+    RUN_TEST(test_next_record_after_appends);
+    RUN_TEST(test_next_record_after_the_ring_wraps);
+    RUN_TEST(test_foreign_file_is_not_a_log);
+    RUN_TEST(test_range_clamps_to_the_log_and_caps_points);
+    return UNITY_END();
+}
@@ -0,0 +1,211 @@
+// LoudnessEq tests: one set plays at every volume, the curve between two
+// sets, holding past the ends, bands only one set has, volume to level
+// quantization, incremental coefficients, a pad covering the whole range,
+// and (reported only) what a volume step costs.
+
+#include <unity.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+#include "LoudnessEq.h"
+
+static const float FS = 44100.0f;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static PEQBand band(float f, float g, float q) { return {f, g, q, true}; }
+
+static void setLevels(LoudnessEq& eq, float ref, int a, int b, int c) {
+    const int spl[] = {a, b, c};
+    eq.setLevels(ref, spl, 3);
+}
+
+static void test_one_set_plays_at_every_volume(void) {
+    LoudnessEq eq;
+    eq.setBand(0, 0, band(100.0f, 4.0f, 0.7f));
+    eq.setBand(0, 3, band(5000.0f, -2.0f, 2.0f));
+    PEQBand out[MAX_PEQ_BANDS];
+    const float levels[] = {-20.0f, 0.0f, 55.0f, 120.0f};
+    for (float level : levels) {
+        eq.curveAt(level, out);
+        TEST_ASSERT_TRUE(out[0].enabled);
+        TEST_ASSERT_EQUAL_FLOAT(4.0f, out[0].gain);
+        TEST_ASSERT_EQUAL_FLOAT(100.0f, out[0].frequency);
+        TEST_ASSERT_EQUAL_FLOAT(-2.0f, out[3].gain);
+        TEST_ASSERT_FALSE(out[1].enabled);
+    }
+}
+
+static void test_curve_between_two_sets(void) {
+    LoudnessEq eq;
+    setLevels(eq, 100.0f, 60, 80, LoudnessEq::UNUSED);
+    eq.setBand(0, 0, band(50.0f, 8.0f, 0.5f));
+    eq.setBand(1, 0, band(200.0f, 2.0f, 2.0f));
+    PEQBand out[MAX_PEQ_BANDS];
+    eq.curveAt(70.0f, out);
+    // Gain linear, frequency and Q geometric
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 5.0f, out[0].gain);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 100.0f, out[0].frequency);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 1.0f, out[0].q);
+    eq.curveAt(65.0f, out);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 6.5f, out[0].gain);
+}
+
+static void test_sets_hold_past_either_end(void) {
+    LoudnessEq eq;
+    // Slot order needn't follow level order
+    setLevels(eq, 100.0f, 85, LoudnessEq::UNUSED, 40);
+    eq.setBand(0, 0, band(60.0f, 1.0f, 1.0f));
+    eq.setBand(2, 0, band(60.0f, 9.0f, 1.0f));
+    PEQBand out[MAX_PEQ_BANDS];
+    eq.curveAt(10.0f, out);
+    TEST_ASSERT_EQUAL_FLOAT(9.0f, out[0].gain);
+    eq.curveAt(110.0f, out);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, out[0].gain);
+    eq.curveAt(85.0f, out);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, out[0].gain);
+}
+
+static void test_band_in_one_set_grows_from_flat(void) {
+    LoudnessEq eq;
+    setLevels(eq, 100.0f, 50, 90, LoudnessEq::UNUSED);
+    eq.setBand(0, 2, band(40.0f, 10.0f, 0.8f));
+    PEQBand out[MAX_PEQ_BANDS];
+    eq.curveAt(80.0f, out);
+    TEST_ASSERT_TRUE(out[2].enabled);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 40.0f, out[2].frequency);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 0.8f, out[2].q);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 2.5f, out[2].gain);
+    TEST_ASSERT_FALSE(out[0].enabled);
+}
+
+static void test_no_sets_is_flat(void) {
+    LoudnessEq eq;
+    eq.setBand(0, 0, band(100.0f, 6.0f, 1.0f));
+    setLevels(eq, 100.0f, LoudnessEq::UNUSED, LoudnessEq::UNUSED, LoudnessEq::UNUSED);
+    PEQBand out[MAX_PEQ_BANDS];
+    eq.curveAt(70.0f, out);
+    for (int i = 0; i < MAX_PEQ_BANDS; i++) TEST_ASSERT_FALSE(out[i].enabled);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, eq.maxBoostDb());
+}
+
+static void test_volume_sets_level_in_steps(void) {
+    LoudnessEq eq;
+    setLevels(eq, 100.0f, 0, LoudnessEq::UNUSED, LoudnessEq::UNUSED);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 80.0f, eq.levelFor(0.1f));
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 100.0f, eq.levelFor(1.0f));
+    // Volume 0 parks at the floor instead of minus infinity
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 0.0f, eq.levelFor(0.0f));
+
+    LoudnessEq::Coeffs c;
+    TEST_ASSERT_TRUE(eq.track(0.1f));
+    eq.computeCoeffs(FS, c);
+    TEST_ASSERT_FALSE(eq.track(0.1f));
+    // Under half a step away: same level, nothing to do
+    TEST_ASSERT_FALSE(eq.track(0.1f * powf(10.0f, 0.1f / 20.0f)));
+    TEST_ASSERT_TRUE(eq.track(0.1f * powf(10.0f, 0.2f / 20.0f)));
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 80.25f, eq.level());
+    eq.computeCoeffs(FS, c);
+    // An edit needs a recompute even where the volume stayed
+    eq.setBand(0, 0, band(100.0f, 3.0f, 1.0f));
+    TEST_ASSERT_TRUE(eq.track(0.1f * powf(10.0f, 0.2f / 20.0f)));
+}
+
+static void test_only_changed_bands_are_recomputed(void) {
+    LoudnessEq eq;
+    setLevels(eq, 100.0f, 60, 80, LoudnessEq::UNUSED);
+    // Band 0 moves with the level, band 1 is the same in both sets
+    eq.setBand(0, 0, band(50.0f, 8.0f, 0.7f));
+    eq.setBand(1, 0, band(50.0f, 2.0f, 0.7f));
+    eq.setBand(0, 1, band(3000.0f, -3.0f, 1.5f));
+    eq.setBand(1, 1, band(3000.0f, -3.0f, 1.5f));
+
+    LoudnessEq::Coeffs c;
+    eq.track(0.1f); // 80 dB
+    TEST_ASSERT_EQUAL_INT(MAX_PEQ_BANDS, eq.computeCoeffs(FS, c));
+    eq.track(0.05f); // ~74 dB
+    TEST_ASSERT_EQUAL_INT(1, eq.computeCoeffs(FS, c));
+    TEST_ASSERT_EQUAL_INT(0, eq.computeCoeffs(FS, c));
+
+    // And what was computed is the band's own bell
+    const PeqSvfCoeffs ref = peqComputeBellSvf(c.bands[0].frequency, c.bands[0].gain, c.bands[0].q, FS);
+    TEST_ASSERT_EQUAL_FLOAT(ref.a1, c.svf[0].a1);
+    TEST_ASSERT_EQUAL_FLOAT(ref.m1, c.svf[0].m1);
+    TEST_ASSERT_TRUE(c.active[0]);
+    TEST_ASSERT_TRUE(c.active[1]);
+    TEST_ASSERT_FALSE(c.active[2]);
+}
+
+static void test_pad_covers_every_level(void) {
+    LoudnessEq eq;
+    setLevels(eq, 100.0f, 60, 80, LoudnessEq::UNUSED);
+    // Two +6dB bells that meet halfway: apart at either set, stacked between
+    eq.setBand(0, 0, band(100.0f, 6.0f, 2.0f));
+    eq.setBand(0, 1, band(400.0f, 6.0f, 2.0f));
+    eq.setBand(1, 0, band(400.0f, 6.0f, 2.0f));
+    eq.setBand(1, 1, band(100.0f, 6.0f, 2.0f));
+    const float pad = eq.maxBoostDb();
+    TEST_ASSERT_TRUE(pad > 11.0f);
+    TEST_ASSERT_TRUE(pad < 12.5f);
+}
+
+// --- benchmark ---
+
+// A volume sweep over three sets whose fifteen bands all differ: every
+// step recomputes every band, the most a step can cost. The Teensy is
+// several times slower than a desktop core (STATS leq= reports the real
+// figure), and host timing varies with load, so this only reports.
+static void test_benchmark_volume_sweep(void) {
+    using Clock = std::chrono::steady_clock;
+    LoudnessEq eq;
+    setLevels(eq, 100.0f, 50, 70, 90);
+    for (int s = 0; s < LoudnessEq::SETS; s++) {
+        for (int i = 0; i < MAX_PEQ_BANDS; i++) {
+            eq.setBand(s, i, band(30.0f * powf(1.5f, (float)i) * (1.0f + 0.1f * s), 2.0f * s - 3.0f + 0.3f * i,
+                                  0.7f + 0.2f * s));
+        }
+    }
+    LoudnessEq::Coeffs c;
+    eq.track(1.0f);
+    eq.computeCoeffs(FS, c);
+
+    int steps = 0;
+    double worstUs = 0.0, totalUs = 0.0;
+    for (int rep = 0; rep < 20; rep++) {
+        // 100 dB down to 40 dB, a quarter dB at a time, and back
+        for (int k = 0; k < 480; k++) {
+            const int at = k < 240 ? k : 479 - k;
+            const float gain = powf(10.0f, -at * 0.25f / 20.0f);
+            const auto start = Clock::now();
+            if (eq.track(gain)) {
+                TEST_ASSERT_TRUE(eq.computeCoeffs(FS, c) <= MAX_PEQ_BANDS);
+            }
+            const double us = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+            totalUs += us;
+            if (us > worstUs) worstUs = us;
+            steps++;
+        }
+    }
+
+    char msg[120];
+    snprintf(msg, sizeof(msg), "volume step, 15 bands moving: %.2f us mean, %.1f us worst",
+             totalUs / steps, worstUs);
+    TEST_MESSAGE(msg);
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_one_set_plays_at_every_volume);
+    RUN_TEST(test_curve_between_two_sets);
+    RUN_TEST(test_sets_hold_past_either_end);
+    RUN_TEST(test_band_in_one_set_grows_from_flat);
+    RUN_TEST(test_no_sets_is_flat);
+    RUN_TEST(test_volume_sets_level_in_steps);
+    RUN_TEST(test_only_changed_bands_are_recomputed);
+    RUN_TEST(test_pad_covers_every_level);
+    RUN_TEST(test_benchmark_volume_sweep);
+    return UNITY_END();
+}
@@ -5,12 +5,17 @@
 //     an independent double-precision recomputation, and
 //  2. the full frequency response of the SVF difference equations matches
 //     the RBJ biquad's response across the audio band.
-// Plus the edge clamps (20Hz-20kHz, +/-15dB, Q 0.1-10).
+// Plus the edge clamps (20Hz-20kHz, +/-15dB, Q 0.1-10), and the maximum
+// boost search against the 100-point sweep it replaced and a dense one,
+// with what each costs (reported only).
 
 #include <unity.h>
 
+#include <chrono>
 #include <cmath>
 #include <complex>
+#include <cstdio>
+#include <cstdlib>
 
 #include "PEQMath.h"
 
@@ -169,6 +174,97 @@ static void test_bell_shape_anchors(void) {
     TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.0f, calculateBellFilter(20000.0f, 20.0f, 9.0f, 4.0f));
 }
 
+// --- maximum boost search ---
+
+// The sweep peqMaxBoostDb replaced: 100 log-spaced points, 20Hz to 20kHz,
+// band responses summed in dB
+static float sweepMaxBoostDb(const PEQBand* bands, int n, int points) {
+    float maxBoost = 0.0f;
+    for (int i = 0; i < points; i++) {
+        float freq = 20.0f * powf(1000.0f, (float)i / (points - 1));
+        float total = 0.0f;
+        for (int j = 0; j < n; j++) {
+            if (bands[j].enabled) total += calculateBellFilter(freq, bands[j].frequency, bands[j].gain, bands[j].q);
+        }
+        if (total > maxBoost) maxBoost = total;
+    }
+    return maxBoost;
+}
+
+static float frand(float lo, float hi) { return lo + (hi - lo) * (float)rand() / (float)RAND_MAX; }
+
+// A random curve within the processors' ranges, mostly narrow-ish bands so
+// the 100-point sweep has peaks to miss
+static void randomCurve(PEQBand* bands, int n) {
+    for (int i = 0; i < n; i++) {
+        bands[i].frequency = 20.0f * powf(1000.0f, frand(0.0f, 1.0f));
+        bands[i].gain = frand(-15.0f, 15.0f);
+        bands[i].q = powf(10.0f, frand(-1.0f, 1.0f));
+        bands[i].enabled = rand() % 8 != 0;
+    }
+}
+
+// Never below the old sweep (it samples the same curve), never above the
+// true peak (a 20000-point sweep, accurate to well under 0.01dB here)
+static void test_max_boost_matches_dense_sweep(void) {
+    srand(1234);
+    PEQBand bands[MAX_PEQ_BANDS];
+    for (int trial = 0; trial < 400; trial++) {
+        const int n = 1 + trial % MAX_PEQ_BANDS;
+        randomCurve(bands, n);
+        const float fast = peqMaxBoostDb(bands, n);
+        const float old = sweepMaxBoostDb(bands, n, 100);
+        const float dense = sweepMaxBoostDb(bands, n, 20000);
+        char msg[128];
+        snprintf(msg, sizeof(msg), "trial %d (%d bands): fast=%.4f sweep=%.4f dense=%.4f", trial, n, fast, old, dense);
+        TEST_ASSERT_TRUE_MESSAGE(fast >= old - 0.01f, msg);
+        TEST_ASSERT_TRUE_MESSAGE(std::fabs(fast - dense) <= 0.02f, msg);
+    }
+}
+
+static void test_max_boost_edge_cases(void) {
+    PEQBand bands[3] = {{1000.0f, 6.0f, 1.0f, true}, {8000.0f, 12.0f, 4.0f, false}, {100.0f, -9.0f, 0.7f, true}};
+    // A single bell peaks at its design gain; a disabled one doesn't count
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 6.0f, peqMaxBoostDb(bands, 2));
+    // Cuts only: no headroom needed
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, peqMaxBoostDb(bands + 1, 2));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, peqMaxBoostDb(bands, 0));
+    // Two overlapping boosts stack beyond either
+    PEQBand pair[2] = {{200.0f, 6.0f, 1.0f, true}, {300.0f, 6.0f, 1.0f, true}};
+    TEST_ASSERT_FLOAT_WITHIN(0.02f, sweepMaxBoostDb(pair, 2, 20000), peqMaxBoostDb(pair, 2));
+    TEST_ASSERT_TRUE(peqMaxBoostDb(pair, 2) > 10.0f);
+    // A boost centered past 20kHz only counts for its skirt inside the band
+    PEQBand high = {20000.0f, 10.0f, 10.0f, true};
+    TEST_ASSERT_FLOAT_WITHIN(0.02f, sweepMaxBoostDb(&high, 1, 20000), peqMaxBoostDb(&high, 1));
+}
+
+// --- benchmark ---
+
+// Fifteen active bands, the input EQ's worst case. Reports both costs; the
+// host is several times faster than the Teensy and its timing varies with
+// load, so this only reports. The ratio is conservative - powf/log10f cost
+// a Cortex-M7 more, relative to a divide, than they cost a desktop core.
+static void test_benchmark_max_boost(void) {
+    using Clock = std::chrono::steady_clock;
+    srand(99);
+    PEQBand bands[MAX_PEQ_BANDS];
+    randomCurve(bands, MAX_PEQ_BANDS);
+    for (PEQBand& b : bands) b.enabled = true;
+
+    const int reps = 2000;
+    volatile float sink = 0.0f;
+    auto start = Clock::now();
+    for (int r = 0; r < reps; r++) sink = sink + sweepMaxBoostDb(bands, MAX_PEQ_BANDS, 100);
+    const double sweepUs = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / reps;
+    start = Clock::now();
+    for (int r = 0; r < reps; r++) sink = sink + peqMaxBoostDb(bands, MAX_PEQ_BANDS);
+    const double fastUs = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / reps;
+
+    char msg[128];
+    snprintf(msg, sizeof(msg), "max boost, 15 bands: search %.2f us, 100-point sweep %.2f us", fastUs, sweepUs);
+    TEST_MESSAGE(msg);
+}
+
 void setUp(void) {}
 void tearDown(void) {}
 
@@ -179,5 +275,8 @@ int main(int, char**) {
     RUN_TEST(test_edge_clamps);
     RUN_TEST(test_freq_clamp_tracks_sample_rate);
     RUN_TEST(test_bell_shape_anchors);
+    RUN_TEST(test_max_boost_matches_dense_sweep);
+    RUN_TEST(test_max_boost_edge_cases);
+    RUN_TEST(test_benchmark_max_boost);
     return UNITY_END();
 }
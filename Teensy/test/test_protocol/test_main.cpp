@@ -96,12 +96,14 @@ static const ProtocolCase kProtocolCases[] = {
     {CMD_SET_OUTPUT_EQ, "3", "2", "1000.0 1.41 -4.50", nullptr, nullptr, 5},
     {CMD_RESET_OUTPUT_EQ, "3", "4", nullptr, nullptr, nullptr, 2},
     {CMD_SET_OUTPUT_EQ_ENABLED, "3", "0", nullptr, nullptr, nullptr, 2},
-    {CMD_SET_INPUT_EQ, "2", "1000.0 1.41 -4.50", nullptr, nullptr, nullptr, 4},
-    {CMD_RESET_INPUT_EQ, "5", nullptr, nullptr, nullptr, nullptr, 1},
+    {CMD_SET_INPUT_EQ, "1", "2", "1000.0 1.41 -4.50", nullptr, nullptr, 5},
+    {CMD_RESET_INPUT_EQ, "1", "5", nullptr, nullptr, nullptr, 2},
     {CMD_SET_INPUT_EQ_ENABLED, "1", nullptr, nullptr, nullptr, nullptr, 1},
+    {CMD_SET_INPUT_EQ_SPL, "100.0", "0 70 -1", nullptr, nullptr, nullptr, 4},
     {CMD_SET_FIR, "3", "DeskL.wav", nullptr, nullptr, nullptr, 2},
     {CMD_SET_FIR_ENABLED, "1", nullptr, nullptr, nullptr, nullptr, 1},
     {CMD_LOAD_FIR_FILES, nullptr, nullptr, nullptr, nullptr, nullptr, 0},
+    {CMD_SET_OUTPUT_FIR_COMPILED, "3", "1", nullptr, nullptr, nullptr, 2},
     {CMD_GET_FILES, nullptr, nullptr, nullptr, nullptr, nullptr, 0},
     {CMD_SET_DELAYS_ENABLED, "1", nullptr, nullptr, nullptr, nullptr, 1},
     {CMD_SET_SPEAKER_GAINS, "1.00", "0.90", "0.80", nullptr, nullptr, 3},
@@ -111,6 +113,7 @@ static const ProtocolCase kProtocolCases[] = {
     {CMD_STOP_TONE, nullptr, nullptr, nullptr, nullptr, nullptr, 0},
     {CMD_SET_NOISE, "25.00", nullptr, nullptr, nullptr, nullptr, 1},
     {CMD_SET_RTA, "1", nullptr, nullptr, nullptr, nullptr, 1},
+    {CMD_SET_RTA_BANK, "1", nullptr, nullptr, nullptr, nullptr, 1},
     {CMD_SET_VU, "1", nullptr, nullptr, nullptr, nullptr, 1},
     {CMD_SET_PLAYBACK_GAIN, "0.80", nullptr, nullptr, nullptr, nullptr, 1},
     // setCompBand carries "<thr> <ratio> <atk> <rel> <mk>" as one builder
@@ -123,8 +126,10 @@ static const ProtocolCase kProtocolCases[] = {
     {CMD_SET_COMP_STRENGTH, "70.00", nullptr, nullptr, nullptr, nullptr, 1},
     {CMD_SET_COMP_VOICE_PRIORITY, "6.00", nullptr, nullptr, nullptr, nullptr, 1},
     {CMD_SET_GRM, "1", nullptr, nullptr, nullptr, nullptr, 1},
-    {CMD_START_DELAY_PROBE, "255", "50", nullptr, nullptr, nullptr, 2},
+    {CMD_START_DELAY_PROBE, "255", "50", "1", nullptr, nullptr, 3},
     {CMD_STOP_DELAY_PROBE, nullptr, nullptr, nullptr, nullptr, nullptr, 0},
+    {CMD_START_IR_MEASURE, "3", "50", nullptr, nullptr, nullptr, 2},
+    {CMD_STOP_IR_MEASURE, nullptr, nullptr, nullptr, nullptr, nullptr, 0},
     {CMD_SOLO_OUTPUT, "3", nullptr, nullptr, nullptr, nullptr, 1},
     {CMD_START_RECORDING, nullptr, nullptr, nullptr, nullptr, nullptr, 0},
     {CMD_STOP_RECORDING, nullptr, nullptr, nullptr, nullptr, nullptr, 0},
@@ -132,6 +137,8 @@ static const ProtocolCase kProtocolCases[] = {
     {CMD_PLAY_RECORDING, "rec-001.wav", nullptr, nullptr, nullptr, nullptr, 1},
     {CMD_STOP_PLAYBACK, nullptr, nullptr, nullptr, nullptr, nullptr, 0},
     {CMD_DELETE_RECORDING, "rec-001.wav", nullptr, nullptr, nullptr, nullptr, 1},
+    {CMD_SET_LEVEL_LOG, "1", nullptr, nullptr, nullptr, nullptr, 1},
+    {CMD_GET_LEVEL_LOG, "-3600", "3600", "12", nullptr, nullptr, 3},
     {CMD_SET_MUTE, "1", nullptr, nullptr, nullptr, nullptr, 1},
     {CMD_SET_MUTE_PERCENT, "50.00", nullptr, nullptr, nullptr, nullptr, 1},
     {CMD_PING, nullptr, nullptr, nullptr, nullptr, nullptr, 0},
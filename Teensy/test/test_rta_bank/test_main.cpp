@@ -0,0 +1,180 @@
+// RtaBank tests: the 512-point tables and band plan, per-channel isolation
+// (a tone on one output shows only in that output's spectrum), the
+// round-robin scheduler's fairness under a tight FFT budget, and the
+// publish/restart bookkeeping.
+
+#include <unity.h>
+
+#include <cmath>
+#include <vector>
+
+#include "RtaBank.h"
+
+static const float FS = 44100.0f;
+static const int BLOCK = 128;
+
+static std::vector<float> arena(RtaBank::ARENA_FLOATS);
+static RtaBank bank(FS, arena.data());
+
+// Same 121-band set as fir_filters.ino / WebUI rta.js
+static const int K_LO = 52;
+static const int NUM_BANDS = 121;
+static float bandCenter(int k) { return powf(10.0f, k / 40.0f); }
+static bool setStandardBands(void) {
+  float lo[NUM_BANDS], hi[NUM_BANDS];
+  for (int b = 0; b < NUM_BANDS; b++) {
+    lo[b] = bandCenter(K_LO + b) * 0.971628f;
+    hi[b] = bandCenter(K_LO + b) * 1.029200f;
+  }
+  return bank.setBands(lo, hi, NUM_BANDS);
+}
+
+static float levels[RTA_MAX_BANDS];
+static float bandDb(int k) {
+  float p = levels[k - K_LO];
+  return (p > 1e-10f) ? 10.0f * log10f(p) : -100.0f;
+}
+
+// Channel ch carries a full-scale sine at hz (0 = silence), every other
+// channel silence. Feeds `seconds`, servicing at most `fftsPerBlock` due
+// segments per block (a negative budget services everything).
+static double phase[RTA_BANK_CHANNELS];
+static void feed(const float* hz, float seconds, int fftsPerBlock = -1) {
+  int16_t block[BLOCK];
+  int blocks = (int)(seconds * FS / BLOCK);
+  for (int b = 0; b < blocks; b++) {
+    for (int ch = 0; ch < RTA_BANK_CHANNELS; ch++) {
+      for (int i = 0; i < BLOCK; i++) {
+        block[i] = hz[ch] > 0.0f ? (int16_t)lrint(32767.0 * sin(phase[ch])) : 0;
+        phase[ch] += 2.0 * M_PI * hz[ch] / FS;
+      }
+      bank.push(ch, block, BLOCK);
+    }
+    int ch, s;
+    for (int n = 0; n != fftsPerBlock && bank.nextDue(ch, s); n++) {
+      bank.snapshot(ch, s);
+      bank.transform(ch, s);
+    }
+  }
+}
+
+void setUp(void) {
+  bank.reset();
+  for (double& p : phase) p = 0.0;
+}
+void tearDown(void) {}
+
+static void test_band_table_fits(void) {
+  TEST_ASSERT_EQUAL(NUM_BANDS, bank.bandCount());
+  TEST_ASSERT_TRUE(bank.bandWeightCount() <= RTA_BANK_MAX_BAND_WEIGHTS);
+  // Half the FFT size moves each crossover an octave-ish down the stages
+  TEST_ASSERT_EQUAL(0, bank.stageFor(4858.0f, 5146.0f));
+  TEST_ASSERT_EQUAL(1, bank.stageFor(971.6f, 1029.2f));
+  TEST_ASSERT_EQUAL(2, bank.stageFor(97.16f, 102.92f));
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 5.38f, bank.binWidthHz(2));
+}
+
+static void test_not_ready_until_every_stage_reports(void) {
+  const float hz[RTA_BANK_CHANNELS] = {0};
+  // The /16 ring needs 16 * 512 input samples = 64 blocks
+  feed(hz, 63 * BLOCK / FS + 1e-4f);
+  TEST_ASSERT_FALSE(bank.ready(0));
+  TEST_ASSERT_FALSE(bank.publish(0, levels));
+  feed(hz, BLOCK / FS + 1e-4f);
+  for (int ch = 0; ch < RTA_BANK_CHANNELS; ch++) TEST_ASSERT_TRUE(bank.ready(ch));
+}
+
+static void test_each_channel_sees_only_its_own_signal(void) {
+  // A different band per channel: 10kHz, 1kHz and 100Hz cover all stages
+  const int ks[RTA_BANK_CHANNELS] = {160, 120, 80, 140, 100, 90, 150, 110, 130};
+  float hz[RTA_BANK_CHANNELS];
+  for (int ch = 0; ch < RTA_BANK_CHANNELS; ch++) hz[ch] = bandCenter(ks[ch]);
+  feed(hz, 0.5f);
+  for (int ch = 0; ch < RTA_BANK_CHANNELS; ch++) {
+    TEST_ASSERT_TRUE(bank.publish(ch, levels));
+    TEST_ASSERT_FLOAT_WITHIN(2.5f, 0.0f, bandDb(ks[ch]));
+    // Nothing of the other channels' tones
+    for (int other = 0; other < RTA_BANK_CHANNELS; other++) {
+      if (other == ch) continue;
+      TEST_ASSERT_TRUE(bandDb(ks[other]) < -60.0f);
+    }
+  }
+}
+
+static void test_only_the_driven_output_shows_energy(void) {
+  float hz[RTA_BANK_CHANNELS] = {0};
+  hz[3] = 1000.0f;
+  feed(hz, 0.5f);
+  for (int ch = 0; ch < RTA_BANK_CHANNELS; ch++) {
+    TEST_ASSERT_TRUE(bank.publish(ch, levels));
+    const float db = bandDb(120);
+    if (ch == 3) TEST_ASSERT_TRUE(db > -3.0f);
+    else TEST_ASSERT_TRUE(db < -90.0f);
+  }
+}
+
+static void test_round_robin_is_fair_under_a_tight_budget(void) {
+  // One FFT per 128-sample block (~345/s) is far below the ~2000/s the
+  // nine channels fall due at, yet every channel's slow stages still get
+  // serviced - no channel or stage starves behind stage 0's steady stream
+  const int ks[RTA_BANK_CHANNELS] = {160, 120, 80, 140, 100, 90, 150, 110, 130};
+  float hz[RTA_BANK_CHANNELS];
+  for (int ch = 0; ch < RTA_BANK_CHANNELS; ch++) hz[ch] = bandCenter(ks[ch]);
+  feed(hz, 1.0f, 1);
+  for (int ch = 0; ch < RTA_BANK_CHANNELS; ch++) {
+    TEST_ASSERT_TRUE(bank.ready(ch));
+    TEST_ASSERT_TRUE(bank.publish(ch, levels));
+    TEST_ASSERT_FLOAT_WITHIN(2.5f, 0.0f, bandDb(ks[ch]));
+  }
+}
+
+static void test_publish_restarts_the_average(void) {
+  float hz[RTA_BANK_CHANNELS] = {0};
+  hz[0] = 1000.0f;
+  feed(hz, 0.5f);
+  TEST_ASSERT_TRUE(bank.publish(0, levels));
+  TEST_ASSERT_TRUE(bandDb(120) > -3.0f);
+  // Republishing with nothing new repeats the last average
+  TEST_ASSERT_TRUE(bank.publish(0, levels));
+  TEST_ASSERT_TRUE(bandDb(120) > -3.0f);
+  // Once the tone stops, the frame after the one that saw it fade covers
+  // only silent segments: each publish restarts the average rather than
+  // diluting the new segments into everything since reset (the 1kHz band
+  // lives on the /4 stage: 46ms windows)
+  hz[0] = 0.0f;
+  feed(hz, 0.2f);
+  TEST_ASSERT_TRUE(bank.publish(0, levels));
+  feed(hz, 0.1f);
+  TEST_ASSERT_TRUE(bank.publish(0, levels));
+  TEST_ASSERT_TRUE(bandDb(120) < -60.0f);
+}
+
+static void test_rebuild_recovers_a_borrowed_arena(void) {
+  // The IR measurement scribbles over the whole arena while it has it
+  for (float& v : arena) v = 12345.0f;
+  bank.rebuild();
+  TEST_ASSERT_EQUAL(0, bank.bandCount());
+  TEST_ASSERT_TRUE(setStandardBands());
+  float hz[RTA_BANK_CHANNELS] = {0};
+  hz[5] = bandCenter(90);
+  feed(hz, 0.5f);
+  for (int ch = 0; ch < RTA_BANK_CHANNELS; ch++) {
+    TEST_ASSERT_TRUE(bank.publish(ch, levels));
+    const float db = bandDb(90);
+    if (ch == 5) TEST_ASSERT_FLOAT_WITHIN(2.5f, 0.0f, db);
+    else TEST_ASSERT_TRUE(db < -90.0f);
+  }
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  setStandardBands();
+  RUN_TEST(test_band_table_fits);
+  RUN_TEST(test_not_ready_until_every_stage_reports);
+  RUN_TEST(test_each_channel_sees_only_its_own_signal);
+  RUN_TEST(test_only_the_driven_output_shows_energy);
+  RUN_TEST(test_round_robin_is_fair_under_a_tight_budget);
+  RUN_TEST(test_publish_restarts_the_average);
+  RUN_TEST(test_rebuild_recovers_a_borrowed_arena);
+  return UNITY_END();
+}
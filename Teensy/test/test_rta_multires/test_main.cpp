@@ -0,0 +1,239 @@
+// RtaMultiRes tests: the half-band decimator's passband and stopband, the
+// band-to-stage plan and sparse weight table, and end-to-end band levels
+// for tones fed through the whole cascade - including the bass resolution
+// the single 4096-point FFT could not deliver, the alias rejection the
+// decimators exist for, the frame-to-frame steadiness Welch averaging
+// buys on noise, and float input past full scale.
+
+#include <unity.h>
+
+#include <cmath>
+#include <vector>
+
+#include "RtaMultiRes.h"
+
+static const float FS = 44100.0f;
+static const int BLOCK = 128;
+
+static std::vector<float> arena(RtaMultiRes::ARENA_FLOATS);
+static RtaMultiRes rta(FS, arena.data());
+
+// Same band definition as fir_filters.ino / WebUI rta.js: 121 bands,
+// centers 10^(k/40) for k = 52..172, edges a twelfth of an octave apart
+static const int K_LO = 52;
+static const int NUM_BANDS = 121;
+static float bandCenter(int k) { return powf(10.0f, k / 40.0f); }
+static bool setStandardBands(void) {
+  float lo[NUM_BANDS], hi[NUM_BANDS];
+  for (int b = 0; b < NUM_BANDS; b++) {
+    lo[b] = bandCenter(K_LO + b) * 0.971628f;
+    hi[b] = bandCenter(K_LO + b) * 1.029200f;
+  }
+  return rta.setBands(lo, hi, NUM_BANDS);
+}
+static float bandDb(int k) {
+  float p = rta.bandPower(k - K_LO);
+  return (p > 1e-10f) ? 10.0f * log10f(p) : -100.0f;
+}
+
+// Feed `seconds` of a sine (amplitude relative to full scale), then analyze
+// the latest window of each stage
+static void feedSine(float hz, float amplitude, float seconds) {
+  static double phase = 0.0;
+  int16_t block[BLOCK];
+  int blocks = (int)(seconds * FS / BLOCK);
+  for (int b = 0; b < blocks; b++) {
+    for (int i = 0; i < BLOCK; i++) {
+      block[i] = (int16_t)lrint(amplitude * 32767.0 * sin(phase));
+      phase += 2.0 * M_PI * hz / FS;
+    }
+    rta.push(block, BLOCK);
+  }
+  rta.analyze();
+}
+
+void setUp(void) { rta.reset(); }
+void tearDown(void) {}
+
+// --- Half-band decimator ---
+
+// Amplitude of a decimated sine at `frac` of the input rate, after settling
+static float halfBandGain(float frac) {
+  RtaHalfBand hb;
+  float in[BLOCK], out[BLOCK / 2];
+  double phase = 0.0, peak = 0.0;
+  for (int b = 0; b < 40; b++) {
+    for (int i = 0; i < BLOCK; i++) {
+      in[i] = (float)sin(phase);
+      phase += 2.0 * M_PI * frac;
+    }
+    hb.process(in, BLOCK, out);
+    if (b < 4) continue; // filter warm-up
+    for (int i = 0; i < BLOCK / 2; i++) peak = fmax(peak, fabs(out[i]));
+  }
+  return (float)peak;
+}
+
+static void test_half_band_passband_is_flat(void) {
+  TEST_ASSERT_FLOAT_WITHIN(0.002f, 1.0f, halfBandGain(0.01f));
+  TEST_ASSERT_FLOAT_WITHIN(0.002f, 1.0f, halfBandGain(0.15f));
+}
+
+static void test_half_band_stopband_rejects(void) {
+  // Anything from 0.35 fs up would alias into the usable band: >75dB down
+  TEST_ASSERT_TRUE(halfBandGain(0.36f) < 1.8e-4f);
+  TEST_ASSERT_TRUE(halfBandGain(0.45f) < 1.8e-4f);
+}
+
+// --- Stage plan ---
+
+static void test_stage_plan(void) {
+  // Treble: the full-rate stage's 43Hz bins are fine-grained enough
+  TEST_ASSERT_EQUAL(0, rta.stageFor(19430.0f, 20580.0f));
+  TEST_ASSERT_EQUAL(0, rta.stageFor(4858.0f, 5146.0f));
+  // Midrange: the /4 stage
+  TEST_ASSERT_EQUAL(1, rta.stageFor(971.6f, 1029.2f));
+  // Bass: the /16 stage, with 2.69Hz bins (4x the old 10.77Hz)
+  TEST_ASSERT_EQUAL(2, rta.stageFor(97.16f, 102.92f));
+  TEST_ASSERT_EQUAL(2, rta.stageFor(19.43f, 20.58f));
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 2.69f, rta.binWidthHz(2));
+}
+
+// --- Sparse band table ---
+
+static void test_band_table_fits(void) {
+  TEST_ASSERT_EQUAL(NUM_BANDS, rta.bandCount());
+  TEST_ASSERT_TRUE(rta.bandWeightCount() <= RTA_MAX_BAND_WEIGHTS);
+  // Far more bands than the table holds: keeps what fits, reports it
+  static float lo[200], hi[200];
+  for (int b = 0; b < 200; b++) { lo[b] = 20.0f + b; hi[b] = 20000.0f; }
+  TEST_ASSERT_FALSE(rta.setBands(lo, hi, 200));
+  TEST_ASSERT_TRUE(rta.bandCount() < 200);
+  TEST_ASSERT_TRUE(setStandardBands());
+}
+
+// --- End to end ---
+
+static void test_ready_after_slowest_ring_fills(void) {
+  int16_t block[BLOCK] = {0};
+  // The /16 ring needs 16 * 1024 input samples = 128 blocks
+  for (int b = 0; b < 127; b++) rta.push(block, BLOCK);
+  rta.analyze();
+  TEST_ASSERT_FALSE(rta.ready());
+  rta.push(block, BLOCK);
+  TEST_ASSERT_EQUAL(2, rta.segmentDue()); // the /16 ring just filled
+  rta.analyze();
+  TEST_ASSERT_TRUE(rta.ready());
+  TEST_ASSERT_EQUAL(-1, rta.segmentDue());
+  // Half a window later stage 0 is due again (50% overlap)
+  for (int b = 0; b < RtaMultiRes::HOP / BLOCK; b++) rta.push(block, BLOCK);
+  TEST_ASSERT_EQUAL(0, rta.segmentDue());
+  rta.reset();
+  TEST_ASSERT_FALSE(rta.ready());
+}
+
+static void test_full_scale_tone_reads_near_0db_on_every_stage(void) {
+  // k = 160 (10kHz, stage 0), 120 (1kHz, stage 1), 80 (100Hz, stage 2)
+  const int ks[] = {160, 120, 80};
+  for (int k : ks) {
+    rta.reset();
+    feedSine(bandCenter(k), 1.0f, 0.5f);
+    TEST_ASSERT_FLOAT_WITHIN(2.5f, 0.0f, bandDb(k));
+    // An octave away there is nothing
+    TEST_ASSERT_TRUE(bandDb(k - 12) < -60.0f);
+    TEST_ASSERT_TRUE(bandDb(k + 12) < -60.0f);
+  }
+}
+
+static void test_bass_bands_are_resolved(void) {
+  // 40Hz (k = 64): with 10.77Hz bins the bands two twelfths away (35.6Hz
+  // and 44.9Hz) shared its bin and read the same level
+  feedSine(bandCenter(64), 1.0f, 0.5f);
+  float peak = bandDb(64);
+  TEST_ASSERT_TRUE(peak > -3.0f);
+  TEST_ASSERT_TRUE(bandDb(60) < peak - 20.0f);
+  TEST_ASSERT_TRUE(bandDb(68) < peak - 20.0f);
+}
+
+static void test_treble_does_not_alias_into_the_bass(void) {
+  // 10kHz (0.23 fs) is past the first /2's passband and lands deep in the
+  // second's stopband; a leak would fold onto the decimated stages' bands
+  feedSine(10000.0f, 1.0f, 0.5f);
+  for (int k = 52; k <= 112; k++) {
+    TEST_ASSERT_TRUE(bandDb(k) < -70.0f);
+  }
+}
+
+// Frame-to-frame standard deviation (dB) of one band over 20 frames of
+// white noise, 100ms apart. Welch: every due segment is analyzed as the
+// audio streams in. Otherwise: one snapshot per frame, as before.
+static float noiseFrameSpreadDb(int k, bool welch) {
+  uint32_t rng = 12345;
+  int16_t block[BLOCK];
+  const int blocksPerFrame = (int)(0.1f * FS / BLOCK);
+  double sum = 0.0, sumSq = 0.0;
+  int frames = 0;
+  for (int f = 0; f < 24; f++) {
+    for (int b = 0; b < blocksPerFrame; b++) {
+      for (int i = 0; i < BLOCK; i++) {
+        rng ^= rng << 13; rng ^= rng >> 17; rng ^= rng << 5;
+        block[i] = (int16_t)((int32_t)(rng >> 16) - 32768) / 4;
+      }
+      rta.push(block, BLOCK);
+      int s;
+      while (welch && (s = rta.segmentDue()) >= 0) {
+        rta.snapshot(s);
+        rta.transform(s);
+      }
+    }
+    rta.analyze();
+    if (f < 4 || !rta.ready()) continue; // let the slow stages fill
+    double db = bandDb(k);
+    sum += db;
+    sumSq += db * db;
+    frames++;
+  }
+  double mean = sum / frames;
+  return (float)sqrt(sumSq / frames - mean * mean);
+}
+
+// A float tap (AudioStreamF32) carries a 6dB boost the int16 path clipped
+static void test_float_input_reads_past_full_scale(void) {
+  double phase = 0.0;
+  float block[BLOCK];
+  const float hz = bandCenter(120); // 1kHz, stage 1
+  for (int b = 0; b < (int)(0.5f * FS / BLOCK); b++) {
+    for (int i = 0; i < BLOCK; i++) {
+      block[i] = (float)(2.0 * sin(phase));
+      phase += 2.0 * M_PI * hz / FS;
+    }
+    rta.push(block, BLOCK);
+  }
+  rta.analyze();
+  TEST_ASSERT_FLOAT_WITHIN(2.5f, 6.02f, bandDb(120));
+  TEST_ASSERT_TRUE(bandDb(120 - 12) < -54.0f);
+}
+
+static void test_welch_averaging_steadies_noise(void) {
+  // k = 160 (10kHz, stage 0): ~8.6 segments per frame
+  const float single = noiseFrameSpreadDb(160, false);
+  rta.reset();
+  const float welch = noiseFrameSpreadDb(160, true);
+  TEST_ASSERT_TRUE(welch < single * 0.6f);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  setStandardBands();
+  RUN_TEST(test_half_band_passband_is_flat);
+  RUN_TEST(test_half_band_stopband_rejects);
+  RUN_TEST(test_stage_plan);
+  RUN_TEST(test_band_table_fits);
+  RUN_TEST(test_ready_after_slowest_ring_fills);
+  RUN_TEST(test_full_scale_tone_reads_near_0db_on_every_stage);
+  RUN_TEST(test_bass_bands_are_resolved);
+  RUN_TEST(test_treble_does_not_alias_into_the_bass);
+  RUN_TEST(test_welch_averaging_steadies_noise);
+  RUN_TEST(test_float_input_reads_past_full_scale);
+  return UNITY_END();
+}
@@ -0,0 +1,191 @@
+// TruePeakLimiter tests: transparent (just delayed) below the ceiling, never
+// past it above, inter-sample peaks caught, a gain that glides rather than
+// steps, recovery to idle, and what eight outputs of it cost (reported
+// only).
+
+#include <unity.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#include "TruePeakLimiter.h"
+
+static const float FS = 44100.0f;
+static const float PI_F = 3.14159265f;
+static const float CEILING = TruePeakLimiter::FULL_SCALE * 0.89125094f; // -1dB
+static const int L = TruePeakLimiter::LATENCY;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static std::vector<int16_t> run(TruePeakLimiter& lim, const std::vector<float>& in) {
+    std::vector<int16_t> out(in.size());
+    lim.process(in.data(), out.data(), (int)in.size());
+    return out;
+}
+
+static std::vector<float> sine(int n, float amplitude, float hz, float phase = 0.0f) {
+    std::vector<float> v(n);
+    for (int i = 0; i < n; i++) v[i] = amplitude * sinf(2.0f * PI_F * hz * i / FS + phase);
+    return v;
+}
+
+static void test_below_the_ceiling_only_delays(void) {
+    TruePeakLimiter lim;
+    lim.begin(FS);
+    std::vector<float> in = sine(2000, 16000.0f, 997.0f);
+    for (float& s : in) s = truncf(s);
+    std::vector<int16_t> out = run(lim, in);
+    for (int i = 0; i < L; i++) TEST_ASSERT_EQUAL_INT16(0, out[i]);
+    for (int i = L; i < (int)in.size(); i++) TEST_ASSERT_EQUAL_INT16((int16_t)in[i - L], out[i]);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, lim.takeMinGain());
+}
+
+static void test_output_never_passes_the_ceiling(void) {
+    TruePeakLimiter lim;
+    lim.begin(FS);
+    // Noise bursts and spikes up to +10dB over full scale, no two alike
+    srand(7);
+    std::vector<float> in(44100);
+    for (int i = 0; i < (int)in.size(); i++) {
+        const float burst = (i / 2000) % 3 == 0 ? 3.16f : 0.4f;
+        in[i] = burst * 32767.0f * ((float)rand() / RAND_MAX * 2.0f - 1.0f);
+        if (i % 1777 == 0) in[i] = 3.0f * 32767.0f;
+    }
+    std::vector<int16_t> out = run(lim, in);
+    for (int16_t s : out) TEST_ASSERT_TRUE(std::abs((int)s) <= (int)CEILING + 1);
+    TEST_ASSERT_TRUE(lim.takeMinGain() < 0.35f);
+}
+
+static void test_inter_sample_peak_is_estimated(void) {
+    TruePeakLimiter lim;
+    lim.begin(FS);
+    // fs/4 peaking halfway between x[3] and x[4]: both sit at 0.707 of it
+    float x[TruePeakLimiter::TAPS];
+    for (int i = 0; i < TruePeakLimiter::TAPS; i++) x[i] = 10000.0f * sinf(PI_F / 2.0f * i + 3.0f * PI_F / 4.0f);
+    TEST_ASSERT_FLOAT_WITHIN(7072.0f * 0.02f, 7071.0f, fabsf(x[3]));
+    TEST_ASSERT_FLOAT_WITHIN(10000.0f * 0.03f, 10000.0f, lim.slotPeak(x));
+}
+
+static void test_inter_sample_overs_are_limited(void) {
+    TruePeakLimiter lim;
+    lim.begin(FS);
+    // Sample peaks 0.707 of full scale - under the ceiling - true peak 0dBFS
+    std::vector<float> in = sine(8000, 32767.0f, FS / 4.0f, PI_F / 4.0f);
+    std::vector<int16_t> out = run(lim, in);
+    const float g = lim.takeMinGain();
+    TEST_ASSERT_FLOAT_WITHIN(0.03f, CEILING / 32767.0f, g);
+    // Settled: the samples sit at the ceiling's share of 0.707
+    const float expected = 32767.0f * 0.7071f * g;
+    TEST_ASSERT_FLOAT_WITHIN(expected * 0.01f, expected, (float)std::abs((int)out[7000]));
+}
+
+static void test_gain_glides_into_a_peak(void) {
+    TruePeakLimiter lim;
+    lim.begin(FS);
+    // A steady tone under the ceiling with one sample at 2x full scale: the
+    // tone must be turned down gradually ahead of it, never stepped
+    std::vector<float> in(3000, 8000.0f);
+    in[1500] = 65534.0f;
+    std::vector<int16_t> out = run(lim, in);
+    const int peakOut = 1500 + L;
+    TEST_ASSERT_TRUE(std::abs((int)out[peakOut]) <= (int)CEILING + 1);
+    TEST_ASSERT_TRUE(out[peakOut] > (int)CEILING - 40);
+    // Before the peak: 8000 falling smoothly, at most one LOOKAHEAD-th of the
+    // reduction per sample
+    const float maxStep = 8000.0f * 0.6f / TruePeakLimiter::LOOKAHEAD + 2.0f;
+    for (int i = peakOut - TruePeakLimiter::LOOKAHEAD; i < peakOut - 1; i++) {
+        TEST_ASSERT_TRUE(out[i + 1] <= out[i]);
+        TEST_ASSERT_TRUE(out[i] - out[i + 1] <= maxStep);
+    }
+    // Untouched until the interpolator's look-forward first sees it
+    TEST_ASSERT_TRUE(out[peakOut - TruePeakLimiter::LOOKAHEAD - TruePeakLimiter::TAPS] == 8000);
+}
+
+static void test_recovers_and_goes_idle(void) {
+    TruePeakLimiter lim;
+    lim.begin(FS);
+    TEST_ASSERT_TRUE(lim.idle());
+    std::vector<float> in(200, 0.0f);
+    in[50] = 60000.0f;
+    run(lim, in);
+    TEST_ASSERT_FALSE(lim.idle());
+    // 50ms release: about a second of silence fully recovers
+    std::vector<int16_t> out(128);
+    for (int b = 0; b < 400; b++) lim.process(nullptr, out.data(), 128);
+    TEST_ASSERT_TRUE(lim.idle());
+    for (int16_t s : out) TEST_ASSERT_EQUAL_INT16(0, s);
+
+    // Sound after idling comes through untouched again
+    std::vector<float> tone = sine(600, 10000.0f, 440.0f);
+    for (float& s : tone) s = truncf(s);
+    lim.takeMinGain();
+    std::vector<int16_t> back = run(lim, tone);
+    for (int i = L; i < 600; i++) TEST_ASSERT_EQUAL_INT16((int16_t)tone[i - L], back[i]);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, lim.takeMinGain());
+}
+
+static void test_block_size_does_not_matter(void) {
+    TruePeakLimiter a, b;
+    a.begin(FS);
+    b.begin(FS);
+    srand(3);
+    std::vector<float> in(1000);
+    for (float& s : in) s = 50000.0f * ((float)rand() / RAND_MAX * 2.0f - 1.0f);
+    std::vector<int16_t> whole = run(a, in);
+    std::vector<int16_t> parts(in.size());
+    const int sizes[] = {1, 7, 128, 300, 64};
+    int at = 0;
+    for (int i = 0; at < (int)in.size(); i++) {
+        int n = sizes[i % 5];
+        if (at + n > (int)in.size()) n = (int)in.size() - at;
+        b.process(in.data() + at, parts.data() + at, n);
+        at += n;
+    }
+    for (size_t i = 0; i < in.size(); i++) TEST_ASSERT_EQUAL_INT16(whole[i], parts[i]);
+}
+
+// --- benchmark ---
+
+// Eight outputs limiting hard the whole time (every slot interpolated, the
+// window always busy), as a share of real time. The Teensy is several
+// times slower than a desktop core and host timing varies with load, so
+// this only reports.
+static void test_benchmark_eight_outputs(void) {
+    using Clock = std::chrono::steady_clock;
+    const int SECONDS = 2;
+    TruePeakLimiter lim[8];
+    for (TruePeakLimiter& l : lim) l.begin(FS);
+    std::vector<float> block(128);
+    srand(11);
+    for (float& s : block) s = 60000.0f * ((float)rand() / RAND_MAX * 2.0f - 1.0f);
+    int16_t out[128];
+
+    const auto start = Clock::now();
+    const int blocks = (int)(SECONDS * FS / 128);
+    for (int b = 0; b < blocks; b++) {
+        for (TruePeakLimiter& l : lim) l.process(block.data(), out, 128);
+    }
+    const double us = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+
+    char msg[120];
+    const double nsPerSample = us * 1000.0 / (8.0 * blocks * 128);
+    snprintf(msg, sizeof(msg), "8 outputs, worst case: %.1f ns/sample, %.2f%% of real time",
+             nsPerSample, us / (SECONDS * 1e6) * 100.0);
+    TEST_MESSAGE(msg);
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_below_the_ceiling_only_delays);
+    RUN_TEST(test_output_never_passes_the_ceiling);
+    RUN_TEST(test_inter_sample_peak_is_estimated);
+    RUN_TEST(test_inter_sample_overs_are_limited);
+    RUN_TEST(test_gain_glides_into_a_peak);
+    RUN_TEST(test_recovers_and_goes_idle);
+    RUN_TEST(test_block_size_does_not_matter);
+    RUN_TEST(test_benchmark_eight_outputs);
+    return UNITY_END();
+}
@@ -0,0 +1,105 @@
+// UsbLatencyTarget tests: a steady host walks the target down to a block
+// plus its packet period plus margin, never faster than the shrink rate; a
+// stall raises it at the grow rate and a stream start takes it at once; a
+// starve only counts when the stream comes back; the bounds hold.
+
+#include <unity.h>
+
+#include "UsbLatencyTarget.h"
+
+namespace {
+
+const float BLOCK_MS = 128 * 1000.0f / 44117.647f;
+const int UPDATES_PER_S = 345;
+
+// Run n updates of a host delivering every gapUs
+void run(UsbLatencyTarget& t, int n, uint32_t gapUs) {
+    for (int i = 0; i < n; i++) t.update(gapUs, false);
+}
+
+} // namespace
+
+void setUp() {}
+void tearDown() {}
+
+static void test_starts_at_the_old_fixed_target() {
+    UsbLatencyTarget t(BLOCK_MS);
+    TEST_ASSERT_EQUAL_FLOAT(UsbLatencyTarget::START_MS, t.targetMs());
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, UsbLatencyTarget::START_MS, t.wantedMs());
+}
+
+static void test_steady_host_shrinks_slowly() {
+    UsbLatencyTarget t(BLOCK_MS);
+    float prev = t.targetMs();
+    for (int s = 0; s < 600; s++) {
+        run(t, UPDATES_PER_S, 1050);
+        // Never faster than the shrink rate, never up
+        TEST_ASSERT_TRUE(t.targetMs() <= prev);
+        TEST_ASSERT_TRUE(prev - t.targetMs() <= UsbLatencyTarget::SHRINK_MS_PER_S * 1.01f);
+        prev = t.targetMs();
+    }
+    // Ten minutes on: a block, the packet period and the margin
+    const float floorMs = BLOCK_MS + 1.05f + UsbLatencyTarget::MARGIN_MS;
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, floorMs, t.targetMs());
+    TEST_ASSERT_TRUE(t.targetMs() < UsbLatencyTarget::START_MS - 2.0f);
+}
+
+static void test_stall_grows_at_rate_and_start_jumps() {
+    UsbLatencyTarget t(BLOCK_MS);
+    run(t, 600 * UPDATES_PER_S, 1000);
+    const float settled = t.targetMs();
+    // One 10ms host stall: wanted follows at once, the servo target doesn't
+    t.update(10000, false);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, BLOCK_MS + 10.0f + UsbLatencyTarget::MARGIN_MS, t.wantedMs());
+    TEST_ASSERT_TRUE(t.targetMs() - settled < 0.01f);
+    run(t, UPDATES_PER_S, 1000);
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, settled + UsbLatencyTarget::GROW_MS_PER_S, t.targetMs());
+    // A stream start takes the learned target in one go
+    t.streamStarted();
+    TEST_ASSERT_EQUAL_FLOAT(t.wantedMs(), t.targetMs());
+    // And a second doesn't forget the stall
+    run(t, UPDATES_PER_S, 1000);
+    TEST_ASSERT_TRUE(t.wantedMs() > BLOCK_MS + 9.0f + UsbLatencyTarget::MARGIN_MS);
+}
+
+static void test_starve_counts_once_the_stream_recovers() {
+    UsbLatencyTarget t(BLOCK_MS);
+    run(t, 600 * UPDATES_PER_S, 1000);
+    const float settled = t.wantedMs();
+    // A host that stopped: starves until the stop is detected, then the
+    // next stream starts - no bump
+    for (int i = 0; i < 34; i++) t.update(0, true);
+    t.streamStarted();
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, settled, t.wantedMs());
+    // A starve run the stream comes back from: one bump, however long
+    for (int i = 0; i < 3; i++) t.update(1000, true);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, settled, t.wantedMs());
+    t.update(1000, false);
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, settled + UsbLatencyTarget::STARVE_BUMP_US / 1000.0f, t.wantedMs());
+}
+
+static void test_bounds() {
+    UsbLatencyTarget t(BLOCK_MS);
+    // An impossibly good host still keeps a block and the margin
+    run(t, 1200 * UPDATES_PER_S, 0);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, BLOCK_MS + UsbLatencyTarget::MARGIN_MS, t.targetMs());
+    TEST_ASSERT_TRUE(t.targetMs() >= UsbLatencyTarget::MIN_MS);
+    // A 60ms hiccup pins the ceiling...
+    t.update(60000, false);
+    t.streamStarted();
+    TEST_ASSERT_EQUAL_FLOAT(UsbLatencyTarget::MAX_MS, t.targetMs());
+    // ...but the way back down starts the next second, not after working
+    // off 40ms of gap nothing could have covered
+    run(t, 2 * UPDATES_PER_S, 1000);
+    TEST_ASSERT_TRUE(t.wantedMs() < UsbLatencyTarget::MAX_MS);
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_starts_at_the_old_fixed_target);
+    RUN_TEST(test_steady_host_shrinks_slowly);
+    RUN_TEST(test_stall_grows_at_rate_and_start_jumps);
+    RUN_TEST(test_starve_counts_once_the_stream_recovers);
+    RUN_TEST(test_bounds);
+    return UNITY_END();
+}
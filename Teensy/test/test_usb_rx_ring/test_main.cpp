@@ -1,6 +1,7 @@
 // UsbRxRing tests: producer/consumer accounting, int16->float conversion,
-// full-ring packet drops, the prefill gate, host-stop detection with stale
-// drain, and index wraparound (both the ring mask and micros overflow).
+// full-ring packet drops, the prefill gate (and moving it), host-stop
+// detection with stale drain, the two packet-gap peaks, index wraparound
+// (both the ring mask and micros overflow) and the silence scan across it.
 
 #include <unity.h>
 
@@ -108,6 +109,21 @@ static void test_prefill_gate() {
     TEST_ASSERT_FALSE(ring.justStarted());
 }
 
+static void test_prefill_follows_setter() {
+    UsbRxRing ring(PREFILL, STOP_GAP_US);
+    ring.setPrefill(200);
+    uint32_t now = feed(ring, 176, 0);
+    TEST_ASSERT_FALSE(ring.consumerReady(now));
+    now = feed(ring, 44, now);
+    TEST_ASSERT_TRUE(ring.consumerReady(now));
+    // Never past what the ring can hold
+    ring.setPrefill(UsbRxRing::CAPACITY + 100);
+    now += STOP_GAP_US + 1000;
+    TEST_ASSERT_FALSE(ring.consumerReady(now));
+    now = feed(ring, UsbRxRing::CAPACITY, now);
+    TEST_ASSERT_TRUE(ring.consumerReady(now));
+}
+
 static void test_stop_detection_drains_and_rearms() {
     UsbRxRing ring(PREFILL, STOP_GAP_US);
     uint32_t now = feed(ring, PREFILL, 0);
@@ -137,6 +153,22 @@ static void test_short_gap_is_not_a_stop() {
     TEST_ASSERT_EQUAL_UINT32(0, ring.stops());
 }
 
+// Telemetry and the latency adaption each read-and-reset their own peak
+static void test_gap_peaks_are_independent() {
+    UsbRxRing ring(PREFILL, STOP_GAP_US);
+    auto p = makePacket(44);
+    ring.write(p.data(), 44, 1000);
+    ring.write(p.data(), 44, 2000);
+    ring.write(p.data(), 44, 6500);
+    TEST_ASSERT_EQUAL_UINT32(4500, ring.takeMaxGapUs());
+    TEST_ASSERT_EQUAL_UINT32(0, ring.takeMaxGapUs());
+    TEST_ASSERT_EQUAL_UINT32(4500, ring.takeJitterGapUs());
+    TEST_ASSERT_EQUAL_UINT32(0, ring.takeJitterGapUs());
+    ring.write(p.data(), 44, 7600);
+    TEST_ASSERT_EQUAL_UINT32(1100, ring.takeJitterGapUs());
+    TEST_ASSERT_EQUAL_UINT32(1100, ring.takeMaxGapUs());
+}
+
 // --- wraparound ---
 
 static void test_ring_index_wrap() {
@@ -161,6 +193,20 @@ static void test_ring_index_wrap() {
     TEST_ASSERT_FLOAT_WITHIN(1e-6f, -530.0f / 32768.0f, ring.rightAt()[0]);
 }
 
+static void test_silence_scan_across_wrap() {
+    UsbRxRing ring(PREFILL, STOP_GAP_US);
+    feed(ring, UsbRxRing::CAPACITY - 30, 0);
+    ring.consume(UsbRxRing::CAPACITY - 30);
+    std::vector<int16_t> quiet(2 * 60, 0);
+    ring.write(quiet.data(), 60, 1000000);
+    TEST_ASSERT_TRUE(ring.silent(60));
+    // The ramp starts at zero, so only its second frame is signal
+    auto p = makePacket(2, 0);
+    ring.write(p.data(), 2, 1001000);
+    TEST_ASSERT_TRUE(ring.silent(61));
+    TEST_ASSERT_FALSE(ring.silent(62));
+}
+
 static void test_micros_wraparound_no_false_stop() {
     UsbRxRing ring(PREFILL, STOP_GAP_US);
     // Last packet just before the 32-bit micros counter wraps
@@ -205,9 +251,12 @@ int main(int, char**) {
     RUN_TEST(test_consume_advances);
     RUN_TEST(test_full_ring_drops_whole_packet);
     RUN_TEST(test_prefill_gate);
+    RUN_TEST(test_prefill_follows_setter);
     RUN_TEST(test_stop_detection_drains_and_rearms);
     RUN_TEST(test_short_gap_is_not_a_stop);
+    RUN_TEST(test_gap_peaks_are_independent);
     RUN_TEST(test_ring_index_wrap);
+    RUN_TEST(test_silence_scan_across_wrap);
     RUN_TEST(test_micros_wraparound_no_false_stop);
     RUN_TEST(test_packet_timestamp_ahead_of_now_is_not_a_stop);
     return UNITY_END();
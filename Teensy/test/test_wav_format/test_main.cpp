@@ -58,6 +58,21 @@ static void test_fmt_chunk_round_trips(void) {
     TEST_ASSERT_EQUAL_UINT16(16, fmt.bitsPerSample);
 }
 
+// The IR measurement's mono float32 header: format tag 3, 4-byte frames.
+static void test_build_header_mono_float(void) {
+    uint8_t h[WavFormat::HEADER_BYTES];
+    WavFormat::buildHeader(h, 65536, 44100, 1, 32, WavFormat::FORMAT_IEEE_FLOAT);
+
+    WavFormat::Fmt fmt;
+    TEST_ASSERT_TRUE(WavFormat::parseFmtChunk(h + 20, 16, fmt));
+    TEST_ASSERT_EQUAL_UINT16(3, fmt.format);
+    TEST_ASSERT_EQUAL_UINT16(1, fmt.channels);
+    TEST_ASSERT_EQUAL_UINT16(32, fmt.bitsPerSample);
+    TEST_ASSERT_EQUAL_UINT32(176400, WavFormat::readU32(h + 28)); // byte rate
+    TEST_ASSERT_EQUAL_UINT16(4, WavFormat::readU16(h + 32));      // block align
+    TEST_ASSERT_EQUAL_UINT32(65536, WavFormat::readU32(h + 40));
+}
+
 static void test_fmt_chunk_rejects_short_body(void) {
     uint8_t body[16] = {0};
     WavFormat::Fmt fmt;
@@ -80,6 +95,7 @@ int main(int, char**) {
     RUN_TEST(test_build_header_canonical_stereo_44k);
     RUN_TEST(test_patch_offsets_hit_the_size_fields);
     RUN_TEST(test_fmt_chunk_round_trips);
+    RUN_TEST(test_build_header_mono_float);
     RUN_TEST(test_fmt_chunk_rejects_short_body);
     RUN_TEST(test_data_seconds);
     return UNITY_END();
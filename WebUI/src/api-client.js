@@ -158,15 +158,21 @@ class VybesAPI {
    * Start a delay probe: the device chirps every enabled output of the
    * active preset in sequence. Resolves with the chirp schedule
    * (sampleRate, preRollSamples, spacingSamples, chirpSamples, tailSamples,
-   * fadeSamples, f0, f1, order) that delay-align.js correlates against.
+   * fadeSamples, f0, f1, minConfidence, capture, order) that
+   * delay-align.js correlates against.
    * Progress arrives as probeEvent live-update messages.
    * @param {number} level - Probe loudness 0-100 (independent of volume)
+   * @param {'phone'|'mic'} capture - 'mic' has the device record its
+   *   measurement mic and report each arrival itself (RESULT events)
    */
-  async startDelayProbe(level = 50) {
+  async startDelayProbe(level = 50, capture = 'phone') {
     if (level < 0 || level > 100) {
       throw new Error('Level must be between 0 and 100');
     }
-    return this.request('PUT', `/probe/delay/start?level=${level}`);
+    if (capture !== 'phone' && capture !== 'mic') {
+      throw new Error('Capture must be phone or mic');
+    }
+    return this.request('PUT', `/probe/delay/start?level=${level}&capture=${capture}`);
   }
 
   /** Cancel a running delay probe */
@@ -174,6 +180,36 @@ class VybesAPI {
     return this.request('PUT', '/probe/delay/stop');
   }
 
+  // ===== LEVEL LOG =====
+
+  /**
+   * Start or stop the device's once-a-second level log to its SD card.
+   * Persisted, so logging resumes after a reboot. The device answers with a
+   * levelLogEvent STATE (or ERR) live-update message.
+   * @param {boolean} enabled
+   */
+  async setLevelLog(enabled) {
+    return this.request('PUT', `/log/levels?enabled=${enabled ? 1 : 0}`);
+  }
+
+  /**
+   * Read a span of the level log back. Resolves with the decoding contract
+   * (intervalMs, capacity, bands, firstBandHz, bandsPerDecade, maxPoints);
+   * the points arrive as levelLogEvent RANGE/PT/END messages, which
+   * level-log.js parses.
+   * @param {number} from - First second; negative counts back from the newest
+   * @param {number} count - Seconds to cover
+   * @param {number} step - Seconds folded into each point (raised by the
+   *   device so no reply has more than maxPoints points)
+   */
+  async queryLevelLog(from = -3600, count = 3600, step = 1) {
+    if (!Number.isInteger(from) || !Number.isInteger(count) || !Number.isInteger(step)
+        || count < 1 || step < 1) {
+      throw new Error('From must be an integer, count and step positive integers');
+    }
+    return this.request('PUT', `/log/levels/query?from=${from}&count=${count}&step=${step}`);
+  }
+
   // ===== PRESET MANAGEMENT =====
 
   /**
@@ -206,12 +242,15 @@ class VybesAPI {
   }
 
   /**
-   * Create or update the preference EQ set
+   * Create or update the preference EQ set, or the set for another SPL
+   * (the Teensy interpolates between the sets as the volume moves)
    * @param {string} presetName - Name of the preset
    * @param {Array} peqPoints - Array of PEQ points
+   * @param {number} [spl=0] - SPL the set is for (0-120)
    */
-  async savePrefEqSet(presetName, peqPoints) {
-    return this.request('PUT', `/preset/eq?preset_name=${encodeURIComponent(presetName)}`, peqPoints);
+  async savePrefEqSet(presetName, peqPoints, spl = 0) {
+    const splParam = spl ? `&spl=${spl}` : '';
+    return this.request('PUT', `/preset/eq?preset_name=${encodeURIComponent(presetName)}${splParam}`, peqPoints);
   }
 
   async updateEqPoint(presetName, point) {
@@ -350,13 +389,35 @@ class VybesAPI {
     return this.request('PUT', this._outputEndpoint('/preset/output/eq/point', presetName, output), point);
   }
 
+  /**
+   * Apply an ordered list of output/crossover edits in one request. All or
+   * nothing: any invalid op (or an hpFloor violation in the result) rejects
+   * the batch. Ops: {op:'gain'|'delay', output, value},
+   * {op:'mute'|'invert'|'enabled'|'eqEnabled', output, state},
+   * {op:'source', output, left, right}, {op:'filter', output, which, mode, ...},
+   * {op:'eqPoint', output, id, freq, gain, q}, {op:'crossover', id, frequency, confirm}
+   * @returns {Promise<Object>} the presetBatchChanged payload (also broadcast)
+   */
+  async applyPresetBatch(presetName, ops) {
+    return this.request('PUT', `/preset/batch?preset_name=${encodeURIComponent(presetName)}`, ops);
+  }
+
   /** Assign a FIR file to an output ('' clears). 409 when the tap pool is exceeded. */
   async setOutputFir(presetName, output, file) {
     return this.request('PUT', this._outputEndpoint('/preset/output/fir', presetName, output,
       `&file=${encodeURIComponent(file)}`));
   }
 
-  /** Tap pool status: {total, used, outputs:[{output, file, taps}]} */
+  /**
+   * Fold an output's crossover and PEQ into its FIR (charged the full tail
+   * against the pool; 409 when it doesn't fit)
+   */
+  async setOutputFirCompiled(presetName, output, compiled) {
+    return this.request('PUT', this._outputEndpoint('/preset/output/fir/compiled', presetName, output,
+      `&state=${compiled ? 'on' : 'off'}`));
+  }
+
+  /** Tap pool status: {total, used, outputs:[{output, file, taps, compiled}]} */
   async getFirPool(presetName) {
     return this.request('GET', `/preset/fir/pool?preset_name=${encodeURIComponent(presetName)}`);
   }
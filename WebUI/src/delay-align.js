@@ -16,6 +16,10 @@
  *
  * The chirp/schedule contract comes from the /probe/delay/start response
  * and matches PROBE_* in ESP/esp-web-server/teensy_protocol.h.
+ *
+ * With a measurement mic on the device's analog input (capture=mic) the
+ * device runs the same matched filter on its own capture and reports each
+ * slot's arrival; analyzeDeviceResults turns those into the same result.
  */
 
 export const SPEED_OF_SOUND_M_PER_S = 343;
@@ -353,6 +357,45 @@ export function analyzeRecording(recording, sampleRate, schedule, currentDelaysU
   return { channels, spreadUs };
 }
 
+// --- On-device analysis (capture=mic) ---
+
+// Parse a probeEvent "RESULT <slot> <ch> <lag> <peakDb> <confidence>" line
+// (the payload after "PROBE "): the device's own arrival measurement for one
+// slot, lag in samples after the chirp's scheduled start. Null if malformed.
+export function parseProbeResult(line) {
+  const parts = line.split(' ');
+  if (parts[0] !== 'RESULT' || parts.length !== 6) return null;
+  const [slot, output, lagSamples, peakDb, confidence] = parts.slice(1).map(Number);
+  if (![slot, output, lagSamples, peakDb, confidence].every(Number.isFinite)) return null;
+  return { slot, output, lagSamples, peakDb, confidence };
+}
+
+// Same result shape as analyzeRecording, from the device's RESULT lines.
+// The lags share one clock with the chirps, so they are the deviations
+// directly - no anchor search, and no drift for the two passes to cancel
+// (their spread is then pure measurement noise, still worth surfacing).
+// A slot with no RESULT counts as not detected.
+export function analyzeDeviceResults(results, schedule, currentDelaysUs, maxDelayUs) {
+  const order = schedule.order;
+  const arrivals = order.map((output, slot) => {
+    const r = results.find((x) => x.slot === slot && x.output === output);
+    if (!r) return { sample: null, deviationS: 0, confidence: 0, detected: false };
+    return {
+      sample: r.lagSamples,
+      deviationS: r.lagSamples / schedule.sampleRate,
+      confidence: r.confidence,
+      detected: r.confidence >= schedule.minConfidence,
+    };
+  });
+  const channels = computeDelays(arrivals, order, currentDelaysUs, maxDelayUs);
+
+  const measured = channels.filter((c) => c.measured);
+  const spreadUs = measured.length >= 2
+    ? Math.max(...measured.map((c) => c.offsetUs)) - Math.min(...measured.map((c) => c.offsetUs))
+    : 0;
+  return { channels, spreadUs };
+}
+
 // Path-difference equivalent of a time offset, for display.
 export function usToCm(us) {
   return us * 1e-6 * SPEED_OF_SOUND_M_PER_S * 100;
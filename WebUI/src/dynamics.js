@@ -83,7 +83,8 @@ export function matchesMode(dynamics, mode) {
   });
 }
 
-// Decode a GRM websocket frame (6 hex chars) into per-band dB of reduction
+// Decode a GRM websocket frame's first 6 hex chars into per-band dB of
+// compressor reduction
 export function decodeGrmFrame(hex) {
   if (typeof hex !== 'string' || hex.length < 6) return null;
   const out = [0, 0, 0];
@@ -94,3 +95,19 @@ export function decodeGrmFrame(hex) {
   }
   return out;
 }
+
+export const LIMITER_OUTPUTS = 8;
+
+// The output limiters' part of a GRM frame (16 hex chars after the bands):
+// each output's deepest dB of reduction since the previous frame. null for
+// firmware that doesn't send it.
+export function decodeLimiterGr(hex) {
+  if (typeof hex !== 'string' || hex.length < 6 + LIMITER_OUTPUTS * 2) return null;
+  const out = new Array(LIMITER_OUTPUTS).fill(0);
+  for (let i = 0; i < LIMITER_OUTPUTS; i++) {
+    const v = parseInt(hex.substr(6 + i * 2, 2), 16);
+    if (Number.isNaN(v)) return null;
+    out[i] = v / 8;
+  }
+  return out;
+}
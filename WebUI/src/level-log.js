@@ -0,0 +1,94 @@
+/*
+ * Long-term level log: decoding the device's levelLogEvent lines (the
+ * Teensy's "LOG ..." replies, see teensy_protocol.h setLevelLog /
+ * getLevelLog). Each point is one or more logged seconds folded together:
+ * peaks and gain reduction are the span's maximum, bands its mean power on
+ * the 1/3-octave RTA grid (rta.js makeBandGrid(3)).
+ */
+
+import { makeBandGrid } from './rta.js';
+
+export const LEVEL_LOG_BANDS = 31;
+const POINT_BYTES = 4 + 1 + 2 + 3 + LEVEL_LOG_BANDS;
+
+const FLAG_CLIP_L = 0x01;
+const FLAG_CLIP_R = 0x02;
+const FLAG_BANDS = 0x04;
+const FLAG_COMP = 0x08;
+const FLAG_GAP = 0x10;
+const FLAG_SOLO = 0x20;
+
+function parseUint(token) {
+  return /^\d+$/.test(token ?? '') ? Number(token) : null;
+}
+
+// Decode a "PT" payload (82 hex chars) into a point, or null if malformed.
+// Scales match the live frames: peaks as VU (0..255 = -60..0 dBFS), gain
+// reduction as GRM (dB * 8), bands as RTA ((dB + 100) * 2).
+export function decodeLevelLogPoint(seq, hex) {
+  if (typeof hex !== 'string' || hex.length !== POINT_BYTES * 2) return null;
+  const bytes = new Uint8Array(POINT_BYTES);
+  for (let i = 0; i < POINT_BYTES; i++) {
+    const v = parseInt(hex.substr(i * 2, 2), 16);
+    if (Number.isNaN(v)) return null;
+    bytes[i] = v;
+  }
+  const uptime = (bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | (bytes[3] << 24)) >>> 0;
+  const flags = bytes[4];
+  const peakDb = [bytes[5], bytes[6]].map((v) => (v === 0 ? -Infinity : (v / 255) * 60 - 60));
+  const grDb = [bytes[7], bytes[8], bytes[9]].map((v) => v / 8);
+  let bandsDb = null;
+  if (flags & FLAG_BANDS) {
+    bandsDb = new Float32Array(LEVEL_LOG_BANDS);
+    for (let j = 0; j < LEVEL_LOG_BANDS; j++) bandsDb[j] = bytes[10 + j] / 2 - 100;
+  }
+  return {
+    seq,
+    uptime,
+    clip: [Boolean(flags & FLAG_CLIP_L), Boolean(flags & FLAG_CLIP_R)],
+    compressor: Boolean(flags & FLAG_COMP),
+    gap: Boolean(flags & FLAG_GAP),
+    solo: Boolean(flags & FLAG_SOLO),
+    peakDb,
+    grDb,
+    bandsDb,
+  };
+}
+
+// One levelLogEvent line -> { type, ... }, or null if malformed:
+//   state { on, first, next }   records first..next-1 are on the card
+//   range { from, count, step } what a query will actually return
+//   point { seq, uptime, ... }  see decodeLevelLogPoint
+//   end   { points }
+//   error { code }
+export function parseLevelLogEvent(line) {
+  if (typeof line !== 'string') return null;
+  const t = line.split(' ');
+  const n = t.slice(1).map(parseUint);
+  switch (t[0]) {
+    case 'STATE':
+      if (t.length !== 4 || n.includes(null)) return null;
+      return { type: 'state', on: n[0] === 1, first: n[1], next: n[2] };
+    case 'RANGE':
+      if (t.length !== 4 || n.includes(null)) return null;
+      return { type: 'range', from: n[0], count: n[1], step: n[2] };
+    case 'PT': {
+      if (t.length !== 3 || n[0] === null) return null;
+      const point = decodeLevelLogPoint(n[0], t[2]);
+      return point && { type: 'point', ...point };
+    }
+    case 'END':
+      if (t.length !== 2 || n[0] === null) return null;
+      return { type: 'end', points: n[0] };
+    case 'ERR':
+      if (t.length !== 2 || !t[1]) return null;
+      return { type: 'error', code: t[1] };
+    default:
+      return null;
+  }
+}
+
+// The band grid a point's bandsDb is on
+export function levelLogGrid() {
+  return makeBandGrid(3);
+}
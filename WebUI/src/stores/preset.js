@@ -340,6 +340,16 @@ export const usePresetStore = defineStore('preset', () => {
         }
         break;
       }
+      case 'presetBatchChanged':
+        for (const entry of msg.outputs) {
+          Object.assign(preset.value.outputs[entry.output], entry.changes);
+        }
+        for (const change of msg.crossovers) {
+          const point = preset.value.crossovers.find((x) => x.id === change.id);
+          if (point) point.freq = change.crossoverFreq;
+        }
+        if (msg.template) preset.value.template = msg.template;
+        break;
       case 'crossoverChanged': {
         const point = preset.value.crossovers.find((x) => x.id === msg.id);
         if (point) point.freq = msg.crossoverFreq;
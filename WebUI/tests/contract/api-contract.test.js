@@ -131,6 +131,60 @@ describe('GET /status', () => {
     expect(typeof s.volume).toBe('number')
     expect(s.volume).toBeGreaterThanOrEqual(0)
     expect(s.volume).toBeLessThanOrEqual(100)
+
+    // Transient allocation pools: one entry per size class, never over capacity
+    expect(Array.isArray(s.memPools.classes)).toBe(true)
+    for (const pool of s.memPools.classes) {
+      expect(pool.inUse).toBeLessThanOrEqual(pool.blocks)
+      expect(pool.peakInUse).toBeLessThanOrEqual(pool.blocks)
+    }
+    expect(typeof s.memPools.oversize).toBe('number')
+
+    // Teensy telemetry: absent until the first STATS line after boot
+    expect(typeof s.teensy.available).toBe('boolean')
+    if (s.teensy.available) {
+      expect(typeof s.teensy.cpu).toBe('number')
+      expect(typeof s.teensy.cpuMax).toBe('number')
+      expect(typeof s.teensy.ageMs).toBe('number')
+      expect(typeof s.teensy.audioBlocks.total).toBe('number')
+      if (s.teensy.usb) expect(typeof s.teensy.usb.stepPpm).toBe('number')
+      if (s.teensy.levelLog) expect(typeof s.teensy.levelLog.maxUs).toBe('number')
+      if ('audioClock' in s.teensy) expect(Number.isInteger(s.teensy.audioClock)).toBe(true)
+      if ('inputEqMaxUs' in s.teensy) expect(Number.isInteger(s.teensy.inputEqMaxUs)).toBe(true)
+    }
+  })
+})
+
+// ===== /metrics =====
+
+describe('GET /metrics', () => {
+  it('serves Prometheus text with per-route histograms and link counters', async () => {
+    await GET('/status')
+    const res = await GET('/metrics')
+    expect(res.status).toBe(200)
+    expect(res.json).toBeNull()
+    const text = res.text
+
+    for (const family of [
+      'vybes_http_request_duration_seconds histogram',
+      'vybes_teensy_queue_high_water gauge',
+      'vybes_teensy_commands_total counter',
+      'vybes_teensy_rx_overflows_total counter',
+      'vybes_websocket_clients gauge',
+      'vybes_websocket_sent_bytes_total counter',
+      'vybes_heap_min_largest_free_block_bytes gauge'
+    ]) {
+      expect(text, family).toContain(`# TYPE ${family}`)
+    }
+
+    // The /status call above landed in its route's histogram
+    const count = text.match(/^vybes_http_request_duration_seconds_count\{path="\/status",method="GET"\} (\d+)$/m)
+    expect(count, '/status series').not.toBeNull()
+    expect(Number(count[1])).toBeGreaterThanOrEqual(1)
+    const inf = text.match(/^vybes_http_request_duration_seconds_bucket\{path="\/status",method="GET",le="\+Inf"\} (\d+)$/m)
+    expect(Number(inf[1])).toBe(Number(count[1]))
+
+    expect(text).toMatch(/^vybes_teensy_commands_total\{outcome="coalesced"\} \d+$/m)
   })
 })
 
@@ -386,6 +440,8 @@ describe('delay alignment probe', () => {
       expect(s.f0).toBeGreaterThan(0)
       expect(s.f1).toBeGreaterThan(s.f0)
       expect(s.level).toBe(40)
+      expect(s.capture).toBe('phone')
+      expect(s.minConfidence).toBeGreaterThan(0)
       // One chirp per enabled output, ascending, then the same list reversed
       expect(Array.isArray(s.order)).toBe(true)
       expect(s.order.length % 2).toBe(0)
@@ -411,6 +467,18 @@ describe('delay alignment probe', () => {
     }
   })
 
+  it('PUT /probe/delay/start?capture=mic selects the on-device analysis, rejects unknown captures', async () => {
+    expect((await PUT('/probe/delay/start?capture=usb')).status).toBe(400)
+    const res = await PUT('/probe/delay/start?level=40&capture=mic')
+    try {
+      expect(res.status).toBe(200)
+      expect(res.json.capture).toBe('mic')
+      expect(res.json.order.length).toBeGreaterThanOrEqual(2)
+    } finally {
+      await PUT('/probe/delay/stop')
+    }
+  })
+
   it('PUT /probe/delay/stop succeeds even when no probe is running', async () => {
     const res = await PUT('/probe/delay/stop')
     expect(res.status).toBe(200)
@@ -418,6 +486,114 @@ describe('delay alignment probe', () => {
   })
 })
 
+// ===== Impulse response measurement =====
+// The sweep starts after a 500ms settle, so start-then-stop stays silent.
+
+describe('impulse response measurement', () => {
+  const activeOutputs = async () =>
+    (await getPreset((await GET('/status')).json.currentPreset)).outputs
+  const enabledOutput = async () => (await activeOutputs()).findIndex((o) => o.enabled)
+
+  it('PUT /measure/ir/start returns the sweep and result contract', async () => {
+    const output = await enabledOutput()
+    const res = await PUT(`/measure/ir/start?output=${output}&level=40`)
+    try {
+      expect(res.status).toBe(200)
+      const s = res.json
+      expect(s.status).toBe('ok')
+      expect(s.output).toBe(output)
+      expect(s.level).toBe(40)
+      expect(s.sampleRate).toBe(44100)
+      expect(s.f1).toBeGreaterThan(s.f0)
+      // The capture covers the sweep plus the result window past lag 0
+      expect(s.captureSamples).toBe(s.sweepSamples + s.lengthSamples - s.preSamples)
+      expect(s.preSamples).toBeLessThan(s.lengthSamples)
+      expect(s.settleMs).toBeGreaterThan(0)
+      expect(s.directory).toBe('/measurements')
+    } finally {
+      await PUT('/measure/ir/stop')
+    }
+  })
+
+  it('PUT /measure/ir/start rejects bad outputs and levels with 400', async () => {
+    expect((await PUT('/measure/ir/start')).status).toBe(400)
+    expect((await PUT('/measure/ir/start?output=8')).status).toBe(400)
+    expect((await PUT('/measure/ir/start?output=-1')).status).toBe(400)
+    const output = await enabledOutput()
+    expect((await PUT(`/measure/ir/start?output=${output}&level=101`)).status).toBe(400)
+    const res = await PUT(`/measure/ir/start?output=${output}`)
+    try {
+      expect(res.status).toBe(200)
+      expect(res.json.level).toBe(50)
+    } finally {
+      await PUT('/measure/ir/stop')
+    }
+  })
+
+  it('PUT /measure/ir/start rejects an output the active preset has disabled', async () => {
+    const disabled = (await activeOutputs()).findIndex((o) => !o.enabled)
+    if (disabled < 0) return // every output enabled in this fixture
+    expect((await PUT(`/measure/ir/start?output=${disabled}`)).status).toBe(400)
+  })
+
+  it('PUT /measure/ir/stop succeeds even when nothing is running', async () => {
+    const res = await PUT('/measure/ir/stop')
+    expect(res.status).toBe(200)
+    expect(res.json).toEqual({ status: 'ok' })
+  })
+})
+
+// ===== Long-term level log =====
+
+describe('level log', () => {
+  it('PUT /log/levels persists the enable flag', async () => {
+    try {
+      const res = await PUT('/log/levels?enabled=1')
+      expect(res.status).toBe(200)
+      expect(res.json).toEqual({ messageType: 'levelLogChanged', enabled: true })
+    } finally {
+      await PUT('/log/levels?enabled=0')
+    }
+  })
+
+  it('PUT /log/levels rejects anything but 0 or 1 with 400', async () => {
+    expect((await PUT('/log/levels')).status).toBe(400)
+    expect((await PUT('/log/levels?enabled=on')).status).toBe(400)
+    expect((await PUT('/log/levels?enabled=2')).status).toBe(400)
+  })
+
+  it('PUT /log/levels/query returns the decoding contract', async () => {
+    const res = await PUT('/log/levels/query?from=-600&count=600&step=10')
+    expect(res.status).toBe(200)
+    const s = res.json
+    expect(s.status).toBe('ok')
+    expect(s.from).toBe(-600)
+    expect(s.count).toBe(600)
+    expect(s.step).toBe(10)
+    expect(s.intervalMs).toBe(1000)
+    expect(s.bands).toBe(31)
+    expect(s.bandsPerDecade).toBe(10)
+    expect(s.firstBandHz).toBeCloseTo(20, 0)
+    expect(s.maxPoints).toBe(300)
+    expect(s.capacity).toBeGreaterThanOrEqual(86400)
+  })
+
+  it('PUT /log/levels/query defaults to the last hour', async () => {
+    const res = await PUT('/log/levels/query')
+    expect(res.status).toBe(200)
+    expect(res.json.from).toBe(-3600)
+    expect(res.json.count).toBe(3600)
+    expect(res.json.step).toBe(1)
+  })
+
+  it('PUT /log/levels/query rejects malformed ranges with 400', async () => {
+    expect((await PUT('/log/levels/query?from=abc')).status).toBe(400)
+    expect((await PUT('/log/levels/query?count=0')).status).toBe(400)
+    expect((await PUT('/log/levels/query?step=0')).status).toBe(400)
+    expect((await PUT('/log/levels/query?count=1.5')).status).toBe(400)
+  })
+})
+
 // ===== Preset CRUD =====
 
 describe('preset CRUD', () => {
@@ -591,6 +767,25 @@ describe('/preset/eq', () => {
     for (const point of spl0.points) expect(point.gain).toBe(0)
   })
 
+  it('spl selects the SPL set to edit, creating it in a free slot', async () => {
+    const res = await PUT(`/preset/eq?preset_name=${enc(LEAK_CHECK)}&spl=85`, [{ freq: 60, gain: -4, q: 0.7 }])
+    expect(res.status).toBe(204)
+
+    const eq = (await getPreset(LEAK_CHECK)).inputEq
+    expect(typeof eq.refSpl).toBe('number')
+    const spl85 = eq.sets.find((set) => set.spl === 85)
+    expect(spl85.points).toHaveLength(1)
+    expect(spl85.points[0].gain).toBeCloseTo(-4, 3)
+    // The preference curve is untouched
+    expect(eq.sets.find((set) => set.spl === 0).points).toHaveLength(3)
+
+    expect((await PUT(`/preset/eq?preset_name=${enc(LEAK_CHECK)}&spl=121`, [])).status).toBe(400)
+    expect((await PUT(`/preset/eq?preset_name=${enc(LEAK_CHECK)}&spl=loud`, [])).status).toBe(400)
+    // Three slots: a third level fits, a fourth does not
+    expect((await PUT(`/preset/eq?preset_name=${enc(LEAK_CHECK)}&spl=60`, [])).status).toBe(204)
+    expect((await PUT(`/preset/eq?preset_name=${enc(LEAK_CHECK)}&spl=70`, [])).status).toBe(507)
+  })
+
   it('clamps out-of-range values instead of rejecting them', async () => {
     const res = await PUT(`/preset/eq?preset_name=${enc(P)}`, [{ freq: 5, gain: 40, q: 50 }])
     expect(res.status).toBe(204)
@@ -931,7 +1126,7 @@ describe('V1 preset shape', () => {
     }
     expect(preset.inputEq.enabled).toBe(false)
     expect(preset.inputEq.sets.find((s) => s.spl === 0).points).toHaveLength(3)
-    expect(preset.firPool).toMatchObject({ total: 12288, used: 0 })
+    expect(preset.firPool).toMatchObject({ total: 15360, used: 0 })
   })
 
   it('a 3way-2sub preset uses all 8 outputs with locked mid/tweeter points and floors', async () => {
@@ -1149,6 +1344,80 @@ describe('output channel endpoints', () => {
   })
 })
 
+// ===== V1: batched preset edits =====
+
+describe('PUT /preset/batch', () => {
+  const BATCH = `${PREFIX}-v1-batch`
+  const batch = (ops, name = BATCH) => PUT(`/preset/batch?preset_name=${enc(name)}`, ops)
+
+  beforeAll(async () => {
+    expect((await POST(`/preset?action=create&name=${enc(BATCH)}&template=2way-sub`)).status).toBe(201)
+  })
+
+  it('applies ops in order and reports only the fields that changed', async () => {
+    const res = await batch([
+      { op: 'gain', output: 0, value: -1 },
+      { op: 'gain', output: 0, value: -2 },
+      { op: 'eqPoint', output: 1, id: 0, freq: 120, gain: -3, q: 2 },
+      { op: 'eqPoint', output: 1, id: 1, freq: 400, gain: 2, q: 1 },
+      { op: 'mute', output: 3, state: false },
+    ])
+    expect(res.status).toBe(200)
+    expect(res.json).toMatchObject({ messageType: 'presetBatchChanged', presetName: BATCH, status: 'ok', applied: 5, crossovers: [] })
+    // Output 3 was already unmuted: no entry for it
+    expect(res.json.outputs.map((o) => o.output)).toEqual([0, 1])
+    expect(res.json.outputs[0].changes).toEqual({ gainDb: -2 })
+    expect(res.json.outputs[1].changes.peq).toHaveLength(2)
+
+    const preset = await getPreset(BATCH)
+    expect(preset.outputs[0].gainDb).toBeCloseTo(-2, 3)
+    expect(preset.outputs[1].peq[1].freq).toBeCloseTo(400, 3)
+  })
+
+  it('is all or nothing: one bad op rejects the whole batch', async () => {
+    const res = await batch([
+      { op: 'gain', output: 0, value: -6 },
+      { op: 'delay', output: 0, value: 99999 },
+    ])
+    expect(res.status).toBe(400)
+    expect((await getPreset(BATCH)).outputs[0].gainDb).toBeCloseTo(-2, 3)
+
+    expect((await batch([{ op: 'gain', output: 8, value: 0 }])).status).toBe(400)
+    expect((await batch([{ op: 'nonsense', output: 0 }])).status).toBe(400)
+    expect((await batch([{ op: 'eqPoint', output: 2, id: 5, freq: 100 }])).status).toBe(400)
+    expect((await batch({ op: 'gain' })).status).toBe(400)
+  })
+
+  it('keeps the locked-crossover confirmation per op', async () => {
+    const locked = await batch([{ op: 'crossover', id: 'twt_xo', frequency: 3000 }])
+    expect(locked.status).toBe(409)
+    expect(locked.json).toMatchObject({ locked: true, op: 0 })
+
+    const confirmed = await batch([{ op: 'crossover', id: 'twt_xo', frequency: 3000, confirm: true }])
+    expect(confirmed.status).toBe(200)
+    expect(confirmed.json.crossovers).toEqual([{ id: 'twt_xo', crossoverFreq: 3000 }])
+    expect((await getPreset(BATCH)).crossovers.find((x) => x.id === 'twt_xo').freq).toBe(3000)
+  })
+
+  it('checks the high-pass floor once, against the end state', async () => {
+    // Output 2 (L Tweeter, hpFloor 800): ending below the floor is refused...
+    const below = await batch([{ op: 'filter', output: 2, which: 'hp', mode: 'manual', freq: 500, type: 'LR4' }])
+    expect(below.status).toBe(409)
+    // ...but passing through it on the way to a safe value is fine
+    const through = await batch([
+      { op: 'filter', output: 2, which: 'hp', mode: 'manual', freq: 500, type: 'LR4' },
+      { op: 'filter', output: 2, which: 'hp', mode: 'manual', freq: 900, type: 'LR4' },
+    ])
+    expect(through.status).toBe(200)
+    expect((await getPreset(BATCH)).outputs[2].hp).toMatchObject({ mode: 'manual', freq: 900 })
+  })
+
+  it('404s for an unknown preset and needs preset_name', async () => {
+    expect((await batch([], PREFIX + '-missing')).status).toBe(404)
+    expect((await PUT('/preset/batch', [])).status).toBe(400)
+  })
+})
+
 // ===== V1: template flips to custom on structural edits =====
 
 describe('template custom-flip', () => {
@@ -1192,7 +1461,7 @@ describe('FIR tap pool', () => {
   it('GET /preset/fir/pool reports total, used and per-output taps', async () => {
     const res = await GET(`/preset/fir/pool?preset_name=${enc(POOL)}`)
     expect(res.status).toBe(200)
-    expect(res.json.total).toBe(12288)
+    expect(res.json.total).toBe(15360)
     expect(res.json.used).toBe(0)
     expect(res.json.outputs).toHaveLength(8)
     for (const o of res.json.outputs) {
@@ -1201,26 +1470,50 @@ describe('FIR tap pool', () => {
   })
 
   it('tracks tap usage as files load and rejects loads that exceed the pool', async () => {
-    // The mock's tap map: room1/room2 = 4096, speaker1/speaker2 = 2048
+    // The mock's tap map: room1/room2 = 4096, speaker1/speaker2 = 2048, sub = 3072
     expect((await PUT(`/preset/output/fir?preset_name=${enc(POOL)}&output=0&file=fir_room1.txt`)).status).toBe(200)
     expect((await PUT(`/preset/output/fir?preset_name=${enc(POOL)}&output=1&file=fir_room2.txt`)).status).toBe(200)
     expect((await PUT(`/preset/output/fir?preset_name=${enc(POOL)}&output=2&file=fir_speaker1.txt`)).status).toBe(200)
-    const almostFull = await PUT(`/preset/output/fir?preset_name=${enc(POOL)}&output=3&file=fir_speaker2.txt`)
+    expect((await PUT(`/preset/output/fir?preset_name=${enc(POOL)}&output=3&file=fir_speaker2.txt`)).status).toBe(200)
+    const almostFull = await PUT(`/preset/output/fir?preset_name=${enc(POOL)}&output=4&file=fir_sub.txt`)
     expect(almostFull.status).toBe(200)
-    expect(almostFull.json.firPool).toEqual({ total: 12288, used: 12288 })
+    expect(almostFull.json.firPool).toEqual({ total: 15360, used: 15360 })
 
     // Pool is exactly full: one more load must be rejected with the usage
-    const overflow = await PUT(`/preset/output/fir?preset_name=${enc(POOL)}&output=4&file=fir_flat.txt`)
+    const overflow = await PUT(`/preset/output/fir?preset_name=${enc(POOL)}&output=5&file=fir_flat.txt`)
     expect(overflow.status).toBe(409)
-    expect(overflow.json).toMatchObject({ total: 12288 })
-    expect(overflow.json.used).toBeGreaterThan(12288)
-    expect((await getPreset(POOL)).outputs[4].fir).toBe('')
+    expect(overflow.json).toMatchObject({ total: 15360 })
+    expect(overflow.json.used).toBeGreaterThan(15360)
+    expect((await getPreset(POOL)).outputs[5].fir).toBe('')
 
     // Clearing a file frees its taps and the load succeeds
     expect((await PUT(`/preset/output/fir?preset_name=${enc(POOL)}&output=0&file=`)).status).toBe(200)
-    expect((await PUT(`/preset/output/fir?preset_name=${enc(POOL)}&output=4&file=fir_flat.txt`)).status).toBe(200)
+    expect((await PUT(`/preset/output/fir?preset_name=${enc(POOL)}&output=5&file=fir_flat.txt`)).status).toBe(200)
+    const pool = (await GET(`/preset/fir/pool?preset_name=${enc(POOL)}`)).json
+    expect(pool.used).toBe(15360 - 4096 + 1024)
+  })
+
+  it('charges a compiled output its file plus the full ring-out tail', async () => {
+    // From the previous test: room2, speaker1, speaker2, sub and flat = 12288 taps
+    const on = await PUT(`/preset/output/fir/compiled?preset_name=${enc(POOL)}&output=5&state=on`)
+    expect(on.status).toBe(200)
+    expect(on.json.firPool).toEqual({ total: 15360, used: 12288 + 1024 })
+    expect((await getPreset(POOL)).outputs[5].firCompiled).toBe(true)
     const pool = (await GET(`/preset/fir/pool?preset_name=${enc(POOL)}`)).json
-    expect(pool.used).toBe(12288 - 4096 + 1024)
+    expect(pool.outputs[5]).toMatchObject({ file: 'fir_flat.txt', compiled: true })
+
+    expect((await PUT(`/preset/output/fir/compiled?preset_name=${enc(POOL)}&output=2&state=on`)).status).toBe(200)
+    expect((await PUT(`/preset/output/fir/compiled?preset_name=${enc(POOL)}&output=3&state=on`)).status).toBe(200)
+    // Full: one more compiled output is refused and left live
+    const overflow = await PUT(`/preset/output/fir/compiled?preset_name=${enc(POOL)}&output=1&state=on`)
+    expect(overflow.status).toBe(409)
+    expect(overflow.json.used).toBe(15360 + 1024)
+    expect((await getPreset(POOL)).outputs[1].firCompiled).toBe(false)
+
+    // Back to live frees the tail
+    const off = await PUT(`/preset/output/fir/compiled?preset_name=${enc(POOL)}&output=5&state=off`)
+    expect(off.json.firPool.used).toBe(15360 - 1024)
+    expect((await PUT(`/preset/output/fir/compiled?preset_name=${enc(POOL)}&output=5&state=maybe`)).status).toBe(400)
   })
 })
 
@@ -1304,6 +1597,36 @@ describe('websocket broadcasts', () => {
     await waitStop
   })
 
+  it('irEvent START on measurement start, STOP on cancel', async () => {
+    const active = await getPreset((await GET('/status')).json.currentPreset)
+    const output = active.outputs.findIndex((o) => o.enabled)
+    const waitStart = ws.expect((m) => m.messageType === 'irEvent' && m.line.startsWith('START'))
+    await PUT(`/measure/ir/start?output=${output}&level=30`)
+    const started = await waitStart
+    // "START <ch> <sweepSamples> <captureSamples>"
+    expect(started.line.split(' ')).toEqual(['START', String(output), '131072', '146944'])
+
+    const waitStop = ws.expect((m) => m.messageType === 'irEvent' && m.line === 'STOP')
+    await PUT('/measure/ir/stop')
+    await waitStop
+  })
+
+  it('levelLogEvent RANGE, PT and END answer a range read', async () => {
+    const waitRange = ws.expect((m) => m.messageType === 'levelLogEvent' && m.line.startsWith('RANGE'))
+    const waitPoint = ws.expect((m) => m.messageType === 'levelLogEvent' && m.line.startsWith('PT'))
+    const waitEnd = ws.expect((m) => m.messageType === 'levelLogEvent' && m.line.startsWith('END'))
+    await PUT('/log/levels/query?from=-60&count=60&step=10')
+    // "RANGE <from> <count> <step>"
+    const range = (await waitRange).line.split(' ')
+    expect(range).toHaveLength(4)
+    expect(range[3]).toBe('10')
+    // "PT <seq> <82 hex digits>"
+    const point = (await waitPoint).line.split(' ')
+    expect(point).toHaveLength(3)
+    expect(point[2]).toMatch(/^[0-9a-f]{82}$/)
+    expect((await waitEnd).line).toMatch(/^END \d+$/)
+  })
+
   it('crossoverEnabledChanged', async () => {
     const wait = ws.expect((m) => m.messageType === 'crossoverEnabledChanged' && m.presetName === P)
     await PUT(`/preset/crossover/enabled?preset_name=${enc(P)}&id=sub_xo&enabled=off`)
@@ -1322,6 +1645,26 @@ describe('websocket broadcasts', () => {
     })
   })
 
+  it('presetBatchChanged carries every changed output in one message', async () => {
+    const wait = ws.expect((m) => m.messageType === 'presetBatchChanged' && m.presetName === P)
+    await PUT(`/preset/batch?preset_name=${enc(P)}`, [
+      { op: 'gain', output: 1, value: -5 },
+      { op: 'invert', output: 0, state: true },
+    ])
+    expect(await wait).toEqual({
+      messageType: 'presetBatchChanged',
+      presetName: P,
+      status: 'ok',
+      applied: 2,
+      outputs: [
+        { output: 0, changes: { invert: true } },
+        { output: 1, changes: { gainDb: -5 } },
+      ],
+      crossovers: [],
+    })
+    await PUT(`/preset/output/invert?preset_name=${enc(P)}&output=0&state=off`)
+  })
+
   it('outputEqChanged reports the output and point count', async () => {
     const wait = ws.expect((m) => m.messageType === 'outputEqChanged' && m.presetName === P)
     await PUT(`/preset/output/eq?preset_name=${enc(P)}&output=2`, [{ freq: 60, gain: -4, q: 3 }])
@@ -1387,6 +1730,23 @@ describe('websocket broadcasts', () => {
     await PUT('/noise?level=0')
     await waitOff
   })
+
+  it('rtab:keepalive streams tagged per-output spectrum frames', async () => {
+    // One channel per frame, round-robin: 0-7 the outputs, 8 the input mix.
+    // The first frames wait for the analyzer's slowest stage to fill.
+    const seen = new Set()
+    const all = ws.expect((m) => {
+      if (m.type !== 'rtab') return false
+      expect(Number.isInteger(m.ch)).toBe(true)
+      expect(m.ch).toBeGreaterThanOrEqual(0)
+      expect(m.ch).toBeLessThanOrEqual(8)
+      expect(m.d).toMatch(/^[0-9a-f]{242}$/)
+      seen.add(m.ch)
+      return seen.size === 9
+    })
+    ws.socket.send('rtab:keepalive')
+    await all
+  })
 })
 
 // ===== Destructive semantics (mock only) =====
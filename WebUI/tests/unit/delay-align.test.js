@@ -5,6 +5,8 @@ import {
   findArrivals,
   computeDelays,
   analyzeRecording,
+  parseProbeResult,
+  analyzeDeviceResults,
   usToCm,
   MIN_CONFIDENCE,
 } from '../../src/delay-align.js'
@@ -316,6 +318,44 @@ describe('computeDelays (direct)', () => {
   })
 })
 
+describe('on-device results (capture=mic)', () => {
+  const schedule = { ...SCHEDULE, order: [0, 1, 1, 0], minConfidence: 8 }
+
+  it('parses RESULT lines and rejects anything else', () => {
+    expect(parseProbeResult('RESULT 2 1 412.250 -18.5 64.0')).toEqual({
+      slot: 2, output: 1, lagSamples: 412.25, peakDb: -18.5, confidence: 64,
+    })
+    expect(parseProbeResult('CHIRP 2 1')).toBeNull()
+    expect(parseProbeResult('RESULT 2 1 x -18.5 64.0')).toBeNull()
+  })
+
+  it('turns per-slot lags into the same delay result as a recording', () => {
+    // Output 1 arrives 44.1 samples (1ms) after output 0, both passes
+    const results = [
+      { slot: 0, output: 0, lagSamples: 400.0, peakDb: -20, confidence: 50 },
+      { slot: 1, output: 1, lagSamples: 444.1, peakDb: -20, confidence: 50 },
+      { slot: 2, output: 1, lagSamples: 444.1, peakDb: -20, confidence: 50 },
+      { slot: 3, output: 0, lagSamples: 400.0, peakDb: -20, confidence: 50 },
+    ]
+    const { channels, spreadUs } = analyzeDeviceResults(results, schedule, [0, 0], MAX_DELAY_US)
+    expect(spreadUs).toBeCloseTo(1000, 3)
+    expect(channels.find((c) => c.output === 0).newDelayUs).toBe(1000)
+    expect(channels.find((c) => c.output === 1).newDelayUs).toBe(0)
+    expect(channels.every((c) => c.consistencyUs === 0)).toBe(true)
+  })
+
+  it('treats low-confidence and missing slots as not detected', () => {
+    const results = [
+      { slot: 0, output: 0, lagSamples: 400, peakDb: -20, confidence: 50 },
+      { slot: 1, output: 1, lagSamples: 900, peakDb: -60, confidence: 4.2 },
+      { slot: 3, output: 0, lagSamples: 400, peakDb: -20, confidence: 50 },
+    ]
+    const { channels } = analyzeDeviceResults(results, schedule, [0, 0], MAX_DELAY_US)
+    expect(channels.find((c) => c.output === 0).measured).toBe(true)
+    expect(channels.find((c) => c.output === 1).measured).toBe(false)
+  })
+})
+
 describe('usToCm', () => {
   it('converts via the speed of sound', () => {
     expect(usToCm(1000)).toBeCloseTo(34.3, 1)
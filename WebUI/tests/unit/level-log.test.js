@@ -0,0 +1,74 @@
+import { describe, it, expect } from 'vitest'
+import { decodeLevelLogPoint, parseLevelLogEvent, levelLogGrid, LEVEL_LOG_BANDS } from '../../src/level-log.js'
+
+// A point payload as the device packs it (LevelLog.h, record bytes 4-44)
+function pointHex({ uptime = 0, flags = 0, peak = [0, 0], gr = [0, 0, 0], band = 0 } = {}) {
+  const bytes = [uptime & 0xff, (uptime >> 8) & 0xff, (uptime >> 16) & 0xff, (uptime >>> 24) & 0xff,
+    flags, ...peak, ...gr, ...new Array(LEVEL_LOG_BANDS).fill(band)]
+  return bytes.map((b) => b.toString(16).padStart(2, '0')).join('')
+}
+
+describe('decodeLevelLogPoint', () => {
+  it('decodes uptime, flags and the meter scales', () => {
+    const p = decodeLevelLogPoint(42, pointHex({
+      uptime: 0x01020304, flags: 0x04 | 0x08 | 0x02, peak: [255, 0], gr: [24, 0, 8], band: 120,
+    }))
+    expect(p.seq).toBe(42)
+    expect(p.uptime).toBe(0x01020304)
+    expect(p.clip).toEqual([false, true])
+    expect(p.compressor).toBe(true)
+    expect(p.gap).toBe(false)
+    expect(p.peakDb[0]).toBeCloseTo(0, 6)
+    expect(p.peakDb[1]).toBe(-Infinity)
+    expect(p.grDb).toEqual([3, 0, 1])
+    expect(p.bandsDb).toHaveLength(LEVEL_LOG_BANDS)
+    expect(p.bandsDb[0]).toBe(-40)
+  })
+
+  it('leaves bands out when the point has no spectrum', () => {
+    expect(decodeLevelLogPoint(0, pointHex({ band: 200 })).bandsDb).toBeNull()
+  })
+
+  it('reads an uptime past 2^31 as unsigned', () => {
+    expect(decodeLevelLogPoint(0, pointHex({ uptime: 0xfffffffe })).uptime).toBe(0xfffffffe)
+  })
+
+  it('rejects a payload of the wrong length or with non-hex digits', () => {
+    expect(decodeLevelLogPoint(0, pointHex().slice(2))).toBeNull()
+    expect(decodeLevelLogPoint(0, 'zz' + pointHex().slice(2))).toBeNull()
+  })
+})
+
+describe('parseLevelLogEvent', () => {
+  it('parses the state, range, end and error lines', () => {
+    expect(parseLevelLogEvent('STATE 1 0 3600')).toEqual({ type: 'state', on: true, first: 0, next: 3600 })
+    expect(parseLevelLogEvent('RANGE 0 3600 12')).toEqual({ type: 'range', from: 0, count: 3600, step: 12 })
+    expect(parseLevelLogEvent('END 300')).toEqual({ type: 'end', points: 300 })
+    expect(parseLevelLogEvent('ERR nosd')).toEqual({ type: 'error', code: 'nosd' })
+  })
+
+  it('parses a point line', () => {
+    const e = parseLevelLogEvent(`PT 7 ${pointHex({ flags: 0x10 })}`)
+    expect(e.type).toBe('point')
+    expect(e.seq).toBe(7)
+    expect(e.gap).toBe(true)
+  })
+
+  it('rejects malformed and unknown lines', () => {
+    expect(parseLevelLogEvent('STATE 1 0')).toBeNull()
+    expect(parseLevelLogEvent('RANGE -1 10 1')).toBeNull()
+    expect(parseLevelLogEvent('PT x ' + pointHex())).toBeNull()
+    expect(parseLevelLogEvent('END')).toBeNull()
+    expect(parseLevelLogEvent('NOPE 1')).toBeNull()
+    expect(parseLevelLogEvent(null)).toBeNull()
+  })
+})
+
+describe('levelLogGrid', () => {
+  it('is the 31-band 1/3-octave grid, 20Hz to 20kHz', () => {
+    const grid = levelLogGrid()
+    expect(grid.centers).toHaveLength(LEVEL_LOG_BANDS)
+    expect(grid.centers[0]).toBeCloseTo(19.95, 1)
+    expect(grid.centers[LEVEL_LOG_BANDS - 1]).toBeCloseTo(19953, -1)
+  })
+})
@@ -2,6 +2,8 @@ import { defineConfig } from 'vite'
 import vue from '@vitejs/plugin-vue'
 import tailwindcss from '@tailwindcss/vite'
 import viteCompression from 'vite-plugin-compression'
+import { createHash } from 'node:crypto'
+import { brotliCompressSync, constants as zlibConstants } from 'node:zlib'
 
 // Inline the built stylesheet into index.html. The device's HTTPS listener
 // only affords a handful of TLS sockets, so a browser's parallel asset
@@ -28,15 +30,70 @@ function inlineCss() {
   }
 }
 
+// Write build-id.txt: a hash over every emitted file. The ESP derives its
+// ETags from it, so a reload of an unchanged UI is a 304 instead of a full
+// index.html - and any rebuild changes it. Runs after inlineCss so the hash
+// covers the HTML that actually ships.
+function buildId() {
+  return {
+    name: 'build-id',
+    apply: 'build',
+    enforce: 'post',
+    generateBundle(_options, bundle) {
+      const hash = createHash('sha256')
+      for (const name of Object.keys(bundle).sort()) {
+        const item = bundle[name]
+        hash.update(name)
+        hash.update(item.type === 'chunk' ? item.code : item.source)
+      }
+      this.emitFile({ type: 'asset', fileName: 'build-id.txt', source: hash.digest('hex').slice(0, 16) })
+    },
+  }
+}
+
+// Brotli variants next to the gzip ones, opt-in (VYBES_BROTLI=1 npm run
+// build). Browsers only offer br over HTTPS, so on the classic ESP32 (HTTP
+// only) they would just take filesystem space. Same file filter and size
+// threshold as the gzip pass; emitted here rather than by a second
+// viteCompression, whose originals-deleting closeBundle would race this one.
+const COMPRESSIBLE = /\.(js|mjs|json|css|html)$/i
+const COMPRESS_THRESHOLD = 1025
+
+function brotliVariants() {
+  return {
+    name: 'brotli-variants',
+    apply: 'build',
+    enforce: 'post',
+    generateBundle(_options, bundle) {
+      if (!process.env.VYBES_BROTLI) return
+      for (const [name, item] of Object.entries(bundle)) {
+        if (!COMPRESSIBLE.test(name)) continue
+        const source = Buffer.from(item.type === 'chunk' ? item.code : item.source)
+        if (source.length < COMPRESS_THRESHOLD) continue
+        const compressed = brotliCompressSync(source, {
+          params: {
+            [zlibConstants.BROTLI_PARAM_QUALITY]: zlibConstants.BROTLI_MAX_QUALITY,
+            [zlibConstants.BROTLI_PARAM_SIZE_HINT]: source.length,
+          },
+        })
+        this.emitFile({ type: 'asset', fileName: `${name}.br`, source: compressed })
+      }
+    },
+  }
+}
+
 // https://vite.dev/config/
 export default defineConfig({
   plugins: [
     vue(),
     tailwindcss(),
     inlineCss(),
+    buildId(),
+    brotliVariants(),
     viteCompression({
       algorithm: 'gzip',
       ext: '.gz',
+      threshold: COMPRESS_THRESHOLD,
       deleteOriginFile: true,
     }),
   ],
@@ -12,6 +12,8 @@ const {
   CROSSOVER_TYPES,
   PRESET_VOLUME_DEFAULT,
   PROBE_SCHEDULE,
+  IR_CONTRACT,
+  LEVEL_LOG_CONTRACT,
   DEFAULT_TEMPLATE,
   buildPresetConfig,
   defaultDynamics,
@@ -31,6 +33,30 @@ const WS_PORT = process.env.WS_PORT !== undefined ? parseInt(process.env.WS_PORT
 app.use(cors());
 app.use(express.json());
 
+// Per-route request timing for GET /metrics (metrics.cpp on the ESP). Keyed
+// by the matched route pattern, so unmatched URLs (static files, 404s) are
+// not counted - the ESP only times its API routes too.
+const METRIC_BUCKETS = [0.001, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1, 2.5];
+const routeMetrics = new Map();
+app.use((req, res, next) => {
+  const started = process.hrtime.bigint();
+  res.on('finish', () => {
+    if (!req.route) return;
+    const key = `${req.method} ${req.route.path}`;
+    let m = routeMetrics.get(key);
+    if (!m) {
+      m = { path: req.route.path, method: req.method, buckets: METRIC_BUCKETS.map(() => 0), count: 0, errors: 0, sum: 0 };
+      routeMetrics.set(key, m);
+    }
+    const seconds = Number(process.hrtime.bigint() - started) / 1e9;
+    METRIC_BUCKETS.forEach((le, i) => { if (seconds <= le) m.buckets[i]++; });
+    m.count++;
+    m.sum += seconds;
+    if (res.statusCode >= 500) m.errors++;
+  });
+  next();
+});
+
 if (process.env.NODE_ENV === 'production') {
   // Production: serve built files
   app.use('/', expressStaticGzip('../WebUI/dist'));
@@ -50,8 +76,11 @@ if (process.env.NODE_ENV === 'production') {
 const dbPath = process.env.VYBES_DB_PATH || path.join(__dirname, 'vybes.db');
 const db = new sqlite3.Database(dbPath);
 
-// Mirrors MAX_PEQ_POINTS in ESP/esp-web-server/config.h (input EQ)
+// Mirrors MAX_PEQ_POINTS, MAX_PEQ_SETS and INPUT_EQ_SPL_MAX in
+// ESP/esp-web-server/config.h (input EQ)
 const MAX_PEQ_POINTS = MAX_INPUT_PEQ;
+const MAX_PEQ_SETS = 3;
+const INPUT_EQ_SPL_MAX = 120;
 
 const clamp = (value, lo, hi) => Math.min(hi, Math.max(lo, value));
 
@@ -68,6 +97,7 @@ const FIR_FILE_TAPS = {
   'fir_room2.txt': 4096,
   'fir_speaker1.txt': 2048,
   'fir_speaker2.txt': 2048,
+  'fir_sub.txt': 3072,
 };
 const firTaps = (file) => (file ? (FIR_FILE_TAPS[file] ?? 2048) : 0);
 
@@ -81,13 +111,22 @@ function mockFirErrors() {
   ];
 }
 
+// Ring-out a compiled output's crossover + PEQ is charged at
+// (FIR_COMPILE_TAIL_TAPS in teensy_protocol.h)
+const FIR_COMPILE_TAIL_TAPS = 1024;
+
 function firPool(config) {
-  const outputs = config.outputs.map((o, i) => ({ output: i, file: o.fir, taps: firTaps(o.fir) }));
+  const outputs = config.outputs.map((o, i) => ({
+    output: i, file: o.fir, taps: firTaps(o.fir), compiled: o.firCompiled === true,
+  }));
   return {
     total: FIR_TAP_POOL,
     // Charged in whole 128-tap partitions, matching the firmware's static
     // coefficient arena (FIR_POOL_CHARGE_QUANTUM in teensy_protocol.h)
-    used: outputs.reduce((sum, o) => sum + Math.ceil(o.taps / 128) * 128, 0),
+    used: outputs.reduce((sum, o) => {
+      const taps = o.compiled && o.taps > 0 ? o.taps + FIR_COMPILE_TAIL_TAPS : o.taps;
+      return sum + Math.ceil(taps / 128) * 128;
+    }, 0),
     outputs,
   };
 }
@@ -139,6 +178,7 @@ db.serialize(() => {
         ['right_gain', '100'],
         ['mute_state', 'off'],
         ['mute_percent', '100'],
+        ['level_log', '0'],
         ['tone_frequency', '1000'],
         ['tone_volume', '50'],
         ['noise_volume', '0'],
@@ -167,14 +207,25 @@ wss.on('listening', () => {
   console.log(`WebSocket server running on port ${wss.address().port}`);
 });
 
+// Broadcast traffic by stream, mirroring the ESP's websocket metrics
+const WS_STREAMS = ['events', 'rta', 'grm', 'vu', 'rtab'];
+const wsStreamStats = Object.fromEntries(WS_STREAMS.map((name) => [name, { messages: 0, bytes: 0 }]));
+
 // Broadcast to all connected WebSocket clients
 function broadcast(data) {
   const message = JSON.stringify(data);
+  let sent = 0;
   wss.clients.forEach(client => {
     if (client.readyState === WebSocket.OPEN) {
       client.send(message);
+      sent++;
     }
   });
+  if (sent > 0) {
+    const stats = wsStreamStats[WS_STREAMS.includes(data.type) ? data.type : 'events'];
+    stats.messages++;
+    stats.bytes += message.length * sent;
+  }
 }
 
 // WebSocket connection handler
@@ -187,6 +238,10 @@ wss.on('connection', (ws) => {
     if (text === 'rta:keepalive') {
       rtaLastKeepaliveAt = Date.now();
     }
+    // The analyzer's per-output spectra panel sends this
+    if (text === 'rtab:keepalive') {
+      rtabLastKeepaliveAt = Date.now();
+    }
     // Any page showing the compressor meters sends this
     if (text === 'grm:keepalive') {
       grmLastKeepaliveAt = Date.now();
@@ -243,17 +298,53 @@ setInterval(() => {
   broadcast({ type: 'rta', d: mockRtaFrameHex(Date.now()) });
 }, 100);
 
-// --- Mock GRM (compressor gain-reduction meter) streaming ---
-// Three bytes ("{type:'grm', d:'<6 hex>'}"), one per band, value =
-// dB of reduction * 8, matching the firmware. The bass band pumps like a
-// compressor riding explosions; mid barely moves; treble twitches.
+// --- Mock per-output spectra ---
+// "{type:'rtab', ch:<0-8>, d:'<242 hex chars>'}", one channel every 50ms
+// round-robin like the firmware. Channel 8 is the input mix (the RTA mock's
+// shape); each output gets a band-limited copy of it, as if behind a
+// crossover, so the UI shows distinct per-driver traces.
+let rtabLastKeepaliveAt = 0;
+let rtabNextChannel = 0;
+const MOCK_RTAB_PASSBANDS = [
+  [20, 80], [20, 80], [80, 2500], [80, 2500], [2500, 20000], [2500, 20000], [20, 20000], [20, 20000],
+];
+
+function mockRtabFrameHex(ch, t) {
+  const mix = mockRtaFrameHex(t + ch * 137);
+  if (ch >= MOCK_RTAB_PASSBANDS.length) return mix;
+  const [lo, hi] = MOCK_RTAB_PASSBANDS[ch];
+  let hex = '';
+  for (let i = 0; i < RTA_BAND_CENTERS.length; i++) {
+    const fc = RTA_BAND_CENTERS[i];
+    // 24dB/octave skirts outside the passband
+    const octavesOut = Math.max(0, Math.log2(lo / fc), Math.log2(fc / hi));
+    const v = parseInt(mix.slice(2 * i, 2 * i + 2), 16) - Math.round(48 * octavesOut);
+    hex += Math.max(0, v).toString(16).padStart(2, '0');
+  }
+  return hex;
+}
+
+setInterval(() => {
+  if (Date.now() - rtabLastKeepaliveAt > 5000) return;
+  const ch = rtabNextChannel;
+  rtabNextChannel = (ch + 1) % 9;
+  broadcast({ type: 'rtab', ch, d: mockRtabFrameHex(ch, Date.now()) });
+}, 50);
+
+// --- Mock GRM (gain-reduction meter) streaming ---
+// Eleven bytes ("{type:'grm', d:'<22 hex>'}"): one per compressor band, then
+// one per output limiter, value = dB of reduction * 8, matching the
+// firmware. The bass band pumps like a compressor riding explosions; mid
+// barely moves; treble twitches. The subs' limiters catch the odd peak.
 let grmLastKeepaliveAt = 0;
 
 function mockGrmFrameHex(t) {
   const bassDb = Math.max(0, 9 * Math.sin(t / 900)) + 1.5 * Math.random();
   const midDb = 0.4 + 0.8 * Math.random();
   const trebleDb = Math.max(0, 3 * Math.sin(t / 700 + 2)) + 0.8 * Math.random();
-  return [bassDb, midDb, trebleDb]
+  const limiterDb = Array.from({ length: 8 }, (_, ch) =>
+    ch >= 2 && ch < 4 ? Math.max(0, 6 * Math.sin(t / 1300 + ch) - 4) : 0);
+  return [bassDb, midDb, trebleDb, ...limiterDb]
     .map((db) => Math.max(0, Math.min(255, Math.round(db * 8))).toString(16).padStart(2, '0'))
     .join('');
 }
@@ -289,6 +380,48 @@ setInterval(() => {
   broadcast({ type: 'vu', d: mockVuFrame(Date.now()) });
 }, 50);
 
+// --- Mock Teensy runtime telemetry ---
+// Same shape as teensy_comm.cpp teensyStatsToJson (GET /status "teensy" and
+// the teensyStats message the ESP relays from every ping). A light, steady
+// DSP load with a little jitter; USB idle with clean counters.
+function mockTeensyStats() {
+  const cpu = 38 + 4 * Math.random();
+  return {
+    available: true,
+    ageMs: Math.floor(Math.random() * 5000),
+    cpu: Math.round(cpu * 10) / 10,
+    cpuMax: Math.round((cpu + 6) * 10) / 10,
+    audioBlocks: { used: 52, max: 71, total: 480 },
+    heap: { unclaimed: 180224, reclaimable: 4096 },
+    levelLog: {
+      active: levelLogActive,
+      us: levelLogActive ? 900 + Math.floor(200 * Math.random()) : 0,
+      maxUs: levelLogActive ? 2400 : 0,
+      writtenBytes: levelLogActive ? 320 : 0
+    },
+    audioClock: Math.floor((Date.now() - mockBootTime) * 44.1) >>> 0,
+    inputEqMaxUs: 40 + Math.floor(20 * Math.random()),
+    usb: {
+      streaming: false,
+      bufferedMs: 0,
+      targetMs: 8,
+      stepPpm: 0,
+      drops: 0,
+      starves: 0,
+      stops: 0,
+      recoveries: 0,
+      resyncs: 0,
+      allocFails: 0,
+      falseStops: 0,
+      maxGapUs: 0
+    }
+  };
+}
+
+setInterval(() => {
+  broadcast({ messageType: 'teensyStats', stats: mockTeensyStats() });
+}, 5000);
+
 // Helper functions
 function getSetting(key) {
   return new Promise((resolve, reject) => {
@@ -537,13 +670,102 @@ app.get('/status', async (req, res) => {
         minLargestFreeBlock: 48000,
         resetReason: 'power-on',
         lastRestartCause: 'none'
-      }
+      },
+      // Mirrors the ESP's config record store telemetry (fixed values)
+      storage: {
+        source: 'store',
+        bootLoadUs: 41000,
+        saves: 0,
+        lastSaveUs: 0,
+        lastSaveBytes: 0,
+        lastSaveRecords: 0,
+        totalBytesWritten: 0
+      },
+      presetCache: {
+        slots: 4,
+        resident: 1,
+        hits: 0,
+        pageIns: 0,
+        writeBacks: 0,
+        failures: 0
+      },
+      static: {
+        files: 0,
+        build: '',
+        ramCachedBytes: 0,
+        requests: 0,
+        notModified: 0,
+        ramHits: 0,
+        bytesSent: 0
+      },
+      // Mirrors mem_pool.h's transient allocation pools (fixed values)
+      memPools: {
+        classes: [
+          { blockSize: 64, blocks: 32, inUse: 0, peakInUse: 6, allocs: 0, exhausted: 0 },
+          { blockSize: 320, blocks: 8, inUse: 0, peakInUse: 2, allocs: 0, exhausted: 0 },
+          { blockSize: 2048, blocks: 3, inUse: 0, peakInUse: 1, allocs: 0, exhausted: 0 }
+        ],
+        oversize: 0
+      },
+      teensy: mockTeensyStats()
     });
   } catch (error) {
     res.status(500).json({ error: error.message });
   }
 });
 
+// Prometheus text exposition - metrics.cpp handleGetMetrics. Same metric
+// names and labels; the Teensy link and heap series are fixed values here.
+app.get('/metrics', (req, res) => {
+  const lines = [];
+  const family = (name, type, help) => lines.push(`# HELP ${name} ${help}`, `# TYPE ${name} ${type}`);
+  family('vybes_info', 'gauge', 'Firmware build, UI build and config version.');
+  lines.push('vybes_info{firmware="mock",ui="",config_version="4"} 1');
+  family('vybes_uptime_seconds', 'gauge', 'Time since boot.');
+  lines.push(`vybes_uptime_seconds ${((Date.now() - mockBootTime) / 1000).toFixed(3)}`);
+  family('vybes_heap_free_bytes', 'gauge', 'Free internal heap.');
+  lines.push('vybes_heap_free_bytes 132000');
+  family('vybes_heap_min_free_bytes', 'gauge', 'Lowest free internal heap since boot.');
+  lines.push('vybes_heap_min_free_bytes 50000');
+  family('vybes_heap_largest_free_block_bytes', 'gauge', 'Largest contiguous free internal block.');
+  lines.push('vybes_heap_largest_free_block_bytes 110000');
+  family('vybes_heap_min_largest_free_block_bytes', 'gauge', 'Lowest largest free block seen since boot.');
+  lines.push('vybes_heap_min_largest_free_block_bytes 48000');
+  family('vybes_teensy_queue_depth', 'gauge', 'Commands waiting for the Teensy UART.');
+  lines.push('vybes_teensy_queue_depth 0');
+  family('vybes_teensy_queue_high_water', 'gauge', 'Deepest the Teensy command queue has been since boot.');
+  lines.push('vybes_teensy_queue_high_water 0');
+  family('vybes_teensy_queue_capacity', 'gauge', 'Teensy command queue slots.');
+  lines.push('vybes_teensy_queue_capacity 250');
+  family('vybes_teensy_commands_total', 'counter', 'Teensy commands by outcome.');
+  for (const outcome of ['queued', 'coalesced', 'cancelled', 'dropped', 'sent']) {
+    lines.push(`vybes_teensy_commands_total{outcome="${outcome}"} 0`);
+  }
+  family('vybes_teensy_rx_lines_total', 'counter', 'Lines received from the Teensy and handled.');
+  lines.push('vybes_teensy_rx_lines_total 0');
+  family('vybes_teensy_rx_overflows_total', 'counter', 'Teensy lines dropped for overflowing the RX buffer.');
+  lines.push('vybes_teensy_rx_overflows_total 0');
+  family('vybes_websocket_clients', 'gauge', 'Connected live-updates clients by listener.');
+  lines.push(`vybes_websocket_clients{listener="http"} ${wss.clients.size}`, 'vybes_websocket_clients{listener="https"} 0');
+  family('vybes_websocket_messages_total', 'counter', 'Broadcasts queued by stream.');
+  for (const name of WS_STREAMS) lines.push(`vybes_websocket_messages_total{stream="${name}"} ${wsStreamStats[name].messages}`);
+  family('vybes_websocket_sent_bytes_total', 'counter', 'Broadcast payload bytes by stream, times the clients each was queued for.');
+  for (const name of WS_STREAMS) lines.push(`vybes_websocket_sent_bytes_total{stream="${name}"} ${wsStreamStats[name].bytes}`);
+  family('vybes_http_request_duration_seconds', 'histogram', 'API handler run time by route.');
+  for (const m of routeMetrics.values()) {
+    const labels = `path="${m.path}",method="${m.method}"`;
+    METRIC_BUCKETS.forEach((le, i) => lines.push(`vybes_http_request_duration_seconds_bucket{${labels},le="${le}"} ${m.buckets[i]}`));
+    lines.push(`vybes_http_request_duration_seconds_bucket{${labels},le="+Inf"} ${m.count}`);
+    lines.push(`vybes_http_request_duration_seconds_sum{${labels}} ${m.sum.toFixed(6)}`);
+    lines.push(`vybes_http_request_duration_seconds_count{${labels}} ${m.count}`);
+  }
+  family('vybes_http_request_errors_total', 'counter', 'Handler calls that failed.');
+  for (const m of routeMetrics.values()) {
+    lines.push(`vybes_http_request_errors_total{path="${m.path}",method="${m.method}"} ${m.errors}`);
+  }
+  res.type('text/plain; version=0.0.4; charset=utf-8').send(lines.join('\n') + '\n');
+});
+
 // Master volume - api_volume.cpp handlePutVolume. The value lives on a
 // preset, so without preset_name this writes the active one (the live master
 // volume); naming a preset sets the level it will play at instead.
@@ -681,7 +903,9 @@ app.put('/noise', async (req, res) => {
 // The mock can't make sound, but it replays the real device's event
 // sequence over the websocket ({messageType:'probeEvent', line:'...'}) on
 // the real schedule, so the wizard's whole flow is testable without
-// hardware (the analysis then finds no chirps, exercising that path).
+// hardware (the analysis then finds no chirps, exercising that path). With
+// capture=mic it follows DONE with the device's analysis: a RESULT per slot
+// (a fixed I/O latency plus a few cm of path per output) and ANALYZED.
 let probeTimers = [];
 
 function clearProbeTimers() {
@@ -697,6 +921,10 @@ app.put('/probe/delay/start', wrap(async (req, res) => {
       return res.status(400).json({ error: 'Level must be an integer 0-100' });
     }
   }
+  const capture = req.query.capture === undefined ? 'phone' : req.query.capture;
+  if (capture !== 'phone' && capture !== 'mic') {
+    return res.status(400).json({ error: 'Capture must be phone or mic' });
+  }
 
   const row = await dbGet("SELECT name, config FROM presets WHERE is_current = 1");
   const config = JSON.parse(row.config);
@@ -728,8 +956,18 @@ app.put('/probe/delay/start', wrap(async (req, res) => {
   });
   const doneMs = (preRollSamples + (order.length - 1) * spacingSamples + chirpSamples + tailSamples) * msPerSample;
   probeTimers.push(setTimeout(() => probeEvent('DONE'), doneMs));
+  if (capture === 'mic') {
+    order.forEach((ch, slot) => {
+      const lag = (412 + ch * 7.25 + (slot < forward.length ? 0.02 : -0.02)).toFixed(3);
+      probeTimers.push(setTimeout(() => probeEvent(`RESULT ${slot} ${ch} ${lag} -18.5 64.0`), doneMs + 50 * (slot + 1)));
+    });
+    probeTimers.push(setTimeout(() => {
+      probeTimers = [];
+      probeEvent('ANALYZED');
+    }, doneMs + 50 * (order.length + 1)));
+  }
 
-  res.json({ status: 'ok', ...PROBE_SCHEDULE, level, order });
+  res.json({ status: 'ok', ...PROBE_SCHEDULE, level, capture, order });
 }));
 
 app.put('/probe/delay/stop', wrap(async (req, res) => {
@@ -740,6 +978,146 @@ app.put('/probe/delay/stop', wrap(async (req, res) => {
   res.json({ status: 'ok' });
 }));
 
+// ===== Impulse response measurement - api_ir.cpp =====
+// Replays the device's irEvent sequence on its real capture timing (the
+// deconvolution's pace is the card's, so its progress steps are nominal).
+// No file is written; DONE names the next ir-NNN.wav and a peak at ~5ms.
+let irTimers = [];
+let irRuns = 0;
+
+function clearIrTimers() {
+  irTimers.forEach(clearTimeout);
+  irTimers = [];
+}
+
+app.put('/measure/ir/start', wrap(async (req, res) => {
+  const output = Number(req.query.output);
+  if (req.query.output === undefined || !Number.isInteger(output) || output < 0 || output >= NUM_OUTPUTS) {
+    return res.status(400).json({ error: 'Output must be an integer 0-7' });
+  }
+  let level = 50;
+  if (req.query.level !== undefined) {
+    level = Number(req.query.level);
+    if (!Number.isInteger(level) || level < 0 || level > 100) {
+      return res.status(400).json({ error: 'Level must be an integer 0-100' });
+    }
+  }
+
+  const row = await dbGet("SELECT name, config FROM presets WHERE is_current = 1");
+  const config = JSON.parse(row.config);
+  if (!config.outputs[output] || !config.outputs[output].enabled) {
+    return res.status(400).json({ error: 'Output is not enabled in the active preset' });
+  }
+
+  const { sampleRate, sweepSamples, captureSamples, preSamples, settleMs } = IR_CONTRACT;
+  clearIrTimers();
+  const irEvent = (line) => broadcast({ messageType: 'irEvent', line });
+  irEvent(`START ${output} ${sweepSamples} ${captureSamples}`);
+  const capturedMs = settleMs + (captureSamples * 1000) / sampleRate;
+  irTimers.push(setTimeout(() => irEvent('CAPTURED'), capturedMs));
+  for (let p = 10; p <= 100; p += 10) {
+    irTimers.push(setTimeout(() => irEvent(`PROGRESS ${p}`), capturedMs + p * 40));
+  }
+  const name = `ir-${String(++irRuns).padStart(3, '0')}.wav`;
+  irTimers.push(setTimeout(() => {
+    irTimers = [];
+    irEvent(`DONE ${name} ${preSamples + 220} -6.0`);
+  }, capturedMs + 4000 + 10));
+
+  res.json({ status: 'ok', output, level, ...IR_CONTRACT });
+}));
+
+app.put('/measure/ir/stop', wrap(async (req, res) => {
+  if (irTimers.length > 0) {
+    clearIrTimers();
+    broadcast({ messageType: 'irEvent', line: 'STOP' });
+  }
+  res.json({ status: 'ok' });
+}));
+
+// --- Long-term level log (api_level_log.cpp) ---
+// The mock's log pretends to hold two hours from before the server started
+// and grows a record a second from then on; range reads synthesize a quiet
+// pink-ish spectrum with a louder stretch every ten minutes.
+const LEVEL_LOG_HISTORY_S = 7200;
+let levelLogActive = false;
+
+function levelLogNext() {
+  return LEVEL_LOG_HISTORY_S + Math.floor((Date.now() - mockBootTime) / 1000);
+}
+
+function levelLogPointHex(seq, step) {
+  const bytes = Buffer.alloc(5 + 2 + 3 + LEVEL_LOG_CONTRACT.bands);
+  const loud = Math.floor(seq / 600) % 3 === 0;
+  bytes.writeUInt32LE(Math.max(0, seq - LEVEL_LOG_HISTORY_S), 0);
+  bytes[4] = 0x04 | 0x08 | (loud && step < 60 ? 0x01 : 0);
+  bytes[5] = loud ? 230 : 170;
+  bytes[6] = loud ? 226 : 166;
+  bytes[7] = loud ? 24 : 0;
+  bytes[8] = loud ? 12 : 0;
+  bytes[9] = 0;
+  for (let j = 0; j < LEVEL_LOG_CONTRACT.bands; j++) {
+    const dB = (loud ? -30 : -50) - j * 0.9;
+    bytes[10 + j] = Math.max(0, Math.min(255, Math.round((dB + 100) * 2)));
+  }
+  return bytes.toString('hex');
+}
+
+// LevelLog::clampRange
+function clampLevelLogRange(from, count, step, first, next) {
+  let start = from < 0 ? next + from : from;
+  let end = start + count;
+  start = Math.min(Math.max(start, first), next);
+  end = Math.min(end, next);
+  const served = Math.max(0, end - start);
+  const minStep = Math.ceil(served / LEVEL_LOG_CONTRACT.maxPoints);
+  return { from: start, count: served, step: Math.max(step, minStep, 1) };
+}
+
+app.put('/log/levels', wrap(async (req, res) => {
+  const { enabled } = req.query;
+  if (enabled !== '0' && enabled !== '1') {
+    return res.status(400).json({ error: 'Enabled must be 0 or 1' });
+  }
+  levelLogActive = enabled === '1';
+  await setSetting('level_log', enabled);
+  const payload = { messageType: 'levelLogChanged', enabled: levelLogActive };
+  broadcast(payload);
+  broadcast({ messageType: 'levelLogEvent', line: `STATE ${enabled} 0 ${levelLogNext()}` });
+  res.json(payload);
+}));
+
+app.put('/log/levels/query', wrap(async (req, res) => {
+  const parsed = {};
+  const limits = {
+    from: [-LEVEL_LOG_CONTRACT.capacity, 0x7FFFFFFF, -3600],
+    count: [1, LEVEL_LOG_CONTRACT.capacity, 3600],
+    step: [1, LEVEL_LOG_CONTRACT.capacity, 1],
+  };
+  for (const [name, [min, max, fallback]] of Object.entries(limits)) {
+    const raw = req.query[name];
+    const value = raw === undefined ? fallback : Number(raw);
+    if (raw === '' || !Number.isInteger(value) || value < min || value > max) {
+      return res.status(400).json({ error: `Invalid ${name}` });
+    }
+    parsed[name] = value;
+  }
+
+  const next = levelLogNext();
+  const range = clampLevelLogRange(parsed.from, parsed.count, parsed.step, 0, next);
+  const levelLogEvent = (line) => broadcast({ messageType: 'levelLogEvent', line });
+  levelLogEvent(`STATE ${levelLogActive ? 1 : 0} 0 ${next}`);
+  levelLogEvent(`RANGE ${range.from} ${range.count} ${range.step}`);
+  let points = 0;
+  for (let seq = range.from; seq < range.from + range.count; seq += range.step) {
+    levelLogEvent(`PT ${seq} ${levelLogPointHex(seq, range.step)}`);
+    points++;
+  }
+  levelLogEvent(`END ${points}`);
+
+  res.json({ status: 'ok', ...parsed, ...LEVEL_LOG_CONTRACT });
+}));
+
 // Speaker & Input gains - api_gains.cpp handlePutSpeakerGain: query params
 // speaker + value, 0-100 percent (the ESP stores value/100 internally)
 app.put('/gains/speaker', async (req, res) => {
@@ -1470,6 +1848,212 @@ app.put('/preset/output/fir', wrap(async (req, res) => {
   }));
 }));
 
+// Compiled mode: crossover + PEQ folded into the output's FIR at load time.
+// Priced at the full tail like the firmware's ESP; the mock has no Teensy
+// to report what the tail cut off.
+app.put('/preset/output/fir/compiled', wrap(async (req, res) => {
+  const ctx = await requirePresetOutput(req, res);
+  if (!ctx) return;
+  const compiled = parseOnOff(req.query.state);
+  if (compiled === null) {
+    return res.status(400).json({ error: 'Invalid state' });
+  }
+
+  const candidate = JSON.parse(JSON.stringify(ctx.preset.config));
+  candidate.outputs[ctx.outputIndex].firCompiled = compiled;
+  const pool = firPool(candidate);
+  if (pool.used > pool.total) {
+    return res.status(409).json({
+      error: `FIR tap pool exceeded: ${pool.used} of ${pool.total} taps`,
+      used: pool.used,
+      total: pool.total,
+    });
+  }
+
+  await saveConfigPath(ctx.preset.name, `$.outputs[${ctx.outputIndex}].firCompiled`, compiled);
+  res.json(broadcastOutputChanged(ctx.preset.name, ctx.outputIndex, { firCompiled: compiled }, {
+    firPool: { total: pool.total, used: pool.used },
+  }));
+}));
+
+// Batched edits: an ordered array of output/crossover ops applied to one
+// candidate config, validated op by op like the single endpoints and
+// against hpFloor once at the end. All or nothing; one broadcast
+// (presetBatchChanged) listing only what actually changed.
+const BATCH_MAX_OPS = 64;
+const BATCH_OUTPUT_FIELDS = ['gainDb', 'mute', 'invert', 'enabled', 'delayUs', 'source', 'eqEnabled'];
+
+function resolvedFilterFreq(section, crossovers) {
+  if (section.mode === 'manual') return Number(section.freq) || 0;
+  if (section.mode === 'xover') return crossovers.find((x) => x.id === section.xover)?.freq ?? 0;
+  return 0;
+}
+
+function applyBatchOp(config, op, effects) {
+  const fail = (status, error, extra = {}) => ({ status, error, ...extra });
+  if (!op || typeof op !== 'object' || Array.isArray(op)) return fail(400, 'Unknown op');
+
+  if (op.op === 'crossover') {
+    const point = config.crossovers.find((x) => x.id === op.id);
+    if (!point) return fail(404, 'Crossover point not found');
+    if (typeof op.frequency !== 'number') return fail(400, 'Missing or invalid frequency');
+    const freq = Math.trunc(op.frequency);
+    if (freq < point.min || freq > point.max) {
+      return fail(400, `Crossover frequency must be between ${point.min} and ${point.max} Hz`);
+    }
+    if (point.locked && op.confirm !== true) {
+      return fail(409, `Crossover point ${point.id} is locked. Re-send with confirm=true to apply.`, { locked: true });
+    }
+    point.freq = freq;
+    return null;
+  }
+
+  if (!Number.isInteger(op.output) || op.output < 0 || op.output >= NUM_OUTPUTS) {
+    return fail(400, `Output must be an integer 0-${NUM_OUTPUTS - 1}`);
+  }
+  const output = config.outputs[op.output];
+
+  switch (op.op) {
+    case 'gain':
+      if (typeof op.value !== 'number') return fail(400, 'Missing or invalid value');
+      output.gainDb = clamp(op.value, GAIN_DB_MIN, GAIN_DB_MAX);
+      return null;
+    case 'delay':
+      if (typeof op.value !== 'number' || op.value < 0 || op.value > MAX_DELAY_US) {
+        return fail(400, `Delay must be between 0 and ${MAX_DELAY_US} microseconds`);
+      }
+      output.delayUs = op.value;
+      return null;
+    case 'mute':
+    case 'invert':
+    case 'enabled':
+    case 'eqEnabled':
+      if (typeof op.state !== 'boolean') return fail(400, 'Invalid state');
+      output[op.op] = op.state;
+      if (op.op === 'enabled') effects.structural = true;
+      return null;
+    case 'source':
+      if (typeof op.left !== 'number' || typeof op.right !== 'number') {
+        return fail(400, 'Expected numeric left and right');
+      }
+      output.source = { left: clamp(op.left, 0, 1), right: clamp(op.right, 0, 1) };
+      effects.structural = true;
+      return null;
+    case 'filter': {
+      if (!['hp', 'lp'].includes(op.which)) return fail(400, "Parameter 'which' must be 'hp' or 'lp'");
+      if (op.mode === 'off') {
+        const previous = output[op.which];
+        output[op.which] = previous.xover ? { mode: 'off', xover: previous.xover } : { mode: 'off' };
+      } else if (op.mode === 'xover') {
+        if (!config.crossovers.some((x) => x.id === op.xover)) return fail(400, 'Unknown crossover point');
+        output[op.which] = { mode: 'xover', xover: op.xover };
+      } else if (op.mode === 'manual') {
+        const freq = Number(op.freq);
+        const type = op.type || 'LR4';
+        if (!Number.isFinite(freq) || freq < 20 || freq > 20000) {
+          return fail(400, 'Manual filter frequency must be between 20 and 20000 Hz');
+        }
+        if (!CROSSOVER_TYPES.includes(type)) {
+          return fail(400, `Filter type must be one of ${CROSSOVER_TYPES.join(', ')}`);
+        }
+        output[op.which] = { mode: 'manual', freq, type };
+      } else {
+        return fail(400, "Filter mode must be 'off', 'xover' or 'manual'");
+      }
+      effects.structural = true;
+      return null;
+    }
+    case 'eqPoint': {
+      const id = Number.isInteger(op.id) ? op.id : -1;
+      if (id < 0 || id >= MAX_OUTPUT_PEQ) return fail(400, 'PEQ point ID out of bounds');
+      if (id > output.peq.length) return fail(400, 'PEQ point ID would leave a gap');
+      output.peq[id] = {
+        freq: clamp(Number(op.freq ?? 1000), 20, 20000),
+        gain: clamp(Number(op.gain ?? 0), -15, 15),
+        q: clamp(Number(op.q ?? 1), 0.1, 10),
+      };
+      return null;
+    }
+    default:
+      return fail(400, 'Unknown op');
+  }
+}
+
+app.put('/preset/batch', wrap(async (req, res) => {
+  const presetName = req.query.preset_name;
+  if (!presetName) {
+    return res.status(400).json({ error: 'Missing preset_name parameter' });
+  }
+  const ops = req.body;
+  if (!Array.isArray(ops)) {
+    return res.status(400).json({ error: 'Expected a JSON array of operations' });
+  }
+  if (ops.length > BATCH_MAX_OPS) {
+    return res.status(400).json({ error: 'Too many operations' });
+  }
+  const preset = await loadPreset(presetName);
+  if (!preset) {
+    return res.status(404).json({ error: 'Preset not found' });
+  }
+
+  const before = preset.config;
+  const candidate = JSON.parse(JSON.stringify(before));
+  const effects = { structural: false };
+  for (let i = 0; i < ops.length; i++) {
+    const failure = applyBatchOp(candidate, ops[i], effects);
+    if (failure) {
+      const { status, error, ...extra } = failure;
+      const body = { error: `Operation ${i}: ${error}`, ...extra };
+      if (extra.locked) body.op = i;
+      return res.status(status).json(body);
+    }
+  }
+  const violation = hpFloorViolation(candidate);
+  if (violation) {
+    return res.status(409).json({ error: violation });
+  }
+
+  const same = (a, b) => JSON.stringify(a) === JSON.stringify(b);
+  const outputs = [];
+  candidate.outputs.forEach((output, index) => {
+    const previous = before.outputs[index];
+    const changes = {};
+    for (const field of BATCH_OUTPUT_FIELDS) {
+      if (!same(previous[field], output[field])) changes[field] = output[field];
+    }
+    // A section edit, or a referenced crossover that moved
+    if (['hp', 'lp'].some((w) => !same(previous[w], output[w])
+        || resolvedFilterFreq(previous[w], before.crossovers) !== resolvedFilterFreq(output[w], candidate.crossovers))) {
+      changes.hp = output.hp;
+      changes.lp = output.lp;
+    }
+    if (!same(previous.peq, output.peq)) changes.peq = output.peq;
+    if (Object.keys(changes).length > 0) outputs.push({ output: index, changes });
+  });
+  const crossovers = candidate.crossovers
+    .filter((point, index) => point.freq !== before.crossovers[index].freq)
+    .map((point) => ({ id: point.id, crossoverFreq: point.freq }));
+
+  const payload = {
+    messageType: 'presetBatchChanged',
+    presetName,
+    status: 'ok',
+    applied: ops.length,
+    outputs,
+    crossovers,
+  };
+  if (outputs.length === 0 && crossovers.length === 0) {
+    return res.json(payload);
+  }
+  if (effects.structural && candidate.template !== 'custom') {
+    candidate.template = 'custom';
+    payload.template = 'custom';
+  }
+  await saveConfig(presetName, candidate);
+  broadcast(payload);
+  res.json(payload);
+}));
+
 // Tap pool status for a preset
 app.get('/preset/fir/pool', wrap(async (req, res) => {
   const presetName = req.query.preset_name;
@@ -1588,16 +2172,28 @@ app.post('/comp/solo', wrap(async (req, res) => {
 
 // ===== Input EQ (shared L/R bus: preference curve + SPL sets) =====
 
-/** Find the spl=0 set index, creating the set if needed. */
-function getOrCreateSpl0SetIndex(config) {
-  let index = config.inputEq.sets.findIndex((s) => s.spl === 0);
+/**
+ * Find the set index for an SPL, creating the set if needed; -1 when all
+ * MAX_PEQ_SETS slots hold other levels.
+ */
+function getOrCreateSplSetIndex(config, spl) {
+  let index = config.inputEq.sets.findIndex((s) => s.spl === spl);
   if (index === -1) {
-    config.inputEq.sets.push({ spl: 0, points: [] });
+    if (config.inputEq.sets.length >= MAX_PEQ_SETS) return -1;
+    config.inputEq.sets.push({ spl, points: [] });
     index = config.inputEq.sets.length - 1;
   }
   return index;
 }
 
+/** The optional spl query parameter (0-120, default 0); null if invalid. */
+function parseSplParam(value) {
+  if (value === undefined) return 0;
+  if (!/^\d+$/.test(String(value))) return null;
+  const spl = Number(value);
+  return spl <= INPUT_EQ_SPL_MAX ? spl : null;
+}
+
 // EQ Points (JSON body): array of points, values clamped, replies 204
 app.put('/preset/eq', wrap(async (req, res) => {
   const presetName = req.query.preset_name;
@@ -1617,6 +2213,10 @@ app.put('/preset/eq', wrap(async (req, res) => {
   if (!preset) {
     return res.status(404).json({ error: 'Preset not found' });
   }
+  const spl = parseSplParam(req.query.spl);
+  if (spl === null) {
+    return res.status(400).json({ error: 'spl out of range' });
+  }
 
   const points = pointsArray.map((point) => ({
     freq: clamp(Number(point.freq ?? 1000), 20, 20000),
@@ -1624,7 +2224,10 @@ app.put('/preset/eq', wrap(async (req, res) => {
     q: clamp(Number(point.q ?? 1), 0.1, 10)
   }));
 
-  const setIndex = getOrCreateSpl0SetIndex(preset.config);
+  const setIndex = getOrCreateSplSetIndex(preset.config, spl);
+  if (setIndex === -1) {
+    return res.status(507).json({ error: 'No available EQ set slots for this spl.' });
+  }
   preset.config.inputEq.sets[setIndex].points = points;
   await saveConfigPath(presetName, '$.inputEq.sets', preset.config.inputEq.sets);
 
@@ -1633,7 +2236,7 @@ app.put('/preset/eq', wrap(async (req, res) => {
     presetName,
     status: 'ok',
     eqType: 'pref',
-    spl: 0,
+    spl,
     numPoints: points.length
   });
 
@@ -1664,7 +2267,14 @@ app.put('/preset/eq/point', wrap(async (req, res) => {
     return res.status(404).json({ error: 'Preset not found' });
   }
 
-  const setIndex = getOrCreateSpl0SetIndex(preset.config);
+  const spl = parseSplParam(req.query.spl);
+  if (spl === null) {
+    return res.status(400).json({ error: 'spl out of range' });
+  }
+  const setIndex = getOrCreateSplSetIndex(preset.config, spl);
+  if (setIndex === -1) {
+    return res.status(507).json({ error: 'No available EQ set slots for this spl.' });
+  }
   const points = preset.config.inputEq.sets[setIndex].points;
   if (id > points.length) {
     return res.status(400).json({ error: 'PEQ point ID would leave a gap' });
@@ -10,7 +10,7 @@
  */
 
 const NUM_OUTPUTS = 8;
-const FIR_TAP_POOL = 12288;
+const FIR_TAP_POOL = 15360;
 const MAX_OUTPUT_PEQ = 10;
 const MAX_INPUT_PEQ = 15;
 const MAX_DELAY_US = 20000;
@@ -31,6 +31,32 @@ const PROBE_SCHEDULE = {
   fadeSamples: 512,
   f0: 60.0,
   f1: 8000.0,
+  minConfidence: 8,
+};
+
+// Impulse response measurement sweep/result contract - must match the IR_*
+// constants in ESP/esp-web-server/teensy_protocol.h.
+const IR_CONTRACT = {
+  sampleRate: 44100,
+  sweepSamples: 131072,
+  f0: 20.0,
+  f1: 20000.0,
+  captureSamples: 131072 + 16384 - 512,
+  preSamples: 512,
+  lengthSamples: 16384,
+  settleMs: 500,
+  directory: '/measurements',
+};
+
+// api_level_log.cpp handlePutLevelLogQuery's decoding contract
+// (teensy_protocol.h LEVEL_LOG_*)
+const LEVEL_LOG_CONTRACT = {
+  intervalMs: 1000,
+  capacity: 604800,
+  bands: 31,
+  firstBandHz: 19.95,
+  bandsPerDecade: 10,
+  maxPoints: 300,
 };
 
 // A disabled, silent output slot
@@ -45,6 +71,7 @@ function emptyOutput(index) {
     peq: [],
     eqEnabled: true,
     fir: '',
+    firCompiled: false,
     delayUs: 0,
     gainDb: 0,
     invert: false,
@@ -144,10 +171,12 @@ const TEMPLATES = {
 const DEFAULT_TEMPLATE = '2.1';
 
 // Default spl=0 input EQ set: three flat points (matches the old ESP
-// handlePostPresetCreate defaults)
+// handlePostPresetCreate defaults). refSpl: dB SPL at full volume, which
+// places the volume between the SPL sets (INPUT_EQ_REF_SPL_DEFAULT)
 function defaultInputEq() {
   return {
     enabled: false,
+    refSpl: 100,
     sets: [
       {
         spl: 0,
@@ -228,6 +257,8 @@ module.exports = {
   CROSSOVER_TYPES,
   PRESET_VOLUME_DEFAULT,
   PROBE_SCHEDULE,
+  IR_CONTRACT,
+  LEVEL_LOG_CONTRACT,
   DEFAULT_TEMPLATE,
   buildPresetConfig,
   defaultDynamics,